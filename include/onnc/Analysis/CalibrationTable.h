@@ -0,0 +1,105 @@
+//===- CalibrationTable.h -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_ANALYSIS_CALIBRATION_TABLE_H
+#define ONNC_ANALYSIS_CALIBRATION_TABLE_H
+#include <onnc/Support/Path.h>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace onnc {
+
+/** \class CalibrationTable
+ *  \brief The activation range of the values of a network.
+ *
+ *  The threshold of a value is the largest magnitude it took over a set of
+ *  sample inputs, so a symmetric quantization maps [-threshold, threshold]
+ *  onto the int8 range. Tables are read and written in the protobuf text
+ *  format of the BM1880 calibration table (NetCalibrationParameter in
+ *  common_calibration2.proto): every layer lists the values it outputs as
+ *  blob_params with their threshold_y.
+ *
+ *  \code
+ *  name: "resnet"
+ *  layer {
+ *    name: "conv1"
+ *    threshold_y: 6.5
+ *    blob_param {
+ *      name: "conv1_out"
+ *      threshold_y: 6.5
+ *    }
+ *  }
+ *  \endcode
+ *
+ *  Reading keeps only the names and the thresholds; the other fields of a
+ *  BM1880 table, such as right shift widths, are skipped.
+ */
+class CalibrationTable
+{
+public:
+  struct Blob
+  {
+    std::string name;
+    float threshold;
+  };
+
+  typedef std::vector<Blob> BlobList;
+
+  struct Layer
+  {
+    std::string name;
+    BlobList blobs;
+  };
+
+  typedef std::vector<Layer> LayerList;
+
+public:
+  CalibrationTable() : m_Name(), m_Layers(), m_Thresholds() { }
+
+  const std::string& name() const { return m_Name; }
+
+  void setName(const std::string& pName) { m_Name = pName; }
+
+  const LayerList& layers() const { return m_Layers; }
+
+  /// Append layer pName outputting pBlobs.
+  void addLayer(const std::string& pName, const BlobList& pBlobs);
+
+  /// @retval true If the table has the threshold of value pName.
+  bool hasThreshold(const std::string& pName) const;
+
+  /// @return The threshold of value pName, or 0 if there is none.
+  float getThreshold(const std::string& pName) const;
+
+  /// Replace the table with the one in pText.
+  /// @retval false If pText is not a calibration table in text format. The
+  ///         table is left empty.
+  bool parse(const std::string& pText);
+
+  /// Replace the table with the one in pFile.
+  /// @retval false If pFile can not be read or parsed.
+  bool read(const Path& pFile);
+
+  /// Print the table in text format.
+  void print(std::ostream& pOS) const;
+
+  /// @retval false If pFile can not be written.
+  bool write(const Path& pFile) const;
+
+  void clear();
+
+private:
+  std::string m_Name;
+  LayerList m_Layers;
+  std::unordered_map<std::string, float> m_Thresholds;
+};
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,100 @@
+//===- CompiledModuleCache.h ----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_CODEGEN_COMPILED_MODULE_CACHE_H
+#define ONNC_CODEGEN_COMPILED_MODULE_CACHE_H
+#include <onnc/Core/ModulePass.h>
+#include <onnc/Support/Path.h>
+#include <string>
+
+namespace onnc {
+
+class TargetOptions;
+
+/** \class CompiledModuleCache
+ *  \brief An on-disk cache of modules which have been through memory
+ *         allocation.
+ *
+ *  An entry is keyed by a hash of the build of libonnc, the model content,
+ *  the target and the options that change compilation. It holds the compute
+ *  graph, the values and the memory operands of the lowered module, so a
+ *  warm start loads the module instead of parsing and compiling the model,
+ *  and goes straight to code emission or to the interpreter.
+ *
+ *  Weights the compilation doesn't change stay in the model and in its
+ *  external data files; the entry refers to them and the loaded module maps
+ *  them. Weights the compilation rewrites are stored in the entry, which is
+ *  mapped as well.
+ */
+class CompiledModuleCache
+{
+public:
+  /// @param pDirectory The cache directory. It is created on first store.
+  CompiledModuleCache(const Path& pDirectory);
+
+  /// @return The key of @ref pModel compiled for @ref pTarget with
+  ///         @ref pOptions, or an empty string if the model can't be read.
+  /// @param pExtra Other settings that change compilation.
+  static std::string key(const Path& pModel, const std::string& pTarget,
+                         const TargetOptions& pOptions,
+                         const std::string& pExtra = std::string());
+
+  /// Load the entry of @ref pKey, computed from @ref pModel, into the empty
+  /// @ref pModule.
+  /// @retval false If there is no valid entry. @ref pModule may have been
+  ///         changed, so discard it and compile the model.
+  bool load(const std::string& pKey, const Path& pModel,
+            Module& pModule) const;
+
+  /// Store @ref pModule, compiled from @ref pModel, as the entry of
+  /// @ref pKey.
+  /// @retval false If the module can't be stored, for example if it has
+  ///         operators the cache doesn't know.
+  bool store(const std::string& pKey, const Path& pModel,
+             Module& pModule) const;
+
+  const Path& directory() const { return m_Directory; }
+
+private:
+  Path getPath(const std::string& pKey) const;
+
+private:
+  Path m_Directory;
+};
+
+/** \class StoreCompiledModule
+ *  \brief Store the module in a cache entry. Add it after memory
+ *         allocation.
+ */
+class StoreCompiledModule : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  StoreCompiledModule(const CompiledModuleCache& pCache,
+                      const std::string& pKey, const Path& pModel)
+    : ModulePass(ID), m_Cache(pCache), m_Key(pKey), m_Model(pModel) {
+  }
+
+  StringRef getPassName() const override { return "StoreCompiledModule"; }
+
+  Pass::ReturnType runOnModule(Module &pModule) override;
+
+private:
+  const CompiledModuleCache& m_Cache;
+  std::string m_Key;
+  Path m_Model;
+};
+
+ModulePass* CreateStoreCompiledModulePass(const CompiledModuleCache& pCache,
+                                          const std::string& pKey,
+                                          const Path& pModel);
+
+} // namespace onnc
+
+#endif
@@ -8,15 +8,27 @@
 #ifndef ONNC_CODEGEN_FUSE_INPLACE_VALUE_H
 #define ONNC_CODEGEN_FUSE_INPLACE_VALUE_H
 #include <onnc/Core/ModulePass.h>
+#include <vector>
 
 namespace onnc {
 
 class ComputeOperator;
+class MemAllocData;
 
 /** \class FuseInplaceValue
  *  \brief If operator's input memory object can be directly reused by output,
  *         fuse input and output value into single value.
  *
+ *  The backend tells which input/output pairs of an operator may share
+ *  memory. A pair is taken when its input has no other user, is neither a
+ *  weight nor a graph input, and has the size and type of the output:
+ *
+ *  - If both have the same dimensions, the output value is replaced by the
+ *    input value.
+ *  - Otherwise, if the pair is a view, i.e. the output is the input
+ *    reinterpreted, the output is recorded in MemAllocData as an alias of
+ *    the input, and memory allocators give both one region.
+ *
  *  \note The pass break SSA form, the compute graph is no longer valid in
  *        terms of graph topology.
  */
@@ -25,11 +37,35 @@ class FuseInplaceValue : public ModulePass
 public:
   static char ID;
 
+  struct InplacePair
+  {
+    unsigned int input;
+    unsigned int output;
+
+    /// The kernel copies nothing when input and output share memory.
+    bool isView;
+  };
+
+  typedef std::vector<InplacePair> InplacePairs;
+
+  /// Append the pairs of pOp, most preferred first, to pPairs.
+  typedef void (*GetInplacePairs)(const ComputeOperator& pOp,
+                                  InplacePairs& pPairs);
+
+  /// The 1st input and the 1st output of a fusible operator are a pair.
   typedef bool (*IsFusible)(const ComputeOperator& pOp);
 
 public:
   FuseInplaceValue(IsFusible pCheckFusibleFn = nullptr)
-    : ModulePass(ID), m_IsFusibleFn(pCheckFusibleFn) {
+    : ModulePass(ID), m_IsFusibleFn(pCheckFusibleFn),
+      m_GetInplacePairsFn(nullptr), m_MemAllocData(nullptr),
+      m_NumOfFused(0), m_NumOfViews(0) {
+  }
+
+  FuseInplaceValue(GetInplacePairs pGetInplacePairsFn)
+    : ModulePass(ID), m_IsFusibleFn(nullptr),
+      m_GetInplacePairsFn(pGetInplacePairsFn), m_MemAllocData(nullptr),
+      m_NumOfFused(0), m_NumOfViews(0) {
   }
 
   StringRef getPassName() const override { return "FuseInplaceValue"; }
@@ -38,13 +74,34 @@ public:
 
   Pass::ReturnType runOnComputeGraph(ComputeGraph& pCG);
 
+  void getAnalysisUsage(AnalysisUsage& pUsage) const override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  /// @return The number of outputs sharing memory with an input.
+  unsigned int getNumOfFused() const { return m_NumOfFused; }
+
+  /// @return The number of the fused outputs that are views.
+  unsigned int getNumOfViews() const { return m_NumOfViews; }
+
+private:
+  void getInplacePairs(const ComputeOperator& pOp,
+                       InplacePairs& pPairs) const;
+
 private:
   IsFusible m_IsFusibleFn;
+  GetInplacePairs m_GetInplacePairsFn;
+  MemAllocData* m_MemAllocData;
+  unsigned int m_NumOfFused;
+  unsigned int m_NumOfViews;
 };
 
 ModulePass*
 CreateFuseInplaceValuePass(FuseInplaceValue::IsFusible pCheckFusibleFn);
 
+ModulePass*
+CreateFuseInplaceValuePass(FuseInplaceValue::GetInplacePairs pGetPairsFn);
+
 } // namespace onnc
 
-#endif
\ No newline at end of file
+#endif
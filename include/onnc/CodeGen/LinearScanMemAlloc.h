@@ -9,17 +9,25 @@
 #define ONNC_CODEGEN_LINEAR_SCAN_MEM_ALLOC_H
 #include <onnc/Core/ModulePass.h>
 #include <onnc/CodeGen/MemAllocData.h>
+#include <onnc/Target/TargetOptions.h>
 
 namespace onnc {
 
 class LiveInterval;
 class LiveIntervalsData;
-class LiveValueMatrix;
+class LiveIntervalTree;
 class TargetBackend;
 class TargetMemInfo;
 
 /** \class LinearScanMemAlloc
  *  \brief Linear memory allocation for each value considering value's liveness.
+ *
+ *  Values whose live intervals overlap get disjoint regions. The values
+ *  interfering with the one being placed are found in a LiveIntervalTree.
+ *  The order of placement and the choice among free blocks depend on the
+ *  TargetOptions::MemAllocStrategy of the target. An alias recorded in
+ *  MemAllocData is placed together with its base, over the union of their
+ *  live intervals.
  */
 class LinearScanMemAlloc : public ModulePass
 {
@@ -32,9 +40,13 @@ public:
 
   typedef std::vector<LiveInterval*> LIs;
 
+  typedef TargetOptions::MemAllocStrategy Strategy;
+
 public:
   LinearScanMemAlloc(TargetBackend* pTarget = nullptr);
 
+  LinearScanMemAlloc(TargetBackend* pTarget, Strategy pStrategy);
+
   StringRef getPassName() const override { return "LinearScanMemAlloc"; }
 
   Pass::ReturnType runOnModule(Module &pModule) override;
@@ -43,17 +55,42 @@ public:
 
   void print(OStream& pOS, const Module* pModule) const override;
 
+  /// @return The highest end address of the allocated regions.
+  uint64_t getFootprint() const { return m_Footprint; }
+
+  /// @return The highest total size of the values live at the same time, a
+  ///         lower bound of the footprint.
+  uint64_t getPeakLiveSize() const { return m_PeakLiveSize; }
+
+  /// @return The share of the footprint that is never used at the peak,
+  ///         1 - peak live size / footprint.
+  double getFragmentation() const;
+
 private:
-  AllocEntries getSortedAllocatedRegions(const LIs& pLIs) const;
+  struct Request
+  {
+    const LiveInterval* li;
+    uint64_t size;
+    uint64_t alignment;
+    AllocEntry alloc;
+  };
+
+  typedef std::vector<Request> Requests;
+
+  /// Place all pRequests with pStrategy.
+  /// @return The footprint.
+  uint64_t allocate(Strategy pStrategy, const LiveIntervalTree& pTree,
+                    Requests& pRequests) const;
+
+  uint64_t getPeakLiveSize(const Requests& pRequests) const;
 
-  AllocEntry getAnEmptyRegion(const AllocEntries& pAllocs,
-                              uint64_t pRequiredSize,
-                              uint64_t pAlignment) const;
 private:
   MemAllocData* m_MemAllocData;
   LiveIntervalsData* m_LIDataPass;
-  LiveValueMatrix* m_LiveMatPass;
   TargetMemInfo* m_TMI;
+  Strategy m_Strategy;
+  uint64_t m_Footprint;
+  uint64_t m_PeakLiveSize;
 };
 
 ModulePass* CreateLinearScanMemAllocPass(TargetBackend* pTB);
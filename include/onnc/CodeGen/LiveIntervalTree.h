@@ -0,0 +1,69 @@
+//===- LiveIntervalTree.h -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_CODEGEN_LIVE_INTERVAL_TREE_H
+#define ONNC_CODEGEN_LIVE_INTERVAL_TREE_H
+#include <onnc/CodeGen/LiveInterval.h>
+#include <vector>
+
+namespace onnc {
+
+/** \class LiveIntervalTree
+ *  \brief A static interval tree over the segments of live intervals.
+ *
+ *  Segments are kept in an array sorted by start index. The array is an
+ *  implicit balanced tree: the root of [lo, hi) is (lo + hi) / 2, and each
+ *  node also records the highest end index of its subtree. A query visits
+ *  only the subtrees that can overlap, so it costs O(log N + K) for K
+ *  results instead of the O(N) of a scan.
+ */
+class LiveIntervalTree
+{
+public:
+  typedef std::vector<const LiveInterval*> LIs;
+
+public:
+  LiveIntervalTree();
+
+  /// Build the tree over all segments of pLIs. The intervals must outlive
+  /// the tree.
+  void build(const LIs& pLIs);
+
+  /// Append the intervals which overlap pLI, except pLI itself, to pResult.
+  /// Each interval is appended once.
+  /// Time complexity: O(S * (log N + K))
+  ///   S = #Segments of pLI
+  void query(const LiveInterval& pLI, LIs& pResult) const;
+
+  /// Append the intervals which are live in [pStart, pEnd] to pResult. An
+  /// interval with several such segments is appended several times.
+  void query(unsigned int pStart, unsigned int pEnd, LIs& pResult) const;
+
+  bool empty() const { return m_Nodes.empty(); }
+
+  void clear() { m_Nodes.clear(); }
+
+private:
+  struct Node
+  {
+    unsigned int start, end; ///< inclusive
+    unsigned int maxEnd;     ///< of the subtree
+    const LiveInterval* li;
+  };
+
+  unsigned int buildMaxEnd(size_t pLo, size_t pHi);
+
+  void query(size_t pLo, size_t pHi, unsigned int pStart, unsigned int pEnd,
+             LIs& pResult) const;
+
+private:
+  std::vector<Node> m_Nodes;
+};
+
+} // namespace of onnc
+
+#endif
@@ -40,9 +40,11 @@ public:
 
   typedef std::unordered_map<Value*, AllocEntry> ValToAllocEntry;
 
+  typedef std::unordered_map<const Value*, Value*> ValToAlias;
+
 public:
   MemAllocData()
-    : ModulePass(ID), m_ValToAllocEntry() {
+    : ModulePass(ID), m_ValToAllocEntry(), m_ValToAlias() {
   }
 
   StringRef getPassName() const override { return "MemAllocData"; }
@@ -56,10 +58,19 @@ public:
 
   bool hasAlloc(const Value* pVal) const;
 
+  /// Let pView share the memory of pBase. Memory allocators give the two
+  /// values one region, which lives as long as either of them.
+  void addAlias(const Value* pView, Value* pBase);
+
+  /// @return The value owning the memory of pVal, which is pVal itself
+  ///         unless pVal is an alias.
+  Value* getBase(const Value* pVal) const;
+
   void print(OStream& pOS, const Module* pModule) const override;
 
 private:
   ValToAllocEntry m_ValToAllocEntry;
+  ValToAlias m_ValToAlias;
 };
 
 ModulePass* CreateMemAllocDataPass();
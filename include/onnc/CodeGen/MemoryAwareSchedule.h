@@ -0,0 +1,74 @@
+//===- MemoryAwareSchedule.h ----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_CODEGEN_MEMORY_AWARE_SCHEDULE_H
+#define ONNC_CODEGEN_MEMORY_AWARE_SCHEDULE_H
+#include <onnc/Core/ModulePass.h>
+#include <onnc/Support/DataTypes.h>
+#include <vector>
+
+namespace onnc {
+
+class ComputeGraph;
+class TargetBackend;
+class TargetMemInfo;
+
+/** \class MemoryAwareSchedule
+ *  \brief Reorder the operators of compute graphs to lower the peak of live
+ *         activation memory.
+ *
+ *  A value is live from the operator defining it to its last user, as in
+ *  LiveIntervals; weights are not counted. Inputs and initializers stay at
+ *  the front and outputs at the end of the graph. The pass tries:
+ *
+ *  - a greedy list schedule, which runs the ready operator that frees the
+ *    most memory, and
+ *  - an exact dynamic program over the sets of scheduled operators when a
+ *    graph has at most kMaxExactSize operators,
+ *
+ *  and keeps the order with the lowest peak. The original order wins ties.
+ */
+class MemoryAwareSchedule : public ModulePass
+{
+public:
+  static char ID;
+
+  /// Graphs up to this size are scheduled exactly. It costs 2^N states.
+  static const unsigned int kMaxExactSize = 18;
+
+  struct Result
+  {
+    uint64_t before; ///< peak live bytes in the original order
+    uint64_t after;  ///< peak live bytes in the chosen order
+  };
+
+public:
+  MemoryAwareSchedule(TargetBackend* pTarget);
+
+  StringRef getPassName() const override { return "MemoryAwareSchedule"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  /// @return The peaks of the compute graphs of the last run.
+  const std::vector<Result>& getResults() const { return m_Results; }
+
+private:
+  /// @retval true If the operators of pCG have been reordered.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  TargetMemInfo* m_TMI;
+  std::vector<Result> m_Results;
+};
+
+ModulePass* CreateMemoryAwareSchedulePass(TargetBackend* pTarget);
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,125 @@
+//===- BatchNormalizationNCHWc.h ------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_BATCH_NORMALIZATION_NCHWC_H
+#define ONNC_IR_COMPUTE_OPERATOR_BATCH_NORMALIZATION_NCHWC_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+
+namespace onnc {
+
+/** \class BatchNormalizationNCHWc
+ *  \brief BatchNormalization in inference mode in the blocked NCHWc layout.
+ *
+ *  X and Y are N x ceil(C / c) x D1 x ... x Dn x c tensors; scale, B, mean
+ *  and var hold the C channels as in BatchNormalization.
+ */
+class BatchNormalizationNCHWc : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kX = 0,
+    kScale = 1,
+    kB = 2,
+    kMean = 3,
+    kVar = 4,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  BatchNormalizationNCHWc();
+
+  // shallow copy constructor.
+  BatchNormalizationNCHWc(const BatchNormalizationNCHWc &pCopy);
+
+  virtual ~BatchNormalizationNCHWc() { }
+
+  // clang-format off
+  // Attributes getters
+  const FloatAttr& getEpsilon() const { return m_Epsilon; }
+
+
+  // Attributes setters
+  void setEpsilon(const FloatAttr& pEpsilon) { m_Epsilon = pEpsilon; }
+
+  // clang-format on
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getX() const { return getInput(kX); }
+
+  const Tensor* getScale() const { return getInput(kScale); }
+
+  const Tensor* getB() const { return getInput(kB); }
+
+  const Tensor* getMean() const { return getInput(kMean); }
+
+  const Tensor* getVar() const { return getInput(kVar); }
+
+  Tensor* getX() { return getInput(kX); }
+
+  Tensor* getScale() { return getInput(kScale); }
+
+  Tensor* getB() { return getInput(kB); }
+
+  Tensor* getMean() { return getInput(kMean); }
+
+  Tensor* getVar() { return getInput(kVar); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setX(Tensor& pTensor) { m_Inputs[kX] = &pTensor; }
+
+  void setScale(Tensor& pTensor) { m_Inputs[kScale] = &pTensor; }
+
+  void setB(Tensor& pTensor) { m_Inputs[kB] = &pTensor; }
+
+  void setMean(Tensor& pTensor) { m_Inputs[kMean] = &pTensor; }
+
+  void setVar(Tensor& pTensor) { m_Inputs[kVar] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  FloatAttr m_Epsilon;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,146 @@
+//===- ConvNCHWc.h --------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_CONV_NCHWC_H
+#define ONNC_IR_COMPUTE_OPERATOR_CONV_NCHWC_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+#include <string>
+
+namespace onnc {
+
+/** \class ConvNCHWc
+ *  \brief A 2-D Conv with one group in the blocked NCHWc layout, followed by
+ *  an epilogue of activations like the one of FusedConv.
+ *
+ *  X and Y are N x ceil(C / c) x H x W x c tensors. W holds the weights
+ *  already packed by the compiler as a
+ *  ceil(M / c) x ceil(C / c) x kH x kW x c x c tensor, and B, if any, the
+ *  ceil(M / c) * c biases. dilations, pads and strides are resolved; pads
+ *  are [top, left, bottom, right] and auto_pad is not supported.
+ */
+class ConvNCHWc : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kX = 0,
+    kW = 1,
+    kB = 2,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  ConvNCHWc();
+
+  // shallow copy constructor.
+  ConvNCHWc(const ConvNCHWc &pCopy);
+
+  virtual ~ConvNCHWc() { }
+
+  // clang-format off
+  // Attributes getters
+  const FloatsAttr& getActivationAlpha() const { return m_ActivationAlpha; }
+
+  const FloatsAttr& getActivationBeta() const { return m_ActivationBeta; }
+
+  const StringsAttr& getActivations() const { return m_Activations; }
+
+  const IntsAttr& getDilations() const { return m_Dilations; }
+
+  const IntsAttr& getPads() const { return m_Pads; }
+
+  const IntsAttr& getStrides() const { return m_Strides; }
+
+
+  // Attributes setters
+  void setActivationAlpha(const FloatsAttr& pActivationAlpha) { m_ActivationAlpha = pActivationAlpha; }
+
+  void setActivationBeta(const FloatsAttr& pActivationBeta) { m_ActivationBeta = pActivationBeta; }
+
+  void setActivations(const StringsAttr& pActivations) { m_Activations = pActivations; }
+
+  void setDilations(const IntsAttr& pDilations) { m_Dilations = pDilations; }
+
+  void setPads(const IntsAttr& pPads) { m_Pads = pPads; }
+
+  void setStrides(const IntsAttr& pStrides) { m_Strides = pStrides; }
+
+  // clang-format on
+
+  /// Append an activation of the epilogue. Only the parameters the
+  /// activation takes are recorded, as in the activations of LSTM.
+  void addActivation(const std::string& pName, unsigned int pNumOfParams,
+                     double pAlpha = 0.0, double pBeta = 0.0);
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getX() const { return getInput(kX); }
+
+  const Tensor* getW() const { return getInput(kW); }
+
+  const Tensor* getB() const { return getInput(kB); }
+
+  Tensor* getX() { return getInput(kX); }
+
+  Tensor* getW() { return getInput(kW); }
+
+  Tensor* getB() { return getInput(kB); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setX(Tensor& pTensor) { m_Inputs[kX] = &pTensor; }
+
+  void setW(Tensor& pTensor) { m_Inputs[kW] = &pTensor; }
+
+  void setB(Tensor& pTensor) { m_Inputs[kB] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  FloatsAttr m_ActivationAlpha;
+  FloatsAttr m_ActivationBeta;
+  StringsAttr m_Activations;
+  IntsAttr m_Dilations;
+  IntsAttr m_Pads;
+  IntsAttr m_Strides;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,111 @@
+//===- FusedElementwise.h -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_FUSED_ELEMENTWISE_H
+#define ONNC_IR_COMPUTE_OPERATOR_FUSED_ELEMENTWISE_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+#include <string>
+
+namespace onnc {
+
+/** \class FusedElementwise
+ *  \brief A chain of unary element-wise operators computed in one pass over
+ *  the input, encoded as the activations of FusedConv.
+ */
+class FusedElementwise : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kX = 0,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  FusedElementwise();
+
+  // shallow copy constructor.
+  FusedElementwise(const FusedElementwise &pCopy);
+
+  virtual ~FusedElementwise() { }
+
+  // clang-format off
+  // Attributes getters
+  const FloatsAttr& getActivationAlpha() const { return m_ActivationAlpha; }
+
+  const FloatsAttr& getActivationBeta() const { return m_ActivationBeta; }
+
+  const StringsAttr& getActivations() const { return m_Activations; }
+
+
+  // Attributes setters
+  void setActivationAlpha(const FloatsAttr& pActivationAlpha) { m_ActivationAlpha = pActivationAlpha; }
+
+  void setActivationBeta(const FloatsAttr& pActivationBeta) { m_ActivationBeta = pActivationBeta; }
+
+  void setActivations(const StringsAttr& pActivations) { m_Activations = pActivations; }
+
+  // clang-format on
+
+  /// Append an activation of the epilogue. Only the parameters the
+  /// activation takes are recorded, as in the activations of LSTM.
+  void addActivation(const std::string& pName, unsigned int pNumOfParams,
+                     double pAlpha = 0.0, double pBeta = 0.0);
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getX() const { return getInput(kX); }
+
+  Tensor* getX() { return getInput(kX); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setX(Tensor& pTensor) { m_Inputs[kX] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  FloatsAttr m_ActivationAlpha;
+  FloatsAttr m_ActivationBeta;
+  StringsAttr m_Activations;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
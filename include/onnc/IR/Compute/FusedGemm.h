@@ -0,0 +1,149 @@
+//===- FusedGemm.h --------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_FUSED_GEMM_H
+#define ONNC_IR_COMPUTE_OPERATOR_FUSED_GEMM_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/Support/IOStream.h>
+#include <string>
+
+namespace onnc {
+
+/** \class FusedGemm
+ *  \brief Gemm followed by an epilogue of activations, encoded as in
+ *  FusedConv.
+ */
+class FusedGemm : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kA = 0,
+    kB = 1,
+    kC = 2,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  FusedGemm();
+
+  /// Copy the attributes of pOp. The epilogue is empty.
+  FusedGemm(const Gemm& pOp);
+
+  // shallow copy constructor.
+  FusedGemm(const FusedGemm &pCopy);
+
+  virtual ~FusedGemm() { }
+
+  // clang-format off
+  // Attributes getters
+  const FloatsAttr& getActivationAlpha() const { return m_ActivationAlpha; }
+
+  const FloatsAttr& getActivationBeta() const { return m_ActivationBeta; }
+
+  const StringsAttr& getActivations() const { return m_Activations; }
+
+  const FloatAttr& getAlpha() const { return m_Alpha; }
+
+  const FloatAttr& getBeta() const { return m_Beta; }
+
+  const IntAttr& getTransA() const { return m_TransA; }
+
+  const IntAttr& getTransB() const { return m_TransB; }
+
+
+  // Attributes setters
+  void setActivationAlpha(const FloatsAttr& pActivationAlpha) { m_ActivationAlpha = pActivationAlpha; }
+
+  void setActivationBeta(const FloatsAttr& pActivationBeta) { m_ActivationBeta = pActivationBeta; }
+
+  void setActivations(const StringsAttr& pActivations) { m_Activations = pActivations; }
+
+  void setAlpha(const FloatAttr& pAlpha) { m_Alpha = pAlpha; }
+
+  void setBeta(const FloatAttr& pBeta) { m_Beta = pBeta; }
+
+  void setTransA(const IntAttr& pTransA) { m_TransA = pTransA; }
+
+  void setTransB(const IntAttr& pTransB) { m_TransB = pTransB; }
+
+  // clang-format on
+
+  /// Append an activation of the epilogue. Only the parameters the
+  /// activation takes are recorded, as in the activations of LSTM.
+  void addActivation(const std::string& pName, unsigned int pNumOfParams,
+                     double pAlpha = 0.0, double pBeta = 0.0);
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getA() const { return getInput(kA); }
+
+  const Tensor* getB() const { return getInput(kB); }
+
+  const Tensor* getC() const { return getInput(kC); }
+
+  Tensor* getA() { return getInput(kA); }
+
+  Tensor* getB() { return getInput(kB); }
+
+  Tensor* getC() { return getInput(kC); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setA(Tensor& pTensor) { m_Inputs[kA] = &pTensor; }
+
+  void setB(Tensor& pTensor) { m_Inputs[kB] = &pTensor; }
+
+  void setC(Tensor& pTensor) { m_Inputs[kC] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  FloatsAttr m_ActivationAlpha;
+  FloatsAttr m_ActivationBeta;
+  StringsAttr m_Activations;
+  FloatAttr m_Alpha;
+  FloatAttr m_Beta;
+  IntAttr m_TransA;
+  IntAttr m_TransB;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
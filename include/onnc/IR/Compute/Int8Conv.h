@@ -0,0 +1,154 @@
+//===- Int8Conv.h ---------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_INT8_CONV_H
+#define ONNC_IR_COMPUTE_OPERATOR_INT8_CONV_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+
+namespace onnc {
+
+/** \class Int8Conv
+ *  \brief A 2-D Conv on int8 tensors with int32 accumulation.
+ *
+ *  X and W are int8 and quantized symmetrically: X with one scale and W
+ *  with one scale per output channel. The int32 sum of output channel m is
+ *  requantized to the int8 Y as
+ *
+ *    Y = saturate(round((sum * scales[m] + B[m]) / output_scale))
+ *
+ *  where scales[m] is the product of the scales of X and of channel m of W,
+ *  and B is the float bias, if any. relu clamps negative values to zero
+ *  before rounding. dilations, kernel_shape, pads and strides are resolved;
+ *  pads are [top, left, bottom, right] and auto_pad is not supported.
+ */
+class Int8Conv : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kX = 0,
+    kW = 1,
+    kB = 2,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  Int8Conv();
+
+  // shallow copy constructor.
+  Int8Conv(const Int8Conv &pCopy);
+
+  virtual ~Int8Conv() { }
+
+  // clang-format off
+  // Attributes getters
+  const IntsAttr& getDilations() const { return m_Dilations; }
+
+  const IntAttr& getGroup() const { return m_Group; }
+
+  const IntsAttr& getKernelShape() const { return m_KernelShape; }
+
+  const FloatAttr& getOutputScale() const { return m_OutputScale; }
+
+  const IntsAttr& getPads() const { return m_Pads; }
+
+  const IntAttr& getRelu() const { return m_Relu; }
+
+  const FloatsAttr& getScales() const { return m_Scales; }
+
+  const IntsAttr& getStrides() const { return m_Strides; }
+
+
+  // Attributes setters
+  void setDilations(const IntsAttr& pDilations) { m_Dilations = pDilations; }
+
+  void setGroup(const IntAttr& pGroup) { m_Group = pGroup; }
+
+  void setKernelShape(const IntsAttr& pKernelShape) { m_KernelShape = pKernelShape; }
+
+  void setOutputScale(const FloatAttr& pOutputScale) { m_OutputScale = pOutputScale; }
+
+  void setPads(const IntsAttr& pPads) { m_Pads = pPads; }
+
+  void setRelu(const IntAttr& pRelu) { m_Relu = pRelu; }
+
+  void setScales(const FloatsAttr& pScales) { m_Scales = pScales; }
+
+  void setStrides(const IntsAttr& pStrides) { m_Strides = pStrides; }
+
+  // clang-format on
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getX() const { return getInput(kX); }
+
+  const Tensor* getW() const { return getInput(kW); }
+
+  const Tensor* getB() const { return getInput(kB); }
+
+  Tensor* getX() { return getInput(kX); }
+
+  Tensor* getW() { return getInput(kW); }
+
+  Tensor* getB() { return getInput(kB); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setX(Tensor& pTensor) { m_Inputs[kX] = &pTensor; }
+
+  void setW(Tensor& pTensor) { m_Inputs[kW] = &pTensor; }
+
+  void setB(Tensor& pTensor) { m_Inputs[kB] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  IntsAttr m_Dilations;
+  IntAttr m_Group;
+  IntsAttr m_KernelShape;
+  FloatAttr m_OutputScale;
+  IntsAttr m_Pads;
+  IntAttr m_Relu;
+  FloatsAttr m_Scales;
+  IntsAttr m_Strides;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
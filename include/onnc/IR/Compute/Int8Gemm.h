@@ -0,0 +1,127 @@
+//===- Int8Gemm.h ---------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_INT8_GEMM_H
+#define ONNC_IR_COMPUTE_OPERATOR_INT8_GEMM_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+
+namespace onnc {
+
+/** \class Int8Gemm
+ *  \brief Y = A * B^T + C on int8 tensors with int32 accumulation.
+ *
+ *  A is a ... x K int8 tensor whose leading axes are rows, B the N x K int8
+ *  weights quantized with one scale per row, and C, if any, the N float
+ *  biases. The int32 sum of column n is requantized like in Int8Conv:
+ *
+ *    Y = saturate(round((sum * scales[n] + C[n]) / output_scale))
+ *
+ *  Y is a ... x N int8 tensor. relu clamps negative values to zero before
+ *  rounding.
+ */
+class Int8Gemm : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kA = 0,
+    kB = 1,
+    kC = 2,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  Int8Gemm();
+
+  // shallow copy constructor.
+  Int8Gemm(const Int8Gemm &pCopy);
+
+  virtual ~Int8Gemm() { }
+
+  // clang-format off
+  // Attributes getters
+  const FloatAttr& getOutputScale() const { return m_OutputScale; }
+
+  const IntAttr& getRelu() const { return m_Relu; }
+
+  const FloatsAttr& getScales() const { return m_Scales; }
+
+
+  // Attributes setters
+  void setOutputScale(const FloatAttr& pOutputScale) { m_OutputScale = pOutputScale; }
+
+  void setRelu(const IntAttr& pRelu) { m_Relu = pRelu; }
+
+  void setScales(const FloatsAttr& pScales) { m_Scales = pScales; }
+
+  // clang-format on
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getA() const { return getInput(kA); }
+
+  const Tensor* getB() const { return getInput(kB); }
+
+  const Tensor* getC() const { return getInput(kC); }
+
+  Tensor* getA() { return getInput(kA); }
+
+  Tensor* getB() { return getInput(kB); }
+
+  Tensor* getC() { return getInput(kC); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setA(Tensor& pTensor) { m_Inputs[kA] = &pTensor; }
+
+  void setB(Tensor& pTensor) { m_Inputs[kB] = &pTensor; }
+
+  void setC(Tensor& pTensor) { m_Inputs[kC] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  FloatAttr m_OutputScale;
+  IntAttr m_Relu;
+  FloatsAttr m_Scales;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,118 @@
+//===- PoolNCHWc.h --------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_POOL_NCHWC_H
+#define ONNC_IR_COMPUTE_OPERATOR_POOL_NCHWC_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+
+namespace onnc {
+
+/** \class PoolNCHWc
+ *  \brief A 2-D MaxPool or AveragePool in the blocked NCHWc layout.
+ *
+ *  mode is "MAX" or "AVERAGE". X and Y are N x ceil(C / c) x H x W x c
+ *  tensors. pads are the resolved [top, left, bottom, right] pads; auto_pad
+ *  is not supported.
+ */
+class PoolNCHWc : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kX = 0,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  PoolNCHWc();
+
+  // shallow copy constructor.
+  PoolNCHWc(const PoolNCHWc &pCopy);
+
+  virtual ~PoolNCHWc() { }
+
+  // clang-format off
+  // Attributes getters
+  const IntAttr& getCountIncludePad() const { return m_CountIncludePad; }
+
+  const IntsAttr& getKernelShape() const { return m_KernelShape; }
+
+  const StringAttr& getMode() const { return m_Mode; }
+
+  const IntsAttr& getPads() const { return m_Pads; }
+
+  const IntsAttr& getStrides() const { return m_Strides; }
+
+
+  // Attributes setters
+  void setCountIncludePad(const IntAttr& pCountIncludePad) { m_CountIncludePad = pCountIncludePad; }
+
+  void setKernelShape(const IntsAttr& pKernelShape) { m_KernelShape = pKernelShape; }
+
+  void setMode(const StringAttr& pMode) { m_Mode = pMode; }
+
+  void setPads(const IntsAttr& pPads) { m_Pads = pPads; }
+
+  void setStrides(const IntsAttr& pStrides) { m_Strides = pStrides; }
+
+  // clang-format on
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getX() const { return getInput(kX); }
+
+  Tensor* getX() { return getInput(kX); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setX(Tensor& pTensor) { m_Inputs[kX] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+protected:
+  // clang-format off
+  IntAttr m_CountIncludePad;
+  IntsAttr m_KernelShape;
+  StringAttr m_Mode;
+  IntsAttr m_Pads;
+  IntsAttr m_Strides;
+  // clang-format on
+};
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,88 @@
+//===- Reorder.h ----------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_OPERATOR_REORDER_H
+#define ONNC_IR_COMPUTE_OPERATOR_REORDER_H
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/IOStream.h>
+
+namespace onnc {
+
+/** \class Reorder
+ *  \brief Copy X to Y between the plain NCHW layout and the blocked NCHWc
+ *  layout of the ONNC Runtime.
+ *
+ *  A tensor in NCHWc has one more axis than in NCHW: a N x C x H x W tensor
+ *  is stored as N x ceil(C / c) x H x W x c, so the dimensions of X and Y
+ *  tell the direction and the block c.
+ */
+class Reorder : public ComputeOperator
+{
+public:
+  enum IOConst {
+    kX = 0,
+    kY = 0
+  };
+
+  static char ID;
+
+public:
+  Reorder();
+
+  // shallow copy constructor.
+  Reorder(const Reorder &pCopy);
+
+  virtual ~Reorder() { }
+
+  // clang-format off
+  // clang-format on
+
+  Tensor* getInput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  const Tensor* getInput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Inputs[pIdx]); }
+
+  Tensor* getOutput(unsigned int pIdx) override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  const Tensor* getOutput(unsigned int pIdx) const override { return static_cast<Tensor*>(m_Outputs[pIdx]); }
+
+  // clang-format off
+  // Inputs getters
+  const Tensor* getX() const { return getInput(kX); }
+
+  Tensor* getX() { return getInput(kX); }
+
+
+  // Outputs getters
+  const Tensor* getY() const { return getOutput(kY); }
+
+  Tensor* getY() { return getOutput(kY); }
+
+
+  // Inputs setters
+  void setX(Tensor& pTensor) { m_Inputs[kX] = &pTensor; }
+
+
+  // Outputs setters
+  void setY(Tensor& pTensor) { m_Outputs[kY] = &pTensor; }
+
+  // clang-format on
+
+  void printAttributes(std::ostream& pOS) const override;
+
+  void accept(ComputeVisitor& pVisitor) override { pVisitor.visit(*this); }
+
+  void accept(ComputeVisitor& pVisitor) const override { pVisitor.visit(*this); }
+
+  static bool classof(const ComputeOperator* pOp);
+
+};
+
+} // namespace of onnc
+
+#endif
@@ -43,6 +43,11 @@ protected:
 
 /** \class TensorT
  *  \brief TensorT is a placeholder of tensor in a network
+ *
+ *  A tensor either owns its values or refers to external values, such as
+ *  the raw data of an initializer or a memory-mapped weight file, without
+ *  copying them. data() reads both kinds. getValues() copies external values
+ *  into the tensor on first use.
  */
 template<typename ValueType, Value::Type Kind>
 class TensorT : public onnc::Tensor
@@ -52,29 +57,70 @@ public:
 
 public:
   TensorT()
-    : onnc::Tensor(Kind), m_Values() {
+    : onnc::Tensor(Kind), m_Values(), m_pExternal(nullptr), m_NumOfExternal(0) {
   }
 
   TensorT(const std::string& pName)
-    : onnc::Tensor(pName, Kind), m_Values() {
+    : onnc::Tensor(pName, Kind), m_Values(),
+      m_pExternal(nullptr), m_NumOfExternal(0) {
   }
 
   TensorT(xTensor& pAdaptee)
-    : onnc::Tensor(Kind, pAdaptee), m_Values() {
+    : onnc::Tensor(Kind, pAdaptee), m_Values(),
+      m_pExternal(nullptr), m_NumOfExternal(0) {
   }
 
   virtual ~TensorT() { }
 
-  ValueList& getValues() { return m_Values; }
+  /// The values become owned by the tensor, so they can be modified.
+  ValueList& getValues() {
+    copyExternal();
+    m_pExternal = nullptr;
+    m_NumOfExternal = 0;
+    return m_Values;
+  }
+
+  const ValueList& getValues() const {
+    copyExternal();
+    return m_Values;
+  }
+
+  /// Refer to @ref pNumOfValues values at @ref pValues instead of owning
+  /// them. The values must outlive the tensor.
+  void setExternalValues(const ValueType* pValues, size_t pNumOfValues) {
+    m_Values.clear();
+    m_pExternal = pValues;
+    m_NumOfExternal = pNumOfValues;
+  }
+
+  bool isExternal() const { return nullptr != m_pExternal; }
 
-  const ValueList& getValues() const { return m_Values; }
+  /// @return The values without copying external ones.
+  const ValueType* data() const {
+    return isExternal() ? m_pExternal : m_Values.data();
+  }
+
+  size_t getNumOfValues() const {
+    return isExternal() ? m_NumOfExternal : m_Values.size();
+  }
+
+private:
+  void copyExternal() const {
+    if (isExternal() && m_Values.size() != m_NumOfExternal)
+      m_Values.assign(m_pExternal, m_pExternal + m_NumOfExternal);
+  }
 
 private:
-  ValueList m_Values;
+  mutable ValueList m_Values;
+  const ValueType* m_pExternal;
+  size_t m_NumOfExternal;
 };
 
 typedef TensorT<float,       onnc::Value::kFloat>   FloatTensor;
-typedef TensorT<float,       onnc::Value::kFloat16> Float16Tensor;
+// 16-bit floats hold their bit patterns. Use the conversions of
+// onnc/Runtime/internal/half.h to read and write them.
+typedef TensorT<uint16_t,    onnc::Value::kFloat16> Float16Tensor;
+typedef TensorT<uint16_t,    onnc::Value::kBFloat16> BFloat16Tensor;
 typedef TensorT<bool,        onnc::Value::kBoolean> BooleanTensor;
 typedef TensorT<int8_t,      onnc::Value::kInt8>    Int8Tensor;
 typedef TensorT<int16_t,     onnc::Value::kInt16>   Int16Tensor;
@@ -0,0 +1,281 @@
+//===- ComputeArchive.h ---------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_IR_COMPUTE_ARCHIVE_H
+#define ONNC_IR_COMPUTE_ARCHIVE_H
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/Support/DataTypes.h>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace onnc {
+
+/** \class ComputeArchive
+ *  \brief Write compute operators and plain data into a byte string, and
+ *         read them back.
+ *
+ *  An archive either writes to the end of a string or reads a range of
+ *  bytes. Visiting an operator writes or reads its attributes. Numbers keep
+ *  the byte order of the host, so an archive is read by the build that
+ *  wrote it.
+ *
+ *  Reading never goes past the end of the range. A truncated or malformed
+ *  archive makes good() false, and every later read returns zeros.
+ */
+class ComputeArchive : public ComputeVisitor
+{
+public:
+  /// Write to the end of @ref pBuffer.
+  explicit ComputeArchive(std::string& pBuffer);
+
+  /// Read [@ref pBegin, @ref pEnd).
+  ComputeArchive(const char* pBegin, const char* pEnd);
+
+  bool isWriting() const { return nullptr != m_pBuffer; }
+
+  bool good() const { return m_Good; }
+
+  void fail() { m_Good = false; }
+
+  template<typename NumberType>
+  void write(NumberType pValue) {
+    static_assert(std::is_arithmetic<NumberType>::value,
+                  "only numbers are written as they are");
+    writeBytes(&pValue, sizeof(pValue));
+  }
+
+  void write(const std::string& pString);
+
+  template<typename ValueType>
+  void write(const std::vector<ValueType>& pVector) {
+    write(static_cast<uint64_t>(pVector.size()));
+    for (const ValueType& value : pVector)
+      write(value);
+  }
+
+  void writeBytes(const void* pData, size_t pSize);
+
+  template<typename NumberType>
+  void read(NumberType& pValue) {
+    static_assert(std::is_arithmetic<NumberType>::value,
+                  "only numbers are read as they are");
+    const char* data = readBytes(sizeof(pValue));
+    pValue = NumberType();
+    if (nullptr != data)
+      memcpy(&pValue, data, sizeof(pValue));
+  }
+
+  void read(std::string& pString);
+
+  template<typename ValueType>
+  void read(std::vector<ValueType>& pVector) {
+    uint64_t size = 0;
+    read(size);
+    // Every value takes a byte at least, which bounds the size read from a
+    // malformed archive.
+    if (size > static_cast<uint64_t>(m_pEnd - m_pCurrent)) {
+      fail();
+      size = 0;
+    }
+    pVector.resize(size);
+    for (ValueType& value : pVector)
+      read(value);
+  }
+
+  /// @return The next @ref pSize bytes, or nullptr if there are less.
+  const char* readBytes(size_t pSize);
+
+  /// Write or read @ref pAttr.
+  void transfer(IntAttr& pAttr);
+  void transfer(FloatAttr& pAttr);
+  void transfer(StringAttr& pAttr);
+  void transfer(IntsAttr& pAttr);
+  void transfer(FloatsAttr& pAttr);
+  void transfer(StringsAttr& pAttr);
+
+  /// Write or read an attribute of @ref pOp through its accessors.
+  template<typename OpType, typename AttrType>
+  void transfer(OpType& pOp, const AttrType& (OpType::*pGet)() const,
+                void (OpType::*pSet)(const AttrType&)) {
+    AttrType attr = (pOp.*pGet)();
+    transfer(attr);
+    if (!isWriting())
+      (pOp.*pSet)(attr);
+  }
+
+  /// Write the type and the attributes of @ref pOp, but not its inputs and
+  /// outputs.
+  /// @retval false If operators of the type are not archived.
+  bool writeOperator(ComputeOperator& pOp);
+
+  /// Read an operator written by writeOperator() and add it to @ref pGraph.
+  /// @retval nullptr If the archive is malformed.
+  ComputeOperator* readOperator(ComputeGraph& pGraph);
+
+  void visit(ATen& pOp) override;
+  void visit(Abs& pOp) override;
+  void visit(Acos& pOp) override;
+  void visit(Add& pOp) override;
+  void visit(Affine& pOp) override;
+  void visit(And& pOp) override;
+  void visit(ArgMax& pOp) override;
+  void visit(ArgMin& pOp) override;
+  void visit(Asin& pOp) override;
+  void visit(Atan& pOp) override;
+  void visit(AveragePool& pOp) override;
+  void visit(BatchNormalization& pOp) override;
+  void visit(BatchNormalizationNCHWc& pOp) override;
+  void visit(Cast& pOp) override;
+  void visit(Ceil& pOp) override;
+  void visit(Clip& pOp) override;
+  void visit(Concat& pOp) override;
+  void visit(ConstantFill& pOp) override;
+  void visit(Conv& pOp) override;
+  void visit(ConvNCHWc& pOp) override;
+  void visit(ConvTranspose& pOp) override;
+  void visit(Cos& pOp) override;
+  void visit(Crop& pOp) override;
+  void visit(DepthToSpace& pOp) override;
+  void visit(Dequantize& pOp) override;
+  void visit(Div& pOp) override;
+  void visit(Dropout& pOp) override;
+  void visit(Elu& pOp) override;
+  void visit(Equal& pOp) override;
+  void visit(Exp& pOp) override;
+  void visit(Expand& pOp) override;
+  void visit(Flatten& pOp) override;
+  void visit(Floor& pOp) override;
+  void visit(FusedConv& pOp) override;
+  void visit(FusedElementwise& pOp) override;
+  void visit(FusedGemm& pOp) override;
+  void visit(GRU& pOp) override;
+  void visit(GRUUnit& pOp) override;
+  void visit(Gather& pOp) override;
+  void visit(Gemm& pOp) override;
+  void visit(GivenTensorFill& pOp) override;
+  void visit(GlobalAveragePool& pOp) override;
+  void visit(GlobalLpPool& pOp) override;
+  void visit(GlobalMaxPool& pOp) override;
+  void visit(Greater& pOp) override;
+  void visit(HardSigmoid& pOp) override;
+  void visit(Hardmax& pOp) override;
+  void visit(Identity& pOp) override;
+  void visit(ImageScaler& pOp) override;
+  void visit(Initializer& pOp) override;
+  void visit(InputOperator& pOp) override;
+  void visit(InstanceNormalization& pOp) override;
+  void visit(Int8Conv& pOp) override;
+  void visit(Int8Gemm& pOp) override;
+  void visit(LRN& pOp) override;
+  void visit(LSTM& pOp) override;
+  void visit(LeakyRelu& pOp) override;
+  void visit(Less& pOp) override;
+  void visit(Log& pOp) override;
+  void visit(LogSoftmax& pOp) override;
+  void visit(LpNormalization& pOp) override;
+  void visit(LpPool& pOp) override;
+  void visit(MatMul& pOp) override;
+  void visit(Max& pOp) override;
+  void visit(MaxPool& pOp) override;
+  void visit(MaxRoiPool& pOp) override;
+  void visit(Mean& pOp) override;
+  void visit(MeanVarianceNormalization& pOp) override;
+  void visit(Min& pOp) override;
+  void visit(Mul& pOp) override;
+  void visit(Multinomial& pOp) override;
+  void visit(Neg& pOp) override;
+  void visit(Not& pOp) override;
+  void visit(Or& pOp) override;
+  void visit(OutputOperator& pOp) override;
+  void visit(PRelu& pOp) override;
+  void visit(Pad& pOp) override;
+  void visit(ParametricSoftplus& pOp) override;
+  void visit(PoolNCHWc& pOp) override;
+  void visit(Pow& pOp) override;
+  void visit(Quantize& pOp) override;
+  void visit(RNN& pOp) override;
+  void visit(RandomNormal& pOp) override;
+  void visit(RandomNormalLike& pOp) override;
+  void visit(RandomUniform& pOp) override;
+  void visit(RandomUniformLike& pOp) override;
+  void visit(Reciprocal& pOp) override;
+  void visit(ReduceL1& pOp) override;
+  void visit(ReduceL2& pOp) override;
+  void visit(ReduceLogSum& pOp) override;
+  void visit(ReduceLogSumExp& pOp) override;
+  void visit(ReduceMax& pOp) override;
+  void visit(ReduceMean& pOp) override;
+  void visit(ReduceMin& pOp) override;
+  void visit(ReduceProd& pOp) override;
+  void visit(ReduceSum& pOp) override;
+  void visit(ReduceSumSquare& pOp) override;
+  void visit(Relu& pOp) override;
+  void visit(Reshape& pOp) override;
+  void visit(Scale& pOp) override;
+  void visit(ScaledTanh& pOp) override;
+  void visit(Selu& pOp) override;
+  void visit(Shape& pOp) override;
+  void visit(Sigmoid& pOp) override;
+  void visit(Sin& pOp) override;
+  void visit(Size& pOp) override;
+  void visit(Slice& pOp) override;
+  void visit(Softmax& pOp) override;
+  void visit(Softplus& pOp) override;
+  void visit(Softsign& pOp) override;
+  void visit(SpaceToDepth& pOp) override;
+  void visit(Split& pOp) override;
+  void visit(Sqrt& pOp) override;
+  void visit(Squeeze& pOp) override;
+  void visit(Sub& pOp) override;
+  void visit(Sum& pOp) override;
+  void visit(Tan& pOp) override;
+  void visit(Tanh& pOp) override;
+  void visit(ThresholdedRelu& pOp) override;
+  void visit(Tile& pOp) override;
+  void visit(TopK& pOp) override;
+  void visit(Transpose& pOp) override;
+  void visit(Unsqueeze& pOp) override;
+  void visit(Upsample& pOp) override;
+  void visit(WinogradConv& pOp) override;
+  void visit(Xor& pOp) override;
+
+private:
+  typedef ComputeOperator* (*Creator)(ComputeGraph& pGraph);
+  typedef std::unordered_map<std::string, Creator> CreatorMap;
+
+  /// Operators with required attributes are created with the default values
+  /// of @ref AttrTypes, until their attributes are read.
+  template<typename OpType, typename ... AttrTypes>
+  static ComputeOperator* Create(ComputeGraph& pGraph) {
+    return pGraph.addOperator<OpType>(AttrTypes()...);
+  }
+
+  template<typename ValueType>
+  void transferValue(ValueType& pValue);
+
+  /// Add the creators of ONNX operators, which code_generator.py generates.
+  static void AddONNXCreators(CreatorMap& pCreators);
+
+  static const CreatorMap& GetCreators();
+
+  static CreatorMap BuildCreators();
+
+private:
+  std::string* m_pBuffer;
+  const char* m_pCurrent;
+  const char* m_pEnd;
+  bool m_Good;
+};
+
+} // namespace of onnc
+
+#endif
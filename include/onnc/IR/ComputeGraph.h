@@ -19,6 +19,7 @@
 #include <onnc/JSON/Value.h>
 #include <iosfwd>
 #include <set>
+#include <vector>
 
 namespace onnc {
 
@@ -59,6 +60,10 @@ public:
 
   const std::string& name() const { return m_Name; }
 
+  Module& getModule() { return m_Module; }
+
+  const Module& getModule() const { return m_Module; }
+
   template<typename OpType, typename ... NodeCtorParams>
   OpType* addOperator(NodeCtorParams&& ... pParams);
 
@@ -95,6 +100,10 @@ public:
 
   void erase(Value& pVal);
 
+  /// Relink the operators in the order of pOrder, which must contain every
+  /// operator of the graph once. Operands and values are not changed.
+  void reorder(const std::vector<Node*>& pOrder);
+
   void clear();
 
   void getRear(Node*& pNode) const { pNode = m_pNodeRear; }
@@ -11,9 +11,21 @@
 namespace onnc {
 
 /// ONNC defined operators
+class BatchNormalizationNCHWc;
+class ConvNCHWc;
+class Dequantize;
+class FusedConv;
+class FusedElementwise;
+class FusedGemm;
 class Initializer;
 class InputOperator;
+class Int8Conv;
+class Int8Gemm;
 class OutputOperator;
+class PoolNCHWc;
+class Quantize;
+class Reorder;
+class WinogradConv;
 
 /// ONNX defined operators
 class Abs;
@@ -151,9 +163,21 @@ public:
   VisitorTypeID getVisitorID() const { return m_VisitorID; }
 
   /// ONNC defined operators @{
+  virtual void visit(const BatchNormalizationNCHWc& pBatchNormalizationNCHWc) { }
+  virtual void visit(const ConvNCHWc& pConvNCHWc) { }
+  virtual void visit(const Dequantize& pDequantize) { }
+  virtual void visit(const FusedConv& pFusedConv) { }
+  virtual void visit(const FusedElementwise& pFusedElementwise) { }
+  virtual void visit(const FusedGemm& pFusedGemm) { }
   virtual void visit(const Initializer& pInitializer) { }
   virtual void visit(const InputOperator& pInputOperator) { }
+  virtual void visit(const Int8Conv& pInt8Conv) { }
+  virtual void visit(const Int8Gemm& pInt8Gemm) { }
   virtual void visit(const OutputOperator& pOutputOperator) { }
+  virtual void visit(const PoolNCHWc& pPoolNCHWc) { }
+  virtual void visit(const Quantize& pQuantize) { }
+  virtual void visit(const Reorder& pReorder) { }
+  virtual void visit(const WinogradConv& pWinogradConv) { }
 
   /// @}
   /// ONNX defined operators @{
@@ -276,9 +300,21 @@ public:
   /// @}
 
   /// ONNC defined operators @{
+  virtual void visit(BatchNormalizationNCHWc& pBatchNormalizationNCHWc) { }
+  virtual void visit(ConvNCHWc& pConvNCHWc) { }
+  virtual void visit(Dequantize& pDequantize) { }
+  virtual void visit(FusedConv& pFusedConv) { }
+  virtual void visit(FusedElementwise& pFusedElementwise) { }
+  virtual void visit(FusedGemm& pFusedGemm) { }
   virtual void visit(Initializer& pInitializer) { }
   virtual void visit(InputOperator& pInputOperator) { }
+  virtual void visit(Int8Conv& pInt8Conv) { }
+  virtual void visit(Int8Gemm& pInt8Gemm) { }
   virtual void visit(OutputOperator& pOutputOperator) { }
+  virtual void visit(PoolNCHWc& pPoolNCHWc) { }
+  virtual void visit(Quantize& pQuantize) { }
+  virtual void visit(Reorder& pReorder) { }
+  virtual void visit(WinogradConv& pWinogradConv) { }
 
   /// @}
   /// ONNX defined operators @{
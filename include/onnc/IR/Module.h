@@ -13,6 +13,7 @@
 #include <onnc/ADT/StringMap.h>
 #include <onnc/JSON/Object.h>
 #include <onnc/Config/ONNX.h>
+#include <onnc/Support/Path.h>
 #include <vector>
 #include <ostream>
 #include <memory>
@@ -20,6 +21,8 @@
 
 namespace onnc {
 
+class MemoryMap;
+
 /** \class Module
  *  \brief Representation of ONNX model
  */
@@ -44,6 +47,8 @@ public:
   typedef std::map<std::string, int64_t> OpsetImport;
   typedef std::map<std::string, std::string> MetaDataMap;
 
+  typedef std::map<std::string, StringRef> ExternalDataMap;
+
   class OnnxInfo
   {
   public:
@@ -162,6 +167,33 @@ public:
 
   const OnnxInfo& getOnnxInfo() const { return m_OnnxInfo; }
 
+  /// Map @ref pFile read-only. The mapping lives as long as the module and
+  /// mapping a file again returns the same mapping.
+  /// @retval nullptr The file can not be mapped.
+  const MemoryMap* mapFile(const Path& pFile);
+
+  /// @return The file mapped by mapFile() which holds all of @ref pData, or
+  ///         nullptr. @ref pFile is then its path and @ref pOffset the offset
+  ///         of @ref pData in it.
+  const MemoryMap* findMappedFile(StringRef pData, Path& pFile,
+                                  uint64_t& pOffset) const;
+
+  /// Record that the data of initializer @ref pName is @ref pData, which is
+  /// usually a region of a file mapped by mapFile().
+  void setExternalData(const std::string& pName, StringRef pData) {
+    m_ExternalData[pName] = pData;
+  }
+
+  /// Forget the external data of initializer @ref pName, whose data is then
+  /// read from the tensor graph.
+  void eraseExternalData(const std::string& pName) {
+    m_ExternalData.erase(pName);
+  }
+
+  /// @return The data of initializer @ref pName stored outside the model
+  ///         file, or an empty reference if there is none.
+  StringRef getExternalData(const std::string& pName) const;
+
   bool hasRootComputeGraph() const { return (nullptr != m_pRootComputeGraph); }
 
   ComputeGraph* getRootComputeGraph() { return m_pRootComputeGraph; }
@@ -235,6 +267,8 @@ private:
   OnnxInfo m_OnnxInfo;
   OpsetImport m_OnnxSetId;
   MetaDataMap m_OnnxMetaData;
+  ExternalDataMap m_ExternalData;
+  std::map<std::string, std::unique_ptr<MemoryMap> > m_MappedFiles;
 
   // compute IR field
   ComputeGraph* m_pRootComputeGraph;
@@ -9,6 +9,7 @@
 #define ONNC_IR_ONNX_UTILS_H
 #include <onnc/IR/Module.h>
 #include <onnc/Config/ONNX.h>
+#include <ostream>
 
 namespace onnc {
 
@@ -17,7 +18,28 @@ typedef std::vector<int64_t> LongInts;
 
 void SerializeToString(std::string &pOutput, const Module &pModule);
 
-void ExportModelProto(xProto &pModelProto, const Module &pModule);
+/// Write @ref pModule as an ONNX model to @ref pOS. The payloads of the
+/// initializers kept outside the tensor graph are written straight from
+/// their mappings, without being copied into the proto.
+bool SerializeToOstream(std::ostream &pOS, const Module &pModule);
+
+/// The payloads of external initializers that ExportModelProto copies.
+enum ExportedPayloads {
+  kAllPayloads,  ///< all of them, for passes that rewrite weights
+  kShapePayloads ///< only the small vectors shape inference reads
+};
+
+/// Export @ref pModule. The payloads of the initializers that @ref pModule
+/// keeps outside its tensor graph are copied into the proto as selected by
+/// @ref pPayloads. The others are marked external but have neither data nor
+/// a location.
+void ExportModelProto(xProto &pModelProto, const Module &pModule,
+                      ExportedPayloads pPayloads = kAllPayloads);
+
+/// Undo the copies of ExportModelProto before @ref pModelProto is imported
+/// back into @ref pModule: payloads equal to the external data are dropped
+/// again, and the external data of rewritten initializers is forgotten.
+void ReleaseExternalData(xProto &pModelProto, Module &pModule);
 
 /// Factory of Module
 /// @param [in] pModuleProto The prototext of the module.
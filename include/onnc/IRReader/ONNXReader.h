@@ -28,6 +28,9 @@ public:
   virtual ~Reader();
 
   /// parse ONNX file
+  /// The file is mapped and only its graph structure is parsed. The raw data
+  /// of initializers stays in the file and is read through the mapping, so
+  /// it doesn't count against the total bytes limit.
   /// @return error occurred in the parsing.
   SystemError parse(const Path& pFileName, Module& pModule);
 
@@ -46,11 +49,15 @@ public:
   /// @param[in] pWarningThreshold
   void setTotalBytesLimit(int pTotalBytesLimit, int pWarningThreshold);
 
+  /// @return The size of the last parsed model in bytes.
+  uint64_t getModelSize() const { return m_ModelSize; }
+
   static void ShutdownProtobufLibrary();
 
 private:
   int m_TotalBytesLimit;
   int m_WarningThreshold;
+  uint64_t m_ModelSize;
 };
 
 } // namespace of onnx
@@ -0,0 +1,86 @@
+//===- Calibrator.h -------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_INTERPRETER_CALIBRATOR_H
+#define ONNC_INTERPRETER_CALIBRATOR_H
+#include <onnc/Analysis/CalibrationTable.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace onnc {
+
+class InferenceSession;
+class Value;
+
+/** \class Calibrator
+ *  \brief The range of every float value over the runs of a session.
+ *
+ *  InferenceSession records the inputs of the graph before a run and the
+ *  outputs of every step right after the step, before anything else can
+ *  reuse their memory. The threshold of a value is the largest magnitude it
+ *  took, which is what a symmetric int8 quantization needs. Run a set of
+ *  sample inputs and save the table for X86Quantize:
+ *
+ *  \code
+ *  Calibrator calibrator(session);
+ *  session.setCalibrator(&calibrator);
+ *  for (const Sample& sample : samples) {
+ *    session.setInput(0, sample.data(), sample.size());
+ *    session.run();
+ *  }
+ *  calibrator.getTable().write(file);
+ *  \endcode
+ *
+ *  Compile the session with TargetOptions::calibrate(), so that the values
+ *  have the names a quantizing compilation looks up.
+ */
+class Calibrator
+{
+public:
+  /// @param pSession A prepared session.
+  explicit Calibrator(InferenceSession& pSession);
+
+  /// Record the inputs of a run.
+  void beginRun();
+
+  /// Record the outputs of step pIdx of the plan, which has just run. A
+  /// step is recorded by one thread at a time.
+  void record(size_t pIdx);
+
+  unsigned int getNumOfRuns() const { return m_NumOfRuns; }
+
+  /// The table of the runs so far. The inputs of the graph come first, in
+  /// layers of their own, and then every step in the order of the plan,
+  /// named after its first output.
+  CalibrationTable getTable() const;
+
+private:
+  /// A float tensor in the memory of the session.
+  struct Range
+  {
+    const Value* value;
+    const float* data;
+    size_t size;
+    float threshold;
+  };
+
+  typedef std::vector<Range> RangeList;
+
+  static void Update(Range& pRange);
+
+private:
+  std::string m_Name;
+  RangeList m_Inputs;
+  std::vector<std::string> m_Layers; ///< one per plan step
+  std::vector<RangeList> m_Steps;    ///< one per plan step
+  unsigned int m_NumOfRuns;
+};
+
+} // namespace of onnc
+
+#endif
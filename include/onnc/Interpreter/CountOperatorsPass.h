@@ -5,8 +5,8 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#ifndef ONNC_COUNT_OPERATORS_PASS_H
-#define ONNC_COUNT_OPERATORS_PASS_H
+#ifndef ONNC_INTERPRETER_COUNT_OPERATORS_PASS_H
+#define ONNC_INTERPRETER_COUNT_OPERATORS_PASS_H
 #include <onnc/Core/ModulePass.h>
 #include <onnc/Analysis/Statistics.h>
 #include <iomanip>
@@ -0,0 +1,116 @@
+//===- ExecutionPlan.h ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_INTERPRETER_EXECUTION_PLAN_H
+#define ONNC_INTERPRETER_EXECUTION_PLAN_H
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace onnc {
+
+class ComputeOperator;
+
+/** \class ExecutionPlan
+ *  \brief A precompiled, flat list of runtime calls.
+ *
+ *  The Interpreter visits the graph once and records one Step per operator.
+ *  A step is a runtime call with every buffer address, dimension array and
+ *  attribute already resolved, so running the plan is a loop of indirect
+ *  calls without hashing or allocation. All arrays the calls refer to live
+ *  in the plan's own arena.
+ */
+class ExecutionPlan
+{
+public:
+  typedef void (*Invoke)(void* pContext, const void* pCall);
+
+  struct Step
+  {
+    Invoke invoke;
+    const void* call;
+    ComputeOperator* op;
+
+    void run(void* pContext) const { invoke(pContext, call); }
+  };
+
+  typedef std::vector<Step> StepList;
+
+public:
+  ExecutionPlan();
+
+  ~ExecutionPlan();
+
+  /// Record pCall, a callable taking the ONNC Runtime Context, as the step
+  /// of pOp.
+  template<typename Call>
+  void add(ComputeOperator& pOp, const Call& pCall);
+
+  /// @return pCount zero-initialized objects that live as long as the plan.
+  template<typename T>
+  T* allocate(size_t pCount);
+
+  /// Run all steps in order.
+  void run(void* pContext) const {
+    for (const Step& step : m_Steps)
+      step.run(pContext);
+  }
+
+  const StepList& steps() const { return m_Steps; }
+
+  bool empty() const { return m_Steps.empty(); }
+
+  size_t size() const { return m_Steps.size(); }
+
+  void clear();
+
+private:
+  ExecutionPlan(const ExecutionPlan&) = delete;
+  ExecutionPlan& operator=(const ExecutionPlan&) = delete;
+
+  template<typename Call>
+  static void invoke(void* pContext, const void* pCall) {
+    (*static_cast<const Call*>(pCall))(pContext);
+  }
+
+  void* allocateBytes(size_t pSize, size_t pAlignment);
+
+private:
+  StepList m_Steps;
+  std::vector<std::unique_ptr<char[]> > m_Blocks;
+  size_t m_BlockUsed;
+  size_t m_BlockSize;
+};
+
+template<typename Call>
+void ExecutionPlan::add(ComputeOperator& pOp, const Call& pCall)
+{
+  // The arena never runs destructors.
+  static_assert(std::is_trivially_destructible<Call>::value,
+                "a step must only capture pointers and values");
+  void* storage = allocateBytes(sizeof(Call), alignof(Call));
+  const Call* call = new (storage) Call(pCall);
+  m_Steps.push_back(Step{&invoke<Call>, call, &pOp});
+}
+
+template<typename T>
+T* ExecutionPlan::allocate(size_t pCount)
+{
+  static_assert(std::is_trivial<T>::value, "arena objects must be trivial");
+  if (pCount == 0)
+    return nullptr;
+  void* storage = allocateBytes(sizeof(T) * pCount, alignof(T));
+  std::memset(storage, 0, sizeof(T) * pCount);
+  return static_cast<T*>(storage);
+}
+
+} // namespace of onnc
+
+#endif
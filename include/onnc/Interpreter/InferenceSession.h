@@ -0,0 +1,173 @@
+//===- InferenceSession.h -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_INTERPRETER_INFERENCE_SESSION_H
+#define ONNC_INTERPRETER_INFERENCE_SESSION_H
+#include <onnc/Interpreter/Interpreter.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Support/Path.h>
+#include <onnc/Target/TargetOptions.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace onnc {
+
+class Calibrator;
+class Module;
+class Profiler;
+class Target;
+class TargetBackend;
+
+/** \class InferenceSession
+ *  \brief A compiled model that can run inference many times.
+ *
+ *  The model is parsed, compiled and planned once. Weights, the internal
+ *  memory, the input and output buffers and the runtime (with its thread
+ *  pool) stay alive between runs, so each run only pays for the inference
+ *  itself:
+ *
+ *  \code
+ *  InferenceSession session(num_threads);
+ *  session.load(model, *target, options);
+ *  for (const Image& image : images) {
+ *    session.setInput(0, image.data(), image.size());
+ *    session.run();
+ *    consume(session.getOutputBuffer(0), session.getOutputSize(0));
+ *  }
+ *  \endcode
+ */
+class InferenceSession
+{
+public:
+  /// @param pNumThreads Threads to run operators on; 0 keeps the runtime's
+  ///        default and 1 runs them one by one, in the order of the graph.
+  InferenceSession(unsigned int pNumThreads = 0, unsigned int pVerbose = 0);
+
+  ~InferenceSession();
+
+  /// Keep compiled modules in pDir. load() reuses them instead of parsing
+  /// and compiling the model again. An empty path disables it.
+  void setCacheDirectory(const Path& pDir) { m_CacheDir = pDir; }
+
+  /// Read pModel, compile it for pTarget and prepare() the result. The
+  /// session owns the module.
+  /// @param pDryRun Only compile the module and print its statistics.
+  /// @retval false If the model can not be read or compiled.
+  bool load(const Path& pModel, const Target& pTarget,
+            const TargetOptions& pOptions,
+            bool pOnnxOpt = false, bool pDryRun = false);
+
+  /// Set up buffers, the execution plan and the runtime for pModule, which
+  /// must have been through memory allocation. pModule must outlive the
+  /// session.
+  void prepare(Module& pModule);
+
+  /// @retval true If prepare() has been done.
+  bool isReady() const { return nullptr != m_pContext; }
+
+  Module* getModule() { return m_pModule; }
+
+  unsigned int getNumOfInputs() const { return m_Inputs.size(); }
+
+  Tensor* getInput(unsigned int pIdx) { return m_Inputs[pIdx].tensor; }
+
+  /// @return The buffer of the pIdx-th input; fill it before run().
+  void* getInputBuffer(unsigned int pIdx) { return m_Inputs[pIdx].buffer; }
+
+  /// @return The size of the pIdx-th input in bytes.
+  size_t getInputSize(unsigned int pIdx) const { return m_Inputs[pIdx].size; }
+
+  /// Copy pData into the pIdx-th input.
+  /// @retval false If pSize is not the size of the input.
+  bool setInput(unsigned int pIdx, const void* pData, size_t pSize);
+
+  /// Run inference on the current inputs.
+  void run();
+
+  /// Record the time of every step of the following runs in pProfiler,
+  /// which must be built from getPlan(). nullptr stops profiling.
+  void setProfiler(Profiler* pProfiler) { m_pProfiler = pProfiler; }
+
+  /// Record the range of every float value of the following runs in
+  /// pCalibrator, which must be built from this session. nullptr stops
+  /// recording.
+  void setCalibrator(Calibrator* pCalibrator) { m_pCalibrator = pCalibrator; }
+
+  /// The steps run() goes through, once prepare() has been done.
+  const ExecutionPlan& getPlan() const { return m_Interpreter.m_Plan; }
+
+  /// Where the values live, once prepare() has been done.
+  const Interpreter::AddressTable& getAddresses() const {
+    return m_Interpreter.m_ATable;
+  }
+
+  unsigned int getNumOfOutputs() const { return m_Outputs.size(); }
+
+  Tensor* getOutput(unsigned int pIdx) { return m_Outputs[pIdx].tensor; }
+
+  /// @return The pIdx-th output of the last run(). It is overwritten by the
+  ///         next run().
+  const float* getOutputBuffer(unsigned int pIdx) const {
+    return static_cast<const float*>(m_Outputs[pIdx].buffer);
+  }
+
+  /// @return The size of the pIdx-th output in bytes.
+  size_t getOutputSize(unsigned int pIdx) const { return m_Outputs[pIdx].size; }
+
+  /// Print every output, one per line.
+  void printOutputs(OStream& pOS) const;
+
+private:
+  InferenceSession(const InferenceSession&) = delete;
+  InferenceSession& operator=(const InferenceSession&) = delete;
+
+  struct Buffer
+  {
+    Tensor* tensor;
+    void* buffer;
+    size_t size;
+  };
+
+  struct Node;
+
+  /// Run a step of a parallel run, then submit the steps it unblocks.
+  static void runNode(void* pNode);
+
+  /// Build the dependency graph of the plan steps for parallel runs.
+  void buildGraph();
+
+  void runSerial();
+
+  void runParallel();
+
+  void release();
+
+private:
+  unsigned int m_NumThreads;
+  unsigned int m_Verbose;
+  Path m_CacheDir;
+  TargetOptions m_Options; ///< of m_pBackend
+  std::unique_ptr<Module> m_pOwnedModule;
+  std::unique_ptr<TargetBackend> m_pBackend;
+  Module* m_pModule;
+  Interpreter m_Interpreter;
+  void* m_pContext;
+  char* m_pHeap;
+  char* m_pInputMem;
+  std::vector<Buffer> m_Inputs;
+  std::vector<Buffer> m_Outputs;
+  std::vector<std::vector<float> > m_Widened; ///< integer weights as floats
+  std::unique_ptr<Node[]> m_Nodes; ///< one per plan step
+  Profiler* m_pProfiler;
+  Calibrator* m_pCalibrator;
+};
+
+} // namespace of onnc
+
+#endif
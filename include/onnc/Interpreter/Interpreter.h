@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #ifndef ONNC_INTERPRETER_INTERPRETER_H
 #define ONNC_INTERPRETER_INTERPRETER_H
+#include <onnc/Interpreter/ExecutionPlan.h>
 #include <onnc/IR/ComputeVisitor.h>
 #include <onnc/IR/Compute/Value.h>
 #include <onnc/IR/ComputeMemOperand.h>
@@ -16,14 +17,18 @@
 namespace onnc {
 /** \class Interpreter
  *  \brief Interpreter dispatch compute ir to runtime.
+ *
+ *  Visiting an operator does not run it, but appends its runtime call to
+ *  m_Plan. Run the plan to do the inference.
  */
 class Interpreter : public ComputeVisitor
 {
 public:
   // XXX
   typedef std::unordered_map<Value *, void *> AddressTable;
+  /// Addresses of values, only looked up while the plan is built.
   AddressTable m_ATable;
-  void *m_pContext;
+  ExecutionPlan m_Plan;
 
   virtual void visit(Abs& pAbs);
   virtual void visit(Acos& pAcos);
@@ -35,15 +40,18 @@ public:
   virtual void visit(Atan& pAtan);
   virtual void visit(AveragePool& pAveragePool);
   virtual void visit(BatchNormalization& pBatchNormalization);
+  virtual void visit(BatchNormalizationNCHWc& pBatchNormalizationNCHWc);
   virtual void visit(Cast& pCast);
   virtual void visit(Ceil& pCeil);
   virtual void visit(Clip& pClip);
   virtual void visit(Concat& pConcat);
   virtual void visit(Constant& pConstant);
   virtual void visit(Conv& pConv);
+  virtual void visit(ConvNCHWc& pConvNCHWc);
   virtual void visit(ConvTranspose& pConvTranspose);
   virtual void visit(Cos& pCos);
   virtual void visit(DepthToSpace& pDepthToSpace);
+  virtual void visit(Dequantize& pDequantize);
   virtual void visit(Div& pDiv);
   virtual void visit(Dropout& pDropout);
   virtual void visit(Elu& pElu);
@@ -52,6 +60,9 @@ public:
   virtual void visit(Expand& pExpand);
   virtual void visit(Flatten& pFlatten);
   virtual void visit(Floor& pFloor);
+  virtual void visit(FusedConv& pFusedConv);
+  virtual void visit(FusedElementwise& pFusedElementwise);
+  virtual void visit(FusedGemm& pFusedGemm);
   virtual void visit(GRU& pGRU);
   virtual void visit(Gather& pGather);
   virtual void visit(Gemm& pGemm);
@@ -63,6 +74,8 @@ public:
   virtual void visit(Hardmax& pHardmax);
   virtual void visit(Identity& pIdentity);
   virtual void visit(InstanceNormalization& pInstanceNormalization);
+  virtual void visit(Int8Conv& pInt8Conv);
+  virtual void visit(Int8Gemm& pInt8Gemm);
   virtual void visit(LRN& pLRN);
   virtual void visit(LSTM& pLSTM);
   virtual void visit(LeakyRelu& pLeakyRelu);
@@ -84,7 +97,9 @@ public:
   virtual void visit(Or& pOr);
   virtual void visit(PRelu& pPRelu);
   virtual void visit(Pad& pPad);
+  virtual void visit(PoolNCHWc& pPoolNCHWc);
   virtual void visit(Pow& pPow);
+  virtual void visit(Quantize& pQuantize);
   virtual void visit(RNN& pRNN);
   virtual void visit(RandomNormal& pRandomNormal);
   virtual void visit(RandomNormalLike& pRandomNormalLike);
@@ -102,6 +117,7 @@ public:
   virtual void visit(ReduceSum& pReduceSum);
   virtual void visit(ReduceSumSquare& pReduceSumSquare);
   virtual void visit(Relu& pRelu);
+  virtual void visit(Reorder& pReorder);
   virtual void visit(Reshape& pReshape);
   virtual void visit(Selu& pSelu);
   virtual void visit(Shape& pShape);
@@ -125,6 +141,7 @@ public:
   virtual void visit(Transpose& pTranspose);
   virtual void visit(Unsqueeze& pUnsqueeze);
   virtual void visit(Upsample& pUpsample);
+  virtual void visit(WinogradConv& pWinogradConv);
   virtual void visit(Xor& pXor);
   virtual void visit(ATen& pATen);
   virtual void visit(Affine& pAffine);
@@ -5,19 +5,19 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#ifndef ONNC_INTERPRETER_PASS_H
-#define ONNC_INTERPRETER_PASS_H
-#include "Interpreter.h"
+#ifndef ONNC_INTERPRETER_INTERPRETER_PASS_H
+#define ONNC_INTERPRETER_INTERPRETER_PASS_H
 #include <onnc/Core/ModulePass.h>
 
 namespace onnc {
 
+class InferenceSession;
 class TargetBackend;
 
 // XXX: Experimental
 
 /** \class InterpreterPass
- *  \brief Run interpreter.
+ *  \brief Print memory statistics and prepare an InferenceSession.
  */
 class InterpreterPass : public ModulePass
 {
@@ -26,25 +26,22 @@ public:
 
 public:
   InterpreterPass(TargetBackend *pBackend,
-                  char *pInputMem,
+                  InferenceSession& pSession,
                   unsigned int pVerbose,
                   bool pIsDryRun);
 
   ReturnType runOnModule(Module& pModule) override;
 
 private:
-  ReturnType runInterpreter(Module& pModule);
-
   TargetBackend *m_pBackend;
-  char *m_pInputMem;
+  InferenceSession& m_Session;
   unsigned int m_Verbose;
   bool m_DryRun;
-  Interpreter m_Interpreter;
 };
 
 // XXX: Experimental
 InterpreterPass *CreateInterpreterPass(TargetBackend *pBackend,
-                                       char *pInputMem,
+                                       InferenceSession& pSession,
                                        unsigned int pVerbose,
                                        bool pIsDryRun);
 
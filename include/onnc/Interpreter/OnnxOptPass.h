@@ -5,8 +5,8 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#ifndef ONNC_ONNX_OPT_PASS_H
-#define ONNC_ONNX_OPT_PASS_H
+#ifndef ONNC_INTERPRETER_ONNX_OPT_PASS_H
+#define ONNC_INTERPRETER_ONNX_OPT_PASS_H
 #include <onnc/Core/ModulePass.h>
 
 namespace onnc {
@@ -0,0 +1,133 @@
+//===- Profiler.h ---------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_INTERPRETER_PROFILER_H
+#define ONNC_INTERPRETER_PROFILER_H
+#include <onnc/Interpreter/ExecutionPlan.h>
+#include <onnc/JSON/Object.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Support/Path.h>
+#include <onnc/Support/Timer.h>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace onnc {
+
+class ComputeOperator;
+
+/** \class Profiler
+ *  \brief Wall time of every step of an execution plan over repeated runs.
+ *
+ *  InferenceSession records each step it runs. The report summarizes the
+ *  times of every operator (min, median and 99th percentile), the work
+ *  done according to the dimensions of its tensors, and the time spent in
+ *  each type of operator. It can be printed as text, saved as JSON, or
+ *  saved as a Chrome trace (chrome://tracing, Perfetto) showing every run
+ *  on every thread.
+ */
+class Profiler
+{
+public:
+  /// Work done by an operator, estimated from the dimensions of its tensors.
+  struct Cost
+  {
+    uint64_t flops; ///< floating point operations; a multiply-add is two
+    uint64_t bytes; ///< bytes of all inputs and outputs
+  };
+
+  /// Order statistics of a list of times, in ns.
+  struct Summary
+  {
+    Timer::Interval min;
+    Timer::Interval median;
+    Timer::Interval p99;
+    Timer::Interval total;
+  };
+
+public:
+  explicit Profiler(const ExecutionPlan& pPlan);
+
+  /// Mark the beginning and the end of one run of the whole plan.
+  void beginRun();
+  void endRun();
+
+  /// Record that step pIdx of the plan ran from pStart to pEnd on the
+  /// calling thread. Steps of one run may be recorded on any threads, but a
+  /// step is recorded by one thread at a time.
+  void record(size_t pIdx, Timer::Interval pStart, Timer::Interval pEnd);
+
+  unsigned int getNumOfRuns() const { return m_Runs.size(); }
+
+  static Cost GetCost(const ComputeOperator& pOp);
+
+  /// Print the operators taking the most time, and the time per type.
+  void print(OStream& pOS) const;
+
+  /// Summaries of the runs, of every operator and of every type.
+  void print(json::Object& pJSON) const;
+
+  /// Save print(json::Object&) in pFile.
+  /// @retval false If pFile can not be written.
+  bool writeJSON(const Path& pFile) const;
+
+  /// Save every recorded run and step in pFile in the Chrome trace event
+  /// format.
+  /// @retval false If pFile can not be written.
+  bool writeTrace(const Path& pFile) const;
+
+private:
+  struct Sample
+  {
+    unsigned int run;
+    Timer::Interval start;
+    Timer::Interval duration;
+    std::thread::id thread;
+  };
+
+  struct Run
+  {
+    Timer::Interval start;
+    Timer::Interval duration;
+  };
+
+  /// Everything known about a step of the plan.
+  struct Record
+  {
+    ComputeOperator* op;
+    std::string name; ///< the name of its first output
+    Cost cost;
+    std::vector<Sample> samples;
+  };
+
+  /// Time per type of operator.
+  struct TypeRecord
+  {
+    std::string type;
+    unsigned int count;
+    Timer::Interval median;
+    uint64_t flops;
+  };
+
+  static Summary Summarize(std::vector<Timer::Interval> pTimes);
+
+  Summary summarize(const Record& pRecord) const;
+
+  Summary summarizeRuns() const;
+
+  std::vector<TypeRecord> groupByType() const;
+
+private:
+  std::vector<Record> m_Records;
+  std::vector<Run> m_Runs;
+  Timer::Interval m_Origin;
+};
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Activation functions applied in place to a block of floats. They are the
+ * activations of the recurrent operators and the epilogues of the fused
+ * operators.
+ */
+
+typedef enum ONNC_RUNTIME_Activation_kind {
+  ONNC_RUNTIME_ACTIVATION_SIGMOID,
+  ONNC_RUNTIME_ACTIVATION_TANH,
+  ONNC_RUNTIME_ACTIVATION_RELU,
+  ONNC_RUNTIME_ACTIVATION_AFFINE,
+  ONNC_RUNTIME_ACTIVATION_LEAKY_RELU,
+  ONNC_RUNTIME_ACTIVATION_THRESHOLDED_RELU,
+  ONNC_RUNTIME_ACTIVATION_SCALED_TANH,
+  ONNC_RUNTIME_ACTIVATION_HARD_SIGMOID,
+  ONNC_RUNTIME_ACTIVATION_ELU,
+  ONNC_RUNTIME_ACTIVATION_SOFTSIGN,
+  ONNC_RUNTIME_ACTIVATION_SOFTPLUS,
+  ONNC_RUNTIME_ACTIVATION_CLIP
+} ONNC_RUNTIME_Activation_kind;
+
+typedef struct ONNC_RUNTIME_Activation {
+  ONNC_RUNTIME_Activation_kind kind;
+  float alpha;
+  float beta;
+} ONNC_RUNTIME_Activation;
+
+/**
+ * Resolve an activations attribute.
+ *
+ * @param defaults Names of the default activations of one direction.
+ * @param per_direction Number of activations of one direction.
+ * @param[out] result per_direction * num_directions activations. alpha and
+ *        beta values are consumed in order by the activations that take them.
+ */
+void ONNC_RUNTIME_internal_parse_activations(
+  const char * const * restrict activations, int32_t number_of_activations,
+  const float * restrict activation_alpha, int32_t number_of_activation_alpha,
+  const float * restrict activation_beta, int32_t number_of_activation_beta,
+  const char * const * restrict defaults, int32_t per_direction,
+  int32_t num_directions, ONNC_RUNTIME_Activation * restrict result);
+
+/** x[i] = act(x[i]) for i in [0, size) */
+void ONNC_RUNTIME_internal_activate(const ONNC_RUNTIME_Activation * restrict act,
+                                    int32_t size, float * restrict x);
+
+/** Apply acts[0], ..., acts[number_of_acts - 1] to x in turn. */
+void ONNC_RUNTIME_internal_activate_all(
+  const ONNC_RUNTIME_Activation * restrict acts, int32_t number_of_acts,
+  int32_t size, float * restrict x);
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <onnc/Runtime/internal/activation.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * ONNC_RUNTIME_conv_float followed by acts[0], ..., acts[number_of_acts - 1]
+ * on the output. The activations run on each block of Y as soon as the block
+ * is computed, so Y is written to memory once. input_W is of
+ * input_W_storage, an ONNC_RUNTIME_Storage.
+ */
+void ONNC_RUNTIME_internal_conv_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const void * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,int32_t input_W_storage
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,const char * restrict auto_pad
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+  ,const ONNC_RUNTIME_Activation * restrict acts
+  ,int32_t number_of_acts
+);
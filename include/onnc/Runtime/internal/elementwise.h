@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Element-wise binary operators supported by the vectorized kernels.
+ */
+typedef enum ONNC_RUNTIME_Binary_op {
+  ONNC_RUNTIME_BINARY_ADD,
+  ONNC_RUNTIME_BINARY_SUB,
+  ONNC_RUNTIME_BINARY_MUL,
+  ONNC_RUNTIME_BINARY_DIV,
+  ONNC_RUNTIME_NUMBER_OF_BINARY_OPS
+} ONNC_RUNTIME_Binary_op;
+
+/**
+ * Operand layout of a binary kernel call.
+ *   VV: c[i] = a[i] op b[i]
+ *   VS: c[i] = a[i] op b[0]
+ *   SV: c[i] = a[0] op b[i]
+ */
+typedef enum ONNC_RUNTIME_Binary_mode {
+  ONNC_RUNTIME_BINARY_VV,
+  ONNC_RUNTIME_BINARY_VS,
+  ONNC_RUNTIME_BINARY_SV,
+  ONNC_RUNTIME_NUMBER_OF_BINARY_MODES
+} ONNC_RUNTIME_Binary_mode;
+
+/**
+ * The kernels may run in place: c may be a or b, and y may be x.
+ */
+typedef void (*ONNC_RUNTIME_binary_kernel)(int64_t size, const float *a,
+                                           const float *b, float *c);
+
+typedef void (*ONNC_RUNTIME_unary_kernel)(int64_t size, const float *x,
+                                          float *y);
+
+/**
+ * Table of the element-wise kernels for one instruction set.
+ *
+ * exp, tanh and sigmoid of the SIMD tables are polynomial approximations.
+ * Over the whole float range, with denormal inputs treated as zero, their
+ * error is below 2 ulp for exp and tanh and below 3 ulp for sigmoid,
+ * compared with the exact result. Results below FLT_MIN may
+ * lose precision further; overflow yields +inf, and NaN is propagated.
+ */
+typedef struct ONNC_RUNTIME_Elementwise_kernels {
+  const char *name; /* Instruction set of the table */
+  ONNC_RUNTIME_binary_kernel binary[ONNC_RUNTIME_NUMBER_OF_BINARY_OPS]
+                                   [ONNC_RUNTIME_NUMBER_OF_BINARY_MODES];
+  ONNC_RUNTIME_unary_kernel relu;
+  ONNC_RUNTIME_unary_kernel abs;
+  ONNC_RUNTIME_unary_kernel exp;
+  ONNC_RUNTIME_unary_kernel tanh;
+  ONNC_RUNTIME_unary_kernel sigmoid;
+} ONNC_RUNTIME_Elementwise_kernels;
+
+/**
+ * Select the kernel table for the running CPU. Called by
+ * ONNC_RUNTIME_init_runtime.
+ *
+ * The environment variable ONNC_RUNTIME_SIMD (one of "scalar", "sse",
+ * "avx2", "avx512") overrides the choice, as long as the CPU supports it.
+ */
+void ONNC_RUNTIME_internal_elementwise_init(void);
+
+/**
+ * @return The selected kernel table. Selects it on the first use if
+ *         ONNC_RUNTIME_internal_elementwise_init has not been called.
+ */
+const ONNC_RUNTIME_Elementwise_kernels *ONNC_RUNTIME_internal_elementwise(void);
+
+/**
+ * C = A op B with multidirectional (numpy-style) broadcasting.
+ *
+ * Same-shape and scalar operands go straight to the vector kernels. Other
+ * shapes are walked row by row, where each row is again a VV, VS or SV call.
+ */
+void ONNC_RUNTIME_internal_binary_float(
+  ONNC_RUNTIME_Binary_op op
+  ,const float * input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const float * input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * output_C
+  ,int32_t output_C_ndim, const int32_t * restrict output_C_dims
+);
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Storage types of weights, numbered like the data types of ONNX. Weights
+ * stored in 16-bit floats take half the memory and bandwidth of floats.
+ * They are widened to float as the kernels read them, so all arithmetic
+ * stays in single precision.
+ */
+typedef enum ONNC_RUNTIME_Storage {
+  ONNC_RUNTIME_STORAGE_FLOAT = 1,
+  ONNC_RUNTIME_STORAGE_FLOAT16 = 10,  // IEEE 754 half precision
+  ONNC_RUNTIME_STORAGE_BFLOAT16 = 16  // the upper half of a float
+} ONNC_RUNTIME_Storage;
+
+/** @return The size of one element of storage in bytes. */
+static inline size_t ONNC_RUNTIME_internal_storage_size(int32_t storage) {
+  return (storage == ONNC_RUNTIME_STORAGE_FLOAT) ? sizeof(float)
+                                                 : sizeof(uint16_t);
+}
+
+/** @return The address of element index of X, which is of storage. */
+static inline const void *ONNC_RUNTIME_internal_storage_at(int32_t storage,
+                                                           const void *X,
+                                                           int64_t index) {
+  int64_t size = (int64_t)ONNC_RUNTIME_internal_storage_size(storage);
+  return (const char *)X + index * size;
+}
+
+static inline float ONNC_RUNTIME_internal_bits_to_float(uint32_t bits) {
+  float x;
+  memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+static inline uint32_t ONNC_RUNTIME_internal_float_to_bits(float x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+static inline float ONNC_RUNTIME_internal_half_to_float(uint16_t h) {
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+  uint32_t exponent = (h >> 10) & 0x1f;
+  uint32_t mantissa = h & 0x3ff;
+  if (exponent == 0x1f) {
+    // Infinities and NaNs.
+    return ONNC_RUNTIME_internal_bits_to_float(sign | 0x7f800000 |
+                                               (mantissa << 13));
+  }
+  if (exponent == 0) {
+    // Zeros and subnormals: mantissa * 2^-24, exact in float.
+    float x = (float)mantissa * 5.9604644775390625e-8f;
+    return ONNC_RUNTIME_internal_bits_to_float(
+        sign | ONNC_RUNTIME_internal_float_to_bits(x));
+  }
+  return ONNC_RUNTIME_internal_bits_to_float(sign | ((exponent + 112) << 23) |
+                                             (mantissa << 13));
+}
+
+/** Round x to the nearest half, ties to even. */
+static inline uint16_t ONNC_RUNTIME_internal_float_to_half(float x) {
+  uint32_t bits = ONNC_RUNTIME_internal_float_to_bits(x);
+  uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+  uint32_t magnitude = bits & 0x7fffffff;
+  if (magnitude > 0x7f800000) {
+    return sign | 0x7e00; // a quiet NaN
+  }
+  if (magnitude >= 0x477ff000) {
+    return sign | 0x7c00; // 65520 and up round to infinity
+  }
+  if (magnitude < 0x38800000) {
+    // Below 2^-14 the result is subnormal. Adding 0.5 leaves the mantissa
+    // in units of 2^-24 and lets the FPU round it.
+    float y = ONNC_RUNTIME_internal_bits_to_float(magnitude) + 0.5f;
+    uint32_t units = ONNC_RUNTIME_internal_float_to_bits(y) - 0x3f000000;
+    return sign | (uint16_t)units;
+  }
+  // Rebias the exponent from 127 to 15 and round the 13 dropped bits.
+  uint32_t odd = (magnitude >> 13) & 1;
+  magnitude += 0xc8000fff + odd;
+  return sign | (uint16_t)(magnitude >> 13);
+}
+
+static inline float ONNC_RUNTIME_internal_bfloat16_to_float(uint16_t h) {
+  return ONNC_RUNTIME_internal_bits_to_float((uint32_t)h << 16);
+}
+
+/** Round x to the nearest bfloat16, ties to even. */
+static inline uint16_t ONNC_RUNTIME_internal_float_to_bfloat16(float x) {
+  uint32_t bits = ONNC_RUNTIME_internal_float_to_bits(x);
+  if ((bits & 0x7fffffff) > 0x7f800000) {
+    return (uint16_t)((bits >> 16) | 0x40); // a quiet NaN
+  }
+  bits += 0x7fff + ((bits >> 16) & 1);
+  return (uint16_t)(bits >> 16);
+}
+
+/**
+ * Y[i] = X[i] for i in [0, n), where X is of storage. Half floats are
+ * converted by F16C on CPUs that have it.
+ */
+void ONNC_RUNTIME_internal_widen(int32_t storage, const void * restrict X,
+                                 float * restrict Y, int64_t n);
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Blocked NCHWc layout.
+ *
+ * A N x C x D1 x ... x Dn tensor in NCHW is stored in NCHWc as a
+ * N x ceil(C / block) x D1 x ... x Dn x block tensor: the channels are split
+ * into blocks of block channels and the channels of a block are the
+ * innermost axis, so one vector register holds the same element of every
+ * channel of a block. Channels past C in the last block are padding; the
+ * kernels keep them finite and never read them back into the real channels.
+ *
+ * The blocked kernels support a block of 8 or 16 channels.
+ */
+
+/** @return The number of channel blocks of C channels. */
+static inline int32_t ONNC_RUNTIME_internal_channel_blocks(int32_t C,
+                                                           int32_t block) {
+  return (C + block - 1) / block;
+}
+
+/**
+ * y = x in NCHWc, where x is a N x C x spatial tensor in NCHW. The padding
+ * channels of y are set to zero.
+ */
+void ONNC_RUNTIME_internal_to_blocked(void *onnc_runtime_context,
+                                      int32_t N, int32_t C, int64_t spatial,
+                                      int32_t block,
+                                      const float * restrict x,
+                                      float * restrict y);
+
+/**
+ * y = x in NCHW, where x is a N x C x spatial tensor in NCHWc. The padding
+ * channels of x are dropped.
+ */
+void ONNC_RUNTIME_internal_from_blocked(void *onnc_runtime_context,
+                                        int32_t N, int32_t C, int64_t spatial,
+                                        int32_t block,
+                                        const float * restrict x,
+                                        float * restrict y);
+
+/**
+ * Pack the M x C x kernel_size weights W of a convolution for
+ * ONNC_RUNTIME_convnchwc_float, as a
+ * ceil(M / block) x ceil(C / block) x kernel_size x block x block tensor:
+ * packed[mb][cb][k][ci][co] = W[mb * block + co][cb * block + ci][k].
+ * Padding channels get zero weights.
+ */
+void ONNC_RUNTIME_internal_conv_weight_nchwc(int32_t M, int32_t C,
+                                             int32_t kernel_size,
+                                             int32_t block,
+                                             const float * restrict W,
+                                             float * restrict packed);
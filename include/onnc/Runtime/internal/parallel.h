@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Body of a parallel loop. Called once for every task in [0, number_of_tasks).
+ */
+typedef void (*ONNC_RUNTIME_parallel_fn)(void *arg, int32_t task);
+
+/**
+ * A unit of work submitted to the thread pool.
+ */
+typedef void (*ONNC_RUNTIME_task_fn)(void *arg);
+
+/**
+ * Work-stealing thread pool shared by the whole runtime.
+ *
+ * Every worker owns a deque: it pushes and pops its own tasks at the bottom
+ * (most recent first, so the data they touch is still in cache) and steals
+ * from the top of the others' deques when it runs dry. Threads outside the
+ * pool push into a shared injection deque. Threads that wait for tasks to
+ * finish run pending tasks meanwhile, so tasks may submit and wait for tasks
+ * of their own without deadlocking the pool.
+ */
+typedef struct ONNC_RUNTIME_Thread_pool ONNC_RUNTIME_Thread_pool;
+
+/**
+ * A set of submitted tasks that can be waited for.
+ */
+typedef struct ONNC_RUNTIME_Task_group {
+  int32_t pending; /* Tasks submitted but not finished yet */
+} ONNC_RUNTIME_Task_group;
+
+/**
+ * Start a thread pool with num_threads - 1 workers; the thread that waits
+ * for tasks is the last one.
+ * @return The pool, or NULL if num_threads is less than 2 or the pool can not
+ *         be allocated. Without a pool, operators run serially.
+ */
+ONNC_RUNTIME_Thread_pool *ONNC_RUNTIME_internal_thread_pool_create(int32_t num_threads);
+
+/**
+ * Stop and join all workers. The pool must not have pending tasks.
+ */
+void ONNC_RUNTIME_internal_thread_pool_destroy(ONNC_RUNTIME_Thread_pool *pool);
+
+/**
+ * @return The number of threads an operator may use, taken from the
+ *         num_threads field of the ONNC Runtime Context. 1 when the context is
+ *         NULL or the field is not positive.
+ */
+int32_t ONNC_RUNTIME_internal_num_threads(const void *onnc_runtime_context);
+
+/**
+ * Queue fn(arg) on the thread pool of the ONNC Runtime Context as a member of
+ * group. Without a thread pool, or when the task can not be queued, fn(arg)
+ * runs right away on the calling thread.
+ */
+void ONNC_RUNTIME_internal_submit(void *onnc_runtime_context,
+                                  ONNC_RUNTIME_Task_group *group,
+                                  ONNC_RUNTIME_task_fn fn,
+                                  void *arg);
+
+/**
+ * Wait until every task of group has finished, running queued tasks on the
+ * calling thread in the meantime.
+ */
+void ONNC_RUNTIME_internal_wait(void *onnc_runtime_context,
+                                ONNC_RUNTIME_Task_group *group);
+
+/**
+ * Run fn(arg, task) for every task in [0, number_of_tasks) on up to
+ * ONNC_RUNTIME_internal_num_threads(onnc_runtime_context) threads of the
+ * context's thread pool, and wait for all of them. Tasks are handed out
+ * dynamically, so they may run in any order. The calling thread takes part
+ * in the work.
+ */
+void ONNC_RUNTIME_internal_parallel_for(void *onnc_runtime_context,
+                                        int32_t number_of_tasks,
+                                        ONNC_RUNTIME_parallel_fn fn,
+                                        void *arg);
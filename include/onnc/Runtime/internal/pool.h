@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Pooling windows supported by ONNC_RUNTIME_internal_pool.
+ *   AVERAGE:             mean of the elements inside the input
+ *   AVERAGE_INCLUDE_PAD: sum of the elements divided by the kernel size
+ *   MAX:                 maximum of the elements inside the input
+ *   LP:                  (sum of |x| ^ p) ^ (1 / p)
+ * Padded elements never take part in MAX or LP.
+ */
+typedef enum ONNC_RUNTIME_Pool_op {
+  ONNC_RUNTIME_POOL_AVERAGE,
+  ONNC_RUNTIME_POOL_AVERAGE_INCLUDE_PAD,
+  ONNC_RUNTIME_POOL_MAX,
+  ONNC_RUNTIME_POOL_LP
+} ONNC_RUNTIME_Pool_op;
+
+/**
+ * Pool the spatial axes of x, an N x C x D1 x ... x Dn tensor, into y.
+ *
+ * A task computes whole rows of y (along Dn): every row of the window is
+ * swept over the row of y with a unit stride loop where possible, so y is
+ * the accumulator and the input row is read in order. The rows are split
+ * over the threads of the ONNC Runtime Context.
+ *
+ * @param p Exponent of LP, ignored otherwise.
+ * @param pads Begin paddings of the n spatial axes, or NULL for none. The
+ *        end paddings follow from the dimensions of y.
+ * @param strides Strides of the n spatial axes, or NULL for all ones.
+ */
+void ONNC_RUNTIME_internal_pool(void *onnc_runtime_context,
+                                ONNC_RUNTIME_Pool_op op, int32_t p,
+                                int32_t ndim,
+                                const float * restrict x,
+                                const int32_t * restrict x_dims,
+                                float * restrict y,
+                                const int32_t * restrict y_dims,
+                                const int32_t * restrict kernel_shape,
+                                const int32_t * restrict pads,
+                                const int32_t * restrict strides);
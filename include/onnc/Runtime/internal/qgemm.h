@@ -0,0 +1,71 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Blocking parameters of the packed int8 GEMM.
+ *
+ * The micro-kernel computes a QGEMM_MR x QGEMM_NR block of int32 sums in
+ * registers. K is packed in groups of four, which the dot product
+ * instructions of VNNI consume at once: A is packed into QGEMM_MC x K panels
+ * and B, the weights, is packed once per call.
+ */
+#define ONNC_RUNTIME_QGEMM_MR 6
+#define ONNC_RUNTIME_QGEMM_NR 16
+#define ONNC_RUNTIME_QGEMM_MC 144
+
+/**
+ * Symmetric quantization of int8 tensors: a float x is stored as
+ * saturate(round(x / scale)), where round goes to the nearest even integer
+ * and saturate clamps to [-128, 127].
+ */
+static inline int8_t ONNC_RUNTIME_internal_saturate_s8(float x) {
+  if (x >= 127.f) {
+    return 127;
+  }
+  if (x <= -128.f) {
+    return -128;
+  }
+  return (int8_t)nearbyintf(x);
+}
+
+/**
+ * How ONNC_RUNTIME_internal_qgemm turns the int32 sum of row i and column j
+ * into an int8 output:
+ *
+ *   y = saturate(round((sum * scales[j] + bias[j]) / output_scale))
+ *
+ * Negative values become zero before rounding when relu is set. bias may be
+ * NULL.
+ */
+typedef struct ONNC_RUNTIME_Requantize {
+  const float *scales;
+  const float *bias;
+  float output_scale;
+  bool relu;
+} ONNC_RUNTIME_Requantize;
+
+/**
+ * Int8 general matrix multiplication with int32 accumulation.
+ *
+ *   sum[M x N] = A[M x K] * B[N x K]^T
+ *
+ * A and B are row-major with K contiguous, so a row of A is a row of
+ * activations (or an im2col patch) and a row of B the weights of one output
+ * channel. Every sum is requantized by requantize and stored at
+ * Y[i * row_stride + j * col_stride], so Y may be written transposed.
+ *
+ * @param onnc_runtime_context The ONNC Runtime Context, or NULL. Large
+ *        problems are split over its num_threads threads.
+ * @param lda Distance (in elements) between two rows of A, at least K.
+ * @param ldb Distance (in elements) between two rows of B, at least K.
+ */
+void ONNC_RUNTIME_internal_qgemm(void *onnc_runtime_context,
+                                 int32_t M, int32_t N, int32_t K,
+                                 const int8_t * restrict A, int32_t lda,
+                                 const int8_t * restrict B, int32_t ldb,
+                                 const ONNC_RUNTIME_Requantize * restrict requantize,
+                                 int8_t * restrict Y,
+                                 int64_t row_stride, int64_t col_stride);
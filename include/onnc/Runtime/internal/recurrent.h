@@ -0,0 +1,68 @@
+#pragma once
+
+#include <onnc/Runtime/internal/activation.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Shared pieces of the LSTM, GRU and RNN kernels.
+ *
+ * All three run the same way: the input projection X * W^T + Wb of every
+ * timestep is computed up front with one GEMM, then each timestep does one
+ * small h * R^T GEMM over the batch followed by a gate kernel that works on
+ * one batch row while it is hot in cache.
+ */
+
+/** Clamp x[i] into [-clip, clip]. Does nothing if clip is not positive. */
+void ONNC_RUNTIME_internal_clip(float clip, int32_t size, float * restrict x);
+
+/** @return 2 for "bidirectional", otherwise 1. */
+int32_t ONNC_RUNTIME_internal_num_directions(const char * restrict direction);
+
+/** @return true if the direction-th pass of the operator runs backward. */
+bool ONNC_RUNTIME_internal_is_reverse(const char * restrict direction,
+                                      int32_t index);
+
+/**
+ * proj[seq_length * batch_size x size] = X * W^T + bias
+ *
+ * @param X [seq_length * batch_size x input_size]
+ * @param W [size x input_size]
+ * @param bias The bias to add to each row, or NULL.
+ */
+void ONNC_RUNTIME_internal_input_projection(
+  void * restrict onnc_runtime_context,
+  int32_t rows, int32_t input_size, int32_t size,
+  const float * restrict X, const float * restrict W,
+  const float * restrict bias, float * restrict proj);
+
+/**
+ * @return The length of the b-th batch entry: seq_lens[b] clamped to
+ *         [0, seq_length], or seq_length when there is no sequence_lens.
+ */
+static inline int32_t ONNC_RUNTIME_internal_sequence_length(
+    const int32_t * restrict seq_lens, int32_t b, int32_t seq_length) {
+  if (seq_lens == NULL) {
+    return seq_length;
+  }
+  int32_t seq_len = seq_lens[b];
+  if (seq_len < 0) {
+    return 0;
+  }
+  return (seq_len > seq_length) ? seq_length : seq_len;
+}
+
+/**
+ * @return The timestep that the step-th iteration of a batch entry of
+ *         length seq_len works on, or -1 when the entry is already done.
+ */
+static inline int32_t ONNC_RUNTIME_internal_timestep(int32_t step,
+                                                     int32_t seq_len,
+                                                     bool reverse) {
+  if (step >= seq_len) {
+    return -1;
+  }
+  return reverse ? seq_len - 1 - step : step;
+}
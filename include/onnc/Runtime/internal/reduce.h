@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Reductions supported by ONNC_RUNTIME_internal_reduce. Each one folds f(x)
+ * of the reduced elements:
+ *   SUM:        x
+ *   SUM_ABS:    |x|
+ *   SUM_SQUARE: x * x
+ *   SUM_EXP:    exp(x)
+ *   MAX, MIN, PROD
+ */
+typedef enum ONNC_RUNTIME_Reduce_op {
+  ONNC_RUNTIME_REDUCE_SUM,
+  ONNC_RUNTIME_REDUCE_SUM_ABS,
+  ONNC_RUNTIME_REDUCE_SUM_SQUARE,
+  ONNC_RUNTIME_REDUCE_SUM_EXP,
+  ONNC_RUNTIME_REDUCE_MAX,
+  ONNC_RUNTIME_REDUCE_MIN,
+  ONNC_RUNTIME_REDUCE_PROD
+} ONNC_RUNTIME_Reduce_op;
+
+/**
+ * Set reduced[i] for every axis i of the ndim axes: true if axis i is in
+ * axes. Negative axes count from the back. No axes at all means all axes,
+ * as in ONNX.
+ */
+void ONNC_RUNTIME_internal_reduce_axes(int32_t ndim,
+                                       const int32_t * restrict axes,
+                                       int32_t number_of_axes,
+                                       bool * restrict reduced);
+
+/**
+ * Reduce the axes i of x for which reduced[i] is true with op. y holds one element per combination
+ * of the kept axes, in the same order as in x, so its layout is the same
+ * whether the reduced axes are kept (as 1) or not.
+ *
+ * Adjacent axes that are both kept or both reduced are merged first, so a
+ * tensor is at most a few groups of contiguous axes. When the innermost
+ * group is kept, rows of y are accumulated from contiguous rows of x, one
+ * vector at a time. When the innermost group is reduced, every element of y
+ * is a horizontal reduction of contiguous elements of x. Either way, the
+ * elements of y are split over the threads of the ONNC Runtime Context.
+ */
+void ONNC_RUNTIME_internal_reduce(void *onnc_runtime_context,
+                                  ONNC_RUNTIME_Reduce_op op,
+                                  int32_t ndim, const int32_t * restrict dims,
+                                  const bool * restrict reduced,
+                                  const float * restrict x,
+                                  float * restrict y);
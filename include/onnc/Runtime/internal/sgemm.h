@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Blocking parameters of the packed SGEMM.
+ *
+ * The micro-kernel computes a SGEMM_MR x SGEMM_NR block of C in registers.
+ * A is packed into SGEMM_MC x SGEMM_KC panels (fits L2), B is packed into
+ * SGEMM_KC x SGEMM_NC panels (fits L3), and a SGEMM_KC x SGEMM_NR sliver of
+ * packed B stays in L1 while the micro-kernel sweeps over packed A.
+ */
+#define ONNC_RUNTIME_SGEMM_MR 6
+#define ONNC_RUNTIME_SGEMM_NR 16
+#define ONNC_RUNTIME_SGEMM_MC 144
+#define ONNC_RUNTIME_SGEMM_KC 256
+#define ONNC_RUNTIME_SGEMM_NC 4096
+
+/**
+ * Single precision general matrix multiplication on row-major matrices.
+ *
+ *   C[M x N] = alpha * op(A)[M x K] * op(B)[K x N] + beta * C[M x N]
+ *
+ * where op(X) is X, or X^T if the corresponding trans flag is set.
+ * Transposition is done while packing, so it costs nothing extra.
+ *
+ * @param onnc_runtime_context The ONNC Runtime Context, or NULL. Large
+ *        problems are split over its num_threads threads.
+ * @param lda Distance (in elements) between two rows of A as stored, i.e.
+ *        at least K, or M when transA is set.
+ * @param ldb Distance (in elements) between two rows of B as stored, i.e.
+ *        at least N, or K when transB is set.
+ * @param ldc Distance (in elements) between two rows of C.
+ * @note When beta is 0, C is not read, so it may hold uninitialized memory.
+ */
+void ONNC_RUNTIME_internal_sgemm(void *onnc_runtime_context,
+                                 bool transA, bool transB,
+                                 int32_t M, int32_t N, int32_t K,
+                                 float alpha,
+                                 const float * restrict A, int32_t lda,
+                                 const float * restrict B, int32_t ldb,
+                                 float beta,
+                                 float * restrict C, int32_t ldc);
+
+/**
+ * ONNC_RUNTIME_internal_sgemm on A and B of the given storage types
+ * (ONNC_RUNTIME_Storage in half.h). 16-bit floats are widened while they
+ * are packed, so they halve the memory traffic of a weight matrix and leave
+ * the arithmetic as it is.
+ */
+void ONNC_RUNTIME_internal_sgemm_mixed(void *onnc_runtime_context,
+                                       bool transA, bool transB,
+                                       int32_t M, int32_t N, int32_t K,
+                                       float alpha,
+                                       const void * restrict A,
+                                       int32_t storageA, int32_t lda,
+                                       const void * restrict B,
+                                       int32_t storageB, int32_t ldb,
+                                       float beta,
+                                       float * restrict C, int32_t ldc);
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Up to this many dimensions are supported by the transpose kernel.
+ */
+#define ONNC_RUNTIME_TRANSPOSE_MAX_NDIM 32
+
+/**
+ * Permute the axes of x into y, as numpy.transpose: axis i of y is axis
+ * perm[i] of x. A NULL perm reverses the axes.
+ *
+ * Axes of one element are dropped and axes that stay adjacent are merged
+ * first, so NCHW <-> NHWC becomes a batch of 2-D transposes and the identity
+ * becomes a copy. When the innermost axis stays in place, whole rows are
+ * copied. Otherwise a batch of 2-D transposes between the innermost axes of
+ * x and y is done by halving the larger side until a block fits in cache,
+ * then in 8 x 8 register tiles. The work is split over the threads of the
+ * ONNC Runtime Context.
+ */
+void ONNC_RUNTIME_internal_transpose(void *onnc_runtime_context,
+                                     int32_t ndim,
+                                     const int32_t * restrict dims,
+                                     const int32_t * restrict perm,
+                                     const float * restrict x,
+                                     float * restrict y);
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Winograd convolution F(m x m, 3 x 3) computes an m x m tile of the output
+ * of a 3 x 3, stride 1 convolution from an (m + 2) x (m + 2) tile of the
+ * input, as
+ *
+ *   Y = A^T [ sum_c (G g_c G^T) .* (B^T d_c B) ] A
+ *
+ * The runtime supports m = 2 and m = 4.
+ */
+#define ONNC_RUNTIME_WINOGRAD_ALPHA(tile) ((tile) + 2)
+
+/**
+ * Transform the weights of a convolution for ONNC_RUNTIME_winogradconv_float.
+ *
+ * @param W The [M x C x 3 x 3] weights of the convolution.
+ * @param[out] U The [alpha * alpha x M x C] transformed weights, where alpha is
+ *        ONNC_RUNTIME_WINOGRAD_ALPHA(tile). U[xi] is G W[m][c] G^T at xi.
+ */
+void ONNC_RUNTIME_internal_winograd_weight_float(int32_t tile,
+                                                 int32_t M, int32_t C,
+                                                 const float * restrict W,
+                                                 float * restrict U);
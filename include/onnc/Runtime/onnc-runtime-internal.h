@@ -4,12 +4,16 @@
 
 #include <stddef.h>
 
+struct ONNC_RUNTIME_Thread_pool;
+
 typedef struct ONNC_RUNTIME_Context {
   void *input_context;
   void *weight_context;
   void *output_context;
   void **mem; /* Deprecated */
   size_t mem_i; /* Deprecated */
+  int32_t num_threads; /* Threads an operator may use, 1 if not positive */
+  struct ONNC_RUNTIME_Thread_pool *thread_pool; /* NULL when single threaded */
 } Context;
 
 
@@ -37,6 +37,16 @@ void *ONNC_RUNTIME_init_runtime();
  */
 bool ONNC_RUNTIME_shutdown_runtime(void *onnc_runtime_context);
 
+/**
+ * Set the number of threads the runtime may use, and restart its thread pool
+ * accordingly. 1 runs everything on the calling thread, in a deterministic
+ * order. The default comes from the ONNC_RUNTIME_NUM_THREADS environment
+ * variable, or 1 if it is not set.
+ * @param onnc_runtime_context The ONNC Runtime Context.
+ * @param num_threads The number of threads, including the calling one.
+ */
+void ONNC_RUNTIME_set_num_threads(void *onnc_runtime_context, int32_t num_threads);
+
 /**
  * Get tensor address from tensor table.
  * @param tensor_table The tensor table start address.
@@ -55,15 +65,18 @@ void *ONNC_RUNTIME_load_from_tensor_table(void *tensor_table, uint32_t index);
 #include "operator/atan.h"
 #include "operator/averagepool.h"
 #include "operator/batchnormalization.h"
+#include "operator/batchnormalizationnchwc.h"
 #include "operator/cast.h"
 #include "operator/ceil.h"
 #include "operator/clip.h"
 #include "operator/concat.h"
 #include "operator/constant.h"
 #include "operator/conv.h"
+#include "operator/convnchwc.h"
 #include "operator/convtranspose.h"
 #include "operator/cos.h"
 #include "operator/depthtospace.h"
+#include "operator/dequantize.h"
 #include "operator/div.h"
 #include "operator/dropout.h"
 #include "operator/elu.h"
@@ -72,6 +85,9 @@ void *ONNC_RUNTIME_load_from_tensor_table(void *tensor_table, uint32_t index);
 #include "operator/expand.h"
 #include "operator/flatten.h"
 #include "operator/floor.h"
+#include "operator/fusedconv.h"
+#include "operator/fusedelementwise.h"
+#include "operator/fusedgemm.h"
 #include "operator/gru.h"
 #include "operator/gather.h"
 #include "operator/gemm.h"
@@ -84,6 +100,8 @@ void *ONNC_RUNTIME_load_from_tensor_table(void *tensor_table, uint32_t index);
 #include "operator/identity.h"
 #include "operator/if.h"
 #include "operator/instancenormalization.h"
+#include "operator/int8conv.h"
+#include "operator/int8gemm.h"
 #include "operator/lrn.h"
 #include "operator/lstm.h"
 #include "operator/leakyrelu.h"
@@ -106,7 +124,9 @@ void *ONNC_RUNTIME_load_from_tensor_table(void *tensor_table, uint32_t index);
 #include "operator/or.h"
 #include "operator/prelu.h"
 #include "operator/pad.h"
+#include "operator/poolnchwc.h"
 #include "operator/pow.h"
+#include "operator/quantize.h"
 #include "operator/rnn.h"
 #include "operator/randomnormal.h"
 #include "operator/randomnormallike.h"
@@ -124,6 +144,7 @@ void *ONNC_RUNTIME_load_from_tensor_table(void *tensor_table, uint32_t index);
 #include "operator/reducesum.h"
 #include "operator/reducesumsquare.h"
 #include "operator/relu.h"
+#include "operator/reorder.h"
 #include "operator/reshape.h"
 #include "operator/scan.h"
 #include "operator/selu.h"
@@ -148,6 +169,7 @@ void *ONNC_RUNTIME_load_from_tensor_table(void *tensor_table, uint32_t index);
 #include "operator/transpose.h"
 #include "operator/unsqueeze.h"
 #include "operator/upsample.h"
+#include "operator/winogradconv.h"
 #include "operator/xor.h"
 #include "operator/aten.h"
 #include "operator/affine.h"
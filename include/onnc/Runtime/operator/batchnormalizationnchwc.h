@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_batchnormalizationnchwc_float(
+  void * restrict onnc_runtime_context
+  ,const float * input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const float * restrict input_scale
+  ,int32_t input_scale_ndim, const int32_t * restrict input_scale_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_mean
+  ,int32_t input_mean_ndim, const int32_t * restrict input_mean_dims
+  ,const float * restrict input_var
+  ,int32_t input_var_ndim, const int32_t * restrict input_var_dims
+  ,float * output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float epsilon
+);
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_dequantize_float(
+  void * restrict onnc_runtime_context
+  ,const int8_t * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float scale
+);
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_fusedgemm_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,float alpha
+  ,float beta
+  ,int32_t transA
+  ,int32_t transB
+);
+
+/**
+ * ONNC_RUNTIME_fusedgemm_float with the weights input_B stored as weight_type, an
+ * ONNC_RUNTIME_Storage: the data type of ONNX FLOAT, FLOAT16 or BFLOAT16.
+ */
+void ONNC_RUNTIME_fusedgemm_mixed(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const void * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,float alpha
+  ,float beta
+  ,int32_t transA
+  ,int32_t transB
+  ,int32_t weight_type
+);
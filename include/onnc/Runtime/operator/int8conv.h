@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_int8conv_float(
+  void * restrict onnc_runtime_context
+  ,const int8_t * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const int8_t * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,int8_t * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,float output_scale
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t relu
+  ,float * restrict scales
+  ,int32_t number_of_scales
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+);
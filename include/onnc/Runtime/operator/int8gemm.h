@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_int8gemm_float(
+  void * restrict onnc_runtime_context
+  ,const int8_t * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const int8_t * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,int8_t * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float output_scale
+  ,int32_t relu
+  ,float * restrict scales
+  ,int32_t number_of_scales
+);
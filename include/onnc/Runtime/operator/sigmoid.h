@@ -5,9 +5,9 @@
 
 void ONNC_RUNTIME_sigmoid_float(
   void * restrict onnc_runtime_context
-  ,const float * restrict input_X
+  ,const float * input_X
   ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
-  ,float * restrict output_Y
+  ,float * output_Y
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   
 );
@@ -14,6 +14,9 @@ namespace onnc {
 
 /** \class onnc::Timer
  *  \brief provides time-out signal.
+ *
+ *  Every Timer keeps its own starting time, so timers can be nested and
+ *  used on several threads at once.
  */
 class Timer
 {
@@ -35,7 +38,11 @@ public:
 
   static std::string unit();
 
+  /// @return The current time of a monotonic clock, in unit().
+  static Interval now();
+
 private:
+  Interval m_Start;
   Interval m_Interval;
   bool m_bIsActive;
 };
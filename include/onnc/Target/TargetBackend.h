@@ -35,6 +35,10 @@ public:
 
   virtual void addCodeEmit(PassManager& pPM, const Path& pOutput) { return; }
 
+  /// @retval true If addCodeEmit() only reads the compute IR, so that it can
+  ///         emit a module loaded from a CompiledModuleCache.
+  virtual bool canEmitCachedModule() const { return false; }
+
   virtual const TargetTransformInfo* getTTI() const { return nullptr; }
 
   /// For the backend using standard TensorSel pass.
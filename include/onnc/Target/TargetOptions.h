@@ -17,6 +17,23 @@ namespace onnc {
  */
 class TargetOptions
 {
+public:
+  /// Placement strategies of LinearScanMemAlloc
+  enum MemAllocStrategy {
+    kFirstFit,      ///< in order of definition, at the lowest free address
+    kBestFit,       ///< in order of definition, in the smallest free block
+    kGreedyBySize,  ///< largest size x lifetime first, in the smallest block
+    kSkyline,       ///< longest lifetime first, at the lowest free address
+    kMinimumMemory  ///< try all of the above and keep the smallest
+  };
+
+  /// Storage types of the weights of convolutions and matrix products
+  enum WeightType {
+    kFloatWeight,    ///< as the model has them
+    kFloat16Weight,  ///< IEEE 754 half precision
+    kBFloat16Weight  ///< the upper 16 bits of a float
+  };
+
 public:
   TargetOptions();
 
@@ -56,14 +73,68 @@ public:
 
   void optOnnxModel(std::string pFileName) { m_OptOnnxModel = pFileName; }
 
+  /// This property holds how memory allocation places values
+  MemAllocStrategy getMemAllocStrategy() const { return m_MemAllocStrategy; }
+
+  void setMemAllocStrategy(MemAllocStrategy pStrategy) {
+    m_MemAllocStrategy = pStrategy;
+  }
+
+  /// Set the strategy by name: first-fit, best-fit, greedy-by-size, skyline
+  /// or minimum.
+  /// @retval false If pName is not a strategy.
+  bool setMemAllocStrategy(const std::string& pName);
+
+  /// This property holds whether the module is compiled to record a
+  /// calibration table. Values then keep the names and the layout a
+  /// quantizing compilation sees.
+  bool shouldCalibrate() const { return m_Calibrate; }
+
+  void calibrate(bool pEnable = true) { m_Calibrate = pEnable; }
+
+  /// This property holds the calibration table that drives the int8
+  /// quantization of a CPU backend. Empty means float inference.
+  const std::string& getCalibrationTable() const { return m_CalibrationTable; }
+
+  void setCalibrationTable(const std::string& pFileName) {
+    m_CalibrationTable = pFileName;
+  }
+
+  /// This property holds the storage type that a CPU backend narrows float
+  /// weights to. Arithmetic stays in float, so narrow weights save memory
+  /// and bandwidth at the cost of precision.
+  WeightType getWeightType() const { return m_WeightType; }
+
+  void setWeightType(WeightType pType) { m_WeightType = pType; }
+
+  /// Set the weight type by name: float, float16 or bfloat16.
+  /// @retval false If pName is not a weight type.
+  bool setWeightType(const std::string& pName);
+
+  /// This property holds the channels of a block of the blocked NCHWc
+  /// layout of a CPU backend, 8 or 16. It defaults to 8 rather than to the
+  /// vector width of the compiling host, so that compiled modules don't
+  /// depend on the host.
+  unsigned int getNCHWcBlock() const { return m_NCHWcBlock; }
+
+  void setNCHWcBlock(unsigned int pChannels) { m_NCHWcBlock = pChannels; }
+
+  /// Set the block by name: 8 or 16.
+  /// @retval false If pName is not a block.
+  bool setNCHWcBlock(const std::string& pName);
 
 private:
   bool m_PrintModuleBeforeSel;
   bool m_IgnoreCalibrationStep;
   bool m_AddDummyCTable;
   bool m_AddDummyWeight;
+  bool m_Calibrate;
+  MemAllocStrategy m_MemAllocStrategy;
+  WeightType m_WeightType;
+  unsigned int m_NCHWcBlock;
 
   std::string m_OptOnnxModel;
+  std::string m_CalibrationTable;
 };
 
 } // namespace onnc
@@ -16,6 +16,13 @@ class TargetBackend;
 /// This is helper function to add passes for building up standard ONNC IR.
 void addStandardTensorSel(PassManager& pPM, TargetBackend& pTB);
 
+/// Add standard passes for ordering operators so that less memory is live
+/// at the same time.
+///
+/// Input: ONNC IR
+/// Output: ONNC IR in the new order
+void addStandardTensorSched(PassManager& pPM, TargetBackend& pTB);
+
 /// Add standard passes for creating value's live interval.
 ///
 /// Input: Module
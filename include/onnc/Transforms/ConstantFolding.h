@@ -0,0 +1,74 @@
+//===- ConstantFolding.h --------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_TRANSFORMS_CONSTANT_FOLDING_H
+#define ONNC_TRANSFORMS_CONSTANT_FOLDING_H
+#include <onnc/Core/ModulePass.h>
+#include <vector>
+
+namespace onnc {
+
+class ComputeGraph;
+class ComputeOperator;
+
+/** \class ConstantFolding
+ *  \brief Evaluate operators whose inputs are all weights at compile time.
+ *
+ *  The outputs of a folded operator become new weights, and the operator,
+ *  along with the weights nobody reads anymore, is erased. Operators are
+ *  visited in execution order, so a whole weight-only subgraph folds in one
+ *  run. Shape and Size only read the dimensions of their input, so they
+ *  fold whatever their input is, once all its dimensions are known.
+ *
+ *  Operators are run by the interpreter with the runtime kernels of libonnc,
+ *  so folded values are exactly what the operator would compute at runtime.
+ *  Only deterministic operators with working kernels are folded, and never
+ *  the ones defining graph outputs, or growing the weights a lot (Tile).
+ *
+ *  The kernels compute in floats. Folded weights keep the element type of
+ *  the values they replace, so the int64 shapes computed by
+ *  Shape -> Gather -> Concat chains stay int64. Operators defining values
+ *  of other types than float and int64 are not folded.
+ */
+class ConstantFolding : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  ConstantFolding();
+
+  StringRef getPassName() const override { return "ConstantFolding"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  /// @return The number of folded operators.
+  unsigned int getNumOfFolded() const { return m_NumOfFolded; }
+
+private:
+  /// @retval true If pCG has been changed.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+  /// Compute the outputs of pOp into pOutputs, one buffer of floats per
+  /// output. Input i is in pInputs[i], which is nullptr for inputs whose
+  /// values aren't known.
+  /// @retval false If the interpreter can't run pOp.
+  bool evaluate(ComputeOperator& pOp, const std::vector<const float*>& pInputs,
+                const std::vector<float*>& pOutputs);
+
+private:
+  void* m_pContext; ///< of the runtime, while the pass runs
+  unsigned int m_NumOfFolded;
+};
+
+ModulePass* CreateConstantFoldingPass();
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,75 @@
+//===- FuseOperators.h ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_TRANSFORMS_FUSE_OPERATORS_H
+#define ONNC_TRANSFORMS_FUSE_OPERATORS_H
+#include <onnc/Core/ModulePass.h>
+
+namespace onnc {
+
+class ComputeGraph;
+
+/** \class FuseOperators
+ *  \brief Fuse operators of compute graphs, so that intermediate tensors
+ *         don't round-trip through memory.
+ *
+ *  In order, the pass
+ *
+ *  - folds a BatchNormalization into the weights and bias of the Conv that
+ *    feeds it,
+ *  - folds an Add of a constant bias into the C input of the Gemm that
+ *    feeds it,
+ *  - turns a Conv or a Gemm followed by element-wise activations into a
+ *    FusedConv or a FusedGemm, which runs the activations as an epilogue,
+ *  - merges chains of two or more element-wise activations into one
+ *    FusedElementwise.
+ *
+ *  Activations include the ONNX activations, Neg, and Add, Sub, Mul and Div
+ *  by a one-element weight, which become Affine. Only weights whose values
+ *  are loaded are folded, and an intermediate value is removed only if the
+ *  next operator is its sole user.
+ */
+class FuseOperators : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  FuseOperators();
+
+  StringRef getPassName() const override { return "FuseOperators"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  unsigned int getNumOfFoldedBN() const { return m_NumOfFoldedBN; }
+
+  unsigned int getNumOfFoldedBias() const { return m_NumOfFoldedBias; }
+
+  /// @return The number of activations moved into epilogues.
+  unsigned int getNumOfEpilogues() const { return m_NumOfEpilogues; }
+
+  /// @return The number of FusedElementwise operators.
+  unsigned int getNumOfChains() const { return m_NumOfChains; }
+
+private:
+  /// @retval true If pCG has been changed.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  unsigned int m_NumOfFoldedBN;
+  unsigned int m_NumOfFoldedBias;
+  unsigned int m_NumOfEpilogues;
+  unsigned int m_NumOfChains;
+};
+
+ModulePass* CreateFuseOperatorsPass();
+
+} // namespace of onnc
+
+#endif
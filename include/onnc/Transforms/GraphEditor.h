@@ -0,0 +1,107 @@
+//===- GraphEditor.h ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_TRANSFORMS_GRAPH_EDITOR_H
+#define ONNC_TRANSFORMS_GRAPH_EDITOR_H
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace onnc {
+
+/** \class GraphEditor
+ *  \brief Keep the operators of a compute graph in execution order while
+ *         operators are replaced and erased.
+ *
+ *  Weights created by the editor go in front of all operators. Call commit()
+ *  after the last edit to relink the graph in the kept order.
+ */
+class GraphEditor
+{
+public:
+  /// Values added by the editor are named "<base>.<pTag><n>".
+  GraphEditor(ComputeGraph& pCG, const std::string& pTag);
+
+  ComputeGraph& graph() { return m_CG; }
+
+  /// The operators in order. Erased ones are nullptr.
+  const std::vector<ComputeOperator*>& operators() const { return m_Operators; }
+
+  /// Add a weight named after pBaseName.
+  FloatTensor* addWeight(const std::string& pBaseName,
+                         const Tensor::Dimensions& pDims,
+                         const std::vector<float>& pValues);
+
+  Int8Tensor* addWeight(const std::string& pBaseName,
+                        const Tensor::Dimensions& pDims,
+                        const std::vector<int8_t>& pValues);
+
+  Int64Tensor* addWeight(const std::string& pBaseName,
+                         const Tensor::Dimensions& pDims,
+                         const std::vector<int64_t>& pValues);
+
+  /// Add a weight of 16-bit floats. pType is Value::kFloat16 or
+  /// Value::kBFloat16 and pValues hold the bits of the floats.
+  Tensor* addWeight(const std::string& pBaseName,
+                    const Tensor::Dimensions& pDims, Value::Type pType,
+                    const std::vector<uint16_t>& pValues);
+
+  /// Add a value named after pBaseName. Nothing defines it yet.
+  FloatTensor* addValue(const std::string& pBaseName,
+                        const Tensor::Dimensions& pDims);
+
+  Int8Tensor* addInt8Value(const std::string& pBaseName,
+                           const Tensor::Dimensions& pDims);
+
+  /// Put pNew, a new operator, right before pBefore. The operators from
+  /// pBefore on move one position back.
+  void insert(ComputeOperator& pNew, ComputeOperator& pBefore);
+
+  /// Let input pIdx of pOp be pValue. pIdx may be the number of inputs.
+  void replaceInput(ComputeOperator& pOp, unsigned int pIdx, Value& pValue);
+
+  /// Let pNew read pInputs, define the outputs of pOld, and take the place
+  /// of pOld, which is erased.
+  void replace(ComputeOperator& pOld, ComputeOperator& pNew,
+               const std::vector<Value*>& pInputs);
+
+  /// Detach pOp from its inputs and outputs and erase it. Weights nobody
+  /// reads anymore are erased, too.
+  void erase(ComputeOperator& pOp);
+
+  /// pFused absorbs its sole user pNext: pFused defines the output of pNext,
+  /// and both the old output of pFused and pNext are erased.
+  void absorb(ComputeOperator& pFused, ComputeOperator& pNext);
+
+  /// Relink the graph in the kept order.
+  void commit();
+
+private:
+  template<typename TensorType>
+  TensorType* createWeight(const std::string& pBaseName,
+                           const Tensor::Dimensions& pDims,
+                           const typename TensorType::ValueList& pValues);
+
+  template<typename TensorType>
+  TensorType* createValue(const std::string& pBaseName,
+                          const Tensor::Dimensions& pDims);
+
+  void eraseIfDeadWeight(Value& pValue);
+
+private:
+  ComputeGraph& m_CG;
+  std::string m_Tag;
+  std::vector<ComputeOperator*> m_Weights;
+  std::vector<ComputeOperator*> m_Operators;
+  std::unordered_map<ComputeOperator*, size_t> m_Positions;
+};
+
+} // namespace of onnc
+
+#endif
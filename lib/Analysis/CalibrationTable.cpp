@@ -0,0 +1,313 @@
+//===- CalibrationTable.cpp -----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Analysis/CalibrationTable.h>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+using namespace onnc;
+
+namespace {
+
+/// Tokens of the protobuf text format: identifiers, numbers and quoted
+/// strings, and the punctuation ':', '{' and '}'. Comments start with '#'.
+class Lexer
+{
+public:
+  enum Kind { kEnd, kWord, kString, kColon, kOpen, kClose, kError };
+
+public:
+  explicit Lexer(const std::string& pText) : m_Text(pText), m_Pos(0) { }
+
+  Kind next(std::string& pToken)
+  {
+    skipSpaces();
+    pToken.clear();
+    if (m_Pos >= m_Text.size())
+      return kEnd;
+
+    char c = m_Text[m_Pos++];
+    switch (c) {
+    case ':': return kColon;
+    case '{': return kOpen;
+    case '}': return kClose;
+    case '"':
+    case '\'':
+      while (m_Pos < m_Text.size() && m_Text[m_Pos] != c) {
+        if (m_Text[m_Pos] == '\\' && m_Pos + 1 < m_Text.size())
+          ++m_Pos;
+        pToken += m_Text[m_Pos++];
+      }
+      if (m_Pos >= m_Text.size())
+        return kError;
+      ++m_Pos;
+      return kString;
+    default:
+      break;
+    }
+
+    if (!isWordChar(c))
+      return kError;
+    pToken += c;
+    while (m_Pos < m_Text.size() && isWordChar(m_Text[m_Pos]))
+      pToken += m_Text[m_Pos++];
+    return kWord;
+  }
+
+private:
+  static bool isWordChar(char pC)
+  {
+    return std::isalnum(static_cast<unsigned char>(pC)) || pC == '_' ||
+           pC == '.' || pC == '-' || pC == '+';
+  }
+
+  void skipSpaces()
+  {
+    while (m_Pos < m_Text.size()) {
+      if (m_Text[m_Pos] == '#') {
+        while (m_Pos < m_Text.size() && m_Text[m_Pos] != '\n')
+          ++m_Pos;
+      }
+      else if (std::isspace(static_cast<unsigned char>(m_Text[m_Pos])))
+        ++m_Pos;
+      else
+        break;
+    }
+  }
+
+private:
+  const std::string& m_Text;
+  std::string::size_type m_Pos;
+};
+
+/// A field of a message: "name: value" or "name { ... }". The colon before
+/// a message is optional in the text format.
+struct Field
+{
+  std::string name;
+  Lexer::Kind kind; ///< kWord or kString for a value, kOpen for a message.
+  std::string value;
+};
+
+/// Read the next field. @retval false At the end of the enclosing message
+/// (pField.kind is kClose or kEnd) or on errors (kError).
+bool NextField(Lexer& pLexer, Field& pField)
+{
+  pField.kind = pLexer.next(pField.name);
+  if (Lexer::kWord != pField.kind)
+    return false;
+
+  std::string token;
+  Lexer::Kind kind = pLexer.next(token);
+  if (Lexer::kColon == kind)
+    kind = pLexer.next(token);
+  if (Lexer::kWord != kind && Lexer::kString != kind && Lexer::kOpen != kind) {
+    pField.kind = Lexer::kError;
+    return false;
+  }
+  pField.kind = kind;
+  pField.value = token;
+  return true;
+}
+
+/// Skip the rest of a message whose '{' has been read.
+bool SkipMessage(Lexer& pLexer)
+{
+  Field field;
+  while (NextField(pLexer, field)) {
+    if (Lexer::kOpen == field.kind && !SkipMessage(pLexer))
+      return false;
+  }
+  return Lexer::kClose == field.kind;
+}
+
+bool ParseFloat(const std::string& pText, float& pValue)
+{
+  char* end = nullptr;
+  pValue = std::strtof(pText.c_str(), &end);
+  return !pText.empty() && '\0' == *end;
+}
+
+/// Parse the rest of a blob_param message.
+bool ParseBlob(Lexer& pLexer, CalibrationTable::Blob& pBlob)
+{
+  bool hasThreshold = false;
+  Field field;
+  while (NextField(pLexer, field)) {
+    if (Lexer::kOpen == field.kind) {
+      if (!SkipMessage(pLexer))
+        return false;
+    }
+    else if ("name" == field.name)
+      pBlob.name = field.value;
+    else if ("threshold_y" == field.name && !hasThreshold) {
+      if (!ParseFloat(field.value, pBlob.threshold))
+        return false;
+      hasThreshold = true;
+    }
+  }
+  return Lexer::kClose == field.kind && hasThreshold && !pBlob.name.empty();
+}
+
+/// Parse the rest of a layer message. A layer without blob_params, as
+/// written by older tools, gives its first threshold_y to the value named
+/// after the layer.
+bool ParseLayer(Lexer& pLexer, CalibrationTable::Layer& pLayer)
+{
+  bool hasThreshold = false;
+  float threshold = 0.f;
+  Field field;
+  while (NextField(pLexer, field)) {
+    if (Lexer::kOpen == field.kind) {
+      if ("blob_param" == field.name) {
+        CalibrationTable::Blob blob;
+        if (!ParseBlob(pLexer, blob))
+          return false;
+        pLayer.blobs.push_back(blob);
+      }
+      else if (!SkipMessage(pLexer))
+        return false;
+    }
+    else if ("name" == field.name)
+      pLayer.name = field.value;
+    else if ("threshold_y" == field.name && !hasThreshold) {
+      if (!ParseFloat(field.value, threshold))
+        return false;
+      hasThreshold = true;
+    }
+  }
+  if (Lexer::kClose != field.kind || pLayer.name.empty())
+    return false;
+
+  if (pLayer.blobs.empty() && hasThreshold)
+    pLayer.blobs.push_back(CalibrationTable::Blob{ pLayer.name, threshold });
+  return true;
+}
+
+void PrintString(std::ostream& pOS, const std::string& pString)
+{
+  pOS << '"';
+  for (char c : pString) {
+    if ('"' == c || '\\' == c)
+      pOS << '\\';
+    pOS << c;
+  }
+  pOS << '"';
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// CalibrationTable
+//===----------------------------------------------------------------------===//
+void CalibrationTable::addLayer(const std::string& pName,
+                                const BlobList& pBlobs)
+{
+  m_Layers.push_back(Layer{ pName, pBlobs });
+  for (const Blob& blob : pBlobs)
+    m_Thresholds[blob.name] = blob.threshold;
+}
+
+bool CalibrationTable::hasThreshold(const std::string& pName) const
+{
+  return m_Thresholds.end() != m_Thresholds.find(pName);
+}
+
+float CalibrationTable::getThreshold(const std::string& pName) const
+{
+  auto it = m_Thresholds.find(pName);
+  return (m_Thresholds.end() == it) ? 0.f : it->second;
+}
+
+bool CalibrationTable::parse(const std::string& pText)
+{
+  clear();
+
+  Lexer lexer(pText);
+  Field field;
+  while (NextField(lexer, field)) {
+    if (Lexer::kOpen == field.kind) {
+      if ("layer" == field.name) {
+        Layer layer;
+        if (!ParseLayer(lexer, layer)) {
+          clear();
+          return false;
+        }
+        addLayer(layer.name, layer.blobs);
+      }
+      else if (!SkipMessage(lexer)) {
+        clear();
+        return false;
+      }
+    }
+    else if ("name" == field.name)
+      m_Name = field.value;
+  }
+
+  if (Lexer::kEnd != field.kind) {
+    clear();
+    return false;
+  }
+  return true;
+}
+
+bool CalibrationTable::read(const Path& pFile)
+{
+  std::ifstream ifs(pFile.native());
+  if (!ifs) {
+    clear();
+    return false;
+  }
+  std::stringstream text;
+  text << ifs.rdbuf();
+  return parse(text.str());
+}
+
+void CalibrationTable::print(std::ostream& pOS) const
+{
+  std::ios::fmtflags flags = pOS.flags();
+  std::streamsize precision = pOS.precision(9);
+
+  pOS << "name: ";
+  PrintString(pOS, m_Name);
+  pOS << '\n';
+  for (const Layer& layer : m_Layers) {
+    pOS << "layer {\n  name: ";
+    PrintString(pOS, layer.name);
+    pOS << '\n';
+    if (!layer.blobs.empty())
+      pOS << "  threshold_y: " << layer.blobs.front().threshold << '\n';
+    for (const Blob& blob : layer.blobs) {
+      pOS << "  blob_param {\n    name: ";
+      PrintString(pOS, blob.name);
+      pOS << "\n    threshold_y: " << blob.threshold << "\n  }\n";
+    }
+    pOS << "}\n";
+  }
+
+  pOS.precision(precision);
+  pOS.flags(flags);
+}
+
+bool CalibrationTable::write(const Path& pFile) const
+{
+  std::ofstream ofs(pFile.native());
+  if (!ofs)
+    return false;
+  print(ofs);
+  return static_cast<bool>(ofs);
+}
+
+void CalibrationTable::clear()
+{
+  m_Name.clear();
+  m_Layers.clear();
+  m_Thresholds.clear();
+}
@@ -0,0 +1,680 @@
+//===- CompiledModuleCache.cpp --------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/CodeGen/CompiledModuleCache.h>
+#include <onnc/Core/PassSupport.h>
+#include <onnc/IR/ComputeArchive.h>
+#include <onnc/IR/ComputeMemOperand.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/Module.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/FileSystem.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Support/MemoryMap.h>
+#include <onnc/Target/TargetOptions.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <dlfcn.h>
+#include <fstream>
+#include <map>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+using namespace onnc;
+
+namespace {
+
+/// Bump it when the format of entries changes. The meaning of entries is
+/// tied to the build by the key.
+const char kMagic[8] = { 'O', 'N', 'N', 'C', 'M', 'O', 'D', '1' };
+
+/// Values stored in an entry are aligned for the widest vector loads of the
+/// runtime.
+const uint64_t kAlignment = 64;
+
+struct Header
+{
+  char magic[8];
+  uint64_t size; ///< of the archive, which the stored values follow
+};
+
+/// Where the values of a tensor are
+enum DataLocation {
+  kNoData,
+  kFileData, ///< in the model or one of its external data files
+  kEntryData ///< in the entry, after the archive
+};
+
+uint64_t AlignUp(uint64_t pOffset)
+{
+  return (pOffset + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+/// 64-bit FNV-1a, for the short fields of the key.
+class Hash
+{
+public:
+  Hash() : m_Value(14695981039346656037ULL) { }
+
+  Hash& add(const void* pData, size_t pSize) {
+    const unsigned char* data = static_cast<const unsigned char*>(pData);
+    for (size_t i = 0; i < pSize; ++i) {
+      m_Value ^= data[i];
+      m_Value *= 1099511628211ULL;
+    }
+    return *this;
+  }
+
+  Hash& add(const std::string& pString) {
+    // the size separates consecutive strings
+    uint64_t size = pString.size();
+    return add(&size, sizeof(size)).add(pString.data(), pString.size());
+  }
+
+  Hash& add(bool pFlag) { return add(&pFlag, sizeof(pFlag)); }
+
+  uint64_t value() const { return m_Value; }
+
+private:
+  uint64_t m_Value;
+};
+
+const uint64_t kPrime1 = 11400714785074694791ULL;
+const uint64_t kPrime2 = 14029467366897019727ULL;
+const uint64_t kPrime3 = 1609587929392839161ULL;
+const uint64_t kPrime4 = 9650029242287828579ULL;
+const uint64_t kPrime5 = 2870177450012600261ULL;
+
+inline uint64_t Rotate(uint64_t pValue, int pBits)
+{
+  return (pValue << pBits) | (pValue >> (64 - pBits));
+}
+
+inline uint64_t Load64(const char* pData)
+{
+  uint64_t value;
+  memcpy(&value, pData, sizeof(value));
+  return value;
+}
+
+inline uint64_t Round(uint64_t pAcc, uint64_t pInput)
+{
+  return Rotate(pAcc + pInput * kPrime2, 31) * kPrime1;
+}
+
+inline uint64_t Merge(uint64_t pAcc, uint64_t pLane)
+{
+  return (pAcc ^ Round(0, pLane)) * kPrime1 + kPrime4;
+}
+
+/// XXH64 of [pData, pData + pSize), for the model and the calibration
+/// table. Four independent lanes take 32 bytes per round, so hashing runs
+/// at memory speed rather than at one multiply per byte.
+uint64_t Digest(const char* pData, size_t pSize)
+{
+  const char* p = pData;
+  const char* end = pData + pSize;
+  uint64_t hash;
+  if (pSize >= 32) {
+    uint64_t v1 = kPrime1 + kPrime2;
+    uint64_t v2 = kPrime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - kPrime1;
+    for (; p + 32 <= end; p += 32) {
+      v1 = Round(v1, Load64(p));
+      v2 = Round(v2, Load64(p + 8));
+      v3 = Round(v3, Load64(p + 16));
+      v4 = Round(v4, Load64(p + 24));
+    }
+    hash = Rotate(v1, 1) + Rotate(v2, 7) + Rotate(v3, 12) + Rotate(v4, 18);
+    hash = Merge(hash, v1);
+    hash = Merge(hash, v2);
+    hash = Merge(hash, v3);
+    hash = Merge(hash, v4);
+  } else
+    hash = kPrime5;
+
+  hash += pSize;
+  for (; p + 8 <= end; p += 8)
+    hash = Rotate(hash ^ Round(0, Load64(p)), 27) * kPrime1 + kPrime4;
+  if (p + 4 <= end) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    hash = Rotate(hash ^ (value * kPrime1), 23) * kPrime2 + kPrime3;
+    p += 4;
+  }
+  for (; p < end; ++p)
+    hash = Rotate(hash ^ (static_cast<unsigned char>(*p) * kPrime5), 11) *
+           kPrime1;
+
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+/// The identity of a file which an entry refers to
+struct Stamp
+{
+  uint64_t size;
+  int64_t time;
+};
+
+bool GetStamp(const char* pFile, Stamp& pStamp)
+{
+  struct stat status;
+  if (0 != ::stat(pFile, &status))
+    return false;
+  pStamp.size = status.st_size;
+  pStamp.time = status.st_mtime;
+  return true;
+}
+
+/// Add the build of libonnc to @ref pHash, so that entries written by
+/// another build are never used. libonnc may be linked statically or be a
+/// shared library, so the stamp is of the file which holds this function.
+void AddBuild(Hash& pHash)
+{
+  pHash.add(std::string(__VERSION__));
+  // The name of the main program may be a bare name which doesn't resolve
+  // from the current directory.
+  Dl_info info;
+  Stamp stamp;
+  if (0 == ::dladdr(reinterpret_cast<void*>(&AddBuild), &info) ||
+      nullptr == info.dli_fname ||
+      nullptr == std::strchr(info.dli_fname, '/') ||
+      !GetStamp(info.dli_fname, stamp)) {
+    if (!GetStamp("/proc/self/exe", stamp))
+      return;
+  }
+  pHash.add(&stamp.size, sizeof(stamp.size))
+       .add(&stamp.time, sizeof(stamp.time));
+}
+
+/// @return The directory external data of @ref pModel is relative to.
+std::string GetModelDirectory(const Path& pModel)
+{
+  Path parent = pModel.parent();
+  return parent.empty() ? std::string(".") : parent.native();
+}
+
+Tensor* CreateTensor(ComputeGraph& pGraph, uint32_t pKind,
+                     const std::string& pName)
+{
+  switch (pKind) {
+  case Value::kFloat:    return pGraph.addValue<FloatTensor>(pName);
+  case Value::kFloat16:  return pGraph.addValue<Float16Tensor>(pName);
+  case Value::kBFloat16: return pGraph.addValue<BFloat16Tensor>(pName);
+  case Value::kBoolean:  return pGraph.addValue<BooleanTensor>(pName);
+  case Value::kInt8:     return pGraph.addValue<Int8Tensor>(pName);
+  case Value::kInt16:    return pGraph.addValue<Int16Tensor>(pName);
+  case Value::kInt32:    return pGraph.addValue<Int32Tensor>(pName);
+  case Value::kInt64:    return pGraph.addValue<Int64Tensor>(pName);
+  case Value::kUint8:    return pGraph.addValue<Uint8Tensor>(pName);
+  case Value::kUint16:   return pGraph.addValue<Uint16Tensor>(pName);
+  case Value::kUint32:   return pGraph.addValue<Uint32Tensor>(pName);
+  case Value::kUint64:   return pGraph.addValue<Uint64Tensor>(pName);
+  case Value::kDouble:   return pGraph.addValue<DoubleTensor>(pName);
+  case Value::kString:   return pGraph.addValue<StringTensor>(pName);
+  default:               return nullptr;
+  }
+}
+
+template<typename TensorType>
+StringRef GetBytes(const Tensor& pTensor)
+{
+  const TensorType& tensor = static_cast<const TensorType&>(pTensor);
+  return StringRef(reinterpret_cast<const char*>(tensor.data()),
+                   tensor.getNumOfValues() * sizeof(*tensor.data()));
+}
+
+/// @param[out] pBytes The values of @ref pTensor. Boolean values are copied
+///             into @ref pStorage as bytes.
+/// @retval false If the values can't be stored.
+bool GetBytes(const Tensor& pTensor, std::string& pStorage, StringRef& pBytes)
+{
+  switch (pTensor.kind()) {
+  case Value::kFloat:    pBytes = GetBytes<FloatTensor>(pTensor); break;
+  case Value::kFloat16:  pBytes = GetBytes<Float16Tensor>(pTensor); break;
+  case Value::kBFloat16: pBytes = GetBytes<BFloat16Tensor>(pTensor); break;
+  case Value::kInt8:     pBytes = GetBytes<Int8Tensor>(pTensor); break;
+  case Value::kInt16:    pBytes = GetBytes<Int16Tensor>(pTensor); break;
+  case Value::kInt32:    pBytes = GetBytes<Int32Tensor>(pTensor); break;
+  case Value::kInt64:    pBytes = GetBytes<Int64Tensor>(pTensor); break;
+  case Value::kUint8:    pBytes = GetBytes<Uint8Tensor>(pTensor); break;
+  case Value::kUint16:   pBytes = GetBytes<Uint16Tensor>(pTensor); break;
+  case Value::kUint32:   pBytes = GetBytes<Uint32Tensor>(pTensor); break;
+  case Value::kUint64:   pBytes = GetBytes<Uint64Tensor>(pTensor); break;
+  case Value::kDouble:   pBytes = GetBytes<DoubleTensor>(pTensor); break;
+  case Value::kBoolean: {
+    const BooleanTensor& tensor = static_cast<const BooleanTensor&>(pTensor);
+    pStorage.assign(tensor.getValues().begin(), tensor.getValues().end());
+    pBytes = StringRef(pStorage.data(), pStorage.size());
+    break;
+  }
+  case Value::kString:
+    pBytes = StringRef();
+    return static_cast<const StringTensor&>(pTensor).getValues().empty();
+  default:
+    return false;
+  }
+  return true;
+}
+
+template<typename TensorType>
+bool SetBytes(Tensor& pTensor, StringRef pBytes)
+{
+  typedef typename TensorType::ValueList::value_type ValueType;
+  if (0 != pBytes.size() % sizeof(ValueType))
+    return false;
+  static_cast<TensorType&>(pTensor).setExternalValues(
+      reinterpret_cast<const ValueType*>(pBytes.data()),
+      pBytes.size() / sizeof(ValueType));
+  return true;
+}
+
+/// Let @ref pTensor refer to @ref pBytes, which outlive it.
+/// @retval false If @ref pBytes are not values of the tensor.
+bool SetBytes(Tensor& pTensor, StringRef pBytes)
+{
+  switch (pTensor.kind()) {
+  case Value::kFloat:    return SetBytes<FloatTensor>(pTensor, pBytes);
+  case Value::kFloat16:  return SetBytes<Float16Tensor>(pTensor, pBytes);
+  case Value::kBFloat16: return SetBytes<BFloat16Tensor>(pTensor, pBytes);
+  case Value::kInt8:     return SetBytes<Int8Tensor>(pTensor, pBytes);
+  case Value::kInt16:    return SetBytes<Int16Tensor>(pTensor, pBytes);
+  case Value::kInt32:    return SetBytes<Int32Tensor>(pTensor, pBytes);
+  case Value::kInt64:    return SetBytes<Int64Tensor>(pTensor, pBytes);
+  case Value::kUint8:    return SetBytes<Uint8Tensor>(pTensor, pBytes);
+  case Value::kUint16:   return SetBytes<Uint16Tensor>(pTensor, pBytes);
+  case Value::kUint32:   return SetBytes<Uint32Tensor>(pTensor, pBytes);
+  case Value::kUint64:   return SetBytes<Uint64Tensor>(pTensor, pBytes);
+  case Value::kDouble:   return SetBytes<DoubleTensor>(pTensor, pBytes);
+  case Value::kBoolean: {
+    BooleanTensor& tensor = static_cast<BooleanTensor&>(pTensor);
+    tensor.getValues().assign(pBytes.begin(), pBytes.end());
+    return true;
+  }
+  default:
+    return false;
+  }
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// CompiledModuleCache
+//===----------------------------------------------------------------------===//
+CompiledModuleCache::CompiledModuleCache(const Path& pDirectory)
+  : m_Directory(pDirectory) {
+}
+
+std::string CompiledModuleCache::key(const Path& pModel,
+                                     const std::string& pTarget,
+                                     const TargetOptions& pOptions,
+                                     const std::string& pExtra)
+{
+  std::unique_ptr<MemoryMap> model = MemoryMap::mapFile(pModel.native());
+  if (!model)
+    return std::string();
+
+  // The int8 values of a quantized module depend on the table, so its
+  // content takes part in the key.
+  std::unique_ptr<MemoryMap> table;
+  if (!pOptions.getCalibrationTable().empty()) {
+    table = MemoryMap::mapFile(pOptions.getCalibrationTable());
+    if (!table)
+      return std::string();
+  }
+
+  uint64_t modelDigest = Digest(model->start(), model->size());
+  uint64_t tableDigest = table ? Digest(table->start(), table->size()) : 0;
+  uint32_t strategy = pOptions.getMemAllocStrategy();
+  uint32_t weightType = pOptions.getWeightType();
+  uint32_t block = pOptions.getNCHWcBlock();
+  Hash hash;
+  AddBuild(hash);
+  hash.add(&modelDigest, sizeof(modelDigest))
+      .add(pTarget)
+      .add(pOptions.shouldIgnoreCalibrationStep())
+      .add(pOptions.shouldUseDummyCTable())
+      .add(pOptions.shouldUseDummyWeight())
+      .add(pOptions.shouldCalibrate())
+      .add(&strategy, sizeof(strategy))
+      .add(&weightType, sizeof(weightType))
+      .add(&block, sizeof(block))
+      .add(pOptions.getCalibrationTable())
+      .add(&tableDigest, sizeof(tableDigest))
+      .add(pExtra);
+
+  char name[17];
+  snprintf(name, sizeof(name), "%016llx",
+           static_cast<unsigned long long>(hash.value()));
+  return name;
+}
+
+Path CompiledModuleCache::getPath(const std::string& pKey) const
+{
+  Path path(m_Directory);
+  path.append(pKey + ".module");
+  return path;
+}
+
+bool CompiledModuleCache::load(const std::string& pKey, const Path& pModel,
+                               Module& pModule) const
+{
+  if (pKey.empty() || !exists(getPath(pKey)))
+    return false;
+
+  // The entry is mapped as long as the module lives, since the values stored
+  // in it are not copied.
+  const MemoryMap* entry = pModule.mapFile(getPath(pKey));
+  Header header;
+  if (nullptr == entry || entry->size() < sizeof(header))
+    return false;
+  memcpy(&header, entry->start(), sizeof(header));
+  if (0 != memcmp(header.magic, kMagic, sizeof(kMagic)) ||
+      header.size > entry->size() - sizeof(header))
+    return false;
+  const char* archive = entry->start() + sizeof(header);
+  ComputeArchive in(archive, archive + header.size);
+  uint64_t blobs = std::min<uint64_t>(AlignUp(sizeof(header) + header.size),
+                                      entry->size());
+
+  std::string name;
+  in.read(name);
+
+  // The key identifies the model. Other files must not have changed since
+  // the entry was stored.
+  std::vector<const MemoryMap*> files(1, pModule.mapFile(pModel));
+  uint64_t numOfFiles = 0;
+  in.read(numOfFiles);
+  for (uint64_t i = 0; i < numOfFiles && in.good(); ++i) {
+    std::string file;
+    Stamp stored, stamp;
+    in.read(file);
+    in.read(stored.size);
+    in.read(stored.time);
+    if (!file.empty() && '/' != file[0])
+      file = GetModelDirectory(pModel) + "/" + file;
+    if (!in.good() || !GetStamp(file.c_str(), stamp) ||
+        stamp.size != stored.size || stamp.time != stored.time)
+      return false;
+    files.push_back(pModule.mapFile(Path(file)));
+  }
+  for (const MemoryMap* file : files)
+    if (nullptr == file)
+      return false;
+
+  ComputeGraph* graph = pModule.createComputeGraph(name);
+  if (!in.good() || nullptr == graph)
+    return false;
+
+  std::vector<Tensor*> values;
+  uint64_t numOfValues = 0;
+  in.read(numOfValues);
+  for (uint64_t i = 0; i < numOfValues && in.good(); ++i) {
+    uint32_t kind = 0, location = kNoData;
+    std::string valueName;
+    Tensor::Dimensions dims;
+    in.read(kind);
+    in.read(valueName);
+    in.read(dims);
+    in.read(location);
+    Tensor* tensor = CreateTensor(*graph, kind, valueName);
+    if (!in.good() || nullptr == tensor)
+      return false;
+    tensor->setDimensions(dims);
+    values.push_back(tensor);
+
+    StringRef bytes;
+    if (kFileData == location) {
+      uint32_t index = 0;
+      uint64_t offset = 0, length = 0;
+      in.read(index);
+      in.read(offset);
+      in.read(length);
+      if (index >= files.size() || offset > files[index]->size() ||
+          length > files[index]->size() - offset)
+        return false;
+      bytes = StringRef(files[index]->start() + offset, length);
+    } else if (kEntryData == location) {
+      uint64_t offset = 0, length = 0;
+      in.read(offset);
+      in.read(length);
+      if (offset > entry->size() - blobs ||
+          length > entry->size() - blobs - offset)
+        return false;
+      bytes = StringRef(entry->start() + blobs + offset, length);
+    } else if (kNoData != location)
+      return false;
+    if (kNoData != location && !SetBytes(*tensor, bytes))
+      return false;
+  }
+
+  std::vector<ComputeOperator*> ops;
+  uint64_t numOfOps = 0;
+  in.read(numOfOps);
+  for (uint64_t i = 0; i < numOfOps && in.good(); ++i) {
+    ComputeOperator* op = in.readOperator(*graph);
+    std::vector<uint32_t> inputs, outputs;
+    in.read(inputs);
+    in.read(outputs);
+    if (!in.good() || nullptr == op)
+      return false;
+    for (uint32_t input : inputs) {
+      if (input >= values.size())
+        return false;
+      // OutputOperator doesn't use its inputs.
+      if (OutputOperator* out = dyn_cast<OutputOperator>(op))
+        out->addTensor(*values[input]);
+      else
+        op->addInput(*values[input]);
+    }
+    for (uint32_t output : outputs) {
+      if (output >= values.size())
+        return false;
+      op->addOutput(*values[output]);
+    }
+    ops.push_back(op);
+  }
+
+  uint64_t numOfOperands = 0;
+  in.read(numOfOperands);
+  for (uint64_t i = 0; i < numOfOperands && in.good(); ++i) {
+    uint32_t source = 0, target = 0, value = 0, residence = 0;
+    uint32_t start = 0, length = 0;
+    in.read(source);
+    in.read(target);
+    in.read(value);
+    in.read(residence);
+    in.read(start);
+    in.read(length);
+    if (!in.good() || source >= ops.size() || target >= ops.size() ||
+        value >= values.size() ||
+        residence > ComputeOperand::kUnknownResidence)
+      return false;
+    ComputeMemOperand* mem = graph->addOperand<ComputeMemOperand>(
+        *ops[source], *ops[target], *values[value],
+        static_cast<ComputeOperand::Residence>(residence));
+    mem->setStart(start);
+    mem->setLength(length);
+  }
+  return in.good();
+}
+
+bool CompiledModuleCache::store(const std::string& pKey, const Path& pModel,
+                                Module& pModule) const
+{
+  ComputeGraph* graph = pModule.getRootComputeGraph();
+  if (pKey.empty() || nullptr == graph ||
+      1 != pModule.getNumOfComputeGraphs())
+    return false;
+
+  // Number the operators, and the values in the order operators use them.
+  std::unordered_map<const ComputeOperator*, uint32_t> ops;
+  std::unordered_map<const Value*, uint32_t> valueIds;
+  std::vector<Tensor*> values;
+  for (ComputeOperator& op : *graph) {
+    uint32_t id = ops.size();
+    ops[&op] = id;
+    for (unsigned int i = 0; i < op.getNumOfInputs(); ++i) {
+      Value* value = op.getInput(i);
+      if (valueIds.emplace(value, values.size()).second)
+        values.push_back(static_cast<Tensor*>(value));
+    }
+    for (unsigned int i = 0; i < op.getNumOfOutputs(); ++i) {
+      Value* value = op.getOutput(i);
+      if (valueIds.emplace(value, values.size()).second)
+        values.push_back(static_cast<Tensor*>(value));
+    }
+  }
+
+  // File 0 is the model. Values which are still in the model or in its
+  // external data files are referred to, and the others are stored.
+  std::string body, data;
+  ComputeArchive out(body);
+  std::map<std::string, uint32_t> fileIds;
+  fileIds[pModel.native()] = 0;
+  out.write(static_cast<uint64_t>(values.size()));
+  for (Tensor* value : values) {
+    out.write(static_cast<uint32_t>(value->kind()));
+    out.write(value->getName());
+    out.write(value->getDimensions());
+
+    std::string storage;
+    StringRef bytes;
+    Path file;
+    uint64_t offset = 0;
+    if (!GetBytes(*value, storage, bytes))
+      return false;
+    if (bytes.empty())
+      out.write(static_cast<uint32_t>(kNoData));
+    else if (storage.empty() &&
+             nullptr != pModule.findMappedFile(bytes, file, offset)) {
+      uint32_t id = fileIds.size();
+      id = fileIds.emplace(file.native(), id).first->second;
+      out.write(static_cast<uint32_t>(kFileData));
+      out.write(id);
+      out.write(offset);
+      out.write(static_cast<uint64_t>(bytes.size()));
+    } else {
+      data.resize(AlignUp(data.size()), '\0');
+      out.write(static_cast<uint32_t>(kEntryData));
+      out.write(static_cast<uint64_t>(data.size()));
+      out.write(static_cast<uint64_t>(bytes.size()));
+      data.append(bytes.data(), bytes.size());
+    }
+  }
+
+  out.write(static_cast<uint64_t>(ops.size()));
+  for (ComputeOperator& op : *graph) {
+    if (!out.writeOperator(op))
+      return false;
+    std::vector<uint32_t> inputs, outputs;
+    for (unsigned int i = 0; i < op.getNumOfInputs(); ++i)
+      inputs.push_back(valueIds[op.getInput(i)]);
+    for (unsigned int i = 0; i < op.getNumOfOutputs(); ++i)
+      outputs.push_back(valueIds[op.getOutput(i)]);
+    out.write(inputs);
+    out.write(outputs);
+  }
+
+  out.write(static_cast<uint64_t>(pModule.getComputeOperands().size()));
+  for (ComputeOperand* opnd : pModule.getComputeOperands()) {
+    ComputeMemOperand* mem = dyn_cast<ComputeMemOperand>(opnd);
+    if (nullptr == mem || !mem->hasValue() ||
+        !ops.count(mem->getSource()) || !ops.count(mem->getTarget()) ||
+        !valueIds.count(mem->getValue()))
+      return false;
+    out.write(ops[mem->getSource()]);
+    out.write(ops[mem->getTarget()]);
+    out.write(valueIds[mem->getValue()]);
+    out.write(static_cast<uint32_t>(mem->residence()));
+    out.write(mem->start());
+    out.write(mem->length());
+  }
+
+  // The name of the graph and the other files go first, so that they are
+  // known when values are read.
+  std::string archive;
+  ComputeArchive head(archive);
+  head.write(graph->name());
+  head.write(static_cast<uint64_t>(fileIds.size() - 1));
+  std::vector<std::string> files(fileIds.size());
+  for (const auto& file : fileIds)
+    files[file.second] = file.first;
+  const std::string directory = GetModelDirectory(pModel) + "/";
+  for (size_t i = 1; i < files.size(); ++i) {
+    Stamp stamp;
+    if (!GetStamp(files[i].c_str(), stamp))
+      return false;
+    // External data is located relative to the model.
+    if (0 == files[i].compare(0, directory.size(), directory))
+      head.write(files[i].substr(directory.size()));
+    else
+      head.write(files[i]);
+    head.write(stamp.size);
+    head.write(stamp.time);
+  }
+  archive += body;
+
+  if (!exists(m_Directory) && !mkdir(m_Directory, 0755).isGood())
+    return false;
+
+  // Write a private file and rename it, so that concurrent compilations
+  // never read a partial entry.
+  Path path = getPath(pKey);
+  std::string temp = path.native() + "." + std::to_string(::getpid());
+  {
+    std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+    Header header;
+    memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.size = archive.size();
+    std::string padding(AlignUp(sizeof(header) + archive.size()) -
+                        sizeof(header) - archive.size(), '\0');
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(archive.data(), archive.size());
+    file.write(padding.data(), padding.size());
+    file.write(data.data(), data.size());
+    if (!file.flush()) {
+      std::remove(temp.c_str());
+      return false;
+    }
+  }
+  return 0 == std::rename(temp.c_str(), path.c_str());
+}
+
+//===----------------------------------------------------------------------===//
+// StoreCompiledModule
+//===----------------------------------------------------------------------===//
+Pass::ReturnType StoreCompiledModule::runOnModule(Module& pModule)
+{
+  if (!m_Cache.store(m_Key, m_Model, pModule)) {
+    errs() << "can not store the compiled module `" << m_Key << "` in "
+           << m_Cache.directory() << std::endl;
+  }
+  return Pass::kModuleNoChanged;
+}
+
+//===----------------------------------------------------------------------===//
+// Factory methods
+//===----------------------------------------------------------------------===//
+char StoreCompiledModule::ID = 0;
+
+ModulePass* onnc::CreateStoreCompiledModulePass(
+    const CompiledModuleCache& pCache, const std::string& pKey,
+    const Path& pModel)
+{
+  return new StoreCompiledModule(pCache, pKey, pModel);
+}
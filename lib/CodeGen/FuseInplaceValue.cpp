@@ -6,16 +6,54 @@
 //
 //===----------------------------------------------------------------------===//
 #include <onnc/CodeGen/FuseInplaceValue.h>
+#include <onnc/CodeGen/MemAllocData.h>
 #include <onnc/Core/PassAnalysisSupport.h>
 #include <onnc/Core/PassSupport.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/Support/Casting.h>
 
 using namespace onnc;
 
+/// @return The number of elements of pTensor.
+static int64_t GetNumOfElements(const Tensor& pTensor)
+{
+  int64_t size = 1;
+  for (int64_t dim : pTensor.getDimensions())
+    size *= dim;
+  return size;
+}
+
+/// @retval true If pNode is the only reader of pValue. An operator fused in
+///         place earlier both reads and defines pValue, and it runs before
+///         pNode, so it doesn't count. An input used twice by pNode is kept.
+static bool IsLastUse(const Value& pValue, const ComputeOperator& pNode)
+{
+  unsigned int numOfUses = 0;
+  for (const Use& use : pValue.getUses()) {
+    const ComputeOperator* user = use.getUser();
+    if (user == &pNode) {
+      ++numOfUses;
+      continue;
+    }
+    bool inplace = false;
+    for (unsigned int i = 0; i < user->getNumOfOutputs(); ++i)
+      inplace |= (user->getOutput(i) == &pValue);
+    if (!inplace)
+      return false;
+  }
+  return 1 == numOfUses;
+}
+
 //===----------------------------------------------------------------------===//
 // FuseInplaceValue
 //===----------------------------------------------------------------------===//
 Pass::ReturnType FuseInplaceValue::runOnModule(Module& pModule)
 {
+  m_MemAllocData = getAnalysis<MemAllocData>();
+  m_NumOfFused = m_NumOfViews = 0;
+
   Pass::ReturnType ret = Pass::kModuleNoChanged;
   Module::cg_iterator cg, cgEnd = pModule.cgEnd();
   for (cg = pModule.cgBegin(); cg != cgEnd; ++cg)
@@ -27,38 +65,89 @@ Pass::ReturnType FuseInplaceValue::runOnModule(Module& pModule)
 Pass::ReturnType FuseInplaceValue::runOnComputeGraph(ComputeGraph& pCG)
 {
   Pass::ReturnType ret = Pass::kModuleNoChanged;
+  InplacePairs pairs;
   ComputeGraph::iterator nodeIt, nEnd = pCG.end();
   for (nodeIt = pCG.begin(); nodeIt != nEnd; ++nodeIt) {
     ComputeOperator* node = nodeIt;
-    if (!m_IsFusibleFn(*node))
-      continue;
+    pairs.clear();
+    getInplacePairs(*node, pairs);
 
-    // TODO: Get fusible input/output pair (backend should provide this)
-    //       Currently assume operator's 1st input and 1st output is a fusible
-    //       pair.
-    const unsigned outputId = 0;
-    Value *input = node->getInput(0),
-          *output = node->getOutput(outputId);
+    // Each input and each output is fused at most once.
+    std::vector<bool> inputTaken(node->getNumOfInputs(), false),
+                      outputTaken(node->getNumOfOutputs(), false);
+    for (const InplacePair& pair : pairs) {
+      if (pair.input >= inputTaken.size() || inputTaken[pair.input] ||
+          pair.output >= outputTaken.size() || outputTaken[pair.output])
+        continue;
 
-    // If input has more than one user, we can't fuse this pair, since we need
-    // keep input value for other users.
-    if (input->getUses().size() > 1)
-      continue;
+      // FIXME: Values of compute graphs are tensors. Check before casting.
+      Tensor* input = static_cast<Tensor*>(node->getInput(pair.input));
+      Tensor* output = static_cast<Tensor*>(node->getOutput(pair.output));
+
+      // If input has other users, we can't fuse this pair, since we need
+      // keep input value for them.
+      if (!IsLastUse(*input, *node))
+        continue;
+
+      // Never write into weights or into the buffers of graph inputs.
+      Define* origDef = input->getDefine();
+      ComputeOperator* defOp = static_cast<ComputeOperator*>(origDef);
+      if (nullptr == defOp || isa<Initializer>(defOp) ||
+          isa<InputOperator>(defOp))
+        continue;
+
+      // A broadcast input is smaller than the output.
+      if (input->kind() != output->kind() ||
+          GetNumOfElements(*input) != GetNumOfElements(*output))
+        continue;
 
-    Define* origDef = input->getDefine();
-    unsigned origDefNo = input->getDefineNo();
-    input->clearDefine();
-    node->replaceOutput(outputId, *input);
-    input->clearDefine();
-    input->setDefine(origDef, origDefNo);
+      if (input->getDimensions() == output->getDimensions()) {
+        unsigned origDefNo = input->getDefineNo();
+        input->clearDefine();
+        node->replaceOutput(pair.output, *input);
+        input->clearDefine();
+        input->setDefine(origDef, origDefNo);
 
-    pCG.erase(*output);
+        pCG.erase(*output);
+      }
+      else if (pair.isView) {
+        // The output keeps its own dimensions, so only its memory goes.
+        m_MemAllocData->addAlias(output, input);
+      }
+      else
+        continue;
 
-    ret |= Pass::kModuleChanged;
+      inputTaken[pair.input] = outputTaken[pair.output] = true;
+      ++m_NumOfFused;
+      if (pair.isView)
+        ++m_NumOfViews;
+      ret |= Pass::kModuleChanged;
+    }
   }
   return ret;
 }
 
+void FuseInplaceValue::getInplacePairs(const ComputeOperator& pOp,
+                                       InplacePairs& pPairs) const
+{
+  if (nullptr != m_GetInplacePairsFn)
+    m_GetInplacePairsFn(pOp, pPairs);
+  else if (nullptr != m_IsFusibleFn && m_IsFusibleFn(pOp))
+    pPairs.push_back(InplacePair{0, 0, false});
+}
+
+void FuseInplaceValue::getAnalysisUsage(AnalysisUsage& pUsage) const
+{
+  pUsage.addRequiredID(MemAllocData::ID);
+}
+
+void FuseInplaceValue::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== FuseInplaceValue ===\n";
+  pOS << "fused outputs: " << m_NumOfFused
+      << ", views: " << m_NumOfViews << "\n";
+}
+
 //===----------------------------------------------------------------------===//
 // FuseInplaceValue Factory method
 //===----------------------------------------------------------------------===//
@@ -73,4 +162,10 @@ ModulePass*
 onnc::CreateFuseInplaceValuePass(FuseInplaceValue::IsFusible pCheckFusibleFn)
 {
   return new FuseInplaceValue(pCheckFusibleFn);
-}
\ No newline at end of file
+}
+
+ModulePass*
+onnc::CreateFuseInplaceValuePass(FuseInplaceValue::GetInplacePairs pGetPairsFn)
+{
+  return new FuseInplaceValue(pGetPairsFn);
+}
@@ -7,11 +7,15 @@
 //===----------------------------------------------------------------------===//
 #include <onnc/CodeGen/LinearScanMemAlloc.h>
 #include <onnc/CodeGen/LiveIntervalsData.h>
-#include <onnc/CodeGen/LiveValueMatrix.h>
+#include <onnc/CodeGen/LiveIntervalTree.h>
 #include <onnc/Core/PassAnalysisSupport.h>
 #include <onnc/Core/PassSupport.h>
 #include <onnc/Target/TargetBackend.h>
 #include <onnc/Target/TargetMemInfo.h>
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <unordered_map>
 
 using namespace onnc;
 
@@ -36,93 +40,266 @@ static uint64_t GetAlignedAddr(uint64_t pAddr, uint64_t pAlignment)
   return pAddr;
 }
 
+static unsigned int GetLifetime(const LiveInterval& pLI)
+{
+  return pLI.endIndex().getIndex() - pLI.beginIndex().getIndex() + 1;
+}
+
+/// @return An interval of the value of pLIs.front() which covers all pLIs.
+static LiveInterval* MergeIntervals(const LiveIntervalTree::LIs& pLIs)
+{
+  LiveRange::Segments segs;
+  for (const LiveInterval* li : pLIs)
+    segs.insert(segs.end(), li->getSegments().begin(),
+                li->getSegments().end());
+  std::sort(segs.begin(), segs.end(),
+            [] (const LiveRange::Segment& pA, const LiveRange::Segment& pB) {
+              return pA.m_Start.getIndex() < pB.m_Start.getIndex();
+            });
+
+  LiveInterval* result =
+    new LiveInterval(const_cast<Value*>(pLIs.front()->getValue()));
+  LiveRange::Segment cur = segs.front();
+  for (const LiveRange::Segment& seg : segs) {
+    // Join overlapping and adjacent segments.
+    if (seg.m_Start.getIndex() <= cur.m_End.getIndex() + 1) {
+      if (seg.m_End.getIndex() > cur.m_End.getIndex())
+        cur.m_End = seg.m_End;
+      continue;
+    }
+    result->addSegment(cur);
+    cur = seg;
+  }
+  result->addSegment(cur);
+  return result;
+}
+
+/// Find a region of pSize bytes that doesn't conflict with pAllocs, which
+/// are sorted by start address.
+/// @param pBestFit Take the smallest free block that fits instead of the
+///        lowest one.
+static MemAllocData::AllocEntry
+GetAnEmptyRegion(const std::vector<MemAllocData::AllocEntry>& pAllocs,
+                 uint64_t pSize, uint64_t pAlignment, bool pBestFit)
+{
+  uint64_t startAddr = 0, bestAddr = 0, bestHole = 0;
+  bool found = false;
+  for (const MemAllocData::AllocEntry& alloc : pAllocs) {
+    if (!HasConflict(alloc.startAddr, alloc.size, startAddr, pSize)) {
+      // Ok we find an empty region. pAllocs is sorted by start address, so
+      // the region doesn't overlap the rest either.
+      if (startAddr + pSize <= alloc.startAddr) {
+        if (!pBestFit)
+          return MemAllocData::AllocEntry(startAddr, pSize);
+        uint64_t hole = alloc.startAddr - startAddr;
+        if (!found || hole < bestHole) {
+          found = true;
+          bestAddr = startAddr;
+          bestHole = hole;
+        }
+      }
+    }
+    startAddr = std::max(startAddr,
+                         GetAlignedAddr(alloc.startAddr + alloc.size,
+                                        pAlignment));
+  }
+
+  // Otherwise, above all conflicting regions.
+  return MemAllocData::AllocEntry(found ? bestAddr : startAddr, pSize);
+}
+
 //===----------------------------------------------------------------------===//
 // LinearScanMemAlloc
 //===----------------------------------------------------------------------===//
 LinearScanMemAlloc::LinearScanMemAlloc(TargetBackend* pTarget)
-  : ModulePass(ID), m_MemAllocData(nullptr),
-    m_LIDataPass(nullptr), m_LiveMatPass(nullptr) {
+  : ModulePass(ID), m_MemAllocData(nullptr), m_LIDataPass(nullptr),
+    m_Strategy(pTarget->options().getMemAllocStrategy()),
+    m_Footprint(0), m_PeakLiveSize(0) {
+  m_TMI = pTarget->getMemInfo();
+}
+
+LinearScanMemAlloc::LinearScanMemAlloc(TargetBackend* pTarget,
+                                       Strategy pStrategy)
+  : ModulePass(ID), m_MemAllocData(nullptr), m_LIDataPass(nullptr),
+    m_Strategy(pStrategy), m_Footprint(0), m_PeakLiveSize(0) {
   m_TMI = pTarget->getMemInfo();
 }
 
 Pass::ReturnType LinearScanMemAlloc::runOnModule(Module& pModule)
 {
   m_LIDataPass = getAnalysis<LiveIntervalsData>();
-  m_LiveMatPass = getAnalysis<LiveValueMatrix>();
   m_MemAllocData = getAnalysis<MemAllocData>();
 
-  // Allocate memory for each value (live interval).
-  for (const LiveInterval* LI: m_LIDataPass->getSortedIntervals()) {
-    LiveIntervalsData::LIs overlappedLIs =
-      m_LiveMatPass->getInterferingLiveIntervals(LI);
+  // Aliases share the region of their base, so each base and its aliases
+  // make one request, which lives as long as any of them.
+  std::unordered_map<const Value*, size_t> groupOf;
+  std::vector<LiveIntervalTree::LIs> groups;
+  for (const LiveInterval* li : m_LIDataPass->getSortedIntervals()) {
+    const Value* base = m_MemAllocData->getBase(li->getValue());
+    auto group = groupOf.find(base);
+    if (groupOf.end() == group) {
+      group = groupOf.emplace(base, groups.size()).first;
+      groups.emplace_back();
+    }
+    groups[group->second].push_back(li);
+  }
 
-    AllocEntries allocRegions = getSortedAllocatedRegions(overlappedLIs);
+  std::vector<std::unique_ptr<LiveInterval> > merged;
+  LiveIntervalTree::LIs lis;
+  Requests requests;
+  for (const LiveIntervalTree::LIs& group : groups) {
+    MemSize m;
+    for (const LiveInterval* li : group) {
+      // FIXME: Do we have safer casting? We should check before casting.
+      Value* v = const_cast<Value*>(li->getValue());
+      MemSize size = m_TMI->getTensorMemorySize(*(Tensor*)v);
+      m.size = std::max(m.size, size.size);
+      m.alignment = std::max(m.alignment, size.alignment);
+    }
+    const LiveInterval* li = group.front();
+    if (group.size() > 1) {
+      merged.emplace_back(MergeIntervals(group));
+      li = merged.back().get();
+    }
+    lis.push_back(li);
+    requests.push_back(Request{li, m.size, m.alignment, AllocEntry()});
+  }
 
-    Value* v = const_cast<Value*>(LI->getValue());
+  LiveIntervalTree tree;
+  tree.build(lis);
 
-    // FIXME: Do we have safer casting? We should check before casting.
-    MemSize m = m_TMI->getTensorMemorySize(*(Tensor*)v);
+  if (TargetOptions::kMinimumMemory == m_Strategy) {
+    const Strategy strategies[] = {
+      TargetOptions::kFirstFit, TargetOptions::kBestFit,
+      TargetOptions::kGreedyBySize, TargetOptions::kSkyline
+    };
+    Requests best;
+    m_Footprint = 0;
+    for (Strategy strategy : strategies) {
+      Requests candidate = requests;
+      uint64_t footprint = allocate(strategy, tree, candidate);
+      if (best.empty() || footprint < m_Footprint) {
+        best.swap(candidate);
+        m_Footprint = footprint;
+      }
+    }
+    requests.swap(best);
+  }
+  else
+    m_Footprint = allocate(m_Strategy, tree, requests);
 
-    m_MemAllocData->addAlloc(v, getAnEmptyRegion(allocRegions,
-                                                 m.size, m.alignment));
+  for (size_t i = 0; i < requests.size(); ++i) {
+    for (const LiveInterval* li : groups[i]) {
+      Value* v = const_cast<Value*>(li->getValue());
+      m_MemAllocData->addAlloc(v, requests[i].alloc);
+    }
   }
+  m_PeakLiveSize = getPeakLiveSize(requests);
   return Pass::kModuleNoChanged;
 }
 
-void LinearScanMemAlloc::getAnalysisUsage(AnalysisUsage& pUsage) const
+uint64_t LinearScanMemAlloc::allocate(Strategy pStrategy,
+                                      const LiveIntervalTree& pTree,
+                                      Requests& pRequests) const
 {
-  pUsage.addRequiredID(LiveIntervalsData::ID);
-  pUsage.addRequiredID(LiveValueMatrix::ID);
-  pUsage.addRequiredID(MemAllocData::ID);
-}
+  // Place requests in the order of the strategy. pRequests is in the order
+  // of definition.
+  std::vector<Request*> order;
+  for (Request& request : pRequests)
+    order.push_back(&request);
 
-void LinearScanMemAlloc::print(OStream& pOS, const Module* pModule) const
-{
-  pOS << "=== LinearScanMemAlloc ===\n";
-  m_MemAllocData->print(pOS, pModule);
+  switch (pStrategy) {
+  case TargetOptions::kGreedyBySize:
+    std::stable_sort(order.begin(), order.end(),
+                     [] (const Request* pA, const Request* pB) {
+                       return pA->size * GetLifetime(*pA->li) >
+                              pB->size * GetLifetime(*pB->li);
+                     });
+    break;
+  case TargetOptions::kSkyline:
+    std::stable_sort(order.begin(), order.end(),
+                     [] (const Request* pA, const Request* pB) {
+                       unsigned int a = GetLifetime(*pA->li),
+                                    b = GetLifetime(*pB->li);
+                       return a != b ? a > b : pA->size > pB->size;
+                     });
+    break;
+  default:
+    break;
+  }
+  bool bestFit = (TargetOptions::kBestFit == pStrategy ||
+                  TargetOptions::kGreedyBySize == pStrategy);
+
+  std::unordered_map<const LiveInterval*, const Request*> placed;
+  LiveIntervalTree::LIs overlapped;
+  std::vector<AllocEntry> allocs;
+  uint64_t footprint = 0;
+  for (Request* request : order) {
+    overlapped.clear();
+    pTree.query(*request->li, overlapped);
+
+    allocs.clear();
+    for (const LiveInterval* li : overlapped) {
+      auto other = placed.find(li);
+      if (placed.end() != other)
+        allocs.push_back(other->second->alloc);
+    }
+
+    // sort by starting address
+    std::sort(allocs.begin(), allocs.end(),
+              [] (const AllocEntry& pA, const AllocEntry& pB) {
+                return pA.startAddr < pB.startAddr;
+              });
+
+    request->alloc = GetAnEmptyRegion(allocs, request->size,
+                                      request->alignment, bestFit);
+    placed[request->li] = request;
+    footprint = std::max(footprint, request->alloc.startAddr + request->size);
+  }
+  return footprint;
 }
 
-LinearScanMemAlloc::AllocEntries
-LinearScanMemAlloc::getSortedAllocatedRegions(const LIs& pLIs) const
+uint64_t LinearScanMemAlloc::getPeakLiveSize(const Requests& pRequests) const
 {
-  AllocEntries allocs;
-  for (const LiveInterval* li : pLIs) {
-    const Value* v = li->getValue();
-    if (m_MemAllocData->hasAlloc(v))
-      allocs.push_back(m_MemAllocData->getAlloc(v));
+  // Sweep the slots: a value is added where a segment starts and removed
+  // after it ends.
+  std::vector<int64_t> delta(m_LIDataPass->getNumSlots() + 1, 0);
+  for (const Request& request : pRequests) {
+    for (const LiveRange::Segment& seg : request.li->getSegments()) {
+      delta[seg.m_Start.getIndex()] += request.size;
+      delta[seg.m_End.getIndex() + 1] -= request.size;
+    }
   }
 
-  // sort by starting address
-  std::sort(allocs.begin(), allocs.end(),
-            [] (const AllocEntry& pA, const AllocEntry& pB) {
-              return pA.startAddr < pB.startAddr;
-            });
+  int64_t live = 0, peak = 0;
+  for (int64_t d : delta) {
+    live += d;
+    peak = std::max(peak, live);
+  }
+  return peak;
+}
 
-  return allocs;
+double LinearScanMemAlloc::getFragmentation() const
+{
+  if (0 == m_Footprint)
+    return 0.0;
+  return 1.0 - static_cast<double>(m_PeakLiveSize) / m_Footprint;
 }
 
-LinearScanMemAlloc::AllocEntry
-LinearScanMemAlloc::getAnEmptyRegion(
-  const LinearScanMemAlloc::AllocEntries& pAllocs,
-  uint64_t pRequiredSize, uint64_t pAlignment) const
+void LinearScanMemAlloc::getAnalysisUsage(AnalysisUsage& pUsage) const
 {
-  uint64_t startAddr = 0;
-  for (const AllocEntry& alloc : pAllocs) {
-    if (HasConflict(alloc.startAddr, alloc.size, startAddr, pRequiredSize)) {
-      startAddr = GetAlignedAddr(alloc.startAddr + alloc.size, pAlignment);
-      continue;
-    }
+  pUsage.addRequiredID(LiveIntervalsData::ID);
+  pUsage.addRequiredID(MemAllocData::ID);
+}
 
-    // Ok we find an empty region.
-    //
-    // Note! pAllocs is sorted by startAddr, so if end address of new allocation
-    // is <= current allocated start address, that means we won't have conflict
-    // with other unchecked regions since these regions must have start address
-    // > new allocation's end address.
-    if ((startAddr + pRequiredSize) <= alloc.startAddr)
-      break;
-  }
-  return AllocEntry(startAddr, pRequiredSize);
+void LinearScanMemAlloc::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== LinearScanMemAlloc ===\n";
+  pOS << "footprint: " << m_Footprint
+      << ", peak live size: " << m_PeakLiveSize
+      << ", fragmentation: " << std::fixed << std::setprecision(1)
+      << getFragmentation() * 100 << "%\n";
+  m_MemAllocData->print(pOS, pModule);
 }
 
 //===----------------------------------------------------------------------===//
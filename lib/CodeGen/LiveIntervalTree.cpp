@@ -0,0 +1,91 @@
+//===- LiveIntervalTree.cpp -----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/CodeGen/LiveIntervalTree.h>
+#include <algorithm>
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// LiveIntervalTree
+//===----------------------------------------------------------------------===//
+LiveIntervalTree::LiveIntervalTree()
+  : m_Nodes() {
+}
+
+void LiveIntervalTree::build(const LIs& pLIs)
+{
+  m_Nodes.clear();
+  for (const LiveInterval* li : pLIs) {
+    for (const LiveRange::Segment& seg : li->getSegments()) {
+      unsigned int start = seg.m_Start.getIndex(), end = seg.m_End.getIndex();
+      m_Nodes.push_back(Node{start, end, end, li});
+    }
+  }
+
+  std::sort(m_Nodes.begin(), m_Nodes.end(),
+            [] (const Node& pA, const Node& pB) {
+              return pA.start < pB.start;
+            });
+  buildMaxEnd(0, m_Nodes.size());
+}
+
+unsigned int LiveIntervalTree::buildMaxEnd(size_t pLo, size_t pHi)
+{
+  if (pLo >= pHi)
+    return 0;
+  size_t mid = (pLo + pHi) / 2;
+  Node& node = m_Nodes[mid];
+  node.maxEnd = std::max(node.end, std::max(buildMaxEnd(pLo, mid),
+                                            buildMaxEnd(mid + 1, pHi)));
+  return node.maxEnd;
+}
+
+void LiveIntervalTree::query(const LiveInterval& pLI, LIs& pResult) const
+{
+  size_t first = pResult.size();
+  for (const LiveRange::Segment& seg : pLI.getSegments())
+    query(seg.m_Start.getIndex(), seg.m_End.getIndex(), pResult);
+
+  // Remove pLI and the intervals found by more than one segment.
+  std::sort(pResult.begin() + first, pResult.end());
+  pResult.erase(std::unique(pResult.begin() + first, pResult.end()),
+                pResult.end());
+  pResult.erase(std::remove(pResult.begin() + first, pResult.end(), &pLI),
+                pResult.end());
+}
+
+void LiveIntervalTree::query(unsigned int pStart, unsigned int pEnd,
+                             LIs& pResult) const
+{
+  query(0, m_Nodes.size(), pStart, pEnd, pResult);
+}
+
+void LiveIntervalTree::query(size_t pLo, size_t pHi,
+                             unsigned int pStart, unsigned int pEnd,
+                             LIs& pResult) const
+{
+  while (pLo < pHi) {
+    size_t mid = (pLo + pHi) / 2;
+    const Node& node = m_Nodes[mid];
+
+    // Nothing in this subtree lives up to pStart.
+    if (node.maxEnd < pStart)
+      return;
+
+    query(pLo, mid, pStart, pEnd, pResult);
+
+    // Nodes on the right start even later.
+    if (node.start > pEnd)
+      return;
+
+    if (node.end >= pStart)
+      pResult.push_back(node.li);
+
+    pLo = mid + 1;
+  }
+}
@@ -36,6 +36,23 @@ bool MemAllocData::hasAlloc(const Value* pVal) const
   return it != m_ValToAllocEntry.end();
 }
 
+void MemAllocData::addAlias(const Value* pView, Value* pBase)
+{
+  assert(pView != getBase(pBase) && "An alias can't be its own base.");
+  m_ValToAlias[pView] = pBase;
+}
+
+Value* MemAllocData::getBase(const Value* pVal) const
+{
+  // A view of a view shares the memory of the first base.
+  auto it = m_ValToAlias.find(pVal);
+  while (it != m_ValToAlias.end()) {
+    pVal = it->second;
+    it = m_ValToAlias.find(pVal);
+  }
+  return const_cast<Value*>(pVal);
+}
+
 void MemAllocData::print(OStream& pOS, const Module* pModule) const
 {
   pOS << "=== MemAllocData ===\n";
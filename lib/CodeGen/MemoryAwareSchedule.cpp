@@ -0,0 +1,368 @@
+//===- MemoryAwareSchedule.cpp --------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/CodeGen/MemoryAwareSchedule.h>
+#include <onnc/Core/PassSupport.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Target/TargetBackend.h>
+#include <onnc/Target/TargetMemInfo.h>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+using namespace onnc;
+
+namespace {
+
+/// The operators between the inputs and the outputs of a graph, with the
+/// values they define and use.
+class Problem
+{
+public:
+  typedef std::vector<unsigned int> Order;
+
+  struct Op
+  {
+    ComputeOperator* node;
+    std::vector<unsigned int> inputs;  ///< unique values
+    std::vector<unsigned int> outputs;
+    std::vector<unsigned int> succs;   ///< ops using the outputs
+    unsigned int numPreds;
+    uint64_t outSize;  ///< bytes allocated while it runs
+    uint64_t keepSize; ///< bytes of outputs still live after it runs
+  };
+
+  struct Val
+  {
+    uint64_t size;
+    unsigned int numUsers; ///< ops using it
+    bool kept;             ///< used after all ops
+  };
+
+public:
+  Problem(ComputeGraph& pCG, TargetMemInfo& pTMI,
+          std::vector<ComputeOperator*>& pFront,
+          std::vector<ComputeOperator*>& pBack);
+
+  unsigned int size() const { return m_Ops.size(); }
+
+  ComputeOperator* node(unsigned int pOp) const { return m_Ops[pOp].node; }
+
+  /// @return The peak live bytes of running the ops in pOrder.
+  uint64_t getPeak(const Order& pOrder) const;
+
+  /// Run the ready op which frees the most memory.
+  Order scheduleGreedy() const;
+
+  /// Find the order with the lowest peak among all topological orders.
+  Order scheduleExact() const;
+
+private:
+  std::vector<Op> m_Ops;
+  std::vector<Val> m_Vals;
+  uint64_t m_Base; ///< bytes live before the first op
+};
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// Problem
+//===----------------------------------------------------------------------===//
+Problem::Problem(ComputeGraph& pCG, TargetMemInfo& pTMI,
+                 std::vector<ComputeOperator*>& pFront,
+                 std::vector<ComputeOperator*>& pBack)
+  : m_Ops(), m_Vals(), m_Base(0) {
+  std::unordered_map<const ComputeOperator*, unsigned int> opIds;
+  ComputeGraph::iterator nodeIt, nEnd = pCG.end();
+  for (nodeIt = pCG.begin(); nodeIt != nEnd; ++nodeIt) {
+    ComputeOperator* node = nodeIt;
+    if (isa<Initializer>(node) || isa<InputOperator>(node))
+      pFront.push_back(node);
+    else if (isa<OutputOperator>(node))
+      pBack.push_back(node);
+    else {
+      opIds[node] = m_Ops.size();
+      m_Ops.push_back(Op{node, {}, {}, {}, 0, 0, 0});
+    }
+  }
+
+  // Number the values defined in the graph. Weights don't take activation
+  // memory.
+  std::unordered_map<const Value*, unsigned int> valIds;
+  auto addValue = [&] (Value* pValue) {
+    auto found = valIds.find(pValue);
+    if (valIds.end() != found)
+      return found->second;
+    ComputeOperator* def = static_cast<ComputeOperator*>(pValue->getDefine());
+    uint64_t size = 0;
+    if (nullptr != def && !isa<Initializer>(def))
+      size = pTMI.getTensorMemorySize(*static_cast<Tensor*>(pValue)).size;
+    unsigned int id = m_Vals.size();
+    m_Vals.push_back(Val{size, 0, false});
+    valIds[pValue] = id;
+    return id;
+  };
+
+  for (ComputeOperator* node : pFront) {
+    for (unsigned int i = 0; i < node->getNumOfOutputs(); ++i)
+      m_Base += m_Vals[addValue(node->getOutput(i))].size;
+  }
+
+  for (Op& op : m_Ops) {
+    for (unsigned int i = 0; i < op.node->getNumOfOutputs(); ++i)
+      op.outputs.push_back(addValue(op.node->getOutput(i)));
+
+    for (unsigned int i = 0; i < op.node->getNumOfInputs(); ++i) {
+      unsigned int val = addValue(op.node->getInput(i));
+      if (op.inputs.end() == std::find(op.inputs.begin(), op.inputs.end(), val))
+        op.inputs.push_back(val);
+    }
+
+    for (unsigned int val : op.inputs)
+      ++m_Vals[val].numUsers;
+  }
+
+  // Dependencies follow the values.
+  for (unsigned int id = 0; id < m_Ops.size(); ++id) {
+    Op& op = m_Ops[id];
+    for (unsigned int i = 0; i < op.node->getNumOfInputs(); ++i) {
+      auto def = opIds.find(
+          static_cast<ComputeOperator*>(op.node->getInput(i)->getDefine()));
+      if (opIds.end() == def)
+        continue;
+      std::vector<unsigned int>& succs = m_Ops[def->second].succs;
+      if (succs.end() == std::find(succs.begin(), succs.end(), id)) {
+        succs.push_back(id);
+        ++op.numPreds;
+      }
+    }
+  }
+
+  for (ComputeOperator* node : pBack) {
+    for (unsigned int i = 0; i < node->getNumOfInputs(); ++i)
+      m_Vals[addValue(node->getInput(i))].kept = true;
+  }
+
+  for (Op& op : m_Ops) {
+    for (unsigned int val : op.outputs) {
+      op.outSize += m_Vals[val].size;
+      if (0 != m_Vals[val].numUsers || m_Vals[val].kept)
+        op.keepSize += m_Vals[val].size;
+    }
+  }
+}
+
+uint64_t Problem::getPeak(const Order& pOrder) const
+{
+  std::vector<unsigned int> remain(m_Vals.size());
+  for (unsigned int val = 0; val < m_Vals.size(); ++val)
+    remain[val] = m_Vals[val].numUsers;
+
+  uint64_t live = m_Base, peak = m_Base;
+  for (unsigned int id : pOrder) {
+    const Op& op = m_Ops[id];
+    peak = std::max(peak, live + op.outSize);
+    live += op.keepSize;
+    for (unsigned int val : op.inputs) {
+      if (0 == --remain[val] && !m_Vals[val].kept)
+        live -= m_Vals[val].size;
+    }
+  }
+  return peak;
+}
+
+Problem::Order Problem::scheduleGreedy() const
+{
+  std::vector<unsigned int> remain(m_Vals.size());
+  for (unsigned int val = 0; val < m_Vals.size(); ++val)
+    remain[val] = m_Vals[val].numUsers;
+
+  std::vector<unsigned int> preds(m_Ops.size());
+  Order ready;
+  for (unsigned int id = 0; id < m_Ops.size(); ++id) {
+    preds[id] = m_Ops[id].numPreds;
+    if (0 == preds[id])
+      ready.push_back(id);
+  }
+
+  Order order;
+  uint64_t live = m_Base;
+  while (!ready.empty()) {
+    // Lowest (growth of live bytes, bytes while running, original position).
+    auto best = ready.end();
+    int64_t bestGrowth = 0;
+    uint64_t bestStep = 0;
+    for (auto it = ready.begin(); it != ready.end(); ++it) {
+      const Op& op = m_Ops[*it];
+      int64_t growth = op.keepSize;
+      for (unsigned int val : op.inputs) {
+        if (1 == remain[val] && !m_Vals[val].kept)
+          growth -= m_Vals[val].size;
+      }
+      uint64_t step = live + op.outSize;
+      if (ready.end() == best || growth < bestGrowth ||
+          (growth == bestGrowth && (step < bestStep ||
+                                    (step == bestStep && *it < *best)))) {
+        best = it;
+        bestGrowth = growth;
+        bestStep = step;
+      }
+    }
+
+    unsigned int id = *best;
+    ready.erase(best);
+    order.push_back(id);
+    live += bestGrowth;
+    for (unsigned int val : m_Ops[id].inputs)
+      --remain[val];
+    for (unsigned int succ : m_Ops[id].succs) {
+      if (0 == --preds[succ])
+        ready.push_back(succ);
+    }
+  }
+  return order;
+}
+
+Problem::Order Problem::scheduleExact() const
+{
+  // peak[S] is the lowest peak of running the set S of ops first; live[S]
+  // only depends on S. S grows by one op at a time, so a set is visited
+  // after all of its subsets.
+  const unsigned int n = m_Ops.size();
+  const uint32_t full = (1u << n) - 1;
+  const uint64_t kNone = std::numeric_limits<uint64_t>::max();
+
+  std::vector<uint32_t> predMask(n, 0), userMask(m_Vals.size(), 0);
+  for (unsigned int id = 0; id < n; ++id) {
+    for (unsigned int succ : m_Ops[id].succs)
+      predMask[succ] |= (1u << id);
+    for (unsigned int val : m_Ops[id].inputs)
+      userMask[val] |= (1u << id);
+  }
+
+  std::vector<uint64_t> peak(full + 1, kNone), live(full + 1, 0);
+  std::vector<uint8_t> last(full + 1, 0);
+  peak[0] = live[0] = m_Base;
+  for (uint32_t set = 0; set < full; ++set) {
+    if (kNone == peak[set])
+      continue;
+    for (unsigned int id = 0; id < n; ++id) {
+      uint32_t bit = 1u << id;
+      if ((set & bit) || (predMask[id] & ~set))
+        continue;
+      const Op& op = m_Ops[id];
+      uint32_t next = set | bit;
+      uint64_t nextPeak = std::max(peak[set], live[set] + op.outSize);
+      if (nextPeak >= peak[next])
+        continue;
+      if (kNone == peak[next]) {
+        uint64_t l = live[set] + op.keepSize;
+        for (unsigned int val : op.inputs) {
+          if (0 == (userMask[val] & ~next) && !m_Vals[val].kept)
+            l -= m_Vals[val].size;
+        }
+        live[next] = l;
+      }
+      peak[next] = nextPeak;
+      last[next] = id;
+    }
+  }
+
+  Order order(n);
+  uint32_t set = full;
+  for (unsigned int i = n; i > 0; --i) {
+    order[i - 1] = last[set];
+    set &= ~(1u << last[set]);
+  }
+  return order;
+}
+
+//===----------------------------------------------------------------------===//
+// MemoryAwareSchedule
+//===----------------------------------------------------------------------===//
+MemoryAwareSchedule::MemoryAwareSchedule(TargetBackend* pTarget)
+  : ModulePass(ID), m_TMI(pTarget->getMemInfo()), m_Results() {
+}
+
+Pass::ReturnType MemoryAwareSchedule::runOnModule(Module& pModule)
+{
+  m_Results.clear();
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+  return ret;
+}
+
+bool MemoryAwareSchedule::runOnComputeGraph(ComputeGraph& pCG)
+{
+  std::vector<ComputeOperator*> front, back;
+  Problem problem(pCG, *m_TMI, front, back);
+
+  Problem::Order best(problem.size());
+  for (unsigned int id = 0; id < problem.size(); ++id)
+    best[id] = id;
+  uint64_t before = problem.getPeak(best), after = before;
+
+  // A partial order means the graph is not a DAG; leave it alone.
+  Problem::Order greedy = problem.scheduleGreedy();
+  if (greedy.size() != problem.size()) {
+    m_Results.push_back(Result{before, after});
+    return false;
+  }
+  uint64_t peak = problem.getPeak(greedy);
+  if (peak < after) {
+    best.swap(greedy);
+    after = peak;
+  }
+
+  if (problem.size() <= kMaxExactSize) {
+    Problem::Order exact = problem.scheduleExact();
+    peak = problem.getPeak(exact);
+    if (peak < after) {
+      best.swap(exact);
+      after = peak;
+    }
+  }
+
+  m_Results.push_back(Result{before, after});
+  if (after == before)
+    return false;
+
+  std::vector<ComputeOperator*> order(front);
+  for (unsigned int id : best)
+    order.push_back(problem.node(id));
+  order.insert(order.end(), back.begin(), back.end());
+  pCG.reorder(order);
+  return true;
+}
+
+void MemoryAwareSchedule::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== MemoryAwareSchedule ===\n";
+  for (const Result& result : m_Results) {
+    pOS << "peak live bytes: " << result.before << " -> " << result.after
+        << "\n";
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char MemoryAwareSchedule::ID = 0;
+
+ModulePass* onnc::CreateMemoryAwareSchedulePass(TargetBackend* pTarget)
+{
+  return new MemoryAwareSchedule(pTarget);
+}
@@ -0,0 +1,37 @@
+//===- BatchNormalizationNCHWc.cpp ----------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/BatchNormalizationNCHWc.h>
+
+using namespace onnc;
+
+char BatchNormalizationNCHWc::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// BatchNormalizationNCHWc
+//===----------------------------------------------------------------------===//
+BatchNormalizationNCHWc::BatchNormalizationNCHWc()
+  : ComputeOperator("BatchNormalizationNCHWc", ID),
+    m_Epsilon(9.99999974738e-06) {
+}
+
+BatchNormalizationNCHWc::BatchNormalizationNCHWc(const BatchNormalizationNCHWc& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_Epsilon(pCopy.getEpsilon()) {
+}
+
+void BatchNormalizationNCHWc::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "epsilon: " << getEpsilon()<< '>';
+}
+
+bool BatchNormalizationNCHWc::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,58 @@
+//===- ConvNCHWc.cpp ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/ConvNCHWc.h>
+
+using namespace onnc;
+
+char ConvNCHWc::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// ConvNCHWc
+//===----------------------------------------------------------------------===//
+ConvNCHWc::ConvNCHWc()
+  : ComputeOperator("ConvNCHWc", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations(),
+    m_Dilations(),
+    m_Pads(),
+    m_Strides() {
+}
+
+ConvNCHWc::ConvNCHWc(const ConvNCHWc& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_ActivationAlpha(pCopy.getActivationAlpha()),
+    m_ActivationBeta(pCopy.getActivationBeta()),
+    m_Activations(pCopy.getActivations()),
+    m_Dilations(pCopy.getDilations()),
+    m_Pads(pCopy.getPads()),
+    m_Strides(pCopy.getStrides()) {
+}
+
+void ConvNCHWc::addActivation(const std::string& pName,
+                              unsigned int pNumOfParams, double pAlpha,
+                              double pBeta)
+{
+  m_Activations.vector().push_back(pName);
+  if (pNumOfParams >= 1)
+    m_ActivationAlpha.vector().push_back(pAlpha);
+  if (pNumOfParams >= 2)
+    m_ActivationBeta.vector().push_back(pBeta);
+}
+
+void ConvNCHWc::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "activation_alpha: " << getActivationAlpha() << ", " "activation_beta: " << getActivationBeta() << ", " "activations: " << getActivations() << ", " "dilations: " << getDilations() << ", " "pads: " << getPads() << ", " "strides: " << getStrides()<< '>';
+}
+
+bool ConvNCHWc::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,37 @@
+//===- Dequantize.cpp -----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/Dequantize.h>
+
+using namespace onnc;
+
+char Dequantize::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// Dequantize
+//===----------------------------------------------------------------------===//
+Dequantize::Dequantize()
+  : ComputeOperator("Dequantize", ID),
+    m_Scale(1.0) {
+}
+
+Dequantize::Dequantize(const Dequantize& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_Scale(pCopy.getScale()) {
+}
+
+void Dequantize::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "scale: " << getScale()<< '>';
+}
+
+bool Dequantize::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,77 @@
+//===- FusedConv.cpp ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/FusedConv.h>
+
+using namespace onnc;
+
+char FusedConv::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// FusedConv
+//===----------------------------------------------------------------------===//
+FusedConv::FusedConv()
+  : ComputeOperator("FusedConv", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations(),
+    m_AutoPad("NOTSET"),
+    m_Dilations(),
+    m_Group(1),
+    m_KernelShape(),
+    m_Pads(),
+    m_Strides() {
+}
+
+FusedConv::FusedConv(const Conv& pOp)
+  : ComputeOperator("FusedConv", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations(),
+    m_AutoPad(pOp.getAutoPad()),
+    m_Dilations(pOp.getDilations()),
+    m_Group(pOp.getGroup()),
+    m_KernelShape(pOp.getKernelShape()),
+    m_Pads(pOp.getPads()),
+    m_Strides(pOp.getStrides()) {
+}
+
+FusedConv::FusedConv(const FusedConv& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_ActivationAlpha(pCopy.getActivationAlpha()),
+    m_ActivationBeta(pCopy.getActivationBeta()),
+    m_Activations(pCopy.getActivations()),
+    m_AutoPad(pCopy.getAutoPad()),
+    m_Dilations(pCopy.getDilations()),
+    m_Group(pCopy.getGroup()),
+    m_KernelShape(pCopy.getKernelShape()),
+    m_Pads(pCopy.getPads()),
+    m_Strides(pCopy.getStrides()) {
+}
+
+void FusedConv::addActivation(const std::string& pName,
+                             unsigned int pNumOfParams, double pAlpha,
+                             double pBeta)
+{
+  m_Activations.vector().push_back(pName);
+  if (pNumOfParams >= 1)
+    m_ActivationAlpha.vector().push_back(pAlpha);
+  if (pNumOfParams >= 2)
+    m_ActivationBeta.vector().push_back(pBeta);
+}
+
+void FusedConv::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "activation_alpha: " << getActivationAlpha() << ", " "activation_beta: " << getActivationBeta() << ", " "activations: " << getActivations() << ", " "auto_pad: " << getAutoPad() << ", " "dilations: " << getDilations() << ", " "group: " << getGroup() << ", " "kernel_shape: " << getKernelShape() << ", " "pads: " << getPads() << ", " "strides: " << getStrides()<< '>';
+}
+
+bool FusedConv::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
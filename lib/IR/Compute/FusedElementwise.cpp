@@ -0,0 +1,52 @@
+//===- FusedElementwise.cpp -----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/FusedElementwise.h>
+
+using namespace onnc;
+
+char FusedElementwise::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// FusedElementwise
+//===----------------------------------------------------------------------===//
+FusedElementwise::FusedElementwise()
+  : ComputeOperator("FusedElementwise", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations() {
+}
+
+FusedElementwise::FusedElementwise(const FusedElementwise& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_ActivationAlpha(pCopy.getActivationAlpha()),
+    m_ActivationBeta(pCopy.getActivationBeta()),
+    m_Activations(pCopy.getActivations()) {
+}
+
+void FusedElementwise::addActivation(const std::string& pName,
+                                    unsigned int pNumOfParams, double pAlpha,
+                                    double pBeta)
+{
+  m_Activations.vector().push_back(pName);
+  if (pNumOfParams >= 1)
+    m_ActivationAlpha.vector().push_back(pAlpha);
+  if (pNumOfParams >= 2)
+    m_ActivationBeta.vector().push_back(pBeta);
+}
+
+void FusedElementwise::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "activation_alpha: " << getActivationAlpha() << ", " "activation_beta: " << getActivationBeta() << ", " "activations: " << getActivations()<< '>';
+}
+
+bool FusedElementwise::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,71 @@
+//===- FusedGemm.cpp ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/FusedGemm.h>
+
+using namespace onnc;
+
+char FusedGemm::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// FusedGemm
+//===----------------------------------------------------------------------===//
+FusedGemm::FusedGemm()
+  : ComputeOperator("FusedGemm", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations(),
+    m_Alpha(1.0),
+    m_Beta(1.0),
+    m_TransA(0),
+    m_TransB(0) {
+}
+
+FusedGemm::FusedGemm(const Gemm& pOp)
+  : ComputeOperator("FusedGemm", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations(),
+    m_Alpha(pOp.getAlpha()),
+    m_Beta(pOp.getBeta()),
+    m_TransA(pOp.getTransA()),
+    m_TransB(pOp.getTransB()) {
+}
+
+FusedGemm::FusedGemm(const FusedGemm& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_ActivationAlpha(pCopy.getActivationAlpha()),
+    m_ActivationBeta(pCopy.getActivationBeta()),
+    m_Activations(pCopy.getActivations()),
+    m_Alpha(pCopy.getAlpha()),
+    m_Beta(pCopy.getBeta()),
+    m_TransA(pCopy.getTransA()),
+    m_TransB(pCopy.getTransB()) {
+}
+
+void FusedGemm::addActivation(const std::string& pName,
+                             unsigned int pNumOfParams, double pAlpha,
+                             double pBeta)
+{
+  m_Activations.vector().push_back(pName);
+  if (pNumOfParams >= 1)
+    m_ActivationAlpha.vector().push_back(pAlpha);
+  if (pNumOfParams >= 2)
+    m_ActivationBeta.vector().push_back(pBeta);
+}
+
+void FusedGemm::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "activation_alpha: " << getActivationAlpha() << ", " "activation_beta: " << getActivationBeta() << ", " "activations: " << getActivations() << ", " "alpha: " << getAlpha() << ", " "beta: " << getBeta() << ", " "transA: " << getTransA() << ", " "transB: " << getTransB()<< '>';
+}
+
+bool FusedGemm::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
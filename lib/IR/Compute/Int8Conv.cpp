@@ -0,0 +1,51 @@
+//===- Int8Conv.cpp -------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/Int8Conv.h>
+
+using namespace onnc;
+
+char Int8Conv::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// Int8Conv
+//===----------------------------------------------------------------------===//
+Int8Conv::Int8Conv()
+  : ComputeOperator("Int8Conv", ID),
+    m_Dilations(),
+    m_Group(1),
+    m_KernelShape(),
+    m_OutputScale(1.0),
+    m_Pads(),
+    m_Relu(0),
+    m_Scales(),
+    m_Strides() {
+}
+
+Int8Conv::Int8Conv(const Int8Conv& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_Dilations(pCopy.getDilations()),
+    m_Group(pCopy.getGroup()),
+    m_KernelShape(pCopy.getKernelShape()),
+    m_OutputScale(pCopy.getOutputScale()),
+    m_Pads(pCopy.getPads()),
+    m_Relu(pCopy.getRelu()),
+    m_Scales(pCopy.getScales()),
+    m_Strides(pCopy.getStrides()) {
+}
+
+void Int8Conv::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "dilations: " << getDilations() << ", " "group: " << getGroup() << ", " "kernel_shape: " << getKernelShape() << ", " "output_scale: " << getOutputScale() << ", " "pads: " << getPads() << ", " "relu: " << getRelu() << ", " "scales: " << getScales() << ", " "strides: " << getStrides()<< '>';
+}
+
+bool Int8Conv::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,41 @@
+//===- Int8Gemm.cpp -------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/Int8Gemm.h>
+
+using namespace onnc;
+
+char Int8Gemm::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// Int8Gemm
+//===----------------------------------------------------------------------===//
+Int8Gemm::Int8Gemm()
+  : ComputeOperator("Int8Gemm", ID),
+    m_OutputScale(1.0),
+    m_Relu(0),
+    m_Scales() {
+}
+
+Int8Gemm::Int8Gemm(const Int8Gemm& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_OutputScale(pCopy.getOutputScale()),
+    m_Relu(pCopy.getRelu()),
+    m_Scales(pCopy.getScales()) {
+}
+
+void Int8Gemm::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "output_scale: " << getOutputScale() << ", " "relu: " << getRelu() << ", " "scales: " << getScales()<< '>';
+}
+
+bool Int8Gemm::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,45 @@
+//===- PoolNCHWc.cpp ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/PoolNCHWc.h>
+
+using namespace onnc;
+
+char PoolNCHWc::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// PoolNCHWc
+//===----------------------------------------------------------------------===//
+PoolNCHWc::PoolNCHWc()
+  : ComputeOperator("PoolNCHWc", ID),
+    m_CountIncludePad(0),
+    m_KernelShape(),
+    m_Mode("MAX"),
+    m_Pads(),
+    m_Strides() {
+}
+
+PoolNCHWc::PoolNCHWc(const PoolNCHWc& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_CountIncludePad(pCopy.getCountIncludePad()),
+    m_KernelShape(pCopy.getKernelShape()),
+    m_Mode(pCopy.getMode()),
+    m_Pads(pCopy.getPads()),
+    m_Strides(pCopy.getStrides()) {
+}
+
+void PoolNCHWc::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "count_include_pad: " << getCountIncludePad() << ", " "kernel_shape: " << getKernelShape() << ", " "mode: " << getMode() << ", " "pads: " << getPads() << ", " "strides: " << getStrides()<< '>';
+}
+
+bool PoolNCHWc::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
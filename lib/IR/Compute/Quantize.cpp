@@ -0,0 +1,37 @@
+//===- Quantize.cpp -------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/Quantize.h>
+
+using namespace onnc;
+
+char Quantize::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// Quantize
+//===----------------------------------------------------------------------===//
+Quantize::Quantize()
+  : ComputeOperator("Quantize", ID),
+    m_Scale(1.0) {
+}
+
+Quantize::Quantize(const Quantize& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_Scale(pCopy.getScale()) {
+}
+
+void Quantize::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "scale: " << getScale()<< '>';
+}
+
+bool Quantize::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,35 @@
+//===- Reorder.cpp --------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/Reorder.h>
+
+using namespace onnc;
+
+char Reorder::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// Reorder
+//===----------------------------------------------------------------------===//
+Reorder::Reorder()
+  : ComputeOperator("Reorder", ID) {
+}
+
+Reorder::Reorder(const Reorder& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */ {
+}
+
+void Reorder::printAttributes(std::ostream& pOS) const
+{
+  ;
+}
+
+bool Reorder::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
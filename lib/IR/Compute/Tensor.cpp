@@ -48,6 +48,7 @@ void Tensor::print(std::ostream& pOS) const {
     case kDouble: pOS << "double"; break;
     case kUint32: pOS << "uint32"; break;
     case kUint64: pOS << "uint64"; break;
+    case kBFloat16: pOS << "bfloat16"; break;
 
     case kComplex64: pOS << "complex64"; break;
     case kComplex128: pOS << "complex128"; break;
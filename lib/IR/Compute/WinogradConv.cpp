@@ -0,0 +1,56 @@
+//===- WinogradConv.cpp ---------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/Compute/WinogradConv.h>
+
+using namespace onnc;
+
+char WinogradConv::ID = 0;
+
+//===----------------------------------------------------------------------===//
+// WinogradConv
+//===----------------------------------------------------------------------===//
+WinogradConv::WinogradConv()
+  : ComputeOperator("WinogradConv", ID),
+    m_ActivationAlpha(),
+    m_ActivationBeta(),
+    m_Activations(),
+    m_Pads(),
+    m_Tile(2) {
+}
+
+WinogradConv::WinogradConv(const WinogradConv& pCopy)
+  : ComputeOperator(pCopy) /* shallow copy */,
+    m_ActivationAlpha(pCopy.getActivationAlpha()),
+    m_ActivationBeta(pCopy.getActivationBeta()),
+    m_Activations(pCopy.getActivations()),
+    m_Pads(pCopy.getPads()),
+    m_Tile(pCopy.getTile()) {
+}
+
+void WinogradConv::addActivation(const std::string& pName,
+                                 unsigned int pNumOfParams, double pAlpha,
+                                 double pBeta)
+{
+  m_Activations.vector().push_back(pName);
+  if (pNumOfParams >= 1)
+    m_ActivationAlpha.vector().push_back(pAlpha);
+  if (pNumOfParams >= 2)
+    m_ActivationBeta.vector().push_back(pBeta);
+}
+
+void WinogradConv::printAttributes(std::ostream& pOS) const
+{
+  pOS << '<' << "activation_alpha: " << getActivationAlpha() << ", " "activation_beta: " << getActivationBeta() << ", " "activations: " << getActivations() << ", " "pads: " << getPads() << ", " "tile: " << getTile()<< '>';
+}
+
+bool WinogradConv::classof(const ComputeOperator* pOp)
+{
+  if (nullptr == pOp)
+    return false;
+  return (pOp->getID() == &ID);
+}
@@ -0,0 +1,288 @@
+//===- ComputeArchive.cpp -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/IR/ComputeArchive.h>
+#include <onnc/IR/Compute/BatchNormalizationNCHWc.h>
+#include <onnc/IR/Compute/ConvNCHWc.h>
+#include <onnc/IR/Compute/Dequantize.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/Int8Conv.h>
+#include <onnc/IR/Compute/Int8Gemm.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/PoolNCHWc.h>
+#include <onnc/IR/Compute/Quantize.h>
+#include <onnc/IR/Compute/Reorder.h>
+#include <onnc/IR/Compute/WinogradConv.h>
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// ComputeArchive
+//===----------------------------------------------------------------------===//
+ComputeArchive::ComputeArchive(std::string& pBuffer)
+  : m_pBuffer(&pBuffer), m_pCurrent(nullptr), m_pEnd(nullptr), m_Good(true) {
+}
+
+ComputeArchive::ComputeArchive(const char* pBegin, const char* pEnd)
+  : m_pBuffer(nullptr), m_pCurrent(pBegin), m_pEnd(pEnd), m_Good(true) {
+}
+
+void ComputeArchive::write(const std::string& pString)
+{
+  write(static_cast<uint64_t>(pString.size()));
+  writeBytes(pString.data(), pString.size());
+}
+
+void ComputeArchive::writeBytes(const void* pData, size_t pSize)
+{
+  m_pBuffer->append(static_cast<const char*>(pData), pSize);
+}
+
+void ComputeArchive::read(std::string& pString)
+{
+  uint64_t size = 0;
+  read(size);
+  const char* data = readBytes(size);
+  if (nullptr == data)
+    pString.clear();
+  else
+    pString.assign(data, size);
+}
+
+const char* ComputeArchive::readBytes(size_t pSize)
+{
+  if (!m_Good || static_cast<size_t>(m_pEnd - m_pCurrent) < pSize) {
+    m_Good = false;
+    return nullptr;
+  }
+  const char* data = m_pCurrent;
+  m_pCurrent += pSize;
+  return data;
+}
+
+template<typename ValueType>
+void ComputeArchive::transferValue(ValueType& pValue)
+{
+  if (isWriting())
+    write(pValue);
+  else
+    read(pValue);
+}
+
+void ComputeArchive::transfer(IntAttr& pAttr)
+{
+  int64_t value = pAttr.value();
+  transferValue(value);
+  pAttr.setValue(value);
+}
+
+void ComputeArchive::transfer(FloatAttr& pAttr)
+{
+  double value = pAttr.value();
+  transferValue(value);
+  pAttr.setValue(value);
+}
+
+void ComputeArchive::transfer(StringAttr& pAttr)
+{
+  std::string value = pAttr.value();
+  transferValue(value);
+  pAttr.setValue(value);
+}
+
+void ComputeArchive::transfer(IntsAttr& pAttr)
+{
+  transferValue(pAttr.vector());
+}
+
+void ComputeArchive::transfer(FloatsAttr& pAttr)
+{
+  transferValue(pAttr.vector());
+}
+
+void ComputeArchive::transfer(StringsAttr& pAttr)
+{
+  transferValue(pAttr.vector());
+}
+
+bool ComputeArchive::writeOperator(ComputeOperator& pOp)
+{
+  std::string type = pOp.name();
+  if (!GetCreators().count(type))
+    return false;
+  write(type);
+  pOp.accept(*this);
+  return m_Good;
+}
+
+ComputeOperator* ComputeArchive::readOperator(ComputeGraph& pGraph)
+{
+  std::string type;
+  read(type);
+  CreatorMap::const_iterator creator = GetCreators().find(type);
+  if (!m_Good || GetCreators().end() == creator) {
+    m_Good = false;
+    return nullptr;
+  }
+  ComputeOperator* op = creator->second(pGraph);
+  op->accept(*this);
+  return m_Good ? op : nullptr;
+}
+
+const ComputeArchive::CreatorMap& ComputeArchive::GetCreators()
+{
+  static const CreatorMap creators = BuildCreators();
+  return creators;
+}
+
+ComputeArchive::CreatorMap ComputeArchive::BuildCreators()
+{
+  CreatorMap creators;
+  AddONNXCreators(creators);
+  creators["BatchNormalizationNCHWc"] = Create<BatchNormalizationNCHWc>;
+  creators["ConvNCHWc"] = Create<ConvNCHWc>;
+  creators["Dequantize"] = Create<Dequantize>;
+  creators["FusedConv"] = Create<FusedConv>;
+  creators["FusedElementwise"] = Create<FusedElementwise>;
+  creators["FusedGemm"] = Create<FusedGemm>;
+  creators["Initializer"] = Create<Initializer>;
+  creators["InputOperator"] = Create<InputOperator>;
+  creators["Int8Conv"] = Create<Int8Conv>;
+  creators["Int8Gemm"] = Create<Int8Gemm>;
+  creators["OutputOperator"] = Create<OutputOperator>;
+  creators["PoolNCHWc"] = Create<PoolNCHWc>;
+  creators["Quantize"] = Create<Quantize>;
+  creators["Reorder"] = Create<Reorder>;
+  creators["WinogradConv"] = Create<WinogradConv>;
+  return creators;
+}
+
+//===----------------------------------------------------------------------===//
+// Visitors of the ONNC operators
+//===----------------------------------------------------------------------===//
+void ComputeArchive::visit(BatchNormalizationNCHWc& pOp)
+{
+  transfer(pOp, &BatchNormalizationNCHWc::getEpsilon,
+           &BatchNormalizationNCHWc::setEpsilon);
+}
+
+void ComputeArchive::visit(ConvNCHWc& pOp)
+{
+  transfer(pOp, &ConvNCHWc::getActivationAlpha,
+           &ConvNCHWc::setActivationAlpha);
+  transfer(pOp, &ConvNCHWc::getActivationBeta, &ConvNCHWc::setActivationBeta);
+  transfer(pOp, &ConvNCHWc::getActivations, &ConvNCHWc::setActivations);
+  transfer(pOp, &ConvNCHWc::getDilations, &ConvNCHWc::setDilations);
+  transfer(pOp, &ConvNCHWc::getPads, &ConvNCHWc::setPads);
+  transfer(pOp, &ConvNCHWc::getStrides, &ConvNCHWc::setStrides);
+}
+
+void ComputeArchive::visit(Dequantize& pOp)
+{
+  transfer(pOp, &Dequantize::getScale, &Dequantize::setScale);
+}
+
+void ComputeArchive::visit(FusedConv& pOp)
+{
+  transfer(pOp, &FusedConv::getActivationAlpha,
+           &FusedConv::setActivationAlpha);
+  transfer(pOp, &FusedConv::getActivationBeta, &FusedConv::setActivationBeta);
+  transfer(pOp, &FusedConv::getActivations, &FusedConv::setActivations);
+  transfer(pOp, &FusedConv::getAutoPad, &FusedConv::setAutoPad);
+  transfer(pOp, &FusedConv::getDilations, &FusedConv::setDilations);
+  transfer(pOp, &FusedConv::getGroup, &FusedConv::setGroup);
+  transfer(pOp, &FusedConv::getKernelShape, &FusedConv::setKernelShape);
+  transfer(pOp, &FusedConv::getPads, &FusedConv::setPads);
+  transfer(pOp, &FusedConv::getStrides, &FusedConv::setStrides);
+}
+
+void ComputeArchive::visit(FusedElementwise& pOp)
+{
+  transfer(pOp, &FusedElementwise::getActivationAlpha,
+           &FusedElementwise::setActivationAlpha);
+  transfer(pOp, &FusedElementwise::getActivationBeta,
+           &FusedElementwise::setActivationBeta);
+  transfer(pOp, &FusedElementwise::getActivations,
+           &FusedElementwise::setActivations);
+}
+
+void ComputeArchive::visit(FusedGemm& pOp)
+{
+  transfer(pOp, &FusedGemm::getActivationAlpha,
+           &FusedGemm::setActivationAlpha);
+  transfer(pOp, &FusedGemm::getActivationBeta, &FusedGemm::setActivationBeta);
+  transfer(pOp, &FusedGemm::getActivations, &FusedGemm::setActivations);
+  transfer(pOp, &FusedGemm::getAlpha, &FusedGemm::setAlpha);
+  transfer(pOp, &FusedGemm::getBeta, &FusedGemm::setBeta);
+  transfer(pOp, &FusedGemm::getTransA, &FusedGemm::setTransA);
+  transfer(pOp, &FusedGemm::getTransB, &FusedGemm::setTransB);
+}
+
+void ComputeArchive::visit(Initializer& pOp)
+{
+  transfer(pOp, &Initializer::getNameAttr, &Initializer::setNameAttr);
+}
+
+void ComputeArchive::visit(InputOperator& pOp)
+{
+  transfer(pOp, &InputOperator::getNameAttr, &InputOperator::setNameAttr);
+}
+
+void ComputeArchive::visit(Int8Conv& pOp)
+{
+  transfer(pOp, &Int8Conv::getDilations, &Int8Conv::setDilations);
+  transfer(pOp, &Int8Conv::getGroup, &Int8Conv::setGroup);
+  transfer(pOp, &Int8Conv::getKernelShape, &Int8Conv::setKernelShape);
+  transfer(pOp, &Int8Conv::getOutputScale, &Int8Conv::setOutputScale);
+  transfer(pOp, &Int8Conv::getPads, &Int8Conv::setPads);
+  transfer(pOp, &Int8Conv::getRelu, &Int8Conv::setRelu);
+  transfer(pOp, &Int8Conv::getScales, &Int8Conv::setScales);
+  transfer(pOp, &Int8Conv::getStrides, &Int8Conv::setStrides);
+}
+
+void ComputeArchive::visit(Int8Gemm& pOp)
+{
+  transfer(pOp, &Int8Gemm::getOutputScale, &Int8Gemm::setOutputScale);
+  transfer(pOp, &Int8Gemm::getRelu, &Int8Gemm::setRelu);
+  transfer(pOp, &Int8Gemm::getScales, &Int8Gemm::setScales);
+}
+
+void ComputeArchive::visit(OutputOperator& pOp)
+{
+  transfer(pOp, &OutputOperator::getNameAttr, &OutputOperator::setNameAttr);
+}
+
+void ComputeArchive::visit(PoolNCHWc& pOp)
+{
+  transfer(pOp, &PoolNCHWc::getCountIncludePad,
+           &PoolNCHWc::setCountIncludePad);
+  transfer(pOp, &PoolNCHWc::getKernelShape, &PoolNCHWc::setKernelShape);
+  transfer(pOp, &PoolNCHWc::getMode, &PoolNCHWc::setMode);
+  transfer(pOp, &PoolNCHWc::getPads, &PoolNCHWc::setPads);
+  transfer(pOp, &PoolNCHWc::getStrides, &PoolNCHWc::setStrides);
+}
+
+void ComputeArchive::visit(Quantize& pOp)
+{
+  transfer(pOp, &Quantize::getScale, &Quantize::setScale);
+}
+
+void ComputeArchive::visit(WinogradConv& pOp)
+{
+  transfer(pOp, &WinogradConv::getActivationAlpha,
+           &WinogradConv::setActivationAlpha);
+  transfer(pOp, &WinogradConv::getActivationBeta,
+           &WinogradConv::setActivationBeta);
+  transfer(pOp, &WinogradConv::getActivations,
+           &WinogradConv::setActivations);
+  transfer(pOp, &WinogradConv::getPads, &WinogradConv::setPads);
+  transfer(pOp, &WinogradConv::getTile, &WinogradConv::setTile);
+}
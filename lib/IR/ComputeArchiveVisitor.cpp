@@ -0,0 +1,860 @@
+//===- ComputeArchiveVisitor.cpp ------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// This file is generated by scripts/runtime/code_generator.py. Visitors of
+// the ONNC operators are written by hand in ComputeArchive.cpp.
+#include <onnc/IR/ComputeArchive.h>
+
+#include <onnc/IR/Compute/Abs.h>
+#include <onnc/IR/Compute/Acos.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/And.h>
+#include <onnc/IR/Compute/ArgMax.h>
+#include <onnc/IR/Compute/ArgMin.h>
+#include <onnc/IR/Compute/Asin.h>
+#include <onnc/IR/Compute/Atan.h>
+#include <onnc/IR/Compute/AveragePool.h>
+#include <onnc/IR/Compute/BatchNormalization.h>
+#include <onnc/IR/Compute/Cast.h>
+#include <onnc/IR/Compute/Ceil.h>
+#include <onnc/IR/Compute/Clip.h>
+#include <onnc/IR/Compute/Concat.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/ConvTranspose.h>
+#include <onnc/IR/Compute/Cos.h>
+#include <onnc/IR/Compute/DepthToSpace.h>
+#include <onnc/IR/Compute/Div.h>
+#include <onnc/IR/Compute/Dropout.h>
+#include <onnc/IR/Compute/Elu.h>
+#include <onnc/IR/Compute/Equal.h>
+#include <onnc/IR/Compute/Exp.h>
+#include <onnc/IR/Compute/Expand.h>
+#include <onnc/IR/Compute/Flatten.h>
+#include <onnc/IR/Compute/Floor.h>
+#include <onnc/IR/Compute/GRU.h>
+#include <onnc/IR/Compute/Gather.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/GlobalAveragePool.h>
+#include <onnc/IR/Compute/GlobalLpPool.h>
+#include <onnc/IR/Compute/GlobalMaxPool.h>
+#include <onnc/IR/Compute/Greater.h>
+#include <onnc/IR/Compute/HardSigmoid.h>
+#include <onnc/IR/Compute/Hardmax.h>
+#include <onnc/IR/Compute/Identity.h>
+#include <onnc/IR/Compute/InstanceNormalization.h>
+#include <onnc/IR/Compute/LRN.h>
+#include <onnc/IR/Compute/LSTM.h>
+#include <onnc/IR/Compute/LeakyRelu.h>
+#include <onnc/IR/Compute/Less.h>
+#include <onnc/IR/Compute/Log.h>
+#include <onnc/IR/Compute/LogSoftmax.h>
+#include <onnc/IR/Compute/LpNormalization.h>
+#include <onnc/IR/Compute/LpPool.h>
+#include <onnc/IR/Compute/MatMul.h>
+#include <onnc/IR/Compute/Max.h>
+#include <onnc/IR/Compute/MaxPool.h>
+#include <onnc/IR/Compute/MaxRoiPool.h>
+#include <onnc/IR/Compute/Mean.h>
+#include <onnc/IR/Compute/Min.h>
+#include <onnc/IR/Compute/Mul.h>
+#include <onnc/IR/Compute/Multinomial.h>
+#include <onnc/IR/Compute/Neg.h>
+#include <onnc/IR/Compute/Not.h>
+#include <onnc/IR/Compute/Or.h>
+#include <onnc/IR/Compute/PRelu.h>
+#include <onnc/IR/Compute/Pad.h>
+#include <onnc/IR/Compute/Pow.h>
+#include <onnc/IR/Compute/RNN.h>
+#include <onnc/IR/Compute/RandomNormal.h>
+#include <onnc/IR/Compute/RandomNormalLike.h>
+#include <onnc/IR/Compute/RandomUniform.h>
+#include <onnc/IR/Compute/RandomUniformLike.h>
+#include <onnc/IR/Compute/Reciprocal.h>
+#include <onnc/IR/Compute/ReduceL1.h>
+#include <onnc/IR/Compute/ReduceL2.h>
+#include <onnc/IR/Compute/ReduceLogSum.h>
+#include <onnc/IR/Compute/ReduceLogSumExp.h>
+#include <onnc/IR/Compute/ReduceMax.h>
+#include <onnc/IR/Compute/ReduceMean.h>
+#include <onnc/IR/Compute/ReduceMin.h>
+#include <onnc/IR/Compute/ReduceProd.h>
+#include <onnc/IR/Compute/ReduceSum.h>
+#include <onnc/IR/Compute/ReduceSumSquare.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/Reshape.h>
+#include <onnc/IR/Compute/Selu.h>
+#include <onnc/IR/Compute/Shape.h>
+#include <onnc/IR/Compute/Sigmoid.h>
+#include <onnc/IR/Compute/Sin.h>
+#include <onnc/IR/Compute/Size.h>
+#include <onnc/IR/Compute/Slice.h>
+#include <onnc/IR/Compute/Softmax.h>
+#include <onnc/IR/Compute/Softplus.h>
+#include <onnc/IR/Compute/Softsign.h>
+#include <onnc/IR/Compute/SpaceToDepth.h>
+#include <onnc/IR/Compute/Split.h>
+#include <onnc/IR/Compute/Sqrt.h>
+#include <onnc/IR/Compute/Squeeze.h>
+#include <onnc/IR/Compute/Sub.h>
+#include <onnc/IR/Compute/Sum.h>
+#include <onnc/IR/Compute/Tan.h>
+#include <onnc/IR/Compute/Tanh.h>
+#include <onnc/IR/Compute/Tile.h>
+#include <onnc/IR/Compute/TopK.h>
+#include <onnc/IR/Compute/Transpose.h>
+#include <onnc/IR/Compute/Unsqueeze.h>
+#include <onnc/IR/Compute/Upsample.h>
+#include <onnc/IR/Compute/Xor.h>
+#include <onnc/IR/Compute/ATen.h>
+#include <onnc/IR/Compute/Affine.h>
+#include <onnc/IR/Compute/ConstantFill.h>
+#include <onnc/IR/Compute/Crop.h>
+#include <onnc/IR/Compute/GRUUnit.h>
+#include <onnc/IR/Compute/GivenTensorFill.h>
+#include <onnc/IR/Compute/ImageScaler.h>
+#include <onnc/IR/Compute/MeanVarianceNormalization.h>
+#include <onnc/IR/Compute/ParametricSoftplus.h>
+#include <onnc/IR/Compute/Scale.h>
+#include <onnc/IR/Compute/ScaledTanh.h>
+#include <onnc/IR/Compute/ThresholdedRelu.h>
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// ComputeArchive
+//===----------------------------------------------------------------------===//
+void ComputeArchive::AddONNXCreators(CreatorMap& pCreators)
+{
+  pCreators["Abs"] = Create<Abs>;
+  pCreators["Acos"] = Create<Acos>;
+  pCreators["Add"] = Create<Add>;
+  pCreators["And"] = Create<And>;
+  pCreators["ArgMax"] = Create<ArgMax>;
+  pCreators["ArgMin"] = Create<ArgMin>;
+  pCreators["Asin"] = Create<Asin>;
+  pCreators["Atan"] = Create<Atan>;
+  pCreators["AveragePool"] = Create<AveragePool, IntsAttr>;
+  pCreators["BatchNormalization"] = Create<BatchNormalization>;
+  pCreators["Cast"] = Create<Cast, IntAttr>;
+  pCreators["Ceil"] = Create<Ceil>;
+  pCreators["Clip"] = Create<Clip>;
+  pCreators["Concat"] = Create<Concat, IntAttr>;
+  pCreators["Conv"] = Create<Conv>;
+  pCreators["ConvTranspose"] = Create<ConvTranspose>;
+  pCreators["Cos"] = Create<Cos>;
+  pCreators["DepthToSpace"] = Create<DepthToSpace, IntAttr>;
+  pCreators["Div"] = Create<Div>;
+  pCreators["Dropout"] = Create<Dropout>;
+  pCreators["Elu"] = Create<Elu>;
+  pCreators["Equal"] = Create<Equal>;
+  pCreators["Exp"] = Create<Exp>;
+  pCreators["Expand"] = Create<Expand>;
+  pCreators["Flatten"] = Create<Flatten>;
+  pCreators["Floor"] = Create<Floor>;
+  pCreators["GRU"] = Create<GRU>;
+  pCreators["Gather"] = Create<Gather>;
+  pCreators["Gemm"] = Create<Gemm>;
+  pCreators["GlobalAveragePool"] = Create<GlobalAveragePool>;
+  pCreators["GlobalLpPool"] = Create<GlobalLpPool>;
+  pCreators["GlobalMaxPool"] = Create<GlobalMaxPool>;
+  pCreators["Greater"] = Create<Greater>;
+  pCreators["HardSigmoid"] = Create<HardSigmoid>;
+  pCreators["Hardmax"] = Create<Hardmax>;
+  pCreators["Identity"] = Create<Identity>;
+  pCreators["InstanceNormalization"] = Create<InstanceNormalization>;
+  pCreators["LRN"] = Create<LRN, IntAttr>;
+  pCreators["LSTM"] = Create<LSTM>;
+  pCreators["LeakyRelu"] = Create<LeakyRelu>;
+  pCreators["Less"] = Create<Less>;
+  pCreators["Log"] = Create<Log>;
+  pCreators["LogSoftmax"] = Create<LogSoftmax>;
+  pCreators["LpNormalization"] = Create<LpNormalization>;
+  pCreators["LpPool"] = Create<LpPool, IntsAttr>;
+  pCreators["MatMul"] = Create<MatMul>;
+  pCreators["Max"] = Create<Max>;
+  pCreators["MaxPool"] = Create<MaxPool, IntsAttr>;
+  pCreators["MaxRoiPool"] = Create<MaxRoiPool, IntsAttr>;
+  pCreators["Mean"] = Create<Mean>;
+  pCreators["Min"] = Create<Min>;
+  pCreators["Mul"] = Create<Mul>;
+  pCreators["Multinomial"] = Create<Multinomial>;
+  pCreators["Neg"] = Create<Neg>;
+  pCreators["Not"] = Create<Not>;
+  pCreators["Or"] = Create<Or>;
+  pCreators["PRelu"] = Create<PRelu>;
+  pCreators["Pad"] = Create<Pad, IntsAttr>;
+  pCreators["Pow"] = Create<Pow>;
+  pCreators["RNN"] = Create<RNN>;
+  pCreators["RandomNormal"] = Create<RandomNormal, IntsAttr>;
+  pCreators["RandomNormalLike"] = Create<RandomNormalLike>;
+  pCreators["RandomUniform"] = Create<RandomUniform, IntsAttr>;
+  pCreators["RandomUniformLike"] = Create<RandomUniformLike>;
+  pCreators["Reciprocal"] = Create<Reciprocal>;
+  pCreators["ReduceL1"] = Create<ReduceL1>;
+  pCreators["ReduceL2"] = Create<ReduceL2>;
+  pCreators["ReduceLogSum"] = Create<ReduceLogSum>;
+  pCreators["ReduceLogSumExp"] = Create<ReduceLogSumExp>;
+  pCreators["ReduceMax"] = Create<ReduceMax>;
+  pCreators["ReduceMean"] = Create<ReduceMean>;
+  pCreators["ReduceMin"] = Create<ReduceMin>;
+  pCreators["ReduceProd"] = Create<ReduceProd>;
+  pCreators["ReduceSum"] = Create<ReduceSum>;
+  pCreators["ReduceSumSquare"] = Create<ReduceSumSquare>;
+  pCreators["Relu"] = Create<Relu>;
+  pCreators["Reshape"] = Create<Reshape>;
+  pCreators["Selu"] = Create<Selu>;
+  pCreators["Shape"] = Create<Shape>;
+  pCreators["Sigmoid"] = Create<Sigmoid>;
+  pCreators["Sin"] = Create<Sin>;
+  pCreators["Size"] = Create<Size>;
+  pCreators["Slice"] = Create<Slice, IntsAttr, IntsAttr>;
+  pCreators["Softmax"] = Create<Softmax>;
+  pCreators["Softplus"] = Create<Softplus>;
+  pCreators["Softsign"] = Create<Softsign>;
+  pCreators["SpaceToDepth"] = Create<SpaceToDepth, IntAttr>;
+  pCreators["Split"] = Create<Split>;
+  pCreators["Sqrt"] = Create<Sqrt>;
+  pCreators["Squeeze"] = Create<Squeeze>;
+  pCreators["Sub"] = Create<Sub>;
+  pCreators["Sum"] = Create<Sum>;
+  pCreators["Tan"] = Create<Tan>;
+  pCreators["Tanh"] = Create<Tanh>;
+  pCreators["Tile"] = Create<Tile>;
+  pCreators["TopK"] = Create<TopK, IntAttr>;
+  pCreators["Transpose"] = Create<Transpose>;
+  pCreators["Unsqueeze"] = Create<Unsqueeze, IntsAttr>;
+  pCreators["Upsample"] = Create<Upsample, FloatsAttr>;
+  pCreators["Xor"] = Create<Xor>;
+  pCreators["ATen"] = Create<ATen>;
+  pCreators["Affine"] = Create<Affine>;
+  pCreators["ConstantFill"] = Create<ConstantFill>;
+  pCreators["Crop"] = Create<Crop>;
+  pCreators["GRUUnit"] = Create<GRUUnit>;
+  pCreators["GivenTensorFill"] = Create<GivenTensorFill>;
+  pCreators["ImageScaler"] = Create<ImageScaler>;
+  pCreators["MeanVarianceNormalization"] = Create<MeanVarianceNormalization>;
+  pCreators["ParametricSoftplus"] = Create<ParametricSoftplus>;
+  pCreators["Scale"] = Create<Scale>;
+  pCreators["ScaledTanh"] = Create<ScaledTanh>;
+  pCreators["ThresholdedRelu"] = Create<ThresholdedRelu>;
+}
+
+void ComputeArchive::visit(Abs& pOp) {
+}
+
+
+void ComputeArchive::visit(Acos& pOp) {
+}
+
+
+void ComputeArchive::visit(Add& pOp) {
+}
+
+
+void ComputeArchive::visit(And& pOp) {
+}
+
+
+void ComputeArchive::visit(ArgMax& pOp) {
+  transfer(pOp, &ArgMax::getAxis, &ArgMax::setAxis);
+  transfer(pOp, &ArgMax::getKeepdims, &ArgMax::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ArgMin& pOp) {
+  transfer(pOp, &ArgMin::getAxis, &ArgMin::setAxis);
+  transfer(pOp, &ArgMin::getKeepdims, &ArgMin::setKeepdims);
+}
+
+
+void ComputeArchive::visit(Asin& pOp) {
+}
+
+
+void ComputeArchive::visit(Atan& pOp) {
+}
+
+
+void ComputeArchive::visit(AveragePool& pOp) {
+  transfer(pOp, &AveragePool::getAutoPad, &AveragePool::setAutoPad);
+  transfer(pOp, &AveragePool::getCountIncludePad, &AveragePool::setCountIncludePad);
+  transfer(pOp, &AveragePool::getKernelShape, &AveragePool::setKernelShape);
+  transfer(pOp, &AveragePool::getPads, &AveragePool::setPads);
+  transfer(pOp, &AveragePool::getStrides, &AveragePool::setStrides);
+}
+
+
+void ComputeArchive::visit(BatchNormalization& pOp) {
+  transfer(pOp, &BatchNormalization::getEpsilon, &BatchNormalization::setEpsilon);
+  transfer(pOp, &BatchNormalization::getMomentum, &BatchNormalization::setMomentum);
+  transfer(pOp, &BatchNormalization::getSpatial, &BatchNormalization::setSpatial);
+}
+
+
+void ComputeArchive::visit(Cast& pOp) {
+  transfer(pOp, &Cast::getTo, &Cast::setTo);
+}
+
+
+void ComputeArchive::visit(Ceil& pOp) {
+}
+
+
+void ComputeArchive::visit(Clip& pOp) {
+  transfer(pOp, &Clip::getMax, &Clip::setMax);
+  transfer(pOp, &Clip::getMin, &Clip::setMin);
+}
+
+
+void ComputeArchive::visit(Concat& pOp) {
+  transfer(pOp, &Concat::getAxis, &Concat::setAxis);
+}
+
+
+void ComputeArchive::visit(Conv& pOp) {
+  transfer(pOp, &Conv::getAutoPad, &Conv::setAutoPad);
+  transfer(pOp, &Conv::getDilations, &Conv::setDilations);
+  transfer(pOp, &Conv::getGroup, &Conv::setGroup);
+  transfer(pOp, &Conv::getKernelShape, &Conv::setKernelShape);
+  transfer(pOp, &Conv::getPads, &Conv::setPads);
+  transfer(pOp, &Conv::getStrides, &Conv::setStrides);
+}
+
+
+void ComputeArchive::visit(ConvTranspose& pOp) {
+  transfer(pOp, &ConvTranspose::getAutoPad, &ConvTranspose::setAutoPad);
+  transfer(pOp, &ConvTranspose::getDilations, &ConvTranspose::setDilations);
+  transfer(pOp, &ConvTranspose::getGroup, &ConvTranspose::setGroup);
+  transfer(pOp, &ConvTranspose::getKernelShape, &ConvTranspose::setKernelShape);
+  transfer(pOp, &ConvTranspose::getOutputPadding, &ConvTranspose::setOutputPadding);
+  transfer(pOp, &ConvTranspose::getOutputShape, &ConvTranspose::setOutputShape);
+  transfer(pOp, &ConvTranspose::getPads, &ConvTranspose::setPads);
+  transfer(pOp, &ConvTranspose::getStrides, &ConvTranspose::setStrides);
+}
+
+
+void ComputeArchive::visit(Cos& pOp) {
+}
+
+
+void ComputeArchive::visit(DepthToSpace& pOp) {
+  transfer(pOp, &DepthToSpace::getBlocksize, &DepthToSpace::setBlocksize);
+}
+
+
+void ComputeArchive::visit(Div& pOp) {
+}
+
+
+void ComputeArchive::visit(Dropout& pOp) {
+  transfer(pOp, &Dropout::getRatio, &Dropout::setRatio);
+}
+
+
+void ComputeArchive::visit(Elu& pOp) {
+  transfer(pOp, &Elu::getAlpha, &Elu::setAlpha);
+}
+
+
+void ComputeArchive::visit(Equal& pOp) {
+}
+
+
+void ComputeArchive::visit(Exp& pOp) {
+}
+
+
+void ComputeArchive::visit(Expand& pOp) {
+}
+
+
+void ComputeArchive::visit(Flatten& pOp) {
+  transfer(pOp, &Flatten::getAxis, &Flatten::setAxis);
+}
+
+
+void ComputeArchive::visit(Floor& pOp) {
+}
+
+
+void ComputeArchive::visit(GRU& pOp) {
+  transfer(pOp, &GRU::getActivationAlpha, &GRU::setActivationAlpha);
+  transfer(pOp, &GRU::getActivationBeta, &GRU::setActivationBeta);
+  transfer(pOp, &GRU::getActivations, &GRU::setActivations);
+  transfer(pOp, &GRU::getClip, &GRU::setClip);
+  transfer(pOp, &GRU::getDirection, &GRU::setDirection);
+  transfer(pOp, &GRU::getHiddenSize, &GRU::setHiddenSize);
+  transfer(pOp, &GRU::getLinearBeforeReset, &GRU::setLinearBeforeReset);
+}
+
+
+void ComputeArchive::visit(Gather& pOp) {
+  transfer(pOp, &Gather::getAxis, &Gather::setAxis);
+}
+
+
+void ComputeArchive::visit(Gemm& pOp) {
+  transfer(pOp, &Gemm::getAlpha, &Gemm::setAlpha);
+  transfer(pOp, &Gemm::getBeta, &Gemm::setBeta);
+  transfer(pOp, &Gemm::getTransA, &Gemm::setTransA);
+  transfer(pOp, &Gemm::getTransB, &Gemm::setTransB);
+}
+
+
+void ComputeArchive::visit(GlobalAveragePool& pOp) {
+}
+
+
+void ComputeArchive::visit(GlobalLpPool& pOp) {
+  transfer(pOp, &GlobalLpPool::getP, &GlobalLpPool::setP);
+}
+
+
+void ComputeArchive::visit(GlobalMaxPool& pOp) {
+}
+
+
+void ComputeArchive::visit(Greater& pOp) {
+}
+
+
+void ComputeArchive::visit(HardSigmoid& pOp) {
+  transfer(pOp, &HardSigmoid::getAlpha, &HardSigmoid::setAlpha);
+  transfer(pOp, &HardSigmoid::getBeta, &HardSigmoid::setBeta);
+}
+
+
+void ComputeArchive::visit(Hardmax& pOp) {
+  transfer(pOp, &Hardmax::getAxis, &Hardmax::setAxis);
+}
+
+
+void ComputeArchive::visit(Identity& pOp) {
+}
+
+
+void ComputeArchive::visit(InstanceNormalization& pOp) {
+  transfer(pOp, &InstanceNormalization::getEpsilon, &InstanceNormalization::setEpsilon);
+}
+
+
+void ComputeArchive::visit(LRN& pOp) {
+  transfer(pOp, &LRN::getAlpha, &LRN::setAlpha);
+  transfer(pOp, &LRN::getBeta, &LRN::setBeta);
+  transfer(pOp, &LRN::getBias, &LRN::setBias);
+  transfer(pOp, &LRN::getSize, &LRN::setSize);
+}
+
+
+void ComputeArchive::visit(LSTM& pOp) {
+  transfer(pOp, &LSTM::getActivationAlpha, &LSTM::setActivationAlpha);
+  transfer(pOp, &LSTM::getActivationBeta, &LSTM::setActivationBeta);
+  transfer(pOp, &LSTM::getActivations, &LSTM::setActivations);
+  transfer(pOp, &LSTM::getClip, &LSTM::setClip);
+  transfer(pOp, &LSTM::getDirection, &LSTM::setDirection);
+  transfer(pOp, &LSTM::getHiddenSize, &LSTM::setHiddenSize);
+  transfer(pOp, &LSTM::getInputForget, &LSTM::setInputForget);
+}
+
+
+void ComputeArchive::visit(LeakyRelu& pOp) {
+  transfer(pOp, &LeakyRelu::getAlpha, &LeakyRelu::setAlpha);
+}
+
+
+void ComputeArchive::visit(Less& pOp) {
+}
+
+
+void ComputeArchive::visit(Log& pOp) {
+}
+
+
+void ComputeArchive::visit(LogSoftmax& pOp) {
+  transfer(pOp, &LogSoftmax::getAxis, &LogSoftmax::setAxis);
+}
+
+
+void ComputeArchive::visit(LpNormalization& pOp) {
+  transfer(pOp, &LpNormalization::getAxis, &LpNormalization::setAxis);
+  transfer(pOp, &LpNormalization::getP, &LpNormalization::setP);
+}
+
+
+void ComputeArchive::visit(LpPool& pOp) {
+  transfer(pOp, &LpPool::getAutoPad, &LpPool::setAutoPad);
+  transfer(pOp, &LpPool::getKernelShape, &LpPool::setKernelShape);
+  transfer(pOp, &LpPool::getP, &LpPool::setP);
+  transfer(pOp, &LpPool::getPads, &LpPool::setPads);
+  transfer(pOp, &LpPool::getStrides, &LpPool::setStrides);
+}
+
+
+void ComputeArchive::visit(MatMul& pOp) {
+}
+
+
+void ComputeArchive::visit(Max& pOp) {
+}
+
+
+void ComputeArchive::visit(MaxPool& pOp) {
+  transfer(pOp, &MaxPool::getAutoPad, &MaxPool::setAutoPad);
+  transfer(pOp, &MaxPool::getKernelShape, &MaxPool::setKernelShape);
+  transfer(pOp, &MaxPool::getPads, &MaxPool::setPads);
+  transfer(pOp, &MaxPool::getStorageOrder, &MaxPool::setStorageOrder);
+  transfer(pOp, &MaxPool::getStrides, &MaxPool::setStrides);
+}
+
+
+void ComputeArchive::visit(MaxRoiPool& pOp) {
+  transfer(pOp, &MaxRoiPool::getPooledShape, &MaxRoiPool::setPooledShape);
+  transfer(pOp, &MaxRoiPool::getSpatialScale, &MaxRoiPool::setSpatialScale);
+}
+
+
+void ComputeArchive::visit(Mean& pOp) {
+}
+
+
+void ComputeArchive::visit(Min& pOp) {
+}
+
+
+void ComputeArchive::visit(Mul& pOp) {
+}
+
+
+void ComputeArchive::visit(Multinomial& pOp) {
+  transfer(pOp, &Multinomial::getDtype, &Multinomial::setDtype);
+  transfer(pOp, &Multinomial::getSampleSize, &Multinomial::setSampleSize);
+  transfer(pOp, &Multinomial::getSeed, &Multinomial::setSeed);
+}
+
+
+void ComputeArchive::visit(Neg& pOp) {
+}
+
+
+void ComputeArchive::visit(Not& pOp) {
+}
+
+
+void ComputeArchive::visit(Or& pOp) {
+}
+
+
+void ComputeArchive::visit(PRelu& pOp) {
+}
+
+
+void ComputeArchive::visit(Pad& pOp) {
+  transfer(pOp, &Pad::getMode, &Pad::setMode);
+  transfer(pOp, &Pad::getPads, &Pad::setPads);
+  transfer(pOp, &Pad::getValue, &Pad::setValue);
+}
+
+
+void ComputeArchive::visit(Pow& pOp) {
+}
+
+
+void ComputeArchive::visit(RNN& pOp) {
+  transfer(pOp, &RNN::getActivationAlpha, &RNN::setActivationAlpha);
+  transfer(pOp, &RNN::getActivationBeta, &RNN::setActivationBeta);
+  transfer(pOp, &RNN::getActivations, &RNN::setActivations);
+  transfer(pOp, &RNN::getClip, &RNN::setClip);
+  transfer(pOp, &RNN::getDirection, &RNN::setDirection);
+  transfer(pOp, &RNN::getHiddenSize, &RNN::setHiddenSize);
+}
+
+
+void ComputeArchive::visit(RandomNormal& pOp) {
+  transfer(pOp, &RandomNormal::getDtype, &RandomNormal::setDtype);
+  transfer(pOp, &RandomNormal::getMean, &RandomNormal::setMean);
+  transfer(pOp, &RandomNormal::getScale, &RandomNormal::setScale);
+  transfer(pOp, &RandomNormal::getSeed, &RandomNormal::setSeed);
+  transfer(pOp, &RandomNormal::getShape, &RandomNormal::setShape);
+}
+
+
+void ComputeArchive::visit(RandomNormalLike& pOp) {
+  transfer(pOp, &RandomNormalLike::getDtype, &RandomNormalLike::setDtype);
+  transfer(pOp, &RandomNormalLike::getMean, &RandomNormalLike::setMean);
+  transfer(pOp, &RandomNormalLike::getScale, &RandomNormalLike::setScale);
+  transfer(pOp, &RandomNormalLike::getSeed, &RandomNormalLike::setSeed);
+}
+
+
+void ComputeArchive::visit(RandomUniform& pOp) {
+  transfer(pOp, &RandomUniform::getDtype, &RandomUniform::setDtype);
+  transfer(pOp, &RandomUniform::getHigh, &RandomUniform::setHigh);
+  transfer(pOp, &RandomUniform::getLow, &RandomUniform::setLow);
+  transfer(pOp, &RandomUniform::getSeed, &RandomUniform::setSeed);
+  transfer(pOp, &RandomUniform::getShape, &RandomUniform::setShape);
+}
+
+
+void ComputeArchive::visit(RandomUniformLike& pOp) {
+  transfer(pOp, &RandomUniformLike::getDtype, &RandomUniformLike::setDtype);
+  transfer(pOp, &RandomUniformLike::getHigh, &RandomUniformLike::setHigh);
+  transfer(pOp, &RandomUniformLike::getLow, &RandomUniformLike::setLow);
+  transfer(pOp, &RandomUniformLike::getSeed, &RandomUniformLike::setSeed);
+}
+
+
+void ComputeArchive::visit(Reciprocal& pOp) {
+}
+
+
+void ComputeArchive::visit(ReduceL1& pOp) {
+  transfer(pOp, &ReduceL1::getAxes, &ReduceL1::setAxes);
+  transfer(pOp, &ReduceL1::getKeepdims, &ReduceL1::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceL2& pOp) {
+  transfer(pOp, &ReduceL2::getAxes, &ReduceL2::setAxes);
+  transfer(pOp, &ReduceL2::getKeepdims, &ReduceL2::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceLogSum& pOp) {
+  transfer(pOp, &ReduceLogSum::getAxes, &ReduceLogSum::setAxes);
+  transfer(pOp, &ReduceLogSum::getKeepdims, &ReduceLogSum::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceLogSumExp& pOp) {
+  transfer(pOp, &ReduceLogSumExp::getAxes, &ReduceLogSumExp::setAxes);
+  transfer(pOp, &ReduceLogSumExp::getKeepdims, &ReduceLogSumExp::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceMax& pOp) {
+  transfer(pOp, &ReduceMax::getAxes, &ReduceMax::setAxes);
+  transfer(pOp, &ReduceMax::getKeepdims, &ReduceMax::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceMean& pOp) {
+  transfer(pOp, &ReduceMean::getAxes, &ReduceMean::setAxes);
+  transfer(pOp, &ReduceMean::getKeepdims, &ReduceMean::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceMin& pOp) {
+  transfer(pOp, &ReduceMin::getAxes, &ReduceMin::setAxes);
+  transfer(pOp, &ReduceMin::getKeepdims, &ReduceMin::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceProd& pOp) {
+  transfer(pOp, &ReduceProd::getAxes, &ReduceProd::setAxes);
+  transfer(pOp, &ReduceProd::getKeepdims, &ReduceProd::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceSum& pOp) {
+  transfer(pOp, &ReduceSum::getAxes, &ReduceSum::setAxes);
+  transfer(pOp, &ReduceSum::getKeepdims, &ReduceSum::setKeepdims);
+}
+
+
+void ComputeArchive::visit(ReduceSumSquare& pOp) {
+  transfer(pOp, &ReduceSumSquare::getAxes, &ReduceSumSquare::setAxes);
+  transfer(pOp, &ReduceSumSquare::getKeepdims, &ReduceSumSquare::setKeepdims);
+}
+
+
+void ComputeArchive::visit(Relu& pOp) {
+}
+
+
+void ComputeArchive::visit(Reshape& pOp) {
+}
+
+
+void ComputeArchive::visit(Selu& pOp) {
+  transfer(pOp, &Selu::getAlpha, &Selu::setAlpha);
+  transfer(pOp, &Selu::getGamma, &Selu::setGamma);
+}
+
+
+void ComputeArchive::visit(Shape& pOp) {
+}
+
+
+void ComputeArchive::visit(Sigmoid& pOp) {
+}
+
+
+void ComputeArchive::visit(Sin& pOp) {
+}
+
+
+void ComputeArchive::visit(Size& pOp) {
+}
+
+
+void ComputeArchive::visit(Slice& pOp) {
+  transfer(pOp, &Slice::getAxes, &Slice::setAxes);
+  transfer(pOp, &Slice::getEnds, &Slice::setEnds);
+  transfer(pOp, &Slice::getStarts, &Slice::setStarts);
+}
+
+
+void ComputeArchive::visit(Softmax& pOp) {
+  transfer(pOp, &Softmax::getAxis, &Softmax::setAxis);
+}
+
+
+void ComputeArchive::visit(Softplus& pOp) {
+}
+
+
+void ComputeArchive::visit(Softsign& pOp) {
+}
+
+
+void ComputeArchive::visit(SpaceToDepth& pOp) {
+  transfer(pOp, &SpaceToDepth::getBlocksize, &SpaceToDepth::setBlocksize);
+}
+
+
+void ComputeArchive::visit(Split& pOp) {
+  transfer(pOp, &Split::getAxis, &Split::setAxis);
+  transfer(pOp, &Split::getSplit, &Split::setSplit);
+}
+
+
+void ComputeArchive::visit(Sqrt& pOp) {
+}
+
+
+void ComputeArchive::visit(Squeeze& pOp) {
+  transfer(pOp, &Squeeze::getAxes, &Squeeze::setAxes);
+}
+
+
+void ComputeArchive::visit(Sub& pOp) {
+}
+
+
+void ComputeArchive::visit(Sum& pOp) {
+}
+
+
+void ComputeArchive::visit(Tan& pOp) {
+}
+
+
+void ComputeArchive::visit(Tanh& pOp) {
+}
+
+
+void ComputeArchive::visit(Tile& pOp) {
+}
+
+
+void ComputeArchive::visit(TopK& pOp) {
+  transfer(pOp, &TopK::getAxis, &TopK::setAxis);
+  transfer(pOp, &TopK::getK, &TopK::setK);
+}
+
+
+void ComputeArchive::visit(Transpose& pOp) {
+  transfer(pOp, &Transpose::getPerm, &Transpose::setPerm);
+}
+
+
+void ComputeArchive::visit(Unsqueeze& pOp) {
+  transfer(pOp, &Unsqueeze::getAxes, &Unsqueeze::setAxes);
+}
+
+
+void ComputeArchive::visit(Upsample& pOp) {
+  transfer(pOp, &Upsample::getMode, &Upsample::setMode);
+  transfer(pOp, &Upsample::getScales, &Upsample::setScales);
+}
+
+
+void ComputeArchive::visit(Xor& pOp) {
+}
+
+
+void ComputeArchive::visit(ATen& pOp) {
+}
+
+
+void ComputeArchive::visit(Affine& pOp) {
+  transfer(pOp, &Affine::getAlpha, &Affine::setAlpha);
+  transfer(pOp, &Affine::getBeta, &Affine::setBeta);
+}
+
+
+void ComputeArchive::visit(ConstantFill& pOp) {
+  transfer(pOp, &ConstantFill::getDtype, &ConstantFill::setDtype);
+  transfer(pOp, &ConstantFill::getExtraShape, &ConstantFill::setExtraShape);
+  transfer(pOp, &ConstantFill::getInputAsShape, &ConstantFill::setInputAsShape);
+  transfer(pOp, &ConstantFill::getShape, &ConstantFill::setShape);
+  transfer(pOp, &ConstantFill::getValue, &ConstantFill::setValue);
+}
+
+
+void ComputeArchive::visit(Crop& pOp) {
+  transfer(pOp, &Crop::getBorder, &Crop::setBorder);
+  transfer(pOp, &Crop::getScale, &Crop::setScale);
+}
+
+
+void ComputeArchive::visit(GRUUnit& pOp) {
+  transfer(pOp, &GRUUnit::getDropStates, &GRUUnit::setDropStates);
+}
+
+
+void ComputeArchive::visit(GivenTensorFill& pOp) {
+  transfer(pOp, &GivenTensorFill::getExtraShape, &GivenTensorFill::setExtraShape);
+  transfer(pOp, &GivenTensorFill::getInputAsShape, &GivenTensorFill::setInputAsShape);
+  transfer(pOp, &GivenTensorFill::getShape, &GivenTensorFill::setShape);
+  transfer(pOp, &GivenTensorFill::getValues, &GivenTensorFill::setValues);
+}
+
+
+void ComputeArchive::visit(ImageScaler& pOp) {
+  transfer(pOp, &ImageScaler::getBias, &ImageScaler::setBias);
+  transfer(pOp, &ImageScaler::getScale, &ImageScaler::setScale);
+}
+
+
+void ComputeArchive::visit(MeanVarianceNormalization& pOp) {
+  transfer(pOp, &MeanVarianceNormalization::getAcrossChannels, &MeanVarianceNormalization::setAcrossChannels);
+  transfer(pOp, &MeanVarianceNormalization::getNormalizeVariance, &MeanVarianceNormalization::setNormalizeVariance);
+}
+
+
+void ComputeArchive::visit(ParametricSoftplus& pOp) {
+  transfer(pOp, &ParametricSoftplus::getAlpha, &ParametricSoftplus::setAlpha);
+  transfer(pOp, &ParametricSoftplus::getBeta, &ParametricSoftplus::setBeta);
+}
+
+
+void ComputeArchive::visit(Scale& pOp) {
+  transfer(pOp, &Scale::getScale, &Scale::setScale);
+}
+
+
+void ComputeArchive::visit(ScaledTanh& pOp) {
+  transfer(pOp, &ScaledTanh::getAlpha, &ScaledTanh::setAlpha);
+  transfer(pOp, &ScaledTanh::getBeta, &ScaledTanh::setBeta);
+}
+
+
+void ComputeArchive::visit(ThresholdedRelu& pOp) {
+  transfer(pOp, &ThresholdedRelu::getAlpha, &ThresholdedRelu::setAlpha);
+}
+
@@ -35,6 +35,23 @@ bool ComputeGraph::addValueToModule(Value* pValue)
   return m_Module.addValue(pValue);
 }
 
+void ComputeGraph::reorder(const std::vector<Node*>& pOrder)
+{
+  assert(pOrder.size() == m_NodeList.size() &&
+         "reorder must keep every operator");
+  Node* prev = nullptr;
+  for (Node* node : pOrder) {
+    node->prev = prev;
+    node->next = nullptr;
+    if (nullptr != prev)
+      prev->next = node;
+    else
+      m_pNodeHead = node;
+    prev = node;
+  }
+  m_pNodeRear = prev;
+}
+
 void ComputeGraph::erase(ComputeOperator& pNode)
 {
   // 1. connect previous node and next node.
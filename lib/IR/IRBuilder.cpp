@@ -7,7 +7,10 @@
 //===----------------------------------------------------------------------===//
 #include <onnc/IR/Compute/Tensor.h>
 #include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Module.h>
 #include <onnc/Config/ONNX.h>
+#include <cstdint>
+#include <type_traits>
 
 using namespace onnc;
 
@@ -247,11 +250,32 @@ bool IRBuilder::FinalizeTensorGraph(const StringList& pOutputs)
   return true;
 }
 
+/// Refer @ref pTensor to @ref pData, its external data kept mapped by the
+/// module. Values that are not stored as their own type or are misaligned
+/// are copied.
+template<typename NativeType, typename TensorType>
+static void SetExternalValues(TensorType& pTensor, StringRef pData)
+{
+  typedef typename TensorType::ValueList::value_type ValueType;
+  const size_t numElems = pData.size() / sizeof(NativeType);
+  const NativeType* d = reinterpret_cast<const NativeType*>(pData.data());
+  if (std::is_same<ValueType, NativeType>::value &&
+      std::is_arithmetic<ValueType>::value &&
+      0 == reinterpret_cast<uintptr_t>(d) % alignof(NativeType)) {
+    pTensor.setExternalValues(reinterpret_cast<const ValueType*>(d), numElems);
+    return;
+  }
+  pTensor.getValues().assign(d, d + numElems);
+}
+
 #define CREATE_VAL_DATA(result, CG, tensor, ONNCType, NativeType, accessor) \
 { \
   auto t = CG.addValue<ONNCType>(name); \
-  /* copy tensor init data. */ \
-  if (tensor.is_raw_data()) { \
+  StringRef external = CG.getModule().getExternalData(name); \
+  /* refer to external data, or copy tensor init data. */ \
+  if (!external.empty()) \
+    SetExternalValues<NativeType>(*t, external); \
+  else if (tensor.is_raw_data()) { \
     const size_t numElems = tensor.raw().size() / sizeof(NativeType); \
     NativeType* d = (NativeType*)tensor.raw().c_str(); \
     t->getValues().resize(numElems); \
@@ -311,7 +335,12 @@ Tensor* IRBuilder::CreateComputeTensor(ComputeGraph& pCG,
     break;
   }
   case onnc::Value::kFloat16: {
-    CREATE_VAL_DATA(result, pCG, pTensor, Float16Tensor, float, floats);
+    // The bits of each half are stored in an int32 of the proto.
+    CREATE_VAL_DATA(result, pCG, pTensor, Float16Tensor, uint16_t, int32s);
+    break;
+  }
+  case onnc::Value::kBFloat16: {
+    CREATE_VAL_DATA(result, pCG, pTensor, BFloat16Tensor, uint16_t, int32s);
     break;
   }
   case onnc::Value::kString: {
@@ -389,6 +418,10 @@ Tensor* IRBuilder::CreateComputeTensor(ComputeGraph& pCG, const xValue& pValue)
     result = pCG.addValue<onnc::Float16Tensor>(pValue.uniqueName());
     break;
   }
+  case onnc::Value::kBFloat16: {
+    result = pCG.addValue<onnc::BFloat16Tensor>(pValue.uniqueName());
+    break;
+  }
   case onnc::Value::kString: {
     result = pCG.addValue<onnc::StringTensor>(pValue.uniqueName());
     break;
@@ -8,6 +8,7 @@
 #include <onnc/IR/Module.h>
 #include <onnc/Diagnostic/MsgHandling.h>
 #include <onnc/Support/IOStream.h>
+#include <onnc/Support/MemoryMap.h>
 #include <onnc/Config/ONNX.h>
 
 using namespace onnc;
@@ -117,6 +118,8 @@ Module::Module()
     m_OnnxInfo(),
     m_OnnxSetId(),
     m_OnnxMetaData(),
+    m_ExternalData(),
+    m_MappedFiles(),
     m_pRootComputeGraph(nullptr),
     m_ComputeGraphs(),
     m_TimeStep(0) {
@@ -128,6 +131,8 @@ Module::Module(std::unique_ptr<xGraph> pGraph)
     m_OnnxInfo(),
     m_OnnxSetId(),
     m_OnnxMetaData(),
+    m_ExternalData(),
+    m_MappedFiles(),
     m_pRootComputeGraph(nullptr),
     m_ComputeGraphs(),
     m_TimeStep(0) {
@@ -155,6 +160,37 @@ Module::~Module()
   m_Values.clear();
 }
 
+const MemoryMap* Module::mapFile(const Path& pFile)
+{
+  std::unique_ptr<MemoryMap>& map = m_MappedFiles[pFile.native()];
+  if (!map)
+    map = MemoryMap::mapFile(pFile.native());
+  return map.get();
+}
+
+const MemoryMap* Module::findMappedFile(StringRef pData, Path& pFile,
+                                        uint64_t& pOffset) const
+{
+  for (const auto& file : m_MappedFiles) {
+    const MemoryMap* map = file.second.get();
+    if (nullptr != map && map->start() <= pData.data() &&
+        pData.data() + pData.size() <= map->end()) {
+      pFile = Path(file.first);
+      pOffset = pData.data() - map->start();
+      return map;
+    }
+  }
+  return nullptr;
+}
+
+StringRef Module::getExternalData(const std::string& pName) const
+{
+  ExternalDataMap::const_iterator data = m_ExternalData.find(pName);
+  if (m_ExternalData.end() == data)
+    return StringRef();
+  return data->second;
+}
+
 Module& Module::delegate(std::unique_ptr<xGraph> pGraph)
 {
   if (m_RootTensorGraph)
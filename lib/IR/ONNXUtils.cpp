@@ -8,9 +8,63 @@
 #include <onnc/IR/Module.h>
 #include <onnc/IR/ONNXUtils.h>
 #include <onnc/Config/ONNX.h>
+#include <memory>
+#include <string>
+#include <vector>
 
 using namespace onnc;
 
+//===----------------------------------------------------------------------===//
+// Non-member functions
+//===----------------------------------------------------------------------===//
+namespace {
+
+/// Field numbers of the length-delimited fields SerializeToOstream writes.
+enum FieldNumber {
+  kTensorRawData    = 9, ///< TensorProto.raw_data
+  kGraphInitializer = 5, ///< GraphProto.initializer
+  kModelGraph       = 7  ///< ModelProto.graph
+};
+
+/// The largest payload shape inference reads: shapes, axes, pads and scales.
+const size_t kMaxShapePayload = 1024;
+
+/// @return true if the initializer is a vector small enough to be a shape,
+///         axes, pads or scales input.
+bool IsShapePayload(const xTensorProto& pTensor, StringRef pData)
+{
+  return pTensor.dims_size() <= 1 && pData.size() <= kMaxShapePayload;
+}
+
+unsigned VarintSize(uint64_t pValue)
+{
+  unsigned size = 1;
+  while (pValue >= 0x80) {
+    pValue >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+/// @return The size of a length-delimited field of @ref pLength bytes.
+uint64_t FieldSize(uint64_t pLength)
+{
+  return 1 + VarintSize(pLength) + pLength;
+}
+
+/// Write the key and the length of a length-delimited field.
+void WriteTag(std::ostream& pOS, FieldNumber pNumber, uint64_t pLength)
+{
+  pOS.put(static_cast<char>(pNumber << 3 | 2));
+  while (pLength >= 0x80) {
+    pOS.put(static_cast<char>(pLength | 0x80));
+    pLength >>= 7;
+  }
+  pOS.put(static_cast<char>(pLength));
+}
+
+} // anonymous namespace
+
 //===----------------------------------------------------------------------===//
 // Procedures
 //===----------------------------------------------------------------------===//
@@ -21,7 +75,8 @@ void onnc::SerializeToString(std::string &output, const Module &pModule)
   modelProto.SerializeToString(&output);
 }
 
-void onnc::ExportModelProto(xProto &pModelProto, const Module &pModule)
+void onnc::ExportModelProto(xProto &pModelProto, const Module &pModule,
+                            ExportedPayloads pPayloads)
 {
   pModelProto.set_ir_version(pModule.getOnnxInfo().getIRVersion());
   pModelProto.set_producer_name(pModule.getOnnxInfo().getProducerName());
@@ -41,6 +96,90 @@ void onnc::ExportModelProto(xProto &pModelProto, const Module &pModule)
     metadata_props->set_key(metaData.first);
     metadata_props->set_value(metaData.second);
   }
+
+  // The tensor graph does not hold the payloads of initializers kept outside
+  // of it, so copy them in for the consumers of the proto. The others are
+  // marked external, with no location.
+  xGraphProto* graph = pModelProto.mutable_graph();
+  for (int i = 0; i < graph->initializer_size(); ++i) {
+    xTensorProto* tensor = graph->mutable_initializer(i);
+    StringRef data = pModule.getExternalData(tensor->name());
+    if (data.empty())
+      continue;
+    tensor->clear_data_location();
+    tensor->clear_external_data();
+    if (kShapePayloads == pPayloads && !IsShapePayload(*tensor, data))
+      tensor->set_data_location(xTensorProto::EXTERNAL);
+    else
+      tensor->set_raw_data(data.data(), data.size());
+  }
+}
+
+bool onnc::SerializeToOstream(std::ostream &pOS, const Module &pModule)
+{
+  xProto modelProto;
+  ExportModelProto(modelProto, pModule, kShapePayloads);
+
+  // Serialize the initializers apart from the graph, so that their external
+  // payloads can be appended as raw_data without a copy.
+  std::unique_ptr<xGraphProto> graph(modelProto.release_graph());
+  std::vector<std::string> tensors(graph->initializer_size());
+  std::vector<StringRef> payloads(graph->initializer_size());
+  for (int i = 0; i < graph->initializer_size(); ++i) {
+    xTensorProto* tensor = graph->mutable_initializer(i);
+    if (tensor->has_data_location() &&
+        xTensorProto::EXTERNAL == tensor->data_location()) {
+      payloads[i] = pModule.getExternalData(tensor->name());
+      tensor->clear_data_location();
+      tensor->clear_external_data();
+    }
+    tensor->SerializeToString(&tensors[i]);
+  }
+  graph->clear_initializer();
+
+  std::string head, body;
+  modelProto.SerializeToString(&head);
+  graph->SerializeToString(&body);
+
+  uint64_t graphSize = body.size();
+  std::vector<uint64_t> tensorSizes(tensors.size());
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    tensorSizes[i] = tensors[i].size();
+    if (!payloads[i].empty())
+      tensorSizes[i] += FieldSize(payloads[i].size());
+    graphSize += FieldSize(tensorSizes[i]);
+  }
+
+  pOS.write(head.data(), head.size());
+  WriteTag(pOS, kModelGraph, graphSize);
+  pOS.write(body.data(), body.size());
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    WriteTag(pOS, kGraphInitializer, tensorSizes[i]);
+    pOS.write(tensors[i].data(), tensors[i].size());
+    if (payloads[i].empty())
+      continue;
+    WriteTag(pOS, kTensorRawData, payloads[i].size());
+    pOS.write(payloads[i].data(), payloads[i].size());
+  }
+  return pOS.good();
+}
+
+void onnc::ReleaseExternalData(xProto &pModelProto, Module &pModule)
+{
+  xGraphProto* graph = pModelProto.mutable_graph();
+  for (int i = 0; i < graph->initializer_size(); ++i) {
+    xTensorProto* tensor = graph->mutable_initializer(i);
+    StringRef data = pModule.getExternalData(tensor->name());
+    if (data.empty())
+      continue;
+    if (tensor->has_raw_data() && data != StringRef(tensor->raw_data())) {
+      // rewritten, e.g. by the ONNX optimizer
+      pModule.eraseExternalData(tensor->name());
+      continue;
+    }
+    tensor->clear_raw_data();
+    tensor->set_data_location(xTensorProto::EXTERNAL);
+  }
 }
 
 Module* onnc::CreateModule(const xProto &pModelProto)
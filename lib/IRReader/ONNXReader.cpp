@@ -10,18 +10,122 @@
 #include <onnc/Diagnostic/MsgHandling.h>
 #include <onnc/IR/ONNXUtils.h>
 #include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Module.h>
+#include <onnc/Support/MemoryMap.h>
+#include <onnc/Support/FileSystem.h>
 #include <onnc/Config/ONNX.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <climits>
+#include <cstdlib>
 
 using namespace onnc;
 
 //===----------------------------------------------------------------------===//
 // Non-member functions
 //===----------------------------------------------------------------------===//
+/// Resolve the external data @ref pLocation against the model directory
+/// @ref pDir into @ref pFile. Like the ONNX checker, reject absolute
+/// locations, `..` components and anything that resolves, through symbolic
+/// links, to a file outside @ref pDir.
+static bool
+ResolveExternalLocation(const std::string& pLocation, const Path& pDir,
+                        Path& pFile)
+{
+  pFile.assign(pDir.empty() ? Path(".") : pDir);
+  pFile.append(pLocation);
+  if (pLocation.empty() || Path(pLocation).isFromRoot() ||
+      '\\' == pLocation.front())
+    return false;
+
+  std::string::size_type begin = 0;
+  while (begin <= pLocation.size()) {
+    std::string::size_type end = pLocation.find_first_of("/\\", begin);
+    if (std::string::npos == end)
+      end = pLocation.size();
+    if (0 == pLocation.compare(begin, end - begin, ".."))
+      return false;
+    begin = end + 1;
+  }
+
+  // A missing file is reported when it's mapped.
+  Path dir, file;
+  if (!onnc::realpath(dir, pDir.empty() ? Path(".") : pDir) ||
+      !onnc::realpath(file, pFile))
+    return true;
+  const std::string& prefix = dir.native();
+  const std::string& target = file.native();
+  return target.size() > prefix.size() &&
+         0 == target.compare(0, prefix.size(), prefix) &&
+         (Path::separator == prefix.back() ||
+          Path::separator == target[prefix.size()]);
+}
+
+/// Map the initializers stored outside the model file, as described by ONNX
+/// external data. Locations are relative to @ref pDir.
+static bool
+LoadExternalData(const xProto& pModel, const Path& pDir, Module& pModule)
+{
+  const xGraphProto& graph = pModel.graph();
+  for (int i = 0; i < graph.initializer_size(); ++i) {
+    const xTensorProto& tensor = graph.initializer(i);
+    if (!tensor.has_data_location() ||
+        xTensorProto::EXTERNAL != tensor.data_location())
+      continue;
+    // already mapped by StreamParser
+    if (!pModule.getExternalData(tensor.name()).empty())
+      continue;
+
+    std::string location;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+    bool has_length = false;
+    for (int j = 0; j < tensor.external_data_size(); ++j) {
+      const std::string& key = tensor.external_data(j).key();
+      const std::string& value = tensor.external_data(j).value();
+      if ("location" == key)
+        location = value;
+      else if ("offset" == key)
+        offset = std::strtoull(value.c_str(), nullptr, 10);
+      else if ("length" == key) {
+        length = std::strtoull(value.c_str(), nullptr, 10);
+        has_length = true;
+      }
+    }
+
+    Path file;
+    if (!ResolveExternalLocation(location, pDir, file)) {
+      error(onnx_external_location) << tensor.name() << location;
+      return false;
+    }
+    const MemoryMap* map = pModule.mapFile(file);
+    if (nullptr == map || offset > map->size() ||
+        (has_length && length > map->size() - offset)) {
+      error(onnx_external_data) << tensor.name() << file;
+      return false;
+    }
+    if (!has_length)
+      length = map->size() - offset;
+    pModule.setExternalData(tensor.name(),
+                            StringRef(map->start() + offset, length));
+  }
+  return true;
+}
+
+/// Build @ref pModule from the parsed @ref pModel.
+static bool
+BuildModule(Module& pModule, const xProto& pModel, const Path& pDir)
+{
+  if (!LoadExternalData(pModel, pDir, pModule))
+    return false;
+  IRBuilder builder(pModule);
+  builder.update(pModel);
+  return true;
+}
+
 static inline bool
 DoParse(Module& pModule, ::google::protobuf::io::ZeroCopyInputStream& pStream,
-        int pTotalBytesLimit, int pWarningThreshold)
+        int pTotalBytesLimit, int pWarningThreshold, const Path& pDir)
 {
   ::google::protobuf::io::CodedInputStream coded_input(&pStream);
 
@@ -30,8 +134,231 @@ DoParse(Module& pModule, ::google::protobuf::io::ZeroCopyInputStream& pStream,
   if (!model.ParseFromCodedStream(&coded_input)) {
     return false;
   }
-  IRBuilder builder(pModule);
-  builder.update(model);
+  return BuildModule(pModule, model, pDir);
+}
+
+//===----------------------------------------------------------------------===//
+// StreamParser
+//===----------------------------------------------------------------------===//
+namespace {
+
+/// Walks the wire format of a model mapped in memory. The graph structure is
+/// parsed into messages, but the raw data of initializers is not: it is left
+/// in the mapped file and recorded as external data of the module, so
+/// weights are neither copied nor counted against the total bytes limit.
+/// ExportModelProto puts the payloads back for shape inference and the ONNX
+/// optimizer.
+class StreamParser
+{
+public:
+  StreamParser(Module& pModule, const MemoryMap& pFile, const Path& pFileName,
+               int pTotalBytesLimit, int pWarningThreshold)
+    : m_Module(pModule), m_File(pFile), m_Location(pFileName.filename()),
+      m_TotalBytesLimit(pTotalBytesLimit),
+      m_WarningThreshold(pWarningThreshold) {
+  }
+
+  bool parse(xProto& pModel);
+
+private:
+  // field numbers in onnx.proto
+  enum {
+    kModelGraph = 7,
+    kGraphInitializer = 5,
+    kTensorRawData = 9
+  };
+
+  enum WireType {
+    kVarint = 0,
+    kFixed64 = 1,
+    kLengthDelimited = 2,
+    kFixed32 = 5
+  };
+
+  /// A serialized field. [begin, end) is the whole field, and [payload, end)
+  /// the value of a length-delimited one.
+  struct Field
+  {
+    uint32_t number;
+    uint32_t type;
+    const uint8_t* begin;
+    const uint8_t* payload;
+    const uint8_t* end;
+  };
+
+  static bool readVarint(const uint8_t*& pCur, const uint8_t* pEnd,
+                         uint64_t& pValue);
+
+  /// Read the field at @ref pCur and move @ref pCur to the next one.
+  static bool readField(const uint8_t*& pCur, const uint8_t* pEnd,
+                        Field& pField);
+
+  /// Merge the serialized fields [pBegin, pEnd) into @ref pMessage.
+  bool merge(::google::protobuf::MessageLite& pMessage,
+             const uint8_t* pBegin, const uint8_t* pEnd) const;
+
+  bool parseGraph(const uint8_t* pBegin, const uint8_t* pEnd,
+                  xGraphProto& pGraph);
+
+  bool parseTensor(const uint8_t* pBegin, const uint8_t* pEnd,
+                   xTensorProto& pTensor);
+
+private:
+  Module& m_Module;
+  const MemoryMap& m_File;
+  Path m_Location;
+  int m_TotalBytesLimit;
+  int m_WarningThreshold;
+};
+
+} // anonymous namespace
+
+bool StreamParser::readVarint(const uint8_t*& pCur, const uint8_t* pEnd,
+                              uint64_t& pValue)
+{
+  pValue = 0;
+  for (unsigned int shift = 0; shift < 64; shift += 7) {
+    if (pCur == pEnd)
+      return false;
+    uint8_t byte = *pCur++;
+    pValue |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (0 == (byte & 0x80))
+      return true;
+  }
+  return false;
+}
+
+bool StreamParser::readField(const uint8_t*& pCur, const uint8_t* pEnd,
+                             Field& pField)
+{
+  pField.begin = pCur;
+  pField.payload = nullptr;
+  uint64_t tag, value;
+  if (!readVarint(pCur, pEnd, tag))
+    return false;
+  pField.number = tag >> 3;
+  pField.type = tag & 0x7;
+  switch (pField.type) {
+  case kVarint:
+    if (!readVarint(pCur, pEnd, value))
+      return false;
+    break;
+  case kFixed64:
+    if (pEnd - pCur < 8)
+      return false;
+    pCur += 8;
+    break;
+  case kFixed32:
+    if (pEnd - pCur < 4)
+      return false;
+    pCur += 4;
+    break;
+  case kLengthDelimited:
+    if (!readVarint(pCur, pEnd, value) ||
+        value > static_cast<uint64_t>(pEnd - pCur))
+      return false;
+    pField.payload = pCur;
+    pCur += value;
+    break;
+  default:
+    // groups are not used by ONNX
+    return false;
+  }
+  pField.end = pCur;
+  return true;
+}
+
+bool StreamParser::merge(::google::protobuf::MessageLite& pMessage,
+                         const uint8_t* pBegin, const uint8_t* pEnd) const
+{
+  if (pBegin == pEnd)
+    return true;
+  if (pEnd - pBegin > INT_MAX)
+    return false;
+  ::google::protobuf::io::CodedInputStream input(pBegin, pEnd - pBegin);
+  input.SetTotalBytesLimit(m_TotalBytesLimit, m_WarningThreshold);
+  return pMessage.MergePartialFromCodedStream(&input);
+}
+
+bool StreamParser::parse(xProto& pModel)
+{
+  const uint8_t* begin = reinterpret_cast<const uint8_t*>(m_File.start());
+  const uint8_t* end = reinterpret_cast<const uint8_t*>(m_File.end());
+  // Consecutive fields that are not streamed are merged at once.
+  const uint8_t* run = begin;
+  const uint8_t* cur = begin;
+  Field field;
+  while (cur != end) {
+    if (!readField(cur, end, field))
+      return false;
+    if (kModelGraph == field.number && kLengthDelimited == field.type) {
+      if (!merge(pModel, run, field.begin) ||
+          !parseGraph(field.payload, field.end, *pModel.mutable_graph()))
+        return false;
+      run = field.end;
+    }
+  }
+  return merge(pModel, run, end);
+}
+
+bool StreamParser::parseGraph(const uint8_t* pBegin, const uint8_t* pEnd,
+                              xGraphProto& pGraph)
+{
+  const uint8_t* run = pBegin;
+  const uint8_t* cur = pBegin;
+  Field field;
+  while (cur != pEnd) {
+    if (!readField(cur, pEnd, field))
+      return false;
+    if (kGraphInitializer == field.number && kLengthDelimited == field.type) {
+      if (!merge(pGraph, run, field.begin) ||
+          !parseTensor(field.payload, field.end, *pGraph.add_initializer()))
+        return false;
+      run = field.end;
+    }
+  }
+  return merge(pGraph, run, pEnd);
+}
+
+bool StreamParser::parseTensor(const uint8_t* pBegin, const uint8_t* pEnd,
+                               xTensorProto& pTensor)
+{
+  const uint8_t* run = pBegin;
+  const uint8_t* cur = pBegin;
+  Field raw_data = Field();
+  Field field;
+  while (cur != pEnd) {
+    if (!readField(cur, pEnd, field))
+      return false;
+    if (kTensorRawData == field.number && kLengthDelimited == field.type) {
+      // the last raw_data wins, as in protobuf
+      if (!merge(pTensor, run, field.begin))
+        return false;
+      raw_data = field;
+      run = field.end;
+    }
+  }
+  if (!merge(pTensor, run, pEnd))
+    return false;
+
+  if (raw_data.payload == raw_data.end)
+    return true;
+
+  // Describe the raw data as ONNX external data in the model file itself.
+  const char* data = reinterpret_cast<const char*>(raw_data.payload);
+  const uint64_t offset = data - m_File.start();
+  const uint64_t length = raw_data.end - raw_data.payload;
+  pTensor.set_data_location(xTensorProto::EXTERNAL);
+  auto* entry = pTensor.add_external_data();
+  entry->set_key("location");
+  entry->set_value(m_Location.native());
+  entry = pTensor.add_external_data();
+  entry->set_key("offset");
+  entry->set_value(std::to_string(offset));
+  entry = pTensor.add_external_data();
+  entry->set_key("length");
+  entry->set_value(std::to_string(length));
+  m_Module.setExternalData(pTensor.name(), StringRef(data, length));
   return true;
 }
 
@@ -39,7 +366,8 @@ DoParse(Module& pModule, ::google::protobuf::io::ZeroCopyInputStream& pStream,
 // onnx::Reader
 //===----------------------------------------------------------------------===//
 onnc::onnx::Reader::Reader()
-  : m_TotalBytesLimit(1024LL << 20), m_WarningThreshold(512LL << 20) {
+  : m_TotalBytesLimit(1024LL << 20), m_WarningThreshold(512LL << 20),
+    m_ModelSize(0) {
   // Verify that the version of the library that we linked against is
   // compatible with the version of the headers we compiled against.
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -58,16 +386,35 @@ void onnc::onnx::Reader::ShutdownProtobufLibrary()
 
 SystemError onnc::onnx::Reader::parse(const Path& pFileName, Module& pModule)
 {
+  // Map the model and stream it, so that initializers stay in the file.
+  // External data is located relative to the model file.
+  if (const MemoryMap* file = pModule.mapFile(pFileName)) {
+    m_ModelSize = file->size();
+    xProto model;
+    StreamParser parser(pModule, *file, pFileName,
+                        m_TotalBytesLimit, m_WarningThreshold);
+    if (!parser.parse(model) ||
+        !BuildModule(pModule, model, pFileName.parent())) {
+      error(onnx_cannot_parsed) << pFileName;
+      return SystemError::kUnknownError;
+    }
+    return SystemError::kSuccess;
+  }
+
+  // Files that can not be mapped are read as a stream.
   FileHandle file;
   SystemError err = file.open(pFileName, FileHandle::kReadOnly);
   if (!err.isGood())
     return err;
 
-  err = parse(file.handler(), pModule);
-  if (!err.isGood()) {
+  m_ModelSize = 0;
+  ::google::protobuf::io::FileInputStream input(file.handler());
+  if (!DoParse(pModule, input, m_TotalBytesLimit, m_WarningThreshold,
+               pFileName.parent())) {
     error(onnx_cannot_parsed) << pFileName;
-    return err;
+    return SystemError::kUnknownError;
   }
+  m_ModelSize = input.ByteCount();
 
   err = file.close();
   if (!err.isGood())
@@ -80,7 +427,9 @@ SystemError onnc::onnx::Reader::parse(ConstBuffer pContent, Module& pModule)
 {
   ::google::protobuf::io::ArrayInputStream input(
       (const uint8_t *)pContent.raw(), pContent.size());
-  if (!DoParse(pModule, input, m_TotalBytesLimit, m_WarningThreshold))
+  m_ModelSize = pContent.size();
+  if (!DoParse(pModule, input, m_TotalBytesLimit, m_WarningThreshold,
+               Path()))
     return SystemError::kUnknownError;
   return SystemError::kSuccess;
 }
@@ -88,8 +437,10 @@ SystemError onnc::onnx::Reader::parse(ConstBuffer pContent, Module& pModule)
 SystemError onnc::onnx::Reader::parse(int pFD, Module& pModule)
 {
   ::google::protobuf::io::FileInputStream input(pFD);
-  if (!DoParse(pModule, input, m_TotalBytesLimit, m_WarningThreshold))
+  if (!DoParse(pModule, input, m_TotalBytesLimit, m_WarningThreshold,
+               Path()))
     return SystemError::kUnknownError;
+  m_ModelSize = input.ByteCount();
   return SystemError::kSuccess;
 }
 
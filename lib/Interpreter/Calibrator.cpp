@@ -0,0 +1,116 @@
+//===- Calibrator.cpp -----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Interpreter/Calibrator.h>
+#include <onnc/Interpreter/InferenceSession.h>
+
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/IR/Module.h>
+
+#include <cmath>
+
+using namespace onnc;
+
+namespace {
+
+/// @return The number of elements of pValue, or 0 if it is not a float
+///         tensor.
+size_t FloatSize(const Value* pValue)
+{
+  if (Value::kFloat != pValue->kind())
+    return 0;
+  const Tensor* tensor = static_cast<const Tensor*>(pValue);
+  size_t size = 1;
+  for (unsigned int i = 0; i < tensor->getNumOfDimensions(); ++i)
+    size *= tensor->dimension(i);
+  return size;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// Calibrator
+//===----------------------------------------------------------------------===//
+Calibrator::Calibrator(InferenceSession& pSession)
+  : m_Name(), m_Inputs(), m_Layers(), m_Steps(), m_NumOfRuns(0) {
+  if (const ComputeGraph* cg = pSession.getModule()->getRootComputeGraph())
+    m_Name = cg->name();
+
+  const Interpreter::AddressTable& addresses = pSession.getAddresses();
+  for (unsigned int i = 0; i < pSession.getNumOfInputs(); ++i) {
+    Value* value = pSession.getInput(i);
+    if (size_t size = FloatSize(value)) {
+      const float* data =
+          static_cast<const float*>(pSession.getInputBuffer(i));
+      m_Inputs.push_back(Range{ value, data, size, 0.f });
+    }
+  }
+
+  for (const ExecutionPlan::Step& step : pSession.getPlan().steps()) {
+    ComputeOperator* op = step.op;
+    RangeList outputs;
+    for (unsigned int i = 0; i < op->getNumOfOutputs(); ++i) {
+      Value* value = op->getOutput(i);
+      size_t size = FloatSize(value);
+      auto address = addresses.find(value);
+      if (0 == size || addresses.end() == address)
+        continue;
+      const float* data = static_cast<const float*>(address->second);
+      outputs.push_back(Range{ value, data, size, 0.f });
+    }
+    if (0 < op->getNumOfOutputs())
+      m_Layers.push_back(op->getOutput(0)->getName());
+    else
+      m_Layers.push_back(op->name().str());
+    m_Steps.push_back(outputs);
+  }
+}
+
+void Calibrator::beginRun()
+{
+  ++m_NumOfRuns;
+  for (Range& range : m_Inputs)
+    Update(range);
+}
+
+void Calibrator::record(size_t pIdx)
+{
+  for (Range& range : m_Steps[pIdx])
+    Update(range);
+}
+
+CalibrationTable Calibrator::getTable() const
+{
+  CalibrationTable table;
+  table.setName(m_Name);
+  for (const Range& input : m_Inputs) {
+    table.addLayer(input.value->getName(),
+                   { { input.value->getName(), input.threshold } });
+  }
+  for (size_t i = 0; i < m_Steps.size(); ++i) {
+    CalibrationTable::BlobList blobs;
+    for (const Range& output : m_Steps[i])
+      blobs.push_back({ output.value->getName(), output.threshold });
+    if (!blobs.empty())
+      table.addLayer(m_Layers[i], blobs);
+  }
+  return table;
+}
+
+void Calibrator::Update(Range& pRange)
+{
+  float threshold = pRange.threshold;
+  for (size_t i = 0; i < pRange.size; ++i) {
+    float magnitude = std::fabs(pRange.data[i]);
+    // NaN compares false and is skipped.
+    if (magnitude > threshold)
+      threshold = magnitude;
+  }
+  pRange.threshold = threshold;
+}
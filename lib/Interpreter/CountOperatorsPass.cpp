@@ -5,7 +5,7 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#include "CountOperatorsPass.h"
+#include <onnc/Interpreter/CountOperatorsPass.h>
 
 #include <onnc/IR/ComputeOperator.h>
 #include <onnc/IR/Compute/Initializer.h>
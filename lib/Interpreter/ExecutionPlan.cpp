@@ -0,0 +1,51 @@
+//===- ExecutionPlan.cpp --------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Interpreter/ExecutionPlan.h>
+
+#include <algorithm>
+
+using namespace onnc;
+
+namespace {
+
+// Large enough for the steps and arrays of a few hundred operators.
+const size_t kBlockSize = 64 * 1024;
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// ExecutionPlan
+//===----------------------------------------------------------------------===//
+ExecutionPlan::ExecutionPlan()
+  : m_Steps(), m_Blocks(), m_BlockUsed(0), m_BlockSize(0) {
+}
+
+ExecutionPlan::~ExecutionPlan()
+{
+}
+
+void ExecutionPlan::clear()
+{
+  m_Steps.clear();
+  m_Blocks.clear();
+  m_BlockUsed = 0;
+  m_BlockSize = 0;
+}
+
+void* ExecutionPlan::allocateBytes(size_t pSize, size_t pAlignment)
+{
+  // new char[] is aligned for any fundamental type.
+  size_t offset = (m_BlockUsed + pAlignment - 1) / pAlignment * pAlignment;
+  if (m_Blocks.empty() || offset + pSize > m_BlockSize) {
+    m_BlockSize = std::max(kBlockSize, pSize);
+    m_Blocks.emplace_back(new char[m_BlockSize]);
+    offset = 0;
+  }
+  m_BlockUsed = offset + pSize;
+  return m_Blocks.back().get() + offset;
+}
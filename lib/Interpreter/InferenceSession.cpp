@@ -0,0 +1,471 @@
+//===- InferenceSession.cpp -----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Interpreter/InferenceSession.h>
+
+#include <onnc/Interpreter/CountOperatorsPass.h>
+#include <onnc/Interpreter/InterpreterPass.h>
+#include <onnc/Interpreter/OnnxOptPass.h>
+#include <onnc/Interpreter/Calibrator.h>
+#include <onnc/Interpreter/Profiler.h>
+
+#include <onnc/CodeGen/CompiledModuleCache.h>
+#include <onnc/Core/PassManager.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/ComputeMemOperand.h>
+#include <onnc/IRReader/ONNXReader.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/Timer.h>
+#include <onnc/Target/Target.h>
+#include <onnc/Target/TargetBackend.h>
+#include <onnc/Target/TargetOptions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/onnc-runtime.h>
+#include <onnc/Runtime/internal/parallel.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// Large enough for the widest vector loads of the runtime.
+const size_t kAlignment = 64;
+
+size_t alignUp(size_t pSize)
+{
+  return (pSize + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+size_t sizeOf(Tensor *pTensor)
+{
+  size_t size = sizeof(float);
+  for (auto dim : pTensor->getDimensions())
+    size *= dim;
+  return size;
+}
+
+char *allocate(size_t pSize)
+{
+  // TODO: aligned_alloc after c++17
+  char *memory = NULL;
+  int fail = posix_memalign(reinterpret_cast<void **>(&memory),
+                            kAlignment, std::max(pSize, kAlignment));
+  assert((!fail) && "posix_memalign failed!");
+  return memory;
+}
+
+/// State shared by all steps of one parallel run.
+struct ParallelRun
+{
+  void *context;
+  ONNC_RUNTIME_Task_group group;
+  bool verbose;
+  Profiler *profiler;
+  Calibrator *calibrator;
+  std::mutex print_mutex;
+};
+
+/// Byte range [first, second) of the internal memory.
+typedef std::pair<int64_t, int64_t> MemRange;
+
+bool overlap(const std::vector<MemRange>& pA, const std::vector<MemRange>& pB)
+{
+  for (const MemRange& a : pA)
+    for (const MemRange& b : pB)
+      if (a.first < b.second && b.first < a.second)
+        return true;
+  return false;
+}
+
+/// Widen the values of the integer weight pTensor to floats, which the
+/// kernels compute in.
+template<typename TensorType>
+std::vector<float> widen(Value *pTensor)
+{
+  TensorType *t = static_cast<TensorType *>(pTensor);
+  return std::vector<float>(t->data(), t->data() + t->getNumOfValues());
+}
+
+} // anonymous namespace
+
+/// A step of the plan in the dependency graph of parallel runs.
+struct InferenceSession::Node
+{
+  const ExecutionPlan::Step *step;
+  size_t index; ///< of the step in the plan
+  std::vector<Node *> successors;
+  int predecessors;
+  std::atomic<int> remaining; ///< predecessors not finished in this run
+  ParallelRun *run;
+};
+
+//===----------------------------------------------------------------------===//
+// InferenceSession
+//===----------------------------------------------------------------------===//
+InferenceSession::InferenceSession(unsigned int pNumThreads,
+                                   unsigned int pVerbose)
+  : m_NumThreads(pNumThreads), m_Verbose(pVerbose),
+    m_pOwnedModule(), m_pBackend(), m_pModule(nullptr), m_Interpreter(),
+    m_pContext(nullptr), m_pHeap(nullptr), m_pInputMem(nullptr),
+    m_Inputs(), m_Outputs(), m_Nodes(), m_pProfiler(nullptr),
+    m_pCalibrator(nullptr) {
+}
+
+InferenceSession::~InferenceSession()
+{
+  release();
+}
+
+bool InferenceSession::load(const Path& pModel, const Target& pTarget,
+                            const TargetOptions& pOptions,
+                            bool pOnnxOpt, bool pDryRun)
+{
+  release();
+
+  m_Options = pOptions;
+  m_pBackend.reset(pTarget.createBackend(m_Options));
+
+  // A cached module replaces parsing and the whole compilation.
+  CompiledModuleCache cache(m_CacheDir);
+  std::string key;
+  if (!m_CacheDir.empty())
+    key = CompiledModuleCache::key(pModel, pTarget.name(), m_Options,
+                                   pOnnxOpt ? "onnx-opt" : "");
+  bool hit = false;
+  if (!key.empty()) {
+    m_pOwnedModule.reset(new Module());
+    hit = cache.load(key, pModel, *m_pOwnedModule);
+    if (m_Verbose >= 1) {
+      outs() << "[v1] compiled module cache " << (hit ? "hit: " : "miss: ")
+             << key << std::endl;
+    }
+  }
+
+  PassManager pm;
+  if (!hit) {
+    m_pOwnedModule.reset(new Module());
+    onnc::onnx::Reader reader;
+    Timer::Interval parse = Timer::now();
+    SystemError err = reader.parse(pModel, *m_pOwnedModule);
+    parse = Timer::now() - parse;
+    if (!err.isGood())
+      return false;
+    if (m_Verbose >= 1) {
+      // bytes per ns are GB/s
+      outs() << "[v1] parse: " << reader.getModelSize() << " bytes in "
+             << parse << " ns, "
+             << reader.getModelSize() * 1000.0 / std::max<Timer::Interval>(parse, 1)
+             << " MB/s" << std::endl;
+    }
+
+    if (pOnnxOpt)
+      pm.add(CreateOnnxOptPass());
+    m_pBackend->addTensorSel(pm);
+    m_pBackend->addTensorSched(pm);
+    m_pBackend->addMemAlloc(pm);
+    if (!key.empty())
+      pm.add(CreateStoreCompiledModulePass(cache, key, pModel));
+  }
+  if (m_Verbose >= 3)
+    pm.add(CreateCountOperatorsPass("[Statistics] "));
+  // InterpreterPass calls prepare().
+  pm.add(CreateInterpreterPass(m_pBackend.get(), *this, m_Verbose, pDryRun));
+  if (!pm.run(*m_pOwnedModule))
+    return false;
+
+  return pDryRun || isReady();
+}
+
+void InferenceSession::prepare(Module& pModule)
+{
+  release();
+  m_pModule = &pModule;
+  Interpreter::AddressTable &atable = m_Interpreter.m_ATable;
+
+  // Weights stay where they are, even in a mapped weight file; everything
+  // else lives in one heap.
+  // XXX: Use Pass or something to get internal memory size
+  uint64_t internal_memory_size = 0;
+  for (ComputeOperand *co : pModule.getComputeOperands()) {
+    if (ComputeMemOperand *mem = dyn_cast<ComputeMemOperand>(co)) {
+      if (mem->isWeight()) {
+        // XXX: Weights may be mapped read-only; kernels never write them.
+        Value *v = co->getValue();
+        if (Value::kInt8 == v->kind()) {
+          Int8Tensor *t = static_cast<Int8Tensor *>(v);
+          atable[t] = const_cast<int8_t *>(t->data());
+        } else if (Value::kFloat16 == v->kind()) {
+          Float16Tensor *t = static_cast<Float16Tensor *>(v);
+          atable[t] = const_cast<uint16_t *>(t->data());
+        } else if (Value::kBFloat16 == v->kind()) {
+          BFloat16Tensor *t = static_cast<BFloat16Tensor *>(v);
+          atable[t] = const_cast<uint16_t *>(t->data());
+        } else if (Value::kInt64 == v->kind()) {
+          m_Widened.push_back(widen<Int64Tensor>(v));
+          atable[v] = m_Widened.back().data();
+        } else if (Value::kInt32 == v->kind()) {
+          m_Widened.push_back(widen<Int32Tensor>(v));
+          atable[v] = m_Widened.back().data();
+        } else {
+          FloatTensor *t = static_cast<FloatTensor *>(v);
+          atable[t] = const_cast<float *>(t->data());
+        }
+      } else if (!mem->isInput()) {
+        internal_memory_size =
+            std::max(internal_memory_size,
+                     static_cast<uint64_t>(mem->start()) + mem->length());
+      }
+    }
+  }
+  m_pHeap = allocate(internal_memory_size);
+  for (ComputeOperand *co : pModule.getComputeOperands()) {
+    if (ComputeMemOperand *mem = dyn_cast<ComputeMemOperand>(co)) {
+      if (mem->isOutput() || mem->isInternal())
+        atable[co->getValue()] = m_pHeap + mem->start();
+    }
+  }
+
+  // Every input gets its own buffer. Hack: there is no output
+  // ComputeOperand, so outputs are the inputs of OutputOperators.
+  size_t input_memory_size = 0;
+  for (ComputeOperator &cm : *pModule.getRootComputeGraph()) {
+    if (InputOperator *in = dyn_cast<InputOperator>(&cm)) {
+      Tensor *t = in->getTensor<Tensor>();
+      if (atable.count(t))
+        continue; // an initializer listed as a graph input
+      m_Inputs.push_back(Buffer{t, nullptr, sizeOf(t)});
+      input_memory_size += alignUp(m_Inputs.back().size);
+    } else if (OutputOperator *out = dyn_cast<OutputOperator>(&cm)) {
+      for (unsigned int i = 0; i < out->getNumOfInputs(); ++i) {
+        Tensor *t = static_cast<Tensor *>(out->getInput(i));
+        m_Outputs.push_back(Buffer{t, nullptr, sizeOf(t)});
+      }
+    }
+  }
+  m_pInputMem = allocate(input_memory_size);
+  size_t offset = 0;
+  for (Buffer &input : m_Inputs) {
+    input.buffer = m_pInputMem + offset;
+    atable[input.tensor] = input.buffer;
+    offset += alignUp(input.size);
+  }
+  for (Buffer &output : m_Outputs)
+    output.buffer = atable[output.tensor];
+
+  // Resolve every runtime call once; running the plan does no lookups.
+  for (ComputeOperator &cm : *pModule.getRootComputeGraph())
+    cm.accept(m_Interpreter);
+
+  m_pContext = ONNC_RUNTIME_init_runtime();
+  if (m_NumThreads > 0)
+    ONNC_RUNTIME_set_num_threads(m_pContext, m_NumThreads);
+  if (ONNC_RUNTIME_internal_num_threads(m_pContext) > 1)
+    buildGraph();
+}
+
+bool InferenceSession::setInput(unsigned int pIdx, const void* pData,
+                                size_t pSize)
+{
+  if (pIdx >= m_Inputs.size() || pSize != m_Inputs[pIdx].size)
+    return false;
+  memcpy(m_Inputs[pIdx].buffer, pData, pSize);
+  return true;
+}
+
+void InferenceSession::run()
+{
+  assert(isReady() && "prepare() the session before running it!");
+
+  Timer timer;
+  timer.start();
+  if (nullptr != m_pProfiler)
+    m_pProfiler->beginRun();
+  if (nullptr != m_pCalibrator)
+    m_pCalibrator->beginRun();
+  if (m_Nodes)
+    runParallel();
+  else
+    runSerial();
+  if (nullptr != m_pProfiler)
+    m_pProfiler->endRun();
+  timer.stop();
+  if (m_Verbose >= 1) {
+    outs() << "[v1] total inference time: " << timer.interval() << ' '
+           << timer.unit() << std::endl;
+  }
+}
+
+void InferenceSession::printOutputs(OStream& pOS) const
+{
+  for (const Buffer &output : m_Outputs) {
+    const float *values = static_cast<const float *>(output.buffer);
+    pOS << '[';
+    for (size_t i = 0; i < output.size / sizeof(float); ++i) {
+      pOS << std::fixed << values[i] << ", ";
+    }
+    pOS << ']' << std::endl;
+  }
+}
+
+void InferenceSession::buildGraph()
+{
+  // Internal memory is shared by values whose lifetimes do not overlap in
+  // graph order, so besides data dependencies a step also has to wait for
+  // the earlier steps that use memory it overwrites. Inputs and weights are
+  // never written and need no ordering.
+  std::unordered_map<Value *, MemRange> ranges;
+  for (ComputeOperand *co : m_pModule->getComputeOperands()) {
+    if (ComputeMemOperand *mem = dyn_cast<ComputeMemOperand>(co)) {
+      if (mem->isOutput() || mem->isInternal()) {
+        ranges[co->getValue()] =
+            MemRange(mem->start(), mem->start() + mem->length());
+      }
+    }
+  }
+
+  const ExecutionPlan::StepList &steps = m_Interpreter.m_Plan.steps();
+  const size_t size = steps.size();
+  std::vector<std::vector<MemRange>> reads(size), writes(size);
+  for (size_t i = 0; i < size; ++i) {
+    ComputeOperator *op = steps[i].op;
+    for (unsigned int k = 0; k < op->getNumOfInputs(); ++k) {
+      auto range = ranges.find(op->getInput(k));
+      if (range != ranges.end())
+        reads[i].push_back(range->second);
+    }
+    for (unsigned int k = 0; k < op->getNumOfOutputs(); ++k) {
+      auto range = ranges.find(op->getOutput(k));
+      if (range != ranges.end())
+        writes[i].push_back(range->second);
+    }
+  }
+
+  m_Nodes.reset(new Node[size]);
+  for (size_t j = 0; j < size; ++j) {
+    m_Nodes[j].step = &steps[j];
+    m_Nodes[j].index = j;
+    m_Nodes[j].predecessors = 0;
+    m_Nodes[j].run = nullptr;
+    for (size_t i = 0; i < j; ++i) {
+      if (overlap(writes[i], reads[j]) || overlap(writes[i], writes[j]) ||
+          overlap(reads[i], writes[j])) {
+        m_Nodes[i].successors.push_back(&m_Nodes[j]);
+        ++m_Nodes[j].predecessors;
+      }
+    }
+  }
+}
+
+void InferenceSession::runSerial()
+{
+  const ExecutionPlan &plan = m_Interpreter.m_Plan;
+  if (m_Verbose < 3 && nullptr == m_pProfiler && nullptr == m_pCalibrator) {
+    plan.run(m_pContext);
+    return;
+  }
+  const ExecutionPlan::StepList &steps = plan.steps();
+  for (size_t i = 0; i < steps.size(); ++i) {
+    Timer::Interval start = Timer::now();
+    steps[i].run(m_pContext);
+    Timer::Interval end = Timer::now();
+    if (nullptr != m_pProfiler)
+      m_pProfiler->record(i, start, end);
+    if (nullptr != m_pCalibrator)
+      m_pCalibrator->record(i);
+    if (m_Verbose >= 3) {
+      outs() << "[v3] " << steps[i].op->name() << " runs in "
+             << end - start << " ns" << std::endl;
+    }
+  }
+}
+
+void InferenceSession::runNode(void *pNode)
+{
+  Node *node = static_cast<Node *>(pNode);
+  ParallelRun *run = node->run;
+
+  bool timed = run->verbose || nullptr != run->profiler;
+  Timer::Interval start = timed ? Timer::now() : 0;
+  node->step->run(run->context);
+  // Outputs are read before the successors, which may reuse their memory,
+  // are submitted.
+  if (nullptr != run->calibrator)
+    run->calibrator->record(node->index);
+  if (timed) {
+    Timer::Interval end = Timer::now();
+    // Each node is run by one thread at a time.
+    if (nullptr != run->profiler)
+      run->profiler->record(node->index, start, end);
+    if (run->verbose) {
+      std::lock_guard<std::mutex> lock(run->print_mutex);
+      outs() << "[v3] " << node->step->op->name() << " runs in "
+             << end - start << " ns" << std::endl;
+    }
+  }
+
+  // The last predecessor to finish hands the step to the pool.
+  for (Node *succ : node->successors) {
+    if (succ->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      ONNC_RUNTIME_internal_submit(run->context, &run->group, runNode, succ);
+  }
+}
+
+void InferenceSession::runParallel()
+{
+  ParallelRun run;
+  run.context = m_pContext;
+  run.group.pending = 0;
+  run.verbose = m_Verbose >= 3;
+  run.profiler = m_pProfiler;
+  run.calibrator = m_pCalibrator;
+
+  const size_t size = m_Interpreter.m_Plan.size();
+  for (size_t i = 0; i < size; ++i) {
+    m_Nodes[i].remaining.store(m_Nodes[i].predecessors,
+                               std::memory_order_relaxed);
+    m_Nodes[i].run = &run;
+  }
+  for (size_t i = 0; i < size; ++i) {
+    if (0 == m_Nodes[i].predecessors)
+      ONNC_RUNTIME_internal_submit(m_pContext, &run.group, runNode,
+                                   &m_Nodes[i]);
+  }
+  ONNC_RUNTIME_internal_wait(m_pContext, &run.group);
+}
+
+void InferenceSession::release()
+{
+  if (nullptr != m_pContext) {
+    ONNC_RUNTIME_shutdown_runtime(m_pContext);
+    m_pContext = nullptr;
+  }
+  m_Nodes.reset();
+  m_Interpreter.m_Plan.clear();
+  m_Interpreter.m_ATable.clear();
+  m_Inputs.clear();
+  m_Outputs.clear();
+  m_Widened.clear();
+  std::free(m_pHeap);
+  m_pHeap = nullptr;
+  std::free(m_pInputMem);
+  m_pInputMem = nullptr;
+  m_pModule = nullptr;
+}
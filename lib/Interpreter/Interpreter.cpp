@@ -5,7 +5,10 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#include "Interpreter.h"
+// This file is generated by scripts/runtime/code_generator.py. Visitors of
+// the ONNC operators, and of the ONNX operators listed in
+// INTERPRETER_CUSTOM_OPERS, are written by hand in InterpreterCustom.cpp.
+#include <onnc/Interpreter/Interpreter.h>
 #include <onnc/Support/IOStream.h>
 
 #include <onnc/IR/Compute/Abs.h>
@@ -21,9 +24,7 @@
 #include <onnc/IR/Compute/Cast.h>
 #include <onnc/IR/Compute/Ceil.h>
 #include <onnc/IR/Compute/Clip.h>
-#include <onnc/IR/Compute/Concat.h>
 #include <onnc/IR/Compute/Constant.h>
-#include <onnc/IR/Compute/Conv.h>
 #include <onnc/IR/Compute/ConvTranspose.h>
 #include <onnc/IR/Compute/Cos.h>
 #include <onnc/IR/Compute/DepthToSpace.h>
@@ -37,7 +38,6 @@
 #include <onnc/IR/Compute/Floor.h>
 #include <onnc/IR/Compute/GRU.h>
 #include <onnc/IR/Compute/Gather.h>
-#include <onnc/IR/Compute/Gemm.h>
 #include <onnc/IR/Compute/GlobalAveragePool.h>
 #include <onnc/IR/Compute/GlobalLpPool.h>
 #include <onnc/IR/Compute/GlobalMaxPool.h>
@@ -54,7 +54,6 @@
 #include <onnc/IR/Compute/LogSoftmax.h>
 #include <onnc/IR/Compute/LpNormalization.h>
 #include <onnc/IR/Compute/LpPool.h>
-#include <onnc/IR/Compute/MatMul.h>
 #include <onnc/IR/Compute/Max.h>
 #include <onnc/IR/Compute/MaxPool.h>
 #include <onnc/IR/Compute/MaxRoiPool.h>
@@ -138,26 +137,28 @@ void Interpreter::visit(Abs& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_abs_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_abs_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -166,26 +167,28 @@ void Interpreter::visit(Acos& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_acos_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_acos_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -194,33 +197,35 @@ void Interpreter::visit(Add& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_add_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_add_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -229,33 +234,35 @@ void Interpreter::visit(And& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_and_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_and_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -264,28 +271,30 @@ void Interpreter::visit(ArgMax& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_argmax_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axis
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_argmax_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axis
+      , keepdims
+    );
+  });
 };
 
 
@@ -294,28 +303,30 @@ void Interpreter::visit(ArgMin& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_argmin_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axis
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_argmin_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axis
+      , keepdims
+    );
+  });
 };
 
 
@@ -324,26 +335,28 @@ void Interpreter::visit(Asin& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_asin_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_asin_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -352,26 +365,28 @@ void Interpreter::visit(Atan& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_atan_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_atan_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -380,43 +395,45 @@ void Interpreter::visit(AveragePool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   const char * auto_pad = pOp.getAutoPad().value().c_str();
   int32_t count_include_pad = pOp.getCountIncludePad().value();
   int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
-  int32_t kernel_shape[number_of_kernel_shape];
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
   for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
   int32_t number_of_pads = pOp.getPads().vector().size();
-  int32_t pads[number_of_pads];
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
   for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
   int32_t number_of_strides = pOp.getStrides().vector().size();
-  int32_t strides[number_of_strides];
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
   for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_averagepool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , auto_pad
-    , count_include_pad
-    , kernel_shape
-    , number_of_kernel_shape
-    , pads
-    , number_of_pads
-    , strides
-    , number_of_strides
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_averagepool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , auto_pad
+      , count_include_pad
+      , kernel_shape
+      , number_of_kernel_shape
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+    );
+  });
 };
 
 
@@ -425,33 +442,33 @@ void Interpreter::visit(BatchNormalization& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_scale_t = pOp.getInput(1);
   void *input_scale = m_ATable[input_scale_t];
   int32_t input_scale_ndim = input_scale_t->getNumOfDimensions();
-  int32_t input_scale_dims[input_scale_ndim];
+  int32_t *input_scale_dims = m_Plan.allocate<int32_t>(input_scale_ndim);
   for (int i = 0; i < input_scale_ndim; ++i) input_scale_dims[i] = input_scale_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(2);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   Tensor *input_mean_t = pOp.getInput(3);
   void *input_mean = m_ATable[input_mean_t];
   int32_t input_mean_ndim = input_mean_t->getNumOfDimensions();
-  int32_t input_mean_dims[input_mean_ndim];
+  int32_t *input_mean_dims = m_Plan.allocate<int32_t>(input_mean_ndim);
   for (int i = 0; i < input_mean_ndim; ++i) input_mean_dims[i] = input_mean_t->dimension(i);
   Tensor *input_var_t = pOp.getInput(4);
   void *input_var = m_ATable[input_var_t];
   int32_t input_var_ndim = input_var_t->getNumOfDimensions();
-  int32_t input_var_dims[input_var_ndim];
+  int32_t *input_var_dims = m_Plan.allocate<int32_t>(input_var_ndim);
   for (int i = 0; i < input_var_ndim; ++i) input_var_dims[i] = input_var_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   Tensor *output_mean_t = NULL;
   void *output_mean = NULL;
@@ -461,7 +478,7 @@ void Interpreter::visit(BatchNormalization& pOp) {
     output_mean = m_ATable[output_mean_t];
     output_mean_ndim = output_mean_t->getNumOfDimensions();
   }
-  int32_t output_mean_dims[output_mean_ndim];
+  int32_t *output_mean_dims = m_Plan.allocate<int32_t>(output_mean_ndim);
   for (int i = 0; i < output_mean_ndim; ++i) output_mean_dims[i] = output_mean_t->dimension(i);
   Tensor *output_var_t = NULL;
   void *output_var = NULL;
@@ -471,7 +488,7 @@ void Interpreter::visit(BatchNormalization& pOp) {
     output_var = m_ATable[output_var_t];
     output_var_ndim = output_var_t->getNumOfDimensions();
   }
-  int32_t output_var_dims[output_var_ndim];
+  int32_t *output_var_dims = m_Plan.allocate<int32_t>(output_var_ndim);
   for (int i = 0; i < output_var_ndim; ++i) output_var_dims[i] = output_var_t->dimension(i);
   Tensor *output_saved_mean_t = NULL;
   void *output_saved_mean = NULL;
@@ -481,7 +498,7 @@ void Interpreter::visit(BatchNormalization& pOp) {
     output_saved_mean = m_ATable[output_saved_mean_t];
     output_saved_mean_ndim = output_saved_mean_t->getNumOfDimensions();
   }
-  int32_t output_saved_mean_dims[output_saved_mean_ndim];
+  int32_t *output_saved_mean_dims = m_Plan.allocate<int32_t>(output_saved_mean_ndim);
   for (int i = 0; i < output_saved_mean_ndim; ++i) output_saved_mean_dims[i] = output_saved_mean_t->dimension(i);
   Tensor *output_saved_var_t = NULL;
   void *output_saved_var = NULL;
@@ -491,7 +508,7 @@ void Interpreter::visit(BatchNormalization& pOp) {
     output_saved_var = m_ATable[output_saved_var_t];
     output_saved_var_ndim = output_saved_var_t->getNumOfDimensions();
   }
-  int32_t output_saved_var_dims[output_saved_var_ndim];
+  int32_t *output_saved_var_dims = m_Plan.allocate<int32_t>(output_saved_var_ndim);
   for (int i = 0; i < output_saved_var_ndim; ++i) output_saved_var_dims[i] = output_saved_var_t->dimension(i);
   // Prepare attributes
   float epsilon = pOp.getEpsilon().value();
@@ -499,32 +516,34 @@ void Interpreter::visit(BatchNormalization& pOp) {
   int32_t spatial = pOp.getSpatial().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_batchnormalization_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_scale)
-    , input_scale_ndim, input_scale_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(input_mean)
-    , input_mean_ndim, input_mean_dims
-    , reinterpret_cast<float *>(input_var)
-    , input_var_ndim, input_var_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , reinterpret_cast<float *>(output_mean)
-    , output_mean_ndim, output_mean_dims
-    , reinterpret_cast<float *>(output_var)
-    , output_var_ndim, output_var_dims
-    , reinterpret_cast<float *>(output_saved_mean)
-    , output_saved_mean_ndim, output_saved_mean_dims
-    , reinterpret_cast<float *>(output_saved_var)
-    , output_saved_var_ndim, output_saved_var_dims
-    , epsilon
-    , momentum
-    , spatial
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_batchnormalization_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_scale)
+      , input_scale_ndim, input_scale_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_mean)
+      , input_mean_ndim, input_mean_dims
+      , reinterpret_cast<float *>(input_var)
+      , input_var_ndim, input_var_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , reinterpret_cast<float *>(output_mean)
+      , output_mean_ndim, output_mean_dims
+      , reinterpret_cast<float *>(output_var)
+      , output_var_ndim, output_var_dims
+      , reinterpret_cast<float *>(output_saved_mean)
+      , output_saved_mean_ndim, output_saved_mean_dims
+      , reinterpret_cast<float *>(output_saved_var)
+      , output_saved_var_ndim, output_saved_var_dims
+      , epsilon
+      , momentum
+      , spatial
+    );
+  });
 };
 
 
@@ -533,26 +552,28 @@ void Interpreter::visit(Cast& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t to = pOp.getTo().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_cast_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , to
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_cast_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , to
+    );
+  });
 };
 
 
@@ -561,26 +582,28 @@ void Interpreter::visit(Ceil& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_ceil_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_ceil_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -589,69 +612,30 @@ void Interpreter::visit(Clip& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   float max = pOp.getMax().value();
   float min = pOp.getMin().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_clip_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , max
-    , min
-  );
-};
-
-
-void Interpreter::visit(Concat& pOp) {
-  // Prepare input
-  int32_t input_inputs_ntensor = pOp.getNumOfInputs() - 0;
-  void *input_inputs[input_inputs_ntensor];
-  int32_t input_inputs_ndim[input_inputs_ntensor];
-  int32_t *input_inputs_dims[input_inputs_ntensor];
-  for (int i = 0; i < input_inputs_ntensor; ++i){
-    input_inputs[i] = m_ATable[pOp.getInput(0 + i)];
-    input_inputs_ndim[i] = pOp.getInput(0 + i)->getNumOfDimensions();
-    input_inputs_dims[i] = new int32_t[input_inputs_ndim[i]];
-    for(int32_t j = 0; j < input_inputs_ndim[i]; ++j){
-      input_inputs_dims[i][j] = pOp.getInput(0 + i)->dimension(j);
-    }
-  }
-  // Prepare output
-  Tensor *output_concat_result_t = pOp.getOutput(0);
-  void *output_concat_result = m_ATable[output_concat_result_t];
-  int32_t output_concat_result_ndim = output_concat_result_t->getNumOfDimensions();
-  int32_t output_concat_result_dims[output_concat_result_ndim];
-  for (int i = 0; i < output_concat_result_ndim; ++i) output_concat_result_dims[i] = output_concat_result_t->dimension(i);
-  // Prepare attributes
-  int32_t axis = pOp.getAxis().value();
-
-  // Call to Runtime
-  ONNC_RUNTIME_concat_float(
-    m_pContext
-    , reinterpret_cast<float **>(input_inputs)
-    , input_inputs_ntensor
-    , input_inputs_ndim, input_inputs_dims
-    , reinterpret_cast<float *>(output_concat_result)
-    , output_concat_result_ndim, output_concat_result_dims
-    , axis
-  );
-
-  // Clean
-  for (int i = 0; i < input_inputs_ntensor; ++i){
-    delete [] input_inputs_dims[i];
-  }
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_clip_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , max
+      , min
+    );
+  });
 };
 
 
@@ -662,88 +646,21 @@ void Interpreter::visit(Constant& pOp) {
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   const void * value = &pOp.getValue().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_constant_float(
-    m_pContext
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_constant_float(
+      pContext
     
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , value
-  );
-};
-
-
-void Interpreter::visit(Conv& pOp) {
-  // Prepare input
-  Tensor *input_X_t = pOp.getInput(0);
-  void *input_X = m_ATable[input_X_t];
-  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
-  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
-  Tensor *input_W_t = pOp.getInput(1);
-  void *input_W = m_ATable[input_W_t];
-  int32_t input_W_ndim = input_W_t->getNumOfDimensions();
-  int32_t input_W_dims[input_W_ndim];
-  for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
-  Tensor *input_B_t = NULL;
-  void *input_B = NULL;
-  int32_t input_B_ndim = 0;
-  if (pOp.getNumOfInputs() > 2) {
-    input_B_t = pOp.getInput(2);
-    input_B = m_ATable[input_B_t];
-    input_B_ndim = input_B_t->getNumOfDimensions();
-  }
-  int32_t input_B_dims[input_B_ndim];
-  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
-  // Prepare output
-  Tensor *output_Y_t = pOp.getOutput(0);
-  void *output_Y = m_ATable[output_Y_t];
-  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
-  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
-  // Prepare attributes
-  const char * auto_pad = pOp.getAutoPad().value().c_str();
-  int32_t number_of_dilations = pOp.getDilations().vector().size();
-  int32_t dilations[number_of_dilations];
-  for (int i = 0; i < number_of_dilations; ++i) dilations[i] = pOp.getDilations().at(i);
-  int32_t group = pOp.getGroup().value();
-  int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
-  int32_t kernel_shape[number_of_kernel_shape];
-  for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
-  int32_t number_of_pads = pOp.getPads().vector().size();
-  int32_t pads[number_of_pads];
-  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
-  int32_t number_of_strides = pOp.getStrides().vector().size();
-  int32_t strides[number_of_strides];
-  for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
-
-  // Call to Runtime
-  ONNC_RUNTIME_conv_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_W)
-    , input_W_ndim, input_W_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , auto_pad
-    , dilations
-    , number_of_dilations
-    , group
-    , kernel_shape
-    , number_of_kernel_shape
-    , pads
-    , number_of_pads
-    , strides
-    , number_of_strides
-  );
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , value
+    );
+  });
 };
 
 
@@ -752,12 +669,12 @@ void Interpreter::visit(ConvTranspose& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_W_t = pOp.getInput(1);
   void *input_W = m_ATable[input_W_t];
   int32_t input_W_ndim = input_W_t->getNumOfDimensions();
-  int32_t input_W_dims[input_W_ndim];
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
   for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
   Tensor *input_B_t = NULL;
   void *input_B = NULL;
@@ -767,62 +684,64 @@ void Interpreter::visit(ConvTranspose& pOp) {
     input_B = m_ATable[input_B_t];
     input_B_ndim = input_B_t->getNumOfDimensions();
   }
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   const char * auto_pad = pOp.getAutoPad().value().c_str();
   int32_t number_of_dilations = pOp.getDilations().vector().size();
-  int32_t dilations[number_of_dilations];
+  int32_t *dilations = m_Plan.allocate<int32_t>(number_of_dilations);
   for (int i = 0; i < number_of_dilations; ++i) dilations[i] = pOp.getDilations().at(i);
   int32_t group = pOp.getGroup().value();
   int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
-  int32_t kernel_shape[number_of_kernel_shape];
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
   for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
   int32_t number_of_output_padding = pOp.getOutputPadding().vector().size();
-  int32_t output_padding[number_of_output_padding];
+  int32_t *output_padding = m_Plan.allocate<int32_t>(number_of_output_padding);
   for (int i = 0; i < number_of_output_padding; ++i) output_padding[i] = pOp.getOutputPadding().at(i);
   int32_t number_of_output_shape = pOp.getOutputShape().vector().size();
-  int32_t output_shape[number_of_output_shape];
+  int32_t *output_shape = m_Plan.allocate<int32_t>(number_of_output_shape);
   for (int i = 0; i < number_of_output_shape; ++i) output_shape[i] = pOp.getOutputShape().at(i);
   int32_t number_of_pads = pOp.getPads().vector().size();
-  int32_t pads[number_of_pads];
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
   for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
   int32_t number_of_strides = pOp.getStrides().vector().size();
-  int32_t strides[number_of_strides];
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
   for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_convtranspose_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_W)
-    , input_W_ndim, input_W_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , auto_pad
-    , dilations
-    , number_of_dilations
-    , group
-    , kernel_shape
-    , number_of_kernel_shape
-    , output_padding
-    , number_of_output_padding
-    , output_shape
-    , number_of_output_shape
-    , pads
-    , number_of_pads
-    , strides
-    , number_of_strides
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_convtranspose_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , auto_pad
+      , dilations
+      , number_of_dilations
+      , group
+      , kernel_shape
+      , number_of_kernel_shape
+      , output_padding
+      , number_of_output_padding
+      , output_shape
+      , number_of_output_shape
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+    );
+  });
 };
 
 
@@ -831,26 +750,28 @@ void Interpreter::visit(Cos& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_cos_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_cos_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -859,26 +780,28 @@ void Interpreter::visit(DepthToSpace& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t blocksize = pOp.getBlocksize().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_depthtospace_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , blocksize
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_depthtospace_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , blocksize
+    );
+  });
 };
 
 
@@ -887,33 +810,35 @@ void Interpreter::visit(Div& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_div_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_div_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -922,13 +847,13 @@ void Interpreter::visit(Dropout& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   Tensor *output_mask_t = NULL;
   void *output_mask = NULL;
@@ -938,22 +863,24 @@ void Interpreter::visit(Dropout& pOp) {
     output_mask = m_ATable[output_mask_t];
     output_mask_ndim = output_mask_t->getNumOfDimensions();
   }
-  int32_t output_mask_dims[output_mask_ndim];
+  int32_t *output_mask_dims = m_Plan.allocate<int32_t>(output_mask_ndim);
   for (int i = 0; i < output_mask_ndim; ++i) output_mask_dims[i] = output_mask_t->dimension(i);
   // Prepare attributes
   float ratio = pOp.getRatio().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_dropout_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , reinterpret_cast<float *>(output_mask)
-    , output_mask_ndim, output_mask_dims
-    , ratio
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_dropout_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , reinterpret_cast<float *>(output_mask)
+      , output_mask_ndim, output_mask_dims
+      , ratio
+    );
+  });
 };
 
 
@@ -962,26 +889,28 @@ void Interpreter::visit(Elu& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_elu_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_elu_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+    );
+  });
 };
 
 
@@ -990,33 +919,35 @@ void Interpreter::visit(Equal& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_equal_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_equal_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1025,26 +956,28 @@ void Interpreter::visit(Exp& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_exp_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_exp_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1053,33 +986,35 @@ void Interpreter::visit(Expand& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   Tensor *input_shape_t = pOp.getInput(1);
   void *input_shape = m_ATable[input_shape_t];
   int32_t input_shape_ndim = input_shape_t->getNumOfDimensions();
-  int32_t input_shape_dims[input_shape_ndim];
+  int32_t *input_shape_dims = m_Plan.allocate<int32_t>(input_shape_ndim);
   for (int i = 0; i < input_shape_ndim; ++i) input_shape_dims[i] = input_shape_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_expand_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(input_shape)
-    , input_shape_ndim, input_shape_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_expand_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(input_shape)
+      , input_shape_ndim, input_shape_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1088,26 +1023,28 @@ void Interpreter::visit(Flatten& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_flatten_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axis
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_flatten_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axis
+    );
+  });
 };
 
 
@@ -1116,26 +1053,28 @@ void Interpreter::visit(Floor& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_floor_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_floor_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1144,17 +1083,17 @@ void Interpreter::visit(GRU& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_W_t = pOp.getInput(1);
   void *input_W = m_ATable[input_W_t];
   int32_t input_W_ndim = input_W_t->getNumOfDimensions();
-  int32_t input_W_dims[input_W_ndim];
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
   for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
   Tensor *input_R_t = pOp.getInput(2);
   void *input_R = m_ATable[input_R_t];
   int32_t input_R_ndim = input_R_t->getNumOfDimensions();
-  int32_t input_R_dims[input_R_ndim];
+  int32_t *input_R_dims = m_Plan.allocate<int32_t>(input_R_ndim);
   for (int i = 0; i < input_R_ndim; ++i) input_R_dims[i] = input_R_t->dimension(i);
   Tensor *input_B_t = NULL;
   void *input_B = NULL;
@@ -1164,7 +1103,7 @@ void Interpreter::visit(GRU& pOp) {
     input_B = m_ATable[input_B_t];
     input_B_ndim = input_B_t->getNumOfDimensions();
   }
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   Tensor *input_sequence_lens_t = NULL;
   void *input_sequence_lens = NULL;
@@ -1174,7 +1113,7 @@ void Interpreter::visit(GRU& pOp) {
     input_sequence_lens = m_ATable[input_sequence_lens_t];
     input_sequence_lens_ndim = input_sequence_lens_t->getNumOfDimensions();
   }
-  int32_t input_sequence_lens_dims[input_sequence_lens_ndim];
+  int32_t *input_sequence_lens_dims = m_Plan.allocate<int32_t>(input_sequence_lens_ndim);
   for (int i = 0; i < input_sequence_lens_ndim; ++i) input_sequence_lens_dims[i] = input_sequence_lens_t->dimension(i);
   Tensor *input_initial_h_t = NULL;
   void *input_initial_h = NULL;
@@ -1184,7 +1123,7 @@ void Interpreter::visit(GRU& pOp) {
     input_initial_h = m_ATable[input_initial_h_t];
     input_initial_h_ndim = input_initial_h_t->getNumOfDimensions();
   }
-  int32_t input_initial_h_dims[input_initial_h_ndim];
+  int32_t *input_initial_h_dims = m_Plan.allocate<int32_t>(input_initial_h_ndim);
   for (int i = 0; i < input_initial_h_ndim; ++i) input_initial_h_dims[i] = input_initial_h_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = NULL;
@@ -1195,7 +1134,7 @@ void Interpreter::visit(GRU& pOp) {
     output_Y = m_ATable[output_Y_t];
     output_Y_ndim = output_Y_t->getNumOfDimensions();
   }
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   Tensor *output_Y_h_t = NULL;
   void *output_Y_h = NULL;
@@ -1205,17 +1144,17 @@ void Interpreter::visit(GRU& pOp) {
     output_Y_h = m_ATable[output_Y_h_t];
     output_Y_h_ndim = output_Y_h_t->getNumOfDimensions();
   }
-  int32_t output_Y_h_dims[output_Y_h_ndim];
+  int32_t *output_Y_h_dims = m_Plan.allocate<int32_t>(output_Y_h_ndim);
   for (int i = 0; i < output_Y_h_ndim; ++i) output_Y_h_dims[i] = output_Y_h_t->dimension(i);
   // Prepare attributes
   int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
-  float activation_alpha[number_of_activation_alpha];
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
   for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
   int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
-  float activation_beta[number_of_activation_beta];
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
   for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
   int32_t number_of_activations = pOp.getActivations().vector().size();
-  const char * activations[number_of_activations];
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
   for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
   float clip = pOp.getClip().value();
   const char * direction = pOp.getDirection().value().c_str();
@@ -1223,35 +1162,37 @@ void Interpreter::visit(GRU& pOp) {
   int32_t linear_before_reset = pOp.getLinearBeforeReset().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_gru_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_W)
-    , input_W_ndim, input_W_dims
-    , reinterpret_cast<float *>(input_R)
-    , input_R_ndim, input_R_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(input_sequence_lens)
-    , input_sequence_lens_ndim, input_sequence_lens_dims
-    , reinterpret_cast<float *>(input_initial_h)
-    , input_initial_h_ndim, input_initial_h_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , reinterpret_cast<float *>(output_Y_h)
-    , output_Y_h_ndim, output_Y_h_dims
-    , activation_alpha
-    , number_of_activation_alpha
-    , activation_beta
-    , number_of_activation_beta
-    , activations
-    , number_of_activations
-    , clip
-    , direction
-    , hidden_size
-    , linear_before_reset
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_gru_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_R)
+      , input_R_ndim, input_R_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_sequence_lens)
+      , input_sequence_lens_ndim, input_sequence_lens_dims
+      , reinterpret_cast<float *>(input_initial_h)
+      , input_initial_h_ndim, input_initial_h_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , reinterpret_cast<float *>(output_Y_h)
+      , output_Y_h_ndim, output_Y_h_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , clip
+      , direction
+      , hidden_size
+      , linear_before_reset
+    );
+  });
 };
 
 
@@ -1260,81 +1201,35 @@ void Interpreter::visit(Gather& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   Tensor *input_indices_t = pOp.getInput(1);
   void *input_indices = m_ATable[input_indices_t];
   int32_t input_indices_ndim = input_indices_t->getNumOfDimensions();
-  int32_t input_indices_dims[input_indices_ndim];
+  int32_t *input_indices_dims = m_Plan.allocate<int32_t>(input_indices_ndim);
   for (int i = 0; i < input_indices_ndim; ++i) input_indices_dims[i] = input_indices_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_gather_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(input_indices)
-    , input_indices_ndim, input_indices_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axis
-  );
-};
-
-
-void Interpreter::visit(Gemm& pOp) {
-  // Prepare input
-  Tensor *input_A_t = pOp.getInput(0);
-  void *input_A = m_ATable[input_A_t];
-  int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
-  for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
-  Tensor *input_B_t = pOp.getInput(1);
-  void *input_B = m_ATable[input_B_t];
-  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
-  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
-  Tensor *input_C_t = pOp.getInput(2);
-  void *input_C = m_ATable[input_C_t];
-  int32_t input_C_ndim = input_C_t->getNumOfDimensions();
-  int32_t input_C_dims[input_C_ndim];
-  for (int i = 0; i < input_C_ndim; ++i) input_C_dims[i] = input_C_t->dimension(i);
-  // Prepare output
-  Tensor *output_Y_t = pOp.getOutput(0);
-  void *output_Y = m_ATable[output_Y_t];
-  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
-  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
-  // Prepare attributes
-  float alpha = pOp.getAlpha().value();
-  float beta = pOp.getBeta().value();
-  int32_t transA = pOp.getTransA().value();
-  int32_t transB = pOp.getTransB().value();
-
-  // Call to Runtime
-  ONNC_RUNTIME_gemm_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(input_C)
-    , input_C_ndim, input_C_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-    , beta
-    , transA
-    , transB
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_gather_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(input_indices)
+      , input_indices_ndim, input_indices_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axis
+    );
+  });
 };
 
 
@@ -1343,26 +1238,28 @@ void Interpreter::visit(GlobalAveragePool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_globalaveragepool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_globalaveragepool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1371,26 +1268,28 @@ void Interpreter::visit(GlobalLpPool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   int32_t p = pOp.getP().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_globallppool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , p
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_globallppool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , p
+    );
+  });
 };
 
 
@@ -1399,26 +1298,28 @@ void Interpreter::visit(GlobalMaxPool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_globalmaxpool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_globalmaxpool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1427,33 +1328,35 @@ void Interpreter::visit(Greater& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_greater_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_greater_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1462,28 +1365,30 @@ void Interpreter::visit(HardSigmoid& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
   float beta = pOp.getBeta().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_hardsigmoid_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-    , beta
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_hardsigmoid_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+      , beta
+    );
+  });
 };
 
 
@@ -1492,26 +1397,28 @@ void Interpreter::visit(Hardmax& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_hardmax_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axis
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_hardmax_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axis
+    );
+  });
 };
 
 
@@ -1520,26 +1427,28 @@ void Interpreter::visit(Identity& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_identity_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_identity_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1548,40 +1457,42 @@ void Interpreter::visit(InstanceNormalization& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   Tensor *input_scale_t = pOp.getInput(1);
   void *input_scale = m_ATable[input_scale_t];
   int32_t input_scale_ndim = input_scale_t->getNumOfDimensions();
-  int32_t input_scale_dims[input_scale_ndim];
+  int32_t *input_scale_dims = m_Plan.allocate<int32_t>(input_scale_ndim);
   for (int i = 0; i < input_scale_ndim; ++i) input_scale_dims[i] = input_scale_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(2);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   float epsilon = pOp.getEpsilon().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_instancenormalization_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(input_scale)
-    , input_scale_ndim, input_scale_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , epsilon
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_instancenormalization_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(input_scale)
+      , input_scale_ndim, input_scale_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , epsilon
+    );
+  });
 };
 
 
@@ -1590,13 +1501,13 @@ void Interpreter::visit(LRN& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
@@ -1605,17 +1516,19 @@ void Interpreter::visit(LRN& pOp) {
   int32_t size = pOp.getSize().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_lrn_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-    , beta
-    , bias
-    , size
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_lrn_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+      , beta
+      , bias
+      , size
+    );
+  });
 };
 
 
@@ -1624,17 +1537,17 @@ void Interpreter::visit(LSTM& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_W_t = pOp.getInput(1);
   void *input_W = m_ATable[input_W_t];
   int32_t input_W_ndim = input_W_t->getNumOfDimensions();
-  int32_t input_W_dims[input_W_ndim];
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
   for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
   Tensor *input_R_t = pOp.getInput(2);
   void *input_R = m_ATable[input_R_t];
   int32_t input_R_ndim = input_R_t->getNumOfDimensions();
-  int32_t input_R_dims[input_R_ndim];
+  int32_t *input_R_dims = m_Plan.allocate<int32_t>(input_R_ndim);
   for (int i = 0; i < input_R_ndim; ++i) input_R_dims[i] = input_R_t->dimension(i);
   Tensor *input_B_t = NULL;
   void *input_B = NULL;
@@ -1644,7 +1557,7 @@ void Interpreter::visit(LSTM& pOp) {
     input_B = m_ATable[input_B_t];
     input_B_ndim = input_B_t->getNumOfDimensions();
   }
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   Tensor *input_sequence_lens_t = NULL;
   void *input_sequence_lens = NULL;
@@ -1654,7 +1567,7 @@ void Interpreter::visit(LSTM& pOp) {
     input_sequence_lens = m_ATable[input_sequence_lens_t];
     input_sequence_lens_ndim = input_sequence_lens_t->getNumOfDimensions();
   }
-  int32_t input_sequence_lens_dims[input_sequence_lens_ndim];
+  int32_t *input_sequence_lens_dims = m_Plan.allocate<int32_t>(input_sequence_lens_ndim);
   for (int i = 0; i < input_sequence_lens_ndim; ++i) input_sequence_lens_dims[i] = input_sequence_lens_t->dimension(i);
   Tensor *input_initial_h_t = NULL;
   void *input_initial_h = NULL;
@@ -1664,7 +1577,7 @@ void Interpreter::visit(LSTM& pOp) {
     input_initial_h = m_ATable[input_initial_h_t];
     input_initial_h_ndim = input_initial_h_t->getNumOfDimensions();
   }
-  int32_t input_initial_h_dims[input_initial_h_ndim];
+  int32_t *input_initial_h_dims = m_Plan.allocate<int32_t>(input_initial_h_ndim);
   for (int i = 0; i < input_initial_h_ndim; ++i) input_initial_h_dims[i] = input_initial_h_t->dimension(i);
   Tensor *input_initial_c_t = NULL;
   void *input_initial_c = NULL;
@@ -1674,7 +1587,7 @@ void Interpreter::visit(LSTM& pOp) {
     input_initial_c = m_ATable[input_initial_c_t];
     input_initial_c_ndim = input_initial_c_t->getNumOfDimensions();
   }
-  int32_t input_initial_c_dims[input_initial_c_ndim];
+  int32_t *input_initial_c_dims = m_Plan.allocate<int32_t>(input_initial_c_ndim);
   for (int i = 0; i < input_initial_c_ndim; ++i) input_initial_c_dims[i] = input_initial_c_t->dimension(i);
   Tensor *input_P_t = NULL;
   void *input_P = NULL;
@@ -1684,7 +1597,7 @@ void Interpreter::visit(LSTM& pOp) {
     input_P = m_ATable[input_P_t];
     input_P_ndim = input_P_t->getNumOfDimensions();
   }
-  int32_t input_P_dims[input_P_ndim];
+  int32_t *input_P_dims = m_Plan.allocate<int32_t>(input_P_ndim);
   for (int i = 0; i < input_P_ndim; ++i) input_P_dims[i] = input_P_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = NULL;
@@ -1695,7 +1608,7 @@ void Interpreter::visit(LSTM& pOp) {
     output_Y = m_ATable[output_Y_t];
     output_Y_ndim = output_Y_t->getNumOfDimensions();
   }
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   Tensor *output_Y_h_t = NULL;
   void *output_Y_h = NULL;
@@ -1705,7 +1618,7 @@ void Interpreter::visit(LSTM& pOp) {
     output_Y_h = m_ATable[output_Y_h_t];
     output_Y_h_ndim = output_Y_h_t->getNumOfDimensions();
   }
-  int32_t output_Y_h_dims[output_Y_h_ndim];
+  int32_t *output_Y_h_dims = m_Plan.allocate<int32_t>(output_Y_h_ndim);
   for (int i = 0; i < output_Y_h_ndim; ++i) output_Y_h_dims[i] = output_Y_h_t->dimension(i);
   Tensor *output_Y_c_t = NULL;
   void *output_Y_c = NULL;
@@ -1715,17 +1628,17 @@ void Interpreter::visit(LSTM& pOp) {
     output_Y_c = m_ATable[output_Y_c_t];
     output_Y_c_ndim = output_Y_c_t->getNumOfDimensions();
   }
-  int32_t output_Y_c_dims[output_Y_c_ndim];
+  int32_t *output_Y_c_dims = m_Plan.allocate<int32_t>(output_Y_c_ndim);
   for (int i = 0; i < output_Y_c_ndim; ++i) output_Y_c_dims[i] = output_Y_c_t->dimension(i);
   // Prepare attributes
   int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
-  float activation_alpha[number_of_activation_alpha];
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
   for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
   int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
-  float activation_beta[number_of_activation_beta];
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
   for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
   int32_t number_of_activations = pOp.getActivations().vector().size();
-  const char * activations[number_of_activations];
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
   for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
   float clip = pOp.getClip().value();
   const char * direction = pOp.getDirection().value().c_str();
@@ -1733,41 +1646,43 @@ void Interpreter::visit(LSTM& pOp) {
   int32_t input_forget = pOp.getInputForget().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_lstm_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_W)
-    , input_W_ndim, input_W_dims
-    , reinterpret_cast<float *>(input_R)
-    , input_R_ndim, input_R_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(input_sequence_lens)
-    , input_sequence_lens_ndim, input_sequence_lens_dims
-    , reinterpret_cast<float *>(input_initial_h)
-    , input_initial_h_ndim, input_initial_h_dims
-    , reinterpret_cast<float *>(input_initial_c)
-    , input_initial_c_ndim, input_initial_c_dims
-    , reinterpret_cast<float *>(input_P)
-    , input_P_ndim, input_P_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , reinterpret_cast<float *>(output_Y_h)
-    , output_Y_h_ndim, output_Y_h_dims
-    , reinterpret_cast<float *>(output_Y_c)
-    , output_Y_c_ndim, output_Y_c_dims
-    , activation_alpha
-    , number_of_activation_alpha
-    , activation_beta
-    , number_of_activation_beta
-    , activations
-    , number_of_activations
-    , clip
-    , direction
-    , hidden_size
-    , input_forget
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_lstm_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_R)
+      , input_R_ndim, input_R_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_sequence_lens)
+      , input_sequence_lens_ndim, input_sequence_lens_dims
+      , reinterpret_cast<float *>(input_initial_h)
+      , input_initial_h_ndim, input_initial_h_dims
+      , reinterpret_cast<float *>(input_initial_c)
+      , input_initial_c_ndim, input_initial_c_dims
+      , reinterpret_cast<float *>(input_P)
+      , input_P_ndim, input_P_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , reinterpret_cast<float *>(output_Y_h)
+      , output_Y_h_ndim, output_Y_h_dims
+      , reinterpret_cast<float *>(output_Y_c)
+      , output_Y_c_ndim, output_Y_c_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , clip
+      , direction
+      , hidden_size
+      , input_forget
+    );
+  });
 };
 
 
@@ -1776,26 +1691,28 @@ void Interpreter::visit(LeakyRelu& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_leakyrelu_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_leakyrelu_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+    );
+  });
 };
 
 
@@ -1804,33 +1721,35 @@ void Interpreter::visit(Less& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_less_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_less_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1839,26 +1758,28 @@ void Interpreter::visit(Log& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_log_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_log_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -1867,26 +1788,28 @@ void Interpreter::visit(LogSoftmax& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_logsoftmax_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axis
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_logsoftmax_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axis
+    );
+  });
 };
 
 
@@ -1895,28 +1818,30 @@ void Interpreter::visit(LpNormalization& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
   int32_t p = pOp.getP().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_lpnormalization_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axis
-    , p
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_lpnormalization_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axis
+      , p
+    );
+  });
 };
 
 
@@ -1925,108 +1850,77 @@ void Interpreter::visit(LpPool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   const char * auto_pad = pOp.getAutoPad().value().c_str();
   int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
-  int32_t kernel_shape[number_of_kernel_shape];
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
   for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
   int32_t p = pOp.getP().value();
   int32_t number_of_pads = pOp.getPads().vector().size();
-  int32_t pads[number_of_pads];
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
   for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
   int32_t number_of_strides = pOp.getStrides().vector().size();
-  int32_t strides[number_of_strides];
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
   for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_lppool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , auto_pad
-    , kernel_shape
-    , number_of_kernel_shape
-    , p
-    , pads
-    , number_of_pads
-    , strides
-    , number_of_strides
-  );
-};
-
-
-void Interpreter::visit(MatMul& pOp) {
-  // Prepare input
-  Tensor *input_A_t = pOp.getInput(0);
-  void *input_A = m_ATable[input_A_t];
-  int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
-  for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
-  Tensor *input_B_t = pOp.getInput(1);
-  void *input_B = m_ATable[input_B_t];
-  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
-  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
-  // Prepare output
-  Tensor *output_Y_t = pOp.getOutput(0);
-  void *output_Y = m_ATable[output_Y_t];
-  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
-  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
-  // Prepare attributes
-  
-
-  // Call to Runtime
-  ONNC_RUNTIME_matmul_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_lppool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , auto_pad
+      , kernel_shape
+      , number_of_kernel_shape
+      , p
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+    );
+  });
 };
 
 
 void Interpreter::visit(Max& pOp) {
   // Prepare input
   int32_t input_data_0_ntensor = pOp.getNumOfInputs() - 0;
-  void *input_data_0[input_data_0_ntensor];
+  void **input_data_0 = m_Plan.allocate<void *>(input_data_0_ntensor);
   for (int i = 0; i < input_data_0_ntensor; ++i) input_data_0[i] = m_ATable[pOp.getInput(0 + i)];
-  int32_t input_data_0_ndim[input_data_0_ntensor]; // FIXME: = input_data_0_v->sizes().size();
-  int32_t *input_data_0_dims[input_data_0_ntensor]; // FIXME: [input_data_0_ndim[0]];
+  int32_t *input_data_0_ndim = m_Plan.allocate<int32_t>(input_data_0_ntensor); // FIXME: = input_data_0_v->sizes().size();
+  int32_t **input_data_0_dims = m_Plan.allocate<int32_t *>(input_data_0_ntensor); // FIXME: [input_data_0_ndim[0]];
   // FIXME: for (int i = 0; i < input_data_0_ndim; ++i) input_data_0_dims[i] = input_data_0_v->sizes()[i].dim;
   // Prepare output
   Tensor *output_max_t = pOp.getOutput(0);
   void *output_max = m_ATable[output_max_t];
   int32_t output_max_ndim = output_max_t->getNumOfDimensions();
-  int32_t output_max_dims[output_max_ndim];
+  int32_t *output_max_dims = m_Plan.allocate<int32_t>(output_max_ndim);
   for (int i = 0; i < output_max_ndim; ++i) output_max_dims[i] = output_max_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_max_float(
-    m_pContext
-    , reinterpret_cast<float **>(input_data_0)
-    , input_data_0_ntensor
-    , input_data_0_ndim, input_data_0_dims
-    , reinterpret_cast<float *>(output_max)
-    , output_max_ndim, output_max_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_max_float(
+      pContext
+      , reinterpret_cast<float **>(input_data_0)
+      , input_data_0_ntensor
+      , input_data_0_ndim, input_data_0_dims
+      , reinterpret_cast<float *>(output_max)
+      , output_max_ndim, output_max_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2035,13 +1929,13 @@ void Interpreter::visit(MaxPool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   Tensor *output_Indices_t = NULL;
   void *output_Indices = NULL;
@@ -2051,39 +1945,41 @@ void Interpreter::visit(MaxPool& pOp) {
     output_Indices = m_ATable[output_Indices_t];
     output_Indices_ndim = output_Indices_t->getNumOfDimensions();
   }
-  int32_t output_Indices_dims[output_Indices_ndim];
+  int32_t *output_Indices_dims = m_Plan.allocate<int32_t>(output_Indices_ndim);
   for (int i = 0; i < output_Indices_ndim; ++i) output_Indices_dims[i] = output_Indices_t->dimension(i);
   // Prepare attributes
   const char * auto_pad = pOp.getAutoPad().value().c_str();
   int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
-  int32_t kernel_shape[number_of_kernel_shape];
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
   for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
   int32_t number_of_pads = pOp.getPads().vector().size();
-  int32_t pads[number_of_pads];
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
   for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
   int32_t storage_order = pOp.getStorageOrder().value();
   int32_t number_of_strides = pOp.getStrides().vector().size();
-  int32_t strides[number_of_strides];
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
   for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_maxpool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , reinterpret_cast<float *>(output_Indices)
-    , output_Indices_ndim, output_Indices_dims
-    , auto_pad
-    , kernel_shape
-    , number_of_kernel_shape
-    , pads
-    , number_of_pads
-    , storage_order
-    , strides
-    , number_of_strides
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_maxpool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , reinterpret_cast<float *>(output_Indices)
+      , output_Indices_ndim, output_Indices_dims
+      , auto_pad
+      , kernel_shape
+      , number_of_kernel_shape
+      , pads
+      , number_of_pads
+      , storage_order
+      , strides
+      , number_of_strides
+    );
+  });
 };
 
 
@@ -2092,98 +1988,104 @@ void Interpreter::visit(MaxRoiPool& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_rois_t = pOp.getInput(1);
   void *input_rois = m_ATable[input_rois_t];
   int32_t input_rois_ndim = input_rois_t->getNumOfDimensions();
-  int32_t input_rois_dims[input_rois_ndim];
+  int32_t *input_rois_dims = m_Plan.allocate<int32_t>(input_rois_ndim);
   for (int i = 0; i < input_rois_ndim; ++i) input_rois_dims[i] = input_rois_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   int32_t number_of_pooled_shape = pOp.getPooledShape().vector().size();
-  int32_t pooled_shape[number_of_pooled_shape];
+  int32_t *pooled_shape = m_Plan.allocate<int32_t>(number_of_pooled_shape);
   for (int i = 0; i < number_of_pooled_shape; ++i) pooled_shape[i] = pOp.getPooledShape().at(i);
   float spatial_scale = pOp.getSpatialScale().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_maxroipool_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_rois)
-    , input_rois_ndim, input_rois_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , pooled_shape
-    , number_of_pooled_shape
-    , spatial_scale
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_maxroipool_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_rois)
+      , input_rois_ndim, input_rois_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , pooled_shape
+      , number_of_pooled_shape
+      , spatial_scale
+    );
+  });
 };
 
 
 void Interpreter::visit(Mean& pOp) {
   // Prepare input
   int32_t input_data_0_ntensor = pOp.getNumOfInputs() - 0;
-  void *input_data_0[input_data_0_ntensor];
+  void **input_data_0 = m_Plan.allocate<void *>(input_data_0_ntensor);
   for (int i = 0; i < input_data_0_ntensor; ++i) input_data_0[i] = m_ATable[pOp.getInput(0 + i)];
-  int32_t input_data_0_ndim[input_data_0_ntensor]; // FIXME: = input_data_0_v->sizes().size();
-  int32_t *input_data_0_dims[input_data_0_ntensor]; // FIXME: [input_data_0_ndim[0]];
+  int32_t *input_data_0_ndim = m_Plan.allocate<int32_t>(input_data_0_ntensor); // FIXME: = input_data_0_v->sizes().size();
+  int32_t **input_data_0_dims = m_Plan.allocate<int32_t *>(input_data_0_ntensor); // FIXME: [input_data_0_ndim[0]];
   // FIXME: for (int i = 0; i < input_data_0_ndim; ++i) input_data_0_dims[i] = input_data_0_v->sizes()[i].dim;
   // Prepare output
   Tensor *output_mean_t = pOp.getOutput(0);
   void *output_mean = m_ATable[output_mean_t];
   int32_t output_mean_ndim = output_mean_t->getNumOfDimensions();
-  int32_t output_mean_dims[output_mean_ndim];
+  int32_t *output_mean_dims = m_Plan.allocate<int32_t>(output_mean_ndim);
   for (int i = 0; i < output_mean_ndim; ++i) output_mean_dims[i] = output_mean_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_mean_float(
-    m_pContext
-    , reinterpret_cast<float **>(input_data_0)
-    , input_data_0_ntensor
-    , input_data_0_ndim, input_data_0_dims
-    , reinterpret_cast<float *>(output_mean)
-    , output_mean_ndim, output_mean_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_mean_float(
+      pContext
+      , reinterpret_cast<float **>(input_data_0)
+      , input_data_0_ntensor
+      , input_data_0_ndim, input_data_0_dims
+      , reinterpret_cast<float *>(output_mean)
+      , output_mean_ndim, output_mean_dims
     
-  );
+    );
+  });
 };
 
 
 void Interpreter::visit(Min& pOp) {
   // Prepare input
   int32_t input_data_0_ntensor = pOp.getNumOfInputs() - 0;
-  void *input_data_0[input_data_0_ntensor];
+  void **input_data_0 = m_Plan.allocate<void *>(input_data_0_ntensor);
   for (int i = 0; i < input_data_0_ntensor; ++i) input_data_0[i] = m_ATable[pOp.getInput(0 + i)];
-  int32_t input_data_0_ndim[input_data_0_ntensor]; // FIXME: = input_data_0_v->sizes().size();
-  int32_t *input_data_0_dims[input_data_0_ntensor]; // FIXME: [input_data_0_ndim[0]];
+  int32_t *input_data_0_ndim = m_Plan.allocate<int32_t>(input_data_0_ntensor); // FIXME: = input_data_0_v->sizes().size();
+  int32_t **input_data_0_dims = m_Plan.allocate<int32_t *>(input_data_0_ntensor); // FIXME: [input_data_0_ndim[0]];
   // FIXME: for (int i = 0; i < input_data_0_ndim; ++i) input_data_0_dims[i] = input_data_0_v->sizes()[i].dim;
   // Prepare output
   Tensor *output_min_t = pOp.getOutput(0);
   void *output_min = m_ATable[output_min_t];
   int32_t output_min_ndim = output_min_t->getNumOfDimensions();
-  int32_t output_min_dims[output_min_ndim];
+  int32_t *output_min_dims = m_Plan.allocate<int32_t>(output_min_ndim);
   for (int i = 0; i < output_min_ndim; ++i) output_min_dims[i] = output_min_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_min_float(
-    m_pContext
-    , reinterpret_cast<float **>(input_data_0)
-    , input_data_0_ntensor
-    , input_data_0_ndim, input_data_0_dims
-    , reinterpret_cast<float *>(output_min)
-    , output_min_ndim, output_min_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_min_float(
+      pContext
+      , reinterpret_cast<float **>(input_data_0)
+      , input_data_0_ntensor
+      , input_data_0_ndim, input_data_0_dims
+      , reinterpret_cast<float *>(output_min)
+      , output_min_ndim, output_min_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2192,33 +2094,35 @@ void Interpreter::visit(Mul& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_mul_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_mul_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2227,13 +2131,13 @@ void Interpreter::visit(Multinomial& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t dtype = pOp.getDtype().value();
@@ -2241,16 +2145,18 @@ void Interpreter::visit(Multinomial& pOp) {
   float seed = pOp.getSeed().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_multinomial_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , dtype
-    , sample_size
-    , seed
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_multinomial_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , dtype
+      , sample_size
+      , seed
+    );
+  });
 };
 
 
@@ -2259,26 +2165,28 @@ void Interpreter::visit(Neg& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_neg_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_neg_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2287,26 +2195,28 @@ void Interpreter::visit(Not& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_not_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_not_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2315,33 +2225,35 @@ void Interpreter::visit(Or& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_or_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_or_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2350,33 +2262,35 @@ void Interpreter::visit(PRelu& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_slope_t = pOp.getInput(1);
   void *input_slope = m_ATable[input_slope_t];
   int32_t input_slope_ndim = input_slope_t->getNumOfDimensions();
-  int32_t input_slope_dims[input_slope_ndim];
+  int32_t *input_slope_dims = m_Plan.allocate<int32_t>(input_slope_ndim);
   for (int i = 0; i < input_slope_ndim; ++i) input_slope_dims[i] = input_slope_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_prelu_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_slope)
-    , input_slope_ndim, input_slope_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_prelu_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_slope)
+      , input_slope_ndim, input_slope_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2385,33 +2299,35 @@ void Interpreter::visit(Pad& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   const char * mode = pOp.getMode().value().c_str();
   int32_t number_of_pads = pOp.getPads().vector().size();
-  int32_t pads[number_of_pads];
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
   for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
   float value = pOp.getValue().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_pad_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , mode
-    , pads
-    , number_of_pads
-    , value
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_pad_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , mode
+      , pads
+      , number_of_pads
+      , value
+    );
+  });
 };
 
 
@@ -2420,33 +2336,35 @@ void Interpreter::visit(Pow& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_Y_t = pOp.getInput(1);
   void *input_Y = m_ATable[input_Y_t];
   int32_t input_Y_ndim = input_Y_t->getNumOfDimensions();
-  int32_t input_Y_dims[input_Y_ndim];
+  int32_t *input_Y_dims = m_Plan.allocate<int32_t>(input_Y_ndim);
   for (int i = 0; i < input_Y_ndim; ++i) input_Y_dims[i] = input_Y_t->dimension(i);
   // Prepare output
   Tensor *output_Z_t = pOp.getOutput(0);
   void *output_Z = m_ATable[output_Z_t];
   int32_t output_Z_ndim = output_Z_t->getNumOfDimensions();
-  int32_t output_Z_dims[output_Z_ndim];
+  int32_t *output_Z_dims = m_Plan.allocate<int32_t>(output_Z_ndim);
   for (int i = 0; i < output_Z_ndim; ++i) output_Z_dims[i] = output_Z_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_pow_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_Y)
-    , input_Y_ndim, input_Y_dims
-    , reinterpret_cast<float *>(output_Z)
-    , output_Z_ndim, output_Z_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_pow_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_Y)
+      , input_Y_ndim, input_Y_dims
+      , reinterpret_cast<float *>(output_Z)
+      , output_Z_ndim, output_Z_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2455,17 +2373,17 @@ void Interpreter::visit(RNN& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   Tensor *input_W_t = pOp.getInput(1);
   void *input_W = m_ATable[input_W_t];
   int32_t input_W_ndim = input_W_t->getNumOfDimensions();
-  int32_t input_W_dims[input_W_ndim];
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
   for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
   Tensor *input_R_t = pOp.getInput(2);
   void *input_R = m_ATable[input_R_t];
   int32_t input_R_ndim = input_R_t->getNumOfDimensions();
-  int32_t input_R_dims[input_R_ndim];
+  int32_t *input_R_dims = m_Plan.allocate<int32_t>(input_R_ndim);
   for (int i = 0; i < input_R_ndim; ++i) input_R_dims[i] = input_R_t->dimension(i);
   Tensor *input_B_t = NULL;
   void *input_B = NULL;
@@ -2475,7 +2393,7 @@ void Interpreter::visit(RNN& pOp) {
     input_B = m_ATable[input_B_t];
     input_B_ndim = input_B_t->getNumOfDimensions();
   }
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   Tensor *input_sequence_lens_t = NULL;
   void *input_sequence_lens = NULL;
@@ -2485,7 +2403,7 @@ void Interpreter::visit(RNN& pOp) {
     input_sequence_lens = m_ATable[input_sequence_lens_t];
     input_sequence_lens_ndim = input_sequence_lens_t->getNumOfDimensions();
   }
-  int32_t input_sequence_lens_dims[input_sequence_lens_ndim];
+  int32_t *input_sequence_lens_dims = m_Plan.allocate<int32_t>(input_sequence_lens_ndim);
   for (int i = 0; i < input_sequence_lens_ndim; ++i) input_sequence_lens_dims[i] = input_sequence_lens_t->dimension(i);
   Tensor *input_initial_h_t = NULL;
   void *input_initial_h = NULL;
@@ -2495,7 +2413,7 @@ void Interpreter::visit(RNN& pOp) {
     input_initial_h = m_ATable[input_initial_h_t];
     input_initial_h_ndim = input_initial_h_t->getNumOfDimensions();
   }
-  int32_t input_initial_h_dims[input_initial_h_ndim];
+  int32_t *input_initial_h_dims = m_Plan.allocate<int32_t>(input_initial_h_ndim);
   for (int i = 0; i < input_initial_h_ndim; ++i) input_initial_h_dims[i] = input_initial_h_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = NULL;
@@ -2506,7 +2424,7 @@ void Interpreter::visit(RNN& pOp) {
     output_Y = m_ATable[output_Y_t];
     output_Y_ndim = output_Y_t->getNumOfDimensions();
   }
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   Tensor *output_Y_h_t = NULL;
   void *output_Y_h = NULL;
@@ -2516,51 +2434,53 @@ void Interpreter::visit(RNN& pOp) {
     output_Y_h = m_ATable[output_Y_h_t];
     output_Y_h_ndim = output_Y_h_t->getNumOfDimensions();
   }
-  int32_t output_Y_h_dims[output_Y_h_ndim];
+  int32_t *output_Y_h_dims = m_Plan.allocate<int32_t>(output_Y_h_ndim);
   for (int i = 0; i < output_Y_h_ndim; ++i) output_Y_h_dims[i] = output_Y_h_t->dimension(i);
   // Prepare attributes
   int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
-  float activation_alpha[number_of_activation_alpha];
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
   for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
   int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
-  float activation_beta[number_of_activation_beta];
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
   for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
   int32_t number_of_activations = pOp.getActivations().vector().size();
-  const char * activations[number_of_activations];
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
   for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
   float clip = pOp.getClip().value();
   const char * direction = pOp.getDirection().value().c_str();
   int32_t hidden_size = pOp.getHiddenSize().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_rnn_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(input_W)
-    , input_W_ndim, input_W_dims
-    , reinterpret_cast<float *>(input_R)
-    , input_R_ndim, input_R_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(input_sequence_lens)
-    , input_sequence_lens_ndim, input_sequence_lens_dims
-    , reinterpret_cast<float *>(input_initial_h)
-    , input_initial_h_ndim, input_initial_h_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , reinterpret_cast<float *>(output_Y_h)
-    , output_Y_h_ndim, output_Y_h_dims
-    , activation_alpha
-    , number_of_activation_alpha
-    , activation_beta
-    , number_of_activation_beta
-    , activations
-    , number_of_activations
-    , clip
-    , direction
-    , hidden_size
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_rnn_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_R)
+      , input_R_ndim, input_R_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_sequence_lens)
+      , input_sequence_lens_ndim, input_sequence_lens_dims
+      , reinterpret_cast<float *>(input_initial_h)
+      , input_initial_h_ndim, input_initial_h_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , reinterpret_cast<float *>(output_Y_h)
+      , output_Y_h_ndim, output_Y_h_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , clip
+      , direction
+      , hidden_size
+    );
+  });
 };
 
 
@@ -2571,7 +2491,7 @@ void Interpreter::visit(RandomNormal& pOp) {
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t dtype = pOp.getDtype().value();
@@ -2579,22 +2499,24 @@ void Interpreter::visit(RandomNormal& pOp) {
   float scale = pOp.getScale().value();
   float seed = pOp.getSeed().value();
   int32_t number_of_shape = pOp.getShape().vector().size();
-  int32_t shape[number_of_shape];
+  int32_t *shape = m_Plan.allocate<int32_t>(number_of_shape);
   for (int i = 0; i < number_of_shape; ++i) shape[i] = pOp.getShape().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_randomnormal_float(
-    m_pContext
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_randomnormal_float(
+      pContext
     
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , dtype
-    , mean
-    , scale
-    , seed
-    , shape
-    , number_of_shape
-  );
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , dtype
+      , mean
+      , scale
+      , seed
+      , shape
+      , number_of_shape
+    );
+  });
 };
 
 
@@ -2603,13 +2525,13 @@ void Interpreter::visit(RandomNormalLike& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t dtype = pOp.getDtype().value();
@@ -2618,17 +2540,19 @@ void Interpreter::visit(RandomNormalLike& pOp) {
   float seed = pOp.getSeed().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_randomnormallike_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , dtype
-    , mean
-    , scale
-    , seed
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_randomnormallike_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , dtype
+      , mean
+      , scale
+      , seed
+    );
+  });
 };
 
 
@@ -2639,7 +2563,7 @@ void Interpreter::visit(RandomUniform& pOp) {
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t dtype = pOp.getDtype().value();
@@ -2647,22 +2571,24 @@ void Interpreter::visit(RandomUniform& pOp) {
   float low = pOp.getLow().value();
   float seed = pOp.getSeed().value();
   int32_t number_of_shape = pOp.getShape().vector().size();
-  int32_t shape[number_of_shape];
+  int32_t *shape = m_Plan.allocate<int32_t>(number_of_shape);
   for (int i = 0; i < number_of_shape; ++i) shape[i] = pOp.getShape().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_randomuniform_float(
-    m_pContext
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_randomuniform_float(
+      pContext
     
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , dtype
-    , high
-    , low
-    , seed
-    , shape
-    , number_of_shape
-  );
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , dtype
+      , high
+      , low
+      , seed
+      , shape
+      , number_of_shape
+    );
+  });
 };
 
 
@@ -2671,13 +2597,13 @@ void Interpreter::visit(RandomUniformLike& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t dtype = pOp.getDtype().value();
@@ -2686,17 +2612,19 @@ void Interpreter::visit(RandomUniformLike& pOp) {
   float seed = pOp.getSeed().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_randomuniformlike_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , dtype
-    , high
-    , low
-    , seed
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_randomuniformlike_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , dtype
+      , high
+      , low
+      , seed
+    );
+  });
 };
 
 
@@ -2705,26 +2633,28 @@ void Interpreter::visit(Reciprocal& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_reciprocal_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reciprocal_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -2733,31 +2663,33 @@ void Interpreter::visit(ReduceL1& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducel1_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducel1_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2766,31 +2698,33 @@ void Interpreter::visit(ReduceL2& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducel2_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducel2_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2799,31 +2733,33 @@ void Interpreter::visit(ReduceLogSum& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducelogsum_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducelogsum_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2832,31 +2768,33 @@ void Interpreter::visit(ReduceLogSumExp& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducelogsumexp_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducelogsumexp_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2865,31 +2803,33 @@ void Interpreter::visit(ReduceMax& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducemax_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducemax_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2898,31 +2838,33 @@ void Interpreter::visit(ReduceMean& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducemean_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducemean_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2931,31 +2873,33 @@ void Interpreter::visit(ReduceMin& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducemin_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducemin_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2964,31 +2908,33 @@ void Interpreter::visit(ReduceProd& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reduceprod_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reduceprod_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -2997,31 +2943,33 @@ void Interpreter::visit(ReduceSum& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducesum_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducesum_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -3030,31 +2978,33 @@ void Interpreter::visit(ReduceSumSquare& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_reduced_t = pOp.getOutput(0);
   void *output_reduced = m_ATable[output_reduced_t];
   int32_t output_reduced_ndim = output_reduced_t->getNumOfDimensions();
-  int32_t output_reduced_dims[output_reduced_ndim];
+  int32_t *output_reduced_dims = m_Plan.allocate<int32_t>(output_reduced_ndim);
   for (int i = 0; i < output_reduced_ndim; ++i) output_reduced_dims[i] = output_reduced_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t keepdims = pOp.getKeepdims().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_reducesumsquare_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_reduced)
-    , output_reduced_ndim, output_reduced_dims
-    , axes
-    , number_of_axes
-    , keepdims
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reducesumsquare_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_reduced)
+      , output_reduced_ndim, output_reduced_dims
+      , axes
+      , number_of_axes
+      , keepdims
+    );
+  });
 };
 
 
@@ -3063,26 +3013,28 @@ void Interpreter::visit(Relu& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_relu_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_relu_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3091,33 +3043,35 @@ void Interpreter::visit(Reshape& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   Tensor *input_shape_t = pOp.getInput(1);
   void *input_shape = m_ATable[input_shape_t];
   int32_t input_shape_ndim = input_shape_t->getNumOfDimensions();
-  int32_t input_shape_dims[input_shape_ndim];
+  int32_t *input_shape_dims = m_Plan.allocate<int32_t>(input_shape_ndim);
   for (int i = 0; i < input_shape_ndim; ++i) input_shape_dims[i] = input_shape_t->dimension(i);
   // Prepare output
   Tensor *output_reshaped_t = pOp.getOutput(0);
   void *output_reshaped = m_ATable[output_reshaped_t];
   int32_t output_reshaped_ndim = output_reshaped_t->getNumOfDimensions();
-  int32_t output_reshaped_dims[output_reshaped_ndim];
+  int32_t *output_reshaped_dims = m_Plan.allocate<int32_t>(output_reshaped_ndim);
   for (int i = 0; i < output_reshaped_ndim; ++i) output_reshaped_dims[i] = output_reshaped_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_reshape_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(input_shape)
-    , input_shape_ndim, input_shape_dims
-    , reinterpret_cast<float *>(output_reshaped)
-    , output_reshaped_ndim, output_reshaped_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reshape_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(input_shape)
+      , input_shape_ndim, input_shape_dims
+      , reinterpret_cast<float *>(output_reshaped)
+      , output_reshaped_ndim, output_reshaped_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3126,28 +3080,30 @@ void Interpreter::visit(Selu& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
   float gamma = pOp.getGamma().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_selu_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-    , gamma
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_selu_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+      , gamma
+    );
+  });
 };
 
 
@@ -3156,26 +3112,28 @@ void Interpreter::visit(Shape& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_shape_t = pOp.getOutput(0);
   void *output_shape = m_ATable[output_shape_t];
   int32_t output_shape_ndim = output_shape_t->getNumOfDimensions();
-  int32_t output_shape_dims[output_shape_ndim];
+  int32_t *output_shape_dims = m_Plan.allocate<int32_t>(output_shape_ndim);
   for (int i = 0; i < output_shape_ndim; ++i) output_shape_dims[i] = output_shape_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_shape_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_shape)
-    , output_shape_ndim, output_shape_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_shape_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_shape)
+      , output_shape_ndim, output_shape_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3184,26 +3142,28 @@ void Interpreter::visit(Sigmoid& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_sigmoid_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_sigmoid_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3212,26 +3172,28 @@ void Interpreter::visit(Sin& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_sin_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_sin_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3240,26 +3202,28 @@ void Interpreter::visit(Size& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_size_t = pOp.getOutput(0);
   void *output_size = m_ATable[output_size_t];
   int32_t output_size_ndim = output_size_t->getNumOfDimensions();
-  int32_t output_size_dims[output_size_ndim];
+  int32_t *output_size_dims = m_Plan.allocate<int32_t>(output_size_ndim);
   for (int i = 0; i < output_size_ndim; ++i) output_size_dims[i] = output_size_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_size_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_size)
-    , output_size_ndim, output_size_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_size_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_size)
+      , output_size_ndim, output_size_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3268,39 +3232,41 @@ void Interpreter::visit(Slice& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
   int32_t number_of_ends = pOp.getEnds().vector().size();
-  int32_t ends[number_of_ends];
+  int32_t *ends = m_Plan.allocate<int32_t>(number_of_ends);
   for (int i = 0; i < number_of_ends; ++i) ends[i] = pOp.getEnds().at(i);
   int32_t number_of_starts = pOp.getStarts().vector().size();
-  int32_t starts[number_of_starts];
+  int32_t *starts = m_Plan.allocate<int32_t>(number_of_starts);
   for (int i = 0; i < number_of_starts; ++i) starts[i] = pOp.getStarts().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_slice_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axes
-    , number_of_axes
-    , ends
-    , number_of_ends
-    , starts
-    , number_of_starts
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_slice_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axes
+      , number_of_axes
+      , ends
+      , number_of_ends
+      , starts
+      , number_of_starts
+    );
+  });
 };
 
 
@@ -3309,26 +3275,28 @@ void Interpreter::visit(Softmax& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_softmax_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , axis
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_softmax_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , axis
+    );
+  });
 };
 
 
@@ -3337,26 +3305,28 @@ void Interpreter::visit(Softplus& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_softplus_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_softplus_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3365,26 +3335,28 @@ void Interpreter::visit(Softsign& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_softsign_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_softsign_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3393,26 +3365,28 @@ void Interpreter::visit(SpaceToDepth& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t blocksize = pOp.getBlocksize().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_spacetodepth_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , blocksize
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_spacetodepth_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , blocksize
+    );
+  });
 };
 
 
@@ -3421,33 +3395,35 @@ void Interpreter::visit(Split& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   int32_t output_outputs_ntensor = pOp.getNumOfOutputs() - 0;
-  void *output_outputs[output_outputs_ntensor];
+  void **output_outputs = m_Plan.allocate<void *>(output_outputs_ntensor);
   for (int i = 0; i < output_outputs_ntensor; ++i) output_outputs[i] = m_ATable[pOp.getOutput(0 + i)];
-  int32_t output_outputs_ndim[output_outputs_ntensor]; // FIXME: = output_outputs_v->sizes().size();
-  int32_t *output_outputs_dims[output_outputs_ntensor]; // FIXME: [output_outputs_ndim[0]];
+  int32_t *output_outputs_ndim = m_Plan.allocate<int32_t>(output_outputs_ntensor); // FIXME: = output_outputs_v->sizes().size();
+  int32_t **output_outputs_dims = m_Plan.allocate<int32_t *>(output_outputs_ntensor); // FIXME: [output_outputs_ndim[0]];
   // FIXME: for (int i = 0; i < output_outputs_ndim; ++i) output_outputs_dims[i] = output_outputs_v->sizes()[i].dim;
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
   int32_t number_of_split = pOp.getSplit().vector().size();
-  int32_t split[number_of_split];
+  int32_t *split = m_Plan.allocate<int32_t>(number_of_split);
   for (int i = 0; i < number_of_split; ++i) split[i] = pOp.getSplit().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_split_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float **>(output_outputs)
-    , output_outputs_ntensor
-    , output_outputs_ndim, output_outputs_dims
-    , axis
-    , split
-    , number_of_split
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_split_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float **>(output_outputs)
+      , output_outputs_ntensor
+      , output_outputs_ndim, output_outputs_dims
+      , axis
+      , split
+      , number_of_split
+    );
+  });
 };
 
 
@@ -3456,26 +3432,28 @@ void Interpreter::visit(Sqrt& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_sqrt_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_sqrt_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3484,29 +3462,31 @@ void Interpreter::visit(Squeeze& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_squeezed_t = pOp.getOutput(0);
   void *output_squeezed = m_ATable[output_squeezed_t];
   int32_t output_squeezed_ndim = output_squeezed_t->getNumOfDimensions();
-  int32_t output_squeezed_dims[output_squeezed_ndim];
+  int32_t *output_squeezed_dims = m_Plan.allocate<int32_t>(output_squeezed_ndim);
   for (int i = 0; i < output_squeezed_ndim; ++i) output_squeezed_dims[i] = output_squeezed_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_squeeze_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_squeezed)
-    , output_squeezed_ndim, output_squeezed_dims
-    , axes
-    , number_of_axes
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_squeeze_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_squeezed)
+      , output_squeezed_ndim, output_squeezed_dims
+      , axes
+      , number_of_axes
+    );
+  });
 };
 
 
@@ -3515,63 +3495,67 @@ void Interpreter::visit(Sub& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_sub_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_sub_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
 void Interpreter::visit(Sum& pOp) {
   // Prepare input
   int32_t input_data_0_ntensor = pOp.getNumOfInputs() - 0;
-  void *input_data_0[input_data_0_ntensor];
+  void **input_data_0 = m_Plan.allocate<void *>(input_data_0_ntensor);
   for (int i = 0; i < input_data_0_ntensor; ++i) input_data_0[i] = m_ATable[pOp.getInput(0 + i)];
-  int32_t input_data_0_ndim[input_data_0_ntensor]; // FIXME: = input_data_0_v->sizes().size();
-  int32_t *input_data_0_dims[input_data_0_ntensor]; // FIXME: [input_data_0_ndim[0]];
+  int32_t *input_data_0_ndim = m_Plan.allocate<int32_t>(input_data_0_ntensor); // FIXME: = input_data_0_v->sizes().size();
+  int32_t **input_data_0_dims = m_Plan.allocate<int32_t *>(input_data_0_ntensor); // FIXME: [input_data_0_ndim[0]];
   // FIXME: for (int i = 0; i < input_data_0_ndim; ++i) input_data_0_dims[i] = input_data_0_v->sizes()[i].dim;
   // Prepare output
   Tensor *output_sum_t = pOp.getOutput(0);
   void *output_sum = m_ATable[output_sum_t];
   int32_t output_sum_ndim = output_sum_t->getNumOfDimensions();
-  int32_t output_sum_dims[output_sum_ndim];
+  int32_t *output_sum_dims = m_Plan.allocate<int32_t>(output_sum_ndim);
   for (int i = 0; i < output_sum_ndim; ++i) output_sum_dims[i] = output_sum_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_sum_float(
-    m_pContext
-    , reinterpret_cast<float **>(input_data_0)
-    , input_data_0_ntensor
-    , input_data_0_ndim, input_data_0_dims
-    , reinterpret_cast<float *>(output_sum)
-    , output_sum_ndim, output_sum_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_sum_float(
+      pContext
+      , reinterpret_cast<float **>(input_data_0)
+      , input_data_0_ntensor
+      , input_data_0_ndim, input_data_0_dims
+      , reinterpret_cast<float *>(output_sum)
+      , output_sum_ndim, output_sum_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3580,26 +3564,28 @@ void Interpreter::visit(Tan& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_tan_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_tan_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3608,26 +3594,28 @@ void Interpreter::visit(Tanh& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_tanh_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_tanh_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3636,33 +3624,35 @@ void Interpreter::visit(Tile& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   Tensor *input_repeats_t = pOp.getInput(1);
   void *input_repeats = m_ATable[input_repeats_t];
   int32_t input_repeats_ndim = input_repeats_t->getNumOfDimensions();
-  int32_t input_repeats_dims[input_repeats_ndim];
+  int32_t *input_repeats_dims = m_Plan.allocate<int32_t>(input_repeats_ndim);
   for (int i = 0; i < input_repeats_ndim; ++i) input_repeats_dims[i] = input_repeats_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_tile_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(input_repeats)
-    , input_repeats_ndim, input_repeats_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_tile_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(input_repeats)
+      , input_repeats_ndim, input_repeats_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3671,35 +3661,37 @@ void Interpreter::visit(TopK& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Values_t = pOp.getOutput(0);
   void *output_Values = m_ATable[output_Values_t];
   int32_t output_Values_ndim = output_Values_t->getNumOfDimensions();
-  int32_t output_Values_dims[output_Values_ndim];
+  int32_t *output_Values_dims = m_Plan.allocate<int32_t>(output_Values_ndim);
   for (int i = 0; i < output_Values_ndim; ++i) output_Values_dims[i] = output_Values_t->dimension(i);
   Tensor *output_Indices_t = pOp.getOutput(1);
   void *output_Indices = m_ATable[output_Indices_t];
   int32_t output_Indices_ndim = output_Indices_t->getNumOfDimensions();
-  int32_t output_Indices_dims[output_Indices_ndim];
+  int32_t *output_Indices_dims = m_Plan.allocate<int32_t>(output_Indices_ndim);
   for (int i = 0; i < output_Indices_ndim; ++i) output_Indices_dims[i] = output_Indices_t->dimension(i);
   // Prepare attributes
   int32_t axis = pOp.getAxis().value();
   int32_t k = pOp.getK().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_topk_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Values)
-    , output_Values_ndim, output_Values_dims
-    , reinterpret_cast<float *>(output_Indices)
-    , output_Indices_ndim, output_Indices_dims
-    , axis
-    , k
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_topk_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Values)
+      , output_Values_ndim, output_Values_dims
+      , reinterpret_cast<float *>(output_Indices)
+      , output_Indices_ndim, output_Indices_dims
+      , axis
+      , k
+    );
+  });
 };
 
 
@@ -3708,29 +3700,31 @@ void Interpreter::visit(Transpose& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_transposed_t = pOp.getOutput(0);
   void *output_transposed = m_ATable[output_transposed_t];
   int32_t output_transposed_ndim = output_transposed_t->getNumOfDimensions();
-  int32_t output_transposed_dims[output_transposed_ndim];
+  int32_t *output_transposed_dims = m_Plan.allocate<int32_t>(output_transposed_ndim);
   for (int i = 0; i < output_transposed_ndim; ++i) output_transposed_dims[i] = output_transposed_t->dimension(i);
   // Prepare attributes
   int32_t number_of_perm = pOp.getPerm().vector().size();
-  int32_t perm[number_of_perm];
+  int32_t *perm = m_Plan.allocate<int32_t>(number_of_perm);
   for (int i = 0; i < number_of_perm; ++i) perm[i] = pOp.getPerm().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_transpose_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_transposed)
-    , output_transposed_ndim, output_transposed_dims
-    , perm
-    , number_of_perm
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_transpose_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_transposed)
+      , output_transposed_ndim, output_transposed_dims
+      , perm
+      , number_of_perm
+    );
+  });
 };
 
 
@@ -3739,29 +3733,31 @@ void Interpreter::visit(Unsqueeze& pOp) {
   Tensor *input_data_t = pOp.getInput(0);
   void *input_data = m_ATable[input_data_t];
   int32_t input_data_ndim = input_data_t->getNumOfDimensions();
-  int32_t input_data_dims[input_data_ndim];
+  int32_t *input_data_dims = m_Plan.allocate<int32_t>(input_data_ndim);
   for (int i = 0; i < input_data_ndim; ++i) input_data_dims[i] = input_data_t->dimension(i);
   // Prepare output
   Tensor *output_expanded_t = pOp.getOutput(0);
   void *output_expanded = m_ATable[output_expanded_t];
   int32_t output_expanded_ndim = output_expanded_t->getNumOfDimensions();
-  int32_t output_expanded_dims[output_expanded_ndim];
+  int32_t *output_expanded_dims = m_Plan.allocate<int32_t>(output_expanded_ndim);
   for (int i = 0; i < output_expanded_ndim; ++i) output_expanded_dims[i] = output_expanded_t->dimension(i);
   // Prepare attributes
   int32_t number_of_axes = pOp.getAxes().vector().size();
-  int32_t axes[number_of_axes];
+  int32_t *axes = m_Plan.allocate<int32_t>(number_of_axes);
   for (int i = 0; i < number_of_axes; ++i) axes[i] = pOp.getAxes().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_unsqueeze_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_data)
-    , input_data_ndim, input_data_dims
-    , reinterpret_cast<float *>(output_expanded)
-    , output_expanded_ndim, output_expanded_dims
-    , axes
-    , number_of_axes
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_unsqueeze_float(
+      pContext
+      , reinterpret_cast<float *>(input_data)
+      , input_data_ndim, input_data_dims
+      , reinterpret_cast<float *>(output_expanded)
+      , output_expanded_ndim, output_expanded_dims
+      , axes
+      , number_of_axes
+    );
+  });
 };
 
 
@@ -3770,31 +3766,33 @@ void Interpreter::visit(Upsample& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   const char * mode = pOp.getMode().value().c_str();
   int32_t number_of_scales = pOp.getScales().vector().size();
-  float scales[number_of_scales];
+  float *scales = m_Plan.allocate<float>(number_of_scales);
   for (int i = 0; i < number_of_scales; ++i) scales[i] = pOp.getScales().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_upsample_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , mode
-    , scales
-    , number_of_scales
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_upsample_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , mode
+      , scales
+      , number_of_scales
+    );
+  });
 };
 
 
@@ -3803,65 +3801,69 @@ void Interpreter::visit(Xor& pOp) {
   Tensor *input_A_t = pOp.getInput(0);
   void *input_A = m_ATable[input_A_t];
   int32_t input_A_ndim = input_A_t->getNumOfDimensions();
-  int32_t input_A_dims[input_A_ndim];
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
   for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
   Tensor *input_B_t = pOp.getInput(1);
   void *input_B = m_ATable[input_B_t];
   int32_t input_B_ndim = input_B_t->getNumOfDimensions();
-  int32_t input_B_dims[input_B_ndim];
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
   for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
   // Prepare output
   Tensor *output_C_t = pOp.getOutput(0);
   void *output_C = m_ATable[output_C_t];
   int32_t output_C_ndim = output_C_t->getNumOfDimensions();
-  int32_t output_C_dims[output_C_ndim];
+  int32_t *output_C_dims = m_Plan.allocate<int32_t>(output_C_ndim);
   for (int i = 0; i < output_C_ndim; ++i) output_C_dims[i] = output_C_t->dimension(i);
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_xor_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_A)
-    , input_A_ndim, input_A_dims
-    , reinterpret_cast<float *>(input_B)
-    , input_B_ndim, input_B_dims
-    , reinterpret_cast<float *>(output_C)
-    , output_C_ndim, output_C_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_xor_float(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_C)
+      , output_C_ndim, output_C_dims
     
-  );
+    );
+  });
 };
 
 
 void Interpreter::visit(ATen& pOp) {
   // Prepare input
   int32_t input_input_ntensor = pOp.getNumOfInputs() - 0;
-  void *input_input[input_input_ntensor];
+  void **input_input = m_Plan.allocate<void *>(input_input_ntensor);
   for (int i = 0; i < input_input_ntensor; ++i) input_input[i] = m_ATable[pOp.getInput(0 + i)];
-  int32_t input_input_ndim[input_input_ntensor]; // FIXME: = input_input_v->sizes().size();
-  int32_t *input_input_dims[input_input_ntensor]; // FIXME: [input_input_ndim[0]];
+  int32_t *input_input_ndim = m_Plan.allocate<int32_t>(input_input_ntensor); // FIXME: = input_input_v->sizes().size();
+  int32_t **input_input_dims = m_Plan.allocate<int32_t *>(input_input_ntensor); // FIXME: [input_input_ndim[0]];
   // FIXME: for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_v->sizes()[i].dim;
   // Prepare output
   int32_t output_output_ntensor = pOp.getNumOfOutputs() - 0;
-  void *output_output[output_output_ntensor];
+  void **output_output = m_Plan.allocate<void *>(output_output_ntensor);
   for (int i = 0; i < output_output_ntensor; ++i) output_output[i] = m_ATable[pOp.getOutput(0 + i)];
-  int32_t output_output_ndim[output_output_ntensor]; // FIXME: = output_output_v->sizes().size();
-  int32_t *output_output_dims[output_output_ntensor]; // FIXME: [output_output_ndim[0]];
+  int32_t *output_output_ndim = m_Plan.allocate<int32_t>(output_output_ntensor); // FIXME: = output_output_v->sizes().size();
+  int32_t **output_output_dims = m_Plan.allocate<int32_t *>(output_output_ntensor); // FIXME: [output_output_ndim[0]];
   // FIXME: for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_v->sizes()[i].dim;
   // Prepare attributes
   
 
   // Call to Runtime
-  ONNC_RUNTIME_aten_float(
-    m_pContext
-    , reinterpret_cast<float **>(input_input)
-    , input_input_ntensor
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float **>(output_output)
-    , output_output_ntensor
-    , output_output_ndim, output_output_dims
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_aten_float(
+      pContext
+      , reinterpret_cast<float **>(input_input)
+      , input_input_ntensor
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float **>(output_output)
+      , output_output_ntensor
+      , output_output_ndim, output_output_dims
     
-  );
+    );
+  });
 };
 
 
@@ -3870,28 +3872,30 @@ void Interpreter::visit(Affine& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
   float beta = pOp.getBeta().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_affine_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-    , beta
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_affine_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+      , beta
+    );
+  });
 };
 
 
@@ -3905,40 +3909,42 @@ void Interpreter::visit(ConstantFill& pOp) {
     input_input = m_ATable[input_input_t];
     input_input_ndim = input_input_t->getNumOfDimensions();
   }
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t dtype = pOp.getDtype().value();
   int32_t number_of_extra_shape = pOp.getExtraShape().vector().size();
-  int32_t extra_shape[number_of_extra_shape];
+  int32_t *extra_shape = m_Plan.allocate<int32_t>(number_of_extra_shape);
   for (int i = 0; i < number_of_extra_shape; ++i) extra_shape[i] = pOp.getExtraShape().at(i);
   int32_t input_as_shape = pOp.getInputAsShape().value();
   int32_t number_of_shape = pOp.getShape().vector().size();
-  int32_t shape[number_of_shape];
+  int32_t *shape = m_Plan.allocate<int32_t>(number_of_shape);
   for (int i = 0; i < number_of_shape; ++i) shape[i] = pOp.getShape().at(i);
   float value = pOp.getValue().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_constantfill_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , dtype
-    , extra_shape
-    , number_of_extra_shape
-    , input_as_shape
-    , shape
-    , number_of_shape
-    , value
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_constantfill_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , dtype
+      , extra_shape
+      , number_of_extra_shape
+      , input_as_shape
+      , shape
+      , number_of_shape
+      , value
+    );
+  });
 };
 
 
@@ -3947,34 +3953,36 @@ void Interpreter::visit(Crop& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t number_of_border = pOp.getBorder().vector().size();
-  int32_t border[number_of_border];
+  int32_t *border = m_Plan.allocate<int32_t>(number_of_border);
   for (int i = 0; i < number_of_border; ++i) border[i] = pOp.getBorder().at(i);
   int32_t number_of_scale = pOp.getScale().vector().size();
-  int32_t scale[number_of_scale];
+  int32_t *scale = m_Plan.allocate<int32_t>(number_of_scale);
   for (int i = 0; i < number_of_scale; ++i) scale[i] = pOp.getScale().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_crop_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , border
-    , number_of_border
-    , scale
-    , number_of_scale
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_crop_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , border
+      , number_of_border
+      , scale
+      , number_of_scale
+    );
+  });
 };
 
 
@@ -3983,47 +3991,49 @@ void Interpreter::visit(GRUUnit& pOp) {
   Tensor *input_hidden_prev_t = pOp.getInput(0);
   void *input_hidden_prev = m_ATable[input_hidden_prev_t];
   int32_t input_hidden_prev_ndim = input_hidden_prev_t->getNumOfDimensions();
-  int32_t input_hidden_prev_dims[input_hidden_prev_ndim];
+  int32_t *input_hidden_prev_dims = m_Plan.allocate<int32_t>(input_hidden_prev_ndim);
   for (int i = 0; i < input_hidden_prev_ndim; ++i) input_hidden_prev_dims[i] = input_hidden_prev_t->dimension(i);
   Tensor *input_gates_t = pOp.getInput(1);
   void *input_gates = m_ATable[input_gates_t];
   int32_t input_gates_ndim = input_gates_t->getNumOfDimensions();
-  int32_t input_gates_dims[input_gates_ndim];
+  int32_t *input_gates_dims = m_Plan.allocate<int32_t>(input_gates_ndim);
   for (int i = 0; i < input_gates_ndim; ++i) input_gates_dims[i] = input_gates_t->dimension(i);
   Tensor *input_seq_lengths_t = pOp.getInput(2);
   void *input_seq_lengths = m_ATable[input_seq_lengths_t];
   int32_t input_seq_lengths_ndim = input_seq_lengths_t->getNumOfDimensions();
-  int32_t input_seq_lengths_dims[input_seq_lengths_ndim];
+  int32_t *input_seq_lengths_dims = m_Plan.allocate<int32_t>(input_seq_lengths_ndim);
   for (int i = 0; i < input_seq_lengths_ndim; ++i) input_seq_lengths_dims[i] = input_seq_lengths_t->dimension(i);
   Tensor *input_t_t = pOp.getInput(3);
   void *input_t = m_ATable[input_t_t];
   int32_t input_t_ndim = input_t_t->getNumOfDimensions();
-  int32_t input_t_dims[input_t_ndim];
+  int32_t *input_t_dims = m_Plan.allocate<int32_t>(input_t_ndim);
   for (int i = 0; i < input_t_ndim; ++i) input_t_dims[i] = input_t_t->dimension(i);
   // Prepare output
   Tensor *output_hidden_t = pOp.getOutput(0);
   void *output_hidden = m_ATable[output_hidden_t];
   int32_t output_hidden_ndim = output_hidden_t->getNumOfDimensions();
-  int32_t output_hidden_dims[output_hidden_ndim];
+  int32_t *output_hidden_dims = m_Plan.allocate<int32_t>(output_hidden_ndim);
   for (int i = 0; i < output_hidden_ndim; ++i) output_hidden_dims[i] = output_hidden_t->dimension(i);
   // Prepare attributes
   int32_t drop_states = pOp.getDropStates().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_gruunit_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_hidden_prev)
-    , input_hidden_prev_ndim, input_hidden_prev_dims
-    , reinterpret_cast<float *>(input_gates)
-    , input_gates_ndim, input_gates_dims
-    , reinterpret_cast<float *>(input_seq_lengths)
-    , input_seq_lengths_ndim, input_seq_lengths_dims
-    , reinterpret_cast<float *>(input_t)
-    , input_t_ndim, input_t_dims
-    , reinterpret_cast<float *>(output_hidden)
-    , output_hidden_ndim, output_hidden_dims
-    , drop_states
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_gruunit_float(
+      pContext
+      , reinterpret_cast<float *>(input_hidden_prev)
+      , input_hidden_prev_ndim, input_hidden_prev_dims
+      , reinterpret_cast<float *>(input_gates)
+      , input_gates_ndim, input_gates_dims
+      , reinterpret_cast<float *>(input_seq_lengths)
+      , input_seq_lengths_ndim, input_seq_lengths_dims
+      , reinterpret_cast<float *>(input_t)
+      , input_t_ndim, input_t_dims
+      , reinterpret_cast<float *>(output_hidden)
+      , output_hidden_ndim, output_hidden_dims
+      , drop_states
+    );
+  });
 };
 
 
@@ -4037,41 +4047,43 @@ void Interpreter::visit(GivenTensorFill& pOp) {
     input_shape = m_ATable[input_shape_t];
     input_shape_ndim = input_shape_t->getNumOfDimensions();
   }
-  int32_t input_shape_dims[input_shape_ndim];
+  int32_t *input_shape_dims = m_Plan.allocate<int32_t>(input_shape_ndim);
   for (int i = 0; i < input_shape_ndim; ++i) input_shape_dims[i] = input_shape_t->dimension(i);
   // Prepare output
   Tensor *output_X_t = pOp.getOutput(0);
   void *output_X = m_ATable[output_X_t];
   int32_t output_X_ndim = output_X_t->getNumOfDimensions();
-  int32_t output_X_dims[output_X_ndim];
+  int32_t *output_X_dims = m_Plan.allocate<int32_t>(output_X_ndim);
   for (int i = 0; i < output_X_ndim; ++i) output_X_dims[i] = output_X_t->dimension(i);
   // Prepare attributes
   int32_t number_of_extra_shape = pOp.getExtraShape().vector().size();
-  int32_t extra_shape[number_of_extra_shape];
+  int32_t *extra_shape = m_Plan.allocate<int32_t>(number_of_extra_shape);
   for (int i = 0; i < number_of_extra_shape; ++i) extra_shape[i] = pOp.getExtraShape().at(i);
   int32_t input_as_shape = pOp.getInputAsShape().value();
   int32_t number_of_shape = pOp.getShape().vector().size();
-  int32_t shape[number_of_shape];
+  int32_t *shape = m_Plan.allocate<int32_t>(number_of_shape);
   for (int i = 0; i < number_of_shape; ++i) shape[i] = pOp.getShape().at(i);
   int32_t number_of_values = pOp.getValues().vector().size();
-  float values[number_of_values];
+  float *values = m_Plan.allocate<float>(number_of_values);
   for (int i = 0; i < number_of_values; ++i) values[i] = pOp.getValues().at(i);
 
   // Call to Runtime
-  ONNC_RUNTIME_giventensorfill_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_shape)
-    , input_shape_ndim, input_shape_dims
-    , reinterpret_cast<float *>(output_X)
-    , output_X_ndim, output_X_dims
-    , extra_shape
-    , number_of_extra_shape
-    , input_as_shape
-    , shape
-    , number_of_shape
-    , values
-    , number_of_values
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_giventensorfill_float(
+      pContext
+      , reinterpret_cast<float *>(input_shape)
+      , input_shape_ndim, input_shape_dims
+      , reinterpret_cast<float *>(output_X)
+      , output_X_ndim, output_X_dims
+      , extra_shape
+      , number_of_extra_shape
+      , input_as_shape
+      , shape
+      , number_of_shape
+      , values
+      , number_of_values
+    );
+  });
 };
 
 
@@ -4080,31 +4092,33 @@ void Interpreter::visit(ImageScaler& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t number_of_bias = pOp.getBias().vector().size();
-  float bias[number_of_bias];
+  float *bias = m_Plan.allocate<float>(number_of_bias);
   for (int i = 0; i < number_of_bias; ++i) bias[i] = pOp.getBias().at(i);
   float scale = pOp.getScale().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_imagescaler_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , bias
-    , number_of_bias
-    , scale
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_imagescaler_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , bias
+      , number_of_bias
+      , scale
+    );
+  });
 };
 
 
@@ -4113,28 +4127,30 @@ void Interpreter::visit(MeanVarianceNormalization& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   int32_t across_channels = pOp.getAcrossChannels().value();
   int32_t normalize_variance = pOp.getNormalizeVariance().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_meanvariancenormalization_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , across_channels
-    , normalize_variance
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_meanvariancenormalization_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , across_channels
+      , normalize_variance
+    );
+  });
 };
 
 
@@ -4143,28 +4159,30 @@ void Interpreter::visit(ParametricSoftplus& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
   float beta = pOp.getBeta().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_parametricsoftplus_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-    , beta
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_parametricsoftplus_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+      , beta
+    );
+  });
 };
 
 
@@ -4173,26 +4191,28 @@ void Interpreter::visit(Scale& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   float scale = pOp.getScale().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_scale_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , scale
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_scale_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , scale
+    );
+  });
 };
 
 
@@ -4201,28 +4221,30 @@ void Interpreter::visit(ScaledTanh& pOp) {
   Tensor *input_input_t = pOp.getInput(0);
   void *input_input = m_ATable[input_input_t];
   int32_t input_input_ndim = input_input_t->getNumOfDimensions();
-  int32_t input_input_dims[input_input_ndim];
+  int32_t *input_input_dims = m_Plan.allocate<int32_t>(input_input_ndim);
   for (int i = 0; i < input_input_ndim; ++i) input_input_dims[i] = input_input_t->dimension(i);
   // Prepare output
   Tensor *output_output_t = pOp.getOutput(0);
   void *output_output = m_ATable[output_output_t];
   int32_t output_output_ndim = output_output_t->getNumOfDimensions();
-  int32_t output_output_dims[output_output_ndim];
+  int32_t *output_output_dims = m_Plan.allocate<int32_t>(output_output_ndim);
   for (int i = 0; i < output_output_ndim; ++i) output_output_dims[i] = output_output_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
   float beta = pOp.getBeta().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_scaledtanh_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_input)
-    , input_input_ndim, input_input_dims
-    , reinterpret_cast<float *>(output_output)
-    , output_output_ndim, output_output_dims
-    , alpha
-    , beta
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_scaledtanh_float(
+      pContext
+      , reinterpret_cast<float *>(input_input)
+      , input_input_ndim, input_input_dims
+      , reinterpret_cast<float *>(output_output)
+      , output_output_ndim, output_output_dims
+      , alpha
+      , beta
+    );
+  });
 };
 
 
@@ -4231,25 +4253,27 @@ void Interpreter::visit(ThresholdedRelu& pOp) {
   Tensor *input_X_t = pOp.getInput(0);
   void *input_X = m_ATable[input_X_t];
   int32_t input_X_ndim = input_X_t->getNumOfDimensions();
-  int32_t input_X_dims[input_X_ndim];
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
   for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
   // Prepare output
   Tensor *output_Y_t = pOp.getOutput(0);
   void *output_Y = m_ATable[output_Y_t];
   int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
-  int32_t output_Y_dims[output_Y_ndim];
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
   for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
   // Prepare attributes
   float alpha = pOp.getAlpha().value();
 
   // Call to Runtime
-  ONNC_RUNTIME_thresholdedrelu_float(
-    m_pContext
-    , reinterpret_cast<float *>(input_X)
-    , input_X_ndim, input_X_dims
-    , reinterpret_cast<float *>(output_Y)
-    , output_Y_ndim, output_Y_dims
-    , alpha
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_thresholdedrelu_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+    );
+  });
 };
 
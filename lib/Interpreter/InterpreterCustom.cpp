@@ -0,0 +1,893 @@
+//===- InterpreterCustom.cpp ----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// Interpreter visitors which code_generator.py does not generate: the ONNC
+// operators, which have no ONNX schema, and the ONNX operators listed in
+// INTERPRETER_CUSTOM_OPERS.
+#include <onnc/Interpreter/Interpreter.h>
+#include <onnc/IR/Compute/BatchNormalizationNCHWc.h>
+#include <onnc/IR/Compute/Concat.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/ConvNCHWc.h>
+#include <onnc/IR/Compute/Dequantize.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Int8Conv.h>
+#include <onnc/IR/Compute/Int8Gemm.h>
+#include <onnc/IR/Compute/MatMul.h>
+#include <onnc/IR/Compute/PoolNCHWc.h>
+#include <onnc/IR/Compute/Quantize.h>
+#include <onnc/IR/Compute/Reorder.h>
+#include <onnc/IR/Compute/WinogradConv.h>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/onnc-runtime.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// Interpreter
+//===----------------------------------------------------------------------===//
+void Interpreter::visit(BatchNormalizationNCHWc& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  Tensor *input_scale_t = pOp.getInput(1);
+  void *input_scale = m_ATable[input_scale_t];
+  int32_t input_scale_ndim = input_scale_t->getNumOfDimensions();
+  int32_t *input_scale_dims = m_Plan.allocate<int32_t>(input_scale_ndim);
+  for (int i = 0; i < input_scale_ndim; ++i) input_scale_dims[i] = input_scale_t->dimension(i);
+  Tensor *input_B_t = pOp.getInput(2);
+  void *input_B = m_ATable[input_B_t];
+  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  Tensor *input_mean_t = pOp.getInput(3);
+  void *input_mean = m_ATable[input_mean_t];
+  int32_t input_mean_ndim = input_mean_t->getNumOfDimensions();
+  int32_t *input_mean_dims = m_Plan.allocate<int32_t>(input_mean_ndim);
+  for (int i = 0; i < input_mean_ndim; ++i) input_mean_dims[i] = input_mean_t->dimension(i);
+  Tensor *input_var_t = pOp.getInput(4);
+  void *input_var = m_ATable[input_var_t];
+  int32_t input_var_ndim = input_var_t->getNumOfDimensions();
+  int32_t *input_var_dims = m_Plan.allocate<int32_t>(input_var_ndim);
+  for (int i = 0; i < input_var_ndim; ++i) input_var_dims[i] = input_var_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  float epsilon = pOp.getEpsilon().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_batchnormalizationnchwc_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_scale)
+      , input_scale_ndim, input_scale_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_mean)
+      , input_mean_ndim, input_mean_dims
+      , reinterpret_cast<float *>(input_var)
+      , input_var_ndim, input_var_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , epsilon
+    );
+  });
+}
+
+void Interpreter::visit(Concat& pOp) {
+  // Prepare input
+  int32_t input_inputs_ntensor = pOp.getNumOfInputs() - 0;
+  void **input_inputs = m_Plan.allocate<void *>(input_inputs_ntensor);
+  int32_t *input_inputs_ndim = m_Plan.allocate<int32_t>(input_inputs_ntensor);
+  int32_t **input_inputs_dims = m_Plan.allocate<int32_t *>(input_inputs_ntensor);
+  for (int i = 0; i < input_inputs_ntensor; ++i){
+    input_inputs[i] = m_ATable[pOp.getInput(0 + i)];
+    input_inputs_ndim[i] = pOp.getInput(0 + i)->getNumOfDimensions();
+    input_inputs_dims[i] = m_Plan.allocate<int32_t>(input_inputs_ndim[i]);
+    for(int32_t j = 0; j < input_inputs_ndim[i]; ++j){
+      input_inputs_dims[i][j] = pOp.getInput(0 + i)->dimension(j);
+    }
+  }
+  // Prepare output
+  Tensor *output_concat_result_t = pOp.getOutput(0);
+  void *output_concat_result = m_ATable[output_concat_result_t];
+  int32_t output_concat_result_ndim = output_concat_result_t->getNumOfDimensions();
+  int32_t *output_concat_result_dims = m_Plan.allocate<int32_t>(output_concat_result_ndim);
+  for (int i = 0; i < output_concat_result_ndim; ++i) output_concat_result_dims[i] = output_concat_result_t->dimension(i);
+  // Prepare attributes
+  int32_t axis = pOp.getAxis().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_concat_float(
+      pContext
+      , reinterpret_cast<float **>(input_inputs)
+      , input_inputs_ntensor
+      , input_inputs_ndim, input_inputs_dims
+      , reinterpret_cast<float *>(output_concat_result)
+      , output_concat_result_ndim, output_concat_result_dims
+      , axis
+    );
+  });
+}
+
+void Interpreter::visit(Conv& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  Tensor *input_W_t = pOp.getInput(1);
+  void *input_W = m_ATable[input_W_t];
+  int32_t input_W_ndim = input_W_t->getNumOfDimensions();
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
+  for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
+  Tensor *input_B_t = NULL;
+  void *input_B = NULL;
+  int32_t input_B_ndim = 0;
+  if (pOp.getNumOfInputs() > 2) {
+    input_B_t = pOp.getInput(2);
+    input_B = m_ATable[input_B_t];
+    input_B_ndim = input_B_t->getNumOfDimensions();
+  }
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t weight_type = input_W_t->kind();
+  const char * auto_pad = pOp.getAutoPad().value().c_str();
+  int32_t number_of_dilations = pOp.getDilations().vector().size();
+  int32_t *dilations = m_Plan.allocate<int32_t>(number_of_dilations);
+  for (int i = 0; i < number_of_dilations; ++i) dilations[i] = pOp.getDilations().at(i);
+  int32_t group = pOp.getGroup().value();
+  int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
+  for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
+  int32_t number_of_pads = pOp.getPads().vector().size();
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
+  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
+  int32_t number_of_strides = pOp.getStrides().vector().size();
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
+  for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_conv_mixed(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , input_W
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , auto_pad
+      , dilations
+      , number_of_dilations
+      , group
+      , kernel_shape
+      , number_of_kernel_shape
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+      , weight_type
+    );
+  });
+}
+
+void Interpreter::visit(ConvNCHWc& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  Tensor *input_W_t = pOp.getInput(1);
+  void *input_W = m_ATable[input_W_t];
+  int32_t input_W_ndim = input_W_t->getNumOfDimensions();
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
+  for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
+  Tensor *input_B_t = NULL;
+  void *input_B = NULL;
+  int32_t input_B_ndim = 0;
+  if (pOp.getNumOfInputs() > 2) {
+    input_B_t = pOp.getInput(2);
+    input_B = m_ATable[input_B_t];
+    input_B_ndim = input_B_t->getNumOfDimensions();
+  }
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
+  for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
+  int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
+  for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
+  int32_t number_of_activations = pOp.getActivations().vector().size();
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
+  for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
+  int32_t number_of_dilations = pOp.getDilations().vector().size();
+  int32_t *dilations = m_Plan.allocate<int32_t>(number_of_dilations);
+  for (int i = 0; i < number_of_dilations; ++i) dilations[i] = pOp.getDilations().at(i);
+  int32_t number_of_pads = pOp.getPads().vector().size();
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
+  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
+  int32_t number_of_strides = pOp.getStrides().vector().size();
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
+  for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_convnchwc_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , dilations
+      , number_of_dilations
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+    );
+  });
+}
+
+void Interpreter::visit(Dequantize& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  float scale = pOp.getScale().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_dequantize_float(
+      pContext
+      , reinterpret_cast<int8_t *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , scale
+    );
+  });
+}
+
+void Interpreter::visit(FusedConv& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  Tensor *input_W_t = pOp.getInput(1);
+  void *input_W = m_ATable[input_W_t];
+  int32_t input_W_ndim = input_W_t->getNumOfDimensions();
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
+  for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
+  Tensor *input_B_t = NULL;
+  void *input_B = NULL;
+  int32_t input_B_ndim = 0;
+  if (pOp.getNumOfInputs() > 2) {
+    input_B_t = pOp.getInput(2);
+    input_B = m_ATable[input_B_t];
+    input_B_ndim = input_B_t->getNumOfDimensions();
+  }
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t weight_type = input_W_t->kind();
+  int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
+  for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
+  int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
+  for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
+  int32_t number_of_activations = pOp.getActivations().vector().size();
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
+  for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
+  const char * auto_pad = pOp.getAutoPad().value().c_str();
+  int32_t number_of_dilations = pOp.getDilations().vector().size();
+  int32_t *dilations = m_Plan.allocate<int32_t>(number_of_dilations);
+  for (int i = 0; i < number_of_dilations; ++i) dilations[i] = pOp.getDilations().at(i);
+  int32_t group = pOp.getGroup().value();
+  int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
+  for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
+  int32_t number_of_pads = pOp.getPads().vector().size();
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
+  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
+  int32_t number_of_strides = pOp.getStrides().vector().size();
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
+  for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_fusedconv_mixed(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , input_W
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , auto_pad
+      , dilations
+      , number_of_dilations
+      , group
+      , kernel_shape
+      , number_of_kernel_shape
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+      , weight_type
+    );
+  });
+}
+
+void Interpreter::visit(FusedElementwise& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
+  for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
+  int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
+  for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
+  int32_t number_of_activations = pOp.getActivations().vector().size();
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
+  for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_fusedelementwise_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+    );
+  });
+}
+
+void Interpreter::visit(FusedGemm& pOp) {
+  // Prepare input
+  Tensor *input_A_t = pOp.getInput(0);
+  void *input_A = m_ATable[input_A_t];
+  int32_t input_A_ndim = input_A_t->getNumOfDimensions();
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
+  for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
+  Tensor *input_B_t = pOp.getInput(1);
+  void *input_B = m_ATable[input_B_t];
+  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  Tensor *input_C_t = pOp.getInput(2);
+  void *input_C = m_ATable[input_C_t];
+  int32_t input_C_ndim = input_C_t->getNumOfDimensions();
+  int32_t *input_C_dims = m_Plan.allocate<int32_t>(input_C_ndim);
+  for (int i = 0; i < input_C_ndim; ++i) input_C_dims[i] = input_C_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t weight_type = input_B_t->kind();
+  int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
+  for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
+  int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
+  for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
+  int32_t number_of_activations = pOp.getActivations().vector().size();
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
+  for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
+  float alpha = pOp.getAlpha().value();
+  float beta = pOp.getBeta().value();
+  int32_t transA = pOp.getTransA().value();
+  int32_t transB = pOp.getTransB().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_fusedgemm_mixed(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , input_B
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_C)
+      , input_C_ndim, input_C_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , alpha
+      , beta
+      , transA
+      , transB
+      , weight_type
+    );
+  });
+}
+
+void Interpreter::visit(Gemm& pOp) {
+  // Prepare input
+  Tensor *input_A_t = pOp.getInput(0);
+  void *input_A = m_ATable[input_A_t];
+  int32_t input_A_ndim = input_A_t->getNumOfDimensions();
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
+  for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
+  Tensor *input_B_t = pOp.getInput(1);
+  void *input_B = m_ATable[input_B_t];
+  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  Tensor *input_C_t = pOp.getInput(2);
+  void *input_C = m_ATable[input_C_t];
+  int32_t input_C_ndim = input_C_t->getNumOfDimensions();
+  int32_t *input_C_dims = m_Plan.allocate<int32_t>(input_C_ndim);
+  for (int i = 0; i < input_C_ndim; ++i) input_C_dims[i] = input_C_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t weight_type = input_B_t->kind();
+  float alpha = pOp.getAlpha().value();
+  float beta = pOp.getBeta().value();
+  int32_t transA = pOp.getTransA().value();
+  int32_t transB = pOp.getTransB().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_gemm_mixed(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , input_B
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_C)
+      , input_C_ndim, input_C_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , alpha
+      , beta
+      , transA
+      , transB
+      , weight_type
+    );
+  });
+}
+
+void Interpreter::visit(Int8Conv& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  Tensor *input_W_t = pOp.getInput(1);
+  void *input_W = m_ATable[input_W_t];
+  int32_t input_W_ndim = input_W_t->getNumOfDimensions();
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
+  for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
+  Tensor *input_B_t = NULL;
+  void *input_B = NULL;
+  int32_t input_B_ndim = 0;
+  if (pOp.getNumOfInputs() > 2) {
+    input_B_t = pOp.getInput(2);
+    input_B = m_ATable[input_B_t];
+    input_B_ndim = input_B_t->getNumOfDimensions();
+  }
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t number_of_dilations = pOp.getDilations().vector().size();
+  int32_t *dilations = m_Plan.allocate<int32_t>(number_of_dilations);
+  for (int i = 0; i < number_of_dilations; ++i) dilations[i] = pOp.getDilations().at(i);
+  int32_t group = pOp.getGroup().value();
+  int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
+  for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
+  float output_scale = pOp.getOutputScale().value();
+  int32_t number_of_pads = pOp.getPads().vector().size();
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
+  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
+  int32_t relu = pOp.getRelu().value();
+  int32_t number_of_scales = pOp.getScales().vector().size();
+  float *scales = m_Plan.allocate<float>(number_of_scales);
+  for (int i = 0; i < number_of_scales; ++i) scales[i] = pOp.getScales().at(i);
+  int32_t number_of_strides = pOp.getStrides().vector().size();
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
+  for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_int8conv_float(
+      pContext
+      , reinterpret_cast<int8_t *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<int8_t *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<int8_t *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , dilations
+      , number_of_dilations
+      , group
+      , kernel_shape
+      , number_of_kernel_shape
+      , output_scale
+      , pads
+      , number_of_pads
+      , relu
+      , scales
+      , number_of_scales
+      , strides
+      , number_of_strides
+    );
+  });
+}
+
+void Interpreter::visit(Int8Gemm& pOp) {
+  // Prepare input
+  Tensor *input_A_t = pOp.getInput(0);
+  void *input_A = m_ATable[input_A_t];
+  int32_t input_A_ndim = input_A_t->getNumOfDimensions();
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
+  for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
+  Tensor *input_B_t = pOp.getInput(1);
+  void *input_B = m_ATable[input_B_t];
+  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  Tensor *input_C_t = NULL;
+  void *input_C = NULL;
+  int32_t input_C_ndim = 0;
+  if (pOp.getNumOfInputs() > 2) {
+    input_C_t = pOp.getInput(2);
+    input_C = m_ATable[input_C_t];
+    input_C_ndim = input_C_t->getNumOfDimensions();
+  }
+  int32_t *input_C_dims = m_Plan.allocate<int32_t>(input_C_ndim);
+  for (int i = 0; i < input_C_ndim; ++i) input_C_dims[i] = input_C_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  float output_scale = pOp.getOutputScale().value();
+  int32_t relu = pOp.getRelu().value();
+  int32_t number_of_scales = pOp.getScales().vector().size();
+  float *scales = m_Plan.allocate<float>(number_of_scales);
+  for (int i = 0; i < number_of_scales; ++i) scales[i] = pOp.getScales().at(i);
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_int8gemm_float(
+      pContext
+      , reinterpret_cast<int8_t *>(input_A)
+      , input_A_ndim, input_A_dims
+      , reinterpret_cast<int8_t *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(input_C)
+      , input_C_ndim, input_C_dims
+      , reinterpret_cast<int8_t *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , output_scale
+      , relu
+      , scales
+      , number_of_scales
+    );
+  });
+}
+
+void Interpreter::visit(MatMul& pOp) {
+  // Prepare input
+  Tensor *input_A_t = pOp.getInput(0);
+  void *input_A = m_ATable[input_A_t];
+  int32_t input_A_ndim = input_A_t->getNumOfDimensions();
+  int32_t *input_A_dims = m_Plan.allocate<int32_t>(input_A_ndim);
+  for (int i = 0; i < input_A_ndim; ++i) input_A_dims[i] = input_A_t->dimension(i);
+  Tensor *input_B_t = pOp.getInput(1);
+  void *input_B = m_ATable[input_B_t];
+  int32_t input_B_ndim = input_B_t->getNumOfDimensions();
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t weight_type = input_B_t->kind();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_matmul_mixed(
+      pContext
+      , reinterpret_cast<float *>(input_A)
+      , input_A_ndim, input_A_dims
+      , input_B
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , weight_type
+    );
+  });
+}
+
+void Interpreter::visit(PoolNCHWc& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t count_include_pad = pOp.getCountIncludePad().value();
+  int32_t number_of_kernel_shape = pOp.getKernelShape().vector().size();
+  int32_t *kernel_shape = m_Plan.allocate<int32_t>(number_of_kernel_shape);
+  for (int i = 0; i < number_of_kernel_shape; ++i) kernel_shape[i] = pOp.getKernelShape().at(i);
+  const char * mode = pOp.getMode().value().c_str();
+  int32_t number_of_pads = pOp.getPads().vector().size();
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
+  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
+  int32_t number_of_strides = pOp.getStrides().vector().size();
+  int32_t *strides = m_Plan.allocate<int32_t>(number_of_strides);
+  for (int i = 0; i < number_of_strides; ++i) strides[i] = pOp.getStrides().at(i);
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_poolnchwc_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , count_include_pad
+      , kernel_shape
+      , number_of_kernel_shape
+      , mode
+      , pads
+      , number_of_pads
+      , strides
+      , number_of_strides
+    );
+  });
+}
+
+void Interpreter::visit(Quantize& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  float scale = pOp.getScale().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_quantize_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<int8_t *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , scale
+    );
+  });
+}
+
+void Interpreter::visit(Reorder& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_reorder_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+    );
+  });
+}
+
+void Interpreter::visit(WinogradConv& pOp) {
+  // Prepare input
+  Tensor *input_X_t = pOp.getInput(0);
+  void *input_X = m_ATable[input_X_t];
+  int32_t input_X_ndim = input_X_t->getNumOfDimensions();
+  int32_t *input_X_dims = m_Plan.allocate<int32_t>(input_X_ndim);
+  for (int i = 0; i < input_X_ndim; ++i) input_X_dims[i] = input_X_t->dimension(i);
+  Tensor *input_W_t = pOp.getInput(1);
+  void *input_W = m_ATable[input_W_t];
+  int32_t input_W_ndim = input_W_t->getNumOfDimensions();
+  int32_t *input_W_dims = m_Plan.allocate<int32_t>(input_W_ndim);
+  for (int i = 0; i < input_W_ndim; ++i) input_W_dims[i] = input_W_t->dimension(i);
+  Tensor *input_B_t = NULL;
+  void *input_B = NULL;
+  int32_t input_B_ndim = 0;
+  if (pOp.getNumOfInputs() > 2) {
+    input_B_t = pOp.getInput(2);
+    input_B = m_ATable[input_B_t];
+    input_B_ndim = input_B_t->getNumOfDimensions();
+  }
+  int32_t *input_B_dims = m_Plan.allocate<int32_t>(input_B_ndim);
+  for (int i = 0; i < input_B_ndim; ++i) input_B_dims[i] = input_B_t->dimension(i);
+  // Prepare output
+  Tensor *output_Y_t = pOp.getOutput(0);
+  void *output_Y = m_ATable[output_Y_t];
+  int32_t output_Y_ndim = output_Y_t->getNumOfDimensions();
+  int32_t *output_Y_dims = m_Plan.allocate<int32_t>(output_Y_ndim);
+  for (int i = 0; i < output_Y_ndim; ++i) output_Y_dims[i] = output_Y_t->dimension(i);
+  // Prepare attributes
+  int32_t number_of_activation_alpha = pOp.getActivationAlpha().vector().size();
+  float *activation_alpha = m_Plan.allocate<float>(number_of_activation_alpha);
+  for (int i = 0; i < number_of_activation_alpha; ++i) activation_alpha[i] = pOp.getActivationAlpha().at(i);
+  int32_t number_of_activation_beta = pOp.getActivationBeta().vector().size();
+  float *activation_beta = m_Plan.allocate<float>(number_of_activation_beta);
+  for (int i = 0; i < number_of_activation_beta; ++i) activation_beta[i] = pOp.getActivationBeta().at(i);
+  int32_t number_of_activations = pOp.getActivations().vector().size();
+  const char **activations = m_Plan.allocate<const char *>(number_of_activations);
+  for (int i = 0; i < number_of_activations; ++i) activations[i] = pOp.getActivations().at(i).c_str();
+  int32_t number_of_pads = pOp.getPads().vector().size();
+  int32_t *pads = m_Plan.allocate<int32_t>(number_of_pads);
+  for (int i = 0; i < number_of_pads; ++i) pads[i] = pOp.getPads().at(i);
+  int32_t tile = pOp.getTile().value();
+
+  // Call to Runtime
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_winogradconv_float(
+      pContext
+      , reinterpret_cast<float *>(input_X)
+      , input_X_ndim, input_X_dims
+      , reinterpret_cast<float *>(input_W)
+      , input_W_ndim, input_W_dims
+      , reinterpret_cast<float *>(input_B)
+      , input_B_ndim, input_B_dims
+      , reinterpret_cast<float *>(output_Y)
+      , output_Y_ndim, output_Y_dims
+      , activation_alpha
+      , number_of_activation_alpha
+      , activation_beta
+      , number_of_activation_beta
+      , activations
+      , number_of_activations
+      , pads
+      , number_of_pads
+      , tile
+    );
+  });
+}
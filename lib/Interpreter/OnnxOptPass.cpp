@@ -5,7 +5,7 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#include "OnnxOptPass.h"
+#include <onnc/Interpreter/OnnxOptPass.h>
 
 #include <onnc/Config/ONNX.h>
 #include <onnc/IR/ONNXUtils.h>
@@ -26,8 +26,10 @@ Pass::ReturnType OnnxOptPass::runOnModule(Module &pModule)
 {
   onnxInferShape(pModule);
 
+  // the optimizer folds weights, e.g. batch normalization into convolution,
+  // so it needs all payloads
   xProto mp;
-  onnc::ExportModelProto(mp, pModule);
+  onnc::ExportModelProto(mp, pModule, onnc::kAllPayloads);
   mp = onnx::optimization::Optimize(mp, {
     "extract_constant_to_initializer",
     "fuse_add_bias_into_conv",
@@ -40,6 +42,7 @@ Pass::ReturnType OnnxOptPass::runOnModule(Module &pModule)
     "eliminate_nop_transpose",
     "eliminate_unused_initializer"
   });
+  ReleaseExternalData(mp, pModule);
   pModule.delegate(xImportModelProto(mp));
 
   return Pass::kModuleChanged;
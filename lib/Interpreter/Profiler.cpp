@@ -0,0 +1,445 @@
+//===- Profiler.cpp -------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Interpreter/Profiler.h>
+
+#include <onnc/IR/Compute/AveragePool.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/LpPool.h>
+#include <onnc/IR/Compute/MaxPool.h>
+#include <onnc/IR/Compute/PoolNCHWc.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/JSON/Array.h>
+#include <onnc/JSON/Value.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IndentOStream.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+using namespace onnc;
+
+namespace {
+
+/// Operators the report lists one by one; the rest only count in the types.
+const size_t kNumOfTopOperators = 20;
+
+uint64_t elements(const Value* pValue)
+{
+  uint64_t size = 1;
+  for (int64_t dim : static_cast<const Tensor*>(pValue)->getDimensions())
+    size *= dim;
+  return size;
+}
+
+/// The size of pValue in bytes: quantized tensors are int8, narrowed weights
+/// 16-bit floats, everything else float.
+uint64_t bytes(const Value* pValue)
+{
+  switch (pValue->kind()) {
+  case Value::kInt8:
+    return elements(pValue) * sizeof(int8_t);
+  case Value::kFloat16:
+  case Value::kBFloat16:
+    return elements(pValue) * sizeof(uint16_t);
+  default:
+    return elements(pValue) * sizeof(float);
+  }
+}
+
+/// The product of the dimensions of pValue from pFirst on.
+uint64_t elements(const Value* pValue, unsigned int pFirst)
+{
+  const Tensor::Dimensions& dims =
+      static_cast<const Tensor*>(pValue)->getDimensions();
+  uint64_t size = 1;
+  for (unsigned int i = pFirst; i < dims.size(); ++i)
+    size *= dims[i];
+  return size;
+}
+
+uint64_t product(const IntsAttr& pAttr)
+{
+  uint64_t size = 1;
+  for (int64_t v : pAttr.vector())
+    size *= v;
+  return size;
+}
+
+/// Floating point operations per second, in GFLOP/s. Per ns they are
+/// already in G.
+double perSecond(uint64_t pAmount, Timer::Interval pTime)
+{
+  return static_cast<double>(pAmount) / std::max<Timer::Interval>(pTime, 1);
+}
+
+/// Move-only ops: they only copy, reorder or look up elements.
+bool isDataMovement(StringRef pType)
+{
+  static const char* const kTypes[] = {
+    "Concat", "Expand", "Flatten", "Gather", "Identity", "Pad", "Reorder",
+    "Reshape", "Shape", "Size", "Slice", "Split", "Squeeze", "Tile",
+    "Transpose", "Unsqueeze", "Upsample"
+  };
+  for (const char* type : kTypes)
+    if (pType == type)
+      return true;
+  return false;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// Profiler
+//===----------------------------------------------------------------------===//
+Profiler::Profiler(const ExecutionPlan& pPlan)
+  : m_Records(), m_Runs(), m_Origin(Timer::now()) {
+  for (const ExecutionPlan::Step& step : pPlan.steps()) {
+    Record record;
+    record.op = step.op;
+    if (0 < step.op->getNumOfOutputs())
+      record.name = step.op->getOutput(0)->getName();
+    record.cost = GetCost(*step.op);
+    m_Records.push_back(record);
+  }
+}
+
+void Profiler::beginRun()
+{
+  m_Runs.push_back(Run{Timer::now(), 0});
+}
+
+void Profiler::endRun()
+{
+  m_Runs.back().duration = Timer::now() - m_Runs.back().start;
+}
+
+void Profiler::record(size_t pIdx, Timer::Interval pStart,
+                      Timer::Interval pEnd)
+{
+  m_Records[pIdx].samples.push_back(
+      Sample{static_cast<unsigned int>(m_Runs.size() - 1), pStart,
+             pEnd - pStart, std::this_thread::get_id()});
+}
+
+Profiler::Cost Profiler::GetCost(const ComputeOperator& pOp)
+{
+  Cost cost{0, 0};
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i)
+    cost.bytes += bytes(pOp.getInput(i));
+  for (unsigned int i = 0; i < pOp.getNumOfOutputs(); ++i)
+    cost.bytes += bytes(pOp.getOutput(i));
+  if (0 == pOp.getNumOfOutputs())
+    return cost;
+
+  StringRef type = pOp.name();
+  uint64_t out = elements(pOp.getOutput(0));
+  if (type == "Conv" || type == "FusedConv" || type == "Int8Conv") {
+    // Every output element is a dot product over the kernel of one group.
+    cost.flops = 2 * out * elements(pOp.getInput(1), 1);
+    if (2 < pOp.getNumOfInputs())
+      cost.flops += out;
+  }
+  else if (type == "WinogradConv") {
+    // Count the 3x3 kernel of the direct convolution over the C channels of
+    // the transformed weights, so that the rate shows what Winograd saves.
+    cost.flops = 2 * out * elements(pOp.getInput(1), 2) * 9;
+    if (2 < pOp.getNumOfInputs())
+      cost.flops += out;
+  }
+  else if (type == "ConvNCHWc") {
+    // W is Mb x Cb x kH x kW x c x c: every output element, padding channels
+    // included, is a dot product over Cb x kH x kW x c weights.
+    cost.flops = 2 * out * elements(pOp.getInput(1), 1) /
+                 elements(pOp.getInput(1), 5);
+    if (2 < pOp.getNumOfInputs())
+      cost.flops += out;
+  }
+  else if (type == "ConvTranspose") {
+    // Every input element is scattered over a kernel.
+    cost.flops = 2 * elements(pOp.getInput(0)) * elements(pOp.getInput(1), 1);
+  }
+  else if (type == "Gemm" || type == "FusedGemm") {
+    // Y is M x N and A holds M x K elements, transposed or not.
+    const Tensor::Dimensions& dims =
+        static_cast<const Tensor*>(pOp.getOutput(0))->getDimensions();
+    uint64_t k = dims.empty() ? 0 : elements(pOp.getInput(0)) / dims[0];
+    cost.flops = 2 * out * k;
+  }
+  else if (type == "Int8Gemm") {
+    // B is N x K; the integer multiply-adds count as floating point ones.
+    cost.flops = 2 * out * elements(pOp.getInput(1), 1);
+  }
+  else if (type == "MatMul") {
+    const Tensor::Dimensions& dims =
+        static_cast<const Tensor*>(pOp.getInput(0))->getDimensions();
+    cost.flops = 2 * out * (dims.empty() ? 1 : dims.back());
+  }
+  else if (const MaxPool* pool = dyn_cast<MaxPool>(&pOp))
+    cost.flops = out * product(pool->getKernelShape());
+  else if (const AveragePool* pool = dyn_cast<AveragePool>(&pOp))
+    cost.flops = out * product(pool->getKernelShape());
+  else if (const LpPool* pool = dyn_cast<LpPool>(&pOp))
+    cost.flops = out * product(pool->getKernelShape());
+  else if (const PoolNCHWc* pool = dyn_cast<PoolNCHWc>(&pOp))
+    cost.flops = out * product(pool->getKernelShape());
+  else if (type == "LSTM" || type == "GRU" || type == "RNN") {
+    // Every time step multiplies the input by W and the hidden state by R.
+    const Tensor::Dimensions& x =
+        static_cast<const Tensor*>(pOp.getInput(0))->getDimensions();
+    uint64_t steps = x.size() < 2 ? 1 : x[0] * x[1];
+    cost.flops = 2 * steps * (elements(pOp.getInput(1), 1) +
+                              elements(pOp.getInput(2), 1));
+  }
+  else if (const FusedElementwise* fused = dyn_cast<FusedElementwise>(&pOp))
+    cost.flops = out * fused->getActivations().vector().size();
+  else if (!isDataMovement(type))
+    cost.flops = out;
+  return cost;
+}
+
+Profiler::Summary Profiler::Summarize(std::vector<Timer::Interval> pTimes)
+{
+  Summary summary{0, 0, 0, 0};
+  if (pTimes.empty())
+    return summary;
+  std::sort(pTimes.begin(), pTimes.end());
+  // Nearest rank.
+  size_t size = pTimes.size();
+  summary.min = pTimes.front();
+  summary.median = pTimes[(size - 1) / 2];
+  summary.p99 = pTimes[std::min(size - 1, (size * 99 + 99) / 100 - 1)];
+  for (Timer::Interval time : pTimes)
+    summary.total += time;
+  return summary;
+}
+
+Profiler::Summary Profiler::summarize(const Record& pRecord) const
+{
+  // A step runs once per run.
+  std::vector<Timer::Interval> times;
+  for (const Sample& sample : pRecord.samples)
+    times.push_back(sample.duration);
+  return Summarize(times);
+}
+
+Profiler::Summary Profiler::summarizeRuns() const
+{
+  std::vector<Timer::Interval> times;
+  for (const Run& run : m_Runs)
+    times.push_back(run.duration);
+  return Summarize(times);
+}
+
+std::vector<Profiler::TypeRecord> Profiler::groupByType() const
+{
+  std::map<std::string, TypeRecord> types;
+  for (const Record& record : m_Records) {
+    std::string type = record.op->name().str();
+    TypeRecord& group = types[type];
+    group.type = type;
+    ++group.count;
+    group.median += summarize(record).median;
+    group.flops += record.cost.flops;
+  }
+
+  std::vector<TypeRecord> result;
+  for (auto& entry : types)
+    result.push_back(entry.second);
+  std::stable_sort(result.begin(), result.end(),
+                   [](const TypeRecord& pA, const TypeRecord& pB) {
+                     return pA.median > pB.median;
+                   });
+  return result;
+}
+
+void Profiler::print(OStream& pOS) const
+{
+  Summary runs = summarizeRuns();
+  pOS << "[Profile] " << m_Runs.size() << " runs: min " << runs.min
+      << " ns, median " << runs.median << " ns, p99 " << runs.p99 << " ns"
+      << std::endl;
+
+  // The medians of all operators add up to about the median of a run, but
+  // parallel runs overlap them.
+  Timer::Interval sum = 0;
+  std::vector<std::pair<Timer::Interval, size_t> > order;
+  for (size_t i = 0; i < m_Records.size(); ++i) {
+    Timer::Interval median = summarize(m_Records[i]).median;
+    sum += median;
+    order.emplace_back(median, i);
+  }
+  sum = std::max<Timer::Interval>(sum, 1);
+
+  std::ios::fmtflags flags = pOS.flags();
+  std::streamsize precision = pOS.precision();
+  pOS << std::fixed << std::setprecision(2);
+
+  pOS << "[Profile] by type:" << std::endl;
+  pOS << std::left << std::setw(24) << "type" << std::right
+      << std::setw(8) << "count" << std::setw(14) << "median(us)"
+      << std::setw(10) << "share" << std::setw(10) << "GFLOP/s" << std::endl;
+  for (const TypeRecord& type : groupByType()) {
+    pOS << std::left << std::setw(24) << type.type << std::right
+        << std::setw(8) << type.count
+        << std::setw(14) << type.median / 1000.0
+        << std::setw(9) << type.median * 100.0 / sum << '%'
+        << std::setw(10) << perSecond(type.flops, type.median) << std::endl;
+  }
+
+  std::stable_sort(order.begin(), order.end(),
+                   [](const std::pair<Timer::Interval, size_t>& pA,
+                      const std::pair<Timer::Interval, size_t>& pB) {
+                     return pA.first > pB.first;
+                   });
+  if (order.size() > kNumOfTopOperators)
+    order.resize(kNumOfTopOperators);
+  pOS << "[Profile] top operators:" << std::endl;
+  pOS << std::left << std::setw(32) << "name" << std::setw(20) << "type"
+      << std::right << std::setw(12) << "min(us)" << std::setw(12)
+      << "median(us)" << std::setw(12) << "p99(us)" << std::setw(10)
+      << "GFLOP/s" << std::setw(10) << "GB/s" << std::endl;
+  for (const auto& entry : order) {
+    const Record& record = m_Records[entry.second];
+    Summary summary = summarize(record);
+    pOS << std::left << std::setw(32) << record.name
+        << std::setw(20) << record.op->name().str() << std::right
+        << std::setw(12) << summary.min / 1000.0
+        << std::setw(12) << summary.median / 1000.0
+        << std::setw(12) << summary.p99 / 1000.0
+        << std::setw(10) << perSecond(record.cost.flops, summary.median)
+        << std::setw(10) << perSecond(record.cost.bytes, summary.median)
+        << std::endl;
+  }
+
+  pOS.flags(flags);
+  pOS.precision(precision);
+}
+
+void Profiler::print(json::Object& pJSON) const
+{
+  Summary runs = summarizeRuns();
+  pJSON.write("runs", static_cast<unsigned int>(m_Runs.size()));
+  pJSON.write("min_ns", runs.min);
+  pJSON.write("median_ns", runs.median);
+  pJSON.write("p99_ns", runs.p99);
+
+  json::Array operators;
+  for (const Record& record : m_Records) {
+    Summary summary = summarize(record);
+    json::Object op;
+    op.write("name", record.name);
+    op.write("type", record.op->name().str());
+    op.write("min_ns", summary.min);
+    op.write("median_ns", summary.median);
+    op.write("p99_ns", summary.p99);
+    op.write("flops", record.cost.flops);
+    op.write("bytes", record.cost.bytes);
+    op.write("gflops", perSecond(record.cost.flops, summary.median));
+    op.write("gbps", perSecond(record.cost.bytes, summary.median));
+    operators.push_back(json::Value(op));
+  }
+  pJSON.write("operators", operators);
+
+  json::Array types;
+  for (const TypeRecord& type : groupByType()) {
+    json::Object group;
+    group.write("type", type.type);
+    group.write("count", type.count);
+    group.write("median_ns", type.median);
+    group.write("flops", type.flops);
+    group.write("gflops", perSecond(type.flops, type.median));
+    types.push_back(json::Value(group));
+  }
+  pJSON.write("types", types);
+}
+
+bool Profiler::writeJSON(const Path& pFile) const
+{
+  std::ofstream ofs(pFile.c_str());
+  if (!ofs.is_open())
+    return false;
+
+  json::Object report;
+  print(report);
+  IndentOStream ios(ofs, 2);
+  ios << std::fixed << std::setprecision(3);
+  report.print(ios);
+  ios << std::endl;
+  return true;
+}
+
+bool Profiler::writeTrace(const Path& pFile) const
+{
+  std::ofstream ofs(pFile.c_str());
+  if (!ofs.is_open())
+    return false;
+
+  // Timestamps are in us from the creation of the profiler. Runs are drawn
+  // on a row of their own, above the threads that ran the steps.
+  std::map<std::thread::id, int> threads;
+  json::Array events;
+  for (unsigned int i = 0; i < m_Runs.size(); ++i) {
+    json::Object event;
+    event.write("name", "run " + std::to_string(i));
+    event.write("cat", "run");
+    event.write("ph", "X");
+    event.write("ts", (m_Runs[i].start - m_Origin) / 1000.0);
+    event.write("dur", m_Runs[i].duration / 1000.0);
+    event.write("pid", 1);
+    event.write("tid", 0);
+    events.push_back(json::Value(event));
+  }
+  for (const Record& record : m_Records) {
+    for (const Sample& sample : record.samples) {
+      auto thread = threads.emplace(sample.thread, threads.size() + 1).first;
+      json::Object args;
+      args.write("run", sample.run);
+      args.write("flops", record.cost.flops);
+      args.write("bytes", record.cost.bytes);
+
+      json::Object event;
+      event.write("name", record.name);
+      event.write("cat", record.op->name().str());
+      event.write("ph", "X");
+      event.write("ts", (sample.start - m_Origin) / 1000.0);
+      event.write("dur", sample.duration / 1000.0);
+      event.write("pid", 1);
+      event.write("tid", thread->second);
+      event.write("args", args);
+      events.push_back(json::Value(event));
+    }
+  }
+
+  // Name the rows.
+  threads.emplace(std::thread::id(), 0);
+  for (const auto& thread : threads) {
+    json::Object args;
+    args.write("name", 0 == thread.second
+                           ? std::string("runs")
+                           : "thread " + std::to_string(thread.second));
+    json::Object event;
+    event.write("name", "thread_name");
+    event.write("ph", "M");
+    event.write("pid", 1);
+    event.write("tid", thread.second);
+    event.write("args", args);
+    events.push_back(json::Value(event));
+  }
+
+  json::Object trace;
+  trace.write("traceEvents", events);
+  trace.write("displayTimeUnit", "ns");
+  IndentOStream ios(ofs, 2);
+  ios << std::fixed << std::setprecision(3);
+  trace.print(ios);
+  ios << std::endl;
+  return true;
+}
@@ -10,14 +10,60 @@
 #include <onnc/IR/ONNXUtils.h>
 #include <onnc/ONNXWrapper/ONNXWrapper.h>
 #include <onnc/Support/IOStream.h>
+#include <unordered_set>
 
 using namespace onnc;
 
+typedef ::google::protobuf::RepeatedPtrField<xTensorProto> TensorProtos;
+
+/// The checker rejects tensors without data, but shape inference only needs
+/// the types of the weights. Move the initializers exported without payload
+/// into @ref pHidden and declare them as graph inputs instead.
+/// @return The number of graph inputs added.
+static int HideWeights(xGraphProto& pGraph, TensorProtos& pHidden)
+{
+  std::unordered_set<std::string> inputs;
+  for (const auto& input : pGraph.input())
+    inputs.insert(input.name());
+
+  int added = 0;
+  pHidden.Swap(pGraph.mutable_initializer());
+  for (const xTensorProto& tensor : pHidden) {
+    if (!tensor.has_data_location() ||
+        xTensorProto::EXTERNAL != tensor.data_location()) {
+      *pGraph.add_initializer() = tensor;
+      continue;
+    }
+    if (inputs.count(tensor.name()))
+      continue;
+    auto* input = pGraph.add_input();
+    input->set_name(tensor.name());
+    auto* type = input->mutable_type()->mutable_tensor_type();
+    type->set_elem_type(tensor.data_type());
+    for (int64_t dim : tensor.dims())
+      type->mutable_shape()->add_dim()->set_dim_value(dim);
+    ++added;
+  }
+  return added;
+}
+
+/// Undo HideWeights.
+static void RestoreWeights(xGraphProto& pGraph, TensorProtos& pHidden,
+                           int pNumAdded)
+{
+  pGraph.mutable_initializer()->Swap(&pHidden);
+  for (int i = 0; i < pNumAdded; ++i)
+    pGraph.mutable_input()->RemoveLast();
+}
+
 bool onnc::onnxInferShape(Module &pModule)
 {
-  // use onnx official shape inference implementation
+  // use onnx official shape inference implementation. It reads no weights,
+  // so leave them in their mappings.
   xProto modelProto;
-  onnc::ExportModelProto(modelProto, pModule);
+  onnc::ExportModelProto(modelProto, pModule, onnc::kShapePayloads);
+  TensorProtos weights;
+  int added = HideWeights(*modelProto.mutable_graph(), weights);
   try {
     xcheck_model(modelProto);
   } catch (xValidationError &e) {
@@ -26,6 +72,8 @@ bool onnc::onnxInferShape(Module &pModule)
     return false;
   }
   xInferShapes(modelProto, xOpSchemaRegistry::Instance());
+  RestoreWeights(*modelProto.mutable_graph(), weights, added);
+  ReleaseExternalData(modelProto, pModule);
   ::onnc::IRBuilder ir_b(pModule);
   ir_b.update(modelProto);
   return true;
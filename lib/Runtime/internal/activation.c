@@ -0,0 +1,124 @@
+#include <onnc/Runtime/internal/activation.h>
+#include <onnc/Runtime/internal/elementwise.h>
+
+#include <stdint.h>
+#include <float.h>
+#include <strings.h>
+#include <math.h>
+
+typedef struct ActivationInfo {
+  const char *name;
+  ONNC_RUNTIME_Activation_kind kind;
+  int32_t number_of_params; // 0: none, 1: alpha, 2: alpha and beta
+  float alpha;              // default alpha
+  float beta;               // default beta
+} ActivationInfo;
+
+static const ActivationInfo g_Activations[] = {
+  { "Sigmoid",         ONNC_RUNTIME_ACTIVATION_SIGMOID,          0, 0.f,  0.f },
+  { "Tanh",            ONNC_RUNTIME_ACTIVATION_TANH,             0, 0.f,  0.f },
+  { "Relu",            ONNC_RUNTIME_ACTIVATION_RELU,             0, 0.f,  0.f },
+  { "Affine",          ONNC_RUNTIME_ACTIVATION_AFFINE,           2, 1.f,  0.f },
+  { "LeakyRelu",       ONNC_RUNTIME_ACTIVATION_LEAKY_RELU,       1, .01f, 0.f },
+  { "ThresholdedRelu", ONNC_RUNTIME_ACTIVATION_THRESHOLDED_RELU, 1, 1.f,  0.f },
+  { "ScaledTanh",      ONNC_RUNTIME_ACTIVATION_SCALED_TANH,      2, 1.f,  1.f },
+  { "HardSigmoid",     ONNC_RUNTIME_ACTIVATION_HARD_SIGMOID,     2, .2f,  .5f },
+  { "Elu",             ONNC_RUNTIME_ACTIVATION_ELU,              1, 1.f,  0.f },
+  { "Softsign",        ONNC_RUNTIME_ACTIVATION_SOFTSIGN,         0, 0.f,  0.f },
+  { "Softplus",        ONNC_RUNTIME_ACTIVATION_SOFTPLUS,         0, 0.f,  0.f },
+  { "Clip",            ONNC_RUNTIME_ACTIVATION_CLIP,             2, -FLT_MAX, FLT_MAX },
+};
+
+static const ActivationInfo *find_activation(const char *name) {
+  const int32_t count = sizeof(g_Activations) / sizeof(g_Activations[0]);
+  for (int32_t i = 0; i < count; ++i) {
+    if (strcasecmp(name, g_Activations[i].name) == 0) {
+      return &g_Activations[i];
+    }
+  }
+  return &g_Activations[0];
+}
+
+void ONNC_RUNTIME_internal_parse_activations(
+  const char * const * restrict activations, int32_t number_of_activations,
+  const float * restrict activation_alpha, int32_t number_of_activation_alpha,
+  const float * restrict activation_beta, int32_t number_of_activation_beta,
+  const char * const * restrict defaults, int32_t per_direction,
+  int32_t num_directions, ONNC_RUNTIME_Activation * restrict result) {
+  int32_t next_alpha = 0, next_beta = 0;
+  for (int32_t i = 0; i < per_direction * num_directions; ++i) {
+    // Without the attribute, every direction uses the defaults.
+    const char *name = (i < number_of_activations) ? activations[i]
+                                                   : defaults[i % per_direction];
+    const ActivationInfo *info = find_activation(name);
+    result[i].kind = info->kind;
+    result[i].alpha = info->alpha;
+    result[i].beta = info->beta;
+    if (info->number_of_params >= 1 && next_alpha < number_of_activation_alpha) {
+      result[i].alpha = activation_alpha[next_alpha++];
+    }
+    if (info->number_of_params >= 2 && next_beta < number_of_activation_beta) {
+      result[i].beta = activation_beta[next_beta++];
+    }
+  }
+}
+
+void ONNC_RUNTIME_internal_activate(const ONNC_RUNTIME_Activation * restrict act,
+                                    int32_t size, float * restrict x) {
+  const float alpha = act->alpha, beta = act->beta;
+  switch (act->kind) {
+  case ONNC_RUNTIME_ACTIVATION_SIGMOID:
+    ONNC_RUNTIME_internal_elementwise()->sigmoid(size, x, x);
+    break;
+  case ONNC_RUNTIME_ACTIVATION_TANH:
+    ONNC_RUNTIME_internal_elementwise()->tanh(size, x, x);
+    break;
+  case ONNC_RUNTIME_ACTIVATION_RELU:
+    ONNC_RUNTIME_internal_elementwise()->relu(size, x, x);
+    break;
+  case ONNC_RUNTIME_ACTIVATION_AFFINE:
+    for (int32_t i = 0; i < size; ++i) x[i] = alpha * x[i] + beta;
+    break;
+  case ONNC_RUNTIME_ACTIVATION_LEAKY_RELU:
+    for (int32_t i = 0; i < size; ++i) x[i] = (x[i] >= 0.f) ? x[i] : alpha * x[i];
+    break;
+  case ONNC_RUNTIME_ACTIVATION_THRESHOLDED_RELU:
+    for (int32_t i = 0; i < size; ++i) x[i] = (x[i] > alpha) ? x[i] : 0.f;
+    break;
+  case ONNC_RUNTIME_ACTIVATION_SCALED_TANH:
+    for (int32_t i = 0; i < size; ++i) x[i] *= beta;
+    ONNC_RUNTIME_internal_elementwise()->tanh(size, x, x);
+    for (int32_t i = 0; i < size; ++i) x[i] *= alpha;
+    break;
+  case ONNC_RUNTIME_ACTIVATION_HARD_SIGMOID:
+    for (int32_t i = 0; i < size; ++i) {
+      float v = alpha * x[i] + beta;
+      x[i] = (v < 0.f) ? 0.f : (v > 1.f) ? 1.f : v;
+    }
+    break;
+  case ONNC_RUNTIME_ACTIVATION_ELU:
+    for (int32_t i = 0; i < size; ++i) {
+      x[i] = (x[i] >= 0.f) ? x[i] : alpha * (expf(x[i]) - 1.f);
+    }
+    break;
+  case ONNC_RUNTIME_ACTIVATION_SOFTSIGN:
+    for (int32_t i = 0; i < size; ++i) x[i] = x[i] / (1.f + fabsf(x[i]));
+    break;
+  case ONNC_RUNTIME_ACTIVATION_SOFTPLUS:
+    for (int32_t i = 0; i < size; ++i) x[i] = logf(1.f + expf(x[i]));
+    break;
+  case ONNC_RUNTIME_ACTIVATION_CLIP:
+    for (int32_t i = 0; i < size; ++i) {
+      x[i] = (x[i] < alpha) ? alpha : (x[i] > beta) ? beta : x[i];
+    }
+    break;
+  }
+}
+
+void ONNC_RUNTIME_internal_activate_all(
+  const ONNC_RUNTIME_Activation * restrict acts, int32_t number_of_acts,
+  int32_t size, float * restrict x) {
+  for (int32_t i = 0; i < number_of_acts; ++i) {
+    ONNC_RUNTIME_internal_activate(&acts[i], size, x);
+  }
+}
@@ -0,0 +1,246 @@
+#include <onnc/Runtime/internal/elementwise.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define EW_STR2(x) #x
+#define EW_STR(x) EW_STR2(x)
+
+//===----------------------------------------------------------------------===//
+// Scalar kernels, the fallback on every platform
+//===----------------------------------------------------------------------===//
+#define SCALAR_BINARY(name, op)                                                \
+static void name##_vv_scalar(int64_t size, const float *a,                     \
+                             const float *b, float *c) {                       \
+  for (int64_t i = 0; i < size; ++i) c[i] = a[i] op b[i];                      \
+}                                                                              \
+static void name##_vs_scalar(int64_t size, const float *a,                     \
+                             const float *b, float *c) {                       \
+  const float s = b[0];                                                        \
+  for (int64_t i = 0; i < size; ++i) c[i] = a[i] op s;                         \
+}                                                                              \
+static void name##_sv_scalar(int64_t size, const float *a,                     \
+                             const float *b, float *c) {                       \
+  const float s = a[0];                                                        \
+  for (int64_t i = 0; i < size; ++i) c[i] = s op b[i];                         \
+}
+
+SCALAR_BINARY(add, +)
+SCALAR_BINARY(sub, -)
+SCALAR_BINARY(mul, *)
+SCALAR_BINARY(div, /)
+
+static void relu_scalar(int64_t size, const float *x, float *y) {
+  for (int64_t i = 0; i < size; ++i) y[i] = (x[i] >= 0.0f) ? x[i] : 0.0f;
+}
+
+static void abs_scalar(int64_t size, const float *x, float *y) {
+  for (int64_t i = 0; i < size; ++i) y[i] = fabsf(x[i]);
+}
+
+static void exp_scalar(int64_t size, const float *x, float *y) {
+  for (int64_t i = 0; i < size; ++i) y[i] = expf(x[i]);
+}
+
+static void tanh_scalar(int64_t size, const float *x, float *y) {
+  for (int64_t i = 0; i < size; ++i) y[i] = tanhf(x[i]);
+}
+
+static void sigmoid_scalar(int64_t size, const float *x, float *y) {
+  for (int64_t i = 0; i < size; ++i) y[i] = 1.0f / (1.0f + expf(-x[i]));
+}
+
+static const ONNC_RUNTIME_Elementwise_kernels kernels_scalar = {
+  .name = "scalar",
+  .binary = {
+    { add_vv_scalar, add_vs_scalar, add_sv_scalar },
+    { sub_vv_scalar, sub_vs_scalar, sub_sv_scalar },
+    { mul_vv_scalar, mul_vs_scalar, mul_sv_scalar },
+    { div_vv_scalar, div_vs_scalar, div_sv_scalar },
+  },
+  .relu = relu_scalar,
+  .abs = abs_scalar,
+  .exp = exp_scalar,
+  .tanh = tanh_scalar,
+  .sigmoid = sigmoid_scalar,
+};
+
+//===----------------------------------------------------------------------===//
+// SIMD kernels
+//===----------------------------------------------------------------------===//
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ONNC_RUNTIME_X86_SIMD 1
+
+#define ISA sse
+#define TARGET "sse2"
+#define VLEN 4
+#include "elementwise_kernels.inc"
+#undef VLEN
+#undef TARGET
+#undef ISA
+
+#define ISA avx2
+#define TARGET "avx2,fma"
+#define VLEN 8
+#include "elementwise_kernels.inc"
+#undef VLEN
+#undef TARGET
+#undef ISA
+
+#define ISA avx512
+#define TARGET "avx512f"
+#define VLEN 16
+#include "elementwise_kernels.inc"
+#undef VLEN
+#undef TARGET
+#undef ISA
+#endif
+
+//===----------------------------------------------------------------------===//
+// Dispatch
+//===----------------------------------------------------------------------===//
+static const ONNC_RUNTIME_Elementwise_kernels *g_Kernels = NULL;
+
+static bool is_requested(const char *request, const char *name) {
+  return request == NULL || strcmp(request, name) == 0;
+}
+
+void ONNC_RUNTIME_internal_elementwise_init(void) {
+  const ONNC_RUNTIME_Elementwise_kernels *kernels = &kernels_scalar;
+  const char *request = getenv("ONNC_RUNTIME_SIMD");
+
+#ifdef ONNC_RUNTIME_X86_SIMD
+  __builtin_cpu_init();
+  if (is_requested(request, "avx512") && __builtin_cpu_supports("avx512f")) {
+    kernels = &kernels_avx512;
+  } else if (is_requested(request, "avx2") &&
+             __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    kernels = &kernels_avx2;
+  } else if (is_requested(request, "sse") && __builtin_cpu_supports("sse2")) {
+    kernels = &kernels_sse;
+  }
+#else
+  (void)request;
+  (void)is_requested;
+#endif
+
+  g_Kernels = kernels;
+}
+
+const ONNC_RUNTIME_Elementwise_kernels *ONNC_RUNTIME_internal_elementwise(void) {
+  if (g_Kernels == NULL) {
+    ONNC_RUNTIME_internal_elementwise_init();
+  }
+  return g_Kernels;
+}
+
+//===----------------------------------------------------------------------===//
+// Broadcasting
+//===----------------------------------------------------------------------===//
+static int64_t product(int32_t ndim, const int32_t * restrict dims) {
+  int64_t size = 1;
+  for (int32_t i = 0; i < ndim; ++i) {
+    size *= dims[i];
+  }
+  return size;
+}
+
+void ONNC_RUNTIME_internal_binary_float(
+  ONNC_RUNTIME_Binary_op op
+  ,const float * input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const float * input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * output_C
+  ,int32_t output_C_ndim, const int32_t * restrict output_C_dims
+) {
+  const ONNC_RUNTIME_binary_kernel *kernel =
+    ONNC_RUNTIME_internal_elementwise()->binary[op];
+  int64_t size_A = product(input_A_ndim, input_A_dims);
+  int64_t size_B = product(input_B_ndim, input_B_dims);
+  int64_t size_C = product(output_C_ndim, output_C_dims);
+
+  if (size_A == size_C && size_B == size_C) {
+    kernel[ONNC_RUNTIME_BINARY_VV](size_C, input_A, input_B, output_C);
+    return;
+  }
+  if (size_A == size_C && size_B == 1) {
+    kernel[ONNC_RUNTIME_BINARY_VS](size_C, input_A, input_B, output_C);
+    return;
+  }
+  if (size_A == 1 && size_B == size_C) {
+    kernel[ONNC_RUNTIME_BINARY_SV](size_C, input_A, input_B, output_C);
+    return;
+  }
+
+  // Align both inputs to the output rank, then merge adjacent axes along
+  // which each input is either broadcast on both or on neither.
+  int32_t ndim = 0;
+  int64_t dims[output_C_ndim > 0 ? output_C_ndim : 1];
+  bool bcast_A[output_C_ndim > 0 ? output_C_ndim : 1];
+  bool bcast_B[output_C_ndim > 0 ? output_C_ndim : 1];
+  for (int32_t i = 0; i < output_C_ndim; ++i) {
+    int32_t a = i - (output_C_ndim - input_A_ndim);
+    int32_t b = i - (output_C_ndim - input_B_ndim);
+    bool ba = (a < 0 || input_A_dims[a] == 1);
+    bool bb = (b < 0 || input_B_dims[b] == 1);
+    if (output_C_dims[i] == 1) {
+      continue;
+    }
+    if (ndim > 0 && bcast_A[ndim - 1] == ba && bcast_B[ndim - 1] == bb) {
+      dims[ndim - 1] *= output_C_dims[i];
+    } else {
+      dims[ndim] = output_C_dims[i];
+      bcast_A[ndim] = ba;
+      bcast_B[ndim] = bb;
+      ++ndim;
+    }
+  }
+  if (ndim == 0) {
+    kernel[ONNC_RUNTIME_BINARY_VV](size_C, input_A, input_B, output_C);
+    return;
+  }
+
+  int64_t stride_A[ndim], stride_B[ndim];
+  int64_t sa = 1, sb = 1;
+  for (int32_t i = ndim - 1; i >= 0; --i) {
+    stride_A[i] = bcast_A[i] ? 0 : sa;
+    stride_B[i] = bcast_B[i] ? 0 : sb;
+    sa *= bcast_A[i] ? 1 : dims[i];
+    sb *= bcast_B[i] ? 1 : dims[i];
+  }
+
+  // The innermost merged axis is one kernel call.
+  int64_t row = dims[ndim - 1];
+  ONNC_RUNTIME_binary_kernel row_kernel;
+  if (!bcast_A[ndim - 1] && !bcast_B[ndim - 1]) {
+    row_kernel = kernel[ONNC_RUNTIME_BINARY_VV];
+  } else if (!bcast_A[ndim - 1]) {
+    row_kernel = kernel[ONNC_RUNTIME_BINARY_VS];
+  } else {
+    // Both broadcast on a merged axis can't happen, so B is the vector.
+    row_kernel = kernel[ONNC_RUNTIME_BINARY_SV];
+  }
+
+  int64_t index[ndim];
+  memset(index, 0, sizeof(index));
+  const float *a = input_A;
+  const float *b = input_B;
+  for (int64_t offset = 0; offset < size_C; offset += row) {
+    row_kernel(row, a, b, output_C + offset);
+    // Advance the odometer over the outer axes.
+    for (int32_t i = ndim - 2; i >= 0; --i) {
+      a += stride_A[i];
+      b += stride_B[i];
+      if (++index[i] < dims[i]) {
+        break;
+      }
+      a -= stride_A[i] * dims[i];
+      b -= stride_B[i] * dims[i];
+      index[i] = 0;
+    }
+  }
+}
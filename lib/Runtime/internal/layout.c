@@ -0,0 +1,118 @@
+#include <onnc/Runtime/internal/layout.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Reorders moving fewer elements than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 16)
+
+// Spatial positions reordered at a time. A tile of one channel block is
+// read and written while it is in L1.
+#define SPATIAL_TILE 64
+
+static inline int64_t min_i64(int64_t a, int64_t b) {
+  return a < b ? a : b;
+}
+
+typedef struct Reorder {
+  bool to_blocked;
+  int32_t C, Cb, block;
+  int64_t spatial;
+  const float *x;
+  float *y;
+} Reorder;
+
+// Reorder channel block task % Cb of image task / Cb.
+static void reorder_task(void *arg, int32_t task) {
+  const Reorder *t = (const Reorder *)arg;
+  int32_t n = task / t->Cb, cb = task % t->Cb;
+  int32_t B = t->block;
+  int32_t channels = t->C - cb * B;
+  if (channels > B) {
+    channels = B;
+  }
+  int64_t plain = ((int64_t)n * t->C + (int64_t)cb * B) * t->spatial;
+  int64_t blocked = ((int64_t)n * t->Cb + cb) * t->spatial * B;
+
+  for (int64_t s0 = 0; s0 < t->spatial; s0 += SPATIAL_TILE) {
+    int64_t size = min_i64(SPATIAL_TILE, t->spatial - s0);
+    for (int32_t c = 0; c < channels; ++c) {
+      if (t->to_blocked) {
+        const float * restrict x = t->x + plain + c * t->spatial + s0;
+        float * restrict y = t->y + blocked + s0 * B + c;
+        for (int64_t s = 0; s < size; ++s) {
+          y[s * B] = x[s];
+        }
+      } else {
+        const float * restrict x = t->x + blocked + s0 * B + c;
+        float * restrict y = t->y + plain + c * t->spatial + s0;
+        for (int64_t s = 0; s < size; ++s) {
+          y[s] = x[s * B];
+        }
+      }
+    }
+    if (t->to_blocked && channels < B) {
+      for (int64_t s = 0; s < size; ++s) {
+        memset(t->y + blocked + (s0 + s) * B + channels, 0,
+               sizeof(float) * (B - channels));
+      }
+    }
+  }
+}
+
+static void reorder(void *onnc_runtime_context, bool to_blocked,
+                    int32_t N, int32_t C, int64_t spatial, int32_t block,
+                    const float * restrict x, float * restrict y) {
+  Reorder t = { to_blocked, C, ONNC_RUNTIME_internal_channel_blocks(C, block),
+                block, spatial, x, y };
+  int32_t number_of_tasks = N * t.Cb;
+  if ((int64_t)number_of_tasks * block * spatial < PARALLEL_THRESHOLD) {
+    for (int32_t task = 0; task < number_of_tasks; ++task) {
+      reorder_task(&t, task);
+    }
+    return;
+  }
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, number_of_tasks,
+                                     reorder_task, &t);
+}
+
+void ONNC_RUNTIME_internal_to_blocked(void *onnc_runtime_context,
+                                      int32_t N, int32_t C, int64_t spatial,
+                                      int32_t block,
+                                      const float * restrict x,
+                                      float * restrict y) {
+  reorder(onnc_runtime_context, true, N, C, spatial, block, x, y);
+}
+
+void ONNC_RUNTIME_internal_from_blocked(void *onnc_runtime_context,
+                                        int32_t N, int32_t C, int64_t spatial,
+                                        int32_t block,
+                                        const float * restrict x,
+                                        float * restrict y) {
+  reorder(onnc_runtime_context, false, N, C, spatial, block, x, y);
+}
+
+void ONNC_RUNTIME_internal_conv_weight_nchwc(int32_t M, int32_t C,
+                                             int32_t kernel_size,
+                                             int32_t block,
+                                             const float * restrict W,
+                                             float * restrict packed) {
+  int32_t Mb = ONNC_RUNTIME_internal_channel_blocks(M, block);
+  int32_t Cb = ONNC_RUNTIME_internal_channel_blocks(C, block);
+  for (int32_t mb = 0; mb < Mb; ++mb) {
+    for (int32_t cb = 0; cb < Cb; ++cb) {
+      for (int32_t k = 0; k < kernel_size; ++k) {
+        for (int32_t ci = 0; ci < block; ++ci) {
+          for (int32_t co = 0; co < block; ++co) {
+            int32_t m = mb * block + co, c = cb * block + ci;
+            *packed++ = (m < M && c < C)
+                            ? W[((int64_t)m * C + c) * kernel_size + k]
+                            : 0.f;
+          }
+        }
+      }
+    }
+  }
+}
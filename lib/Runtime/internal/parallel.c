@@ -0,0 +1,328 @@
+#include <onnc/Runtime/internal/parallel.h>
+#include <onnc/Runtime/onnc-runtime-internal.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+typedef struct Task {
+  ONNC_RUNTIME_task_fn fn;
+  void *arg;
+  ONNC_RUNTIME_Task_group *group;
+} Task;
+
+// A growable ring buffer of tasks. The owner works at the bottom, thieves at
+// the top. Operators are coarse enough that a lock per deque is not the
+// bottleneck, so there is no need for a lock-free deque here.
+typedef struct Deque {
+  pthread_mutex_t lock;
+  Task *tasks;
+  int64_t capacity;
+  int64_t top;
+  int64_t bottom;
+} Deque;
+
+typedef struct Worker {
+  ONNC_RUNTIME_Thread_pool *pool;
+  int32_t index;
+} Worker;
+
+struct ONNC_RUNTIME_Thread_pool {
+  int32_t number_of_workers;
+  pthread_t *threads;
+  Worker *workers;
+  Deque *deques;            // [0] is the injection deque, [i + 1] is worker i's
+  int32_t number_of_queued; // Tasks in all deques
+  bool stop;
+  pthread_mutex_t lock;
+  pthread_cond_t wakeup;
+};
+
+// The pool and deque the current thread works on, if it is a worker.
+static __thread ONNC_RUNTIME_Thread_pool *t_Pool = NULL;
+static __thread int32_t t_Deque = 0;
+
+static bool deque_init(Deque *deque) {
+  deque->capacity = 64;
+  deque->tasks = (Task *)malloc(sizeof(Task) * deque->capacity);
+  if (deque->tasks == NULL) {
+    return false;
+  }
+  pthread_mutex_init(&deque->lock, NULL);
+  deque->top = 0;
+  deque->bottom = 0;
+  return true;
+}
+
+static void deque_destroy(Deque *deque) {
+  pthread_mutex_destroy(&deque->lock);
+  free(deque->tasks);
+}
+
+// Returns false if the deque is full and can not grow.
+static bool deque_push_bottom(Deque *deque, Task task) {
+  pthread_mutex_lock(&deque->lock);
+  if (deque->bottom - deque->top == deque->capacity) {
+    Task *tasks = (Task *)malloc(sizeof(Task) * deque->capacity * 2);
+    if (tasks == NULL) {
+      pthread_mutex_unlock(&deque->lock);
+      return false;
+    }
+    for (int64_t i = deque->top; i < deque->bottom; ++i) {
+      tasks[i % (deque->capacity * 2)] = deque->tasks[i % deque->capacity];
+    }
+    free(deque->tasks);
+    deque->tasks = tasks;
+    deque->capacity *= 2;
+  }
+  deque->tasks[deque->bottom % deque->capacity] = task;
+  ++deque->bottom;
+  pthread_mutex_unlock(&deque->lock);
+  return true;
+}
+
+static bool deque_pop_bottom(Deque *deque, Task *task) {
+  bool found = false;
+  pthread_mutex_lock(&deque->lock);
+  if (deque->bottom > deque->top) {
+    --deque->bottom;
+    *task = deque->tasks[deque->bottom % deque->capacity];
+    found = true;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+static bool deque_steal_top(Deque *deque, Task *task) {
+  bool found = false;
+  pthread_mutex_lock(&deque->lock);
+  if (deque->bottom > deque->top) {
+    *task = deque->tasks[deque->top % deque->capacity];
+    ++deque->top;
+    found = true;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+// Take a task from the own deque of the current thread (if it is a worker of
+// pool), or steal one from the others.
+static bool take_task(ONNC_RUNTIME_Thread_pool *pool, Task *task) {
+  if (__atomic_load_n(&pool->number_of_queued, __ATOMIC_ACQUIRE) == 0) {
+    return false;
+  }
+  const int32_t number_of_deques = pool->number_of_workers + 1;
+  const int32_t self = (t_Pool == pool) ? t_Deque : 0;
+  bool found = (self != 0) && deque_pop_bottom(&pool->deques[self], task);
+  for (int32_t i = 1; !found && i <= number_of_deques; ++i) {
+    found = deque_steal_top(&pool->deques[(self + i) % number_of_deques], task);
+  }
+  if (found) {
+    __atomic_fetch_sub(&pool->number_of_queued, 1, __ATOMIC_RELAXED);
+  }
+  return found;
+}
+
+static void run_task(const Task *task) {
+  task->fn(task->arg);
+  __atomic_fetch_sub(&task->group->pending, 1, __ATOMIC_RELEASE);
+}
+
+static void *worker_main(void *data) {
+  Worker *worker = (Worker *)data;
+  ONNC_RUNTIME_Thread_pool *pool = worker->pool;
+  t_Pool = pool;
+  t_Deque = worker->index + 1;
+
+  while (true) {
+    Task task;
+    if (take_task(pool, &task)) {
+      run_task(&task);
+      continue;
+    }
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop &&
+           __atomic_load_n(&pool->number_of_queued, __ATOMIC_ACQUIRE) == 0) {
+      pthread_cond_wait(&pool->wakeup, &pool->lock);
+    }
+    bool stop = pool->stop;
+    pthread_mutex_unlock(&pool->lock);
+    if (stop) {
+      break;
+    }
+  }
+  return NULL;
+}
+
+ONNC_RUNTIME_Thread_pool *ONNC_RUNTIME_internal_thread_pool_create(int32_t num_threads) {
+  if (num_threads < 2) {
+    return NULL;
+  }
+  ONNC_RUNTIME_Thread_pool *pool =
+    (ONNC_RUNTIME_Thread_pool *)calloc(1, sizeof(ONNC_RUNTIME_Thread_pool));
+  if (pool == NULL) {
+    return NULL;
+  }
+  const int32_t number_of_workers = num_threads - 1;
+  pool->threads = (pthread_t *)malloc(sizeof(pthread_t) * number_of_workers);
+  pool->workers = (Worker *)malloc(sizeof(Worker) * number_of_workers);
+  pool->deques = (Deque *)malloc(sizeof(Deque) * (number_of_workers + 1));
+  int32_t number_of_deques = 0;
+  if (pool->threads != NULL && pool->workers != NULL && pool->deques != NULL) {
+    while (number_of_deques <= number_of_workers &&
+           deque_init(&pool->deques[number_of_deques])) {
+      ++number_of_deques;
+    }
+  }
+  if (number_of_deques <= number_of_workers) {
+    // Out of memory: without a pool, operators run serially.
+    for (int32_t i = 0; i < number_of_deques; ++i) {
+      deque_destroy(&pool->deques[i]);
+    }
+    free(pool->deques);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+    return NULL;
+  }
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->wakeup, NULL);
+
+  for (int32_t i = 0; i < number_of_workers; ++i) {
+    pool->workers[i].pool = pool;
+    pool->workers[i].index = i;
+    if (pthread_create(&pool->threads[i], NULL, worker_main, &pool->workers[i]) != 0) {
+      // Run with the workers we have.
+      for (int32_t j = i + 1; j <= number_of_workers; ++j) {
+        deque_destroy(&pool->deques[j]);
+      }
+      break;
+    }
+    pool->number_of_workers = i + 1;
+  }
+  return pool;
+}
+
+void ONNC_RUNTIME_internal_thread_pool_destroy(ONNC_RUNTIME_Thread_pool *pool) {
+  if (pool == NULL) {
+    return;
+  }
+  pthread_mutex_lock(&pool->lock);
+  pool->stop = true;
+  pthread_cond_broadcast(&pool->wakeup);
+  pthread_mutex_unlock(&pool->lock);
+  for (int32_t i = 0; i < pool->number_of_workers; ++i) {
+    pthread_join(pool->threads[i], NULL);
+  }
+
+  for (int32_t i = 0; i < pool->number_of_workers + 1; ++i) {
+    deque_destroy(&pool->deques[i]);
+  }
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->wakeup);
+  free(pool->deques);
+  free(pool->workers);
+  free(pool->threads);
+  free(pool);
+}
+
+int32_t ONNC_RUNTIME_internal_num_threads(const void *onnc_runtime_context) {
+  if (onnc_runtime_context == NULL) {
+    return 1;
+  }
+  const Context *context = (const Context *)onnc_runtime_context;
+  return (context->num_threads > 0) ? context->num_threads : 1;
+}
+
+static ONNC_RUNTIME_Thread_pool *thread_pool(void *onnc_runtime_context) {
+  if (onnc_runtime_context == NULL) {
+    return NULL;
+  }
+  return ((Context *)onnc_runtime_context)->thread_pool;
+}
+
+void ONNC_RUNTIME_internal_submit(void *onnc_runtime_context,
+                                  ONNC_RUNTIME_Task_group *group,
+                                  ONNC_RUNTIME_task_fn fn,
+                                  void *arg) {
+  ONNC_RUNTIME_Thread_pool *pool = thread_pool(onnc_runtime_context);
+  if (pool == NULL) {
+    fn(arg);
+    return;
+  }
+
+  Task task = { fn, arg, group };
+  __atomic_fetch_add(&group->pending, 1, __ATOMIC_RELAXED);
+  if (!deque_push_bottom(&pool->deques[(t_Pool == pool) ? t_Deque : 0], task)) {
+    // The deque can not grow, so run the task here.
+    run_task(&task);
+    return;
+  }
+  __atomic_fetch_add(&pool->number_of_queued, 1, __ATOMIC_RELEASE);
+
+  pthread_mutex_lock(&pool->lock);
+  pthread_cond_signal(&pool->wakeup);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+void ONNC_RUNTIME_internal_wait(void *onnc_runtime_context,
+                                ONNC_RUNTIME_Task_group *group) {
+  ONNC_RUNTIME_Thread_pool *pool = thread_pool(onnc_runtime_context);
+  if (pool == NULL) {
+    return;
+  }
+  while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE) > 0) {
+    Task task;
+    if (take_task(pool, &task)) {
+      run_task(&task);
+    } else {
+      sched_yield();
+    }
+  }
+}
+
+typedef struct ParallelFor {
+  ONNC_RUNTIME_parallel_fn fn;
+  void *arg;
+  int32_t number_of_tasks;
+  int32_t next_task;
+} ParallelFor;
+
+static void parallel_for_worker(void *data) {
+  ParallelFor *loop = (ParallelFor *)data;
+  while (true) {
+    int32_t task = __atomic_fetch_add(&loop->next_task, 1, __ATOMIC_RELAXED);
+    if (task >= loop->number_of_tasks) {
+      break;
+    }
+    loop->fn(loop->arg, task);
+  }
+}
+
+void ONNC_RUNTIME_internal_parallel_for(void *onnc_runtime_context,
+                                        int32_t number_of_tasks,
+                                        ONNC_RUNTIME_parallel_fn fn,
+                                        void *arg) {
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads > number_of_tasks) {
+    num_threads = number_of_tasks;
+  }
+  if (num_threads <= 1 || thread_pool(onnc_runtime_context) == NULL) {
+    for (int32_t task = 0; task < number_of_tasks; ++task) {
+      fn(arg, task);
+    }
+    return;
+  }
+
+  // Helpers that start late find the loop drained and return right away.
+  ParallelFor loop = { fn, arg, number_of_tasks, 0 };
+  ONNC_RUNTIME_Task_group group = { 0 };
+  for (int32_t i = 0; i < num_threads - 1; ++i) {
+    ONNC_RUNTIME_internal_submit(onnc_runtime_context, &group,
+                                 parallel_for_worker, &loop);
+  }
+  parallel_for_worker(&loop);
+  ONNC_RUNTIME_internal_wait(onnc_runtime_context, &group);
+}
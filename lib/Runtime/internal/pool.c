@@ -0,0 +1,251 @@
+#include <onnc/Runtime/internal/pool.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <float.h>
+#include <math.h>
+
+// Up to this many spatial dimensions are supported.
+#define MAX_SPATIAL_NDIM 16
+
+// Poolings reading fewer elements than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 16)
+
+// The sweep is compiled once per pooling and stride kind: with constant
+// arguments the switch folds away and the unit stride loop vectorizes.
+#if defined(__GNUC__)
+#define POOL_INLINE static inline __attribute__((always_inline))
+#else
+#define POOL_INLINE static inline
+#endif
+
+static inline int32_t min_i32(int32_t a, int32_t b) {
+  return a < b ? a : b;
+}
+
+static inline int32_t max_i32(int32_t a, int32_t b) {
+  return a > b ? a : b;
+}
+
+static inline int64_t min_i64(int64_t a, int64_t b) {
+  return a < b ? a : b;
+}
+
+typedef struct Pooling {
+  ONNC_RUNTIME_Pool_op op;
+  int32_t p;
+  int32_t ndim;     // number of spatial dimensions
+  const float *x;
+  float *y;
+  int32_t x_dims[MAX_SPATIAL_NDIM], y_dims[MAX_SPATIAL_NDIM];
+  int32_t kernel[MAX_SPATIAL_NDIM], pads[MAX_SPATIAL_NDIM];
+  int32_t strides[MAX_SPATIAL_NDIM];
+  int64_t x_plane;  // elements of one channel of x
+  int64_t rows;     // rows of y, N * C * D1 * ... * Dn-1
+  int64_t chunk;    // rows per task
+} Pooling;
+
+// y[i] = y[i] op x[i * stride] for i in [0, n)
+POOL_INLINE void sweep_op(ONNC_RUNTIME_Pool_op op, int32_t p, int32_t n,
+                          int32_t stride, const float * restrict x,
+                          float * restrict y) {
+  for (int32_t i = 0; i < n; ++i) {
+    float v = x[(int64_t)i * stride];
+    switch (op) {
+    case ONNC_RUNTIME_POOL_MAX:
+      y[i] = v > y[i] ? v : y[i];
+      break;
+    case ONNC_RUNTIME_POOL_LP:
+      y[i] += (p == 1) ? fabsf(v) : (p == 2) ? v * v : powf(fabsf(v), p);
+      break;
+    default:
+      y[i] += v;
+      break;
+    }
+  }
+}
+
+static void sweep(ONNC_RUNTIME_Pool_op op, int32_t p, int32_t n,
+                  int32_t stride, const float * restrict x,
+                  float * restrict y) {
+  switch (op) {
+  case ONNC_RUNTIME_POOL_MAX:
+    if (stride == 1) {
+      sweep_op(ONNC_RUNTIME_POOL_MAX, 0, n, 1, x, y);
+    } else {
+      sweep_op(ONNC_RUNTIME_POOL_MAX, 0, n, stride, x, y);
+    }
+    break;
+  case ONNC_RUNTIME_POOL_LP:
+    if (p == 1) {
+      sweep_op(ONNC_RUNTIME_POOL_LP, 1, n, stride, x, y);
+    } else if (p == 2) {
+      sweep_op(ONNC_RUNTIME_POOL_LP, 2, n, stride, x, y);
+    } else {
+      sweep_op(ONNC_RUNTIME_POOL_LP, p, n, stride, x, y);
+    }
+    break;
+  default:
+    if (stride == 1) {
+      sweep_op(ONNC_RUNTIME_POOL_AVERAGE, 0, n, 1, x, y);
+    } else {
+      sweep_op(ONNC_RUNTIME_POOL_AVERAGE, 0, n, stride, x, y);
+    }
+    break;
+  }
+}
+
+// Advance index over dims like an odometer.
+// @return false after the last index.
+static inline bool next_index(int32_t ndim, int32_t * restrict index,
+                              const int32_t * restrict dims) {
+  for (int32_t i = ndim - 1; i >= 0; --i) {
+    if (++index[i] < dims[i]) {
+      return true;
+    }
+    index[i] = 0;
+  }
+  return false;
+}
+
+static void pool_row(const Pooling *t, int64_t row) {
+  int32_t last = t->ndim - 1;
+  int32_t OW = t->y_dims[last], W = t->x_dims[last];
+  int32_t KW = t->kernel[last], SW = t->strides[last], PW = t->pads[last];
+  float *y = t->y + row * OW;
+
+  // Coordinates of the row along the outer spatial dimensions.
+  int32_t begin[MAX_SPATIAL_NDIM];
+  int64_t rest = row;
+  for (int32_t i = last - 1; i >= 0; --i) {
+    begin[i] = (int32_t)(rest % t->y_dims[i]) * t->strides[i] - t->pads[i];
+    rest /= t->y_dims[i];
+  }
+  const float *x = t->x + rest * t->x_plane;
+
+  float initial = (t->op == ONNC_RUNTIME_POOL_MAX) ? -FLT_MAX : 0.f;
+  for (int32_t ow = 0; ow < OW; ++ow) {
+    y[ow] = initial;
+  }
+
+  // Sweep every input row of the window over the output row. Padded rows
+  // are skipped.
+  int32_t k[MAX_SPATIAL_NDIM] = { 0 };
+  int64_t number_of_rows = 0;
+  do {
+    int64_t offset = 0;
+    bool inside = true;
+    for (int32_t i = 0; i < last && inside; ++i) {
+      int32_t index = begin[i] + k[i];
+      inside = (index >= 0 && index < t->x_dims[i]);
+      offset = offset * t->x_dims[i] + index;
+    }
+    if (!inside) {
+      continue;
+    }
+    ++number_of_rows;
+    const float *x_row = x + offset * W;
+    for (int32_t kw = 0; kw < KW; ++kw) {
+      // Input column ow * SW + first is inside for ow in [lo, hi).
+      int32_t first = kw - PW;
+      int32_t lo = (first >= 0) ? 0 : (SW - 1 - first) / SW;
+      int32_t hi = (W > first) ? min_i32(OW, (W - first + SW - 1) / SW) : 0;
+      if (lo < hi) {
+        sweep(t->op, t->p, hi - lo, SW, x_row + first + lo * SW, y + lo);
+      }
+    }
+  } while (next_index(last, k, t->kernel));
+
+  switch (t->op) {
+  case ONNC_RUNTIME_POOL_AVERAGE:
+    for (int32_t ow = 0; ow < OW; ++ow) {
+      int32_t start = ow * SW - PW;
+      int32_t columns = min_i32(W, start + KW) - max_i32(0, start);
+      int64_t count = number_of_rows * columns;
+      y[ow] = (count > 0) ? y[ow] / count : 0.f;
+    }
+    break;
+  case ONNC_RUNTIME_POOL_AVERAGE_INCLUDE_PAD: {
+    int64_t count = 1;
+    for (int32_t i = 0; i < t->ndim; ++i) {
+      count *= t->kernel[i];
+    }
+    for (int32_t ow = 0; ow < OW; ++ow) {
+      y[ow] /= count;
+    }
+    break;
+  }
+  case ONNC_RUNTIME_POOL_LP:
+    if (t->p == 2) {
+      for (int32_t ow = 0; ow < OW; ++ow) {
+        y[ow] = sqrtf(y[ow]);
+      }
+    } else if (t->p != 1) {
+      for (int32_t ow = 0; ow < OW; ++ow) {
+        y[ow] = powf(y[ow], 1.f / t->p);
+      }
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+static void pool_task(void *arg, int32_t task) {
+  const Pooling *t = (const Pooling *)arg;
+  int64_t begin = task * t->chunk;
+  int64_t end = min_i64(begin + t->chunk, t->rows);
+  for (int64_t row = begin; row < end; ++row) {
+    pool_row(t, row);
+  }
+}
+
+void ONNC_RUNTIME_internal_pool(void *onnc_runtime_context,
+                                ONNC_RUNTIME_Pool_op op, int32_t p,
+                                int32_t ndim,
+                                const float * restrict x,
+                                const int32_t * restrict x_dims,
+                                float * restrict y,
+                                const int32_t * restrict y_dims,
+                                const int32_t * restrict kernel_shape,
+                                const int32_t * restrict pads,
+                                const int32_t * restrict strides) {
+  Pooling t;
+  t.op = op;
+  t.p = p;
+  t.ndim = ndim - 2;
+  t.x = x;
+  t.y = y;
+  t.x_plane = 1;
+  t.rows = (int64_t)y_dims[0] * y_dims[1];
+  int64_t work = t.rows;
+  for (int32_t i = 0; i < t.ndim; ++i) {
+    t.x_dims[i] = x_dims[i + 2];
+    t.y_dims[i] = y_dims[i + 2];
+    t.kernel[i] = kernel_shape[i];
+    t.pads[i] = (pads != NULL) ? pads[i] : 0;
+    t.strides[i] = (strides != NULL) ? strides[i] : 1;
+    t.x_plane *= t.x_dims[i];
+    t.rows *= (i + 1 < t.ndim) ? t.y_dims[i] : 1;
+    work *= (int64_t)t.y_dims[i] * t.kernel[i];
+  }
+  if (t.ndim <= 0 || t.rows == 0) {
+    return;
+  }
+
+  // A few tasks per thread even out the load of unequal threads.
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 || work < PARALLEL_THRESHOLD || t.rows == 1) {
+    t.chunk = t.rows;
+    pool_task(&t, 0);
+    return;
+  }
+  int64_t number_of_tasks = min_i64(t.rows, (int64_t)num_threads * 4);
+  t.chunk = (t.rows + number_of_tasks - 1) / number_of_tasks;
+  number_of_tasks = (t.rows + t.chunk - 1) / t.chunk;
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context,
+                                     (int32_t)number_of_tasks,
+                                     pool_task, &t);
+}
@@ -0,0 +1,341 @@
+#include <onnc/Runtime/internal/qgemm.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MR ONNC_RUNTIME_QGEMM_MR
+#define NR ONNC_RUNTIME_QGEMM_NR
+#define MC ONNC_RUNTIME_QGEMM_MC
+
+// Problems smaller than this many multiply-adds are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 20)
+
+// The micro-kernel multiplies unsigned activations by signed weights, four
+// of each at a time, with the VNNI dot product instructions when the CPU
+// has them. A is packed as a + 128 and the sums are corrected by 128 times
+// the sum of each row of B, so that signed activations need no range
+// restriction.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QGEMM_X86_DISPATCH 1
+#include <immintrin.h>
+#if __GNUC__ >= 11 || defined(__clang__)
+#define QGEMM_AVXVNNI 1
+#endif
+#endif
+
+#define ZERO_POINT 128
+
+typedef int32_t acc_t[MR][NR];
+
+typedef void (*kernel_fn)(int32_t K4, const uint8_t * restrict a,
+                          const int8_t * restrict b, acc_t acc);
+
+static inline int32_t min_i32(int32_t a, int32_t b) {
+  return a < b ? a : b;
+}
+
+// Pack mc rows of A into slivers of MR rows. A sliver holds K4 groups of
+// MR x 4 bytes, the four consecutive k of every row. Rows past mc and k
+// past K are filled with the zero point.
+static void pack_A(int32_t mc, int32_t K, int32_t K4,
+                   const int8_t * restrict A, int32_t lda,
+                   uint8_t * restrict packed) {
+  for (int32_t i = 0; i < mc; i += MR) {
+    int32_t mr = min_i32(MR, mc - i);
+    memset(packed, ZERO_POINT, (size_t)K4 * MR * 4);
+    for (int32_t r = 0; r < mr; ++r) {
+      const int8_t * restrict a = A + (int64_t)(i + r) * lda;
+      uint8_t * restrict row = packed + r * 4;
+      for (int32_t k = 0; k < K; ++k) {
+        row[(k >> 2) * MR * 4 + (k & 3)] = (uint8_t)(a[k] + ZERO_POINT);
+      }
+    }
+    packed += (size_t)K4 * MR * 4;
+  }
+}
+
+// Pack nr rows of B into one sliver of K4 groups of NR x 4 bytes, and set
+// comp[j] to ZERO_POINT times the sum of row j. Rows past nr and k past K
+// are zero.
+static void pack_B(int32_t nr, int32_t K, int32_t K4,
+                   const int8_t * restrict B, int32_t ldb,
+                   int8_t * restrict packed, int32_t * restrict comp) {
+  memset(packed, 0, (size_t)K4 * NR * 4);
+  for (int32_t c = 0; c < nr; ++c) {
+    const int8_t * restrict b = B + (int64_t)c * ldb;
+    int8_t * restrict col = packed + c * 4;
+    int32_t sum = 0;
+    for (int32_t k = 0; k < K; ++k) {
+      col[(k >> 2) * NR * 4 + (k & 3)] = b[k];
+      sum += b[k];
+    }
+    comp[c] = ZERO_POINT * sum;
+  }
+  for (int32_t c = nr; c < NR; ++c) {
+    comp[c] = 0;
+  }
+}
+
+// acc[MR x NR] = a[MR x 4 K4] * b[NR x 4 K4]^T in plain C.
+static void kernel_default(int32_t K4, const uint8_t * restrict a,
+                           const int8_t * restrict b, acc_t acc) {
+  memset(acc, 0, sizeof(acc_t));
+  for (int32_t q = 0; q < K4; ++q) {
+    int32_t bt[4][NR];
+    for (int32_t c = 0; c < NR; ++c) {
+      for (int32_t t = 0; t < 4; ++t) {
+        bt[t][c] = b[c * 4 + t];
+      }
+    }
+    for (int32_t r = 0; r < MR; ++r) {
+      for (int32_t t = 0; t < 4; ++t) {
+        const int32_t av = a[r * 4 + t];
+        for (int32_t c = 0; c < NR; ++c) {
+          acc[r][c] += av * bt[t][c];
+        }
+      }
+    }
+    a += MR * 4;
+    b += NR * 4;
+  }
+}
+
+#ifdef QGEMM_X86_DISPATCH
+// Every row of acc is one vector of 16 sums; vpdpbusd adds the dot products
+// of the four bytes of a row of a with the four bytes of every column of b.
+__attribute__((target("avx512f,avx512vnni")))
+static void kernel_avx512vnni(int32_t K4, const uint8_t * restrict a,
+                              const int8_t * restrict b, acc_t acc) {
+  __m512i vacc[MR];
+  for (int32_t r = 0; r < MR; ++r) {
+    vacc[r] = _mm512_setzero_si512();
+  }
+  for (int32_t q = 0; q < K4; ++q) {
+    __m512i bv = _mm512_loadu_si512((const void *)b);
+    for (int32_t r = 0; r < MR; ++r) {
+      int32_t av;
+      memcpy(&av, a + r * 4, sizeof(av));
+      vacc[r] = _mm512_dpbusd_epi32(vacc[r], _mm512_set1_epi32(av), bv);
+    }
+    a += MR * 4;
+    b += NR * 4;
+  }
+  for (int32_t r = 0; r < MR; ++r) {
+    _mm512_storeu_si512((void *)acc[r], vacc[r]);
+  }
+}
+
+#ifdef QGEMM_AVXVNNI
+// The same with two vectors of 8 sums per row.
+__attribute__((target("avx2,avxvnni")))
+static void kernel_avxvnni(int32_t K4, const uint8_t * restrict a,
+                           const int8_t * restrict b, acc_t acc) {
+  __m256i vacc[MR][2];
+  for (int32_t r = 0; r < MR; ++r) {
+    vacc[r][0] = _mm256_setzero_si256();
+    vacc[r][1] = _mm256_setzero_si256();
+  }
+  for (int32_t q = 0; q < K4; ++q) {
+    __m256i b0 = _mm256_loadu_si256((const __m256i *)b);
+    __m256i b1 = _mm256_loadu_si256((const __m256i *)(b + 32));
+    for (int32_t r = 0; r < MR; ++r) {
+      int32_t av;
+      memcpy(&av, a + r * 4, sizeof(av));
+      __m256i va = _mm256_set1_epi32(av);
+      vacc[r][0] = _mm256_dpbusd_avx_epi32(vacc[r][0], va, b0);
+      vacc[r][1] = _mm256_dpbusd_avx_epi32(vacc[r][1], va, b1);
+    }
+    a += MR * 4;
+    b += NR * 4;
+  }
+  for (int32_t r = 0; r < MR; ++r) {
+    _mm256_storeu_si256((__m256i *)acc[r], vacc[r][0]);
+    _mm256_storeu_si256((__m256i *)(acc[r] + 8), vacc[r][1]);
+  }
+}
+#endif
+#endif
+
+static kernel_fn g_Kernel = NULL;
+
+static kernel_fn select_kernel(void) {
+  kernel_fn fn = __atomic_load_n(&g_Kernel, __ATOMIC_RELAXED);
+  if (fn == NULL) {
+    fn = kernel_default;
+#ifdef QGEMM_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vnni")) {
+      fn = kernel_avx512vnni;
+    }
+#ifdef QGEMM_AVXVNNI
+    else if (__builtin_cpu_supports("avxvnni")) {
+      fn = kernel_avxvnni;
+    }
+#endif
+#endif
+    __atomic_store_n(&g_Kernel, fn, __ATOMIC_RELAXED);
+  }
+  return fn;
+}
+
+// Requantize the mr x nr sums of acc to Y, at row i and column j.
+static void store(acc_t acc, const int32_t * restrict comp,
+                  const ONNC_RUNTIME_Requantize * restrict requantize,
+                  float inverse_scale, int32_t i, int32_t j,
+                  int32_t mr, int32_t nr, int8_t * restrict Y,
+                  int64_t row_stride, int64_t col_stride) {
+  for (int32_t r = 0; r < mr; ++r) {
+    int8_t * restrict y = Y + (int64_t)(i + r) * row_stride;
+    for (int32_t c = 0; c < nr; ++c) {
+      float value = (float)(acc[r][c] - comp[c]) * requantize->scales[j + c];
+      if (requantize->bias != NULL) {
+        value += requantize->bias[j + c];
+      }
+      if (requantize->relu && value < 0.f) {
+        value = 0.f;
+      }
+      y[(int64_t)(j + c) * col_stride] =
+          ONNC_RUNTIME_internal_saturate_s8(value * inverse_scale);
+    }
+  }
+}
+
+typedef struct Qgemm {
+  int32_t M, N, K, K4;
+  const int8_t *A, *B;
+  int32_t lda, ldb;
+  int8_t *packed_B;     // all slivers of B
+  int32_t *comp;        // NR per sliver
+  const ONNC_RUNTIME_Requantize *requantize;
+  float inverse_scale;
+  int8_t *Y;
+  int64_t row_stride, col_stride;
+  int32_t col_chunk;    // columns per task, whole slivers
+  int32_t col_chunks;
+  kernel_fn kernel;
+} Qgemm;
+
+// Unpacked fallback for rows [i0, i0 + m) and columns [j0, j0 + n), used
+// when the packing panels can not be allocated.
+static void naive_qgemm(const Qgemm *t, int32_t i0, int32_t m,
+                        int32_t j0, int32_t n) {
+  for (int32_t i = i0; i < i0 + m; ++i) {
+    const int8_t *a = t->A + (int64_t)i * t->lda;
+    for (int32_t j = j0; j < j0 + n; ++j) {
+      const int8_t *b = t->B + (int64_t)j * t->ldb;
+      acc_t acc;
+      int32_t comp = 0;
+      acc[0][0] = 0;
+      for (int32_t k = 0; k < t->K; ++k) {
+        acc[0][0] += (int32_t)a[k] * b[k];
+      }
+      store(acc, &comp, t->requantize, t->inverse_scale, i, j, 1, 1,
+            t->Y, t->row_stride, t->col_stride);
+    }
+  }
+}
+
+static void pack_B_task(void *arg, int32_t sliver) {
+  const Qgemm *t = (const Qgemm *)arg;
+  int32_t j = sliver * NR;
+  pack_B(min_i32(NR, t->N - j), t->K, t->K4, t->B + (int64_t)j * t->ldb,
+         t->ldb, t->packed_B + (size_t)sliver * t->K4 * NR * 4,
+         t->comp + j);
+}
+
+// Compute the rows of block task / col_chunks and the columns of chunk
+// task % col_chunks.
+static void compute_task(void *arg, int32_t task) {
+  const Qgemm *t = (const Qgemm *)arg;
+  int32_t ic = (task / t->col_chunks) * MC;
+  int32_t jc = (task % t->col_chunks) * t->col_chunk;
+  int32_t mc = min_i32(MC, t->M - ic);
+  int32_t nc = min_i32(t->col_chunk, t->N - jc);
+  size_t sliver_size = (size_t)t->K4 * MR * 4;
+
+  // A block is packed by every chunk of columns that needs it; packing is
+  // linear in K while the chunk is quadratic.
+  uint8_t *packed_A = NULL;
+  if (posix_memalign((void **)&packed_A, 64,
+                     sliver_size * ((mc + MR - 1) / MR)) != 0) {
+    packed_A = NULL;
+  }
+  if (packed_A == NULL) {
+    naive_qgemm(t, ic, mc, jc, nc);
+    return;
+  }
+  pack_A(mc, t->K, t->K4, t->A + (int64_t)ic * t->lda, t->lda, packed_A);
+
+  for (int32_t jr = 0; jr < nc; jr += NR) {
+    int32_t j = jc + jr;
+    const int8_t *b = t->packed_B + (size_t)(j / NR) * t->K4 * NR * 4;
+    for (int32_t ir = 0; ir < mc; ir += MR) {
+      acc_t acc;
+      t->kernel(t->K4, packed_A + (size_t)(ir / MR) * sliver_size, b, acc);
+      store(acc, t->comp + j, t->requantize,
+            t->inverse_scale, ic + ir, j, min_i32(MR, mc - ir),
+            min_i32(NR, nc - jr), t->Y, t->row_stride, t->col_stride);
+    }
+  }
+  free(packed_A);
+}
+
+void ONNC_RUNTIME_internal_qgemm(void *onnc_runtime_context,
+                                 int32_t M, int32_t N, int32_t K,
+                                 const int8_t * restrict A, int32_t lda,
+                                 const int8_t * restrict B, int32_t ldb,
+                                 const ONNC_RUNTIME_Requantize * restrict requantize,
+                                 int8_t * restrict Y,
+                                 int64_t row_stride, int64_t col_stride) {
+  if (M <= 0 || N <= 0) {
+    return;
+  }
+
+  int32_t slivers = (N + NR - 1) / NR;
+  Qgemm t = { M, N, K, (K + 3) / 4, A, B, lda, ldb, NULL, NULL,
+              requantize, 1.f / requantize->output_scale, Y,
+              row_stride, col_stride, slivers * NR, 1, select_kernel() };
+  if (posix_memalign((void **)&t.packed_B, 64,
+                     (size_t)slivers * (t.K4 > 0 ? t.K4 : 1) * NR * 4) != 0) {
+    t.packed_B = NULL;
+  }
+  t.comp = (int32_t *)malloc(sizeof(int32_t) * slivers * NR);
+  if (t.packed_B == NULL || t.comp == NULL) {
+    free(t.packed_B);
+    free(t.comp);
+    naive_qgemm(&t, 0, M, 0, N);
+    return;
+  }
+
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  bool parallel = num_threads > 1 && (int64_t)M * N * K >= PARALLEL_THRESHOLD;
+  int32_t row_blocks = (M + MC - 1) / MC;
+  if (parallel && row_blocks < num_threads) {
+    // Too few rows to keep every thread busy: split the columns too.
+    int32_t chunks = min_i32((num_threads + row_blocks - 1) / row_blocks,
+                             slivers);
+    t.col_chunk = (slivers + chunks - 1) / chunks * NR;
+    t.col_chunks = (N + t.col_chunk - 1) / t.col_chunk;
+  }
+
+  if (parallel) {
+    ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, slivers,
+                                       pack_B_task, &t);
+    ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context,
+                                       row_blocks * t.col_chunks,
+                                       compute_task, &t);
+  } else {
+    for (int32_t sliver = 0; sliver < slivers; ++sliver) {
+      pack_B_task(&t, sliver);
+    }
+    for (int32_t task = 0; task < row_blocks; ++task) {
+      compute_task(&t, task);
+    }
+  }
+
+  free(t.packed_B);
+  free(t.comp);
+}
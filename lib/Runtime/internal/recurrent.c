@@ -0,0 +1,49 @@
+#include <onnc/Runtime/internal/recurrent.h>
+#include <onnc/Runtime/internal/sgemm.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+void ONNC_RUNTIME_internal_clip(float clip, int32_t size, float * restrict x) {
+  if (!(clip > 0.f)) {
+    return;
+  }
+  for (int32_t i = 0; i < size; ++i) {
+    x[i] = (x[i] < -clip) ? -clip : (x[i] > clip) ? clip : x[i];
+  }
+}
+
+int32_t ONNC_RUNTIME_internal_num_directions(const char * restrict direction) {
+  return (direction != NULL && strcmp(direction, "bidirectional") == 0) ? 2 : 1;
+}
+
+bool ONNC_RUNTIME_internal_is_reverse(const char * restrict direction,
+                                      int32_t index) {
+  if (direction == NULL) {
+    return false;
+  }
+  if (strcmp(direction, "reverse") == 0) {
+    return true;
+  }
+  return strcmp(direction, "bidirectional") == 0 && index == 1;
+}
+
+void ONNC_RUNTIME_internal_input_projection(
+  void * restrict onnc_runtime_context,
+  int32_t rows, int32_t input_size, int32_t size,
+  const float * restrict X, const float * restrict W,
+  const float * restrict bias, float * restrict proj) {
+  float beta = 0.f;
+  if (bias != NULL) {
+    for (int32_t r = 0; r < rows; ++r) {
+      memcpy(proj + (int64_t)r * size, bias, sizeof(float) * size);
+    }
+    beta = 1.f;
+  }
+  ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, true,
+                              rows, size, input_size, 1.f,
+                              X, input_size, W, input_size,
+                              beta, proj, size);
+}
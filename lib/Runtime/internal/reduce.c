@@ -0,0 +1,297 @@
+#include <onnc/Runtime/internal/reduce.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <string.h>
+
+// Reductions reading fewer elements than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 16)
+
+// Columns of a row of y accumulated by one task, when the innermost group is
+// kept. The block of y stays in L1 while the reduced rows stream through.
+#define COLUMN_BLOCK 1024
+
+// Independent accumulators of a horizontal reduction, so that the loop does
+// not wait for the previous addition and can be vectorized.
+#define LANES 8
+
+// The row loops are compiled once per reduction: with a constant op the
+// switches below fold away and the loops vectorize.
+#if defined(__GNUC__)
+#define REDUCE_INLINE static inline __attribute__((always_inline))
+#else
+#define REDUCE_INLINE static inline
+#endif
+
+static inline int64_t min_i64(int64_t a, int64_t b) {
+  return a < b ? a : b;
+}
+
+static float initial_value(ONNC_RUNTIME_Reduce_op op) {
+  switch (op) {
+  case ONNC_RUNTIME_REDUCE_MAX:  return -INFINITY;
+  case ONNC_RUNTIME_REDUCE_MIN:  return INFINITY;
+  case ONNC_RUNTIME_REDUCE_PROD: return 1.f;
+  default:                       return 0.f;
+  }
+}
+
+// f(v) of the element v before it is folded.
+REDUCE_INLINE float apply(ONNC_RUNTIME_Reduce_op op, float v) {
+  switch (op) {
+  case ONNC_RUNTIME_REDUCE_SUM_ABS:    return fabsf(v);
+  case ONNC_RUNTIME_REDUCE_SUM_SQUARE: return v * v;
+  case ONNC_RUNTIME_REDUCE_SUM_EXP:    return expf(v);
+  default:                             return v;
+  }
+}
+
+// Fold two partial results.
+REDUCE_INLINE float merge(ONNC_RUNTIME_Reduce_op op, float a, float b) {
+  switch (op) {
+  case ONNC_RUNTIME_REDUCE_MAX:  return b > a ? b : a;
+  case ONNC_RUNTIME_REDUCE_MIN:  return b < a ? b : a;
+  case ONNC_RUNTIME_REDUCE_PROD: return a * b;
+  default:                       return a + b;
+  }
+}
+
+// y[i] = y[i] op f(x[i])
+REDUCE_INLINE void accumulate_op(ONNC_RUNTIME_Reduce_op op, int64_t n,
+                                 const float * restrict x,
+                                 float * restrict y) {
+  for (int64_t i = 0; i < n; ++i) {
+    y[i] = merge(op, y[i], apply(op, x[i]));
+  }
+}
+
+// @return f(x[0]) op ... op f(x[n - 1])
+REDUCE_INLINE float reduce_row_op(ONNC_RUNTIME_Reduce_op op, int64_t n,
+                                  const float * restrict x) {
+  float acc[LANES];
+  for (int32_t l = 0; l < LANES; ++l) {
+    acc[l] = initial_value(op);
+  }
+  int64_t i = 0;
+  for (; i + LANES <= n; i += LANES) {
+    for (int32_t l = 0; l < LANES; ++l) {
+      acc[l] = merge(op, acc[l], apply(op, x[i + l]));
+    }
+  }
+  for (; i < n; ++i) {
+    acc[0] = merge(op, acc[0], apply(op, x[i]));
+  }
+  float result = acc[0];
+  for (int32_t l = 1; l < LANES; ++l) {
+    result = merge(op, result, acc[l]);
+  }
+  return result;
+}
+
+#define DISPATCH(call)                                                       \
+  switch (op) {                                                              \
+  case ONNC_RUNTIME_REDUCE_SUM:        call(ONNC_RUNTIME_REDUCE_SUM);        \
+  case ONNC_RUNTIME_REDUCE_SUM_ABS:    call(ONNC_RUNTIME_REDUCE_SUM_ABS);    \
+  case ONNC_RUNTIME_REDUCE_SUM_SQUARE: call(ONNC_RUNTIME_REDUCE_SUM_SQUARE); \
+  case ONNC_RUNTIME_REDUCE_SUM_EXP:    call(ONNC_RUNTIME_REDUCE_SUM_EXP);    \
+  case ONNC_RUNTIME_REDUCE_MAX:        call(ONNC_RUNTIME_REDUCE_MAX);        \
+  case ONNC_RUNTIME_REDUCE_MIN:        call(ONNC_RUNTIME_REDUCE_MIN);        \
+  case ONNC_RUNTIME_REDUCE_PROD:       call(ONNC_RUNTIME_REDUCE_PROD);       \
+  }
+
+static void accumulate(ONNC_RUNTIME_Reduce_op op, int64_t n,
+                       const float * restrict x, float * restrict y) {
+#define ACCUMULATE(OP) accumulate_op(OP, n, x, y); break
+  DISPATCH(ACCUMULATE);
+#undef ACCUMULATE
+}
+
+static float reduce_row(ONNC_RUNTIME_Reduce_op op, int64_t n,
+                        const float * restrict x) {
+#define REDUCE_ROW(OP) return reduce_row_op(OP, n, x)
+  DISPATCH(REDUCE_ROW);
+#undef REDUCE_ROW
+  return 0.f;
+}
+
+#undef DISPATCH
+
+typedef struct Reduction {
+  ONNC_RUNTIME_Reduce_op op;
+  const float *x;
+  float *y;
+  // Groups of merged axes outside the innermost one, split by kind. A unit
+  // of work is one element of y (inner_reduced) or one block of a row of y.
+  // The arrays live on the stack of ONNC_RUNTIME_internal_reduce.
+  int32_t number_of_kept, number_of_reduced;
+  int64_t *kept_dims, *kept_strides;
+  int64_t *reduced_dims, *reduced_strides;
+  bool inner_reduced;
+  int64_t inner;   // number of elements of the innermost group
+  int64_t blocks;  // column blocks per row of y
+  int64_t units;
+  int64_t chunk;   // units per task
+} Reduction;
+
+static void reduce_unit(const Reduction *r, int64_t unit) {
+  int64_t row = unit / r->blocks;
+  int64_t offset = 0, rest = row;
+  for (int32_t i = r->number_of_kept - 1; i >= 0; --i) {
+    offset += (rest % r->kept_dims[i]) * r->kept_strides[i];
+    rest /= r->kept_dims[i];
+  }
+
+  int64_t column = 0, n = r->inner;
+  float *y = r->y + row;
+  if (!r->inner_reduced) {
+    column = (unit % r->blocks) * COLUMN_BLOCK;
+    n = min_i64(COLUMN_BLOCK, r->inner - column);
+    y = r->y + row * r->inner + column;
+    for (int64_t i = 0; i < n; ++i) {
+      y[i] = initial_value(r->op);
+    }
+  }
+  else {
+    y[0] = initial_value(r->op);
+  }
+
+  // Walk the outer reduced groups like an odometer.
+  int64_t index[r->number_of_reduced + 1];
+  memset(index, 0, sizeof(index));
+  const float *x = r->x + offset + column;
+  while (true) {
+    if (r->inner_reduced) {
+      y[0] = merge(r->op, y[0], reduce_row(r->op, n, x));
+    }
+    else {
+      accumulate(r->op, n, x, y);
+    }
+    int32_t i = r->number_of_reduced - 1;
+    for (; i >= 0; --i) {
+      x += r->reduced_strides[i];
+      if (++index[i] < r->reduced_dims[i]) {
+        break;
+      }
+      x -= r->reduced_dims[i] * r->reduced_strides[i];
+      index[i] = 0;
+    }
+    if (i < 0) {
+      break;
+    }
+  }
+}
+
+static void reduce_task(void *arg, int32_t task) {
+  const Reduction *r = (const Reduction *)arg;
+  int64_t begin = task * r->chunk;
+  int64_t end = min_i64(begin + r->chunk, r->units);
+  for (int64_t unit = begin; unit < end; ++unit) {
+    reduce_unit(r, unit);
+  }
+}
+
+void ONNC_RUNTIME_internal_reduce_axes(int32_t ndim,
+                                       const int32_t * restrict axes,
+                                       int32_t number_of_axes,
+                                       bool * restrict reduced) {
+  for (int32_t i = 0; i < ndim; ++i) {
+    reduced[i] = (number_of_axes <= 0);
+  }
+  for (int32_t i = 0; i < number_of_axes; ++i) {
+    int32_t axis = (axes[i] < 0) ? axes[i] + ndim : axes[i];
+    reduced[axis] = true;
+  }
+}
+
+void ONNC_RUNTIME_internal_reduce(void *onnc_runtime_context,
+                                  ONNC_RUNTIME_Reduce_op op,
+                                  int32_t ndim, const int32_t * restrict dims,
+                                  const bool * restrict reduced,
+                                  const float * restrict x,
+                                  float * restrict y) {
+  // Merge adjacent axes of the same kind. Axes of one element do not change
+  // the layout, so they are dropped. There are at most ndim groups.
+  int64_t group_dims[ndim + 1];
+  bool group_reduced[ndim + 1];
+  int32_t number_of_groups = 0;
+  int64_t size = 1, y_size = 1;
+  for (int32_t i = 0; i < ndim; ++i) {
+    size *= dims[i];
+    y_size *= reduced[i] ? 1 : dims[i];
+    if (dims[i] == 1) {
+      continue;
+    }
+    if (number_of_groups > 0 &&
+        group_reduced[number_of_groups - 1] == reduced[i]) {
+      group_dims[number_of_groups - 1] *= dims[i];
+    }
+    else {
+      group_dims[number_of_groups] = dims[i];
+      group_reduced[number_of_groups] = reduced[i];
+      ++number_of_groups;
+    }
+  }
+  if (size == 0) {
+    // Nothing to reduce: every element of y is the initial value.
+    for (int64_t i = 0; i < y_size; ++i) {
+      y[i] = initial_value(op);
+    }
+    return;
+  }
+  if (number_of_groups == 0) {
+    group_dims[0] = 1;
+    group_reduced[0] = false;
+    number_of_groups = 1;
+  }
+
+  Reduction r;
+  r.op = op;
+  r.x = x;
+  r.y = y;
+  r.number_of_kept = r.number_of_reduced = 0;
+  r.inner = group_dims[number_of_groups - 1];
+  r.inner_reduced = group_reduced[number_of_groups - 1];
+  int64_t group_strides[number_of_groups];
+  int64_t kept_dims[number_of_groups], kept_strides[number_of_groups];
+  int64_t reduced_dims[number_of_groups], reduced_strides[number_of_groups];
+  r.kept_dims = kept_dims;
+  r.kept_strides = kept_strides;
+  r.reduced_dims = reduced_dims;
+  r.reduced_strides = reduced_strides;
+  int64_t stride = 1, rows = 1;
+  for (int32_t i = number_of_groups - 1; i >= 0; --i) {
+    group_strides[i] = stride;
+    stride *= group_dims[i];
+  }
+  for (int32_t i = 0; i < number_of_groups - 1; ++i) {
+    if (group_reduced[i]) {
+      r.reduced_dims[r.number_of_reduced] = group_dims[i];
+      r.reduced_strides[r.number_of_reduced] = group_strides[i];
+      ++r.number_of_reduced;
+    }
+    else {
+      r.kept_dims[r.number_of_kept] = group_dims[i];
+      r.kept_strides[r.number_of_kept] = group_strides[i];
+      ++r.number_of_kept;
+      rows *= group_dims[i];
+    }
+  }
+  r.blocks = r.inner_reduced ? 1 : (r.inner + COLUMN_BLOCK - 1) / COLUMN_BLOCK;
+  r.units = rows * r.blocks;
+
+  // A few tasks per thread even out the load of unequal threads.
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 || size < PARALLEL_THRESHOLD || r.units == 1) {
+    r.chunk = r.units;
+    reduce_task(&r, 0);
+    return;
+  }
+  int64_t number_of_tasks = min_i64(r.units, (int64_t)num_threads * 4);
+  r.chunk = (r.units + number_of_tasks - 1) / number_of_tasks;
+  number_of_tasks = (r.units + r.chunk - 1) / r.chunk;
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context,
+                                     (int32_t)number_of_tasks,
+                                     reduce_task, &r);
+}
@@ -0,0 +1,529 @@
+#include <onnc/Runtime/internal/sgemm.h>
+#include <onnc/Runtime/internal/half.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MR ONNC_RUNTIME_SGEMM_MR
+#define NR ONNC_RUNTIME_SGEMM_NR
+#define MC ONNC_RUNTIME_SGEMM_MC
+#define KC ONNC_RUNTIME_SGEMM_KC
+#define NC ONNC_RUNTIME_SGEMM_NC
+
+// Problems smaller than this many multiply-adds are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 18)
+
+// The blocked driver is compiled once per instruction set and picked on the
+// first call, so that the micro-kernel uses the widest vector registers
+// available. The helpers are forced inline so that they are compiled into
+// every variant.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SGEMM_X86_DISPATCH 1
+#endif
+
+#if defined(__GNUC__)
+#define SGEMM_INLINE static inline __attribute__((always_inline))
+#else
+#define SGEMM_INLINE static inline
+#endif
+
+
+static inline int32_t min_i32(int32_t a, int32_t b) {
+  return a < b ? a : b;
+}
+
+// The address of element index of X, which is of storage.
+static inline const void *at(int32_t storage, const void *X, int64_t index) {
+  return ONNC_RUNTIME_internal_storage_at(storage, X, index);
+}
+
+static inline float load(int32_t storage, const void *X, int64_t index) {
+  switch (storage) {
+  case ONNC_RUNTIME_STORAGE_FLOAT16:
+    return ONNC_RUNTIME_internal_half_to_float(((const uint16_t *)X)[index]);
+  case ONNC_RUNTIME_STORAGE_BFLOAT16:
+    return ONNC_RUNTIME_internal_bfloat16_to_float(((const uint16_t *)X)[index]);
+  default:
+    return ((const float *)X)[index];
+  }
+}
+
+static float *alloc_panel(size_t count) {
+  void *panel = NULL;
+  if (posix_memalign(&panel, 64, count * sizeof(float)) != 0) {
+    return NULL;
+  }
+  return (float *)panel;
+}
+
+// pack_A of 16-bit floats. Runs of consecutive elements are widened at
+// once: straight into the sliver when it stores them next to each other,
+// through a row buffer otherwise.
+static void pack_A_narrow(int32_t storage, bool trans, int32_t mc, int32_t kc,
+                          const void * restrict A, int32_t lda,
+                          float * restrict packed) {
+  float row[KC];
+  for (int32_t i = 0; i < mc; i += MR) {
+    int32_t mr = min_i32(MR, mc - i);
+    if (!trans) {
+      for (int32_t r = 0; r < MR; ++r) {
+        if (r < mr) {
+          ONNC_RUNTIME_internal_widen(storage,
+                                      at(storage, A, (int64_t)(i + r) * lda),
+                                      row, kc);
+        }
+        for (int32_t p = 0; p < kc; ++p) {
+          packed[p * MR + r] = (r < mr) ? row[p] : 0.f;
+        }
+      }
+    } else {
+      for (int32_t p = 0; p < kc; ++p) {
+        float * restrict col = packed + p * MR;
+        ONNC_RUNTIME_internal_widen(storage,
+                                    at(storage, A, (int64_t)p * lda + i),
+                                    col, mr);
+        for (int32_t r = mr; r < MR; ++r) {
+          col[r] = 0.f;
+        }
+      }
+    }
+    packed += (int64_t)MR * kc;
+  }
+}
+
+// Pack a mc x kc block of op(A) into slivers of MR rows. Each sliver is
+// stored column by column so that the micro-kernel reads it sequentially.
+// Rows past mc are filled with zero.
+SGEMM_INLINE void pack_A(int32_t storage, bool trans, int32_t mc, int32_t kc,
+                          const void * restrict A_any, int32_t lda,
+                          float * restrict packed) {
+  if (storage != ONNC_RUNTIME_STORAGE_FLOAT) {
+    pack_A_narrow(storage, trans, mc, kc, A_any, lda, packed);
+    return;
+  }
+  const float * restrict A = (const float *)A_any;
+  for (int32_t i = 0; i < mc; i += MR) {
+    int32_t mr = min_i32(MR, mc - i);
+    if (!trans) {
+      const float * restrict a = A + (int64_t)i * lda;
+      for (int32_t p = 0; p < kc; ++p) {
+        int32_t r = 0;
+        for (; r < mr; ++r) {
+          packed[r] = a[(int64_t)r * lda + p];
+        }
+        for (; r < MR; ++r) {
+          packed[r] = 0.f;
+        }
+        packed += MR;
+      }
+    } else {
+      // op(A)(i, p) = A[p * lda + i], so every sliver row is contiguous.
+      const float * restrict a = A + i;
+      for (int32_t p = 0; p < kc; ++p) {
+        const float * restrict col = a + (int64_t)p * lda;
+        int32_t r = 0;
+        for (; r < mr; ++r) {
+          packed[r] = col[r];
+        }
+        for (; r < MR; ++r) {
+          packed[r] = 0.f;
+        }
+        packed += MR;
+      }
+    }
+  }
+}
+
+// pack_B of 16-bit floats, widened like in pack_A_narrow.
+static void pack_B_narrow(int32_t storage, bool trans, int32_t kc, int32_t nc,
+                          const void * restrict B, int32_t ldb,
+                          float * restrict packed) {
+  float col[KC];
+  for (int32_t j = 0; j < nc; j += NR) {
+    int32_t nr = min_i32(NR, nc - j);
+    if (!trans) {
+      for (int32_t p = 0; p < kc; ++p) {
+        float * restrict row = packed + p * NR;
+        ONNC_RUNTIME_internal_widen(storage,
+                                    at(storage, B, (int64_t)p * ldb + j),
+                                    row, nr);
+        for (int32_t c = nr; c < NR; ++c) {
+          row[c] = 0.f;
+        }
+      }
+    } else {
+      for (int32_t c = 0; c < NR; ++c) {
+        if (c < nr) {
+          ONNC_RUNTIME_internal_widen(storage,
+                                      at(storage, B, (int64_t)(j + c) * ldb),
+                                      col, kc);
+        }
+        for (int32_t p = 0; p < kc; ++p) {
+          packed[p * NR + c] = (c < nr) ? col[p] : 0.f;
+        }
+      }
+    }
+    packed += (int64_t)NR * kc;
+  }
+}
+
+// Pack a kc x nc block of op(B) into slivers of NR columns. Each sliver is
+// stored row by row. Columns past nc are filled with zero.
+SGEMM_INLINE void pack_B(int32_t storage, bool trans, int32_t kc, int32_t nc,
+                          const void * restrict B_any, int32_t ldb,
+                          float * restrict packed) {
+  if (storage != ONNC_RUNTIME_STORAGE_FLOAT) {
+    pack_B_narrow(storage, trans, kc, nc, B_any, ldb, packed);
+    return;
+  }
+  const float * restrict B = (const float *)B_any;
+  for (int32_t j = 0; j < nc; j += NR) {
+    int32_t nr = min_i32(NR, nc - j);
+    if (!trans) {
+      const float * restrict b = B + j;
+      for (int32_t p = 0; p < kc; ++p) {
+        const float * restrict row = b + (int64_t)p * ldb;
+        int32_t c = 0;
+        for (; c < nr; ++c) {
+          packed[c] = row[c];
+        }
+        for (; c < NR; ++c) {
+          packed[c] = 0.f;
+        }
+        packed += NR;
+      }
+    } else {
+      // op(B)(p, j) = B[j * ldb + p]
+      const float * restrict b = B + (int64_t)j * ldb;
+      for (int32_t p = 0; p < kc; ++p) {
+        int32_t c = 0;
+        for (; c < nr; ++c) {
+          packed[c] = b[(int64_t)c * ldb + p];
+        }
+        for (; c < NR; ++c) {
+          packed[c] = 0.f;
+        }
+        packed += NR;
+      }
+    }
+  }
+}
+
+#if defined(__GNUC__)
+// acc[MR x NR] = a[MR x kc] * b[kc x NR], holding each row of acc in NR / W
+// vectors of W floats. W must match the register width of the variant,
+// otherwise the accumulators don't stay in registers. The row loops are
+// unrolled for the same reason.
+#define DEFINE_ACCUMULATE(W)                                                   \
+typedef float vec##W##_t __attribute__((vector_size(W * sizeof(float))));     \
+SGEMM_INLINE void accumulate_##W(int32_t kc,                                   \
+                                 const float * restrict a,                     \
+                                 const float * restrict b,                     \
+                                 float acc[MR][NR]) {                          \
+  vec##W##_t vacc[MR][NR / W];                                                 \
+  _Pragma("GCC unroll 16")                                                     \
+  for (int32_t r = 0; r < MR; ++r) {                                           \
+    _Pragma("GCC unroll 16")                                                   \
+    for (int32_t c = 0; c < NR / W; ++c) {                                     \
+      vacc[r][c] = (vec##W##_t){0};                                            \
+    }                                                                          \
+  }                                                                            \
+  for (int32_t p = 0; p < kc; ++p) {                                           \
+    vec##W##_t bv[NR / W];                                                     \
+    memcpy(bv, b, sizeof(bv));                                                 \
+    _Pragma("GCC unroll 16")                                                   \
+    for (int32_t r = 0; r < MR; ++r) {                                         \
+      _Pragma("GCC unroll 16")                                                 \
+      for (int32_t c = 0; c < NR / W; ++c) {                                   \
+        vacc[r][c] += a[r] * bv[c];                                            \
+      }                                                                        \
+    }                                                                          \
+    a += MR;                                                                   \
+    b += NR;                                                                   \
+  }                                                                            \
+  memcpy(acc, vacc, sizeof(vacc));                                             \
+}
+
+DEFINE_ACCUMULATE(4)
+DEFINE_ACCUMULATE(8)
+DEFINE_ACCUMULATE(16)
+#endif
+
+// C[mr x nr] = alpha * a[MR x kc] * b[kc x NR] + beta * C, where vw is the
+// vector width (in floats) of the calling variant.
+SGEMM_INLINE void micro_kernel(int32_t vw, int32_t kc,
+                               const float * restrict a,
+                               const float * restrict b,
+                               float * restrict C, int32_t ldc,
+                               int32_t mr, int32_t nr,
+                               float alpha, float beta) {
+  float acc[MR][NR];
+#if defined(__GNUC__)
+  if (vw == 16) {
+    accumulate_16(kc, a, b, acc);
+  } else if (vw == 8) {
+    accumulate_8(kc, a, b, acc);
+  } else {
+    accumulate_4(kc, a, b, acc);
+  }
+#else
+  (void)vw;
+  memset(acc, 0, sizeof(acc));
+  for (int32_t p = 0; p < kc; ++p) {
+    for (int32_t r = 0; r < MR; ++r) {
+      const float av = a[r];
+      for (int32_t c = 0; c < NR; ++c) {
+        acc[r][c] += av * b[c];
+      }
+    }
+    a += MR;
+    b += NR;
+  }
+#endif
+
+  for (int32_t r = 0; r < mr; ++r) {
+    float * restrict c_row = C + (int64_t)r * ldc;
+    if (beta == 0.f) {
+      for (int32_t c = 0; c < nr; ++c) {
+        c_row[c] = alpha * acc[r][c];
+      }
+    } else if (beta == 1.f) {
+      for (int32_t c = 0; c < nr; ++c) {
+        c_row[c] += alpha * acc[r][c];
+      }
+    } else {
+      for (int32_t c = 0; c < nr; ++c) {
+        c_row[c] = beta * c_row[c] + alpha * acc[r][c];
+      }
+    }
+  }
+}
+
+static void scale_C(int32_t M, int32_t N, float beta,
+                    float * restrict C, int32_t ldc) {
+  for (int32_t i = 0; i < M; ++i) {
+    float * restrict c_row = C + (int64_t)i * ldc;
+    if (beta == 0.f) {
+      memset(c_row, 0, sizeof(float) * N);
+    } else if (beta != 1.f) {
+      for (int32_t j = 0; j < N; ++j) {
+        c_row[j] *= beta;
+      }
+    }
+  }
+}
+
+// Unblocked fallback, used when the packing panels can not be allocated.
+static void naive_sgemm(bool transA, bool transB,
+                        int32_t M, int32_t N, int32_t K, float alpha,
+                        const void * restrict A, int32_t storageA, int32_t lda,
+                        const void * restrict B, int32_t storageB, int32_t ldb,
+                        float beta, float * restrict C, int32_t ldc) {
+  scale_C(M, N, beta, C, ldc);
+  for (int32_t i = 0; i < M; ++i) {
+    float * restrict c_row = C + (int64_t)i * ldc;
+    for (int32_t p = 0; p < K; ++p) {
+      const float av = alpha * load(storageA, A,
+                                    transA ? (int64_t)p * lda + i
+                                           : (int64_t)i * lda + p);
+      for (int32_t j = 0; j < N; ++j) {
+        c_row[j] += av * load(storageB, B,
+                              transB ? (int64_t)j * ldb + p
+                                     : (int64_t)p * ldb + j);
+      }
+    }
+  }
+}
+
+SGEMM_INLINE void sgemm_blocked(int32_t vw, bool transA, bool transB,
+                               int32_t M, int32_t N, int32_t K, float alpha,
+                               const void * restrict A, int32_t storageA,
+                               int32_t lda,
+                               const void * restrict B, int32_t storageB,
+                               int32_t ldb,
+                               float beta, float * restrict C, int32_t ldc) {
+  // Don't allocate full panels for small problems.
+  int32_t kc_max = min_i32(KC, K);
+  int32_t mc_max = (min_i32(MC, M) + MR - 1) / MR * MR;
+  int32_t nc_max = (min_i32(NC, N) + NR - 1) / NR * NR;
+  float *packed_A = alloc_panel((size_t)mc_max * kc_max);
+  float *packed_B = alloc_panel((size_t)kc_max * nc_max);
+  if (packed_A == NULL || packed_B == NULL) {
+    free(packed_A);
+    free(packed_B);
+    naive_sgemm(transA, transB, M, N, K, alpha, A, storageA, lda,
+                B, storageB, ldb, beta, C, ldc);
+    return;
+  }
+
+  for (int32_t jc = 0; jc < N; jc += NC) {
+    int32_t nc = min_i32(NC, N - jc);
+    for (int32_t pc = 0; pc < K; pc += KC) {
+      int32_t kc = min_i32(KC, K - pc);
+      // Only the first rank-kc update applies beta, the others accumulate.
+      float beta_pc = (pc == 0) ? beta : 1.f;
+      const void *B_block = at(storageB, B, transB ? (int64_t)jc * ldb + pc
+                                                   : (int64_t)pc * ldb + jc);
+      pack_B(storageB, transB, kc, nc, B_block, ldb, packed_B);
+      for (int32_t ic = 0; ic < M; ic += MC) {
+        int32_t mc = min_i32(MC, M - ic);
+        const void *A_block = at(storageA, A, transA ? (int64_t)pc * lda + ic
+                                                     : (int64_t)ic * lda + pc);
+        pack_A(storageA, transA, mc, kc, A_block, lda, packed_A);
+        for (int32_t jr = 0; jr < nc; jr += NR) {
+          for (int32_t ir = 0; ir < mc; ir += MR) {
+            micro_kernel(vw, kc,
+                         packed_A + (int64_t)ir * kc,
+                         packed_B + (int64_t)jr * kc,
+                         C + (int64_t)(ic + ir) * ldc + jc + jr, ldc,
+                         min_i32(MR, mc - ir), min_i32(NR, nc - jr),
+                         alpha, beta_pc);
+          }
+        }
+      }
+    }
+  }
+
+  free(packed_A);
+  free(packed_B);
+}
+
+typedef void (*sgemm_fn)(bool transA, bool transB,
+                         int32_t M, int32_t N, int32_t K, float alpha,
+                         const void * restrict A, int32_t storageA,
+                         int32_t lda,
+                         const void * restrict B, int32_t storageB,
+                         int32_t ldb,
+                         float beta, float * restrict C, int32_t ldc);
+
+#define DEFINE_SGEMM_VARIANT(name, vw, attribute)                              \
+attribute static void name(bool transA, bool transB,                           \
+                           int32_t M, int32_t N, int32_t K, float alpha,       \
+                           const void * restrict A, int32_t storageA,          \
+                           int32_t lda,                                        \
+                           const void * restrict B, int32_t storageB,          \
+                           int32_t ldb,                                        \
+                           float beta, float * restrict C, int32_t ldc) {      \
+  sgemm_blocked(vw, transA, transB, M, N, K, alpha,                            \
+                A, storageA, lda, B, storageB, ldb, beta, C, ldc);             \
+}
+
+DEFINE_SGEMM_VARIANT(sgemm_default, 4, )
+#ifdef SGEMM_X86_DISPATCH
+DEFINE_SGEMM_VARIANT(sgemm_avx2, 8, __attribute__((target("avx2,fma"))))
+DEFINE_SGEMM_VARIANT(sgemm_avx512, 16, __attribute__((target("avx512f"))))
+#endif
+
+static sgemm_fn g_SgemmSerial = NULL;
+
+static void sgemm_serial(bool transA, bool transB,
+                         int32_t M, int32_t N, int32_t K, float alpha,
+                         const void * restrict A, int32_t storageA,
+                         int32_t lda,
+                         const void * restrict B, int32_t storageB,
+                         int32_t ldb,
+                         float beta, float * restrict C, int32_t ldc) {
+  sgemm_fn fn = __atomic_load_n(&g_SgemmSerial, __ATOMIC_RELAXED);
+  if (fn == NULL) {
+    fn = sgemm_default;
+#ifdef SGEMM_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      fn = sgemm_avx512;
+    } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      fn = sgemm_avx2;
+    }
+#endif
+    __atomic_store_n(&g_SgemmSerial, fn, __ATOMIC_RELAXED);
+  }
+  fn(transA, transB, M, N, K, alpha, A, storageA, lda, B, storageB, ldb,
+     beta, C, ldc);
+}
+
+typedef struct SgemmTask {
+  bool transA, transB;
+  int32_t M, N, K;
+  float alpha, beta;
+  const void *A, *B;
+  float *C;
+  int32_t storageA, storageB;
+  int32_t lda, ldb, ldc;
+  bool split_N;     // split along N (true) or M (false)
+  int32_t chunk;    // rows or columns per task
+} SgemmTask;
+
+static void sgemm_task(void *arg, int32_t task) {
+  const SgemmTask *t = (const SgemmTask *)arg;
+  int32_t begin = task * t->chunk;
+  if (t->split_N) {
+    int32_t n = min_i32(t->chunk, t->N - begin);
+    const void *B = at(t->storageB, t->B,
+                       t->transB ? (int64_t)begin * t->ldb : begin);
+    sgemm_serial(t->transA, t->transB, t->M, n, t->K, t->alpha,
+                 t->A, t->storageA, t->lda, B, t->storageB, t->ldb,
+                 t->beta, t->C + begin, t->ldc);
+  } else {
+    int32_t m = min_i32(t->chunk, t->M - begin);
+    const void *A = at(t->storageA, t->A,
+                       t->transA ? begin : (int64_t)begin * t->lda);
+    sgemm_serial(t->transA, t->transB, m, t->N, t->K, t->alpha,
+                 A, t->storageA, t->lda, t->B, t->storageB, t->ldb, t->beta,
+                 t->C + (int64_t)begin * t->ldc, t->ldc);
+  }
+}
+
+void ONNC_RUNTIME_internal_sgemm(void *onnc_runtime_context,
+                                 bool transA, bool transB,
+                                 int32_t M, int32_t N, int32_t K,
+                                 float alpha,
+                                 const float * restrict A, int32_t lda,
+                                 const float * restrict B, int32_t ldb,
+                                 float beta,
+                                 float * restrict C, int32_t ldc) {
+  ONNC_RUNTIME_internal_sgemm_mixed(onnc_runtime_context, transA, transB,
+                                    M, N, K, alpha,
+                                    A, ONNC_RUNTIME_STORAGE_FLOAT, lda,
+                                    B, ONNC_RUNTIME_STORAGE_FLOAT, ldb,
+                                    beta, C, ldc);
+}
+
+void ONNC_RUNTIME_internal_sgemm_mixed(void *onnc_runtime_context,
+                                       bool transA, bool transB,
+                                       int32_t M, int32_t N, int32_t K,
+                                       float alpha,
+                                       const void * restrict A,
+                                       int32_t storageA, int32_t lda,
+                                       const void * restrict B,
+                                       int32_t storageB, int32_t ldb,
+                                       float beta,
+                                       float * restrict C, int32_t ldc) {
+  if (M <= 0 || N <= 0) {
+    return;
+  }
+  if (K <= 0 || alpha == 0.f) {
+    scale_C(M, N, beta, C, ldc);
+    return;
+  }
+
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 || (int64_t)M * N * K < PARALLEL_THRESHOLD) {
+    sgemm_serial(transA, transB, M, N, K, alpha, A, storageA, lda,
+                 B, storageB, ldb, beta, C, ldc);
+    return;
+  }
+
+  // Split C into one stripe per thread along its longer side. Stripes are
+  // whole micro-tiles wide, so no micro-tile is shared.
+  SgemmTask task = { transA, transB, M, N, K, alpha, beta, A, B, C,
+                     storageA, storageB, lda, ldb, ldc, N >= M, 0 };
+  int32_t extent = task.split_N ? N : M;
+  int32_t unit = task.split_N ? NR : MR;
+  int32_t units = (extent + unit - 1) / unit;
+  task.chunk = (units + num_threads - 1) / num_threads * unit;
+  int32_t number_of_tasks = (extent + task.chunk - 1) / task.chunk;
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, number_of_tasks,
+                                     sgemm_task, &task);
+}
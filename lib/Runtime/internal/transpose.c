@@ -0,0 +1,338 @@
+#include <onnc/Runtime/internal/transpose.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define MAX_NDIM ONNC_RUNTIME_TRANSPOSE_MAX_NDIM
+
+// Transposes moving fewer elements than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 16)
+
+// Side of the register tile.
+#define TILE 8
+
+// Blocks with both sides up to this many elements fit in L1.
+#define BLOCK 32
+
+// Rows of x transposed by one task, when a 2-D transpose is split.
+#define ROWS_PER_TASK 64
+
+// The 2-D transpose is compiled once per instruction set and picked on the
+// first call, so that a tile is eight vector registers wide where possible.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TRANSPOSE_X86_DISPATCH 1
+#endif
+
+#if defined(__GNUC__)
+#define TRANSPOSE_INLINE static inline __attribute__((always_inline))
+#else
+#define TRANSPOSE_INLINE static inline
+#endif
+
+static inline int64_t min_i64(int64_t a, int64_t b) {
+  return a < b ? a : b;
+}
+
+// dst[j * ldd + i] = src[i * lds + j] for i in [0, M), j in [0, N)
+TRANSPOSE_INLINE void transpose_scalar(int64_t M, int64_t N,
+                                       const float * restrict src, int64_t lds,
+                                       float * restrict dst, int64_t ldd) {
+  for (int64_t i = 0; i < M; ++i) {
+    for (int64_t j = 0; j < N; ++j) {
+      dst[j * ldd + i] = src[i * lds + j];
+    }
+  }
+}
+
+#if defined(__GNUC__)
+typedef float vec8_t __attribute__((vector_size(TILE * sizeof(float))));
+typedef int32_t vec8i_t __attribute__((vector_size(TILE * sizeof(int32_t))));
+
+#if defined(__clang__)
+#define SHUFFLE(a, b, i0, i1, i2, i3, i4, i5, i6, i7)                          \
+  __builtin_shufflevector(a, b, i0, i1, i2, i3, i4, i5, i6, i7)
+#else
+#define SHUFFLE(a, b, i0, i1, i2, i3, i4, i5, i6, i7)                          \
+  __builtin_shuffle(a, b, (vec8i_t){ i0, i1, i2, i3, i4, i5, i6, i7 })
+#endif
+
+// Transpose one TILE x TILE tile: interleave pairs of rows, then pairs of
+// pairs, then swap the halves.
+TRANSPOSE_INLINE void transpose_tile(const float * restrict src, int64_t lds,
+                                     float * restrict dst, int64_t ldd) {
+  vec8_t r[TILE], t[TILE], s[TILE];
+  for (int32_t i = 0; i < TILE; ++i) {
+    memcpy(&r[i], src + i * lds, sizeof(vec8_t));
+  }
+  for (int32_t i = 0; i < TILE; i += 2) {
+    t[i]     = SHUFFLE(r[i], r[i + 1], 0, 8, 1, 9, 4, 12, 5, 13);
+    t[i + 1] = SHUFFLE(r[i], r[i + 1], 2, 10, 3, 11, 6, 14, 7, 15);
+  }
+  for (int32_t i = 0; i < TILE; i += 4) {
+    s[i]     = SHUFFLE(t[i], t[i + 2], 0, 1, 8, 9, 4, 5, 12, 13);
+    s[i + 1] = SHUFFLE(t[i], t[i + 2], 2, 3, 10, 11, 6, 7, 14, 15);
+    s[i + 2] = SHUFFLE(t[i + 1], t[i + 3], 0, 1, 8, 9, 4, 5, 12, 13);
+    s[i + 3] = SHUFFLE(t[i + 1], t[i + 3], 2, 3, 10, 11, 6, 7, 14, 15);
+  }
+  for (int32_t i = 0; i < TILE / 2; ++i) {
+    r[i]     = SHUFFLE(s[i], s[i + 4], 0, 1, 2, 3, 8, 9, 10, 11);
+    r[i + 4] = SHUFFLE(s[i], s[i + 4], 4, 5, 6, 7, 12, 13, 14, 15);
+  }
+  for (int32_t i = 0; i < TILE; ++i) {
+    memcpy(dst + i * ldd, &r[i], sizeof(vec8_t));
+  }
+}
+#else
+TRANSPOSE_INLINE void transpose_tile(const float * restrict src, int64_t lds,
+                                     float * restrict dst, int64_t ldd) {
+  transpose_scalar(TILE, TILE, src, lds, dst, ldd);
+}
+#endif
+
+// A block that fits in L1: whole tiles, then the ragged edges.
+TRANSPOSE_INLINE void transpose_block(int64_t M, int64_t N,
+                                      const float * restrict src, int64_t lds,
+                                      float * restrict dst, int64_t ldd) {
+  int64_t M8 = M - M % TILE, N8 = N - N % TILE;
+  for (int64_t i = 0; i < M8; i += TILE) {
+    for (int64_t j = 0; j < N8; j += TILE) {
+      transpose_tile(src + i * lds + j, lds, dst + j * ldd + i, ldd);
+    }
+  }
+  transpose_scalar(M8, N - N8, src + N8, lds, dst + N8 * ldd, ldd);
+  transpose_scalar(M - M8, N, src + M8 * lds, lds, dst + M8, ldd);
+}
+
+// Halve the longer side until the block fits in L1, whatever the cache
+// sizes are. Splits stay on tile boundaries.
+#define DEFINE_TRANSPOSE_VARIANT(name, attribute)                              \
+attribute static void name(int64_t M, int64_t N,                               \
+                           const float * restrict src, int64_t lds,            \
+                           float * restrict dst, int64_t ldd) {                \
+  if (M <= BLOCK && N <= BLOCK) {                                              \
+    transpose_block(M, N, src, lds, dst, ldd);                                 \
+  } else if (M >= N) {                                                         \
+    int64_t half = (M / 2 + TILE - 1) / TILE * TILE;                           \
+    name(half, N, src, lds, dst, ldd);                                         \
+    name(M - half, N, src + half * lds, lds, dst + half, ldd);                 \
+  } else {                                                                     \
+    int64_t half = (N / 2 + TILE - 1) / TILE * TILE;                           \
+    name(M, half, src, lds, dst, ldd);                                         \
+    name(M, N - half, src + half, lds, dst + half * ldd, ldd);                 \
+  }                                                                            \
+}
+
+DEFINE_TRANSPOSE_VARIANT(transpose_2d_default, )
+#ifdef TRANSPOSE_X86_DISPATCH
+DEFINE_TRANSPOSE_VARIANT(transpose_2d_avx, __attribute__((target("avx"))))
+#endif
+
+typedef void (*transpose_2d_fn)(int64_t M, int64_t N,
+                                const float * restrict src, int64_t lds,
+                                float * restrict dst, int64_t ldd);
+
+static transpose_2d_fn g_Transpose2D = NULL;
+
+static void transpose_2d(int64_t M, int64_t N,
+                         const float * restrict src, int64_t lds,
+                         float * restrict dst, int64_t ldd) {
+  transpose_2d_fn fn = __atomic_load_n(&g_Transpose2D, __ATOMIC_RELAXED);
+  if (fn == NULL) {
+    fn = transpose_2d_default;
+#ifdef TRANSPOSE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) {
+      fn = transpose_2d_avx;
+    }
+#endif
+    __atomic_store_n(&g_Transpose2D, fn, __ATOMIC_RELAXED);
+  }
+  fn(M, N, src, lds, dst, ldd);
+}
+
+typedef struct Transpose {
+  const float *x;
+  float *y;
+  // Outer axes of y, walked in order, with the matching strides of x and y.
+  int32_t number_of_outer;
+  int64_t outer_dims[MAX_NDIM];
+  int64_t outer_x_strides[MAX_NDIM], outer_y_strides[MAX_NDIM];
+  // Rows: the innermost axis stays, M rows of N elements are copied.
+  // Otherwise: y[j * ldy + i] = x[i * ldx + j], i in [0, M), j in [0, N).
+  bool rows;
+  int64_t M, N, ldx, ldy;
+  int64_t blocks;  // blocks of rows of x per outer index
+  int64_t units;   // outer indices * blocks
+  int64_t chunk;   // units per task
+} Transpose;
+
+static void transpose_unit(const Transpose *t, int64_t unit) {
+  int64_t outer = unit / t->blocks;
+  int64_t begin = (unit % t->blocks) * ROWS_PER_TASK;
+  int64_t m = min_i64(t->M - begin, t->blocks == 1 ? t->M : ROWS_PER_TASK);
+  const float *x = t->x;
+  float *y = t->y;
+  for (int32_t i = t->number_of_outer - 1; i >= 0; --i) {
+    int64_t index = outer % t->outer_dims[i];
+    outer /= t->outer_dims[i];
+    x += index * t->outer_x_strides[i];
+    y += index * t->outer_y_strides[i];
+  }
+  if (t->rows) {
+    for (int64_t i = begin; i < begin + m; ++i) {
+      memcpy(y + i * t->ldy, x + i * t->ldx, t->N * sizeof(float));
+    }
+  } else {
+    transpose_2d(m, t->N, x + begin * t->ldx, t->ldx, y + begin, t->ldy);
+  }
+}
+
+static void transpose_task(void *arg, int32_t task) {
+  const Transpose *t = (const Transpose *)arg;
+  int64_t begin = task * t->chunk;
+  int64_t end = min_i64(begin + t->chunk, t->units);
+  for (int64_t unit = begin; unit < end; ++unit) {
+    transpose_unit(t, unit);
+  }
+}
+
+void ONNC_RUNTIME_internal_transpose(void *onnc_runtime_context,
+                                     int32_t ndim,
+                                     const int32_t * restrict dims,
+                                     const int32_t * restrict perm,
+                                     const float * restrict x,
+                                     float * restrict y) {
+  // Drop the axes of one element, renumbering the others.
+  int32_t axis_of[MAX_NDIM];
+  int64_t size = 1;
+  int32_t n = 0;
+  for (int32_t i = 0; i < ndim; ++i) {
+    size *= dims[i];
+    axis_of[i] = (dims[i] == 1) ? -1 : n++;
+  }
+  int32_t p[MAX_NDIM];
+  int64_t d[MAX_NDIM];
+  n = 0;
+  for (int32_t i = 0; i < ndim; ++i) {
+    int32_t axis = (perm != NULL) ? perm[i] : ndim - 1 - i;
+    if (axis_of[axis] >= 0) {
+      p[n] = axis_of[axis];
+      d[p[n]] = dims[axis];
+      ++n;
+    }
+  }
+
+  // Merge axes of x that stay adjacent in y: if y takes axis a + 1 of x
+  // right after axis a, the two are one axis. head[a] marks the axes that
+  // start a merged axis.
+  bool head[MAX_NDIM];
+  for (int32_t a = 0; a < n; ++a) {
+    head[a] = true;
+  }
+  for (int32_t j = 1; j < n; ++j) {
+    if (p[j] == p[j - 1] + 1) {
+      head[p[j]] = false;
+    }
+  }
+  int32_t merged_of[MAX_NDIM];
+  int64_t x_dims[MAX_NDIM];
+  int32_t m = -1;
+  for (int32_t a = 0; a < n; ++a) {
+    if (head[a]) {
+      x_dims[++m] = d[a];
+    } else {
+      x_dims[m] *= d[a];
+    }
+    merged_of[a] = m;
+  }
+  int32_t merged_ndim = m + 1;
+  int32_t q[MAX_NDIM];
+  for (int32_t j = 0, k = 0; j < n; ++j) {
+    if (head[p[j]]) {
+      q[k++] = merged_of[p[j]];
+    }
+  }
+
+  if (size == 0) {
+    return;
+  }
+  // The identity, as well as shapes with at most one axis left, is a copy.
+  if (merged_ndim <= 1) {
+    memcpy(y, x, size * sizeof(float));
+    return;
+  }
+
+  int64_t x_strides[MAX_NDIM], y_strides[MAX_NDIM];
+  int64_t stride = 1;
+  for (int32_t a = merged_ndim - 1; a >= 0; --a) {
+    x_strides[a] = stride;
+    stride *= x_dims[a];
+  }
+  stride = 1;
+  for (int32_t j = merged_ndim - 1; j >= 0; --j) {
+    y_strides[j] = stride;
+    stride *= x_dims[q[j]];
+  }
+
+  Transpose t;
+  t.x = x;
+  t.y = y;
+  t.number_of_outer = 0;
+  int32_t last = merged_ndim - 1;
+  if (q[last] == last) {
+    // The innermost axis stays: copy rows of N elements. The rows are
+    // indexed by the second innermost axis of y.
+    t.rows = true;
+    t.N = x_dims[last];
+    t.M = x_dims[q[last - 1]];
+    t.ldx = x_strides[q[last - 1]];
+    t.ldy = y_strides[last - 1];
+    for (int32_t j = 0; j < last - 1; ++j) {
+      t.outer_dims[t.number_of_outer] = x_dims[q[j]];
+      t.outer_x_strides[t.number_of_outer] = x_strides[q[j]];
+      t.outer_y_strides[t.number_of_outer] = y_strides[j];
+      ++t.number_of_outer;
+    }
+  } else {
+    // A batch of 2-D transposes between axis q[last] of x, innermost in y,
+    // and the innermost axis of x. NCHW <-> NHWC and swapping the last two
+    // axes have a single 2-D transpose per batch.
+    t.rows = false;
+    t.M = x_dims[q[last]];
+    t.N = x_dims[last];
+    t.ldx = x_strides[q[last]];
+    for (int32_t j = 0; j < last; ++j) {
+      if (q[j] == last) {
+        t.ldy = y_strides[j];
+        continue;
+      }
+      t.outer_dims[t.number_of_outer] = x_dims[q[j]];
+      t.outer_x_strides[t.number_of_outer] = x_strides[q[j]];
+      t.outer_y_strides[t.number_of_outer] = y_strides[j];
+      ++t.number_of_outer;
+    }
+  }
+  int64_t outer = size / (t.M * t.N);
+
+  // Split the rows of x as well when there are too few batches to go
+  // around. A few tasks per thread even out the load.
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 || size < PARALLEL_THRESHOLD) {
+    t.blocks = 1;
+    t.units = t.chunk = outer;
+    transpose_task(&t, 0);
+    return;
+  }
+  t.blocks = (outer >= (int64_t)num_threads * 4)
+               ? 1 : (t.M + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+  t.units = outer * t.blocks;
+  int64_t number_of_tasks = min_i64(t.units, (int64_t)num_threads * 4);
+  t.chunk = (t.units + number_of_tasks - 1) / number_of_tasks;
+  number_of_tasks = (t.units + t.chunk - 1) / t.chunk;
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context,
+                                     (int32_t)number_of_tasks,
+                                     transpose_task, &t);
+}
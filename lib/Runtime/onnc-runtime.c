@@ -1,4 +1,6 @@
 #include <onnc/Runtime/onnc-runtime-internal.h>
+#include <onnc/Runtime/internal/elementwise.h>
+#include <onnc/Runtime/internal/parallel.h>
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -15,6 +17,12 @@ void *ONNC_RUNTIME_init_runtime() {
   context->mem = (void **)calloc(2048 , sizeof(void *));
   context->mem_i = 0;
 
+  // Operators run single threaded unless ONNC_RUNTIME_NUM_THREADS is set.
+  const char *num_threads = getenv("ONNC_RUNTIME_NUM_THREADS");
+  ONNC_RUNTIME_set_num_threads(context, (num_threads != NULL) ? atoi(num_threads) : 1);
+
+  ONNC_RUNTIME_internal_elementwise_init();
+
   return context;
 }
 
@@ -28,10 +36,22 @@ bool ONNC_RUNTIME_shutdown_runtime(void *onnc_runtime_context) {
     free(context->mem[i]);
   }
 
+  ONNC_RUNTIME_internal_thread_pool_destroy(context->thread_pool);
+  free(context->mem);
   free(context);
   return true;
 }
 
+void ONNC_RUNTIME_set_num_threads(void *onnc_runtime_context, int32_t num_threads) {
+  Context *context = (Context *)onnc_runtime_context;
+  if (num_threads < 1) {
+    num_threads = 1;
+  }
+  ONNC_RUNTIME_internal_thread_pool_destroy(context->thread_pool);
+  context->num_threads = num_threads;
+  context->thread_pool = ONNC_RUNTIME_internal_thread_pool_create(num_threads);
+}
+
 /*
 void *ONNC_RUNTIME_internal_allocate_memory(void *onnc_runtime_context, size_t num, size_t size) {
   Context *context = (Context *)onnc_runtime_context;
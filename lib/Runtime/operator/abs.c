@@ -1,7 +1,7 @@
 #include <onnc/Runtime/operator/abs.h>
+#include <onnc/Runtime/internal/elementwise.h>
 
 #include <stdint.h>
-#include <math.h>
 #include <stdbool.h>
 
 void ONNC_RUNTIME_abs_float(
@@ -11,11 +11,9 @@ void ONNC_RUNTIME_abs_float(
   ,float * restrict output_Y
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
 ) {
-  int32_t size = 1;
-	for(int32_t i = 0 ; i < input_X_ndim ; ++i){
-		size *= input_X_dims[i];
-	}
-	for(int32_t i = 0 ; i < size ; ++i){
-		output_Y[i] = fabs(input_X[i]);
-	}
+  int64_t size = 1;
+  for (int32_t i = 0; i < input_X_ndim; ++i) {
+    size *= input_X_dims[i];
+  }
+  ONNC_RUNTIME_internal_elementwise()->abs(size, input_X, output_Y);
 }
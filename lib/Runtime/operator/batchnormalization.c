@@ -6,7 +6,7 @@
 
 void ONNC_RUNTIME_batchnormalization_float(
   void * restrict onnc_runtime_context
-  ,const float * restrict input_X
+  ,const float * input_X
   ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
   ,const float * restrict input_scale
   ,int32_t input_scale_ndim, const int32_t * restrict input_scale_dims
@@ -16,7 +16,7 @@ void ONNC_RUNTIME_batchnormalization_float(
   ,int32_t input_mean_ndim, const int32_t * restrict input_mean_dims
   ,const float * restrict input_var
   ,int32_t input_var_ndim, const int32_t * restrict input_var_dims
-  ,float * restrict output_Y
+  ,float * output_Y
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   ,float * restrict output_mean
   ,int32_t output_mean_ndim, const int32_t * restrict output_mean_dims
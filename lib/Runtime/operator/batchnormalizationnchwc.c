@@ -0,0 +1,108 @@
+#include <onnc/Runtime/operator/batchnormalizationnchwc.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Normalizations of fewer elements than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 16)
+
+#if defined(__GNUC__)
+#define BN_INLINE static inline __attribute__((always_inline))
+#else
+#define BN_INLINE static inline
+#endif
+
+typedef struct Normalization {
+  int32_t block, Cb;
+  int64_t spatial;
+  const float *x;
+  float *y;
+  const float *a, *b;   // y = a * x + b, per channel
+} Normalization;
+
+// y = a * x + b over one channel block of one image, whole blocks at a time.
+BN_INLINE void normalize(int32_t B, const Normalization *t, int32_t task) {
+  const float *a = t->a + (int64_t)(task % t->Cb) * B;
+  const float *b = t->b + (int64_t)(task % t->Cb) * B;
+  const float *x = t->x + (int64_t)task * t->spatial * B;
+  float *y = t->y + (int64_t)task * t->spatial * B;
+  for (int64_t s = 0; s < t->spatial; ++s) {
+    for (int32_t c = 0; c < B; ++c) {
+      y[s * B + c] = a[c] * x[s * B + c] + b[c];
+    }
+  }
+}
+
+static void normalize_task(void *arg, int32_t task) {
+  const Normalization *t = (const Normalization *)arg;
+  if (t->block == 16) {
+    normalize(16, t, task);
+  } else {
+    normalize(8, t, task);
+  }
+}
+
+// BatchNormalization in inference mode of the NCHWc tensor X, a
+// N x Cb x D1 x ... x Dn x block tensor. scale, B, mean and var hold the C
+// channels; the padding channels of Y are set to zero.
+void ONNC_RUNTIME_batchnormalizationnchwc_float(
+  void * restrict onnc_runtime_context
+  ,const float * input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const float * restrict input_scale
+  ,int32_t input_scale_ndim, const int32_t * restrict input_scale_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_mean
+  ,int32_t input_mean_ndim, const int32_t * restrict input_mean_dims
+  ,const float * restrict input_var
+  ,int32_t input_var_ndim, const int32_t * restrict input_var_dims
+  ,float * output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float epsilon
+) {
+  Normalization t;
+  t.block = input_X_dims[input_X_ndim - 1];
+  t.Cb = input_X_dims[1];
+  t.spatial = 1;
+  for (int32_t i = 2; i < input_X_ndim - 1; ++i) {
+    t.spatial *= input_X_dims[i];
+  }
+  t.x = input_X;
+  t.y = output_Y;
+
+  // Fold the parameters into one multiply-add per element.
+  int32_t C = input_scale_dims[0];
+  int32_t channels = t.Cb * t.block;
+  float *ab = (float *)malloc(sizeof(float) * 2 * channels);
+  if (ab == NULL) {
+    return;
+  }
+  for (int32_t c = 0; c < channels; ++c) {
+    float a = 0.f, b = 0.f;
+    if (c < C) {
+      a = input_scale[c] / sqrtf(input_var[c] + epsilon);
+      b = input_B[c] - input_mean[c] * a;
+    }
+    ab[c] = a;
+    ab[channels + c] = b;
+  }
+  t.a = ab;
+  t.b = ab + channels;
+
+  int32_t number_of_tasks = input_X_dims[0] * t.Cb;
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 ||
+      (int64_t)number_of_tasks * t.spatial * t.block < PARALLEL_THRESHOLD) {
+    for (int32_t task = 0; task < number_of_tasks; ++task) {
+      normalize_task(&t, task);
+    }
+  } else {
+    ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, number_of_tasks,
+                                       normalize_task, &t);
+  }
+  free(ab);
+}
@@ -1,7 +1,44 @@
 #include <onnc/Runtime/operator/cast.h>
+#include <onnc/Runtime/internal/half.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <math.h>
+
+/* Data types of ONNX that values can be cast to */
+enum {
+  CAST_FLOAT = 1,
+  CAST_UINT8 = 2,
+  CAST_INT8 = 3,
+  CAST_UINT16 = 4,
+  CAST_INT16 = 5,
+  CAST_INT32 = 6,
+  CAST_INT64 = 7,
+  CAST_BOOL = 9,
+  CAST_FLOAT16 = 10,
+  CAST_DOUBLE = 11,
+  CAST_UINT32 = 12,
+  CAST_UINT64 = 13,
+  CAST_BFLOAT16 = 16
+};
+
+/* Truncate x toward zero and wrap it into an integer of the given bits. */
+static float wrap(float x, int bits, bool is_signed) {
+  x = truncf(x);
+  if (bits == 64) {
+    return (is_signed || x >= 0.f) ? x : x + 18446744073709551616.0f;
+  }
+  // Values beyond 2^62 can't be wrapped exactly in floats anyway.
+  if (!(fabsf(x) < 4611686018427387904.0f)) {
+    return x;
+  }
+  uint64_t mask = ((uint64_t)1 << bits) - 1;
+  uint64_t value = (uint64_t)(int64_t)x & mask;
+  if (is_signed && (value >> (bits - 1))) {
+    return (float)((int64_t)value - ((int64_t)1 << bits));
+  }
+  return (float)value;
+}
 
 void ONNC_RUNTIME_cast_float(
   void * restrict onnc_runtime_context
@@ -11,4 +48,36 @@ void ONNC_RUNTIME_cast_float(
   ,int32_t output_output_ndim, const int32_t * restrict output_output_dims
   ,int32_t to
 ) {
+  int64_t size = 1;
+  for (int32_t dim = 0; dim < input_input_ndim; ++dim) {
+    size *= input_input_dims[dim];
+  }
+
+  // Values are floats at runtime, so a cast only rounds them to what the
+  // target type can hold.
+  for (int64_t i = 0; i < size; ++i) {
+    float x = input_input[i];
+    switch (to) {
+    case CAST_UINT8:    x = wrap(x, 8, false); break;
+    case CAST_INT8:     x = wrap(x, 8, true); break;
+    case CAST_UINT16:   x = wrap(x, 16, false); break;
+    case CAST_INT16:    x = wrap(x, 16, true); break;
+    case CAST_INT32:    x = wrap(x, 32, true); break;
+    case CAST_UINT32:   x = wrap(x, 32, false); break;
+    case CAST_INT64:    x = wrap(x, 64, true); break;
+    case CAST_UINT64:   x = wrap(x, 64, false); break;
+    case CAST_BOOL:     x = (x != 0.f) ? 1.f : 0.f; break;
+    case CAST_FLOAT16:
+      x = ONNC_RUNTIME_internal_half_to_float(
+          ONNC_RUNTIME_internal_float_to_half(x));
+      break;
+    case CAST_BFLOAT16:
+      x = ONNC_RUNTIME_internal_bfloat16_to_float(
+          ONNC_RUNTIME_internal_float_to_bfloat16(x));
+      break;
+    default: // float and double hold every float
+      break;
+    }
+    output_output[i] = x;
+  }
 }
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 void ONNC_RUNTIME_concat_float(
   void * restrict onnc_runtime_context
@@ -12,41 +13,26 @@ void ONNC_RUNTIME_concat_float(
   ,int32_t output_concat_result_ndim, const int32_t * restrict output_concat_result_dims
   ,int32_t axis
 ) {
-  int32_t elementDistance[input_inputs_ntensor];
-  for(int32_t ntensor = 0 ; ntensor < input_inputs_ntensor ; ntensor++){
-    elementDistance[ntensor] = 1;
-    for(int32_t dim = axis ; dim < input_inputs_ndim[ntensor] ; dim++){
-      elementDistance[ntensor] *= input_inputs_dims[ntensor][dim];
-    }
+  if (axis < 0) {
+    axis += output_concat_result_ndim;
   }
 
-  int32_t size[input_inputs_ntensor];
-  for(int32_t ntensor = 0 ; ntensor < input_inputs_ntensor ; ntensor++){
-    size[ntensor] = elementDistance[ntensor];
-    for(int32_t dim = 0 ; dim < axis ; dim++){
-      size[ntensor] *= input_inputs_dims[ntensor][dim];
-    }
+  // Every outer block of the output takes one block of each input in turn.
+  // A block of an input spans the axis and all the dimensions after it.
+  int64_t outer = 1;
+  for (int32_t dim = 0; dim < axis; ++dim) {
+    outer *= output_concat_result_dims[dim];
   }
 
-  int32_t axisDim = input_inputs_dims[0][axis];
-  int32_t axisIndex = 0;
-  int32_t insertIndex = 0;
-  while(axisIndex < axisDim){
-    for(int32_t ntensor = 0; ntensor < input_inputs_ntensor ; ntensor++){
-      int32_t base = axisIndex * elementDistance[ntensor];
-      int32_t index = base;
-      int32_t nElementDistance = elementDistance[ntensor];
-      while(index < size[ntensor]){
-        output_concat_result[insertIndex] = input_inputs[ntensor][index];
-        insertIndex++;
-        if(index % nElementDistance == nElementDistance - 1){
-          index = index + 1 - nElementDistance + nElementDistance * axisDim;
-        }
-        else{
-          ++index;
-        }
+  float *out = output_concat_result;
+  for (int64_t o = 0; o < outer; ++o) {
+    for (int32_t ntensor = 0; ntensor < input_inputs_ntensor; ++ntensor) {
+      int64_t block = 1;
+      for (int32_t dim = axis; dim < input_inputs_ndim[ntensor]; ++dim) {
+        block *= input_inputs_dims[ntensor][dim];
       }
+      memcpy(out, input_inputs[ntensor] + o * block, block * sizeof(float));
+      out += block;
     }
-    ++axisIndex;
   }
 }
@@ -1,9 +1,19 @@
 #include <onnc/Runtime/operator/conv.h>
+#include <onnc/Runtime/internal/activation.h>
+#include <onnc/Runtime/internal/conv.h>
+#include <onnc/Runtime/internal/half.h>
+#include <onnc/Runtime/internal/sgemm.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 
+// Upper bound (in floats) of the im2col scratch buffer. The output pixels are
+// processed in column tiles so that the lowered input stays cache resident
+// and the buffer size doesn't grow with the feature map. (4 MiB)
+#define CONV_COL_BUFFER_SIZE (1 << 20)
+
 static inline bool next_dim(int32_t ndim, int32_t * restrict dim,
                             const int32_t * restrict dim_max) {
   do {
@@ -20,88 +30,383 @@ static inline bool next_dim(int32_t ndim, int32_t * restrict dim,
   } while(true);
 }
 
-static inline int64_t dim_to_offset(int32_t ndim, const int32_t * restrict dim,
-                                    const int32_t * restrict dim_max) {
-  int64_t offset = 0;
-  int64_t step = 1;
-  for (int32_t i = ndim - 1; i >= 0; --i) {
-    offset += dim[i] * step;
-    step *= dim_max[i];
+static inline int64_t product(int32_t ndim, const int32_t * restrict dims) {
+  int64_t size = 1;
+  for (int32_t i = 0; i < ndim; ++i) {
+    size *= dims[i];
   }
-  return offset;
+  return size;
 }
 
-// If it is outside the bounds of the input, use 0.
-static inline float get_value_or_zero(int32_t ndim, const int32_t * restrict dim_max,
-                                      const float * restrict value, const int32_t * restrict dim) {
-  for (int32_t i = 0; i < ndim; ++i) {
-    if (dim[i] < 0 || dim[i] >= dim_max[i]) {
-      return 0.f;
+// Compute the range [*lo, *hi) of output positions o whose input position
+// o * stride + offset lies inside [0, in). offset is `k * dilation - pad`.
+static inline void valid_range(int32_t in, int32_t out, int32_t offset,
+                               int32_t stride, int32_t * restrict lo,
+                               int32_t * restrict hi) {
+  int32_t l = (offset >= 0) ? 0 : (-offset + stride - 1) / stride;
+  int32_t h = (in - 1 - offset < 0) ? 0 : (in - 1 - offset) / stride + 1;
+  if (l > out) l = out;
+  if (h > out) h = out;
+  if (h < l) h = l;
+  *lo = l;
+  *hi = h;
+}
+
+// Resolve the padding at the beginning of each spatial axis, taking auto_pad
+// into account.
+static void resolve_pads(int32_t nspatial,
+                         const int32_t * restrict in,
+                         const int32_t * restrict out,
+                         const int32_t * restrict kernel,
+                         const int32_t * restrict strides,
+                         const int32_t * restrict dilations,
+                         const char * restrict auto_pad,
+                         const int32_t * restrict pads, int32_t number_of_pads,
+                         int32_t * restrict pad_begin) {
+  bool same_upper = auto_pad != NULL && strcmp(auto_pad, "SAME_UPPER") == 0;
+  bool same_lower = auto_pad != NULL && strcmp(auto_pad, "SAME_LOWER") == 0;
+  bool valid = auto_pad != NULL && strcmp(auto_pad, "VALID") == 0;
+  for (int32_t i = 0; i < nspatial; ++i) {
+    if (same_upper || same_lower) {
+      int32_t total = (out[i] - 1) * strides[i] +
+                      (kernel[i] - 1) * dilations[i] + 1 - in[i];
+      if (total < 0) total = 0;
+      pad_begin[i] = same_upper ? total / 2 : (total + 1) / 2;
+    } else if (valid || i >= number_of_pads) {
+      pad_begin[i] = 0;
+    } else {
+      pad_begin[i] = pads[i];
     }
   }
-  return value[dim_to_offset(ndim, dim, dim_max)];
 }
 
-void ONNC_RUNTIME_conv_2d_float(void * restrict onnc_runtime_context,
-                                int32_t N, int32_t C, int32_t iH, int32_t iW,
-                                const float X[restrict N][C][iH][iW],
-                                int32_t M, int32_t kC, int32_t kH, int32_t kW,
-                                const float W[restrict M][kC][kH][kW],
-                                const float B[restrict M],
-                                int32_t oN, int32_t oC, int32_t oH, int32_t oW,
-                                float Y[restrict oN][oC][oH][oW],
-                                int32_t auto_pad,
-                                const int32_t * restrict dilations,
-                                int32_t group,
-                                const int32_t * restrict kernel_shape,
-                                const int32_t * restrict pads,
-                                const int32_t * restrict strides) {
-  // TODO: auto_pad
-  // TODO: type
-  for (int32_t n = 0; n < oN; ++n) {
-    for (int32_t c = 0; c < oC; ++c) {
-
-      for (int32_t h = 0; h < oH; ++h) {
-        for (int32_t w = 0; w < oW; ++w) {
-
-          int32_t base_c = (c * group / M) * kC; // input channel <-group-> output channel
-          int32_t base_h = h * strides[0] - pads[0];
-          int32_t base_w = w * strides[1] - pads[1];
-
-          float sum = 0.f;
-
-          for (int32_t i = (base_h < 0 ? (-base_h) / dilations[0] : 0); i < kH; ++i) {
-            int32_t input_h = base_h + i * dilations[0];
-            if (input_h >= iH) { break; }
-            for (int32_t j =  (base_w < 0 ? (-base_w) / dilations[1] : 0); j < kW; ++j) {
-              int32_t input_w = base_w + j * dilations[1];
-              if (input_w >= iW) { break; }
-              for (int32_t w_channel = 0; w_channel < kC; ++w_channel) {
-                int32_t input_channel = base_c + w_channel;
-
-                float input = X[n][input_channel][input_h][input_w];
-                float weight = W[c][w_channel][i][j];
-                sum += input * weight;
-              }
+// Lower columns [q0, q0 + nq) of a 2-D convolution into a
+// [kC * kH * kW] x [nq] matrix. Padding is resolved per row segment, so the
+// copy loops don't check bounds per element.
+static void im2col_2d(const float * restrict X, int32_t kC,
+                      int32_t iH, int32_t iW, int32_t kH, int32_t kW,
+                      int32_t sH, int32_t sW, int32_t pH, int32_t pW,
+                      int32_t dH, int32_t dW, int32_t oW,
+                      int64_t q0, int32_t nq, float * restrict col) {
+  int32_t ow_lo[kW], ow_hi[kW];
+  for (int32_t kw = 0; kw < kW; ++kw) {
+    valid_range(iW, oW, kw * dW - pW, sW, &ow_lo[kw], &ow_hi[kw]);
+  }
+
+  for (int32_t c = 0; c < kC; ++c) {
+    const float * restrict x_c = X + (int64_t)c * iH * iW;
+    for (int32_t kh = 0; kh < kH; ++kh) {
+      for (int32_t kw = 0; kw < kW; ++kw) {
+        int32_t lo = ow_lo[kw], hi = ow_hi[kw];
+        int64_t q = q0;
+        int64_t q_end = q0 + nq;
+        while (q < q_end) {
+          int32_t oh = (int32_t)(q / oW);
+          int32_t ow = (int32_t)(q % oW);
+          int32_t ow_end = (q_end - q < oW - ow) ? ow + (int32_t)(q_end - q) : oW;
+          float * restrict dst = col + (q - q0) - ow;
+          int32_t ih = oh * sH - pH + kh * dH;
+          if (ih < 0 || ih >= iH) {
+            memset(dst + ow, 0, sizeof(float) * (ow_end - ow));
+          } else {
+            const float * restrict src = x_c + (int64_t)ih * iW + kw * dW - pW;
+            int32_t a = ow < lo ? lo : ow;
+            int32_t b = ow_end < hi ? ow_end : hi;
+            int32_t x = ow;
+            for (; x < a && x < ow_end; ++x) dst[x] = 0.f;
+            if (sW == 1) {
+              for (; x < b; ++x) dst[x] = src[x];
+            } else {
+              for (; x < b; ++x) dst[x] = src[(int64_t)x * sW];
             }
+            for (; x < ow_end; ++x) dst[x] = 0.f;
+          }
+          q += ow_end - ow;
+        }
+        col += nq;
+      }
+    }
+  }
+}
+
+// N-d version of im2col_2d. Used for convolutions with three or more spatial
+// axes.
+static void im2col_nd(int32_t nspatial, const float * restrict X, int32_t kC,
+                      const int32_t * restrict in,
+                      const int32_t * restrict out,
+                      const int32_t * restrict kernel,
+                      const int32_t * restrict strides,
+                      const int32_t * restrict pads,
+                      const int32_t * restrict dilations,
+                      int64_t q0, int32_t nq, float * restrict col) {
+  int64_t in_size = product(nspatial, in);
+  for (int32_t c = 0; c < kC; ++c) {
+    const float * restrict x_c = X + c * in_size;
+    int32_t k_dim[nspatial];
+    memset(k_dim, 0, sizeof(k_dim));
+    do { // while k_dim
+      int32_t o_dim[nspatial];
+      int64_t rest = q0;
+      for (int32_t i = nspatial - 1; i >= 0; --i) {
+        o_dim[i] = (int32_t)(rest % out[i]);
+        rest /= out[i];
+      }
+      for (int32_t t = 0; t < nq; ++t) {
+        int64_t offset = 0;
+        bool inside = true;
+        for (int32_t i = 0; i < nspatial; ++i) {
+          int32_t pos = o_dim[i] * strides[i] - pads[i] + k_dim[i] * dilations[i];
+          if (pos < 0 || pos >= in[i]) {
+            inside = false;
+            break;
           }
+          offset = offset * in[i] + pos;
+        }
+        col[t] = inside ? x_c[offset] : 0.f;
+        if (t + 1 < nq) next_dim(nspatial, o_dim, out);
+      }
+      col += nq;
+    } while (next_dim(nspatial, k_dim, kernel));
+  }
+}
+
+// Depthwise convolution (group == C, one input channel per group). The
+// lowered matrix would have a single output row, so run a direct loop that
+// keeps the innermost loop over the contiguous output width instead. 16-bit
+// weights are widened one kernel at a time.
+static void conv_depthwise_2d(int32_t N, int32_t C, int32_t iH, int32_t iW,
+                              const float * restrict X,
+                              int32_t M, int32_t kH, int32_t kW,
+                              const void * restrict W, int32_t W_storage,
+                              const float * restrict B,
+                              int32_t oH, int32_t oW, float * restrict Y,
+                              int32_t sH, int32_t sW, int32_t pH, int32_t pW,
+                              int32_t dH, int32_t dW,
+                              const ONNC_RUNTIME_Activation * restrict acts,
+                              int32_t number_of_acts) {
+  int32_t multiplier = M / C;
+  int32_t ow_lo[kW], ow_hi[kW];
+  for (int32_t kw = 0; kw < kW; ++kw) {
+    valid_range(iW, oW, kw * dW - pW, sW, &ow_lo[kw], &ow_hi[kw]);
+  }
 
-          if (B != NULL) {
-            sum += B[c];
+  float kernel[kH * kW];
+  for (int32_t n = 0; n < N; ++n) {
+    for (int32_t m = 0; m < M; ++m) {
+      const float * restrict x = X + ((int64_t)n * C + m / multiplier) * iH * iW;
+      const float * restrict w = kernel;
+      const void *w_m = ONNC_RUNTIME_internal_storage_at(W_storage, W,
+                                                         (int64_t)m * kH * kW);
+      if (W_storage == ONNC_RUNTIME_STORAGE_FLOAT) {
+        w = (const float *)w_m;
+      } else {
+        ONNC_RUNTIME_internal_widen(W_storage, w_m, kernel, kH * kW);
+      }
+      float * restrict y = Y + ((int64_t)n * M + m) * oH * oW;
+      float bias = (B != NULL) ? B[m] : 0.f;
+
+      for (int32_t oh = 0; oh < oH; ++oh) {
+        float * restrict y_row = y + (int64_t)oh * oW;
+        for (int32_t ow = 0; ow < oW; ++ow) {
+          y_row[ow] = bias;
+        }
+        for (int32_t kh = 0; kh < kH; ++kh) {
+          int32_t ih = oh * sH - pH + kh * dH;
+          if (ih < 0 || ih >= iH) {
+            continue;
+          }
+          const float * restrict x_row = x + (int64_t)ih * iW;
+          for (int32_t kw = 0; kw < kW; ++kw) {
+            const float wv = w[kh * kW + kw];
+            const float * restrict src = x_row + kw * dW - pW;
+            if (sW == 1) {
+              for (int32_t ow = ow_lo[kw]; ow < ow_hi[kw]; ++ow) {
+                y_row[ow] += wv * src[ow];
+              }
+            } else {
+              for (int32_t ow = ow_lo[kw]; ow < ow_hi[kw]; ++ow) {
+                y_row[ow] += wv * src[(int64_t)ow * sW];
+              }
+            }
           }
-          Y[n][c][h][w] = sum;
         }
+        // The row is final and still in L1.
+        ONNC_RUNTIME_internal_activate_all(acts, number_of_acts, oW, y_row);
       }
     }
   }
 }
 
-void ONNC_RUNTIME_conv_float(
+// Direct convolution without any scratch memory. conv_gemm falls back to it
+// when the im2col buffer can not be allocated.
+static void conv_direct(int32_t nspatial, int32_t N, int32_t C,
+                        const int32_t * restrict in, const float * restrict X,
+                        int32_t M, int32_t kC, const int32_t * restrict kernel,
+                        const void * restrict W, int32_t W_storage,
+                        const float * restrict B,
+                        const int32_t * restrict out, float * restrict Y,
+                        int32_t group,
+                        const int32_t * restrict strides,
+                        const int32_t * restrict pads,
+                        const int32_t * restrict dilations,
+                        const ONNC_RUNTIME_Activation * restrict acts,
+                        int32_t number_of_acts) {
+  int64_t in_size = product(nspatial, in);
+  int64_t out_size = product(nspatial, out);
+  int64_t k_size = product(nspatial, kernel);
+  int32_t Mg = M / group;
+
+  for (int32_t n = 0; n < N; ++n) {
+    for (int32_t m = 0; m < M; ++m) {
+      int32_t g = m / Mg;
+      const float * restrict x_g = X + ((int64_t)n * C + (int64_t)g * kC) * in_size;
+      float * restrict y_m = Y + ((int64_t)n * M + m) * out_size;
+      int32_t o_dim[nspatial];
+      memset(o_dim, 0, sizeof(o_dim));
+      for (int64_t q = 0; q < out_size; ++q) {
+        float sum = (B != NULL) ? B[m] : 0.f;
+        for (int32_t c = 0; c < kC; ++c) {
+          const float * restrict x_c = x_g + c * in_size;
+          int64_t w_base = ((int64_t)m * kC + c) * k_size;
+          int32_t k_dim[nspatial];
+          memset(k_dim, 0, sizeof(k_dim));
+          int64_t k = 0;
+          do { // while k_dim
+            int64_t offset = 0;
+            bool inside = true;
+            for (int32_t i = 0; i < nspatial; ++i) {
+              int32_t pos = o_dim[i] * strides[i] - pads[i] + k_dim[i] * dilations[i];
+              if (pos < 0 || pos >= in[i]) {
+                inside = false;
+                break;
+              }
+              offset = offset * in[i] + pos;
+            }
+            if (inside) {
+              float w;
+              ONNC_RUNTIME_internal_widen(
+                W_storage,
+                ONNC_RUNTIME_internal_storage_at(W_storage, W, w_base + k),
+                &w, 1);
+              sum += w * x_c[offset];
+            }
+            ++k;
+          } while (next_dim(nspatial, k_dim, kernel));
+        }
+        y_m[q] = sum;
+        if (q + 1 < out_size) next_dim(nspatial, o_dim, out);
+      }
+      ONNC_RUNTIME_internal_activate_all(acts, number_of_acts,
+                                         (int32_t)out_size, y_m);
+    }
+  }
+}
+
+// Lower the convolution to one GEMM per (batch, group):
+//   Y_g[M/group x oHW] = W_g[M/group x K] * col(X_g)[K x oHW]
+// where K = kC * prod(kernel). A point-wise convolution uses X_g as is.
+// The activations run on each tile of Y right after its GEMM.
+static void conv_gemm(void * restrict onnc_runtime_context,
+                      int32_t nspatial, int32_t N, int32_t C,
+                      const int32_t * restrict in, const float * restrict X,
+                      int32_t M, int32_t kC, const int32_t * restrict kernel,
+                      const void * restrict W, int32_t W_storage,
+                      const float * restrict B,
+                      const int32_t * restrict out, float * restrict Y,
+                      int32_t group,
+                      const int32_t * restrict strides,
+                      const int32_t * restrict pads,
+                      const int32_t * restrict dilations,
+                      const ONNC_RUNTIME_Activation * restrict acts,
+                      int32_t number_of_acts) {
+  int64_t in_size = product(nspatial, in);
+  int64_t out_size = product(nspatial, out);
+  int32_t K = kC * (int32_t)product(nspatial, kernel);
+  int32_t Mg = M / group;
+
+  bool pointwise = true;
+  for (int32_t i = 0; i < nspatial; ++i) {
+    pointwise = pointwise && kernel[i] == 1 && strides[i] == 1 &&
+                pads[i] == 0 && in[i] == out[i];
+  }
+
+  int32_t nq = 0;
+  float *col = NULL;
+  if (!pointwise) {
+    int64_t cols = CONV_COL_BUFFER_SIZE / K;
+    if (cols < ONNC_RUNTIME_SGEMM_NR) cols = ONNC_RUNTIME_SGEMM_NR;
+    if (cols > out_size) cols = out_size;
+    nq = (int32_t)cols;
+    col = (float *)malloc(sizeof(float) * K * nq);
+    if (col == NULL) {
+      conv_direct(nspatial, N, C, in, X, M, kC, kernel, W, W_storage, B,
+                  out, Y, group, strides, pads, dilations,
+                  acts, number_of_acts);
+      return;
+    }
+  }
+
+  for (int32_t n = 0; n < N; ++n) {
+    for (int32_t g = 0; g < group; ++g) {
+      const float * restrict x_g = X + ((int64_t)n * C + (int64_t)g * kC) * in_size;
+      const void *w_g = ONNC_RUNTIME_internal_storage_at(W_storage, W,
+                                                         (int64_t)g * Mg * K);
+      float * restrict y_g = Y + ((int64_t)n * M + (int64_t)g * Mg) * out_size;
+
+      // Seed the output with bias, then accumulate with beta = 1.
+      for (int32_t m = 0; m < Mg; ++m) {
+        float bias = (B != NULL) ? B[g * Mg + m] : 0.f;
+        float * restrict y_m = y_g + m * out_size;
+        for (int64_t q = 0; q < out_size; ++q) {
+          y_m[q] = bias;
+        }
+      }
+
+      if (pointwise) {
+        ONNC_RUNTIME_internal_sgemm_mixed(onnc_runtime_context, false, false,
+                                          Mg, (int32_t)out_size, K, 1.f,
+                                          w_g, W_storage, K,
+                                          x_g, ONNC_RUNTIME_STORAGE_FLOAT,
+                                          (int32_t)out_size,
+                                          1.f, y_g, (int32_t)out_size);
+        ONNC_RUNTIME_internal_activate_all(acts, number_of_acts,
+                                           (int32_t)(Mg * out_size), y_g);
+        continue;
+      }
+
+      for (int64_t q0 = 0; q0 < out_size; q0 += nq) {
+        int32_t cols = (out_size - q0 < nq) ? (int32_t)(out_size - q0) : nq;
+        if (nspatial == 2) {
+          im2col_2d(x_g, kC, in[0], in[1], kernel[0], kernel[1],
+                    strides[0], strides[1], pads[0], pads[1],
+                    dilations[0], dilations[1], out[1], q0, cols, col);
+        } else {
+          im2col_nd(nspatial, x_g, kC, in, out, kernel, strides, pads,
+                    dilations, q0, cols, col);
+        }
+        ONNC_RUNTIME_internal_sgemm_mixed(onnc_runtime_context, false, false,
+                                          Mg, cols, K, 1.f,
+                                          w_g, W_storage, K,
+                                          col, ONNC_RUNTIME_STORAGE_FLOAT, cols,
+                                          1.f, y_g + q0, (int32_t)out_size);
+        for (int32_t m = 0; m < Mg && number_of_acts > 0; ++m) {
+          ONNC_RUNTIME_internal_activate_all(acts, number_of_acts, cols,
+                                             y_g + m * out_size + q0);
+        }
+      }
+    }
+  }
+
+  free(col);
+}
+
+void ONNC_RUNTIME_internal_conv_float(
   void * restrict onnc_runtime_context
   ,const float * restrict input_X
   ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
-  ,const float * restrict input_W
+  ,const void * restrict input_W
   ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,int32_t input_W_storage
   ,const float * restrict input_B
   ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
   ,float * restrict output_Y
@@ -116,71 +421,114 @@ void ONNC_RUNTIME_conv_float(
   ,int32_t number_of_pads
   ,int32_t * restrict strides
   ,int32_t number_of_strides
+  ,const ONNC_RUNTIME_Activation * restrict acts
+  ,int32_t number_of_acts
 ) {
-    int32_t M = input_W_dims[0];
-    int32_t C = input_W_dims[1];
-    int32_t ndim = input_X_ndim;
-
-    if (ndim == 4) {
-      ONNC_RUNTIME_conv_2d_float(onnc_runtime_context,
-                                 input_X_dims[0], input_X_dims[1],
-                                 input_X_dims[2], input_X_dims[3],
-                                 input_X,
-                                 input_W_dims[0], input_W_dims[1],
-                                 input_W_dims[2], input_W_dims[3],
-                                 input_W,
-                                 input_B,
-                                 output_Y_dims[0], output_Y_dims[1],
-                                 output_Y_dims[2], output_Y_dims[3],
-                                 output_Y,
-                                 0,
-                                 dilations,
-                                 group,
-                                 kernel_shape,
-                                 pads,
-                                 strides);
-      return;
-    }
-
-    // TODO: type
-    int32_t o_dim[ndim];
-    memset(o_dim, 0, sizeof(o_dim));
-    do { // while o_dim
-        int32_t base_dim[ndim];
-        base_dim[0] = o_dim[0]; // N
-        for (int32_t i = 2; i < ndim; ++i) {
-            base_dim[i] = o_dim[i] * strides[i - 2] - pads[i - 2];
-        }
+  // TODO: type
+  int32_t N = input_X_dims[0];
+  int32_t C = input_X_dims[1];
+  int32_t M = input_W_dims[0];
+  int32_t kC = input_W_dims[1];
+  if (group <= 0) {
+    group = 1;
+  }
 
-        float sum = 0.f;
+  // Normalize the spatial parameters. A 1-D convolution is treated as a 2-D
+  // one with a unit height, so that it shares the 2-D fast paths.
+  int32_t nspatial = input_X_ndim - 2;
+  int32_t offset = (nspatial == 1) ? 1 : 0;
+  int32_t rank = nspatial + offset;
+  int32_t in[rank], out[rank], kernel[rank];
+  int32_t stride[rank], dilation[rank], pad[rank];
+  for (int32_t i = 0; i < offset; ++i) {
+    in[i] = out[i] = kernel[i] = stride[i] = dilation[i] = 1;
+  }
+  for (int32_t i = 0; i < nspatial; ++i) {
+    in[offset + i] = input_X_dims[2 + i];
+    out[offset + i] = output_Y_dims[2 + i];
+    kernel[offset + i] = input_W_dims[2 + i];
+    stride[offset + i] = (i < number_of_strides) ? strides[i] : 1;
+    dilation[offset + i] = (i < number_of_dilations) ? dilations[i] : 1;
+  }
+  pad[0] = 0;
+  resolve_pads(nspatial, in + offset, out + offset, kernel + offset,
+               stride + offset, dilation + offset, auto_pad,
+               pads, number_of_pads, pad + offset);
 
-        int32_t w_dim[ndim];
-        memset(w_dim, 0, sizeof(w_dim));
-        w_dim[0] = o_dim[1]; // M;
-        do { // while w_dim
-            if (w_dim[1] == 1) { // all D1 ~ Dn done.
-                break;
-            }
+  if (rank == 2 && group == C && kC == 1 && group > 1) {
+    conv_depthwise_2d(N, C, in[0], in[1], input_X,
+                      M, kernel[0], kernel[1],
+                      input_W, input_W_storage, input_B,
+                      out[0], out[1], output_Y,
+                      stride[0], stride[1], pad[0], pad[1],
+                      dilation[0], dilation[1], acts, number_of_acts);
+    return;
+  }
 
-            int32_t i_dim[ndim];
-            i_dim[0] = base_dim[0]; // N
-            for (int32_t i = 2; i < ndim; ++i) {
-                i_dim[i] = base_dim[i] + w_dim[i] * dilations[i - 2];
-            }
-            for (int32_t channel = 0; channel < C; ++channel) {
-                i_dim[1] = (o_dim[1] * group / M) * C + channel; // input channel <-group-> output channel
-                w_dim[1] = channel; // C
+  conv_gemm(onnc_runtime_context, rank, N, C, in, input_X, M, kC, kernel,
+            input_W, input_W_storage, input_B, out, output_Y,
+            group, stride, pad, dilation,
+            acts, number_of_acts);
+}
 
-                float input = get_value_or_zero(ndim, input_X_dims, input_X, i_dim);
-                float weight = get_value_or_zero(ndim, input_W_dims, input_W, w_dim);
-                sum += input * weight;
-            }
-            w_dim[1] = 0; // reset C
-        } while (next_dim(ndim, w_dim, input_W_dims));
+void ONNC_RUNTIME_conv_mixed(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const void * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,const char * restrict auto_pad
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+  ,int32_t weight_type
+) {
+  ONNC_RUNTIME_internal_conv_float(
+    onnc_runtime_context,
+    input_X, input_X_ndim, input_X_dims,
+    input_W, input_W_ndim, input_W_dims, weight_type,
+    input_B, input_B_ndim, input_B_dims,
+    output_Y, output_Y_ndim, output_Y_dims,
+    auto_pad, dilations, number_of_dilations, group,
+    kernel_shape, number_of_kernel_shape, pads, number_of_pads,
+    strides, number_of_strides, NULL, 0);
+}
 
-        if (input_B != NULL) {
-            sum += input_B[o_dim[1]];
-        }
-        output_Y[dim_to_offset(ndim, o_dim, output_Y_dims)] = sum;
-    } while (next_dim(ndim, o_dim, output_Y_dims));
+void ONNC_RUNTIME_conv_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const float * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,const char * restrict auto_pad
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+) {
+  ONNC_RUNTIME_conv_mixed(
+    onnc_runtime_context, input_X, input_X_ndim, input_X_dims, input_W,
+    input_W_ndim, input_W_dims, input_B, input_B_ndim, input_B_dims, output_Y,
+    output_Y_ndim, output_Y_dims, auto_pad, dilations, number_of_dilations,
+    group, kernel_shape, number_of_kernel_shape, pads, number_of_pads,
+    strides, number_of_strides, ONNC_RUNTIME_STORAGE_FLOAT);
 }
@@ -0,0 +1,399 @@
+#include <onnc/Runtime/operator/convnchwc.h>
+#include <onnc/Runtime/internal/activation.h>
+#include <onnc/Runtime/internal/layout.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// Convolutions of fewer multiply-adds than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 18)
+
+// Output channel blocks computed by one tile.
+#define OUTPUT_BLOCKS 2
+
+// Accumulators and weight vectors of one tile, in vector registers.
+#define MAX_ACC 24
+#define MAX_WEIGHTS 8
+
+// The row driver is compiled once per instruction set and picked on the
+// first call. A tile of output pixels is as wide as the vector registers
+// of the variant allow; the helpers are forced inline so that the tile
+// width and the block are constants in every variant.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CONV_X86_DISPATCH 1
+#endif
+
+#if defined(__GNUC__)
+#define CONV_INLINE static inline __attribute__((always_inline))
+#else
+#define CONV_INLINE static inline
+#endif
+
+static inline int32_t min_i32(int32_t a, int32_t b) {
+  return a < b ? a : b;
+}
+
+static inline int64_t min_i64(int64_t a, int64_t b) {
+  return a < b ? a : b;
+}
+
+typedef struct Convolution {
+  const float *x, *w, *b;
+  float *y;
+  int32_t block;
+  int32_t Cb, H, W;       // blocked X
+  int32_t Mb, OH, OW;     // blocked Y
+  int32_t KH, KW;
+  int32_t SH, SW, DH, DW, PH, PW;
+  const ONNC_RUNTIME_Activation *acts;
+  int32_t number_of_acts;
+  int64_t rows;           // N * ceil(Mb / OUTPUT_BLOCKS) * OH
+  int64_t chunk;          // rows per task
+} Convolution;
+
+#if defined(__GNUC__)
+// y[m][r][co] = bias[m][co] + sum over cb, kh, kw, ci of
+//               x[cb][ih0 + kh * DH][iw0 + r * SW + kw * DW][ci] *
+//               w[m][cb][kh][kw][ci][co]
+// for the rw output pixels and mt output channel blocks of a tile, where the
+// B output channels of a block are B / VW vectors of VW floats. Every input
+// element loaded feeds mt * B / VW multiply-adds. With check, taps left or
+// right of the image are skipped; rows above and below are always skipped.
+#define DEFINE_TILE(VW)                                                        \
+typedef float vec##VW##_t __attribute__((vector_size(VW * sizeof(float))));    \
+CONV_INLINE void tile_##VW(int32_t B, int32_t mt, int32_t rw, bool check,      \
+                           const Convolution *t,                               \
+                           const float * restrict x,                           \
+                           const float * restrict w,                           \
+                           const float * restrict bias,                        \
+                           int32_t ih0, int32_t iw0, float * restrict y) {     \
+  const int32_t nv = B / VW, np = mt * nv;                                     \
+  const int64_t w_block = (int64_t)t->Cb * t->KH * t->KW * B * B;              \
+  const int64_t y_block = (int64_t)t->OH * t->OW * B;                          \
+  vec##VW##_t acc[MAX_ACC];                                                    \
+  _Pragma("GCC unroll 16")                                                     \
+  for (int32_t v = 0; v < np; ++v) {                                           \
+    vec##VW##_t b = { 0 };                                                     \
+    if (bias != NULL) {                                                        \
+      memcpy(&b, bias + v * VW, sizeof(b));                                    \
+    }                                                                          \
+    _Pragma("GCC unroll 16")                                                   \
+    for (int32_t r = 0; r < rw; ++r) {                                         \
+      acc[r * np + v] = b;                                                     \
+    }                                                                          \
+  }                                                                            \
+  for (int32_t cb = 0; cb < t->Cb; ++cb) {                                     \
+    const float *xc = x + (int64_t)cb * t->H * t->W * B;                       \
+    const float *wc = w + (int64_t)cb * t->KH * t->KW * B * B;                 \
+    for (int32_t kh = 0; kh < t->KH; ++kh) {                                   \
+      int32_t ih = ih0 + kh * t->DH;                                           \
+      if (ih < 0 || ih >= t->H) {                                              \
+        continue;                                                              \
+      }                                                                        \
+      const float *xr = xc + (int64_t)ih * t->W * B;                           \
+      for (int32_t kw = 0; kw < t->KW; ++kw) {                                 \
+        int32_t iw = iw0 + kw * t->DW;                                         \
+        const float *wk = wc + (int64_t)(kh * t->KW + kw) * B * B;             \
+        for (int32_t ci = 0; ci < B; ++ci) {                                   \
+          vec##VW##_t wv[MAX_WEIGHTS];                                         \
+          _Pragma("GCC unroll 16")                                             \
+          for (int32_t v = 0; v < np; ++v) {                                   \
+            memcpy(&wv[v], wk + (v / nv) * w_block + ci * B + (v % nv) * VW,  \
+                   sizeof(wv[v]));                                             \
+          }                                                                    \
+          _Pragma("GCC unroll 16")                                             \
+          for (int32_t r = 0; r < rw; ++r) {                                   \
+            int32_t col = iw + r * t->SW;                                      \
+            if (check && (col < 0 || col >= t->W)) {                           \
+              continue;                                                        \
+            }                                                                  \
+            float xs = xr[(int64_t)col * B + ci];                              \
+            _Pragma("GCC unroll 16")                                           \
+            for (int32_t v = 0; v < np; ++v) {                                 \
+              acc[r * np + v] += xs * wv[v];                                   \
+            }                                                                  \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  _Pragma("GCC unroll 16")                                                     \
+  for (int32_t r = 0; r < rw; ++r) {                                           \
+    _Pragma("GCC unroll 16")                                                   \
+    for (int32_t v = 0; v < np; ++v) {                                         \
+      vec##VW##_t out = acc[r * np + v];                                       \
+      memcpy(y + (v / nv) * y_block + r * B + (v % nv) * VW, &out,             \
+             sizeof(out));                                                     \
+    }                                                                          \
+  }                                                                            \
+}
+
+DEFINE_TILE(4)
+DEFINE_TILE(8)
+DEFINE_TILE(16)
+#endif
+
+// One tile of rw pixels and mt output channel blocks with vectors of vw
+// floats. w, bias and y point to the first block.
+CONV_INLINE void tile(int32_t vw, int32_t B, int32_t mt, int32_t rw,
+                      bool check, const Convolution *t,
+                      const float * restrict x, const float * restrict w,
+                      const float * restrict bias, int32_t ih0, int32_t iw0,
+                      float * restrict y) {
+#if defined(__GNUC__)
+  if (vw == 16) {
+    tile_16(B, mt, rw, check, t, x, w, bias, ih0, iw0, y);
+  } else if (vw == 8) {
+    tile_8(B, mt, rw, check, t, x, w, bias, ih0, iw0, y);
+  } else {
+    tile_4(B, mt, rw, check, t, x, w, bias, ih0, iw0, y);
+  }
+#else
+  (void)vw;
+  const int64_t w_block = (int64_t)t->Cb * t->KH * t->KW * B * B;
+  const int64_t y_block = (int64_t)t->OH * t->OW * B;
+  for (int32_t m = 0; m < mt; ++m) {
+    const float *wm = w + m * w_block;
+    float *ym = y + m * y_block;
+    for (int32_t r = 0; r < rw; ++r) {
+      for (int32_t co = 0; co < B; ++co) {
+        ym[r * B + co] = (bias != NULL) ? bias[m * B + co] : 0.f;
+      }
+    }
+    for (int32_t cb = 0; cb < t->Cb; ++cb) {
+      for (int32_t kh = 0; kh < t->KH; ++kh) {
+        int32_t ih = ih0 + kh * t->DH;
+        if (ih < 0 || ih >= t->H) {
+          continue;
+        }
+        for (int32_t kw = 0; kw < t->KW; ++kw) {
+          const float *wk =
+              wm + ((int64_t)(cb * t->KH + kh) * t->KW + kw) * B * B;
+          for (int32_t r = 0; r < rw; ++r) {
+            int32_t col = iw0 + r * t->SW + kw * t->DW;
+            if (check && (col < 0 || col >= t->W)) {
+              continue;
+            }
+            const float *xp = x + (((int64_t)cb * t->H + ih) * t->W + col) * B;
+            for (int32_t ci = 0; ci < B; ++ci) {
+              for (int32_t co = 0; co < B; ++co) {
+                ym[r * B + co] += xp[ci] * wk[ci * B + co];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+#endif
+}
+
+// Pixels [ow, ow + width) of a row, with bound checks only if some of their
+// taps are outside [lo, hi).
+CONV_INLINE void tile_at(int32_t vw, int32_t B, int32_t mt, int32_t width,
+                         const Convolution *t, const float * restrict x,
+                         const float * restrict w,
+                         const float * restrict bias, int32_t ih0,
+                         int32_t ow, int32_t lo, int32_t hi,
+                         float * restrict y) {
+  int32_t iw0 = ow * t->SW - t->PW;
+  if (ow >= lo && ow + width <= hi) {
+    tile(vw, B, mt, width, false, t, x, w, bias, ih0, iw0, y + ow * B);
+  } else {
+    tile(vw, B, mt, width, true, t, x, w, bias, ih0, iw0, y + ow * B);
+  }
+}
+
+// One row of mt output channel blocks, in tiles of rw pixels, then rw / 2,
+// rw / 4 and single pixels. The pixels in [lo, hi) have all their taps inside
+// the image.
+CONV_INLINE void conv_row(int32_t vw, int32_t B, int32_t mt, int32_t rw,
+                          const Convolution *t, const float * restrict x,
+                          const float * restrict w,
+                          const float * restrict bias, int32_t ih0,
+                          float * restrict y) {
+  int32_t lo = min_i32(t->OW, (t->PW + t->SW - 1) / t->SW);
+  int32_t last = t->W - 1 - (t->KW - 1) * t->DW + t->PW;
+  int32_t hi = (last < 0) ? 0 : min_i32(t->OW, last / t->SW + 1);
+
+  int32_t ow = 0;
+  for (; ow + rw <= t->OW; ow += rw) {
+    tile_at(vw, B, mt, rw, t, x, w, bias, ih0, ow, lo, hi, y);
+  }
+  if (rw >= 2 && ow + rw / 2 <= t->OW) {
+    tile_at(vw, B, mt, rw / 2, t, x, w, bias, ih0, ow, lo, hi, y);
+    ow += rw / 2;
+  }
+  if (rw >= 4 && ow + rw / 4 <= t->OW) {
+    tile_at(vw, B, mt, rw / 4, t, x, w, bias, ih0, ow, lo, hi, y);
+    ow += rw / 4;
+  }
+  for (; ow < t->OW; ++ow) {
+    tile_at(vw, B, mt, 1, t, x, w, bias, ih0, ow, lo, hi, y);
+  }
+}
+
+// Rows [begin, end) of the OUTPUT_BLOCKS output channel blocks at a time,
+// counted as N x ceil(Mb / OUTPUT_BLOCKS) x OH. A last, narrower group goes
+// one block at a time.
+CONV_INLINE void conv_rows(int32_t vw, int32_t B, int32_t rw,
+                           const Convolution *t, int64_t begin, int64_t end) {
+  int32_t groups = (t->Mb + OUTPUT_BLOCKS - 1) / OUTPUT_BLOCKS;
+  int64_t w_block = (int64_t)t->Cb * t->KH * t->KW * B * B;
+  for (int64_t row = begin; row < end; ++row) {
+    int32_t oh = (int32_t)(row % t->OH);
+    int64_t image = row / t->OH;
+    int32_t mb = (int32_t)(image % groups) * OUTPUT_BLOCKS;
+    int32_t n = (int32_t)(image / groups);
+    const float *x = t->x + (int64_t)n * t->Cb * t->H * t->W * B;
+    int32_t ih0 = oh * t->SH - t->PH;
+    int32_t mt = min_i32(OUTPUT_BLOCKS, t->Mb - mb);
+    for (int32_t m = 0; m < mt; m += (mt == OUTPUT_BLOCKS) ? mt : 1) {
+      const float *w = t->w + (mb + m) * w_block;
+      const float *bias = (t->b != NULL) ? t->b + (int64_t)(mb + m) * B : NULL;
+      float *y = t->y + (((int64_t)n * t->Mb + mb + m) * t->OH + oh) *
+                        t->OW * B;
+      if (mt == OUTPUT_BLOCKS) {
+        conv_row(vw, B, OUTPUT_BLOCKS, rw, t, x, w, bias, ih0, y);
+      } else {
+        conv_row(vw, B, 1, rw, t, x, w, bias, ih0, y);
+      }
+    }
+
+    if (t->number_of_acts > 0) {
+      for (int32_t m = 0; m < mt; ++m) {
+        float *y = t->y + (((int64_t)n * t->Mb + mb + m) * t->OH + oh) *
+                          t->OW * B;
+        ONNC_RUNTIME_internal_activate_all(t->acts, t->number_of_acts,
+                                           t->OW * B, y);
+      }
+    }
+  }
+}
+
+typedef void (*conv_fn)(const Convolution *t, int64_t begin, int64_t end);
+
+// Tiles use rw * OUTPUT_BLOCKS * B / vw accumulators, which must fit in the
+// vector registers of the variant with the weights of one input channel.
+#define DEFINE_CONV_VARIANT(name, attribute, vw8, rw8, vw16, rw16)             \
+attribute static void name(const Convolution *t, int64_t begin, int64_t end) { \
+  if (t->block == 16) {                                                        \
+    conv_rows(vw16, 16, rw16, t, begin, end);                                  \
+  } else {                                                                     \
+    conv_rows(vw8, 8, rw8, t, begin, end);                                     \
+  }                                                                            \
+}
+
+DEFINE_CONV_VARIANT(conv_default, , 4, 3, 4, 1)
+#ifdef CONV_X86_DISPATCH
+DEFINE_CONV_VARIANT(conv_avx2, __attribute__((target("avx2,fma"))),
+                    8, 6, 8, 3)
+DEFINE_CONV_VARIANT(conv_avx512, __attribute__((target("avx512f"))),
+                    8, 6, 16, 12)
+#endif
+
+static conv_fn g_Conv = NULL;
+
+static conv_fn conv_kernel(void) {
+  conv_fn fn = __atomic_load_n(&g_Conv, __ATOMIC_RELAXED);
+  if (fn == NULL) {
+    fn = conv_default;
+#ifdef CONV_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      fn = conv_avx512;
+    } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      fn = conv_avx2;
+    }
+#endif
+    __atomic_store_n(&g_Conv, fn, __ATOMIC_RELAXED);
+  }
+  return fn;
+}
+
+static void conv_task(void *arg, int32_t task) {
+  const Convolution *t = (const Convolution *)arg;
+  int64_t begin = task * t->chunk;
+  conv_kernel()(t, begin, min_i64(begin + t->chunk, t->rows));
+}
+
+// Y = activations(X * W + B) in NCHWc, where X is N x Cb x H x W x block,
+// W is packed by ONNC_RUNTIME_internal_conv_weight_nchwc as
+// Mb x Cb x KH x KW x block x block, B holds Mb x block biases and Y is
+// N x Mb x OH x OW x block. pads are the resolved [top, left, bottom, right]
+// pads.
+void ONNC_RUNTIME_convnchwc_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const float * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+) {
+  ONNC_RUNTIME_Activation acts[number_of_activations + 1];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    activations, number_of_activations, 1, acts);
+
+  Convolution t;
+  t.x = input_X;
+  t.w = input_W;
+  t.b = (input_B != NULL && input_B_ndim > 0) ? input_B : NULL;
+  t.y = output_Y;
+  t.block = input_X_dims[4];
+  t.Cb = input_X_dims[1];
+  t.H = input_X_dims[2];
+  t.W = input_X_dims[3];
+  t.Mb = output_Y_dims[1];
+  t.OH = output_Y_dims[2];
+  t.OW = output_Y_dims[3];
+  t.KH = input_W_dims[2];
+  t.KW = input_W_dims[3];
+  t.SH = (number_of_strides > 0) ? strides[0] : 1;
+  t.SW = (number_of_strides > 1) ? strides[1] : 1;
+  t.DH = (number_of_dilations > 0) ? dilations[0] : 1;
+  t.DW = (number_of_dilations > 1) ? dilations[1] : 1;
+  t.PH = (number_of_pads > 0) ? pads[0] : 0;
+  t.PW = (number_of_pads > 1) ? pads[1] : 0;
+  t.acts = acts;
+  t.number_of_acts = number_of_activations;
+  t.rows = (int64_t)output_Y_dims[0] *
+           ((t.Mb + OUTPUT_BLOCKS - 1) / OUTPUT_BLOCKS) * t.OH;
+  if (t.rows == 0 || t.OW == 0) {
+    return;
+  }
+
+  int64_t work = (int64_t)output_Y_dims[0] * t.Mb * t.OH * t.OW * t.block *
+                 t.Cb * t.block * t.KH * t.KW;
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 || work < PARALLEL_THRESHOLD || t.rows == 1) {
+    conv_kernel()(&t, 0, t.rows);
+    return;
+  }
+  // A few tasks per thread even out the load of unequal threads.
+  int64_t number_of_tasks = min_i64(t.rows, (int64_t)num_threads * 4);
+  t.chunk = (t.rows + number_of_tasks - 1) / number_of_tasks;
+  number_of_tasks = (t.rows + t.chunk - 1) / t.chunk;
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context,
+                                     (int32_t)number_of_tasks, conv_task, &t);
+}
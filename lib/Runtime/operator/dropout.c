@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 void ONNC_RUNTIME_dropout_float(
   void * restrict onnc_runtime_context
@@ -13,4 +14,19 @@ void ONNC_RUNTIME_dropout_float(
   ,int32_t output_mask_ndim, const int32_t * restrict output_mask_dims
   ,float ratio
 ) {
+  // Inference: the output is the input, and nothing is dropped.
+  int32_t size = 1;
+  for (int32_t i = 0; i < input_data_ndim; ++i) {
+    size *= input_data_dims[i];
+  }
+  if (output_output != input_data) {
+    for (int32_t i = 0; i < size; ++i) {
+      output_output[i] = input_data[i];
+    }
+  }
+  if (output_mask != NULL) {
+    for (int32_t i = 0; i < size; ++i) {
+      output_mask[i] = 1.0f;
+    }
+  }
 }
@@ -1,8 +1,8 @@
 #include <onnc/Runtime/operator/exp.h>
+#include <onnc/Runtime/internal/elementwise.h>
 
 #include <stdint.h>
 #include <stdbool.h>
-#include <math.h>
 
 void ONNC_RUNTIME_exp_float(
   void * restrict onnc_runtime_context
@@ -12,12 +12,9 @@ void ONNC_RUNTIME_exp_float(
   ,int32_t output_output_ndim, const int32_t * restrict output_output_dims
   
 ) {
-  int32_t size = 1;
-  for(int32_t dim = 0 ; dim < input_input_ndim ; dim++){
-    size *= input_input_dims[dim];
-  }
-
-  for(int32_t index = 0 ; index < size ; index++){
-    output_output[index] = expf(input_input[index]);
+  int64_t size = 1;
+  for (int32_t i = 0; i < input_input_ndim; ++i) {
+    size *= input_input_dims[i];
   }
+  ONNC_RUNTIME_internal_elementwise()->exp(size, input_input, output_output);
 }
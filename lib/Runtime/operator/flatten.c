@@ -11,6 +11,11 @@ void ONNC_RUNTIME_flatten_float(
   ,int32_t output_output_ndim, const int32_t * restrict output_output_dims
   ,int32_t axis
 ) {
+  // The output shares the memory of the input.
+  if (output_output == input_input) {
+    return;
+  }
+
   int32_t size = 1;
   for(int32_t dim = 0 ; dim < input_input_ndim ; dim++){
     size *= input_input_dims[dim];
@@ -0,0 +1,94 @@
+#include <onnc/Runtime/operator/fusedconv.h>
+#include <onnc/Runtime/internal/activation.h>
+#include <onnc/Runtime/internal/conv.h>
+#include <onnc/Runtime/internal/half.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_fusedconv_mixed(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const void * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,const char * restrict auto_pad
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+  ,int32_t weight_type
+) {
+  ONNC_RUNTIME_Activation acts[number_of_activations + 1];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    activations, number_of_activations, 1, acts);
+
+  ONNC_RUNTIME_internal_conv_float(
+    onnc_runtime_context,
+    input_X, input_X_ndim, input_X_dims,
+    input_W, input_W_ndim, input_W_dims, weight_type,
+    input_B, input_B_ndim, input_B_dims,
+    output_Y, output_Y_ndim, output_Y_dims,
+    auto_pad, dilations, number_of_dilations, group,
+    kernel_shape, number_of_kernel_shape, pads, number_of_pads,
+    strides, number_of_strides, acts, number_of_activations);
+}
+
+void ONNC_RUNTIME_fusedconv_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const float * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,const char * restrict auto_pad
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+) {
+  ONNC_RUNTIME_fusedconv_mixed(
+    onnc_runtime_context,
+    input_X, input_X_ndim, input_X_dims,
+    input_W, input_W_ndim, input_W_dims,
+    input_B, input_B_ndim, input_B_dims,
+    output_Y, output_Y_ndim, output_Y_dims,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    activations, number_of_activations,
+    auto_pad, dilations, number_of_dilations, group,
+    kernel_shape, number_of_kernel_shape, pads, number_of_pads,
+    strides, number_of_strides, ONNC_RUNTIME_STORAGE_FLOAT);
+}
@@ -0,0 +1,47 @@
+#include <onnc/Runtime/operator/fusedelementwise.h>
+#include <onnc/Runtime/internal/activation.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Number of floats that every activation of the chain processes before the
+// next block is loaded. (4 KiB, stays in L1)
+#define FUSED_ELEMENTWISE_BLOCK_SIZE 1024
+
+void ONNC_RUNTIME_fusedelementwise_float(
+  void * restrict onnc_runtime_context
+  ,const float * input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,float * output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+) {
+  ONNC_RUNTIME_Activation acts[number_of_activations + 1];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    activations, number_of_activations, 1, acts);
+
+  int64_t size = 1;
+  for (int32_t i = 0; i < input_X_ndim; ++i) {
+    size *= input_X_dims[i];
+  }
+
+  // Y may be X when the operator is computed in place.
+  for (int64_t i = 0; i < size; i += FUSED_ELEMENTWISE_BLOCK_SIZE) {
+    int32_t n = (size - i < FUSED_ELEMENTWISE_BLOCK_SIZE)
+                  ? (int32_t)(size - i) : FUSED_ELEMENTWISE_BLOCK_SIZE;
+    if (output_Y != input_X) {
+      memcpy(output_Y + i, input_X + i, sizeof(float) * n);
+    }
+    ONNC_RUNTIME_internal_activate_all(acts, number_of_activations, n,
+                                       output_Y + i);
+  }
+}
@@ -0,0 +1,83 @@
+#include <onnc/Runtime/operator/fusedgemm.h>
+#include <onnc/Runtime/operator/gemm.h>
+#include <onnc/Runtime/internal/activation.h>
+#include <onnc/Runtime/internal/half.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void ONNC_RUNTIME_fusedgemm_mixed(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const void * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,float alpha
+  ,float beta
+  ,int32_t transA
+  ,int32_t transB
+  ,int32_t weight_type
+) {
+  ONNC_RUNTIME_Activation acts[number_of_activations + 1];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    activations, number_of_activations, 1, acts);
+
+  ONNC_RUNTIME_gemm_mixed(onnc_runtime_context,
+                          input_A, input_A_ndim, input_A_dims,
+                          input_B, input_B_ndim, input_B_dims,
+                          input_C, input_C_ndim, input_C_dims,
+                          output_Y, output_Y_ndim, output_Y_dims,
+                          alpha, beta, transA, transB, weight_type);
+
+  // Run all activations on one row at a time, so the row is read from
+  // memory once however many activations there are.
+  int32_t M = output_Y_dims[0];
+  int32_t N = output_Y_dims[1];
+  for (int32_t i = 0; i < M; ++i) {
+    ONNC_RUNTIME_internal_activate_all(acts, number_of_activations, N,
+                                       output_Y + (int64_t)i * N);
+  }
+}
+
+void ONNC_RUNTIME_fusedgemm_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,float alpha
+  ,float beta
+  ,int32_t transA
+  ,int32_t transB
+) {
+  ONNC_RUNTIME_fusedgemm_mixed(
+    onnc_runtime_context, input_A, input_A_ndim, input_A_dims, input_B,
+    input_B_ndim, input_B_dims, input_C, input_C_ndim, input_C_dims, output_Y,
+    output_Y_ndim, output_Y_dims, activation_alpha,
+    number_of_activation_alpha, activation_beta, number_of_activation_beta,
+    activations, number_of_activations, alpha, beta, transA, transB,
+    ONNC_RUNTIME_STORAGE_FLOAT);
+}
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 void ONNC_RUNTIME_gather_float(
   void * restrict onnc_runtime_context
@@ -13,4 +14,42 @@ void ONNC_RUNTIME_gather_float(
   ,int32_t output_output_ndim, const int32_t * restrict output_output_dims
   ,int32_t axis
 ) {
+  if (axis < 0) {
+    axis += input_data_ndim;
+  }
+
+  // The output is data with the axis replaced by the dimensions of indices:
+  // outer blocks of the leading axes, each of which takes one slice of
+  // inner elements per index.
+  int64_t outer = 1;
+  for (int32_t dim = 0; dim < axis; ++dim) {
+    outer *= input_data_dims[dim];
+  }
+  int64_t inner = 1;
+  for (int32_t dim = axis + 1; dim < input_data_ndim; ++dim) {
+    inner *= input_data_dims[dim];
+  }
+  int64_t num_of_indices = 1;
+  for (int32_t dim = 0; dim < input_indices_ndim; ++dim) {
+    num_of_indices *= input_indices_dims[dim];
+  }
+  const int64_t axis_dim = input_data_dims[axis];
+
+  for (int64_t o = 0; o < outer; ++o) {
+    const float *block = input_data + o * axis_dim * inner;
+    float *out = output_output + o * num_of_indices * inner;
+    for (int64_t i = 0; i < num_of_indices; ++i) {
+      // Indices are integers stored as floats; negative ones count from the
+      // end. Out of range indices gather zeros.
+      int64_t index = (int64_t)input_indices[i];
+      if (index < 0) {
+        index += axis_dim;
+      }
+      if (index < 0 || index >= axis_dim) {
+        memset(out + i * inner, 0, inner * sizeof(float));
+      } else {
+        memcpy(out + i * inner, block + index * inner, inner * sizeof(float));
+      }
+    }
+  }
 }
@@ -1,13 +1,16 @@
 #include <onnc/Runtime/operator/gemm.h>
+#include <onnc/Runtime/internal/half.h>
+#include <onnc/Runtime/internal/sgemm.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
-void ONNC_RUNTIME_gemm_float(
+void ONNC_RUNTIME_gemm_mixed(
   void * restrict onnc_runtime_context
   ,const float * restrict input_A
   ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
-  ,const float * restrict input_B
+  ,const void * restrict input_B
   ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
   ,const float * restrict input_C
   ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
@@ -17,20 +20,53 @@ void ONNC_RUNTIME_gemm_float(
   ,float beta
   ,int32_t transA
   ,int32_t transB
+  ,int32_t weight_type
 ) {
-  int num = transA ? input_A_dims[0] : input_A_dims[1];
-  for (int32_t i = 0 ; i < output_Y_dims[0] ; ++i) {
-    for (int32_t j = 0 ; j < output_Y_dims[1] ; ++j) {
-      output_Y[ i * output_Y_dims[1] + j ] = 0;
-      for (int32_t k = 0 ; k < num ; ++k) {
-        output_Y[ i * output_Y_dims[1] + j ] +=
-          input_A[ transA ? (k * input_A_dims[1] + i) :
-                            (i * input_A_dims[1] + k) ] *
-          input_B[ transB ? (j * input_B_dims[1] + k) :
-                            (k * input_B_dims[1] + j) ];
+  int32_t M = output_Y_dims[0];
+  int32_t N = output_Y_dims[1];
+  int32_t K = transA ? input_A_dims[0] : input_A_dims[1];
+
+  // Seed Y with beta * C, where C is unidirectionally broadcast to [M, N].
+  float gemm_beta = 0.f;
+  if (input_C != NULL && beta != 0.f) {
+    int32_t C_M = (input_C_ndim >= 2) ? input_C_dims[input_C_ndim - 2] : 1;
+    int32_t C_N = (input_C_ndim >= 1) ? input_C_dims[input_C_ndim - 1] : 1;
+    for (int32_t i = 0; i < M; ++i) {
+      const float * restrict c_row = input_C + (C_M == 1 ? 0 : (int64_t)i * C_N);
+      float * restrict y_row = output_Y + (int64_t)i * N;
+      for (int32_t j = 0; j < N; ++j) {
+        y_row[j] = beta * c_row[C_N == 1 ? 0 : j];
       }
-      output_Y[ i * output_Y_dims[1] + j ] *= alpha;
-      output_Y[ i * output_Y_dims[1] + j ] += beta * input_C[ + j ];
     }
+    gemm_beta = 1.f;
   }
+
+  ONNC_RUNTIME_internal_sgemm_mixed(onnc_runtime_context,
+                                    transA != 0, transB != 0, M, N, K, alpha,
+                                    input_A, ONNC_RUNTIME_STORAGE_FLOAT,
+                                    input_A_dims[1],
+                                    input_B, weight_type, input_B_dims[1],
+                                    gemm_beta, output_Y, N);
+}
+
+void ONNC_RUNTIME_gemm_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float alpha
+  ,float beta
+  ,int32_t transA
+  ,int32_t transB
+) {
+  ONNC_RUNTIME_gemm_mixed(
+    onnc_runtime_context, input_A, input_A_ndim, input_A_dims, input_B,
+    input_B_ndim, input_B_dims, input_C, input_C_ndim, input_C_dims, output_Y,
+    output_Y_ndim, output_Y_dims, alpha, beta, transA, transB,
+    ONNC_RUNTIME_STORAGE_FLOAT);
 }
@@ -1,4 +1,5 @@
 #include <onnc/Runtime/operator/globalaveragepool.h>
+#include <onnc/Runtime/internal/reduce.h>
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -11,46 +12,22 @@ void ONNC_RUNTIME_globalaveragepool_float(
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   
 ) {
-  int32_t nbatch = output_Y_dims[0];
-  int32_t nchannel = output_Y_dims[1];
-
-  int32_t elem = 1;
-  for(int32_t i = 0; i < input_X_ndim; i++){
-    elem *= input_X_dims[i];
-  }
-
-  int32_t dimStride[input_X_ndim];
-  dimStride[input_X_ndim-1] = 1;
-  for(int32_t i = (input_X_ndim - 1) - 1; i >= 0; i--){
-    dimStride[i] = dimStride[i+1] * input_X_dims[i+1];
-  }
-
-  int32_t avgSize = elem / (nbatch * nchannel);
-
-  float sum[nbatch][nchannel];
-  for(int32_t i = 0; i < nbatch; i++){
-    for(int32_t j = 0; j < nchannel; j++){
-      sum[i][j] = 0;
-    }
+  // Reduce all the spatial axes.
+  bool reduced[input_X_ndim];
+  for (int32_t i = 0; i < input_X_ndim; ++i) {
+    reduced[i] = (i >= 2);
   }
-
-  int32_t indexCounter;
-  int32_t dimCounter;
-  int32_t index[2];
-  for(int32_t i = 0; i < elem; i++){
-    indexCounter = i;
-    dimCounter = 0;
-    while(dimCounter < 2){
-      index[dimCounter] = indexCounter / dimStride[dimCounter];
-      indexCounter %= dimStride[dimCounter];
-      dimCounter++;
-    }
-    sum[index[0]][index[1]] += input_X[i];
+  ONNC_RUNTIME_internal_reduce(onnc_runtime_context,
+                               ONNC_RUNTIME_REDUCE_SUM,
+                               input_X_ndim, input_X_dims, reduced,
+                               input_X, output_Y);
+
+  int64_t count = 1;
+  for (int32_t i = 2; i < input_X_ndim; ++i) {
+    count *= input_X_dims[i];
   }
-
-  for(int32_t i = 0; i < nbatch; i++){
-    for(int32_t j = 0; j < nchannel; j++){
-      output_Y[i * nchannel + j] = sum[i][j] / (float)avgSize;
-    }
+  int64_t size = (int64_t)input_X_dims[0] * input_X_dims[1];
+  for (int64_t i = 0; i < size; ++i) {
+    output_Y[i] /= count;
   }
 }
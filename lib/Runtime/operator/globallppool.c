@@ -1,8 +1,9 @@
 #include <onnc/Runtime/operator/globallppool.h>
+#include <onnc/Runtime/internal/pool.h>
 
 #include <stdint.h>
 #include <stdbool.h>
-#include <math.h>
+#include <stddef.h>
 
 void ONNC_RUNTIME_globallppool_float(
   void * restrict onnc_runtime_context
@@ -12,19 +13,9 @@ void ONNC_RUNTIME_globallppool_float(
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   ,int32_t p
 ) {
-  int32_t mul = 1 ;
-	for(int32_t i = input_X_ndim - 1 ; i >= 2 ; --i){
-		mul *= input_X_dims[i] ;
-	}
-	for(int32_t i = 0 ; i < output_Y_dims[0] ; ++i){
-		for(int32_t j = 0 ; j < output_Y_dims[1] ; ++j){
-			output_Y[ i * output_Y_dims[1] + j ] = 0;
-			for(int32_t k = 0 ; k < mul ; ++k){
-				output_Y[ i * output_Y_dims[1] + j ] += powf(
-					fabs( input_X[ ( i * input_X_dims[1] + j ) * mul + k] ), p
-				);
-			}
-			output_Y[ i * output_Y_dims[1] + j ] = powf( output_Y[ i * output_Y_dims[1] + j ], 1.0 / p );
-		}
-	}
+  // One window covering all the spatial axes.
+  ONNC_RUNTIME_internal_pool(onnc_runtime_context, ONNC_RUNTIME_POOL_LP,
+                             p, input_X_ndim,
+                             input_X, input_X_dims, output_Y, output_Y_dims,
+                             input_X_dims + 2, NULL, NULL);
 }
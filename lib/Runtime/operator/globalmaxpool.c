@@ -1,8 +1,8 @@
 #include <onnc/Runtime/operator/globalmaxpool.h>
+#include <onnc/Runtime/internal/reduce.h>
 
 #include <stdint.h>
 #include <stdbool.h>
-#include <math.h>
 
 void ONNC_RUNTIME_globalmaxpool_float(
   void * restrict onnc_runtime_context
@@ -12,19 +12,13 @@ void ONNC_RUNTIME_globalmaxpool_float(
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   
 ) {
-	int32_t mul = 1 ;
-	for(int32_t i = input_X_ndim - 1 ; i >= 2 ; --i){
-		mul *= input_X_dims[i] ;
-	}
-	for(int32_t i = 0 ; i < output_Y_dims[0] ; ++i){
-		for(int32_t j = 0 ; j < output_Y_dims[1] ; ++j){
-			output_Y[ i * output_Y_dims[1] + j ] = input_X[ ( i * input_X_dims[1] + j ) * mul ] ;
-			for(int32_t k = 1 ; k < mul ; ++k){
-				output_Y[ i * output_Y_dims[1] + j ] = fmax(
-					output_Y[ i * output_Y_dims[1] + j ],
-					input_X[ ( i * input_X_dims[1] + j ) * mul + k]
-				);
-			}
-		}
-	}
+  // Reduce all the spatial axes.
+  bool reduced[input_X_ndim];
+  for (int32_t i = 0; i < input_X_ndim; ++i) {
+    reduced[i] = (i >= 2);
+  }
+  ONNC_RUNTIME_internal_reduce(onnc_runtime_context,
+                               ONNC_RUNTIME_REDUCE_MAX,
+                               input_X_ndim, input_X_dims, reduced,
+                               input_X, output_Y);
 }
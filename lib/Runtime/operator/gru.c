@@ -1,7 +1,53 @@
 #include <onnc/Runtime/operator/gru.h>
+#include <onnc/Runtime/internal/recurrent.h>
+#include <onnc/Runtime/internal/sgemm.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Update and reset gates of one batch entry. gates holds h_{t-1} * R^T of
+// the z and r gates on entry, in the ONNX gate order z, r, h.
+static void gru_gates(int32_t H, float * restrict gates,
+                      const float * restrict proj,
+                      const ONNC_RUNTIME_Activation * restrict act,
+                      float clip) {
+  for (int32_t j = 0; j < 2 * H; ++j) {
+    gates[j] += proj[j];
+  }
+  ONNC_RUNTIME_internal_clip(clip, 2 * H, gates);
+  ONNC_RUNTIME_internal_activate(&act[0], 2 * H, gates);
+}
+
+// Hidden gate and new hidden state of one batch entry. hidden holds either
+// (r (.) h_{t-1}) * Rh^T or, with linear_before_reset, h_{t-1} * Rh^T + Rbh.
+static void gru_cell(int32_t H, float * restrict gates,
+                     const float * restrict proj, float * restrict h,
+                     const ONNC_RUNTIME_Activation * restrict act,
+                     float clip, bool linear_before_reset) {
+  const float * restrict z = gates;
+  const float * restrict r = gates + H;
+  float * restrict hidden = gates + 2 * H;
+  const float * restrict proj_h = proj + 2 * H;
+
+  if (linear_before_reset) {
+    for (int32_t j = 0; j < H; ++j) {
+      hidden[j] = proj_h[j] + r[j] * hidden[j];
+    }
+  } else {
+    for (int32_t j = 0; j < H; ++j) {
+      hidden[j] += proj_h[j];
+    }
+  }
+  ONNC_RUNTIME_internal_clip(clip, H, hidden);
+  ONNC_RUNTIME_internal_activate(&act[1], H, hidden);
+
+  for (int32_t j = 0; j < H; ++j) {
+    h[j] = (1.f - z[j]) * hidden[j] + z[j] * h[j];
+  }
+}
 
 void ONNC_RUNTIME_gru_float(
   void * restrict onnc_runtime_context
@@ -32,4 +78,147 @@ void ONNC_RUNTIME_gru_float(
   ,int32_t hidden_size
   ,int32_t linear_before_reset
 ) {
+  const int32_t seq_length = input_X_dims[0];
+  const int32_t batch_size = input_X_dims[1];
+  const int32_t input_size = input_X_dims[2];
+  const int32_t H = (hidden_size > 0) ? hidden_size : input_R_dims[2];
+  const int32_t G = 3 * H;
+  const int32_t num_directions = ONNC_RUNTIME_internal_num_directions(direction);
+  // sequence_lens is an int32 tensor, handed over through a float pointer.
+  const int32_t *seq_lens = (const int32_t *)input_sequence_lens;
+
+  static const char * const defaults[2] = { "Sigmoid", "Tanh" };
+  ONNC_RUNTIME_Activation acts[2 * num_directions];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    defaults, 2, num_directions, acts);
+
+  float *proj = (float *)malloc(sizeof(float) * seq_length * batch_size * G);
+  float *gates = (float *)malloc(sizeof(float) * batch_size * G);
+  float *h = (float *)malloc(sizeof(float) * batch_size * H);
+  float *reset_h = (float *)malloc(sizeof(float) * batch_size * H);
+  float *bias = (float *)calloc(G, sizeof(float));
+  float *recurrent_bias_h = (float *)calloc(H, sizeof(float));
+  if (proj == NULL || gates == NULL || h == NULL || reset_h == NULL ||
+      bias == NULL || recurrent_bias_h == NULL) {
+    free(proj);
+    free(gates);
+    free(h);
+    free(reset_h);
+    free(bias);
+    free(recurrent_bias_h);
+    return;
+  }
+
+  for (int32_t d = 0; d < num_directions; ++d) {
+    const bool reverse = ONNC_RUNTIME_internal_is_reverse(direction, d);
+    const float *W = input_W + (int64_t)d * G * input_size;
+    const float *R = input_R + (int64_t)d * G * H;
+    const float *Rh = R + (int64_t)2 * H * H;
+    // Rbh is applied inside the reset gate with linear_before_reset, every
+    // other bias is folded into the projection.
+    if (input_B != NULL) {
+      const float *B = input_B + (int64_t)d * 2 * G;
+      for (int32_t j = 0; j < G; ++j) {
+        bias[j] = B[j] + ((linear_before_reset && j >= 2 * H) ? 0.f : B[G + j]);
+      }
+      memcpy(recurrent_bias_h, B + G + 2 * H, sizeof(float) * H);
+    }
+    ONNC_RUNTIME_internal_input_projection(onnc_runtime_context,
+      seq_length * batch_size, input_size, G, input_X, W,
+      (input_B != NULL) ? bias : NULL, proj);
+
+    const int64_t state_offset = (int64_t)d * batch_size * H;
+    if (input_initial_h != NULL) {
+      memcpy(h, input_initial_h + state_offset, sizeof(float) * batch_size * H);
+    } else {
+      memset(h, 0, sizeof(float) * batch_size * H);
+    }
+
+    for (int32_t step = 0; step < seq_length; ++step) {
+      if (linear_before_reset) {
+        // All three gates in one product; Rbh is added to the hidden part.
+        ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, true,
+                                    batch_size, G, H, 1.f, h, H, R, H,
+                                    0.f, gates, G);
+        for (int32_t b = 0; b < batch_size; ++b) {
+          float *hidden = gates + (int64_t)b * G + 2 * H;
+          for (int32_t j = 0; j < H; ++j) {
+            hidden[j] += recurrent_bias_h[j];
+          }
+        }
+      } else {
+        ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, true,
+                                    batch_size, 2 * H, H, 1.f, h, H, R, H,
+                                    0.f, gates, G);
+      }
+
+      for (int32_t b = 0; b < batch_size; ++b) {
+        int32_t seq_len = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                                seq_length);
+        int32_t t = ONNC_RUNTIME_internal_timestep(step, seq_len, reverse);
+        float *h_b = h + (int64_t)b * H;
+        float *reset_h_b = reset_h + (int64_t)b * H;
+        if (t < 0) {
+          memcpy(reset_h_b, h_b, sizeof(float) * H);
+          continue;
+        }
+        float *g = gates + (int64_t)b * G;
+        gru_gates(H, g, proj + ((int64_t)t * batch_size + b) * G, acts + 2 * d,
+                  clip);
+        if (!linear_before_reset) {
+          for (int32_t j = 0; j < H; ++j) {
+            reset_h_b[j] = g[H + j] * h_b[j];
+          }
+        }
+      }
+
+      if (!linear_before_reset) {
+        ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, true,
+                                    batch_size, H, H, 1.f, reset_h, H, Rh, H,
+                                    0.f, gates + 2 * H, G);
+      }
+
+      for (int32_t b = 0; b < batch_size; ++b) {
+        int32_t seq_len = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                                seq_length);
+        int32_t t = ONNC_RUNTIME_internal_timestep(step, seq_len, reverse);
+        if (t < 0) {
+          continue;
+        }
+        gru_cell(H, gates + (int64_t)b * G,
+                 proj + ((int64_t)t * batch_size + b) * G,
+                 h + (int64_t)b * H, acts + 2 * d, clip,
+                 linear_before_reset != 0);
+        if (output_Y != NULL) {
+          float *y = output_Y + (((int64_t)t * num_directions + d) * batch_size + b) * H;
+          memcpy(y, h + (int64_t)b * H, sizeof(float) * H);
+        }
+      }
+    }
+
+    // Steps past the end of a sequence produce zeros.
+    if (output_Y != NULL && seq_lens != NULL) {
+      for (int32_t b = 0; b < batch_size; ++b) {
+        for (int32_t t = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                               seq_length);
+             t < seq_length; ++t) {
+          float *y = output_Y + (((int64_t)t * num_directions + d) * batch_size + b) * H;
+          memset(y, 0, sizeof(float) * H);
+        }
+      }
+    }
+    if (output_Y_h != NULL) {
+      memcpy(output_Y_h + state_offset, h, sizeof(float) * batch_size * H);
+    }
+  }
+
+  free(proj);
+  free(gates);
+  free(h);
+  free(reset_h);
+  free(bias);
+  free(recurrent_bias_h);
 }
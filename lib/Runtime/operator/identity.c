@@ -11,6 +11,11 @@ void ONNC_RUNTIME_identity_float(
   ,int32_t output_output_ndim, const int32_t * restrict output_output_dims
   
 ) {
+	// The output shares the memory of the input.
+	if (output_output == input_input) {
+	  return;
+	}
+
 	int32_t size = 1;
 	for(int32_t i = 0 ; i < input_input_ndim ; ++i){
 		size *= input_input_dims[i];
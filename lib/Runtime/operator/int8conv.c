@@ -0,0 +1,123 @@
+#include <onnc/Runtime/operator/int8conv.h>
+#include <onnc/Runtime/internal/qgemm.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Upper bound (in bytes) of the im2col scratch buffer. The output pixels are
+// processed in tiles so that the buffer size doesn't grow with the feature
+// map. (4 MiB)
+#define CONV_COL_BUFFER_SIZE (1 << 22)
+
+// Lower output pixels [q0, q0 + cols) of one group of a 2-D convolution to
+// one row per pixel: col[q][(c * kH + kh) * kW + kw] is the input under
+// kernel position (kh, kw) of channel c, or 0 in the padding. A row is the
+// K contiguous activations that ONNC_RUNTIME_internal_qgemm multiplies with
+// a row of weights.
+static void im2row(const int8_t * restrict X, int32_t C,
+                   int32_t iH, int32_t iW, int32_t kH, int32_t kW,
+                   int32_t sH, int32_t sW, int32_t pH, int32_t pW,
+                   int32_t dH, int32_t dW, int32_t oW,
+                   int64_t q0, int32_t cols, int8_t * restrict col) {
+  for (int32_t q = 0; q < cols; ++q) {
+    int32_t oh = (int32_t)((q0 + q) / oW);
+    int32_t ow = (int32_t)((q0 + q) % oW);
+    int8_t * restrict row = col;
+    for (int32_t c = 0; c < C; ++c) {
+      const int8_t * restrict x = X + (int64_t)c * iH * iW;
+      for (int32_t kh = 0; kh < kH; ++kh) {
+        int32_t ih = oh * sH - pH + kh * dH;
+        if (ih < 0 || ih >= iH) {
+          memset(row, 0, kW);
+          row += kW;
+          continue;
+        }
+        const int8_t * restrict x_row = x + (int64_t)ih * iW;
+        for (int32_t kw = 0; kw < kW; ++kw) {
+          int32_t iw = ow * sW - pW + kw * dW;
+          *row++ = (iw < 0 || iw >= iW) ? 0 : x_row[iw];
+        }
+      }
+    }
+    col = row;
+  }
+}
+
+// A 2-D convolution of int8 tensors with one GEMM per (batch, group) and
+// tile of output pixels:
+//   Y_g^T[oHW x M/group] = col(X_g)[oHW x K] * W_g[M/group x K]^T
+// Y_g^T is written transposed, so Y stays NCHW.
+void ONNC_RUNTIME_int8conv_float(
+  void * restrict onnc_runtime_context
+  ,const int8_t * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const int8_t * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,int8_t * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,int32_t * restrict dilations
+  ,int32_t number_of_dilations
+  ,int32_t group
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,float output_scale
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t relu
+  ,float * restrict scales
+  ,int32_t number_of_scales
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+) {
+  int32_t N = input_X_dims[0], C = input_X_dims[1];
+  int32_t iH = input_X_dims[2], iW = input_X_dims[3];
+  int32_t M = input_W_dims[0], kC = input_W_dims[1];
+  int32_t kH = input_W_dims[2], kW = input_W_dims[3];
+  int32_t oH = output_Y_dims[2], oW = output_Y_dims[3];
+  int32_t dH = (number_of_dilations > 0) ? dilations[0] : 1;
+  int32_t dW = (number_of_dilations > 1) ? dilations[1] : 1;
+  int32_t sH = (number_of_strides > 0) ? strides[0] : 1;
+  int32_t sW = (number_of_strides > 1) ? strides[1] : 1;
+  int32_t pH = (number_of_pads > 0) ? pads[0] : 0;
+  int32_t pW = (number_of_pads > 1) ? pads[1] : 0;
+  if (group < 1) {
+    group = 1;
+  }
+
+  int32_t Mg = M / group;
+  int32_t K = kC * kH * kW;
+  int64_t in_size = (int64_t)iH * iW;
+  int64_t out_size = (int64_t)oH * oW;
+
+  int64_t tile = CONV_COL_BUFFER_SIZE / K;
+  if (tile < ONNC_RUNTIME_QGEMM_MC) tile = ONNC_RUNTIME_QGEMM_MC;
+  if (tile > out_size) tile = out_size;
+  int8_t *col = (int8_t *)malloc((size_t)K * tile);
+
+  for (int32_t n = 0; n < N; ++n) {
+    for (int32_t g = 0; g < group; ++g) {
+      const int8_t * restrict x_g = input_X + ((int64_t)n * C + (int64_t)g * kC) * in_size;
+      const int8_t * restrict w_g = input_W + (int64_t)g * Mg * K;
+      int8_t * restrict y_g = output_Y + ((int64_t)n * M + (int64_t)g * Mg) * out_size;
+      ONNC_RUNTIME_Requantize requantize = {
+        scales + g * Mg, (input_B != NULL) ? input_B + g * Mg : NULL,
+        output_scale, relu != 0
+      };
+
+      for (int64_t q0 = 0; q0 < out_size; q0 += tile) {
+        int32_t cols = (int32_t)((out_size - q0 < tile) ? out_size - q0 : tile);
+        im2row(x_g, kC, iH, iW, kH, kW, sH, sW, pH, pW, dH, dW, oW,
+               q0, cols, col);
+        ONNC_RUNTIME_internal_qgemm(onnc_runtime_context, cols, Mg, K,
+                                    col, K, w_g, K, &requantize,
+                                    y_g + q0, 1, out_size);
+      }
+    }
+  }
+
+  free(col);
+}
@@ -0,0 +1,35 @@
+#include <onnc/Runtime/operator/int8gemm.h>
+#include <onnc/Runtime/internal/qgemm.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Y[rows x N] = A[rows x K] * B[N x K]^T, where the leading axes of A and Y
+// are the rows.
+void ONNC_RUNTIME_int8gemm_float(
+  void * restrict onnc_runtime_context
+  ,const int8_t * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const int8_t * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,const float * restrict input_C
+  ,int32_t input_C_ndim, const int32_t * restrict input_C_dims
+  ,int8_t * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float output_scale
+  ,int32_t relu
+  ,float * restrict scales
+  ,int32_t number_of_scales
+) {
+  int32_t N = input_B_dims[0], K = input_B_dims[1];
+  int32_t rows = 1;
+  for (int32_t i = 0; i + 1 < input_A_ndim; ++i) {
+    rows *= input_A_dims[i];
+  }
+
+  ONNC_RUNTIME_Requantize requantize = { scales, input_C, output_scale,
+                                         relu != 0 };
+  ONNC_RUNTIME_internal_qgemm(onnc_runtime_context, rows, N, K,
+                              input_A, K, input_B, K, &requantize,
+                              output_Y, N, 1);
+}
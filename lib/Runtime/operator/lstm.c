@@ -1,7 +1,69 @@
 #include <onnc/Runtime/operator/lstm.h>
+#include <onnc/Runtime/internal/recurrent.h>
+#include <onnc/Runtime/internal/sgemm.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// One LSTM step of one batch entry. gates holds h_{t-1} * R^T on entry, in
+// the ONNX gate order i, o, f, c.
+static void lstm_cell(int32_t H, float * restrict gates,
+                      const float * restrict proj,
+                      float * restrict h, float * restrict c,
+                      const float * restrict P,
+                      const ONNC_RUNTIME_Activation * restrict act,
+                      float clip, bool input_forget) {
+  float * restrict gi = gates;
+  float * restrict go = gates + H;
+  float * restrict gf = gates + 2 * H;
+  float * restrict gc = gates + 3 * H;
+
+  for (int32_t j = 0; j < 4 * H; ++j) {
+    gates[j] += proj[j];
+  }
+  if (P != NULL) {
+    const float * restrict Pi = P;
+    const float * restrict Pf = P + 2 * H;
+    for (int32_t j = 0; j < H; ++j) {
+      gi[j] += Pi[j] * c[j];
+      gf[j] += Pf[j] * c[j];
+    }
+  }
+  ONNC_RUNTIME_internal_clip(clip, H, gi);
+  ONNC_RUNTIME_internal_activate(&act[0], H, gi);
+  if (input_forget) {
+    for (int32_t j = 0; j < H; ++j) {
+      gf[j] = 1.f - gi[j];
+    }
+  } else {
+    ONNC_RUNTIME_internal_clip(clip, H, gf);
+    ONNC_RUNTIME_internal_activate(&act[0], H, gf);
+  }
+  ONNC_RUNTIME_internal_clip(clip, H, gc);
+  ONNC_RUNTIME_internal_activate(&act[1], H, gc);
+
+  for (int32_t j = 0; j < H; ++j) {
+    c[j] = gf[j] * c[j] + gi[j] * gc[j];
+  }
+
+  if (P != NULL) {
+    const float * restrict Po = P + H;
+    for (int32_t j = 0; j < H; ++j) {
+      go[j] += Po[j] * c[j];
+    }
+  }
+  ONNC_RUNTIME_internal_clip(clip, H, go);
+  ONNC_RUNTIME_internal_activate(&act[0], H, go);
+
+  memcpy(h, c, sizeof(float) * H);
+  ONNC_RUNTIME_internal_activate(&act[2], H, h);
+  for (int32_t j = 0; j < H; ++j) {
+    h[j] *= go[j];
+  }
+}
 
 void ONNC_RUNTIME_lstm_float(
   void * restrict onnc_runtime_context
@@ -38,4 +100,110 @@ void ONNC_RUNTIME_lstm_float(
   ,int32_t hidden_size
   ,int32_t input_forget
 ) {
+  const int32_t seq_length = input_X_dims[0];
+  const int32_t batch_size = input_X_dims[1];
+  const int32_t input_size = input_X_dims[2];
+  const int32_t H = (hidden_size > 0) ? hidden_size : input_R_dims[2];
+  const int32_t G = 4 * H;
+  const int32_t num_directions = ONNC_RUNTIME_internal_num_directions(direction);
+  // sequence_lens is an int32 tensor, handed over through a float pointer.
+  const int32_t *seq_lens = (const int32_t *)input_sequence_lens;
+
+  static const char * const defaults[3] = { "Sigmoid", "Tanh", "Tanh" };
+  ONNC_RUNTIME_Activation acts[3 * num_directions];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    defaults, 3, num_directions, acts);
+
+  float *proj = (float *)malloc(sizeof(float) * seq_length * batch_size * G);
+  float *gates = (float *)malloc(sizeof(float) * batch_size * G);
+  float *h = (float *)malloc(sizeof(float) * batch_size * H);
+  float *c = (float *)malloc(sizeof(float) * batch_size * H);
+  float *bias = (float *)malloc(sizeof(float) * G);
+  if (proj == NULL || gates == NULL || h == NULL || c == NULL ||
+      bias == NULL) {
+    free(proj);
+    free(gates);
+    free(h);
+    free(c);
+    free(bias);
+    return;
+  }
+
+  for (int32_t d = 0; d < num_directions; ++d) {
+    const bool reverse = ONNC_RUNTIME_internal_is_reverse(direction, d);
+    const float *W = input_W + (int64_t)d * G * input_size;
+    const float *R = input_R + (int64_t)d * G * H;
+    const float *P = (input_P != NULL) ? input_P + (int64_t)d * 3 * H : NULL;
+    // Wb and Rb always appear summed, so fold both into the projection.
+    if (input_B != NULL) {
+      const float *B = input_B + (int64_t)d * 2 * G;
+      for (int32_t j = 0; j < G; ++j) {
+        bias[j] = B[j] + B[G + j];
+      }
+    }
+    ONNC_RUNTIME_internal_input_projection(onnc_runtime_context,
+      seq_length * batch_size, input_size, G, input_X, W,
+      (input_B != NULL) ? bias : NULL, proj);
+
+    const int64_t state_offset = (int64_t)d * batch_size * H;
+    if (input_initial_h != NULL) {
+      memcpy(h, input_initial_h + state_offset, sizeof(float) * batch_size * H);
+    } else {
+      memset(h, 0, sizeof(float) * batch_size * H);
+    }
+    if (input_initial_c != NULL) {
+      memcpy(c, input_initial_c + state_offset, sizeof(float) * batch_size * H);
+    } else {
+      memset(c, 0, sizeof(float) * batch_size * H);
+    }
+
+    for (int32_t step = 0; step < seq_length; ++step) {
+      ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, true,
+                                  batch_size, G, H, 1.f, h, H, R, H,
+                                  0.f, gates, G);
+      for (int32_t b = 0; b < batch_size; ++b) {
+        int32_t seq_len = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                                seq_length);
+        int32_t t = ONNC_RUNTIME_internal_timestep(step, seq_len, reverse);
+        if (t < 0) {
+          continue;
+        }
+        lstm_cell(H, gates + (int64_t)b * G,
+                  proj + ((int64_t)t * batch_size + b) * G,
+                  h + (int64_t)b * H, c + (int64_t)b * H,
+                  P, acts + 3 * d, clip, input_forget != 0);
+        if (output_Y != NULL) {
+          float *y = output_Y + (((int64_t)t * num_directions + d) * batch_size + b) * H;
+          memcpy(y, h + (int64_t)b * H, sizeof(float) * H);
+        }
+      }
+    }
+
+    // Steps past the end of a sequence produce zeros.
+    if (output_Y != NULL && seq_lens != NULL) {
+      for (int32_t b = 0; b < batch_size; ++b) {
+        for (int32_t t = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                               seq_length);
+             t < seq_length; ++t) {
+          float *y = output_Y + (((int64_t)t * num_directions + d) * batch_size + b) * H;
+          memset(y, 0, sizeof(float) * H);
+        }
+      }
+    }
+    if (output_Y_h != NULL) {
+      memcpy(output_Y_h + state_offset, h, sizeof(float) * batch_size * H);
+    }
+    if (output_Y_c != NULL) {
+      memcpy(output_Y_c + state_offset, c, sizeof(float) * batch_size * H);
+    }
+  }
+
+  free(proj);
+  free(gates);
+  free(h);
+  free(c);
+  free(bias);
 }
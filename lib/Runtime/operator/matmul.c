@@ -1,58 +1,120 @@
 #include <onnc/Runtime/operator/matmul.h>
+#include <onnc/Runtime/internal/half.h>
+#include <onnc/Runtime/internal/sgemm.h>
+#include <onnc/Runtime/internal/parallel.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
-static int32_t con(
-	int32_t * meofarr, int32_t ndim, const int32_t * restrict dims
-){
-	int32_t mul = 1, res = 0 ;
-	for(int32_t i = ndim - 1 ; i >= 0 ; --i){
-		res += meofarr[i] * mul ;
-		mul *= dims[i] ;
-	}
-	return res ;
+typedef struct BatchedMatMul {
+  const float *A;
+  const void *B;
+  int32_t storage_B;                  // ONNC_RUNTIME_Storage of B
+  float *C;
+  int32_t M, N, K;
+  int32_t ndim;                       // number of broadcast batch dimensions
+  int32_t A_ndim, B_ndim;             // number of batch dimensions of A and B
+  const int32_t *A_dims, *B_dims;     // batch dimensions of A and B
+} BatchedMatMul;
+
+// The batch shape is walked for every product instead of being copied into
+// fixed arrays, so there is no limit on the number of batch dimensions.
+static void matmul_batch(const BatchedMatMul *mm, void *onnc_runtime_context,
+                         int64_t batch) {
+  const float *A = mm->A;
+  int64_t offset_B = 0;
+  int64_t rest = batch;
+  int64_t stride_A = (int64_t)mm->M * mm->K, stride_B = (int64_t)mm->K * mm->N;
+  for (int32_t i = mm->ndim - 1; i >= 0; --i) {
+    int32_t a = i - (mm->ndim - mm->A_ndim);
+    int32_t b = i - (mm->ndim - mm->B_ndim);
+    int32_t A_dim = (a >= 0) ? mm->A_dims[a] : 1;
+    int32_t B_dim = (b >= 0) ? mm->B_dims[b] : 1;
+    int32_t dim = (A_dim > B_dim) ? A_dim : B_dim;
+    int64_t index = rest % dim;
+    rest /= dim;
+    // Broadcast axes of size 1 do not move.
+    if (A_dim != 1) {
+      A += index * stride_A;
+    }
+    if (B_dim != 1) {
+      offset_B += index * stride_B;
+    }
+    stride_A *= A_dim;
+    stride_B *= B_dim;
+  }
+  const void *B = ONNC_RUNTIME_internal_storage_at(mm->storage_B, mm->B,
+                                                   offset_B);
+  ONNC_RUNTIME_internal_sgemm_mixed(onnc_runtime_context, false, false,
+                                    mm->M, mm->N, mm->K, 1.f,
+                                    A, ONNC_RUNTIME_STORAGE_FLOAT, mm->K,
+                                    B, mm->storage_B, mm->N,
+                                    0.f, mm->C + batch * mm->M * mm->N, mm->N);
+}
+
+static void matmul_batch_task(void *arg, int32_t task) {
+  matmul_batch((const BatchedMatMul *)arg, NULL, task);
 }
-static void Enu(
-	const float * restrict A,
-	const int32_t * restrict A_dims,
-	const float * restrict B,
-	const int32_t * restrict B_dims,
-	float * restrict C,
-	int32_t C_ndim, const int32_t * restrict C_dims,
-	int32_t * meofarr, int32_t idx,
-	int32_t num
-){
-	if( idx == C_ndim ){
-		int32_t ou_idx = con( meofarr, C_ndim, C_dims );
-		C[ ou_idx ] = 0 ;
-		int32_t _1 = meofarr[ C_ndim-1 ] ;
-		int32_t _2 = meofarr[ C_ndim-2 ] ;
-		for(int32_t i = 0 ; i < num ; ++i){
-			meofarr[ C_ndim-1 ] =  i;
-			int32_t A_idx = con( meofarr, C_ndim, A_dims );
-			meofarr[ C_ndim-1 ] = _1;
-			meofarr[ C_ndim-2 ] =  i;
-			int32_t B_idx = con( meofarr, C_ndim, B_dims );
-			C[ ou_idx ] += A[ A_idx ] * B[ B_idx ];
-			meofarr[ C_ndim-1 ] = _1;
-			meofarr[ C_ndim-2 ] = _2;
-		}
-	} else {
-		for(int32_t i = 0 ; i < C_dims[idx] ; ++i){
-			meofarr[ idx ] = i ;
-			Enu(
-				A,
-				A_dims,
-				B,
-				B_dims,
-				C,
-				C_ndim, C_dims,
-				meofarr, idx+1,
-				num
-			);
-		}
-	}
+
+void ONNC_RUNTIME_matmul_mixed(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_A
+  ,int32_t input_A_ndim, const int32_t * restrict input_A_dims
+  ,const void * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,int32_t weight_type
+) {
+  // 1-D operands are promoted to [1, K] and [K, 1] as in numpy.matmul.
+  BatchedMatMul mm;
+  mm.A = input_A;
+  mm.B = input_B;
+  mm.storage_B = weight_type;
+  mm.C = output_Y;
+  mm.M = (input_A_ndim >= 2) ? input_A_dims[input_A_ndim - 2] : 1;
+  mm.K = input_A_dims[input_A_ndim - 1];
+  mm.N = (input_B_ndim >= 2) ? input_B_dims[input_B_ndim - 1] : 1;
+
+  // Broadcast the batch dimensions, right aligned.
+  mm.A_ndim = (input_A_ndim > 2) ? input_A_ndim - 2 : 0;
+  mm.B_ndim = (input_B_ndim > 2) ? input_B_ndim - 2 : 0;
+  mm.A_dims = input_A_dims;
+  mm.B_dims = input_B_dims;
+  mm.ndim = (mm.A_ndim > mm.B_ndim) ? mm.A_ndim : mm.B_ndim;
+  int64_t batches = 1, A_batches = 1, B_batches = 1;
+  for (int32_t i = mm.ndim - 1; i >= 0; --i) {
+    int32_t a = i - (mm.ndim - mm.A_ndim);
+    int32_t b = i - (mm.ndim - mm.B_ndim);
+    int32_t A_dim = (a >= 0) ? input_A_dims[a] : 1;
+    int32_t B_dim = (b >= 0) ? input_B_dims[b] : 1;
+    batches *= (A_dim > B_dim) ? A_dim : B_dim;
+    A_batches *= A_dim;
+    B_batches *= B_dim;
+  }
+
+  // A shared right-hand side (e.g. a fully-connected weight) turns the whole
+  // batch into one tall GEMM.
+  if (B_batches == 1 && A_batches == batches) {
+    ONNC_RUNTIME_internal_sgemm_mixed(onnc_runtime_context, false, false,
+                                      (int32_t)(batches * mm.M), mm.N, mm.K,
+                                      1.f, input_A, ONNC_RUNTIME_STORAGE_FLOAT,
+                                      mm.K, input_B, weight_type, mm.N,
+                                      0.f, output_Y, mm.N);
+    return;
+  }
+
+  // Many small products (e.g. attention heads) are spread over the threads
+  // one product at a time, otherwise each product uses all the threads.
+  if (batches >= ONNC_RUNTIME_internal_num_threads(onnc_runtime_context)) {
+    ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, (int32_t)batches,
+                                       matmul_batch_task, &mm);
+    return;
+  }
+  for (int64_t batch = 0; batch < batches; ++batch) {
+    matmul_batch(&mm, onnc_runtime_context, batch);
+  }
 }
 
 void ONNC_RUNTIME_matmul_float(
@@ -65,15 +127,8 @@ void ONNC_RUNTIME_matmul_float(
   ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   
 ) {
-	int32_t meofarr[output_Y_ndim];
-	Enu(
-		input_A,
-		input_A_dims,
-		input_B,
-		input_B_dims,
-		output_Y,
-		output_Y_ndim, output_Y_dims,
-		meofarr, 0,
-		input_A_dims[ input_A_ndim - 1 ]
-	);
+  ONNC_RUNTIME_matmul_mixed(
+    onnc_runtime_context, input_A, input_A_ndim, input_A_dims, input_B,
+    input_B_ndim, input_B_dims, output_Y, output_Y_ndim, output_Y_dims,
+    ONNC_RUNTIME_STORAGE_FLOAT);
 }
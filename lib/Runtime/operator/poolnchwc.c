@@ -0,0 +1,165 @@
+#include <onnc/Runtime/operator/poolnchwc.h>
+#include <onnc/Runtime/internal/parallel.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <float.h>
+
+// Poolings reading fewer elements than this are not worth a thread.
+#define PARALLEL_THRESHOLD (1 << 16)
+
+// The window loop is compiled once per block and pooling kind, so that the
+// loops over the channels of a block have a constant trip count and
+// vectorize.
+#if defined(__GNUC__)
+#define POOL_INLINE static inline __attribute__((always_inline))
+#else
+#define POOL_INLINE static inline
+#endif
+
+static inline int32_t min_i32(int32_t a, int32_t b) {
+  return a < b ? a : b;
+}
+
+static inline int32_t max_i32(int32_t a, int32_t b) {
+  return a > b ? a : b;
+}
+
+static inline int64_t min_i64(int64_t a, int64_t b) {
+  return a < b ? a : b;
+}
+
+typedef struct Pooling {
+  bool max;
+  bool count_include_pad;
+  int32_t block;
+  int32_t H, W, OH, OW;
+  int32_t KH, KW, SH, SW, PH, PW;
+  const float *x;
+  float *y;
+  int64_t rows;     // rows of y, N * Cb * OH
+  int64_t chunk;    // rows per task
+} Pooling;
+
+// One row of y. Every pixel reduces the elements of its window inside x, a
+// whole channel block at a time.
+POOL_INLINE void pool_row(int32_t B, bool max, const Pooling *t, int64_t row) {
+  int32_t oh = (int32_t)(row % t->OH);
+  const float *x = t->x + (row / t->OH) * t->H * t->W * B;
+  float *y = t->y + row * t->OW * B;
+
+  int32_t h0 = oh * t->SH - t->PH;
+  int32_t h1 = min_i32(h0 + t->KH, t->H);
+  int32_t window_rows = h1 - max_i32(h0, 0);
+  h0 = max_i32(h0, 0);
+  for (int32_t ow = 0; ow < t->OW; ++ow) {
+    int32_t w0 = ow * t->SW - t->PW;
+    int32_t w1 = min_i32(w0 + t->KW, t->W);
+    int32_t columns = w1 - max_i32(w0, 0);
+    w0 = max_i32(w0, 0);
+
+    float acc[16];
+    for (int32_t c = 0; c < B; ++c) {
+      acc[c] = max ? -FLT_MAX : 0.f;
+    }
+    for (int32_t ih = h0; ih < h1; ++ih) {
+      const float *xr = x + ((int64_t)ih * t->W + w0) * B;
+      for (int32_t iw = 0; iw < columns; ++iw) {
+        for (int32_t c = 0; c < B; ++c) {
+          float v = xr[iw * B + c];
+          acc[c] = max ? (v > acc[c] ? v : acc[c]) : acc[c] + v;
+        }
+      }
+    }
+
+    float *yp = y + (int64_t)ow * B;
+    if (max) {
+      memcpy(yp, acc, B * sizeof(float));
+    } else {
+      int32_t count = t->count_include_pad ? t->KH * t->KW
+                                           : window_rows * columns;
+      float scale = (count > 0) ? 1.f / count : 0.f;
+      for (int32_t c = 0; c < B; ++c) {
+        yp[c] = acc[c] * scale;
+      }
+    }
+  }
+}
+
+static void pool_task(void *arg, int32_t task) {
+  const Pooling *t = (const Pooling *)arg;
+  int64_t begin = task * t->chunk;
+  int64_t end = min_i64(begin + t->chunk, t->rows);
+  for (int64_t row = begin; row < end; ++row) {
+    if (t->block == 16) {
+      if (t->max) {
+        pool_row(16, true, t, row);
+      } else {
+        pool_row(16, false, t, row);
+      }
+    } else {
+      if (t->max) {
+        pool_row(8, true, t, row);
+      } else {
+        pool_row(8, false, t, row);
+      }
+    }
+  }
+}
+
+// MaxPool or AveragePool (mode "MAX" or "AVERAGE") of the 2-D NCHWc tensor
+// X, a N x Cb x H x W x block tensor. pads are the resolved
+// [top, left, bottom, right] pads; padded elements never take part.
+void ONNC_RUNTIME_poolnchwc_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,int32_t count_include_pad
+  ,int32_t * restrict kernel_shape
+  ,int32_t number_of_kernel_shape
+  ,const char * restrict mode
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t * restrict strides
+  ,int32_t number_of_strides
+) {
+  Pooling t;
+  t.max = (strcmp(mode, "MAX") == 0);
+  t.count_include_pad = (count_include_pad != 0);
+  t.block = input_X_dims[4];
+  t.H = input_X_dims[2];
+  t.W = input_X_dims[3];
+  t.OH = output_Y_dims[2];
+  t.OW = output_Y_dims[3];
+  t.KH = kernel_shape[0];
+  t.KW = kernel_shape[1];
+  t.SH = (number_of_strides > 0) ? strides[0] : 1;
+  t.SW = (number_of_strides > 1) ? strides[1] : 1;
+  t.PH = (number_of_pads > 0) ? pads[0] : 0;
+  t.PW = (number_of_pads > 1) ? pads[1] : 0;
+  t.x = input_X;
+  t.y = output_Y;
+  t.rows = (int64_t)output_Y_dims[0] * output_Y_dims[1] * t.OH;
+  if (t.rows == 0) {
+    return;
+  }
+
+  // A few tasks per thread even out the load of unequal threads.
+  int64_t work = t.rows * t.OW * t.block * t.KH * t.KW;
+  int32_t num_threads = ONNC_RUNTIME_internal_num_threads(onnc_runtime_context);
+  if (num_threads <= 1 || work < PARALLEL_THRESHOLD || t.rows == 1) {
+    t.chunk = t.rows;
+    pool_task(&t, 0);
+    return;
+  }
+  int64_t number_of_tasks = min_i64(t.rows, (int64_t)num_threads * 4);
+  t.chunk = (t.rows + number_of_tasks - 1) / number_of_tasks;
+  number_of_tasks = (t.rows + t.chunk - 1) / t.chunk;
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context,
+                                     (int32_t)number_of_tasks,
+                                     pool_task, &t);
+}
@@ -0,0 +1,43 @@
+#include <onnc/Runtime/operator/quantize.h>
+#include <onnc/Runtime/internal/parallel.h>
+#include <onnc/Runtime/internal/qgemm.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Elements converted by one task.
+#define CHUNK (1 << 16)
+
+typedef struct Quantize {
+  const float *x;
+  int8_t *y;
+  int64_t size;
+  float inverse_scale;
+} Quantize;
+
+static void quantize_task(void *arg, int32_t task) {
+  const Quantize *t = (const Quantize *)arg;
+  int64_t begin = (int64_t)task * CHUNK;
+  int64_t end = (t->size - begin < CHUNK) ? t->size : begin + CHUNK;
+  for (int64_t i = begin; i < end; ++i) {
+    t->y[i] = ONNC_RUNTIME_internal_saturate_s8(t->x[i] * t->inverse_scale);
+  }
+}
+
+void ONNC_RUNTIME_quantize_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,int8_t * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float scale
+) {
+  int64_t size = 1;
+  for (int32_t i = 0; i < input_X_ndim; ++i) {
+    size *= input_X_dims[i];
+  }
+  Quantize t = { input_X, output_Y, size, 1.f / scale };
+  int32_t number_of_tasks = (int32_t)((size + CHUNK - 1) / CHUNK);
+  ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, number_of_tasks,
+                                     quantize_task, &t);
+}
@@ -0,0 +1,35 @@
+#include <onnc/Runtime/operator/reorder.h>
+#include <onnc/Runtime/internal/layout.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Y = X between NCHW and NCHWc. The blocked side has one more axis, the
+// channels of a block, so the dimensions tell the direction.
+void ONNC_RUNTIME_reorder_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+) {
+  bool to_blocked = (output_Y_ndim == input_X_ndim + 1);
+  const int32_t *plain_dims = to_blocked ? input_X_dims : output_Y_dims;
+  const int32_t *blocked_dims = to_blocked ? output_Y_dims : input_X_dims;
+  int32_t plain_ndim = to_blocked ? input_X_ndim : output_Y_ndim;
+  int32_t block = blocked_dims[plain_ndim];
+
+  int64_t spatial = 1;
+  for (int32_t i = 2; i < plain_ndim; ++i) {
+    spatial *= plain_dims[i];
+  }
+  if (to_blocked) {
+    ONNC_RUNTIME_internal_to_blocked(onnc_runtime_context,
+                                     plain_dims[0], plain_dims[1], spatial,
+                                     block, input_X, output_Y);
+  } else {
+    ONNC_RUNTIME_internal_from_blocked(onnc_runtime_context,
+                                       plain_dims[0], plain_dims[1], spatial,
+                                       block, input_X, output_Y);
+  }
+}
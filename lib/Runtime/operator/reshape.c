@@ -13,6 +13,11 @@ void ONNC_RUNTIME_reshape_float(
   ,int32_t output_reshaped_ndim, const int32_t * restrict output_reshaped_dims
   
 ) {
+    // The output shares the memory of the input.
+    if (output_reshaped == input_data) {
+      return;
+    }
+
     int32_t size = 1;
     for(int32_t dim = 0 ; dim < input_data_ndim ; dim++){
         size *= input_data_dims[dim];
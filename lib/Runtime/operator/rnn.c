@@ -1,7 +1,12 @@
 #include <onnc/Runtime/operator/rnn.h>
+#include <onnc/Runtime/internal/recurrent.h>
+#include <onnc/Runtime/internal/sgemm.h>
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 void ONNC_RUNTIME_rnn_float(
   void * restrict onnc_runtime_context
@@ -31,4 +36,99 @@ void ONNC_RUNTIME_rnn_float(
   ,const char * restrict direction
   ,int32_t hidden_size
 ) {
+  const int32_t seq_length = input_X_dims[0];
+  const int32_t batch_size = input_X_dims[1];
+  const int32_t input_size = input_X_dims[2];
+  const int32_t H = (hidden_size > 0) ? hidden_size : input_R_dims[2];
+  const int32_t num_directions = ONNC_RUNTIME_internal_num_directions(direction);
+  // sequence_lens is an int32 tensor, handed over through a float pointer.
+  const int32_t *seq_lens = (const int32_t *)input_sequence_lens;
+
+  static const char * const defaults[1] = { "Tanh" };
+  ONNC_RUNTIME_Activation acts[num_directions];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    defaults, 1, num_directions, acts);
+
+  float *proj = (float *)malloc(sizeof(float) * seq_length * batch_size * H);
+  float *gates = (float *)malloc(sizeof(float) * batch_size * H);
+  float *h = (float *)malloc(sizeof(float) * batch_size * H);
+  float *bias = (float *)malloc(sizeof(float) * H);
+  if (proj == NULL || gates == NULL || h == NULL || bias == NULL) {
+    free(proj);
+    free(gates);
+    free(h);
+    free(bias);
+    return;
+  }
+
+  for (int32_t d = 0; d < num_directions; ++d) {
+    const bool reverse = ONNC_RUNTIME_internal_is_reverse(direction, d);
+    const float *W = input_W + (int64_t)d * H * input_size;
+    const float *R = input_R + (int64_t)d * H * H;
+    if (input_B != NULL) {
+      const float *B = input_B + (int64_t)d * 2 * H;
+      for (int32_t j = 0; j < H; ++j) {
+        bias[j] = B[j] + B[H + j];
+      }
+    }
+    ONNC_RUNTIME_internal_input_projection(onnc_runtime_context,
+      seq_length * batch_size, input_size, H, input_X, W,
+      (input_B != NULL) ? bias : NULL, proj);
+
+    const int64_t state_offset = (int64_t)d * batch_size * H;
+    if (input_initial_h != NULL) {
+      memcpy(h, input_initial_h + state_offset, sizeof(float) * batch_size * H);
+    } else {
+      memset(h, 0, sizeof(float) * batch_size * H);
+    }
+
+    for (int32_t step = 0; step < seq_length; ++step) {
+      ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, true,
+                                  batch_size, H, H, 1.f, h, H, R, H,
+                                  0.f, gates, H);
+      for (int32_t b = 0; b < batch_size; ++b) {
+        int32_t seq_len = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                                seq_length);
+        int32_t t = ONNC_RUNTIME_internal_timestep(step, seq_len, reverse);
+        if (t < 0) {
+          continue;
+        }
+        float *g = gates + (int64_t)b * H;
+        const float *p = proj + ((int64_t)t * batch_size + b) * H;
+        for (int32_t j = 0; j < H; ++j) {
+          g[j] += p[j];
+        }
+        ONNC_RUNTIME_internal_clip(clip, H, g);
+        ONNC_RUNTIME_internal_activate(&acts[d], H, g);
+        memcpy(h + (int64_t)b * H, g, sizeof(float) * H);
+        if (output_Y != NULL) {
+          float *y = output_Y + (((int64_t)t * num_directions + d) * batch_size + b) * H;
+          memcpy(y, g, sizeof(float) * H);
+        }
+      }
+    }
+
+    // Steps past the end of a sequence produce zeros.
+    if (output_Y != NULL && seq_lens != NULL) {
+      for (int32_t b = 0; b < batch_size; ++b) {
+        for (int32_t t = ONNC_RUNTIME_internal_sequence_length(seq_lens, b,
+                                                               seq_length);
+             t < seq_length; ++t) {
+          float *y = output_Y + (((int64_t)t * num_directions + d) * batch_size + b) * H;
+          memset(y, 0, sizeof(float) * H);
+        }
+      }
+    }
+    if (output_Y_h != NULL) {
+      memcpy(output_Y_h + state_offset, h, sizeof(float) * batch_size * H);
+    }
+  }
+
+  free(proj);
+  free(gates);
+  free(h);
+  free(bias);
 }
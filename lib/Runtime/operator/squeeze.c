@@ -12,6 +12,11 @@ void ONNC_RUNTIME_squeeze_float(
   ,int32_t * restrict axes
   ,int32_t number_of_axes
 ) {
+  // The output shares the memory of the input.
+  if (output_squeezed == input_data) {
+    return;
+  }
+
   int32_t size_N = 1;
 
   // total counts of elements
@@ -46,7 +46,6 @@ static void down_heap(struct node * restrict heap, int32_t index, int32_t inside
 
     int32_t right_index = 2 * index + 1;
     int32_t left_index = 2 * index;
-    int32_t value = heap[index].value;
 
     if(left_index > inside_num) return;
 	if(right_index > inside_num && smaller(heap[left_index], heap[index])){
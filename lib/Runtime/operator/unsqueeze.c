@@ -12,6 +12,11 @@ void ONNC_RUNTIME_unsqueeze_float(
   ,int32_t * restrict axes
   ,int32_t number_of_axes
 ) {
+  // The output shares the memory of the input.
+  if (output_expanded == input_data) {
+    return;
+  }
+
   int32_t size_N = 1;
   for(int32_t i = 0; i < input_data_ndim; ++i) {
     size_N *= input_data_dims[i];
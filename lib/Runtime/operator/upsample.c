@@ -5,20 +5,6 @@
 #include <stddef.h>
 #include <string.h>
 
-static size_t getOffset(
-  const int32_t * restrict target_dims,
-  int32_t ndim,
-  const int32_t * restrict dims
-){
-  size_t offset = target_dims[ndim - 1] % dims[ndim - 1];
-  size_t steps = 1;
-  for(int32_t i = ndim - 2; i >= 0; --i){
-    steps *= dims[i + 1];
-    offset += target_dims[i] * steps;
-  }
-  return offset;
-}
-
 static void nearest_upsample(
   int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
   ,const int32_t * restrict output_convs
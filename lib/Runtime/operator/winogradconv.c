@@ -0,0 +1,306 @@
+#include <onnc/Runtime/operator/winogradconv.h>
+#include <onnc/Runtime/internal/activation.h>
+#include <onnc/Runtime/internal/parallel.h>
+#include <onnc/Runtime/internal/sgemm.h>
+#include <onnc/Runtime/internal/winograd.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Upper bound (in floats) of the transformed input and output of one block of
+// tiles. A block is transformed, multiplied and transformed back while it is
+// in cache, and the buffers don't grow with the feature map. (2 MiB)
+#define WINOGRAD_BLOCK_SIZE (1 << 19)
+
+#define WINOGRAD_MAX_ALPHA ONNC_RUNTIME_WINOGRAD_ALPHA(4)
+
+// The 1-D transforms below are the rows of B^T, G and A^T. F(2, 3) uses the
+// interpolation points 0, 1, -1, and F(4, 3) uses 0, 1, -1, 2, -2; both add
+// the point at infinity. Zero coefficients are left out, which the compiler
+// can't do by itself without -ffast-math.
+
+// v = B^T d, where d and v are strided vectors of alpha elements.
+static inline void input_1d(int32_t tile, const float * restrict d,
+                            int32_t ds, float * restrict v, int32_t vs) {
+  if (tile == 2) {
+    v[0]      = d[0] - d[2 * ds];
+    v[vs]     = d[ds] + d[2 * ds];
+    v[2 * vs] = d[2 * ds] - d[ds];
+    v[3 * vs] = d[ds] - d[3 * ds];
+  } else {
+    float d0 = d[0], d1 = d[ds], d2 = d[2 * ds];
+    float d3 = d[3 * ds], d4 = d[4 * ds], d5 = d[5 * ds];
+    v[0]      = 4.f * d0 - 5.f * d2 + d4;
+    v[vs]     = -4.f * (d1 + d2) + d3 + d4;
+    v[2 * vs] = 4.f * (d1 - d2) - d3 + d4;
+    v[3 * vs] = 2.f * (d3 - d1) - d2 + d4;
+    v[4 * vs] = 2.f * (d1 - d3) - d2 + d4;
+    v[5 * vs] = 4.f * d1 - 5.f * d3 + d5;
+  }
+}
+
+// u = G g, where g is a strided vector of 3 elements.
+static inline void weight_1d(int32_t tile, const float * restrict g,
+                             int32_t gs, float * restrict u, int32_t us) {
+  float g0 = g[0], g1 = g[gs], g2 = g[2 * gs];
+  if (tile == 2) {
+    u[0]      = g0;
+    u[us]     = 0.5f * (g0 + g1 + g2);
+    u[2 * us] = 0.5f * (g0 - g1 + g2);
+    u[3 * us] = g2;
+  } else {
+    u[0]      = g0 / 4.f;
+    u[us]     = -(g0 + g1 + g2) / 6.f;
+    u[2 * us] = -(g0 - g1 + g2) / 6.f;
+    u[3 * us] = g0 / 24.f + g1 / 12.f + g2 / 6.f;
+    u[4 * us] = g0 / 24.f - g1 / 12.f + g2 / 6.f;
+    u[5 * us] = g2;
+  }
+}
+
+// y = A^T m, where m is a strided vector of alpha elements.
+static inline void output_1d(int32_t tile, const float * restrict m,
+                             int32_t ms, float * restrict y, int32_t ys) {
+  if (tile == 2) {
+    y[0]  = m[0] + m[ms] + m[2 * ms];
+    y[ys] = m[ms] - m[2 * ms] - m[3 * ms];
+  } else {
+    float m0 = m[0], m1 = m[ms], m2 = m[2 * ms];
+    float m3 = m[3 * ms], m4 = m[4 * ms], m5 = m[5 * ms];
+    float s12 = m1 + m2, d12 = m1 - m2, s34 = m3 + m4, d34 = m3 - m4;
+    y[0]      = m0 + s12 + s34;
+    y[ys]     = d12 + 2.f * d34;
+    y[2 * ys] = s12 + 4.f * s34;
+    y[3 * ys] = d12 + 8.f * d34 + m5;
+  }
+}
+
+void ONNC_RUNTIME_internal_winograd_weight_float(int32_t tile,
+                                                 int32_t M, int32_t C,
+                                                 const float * restrict W,
+                                                 float * restrict U) {
+  int32_t alpha = ONNC_RUNTIME_WINOGRAD_ALPHA(tile);
+  for (int32_t m = 0; m < M; ++m) {
+    for (int32_t c = 0; c < C; ++c) {
+      const float * restrict g = W + ((int64_t)m * C + c) * 9;
+      float tmp[WINOGRAD_MAX_ALPHA * 3], u[WINOGRAD_MAX_ALPHA * WINOGRAD_MAX_ALPHA];
+      for (int32_t j = 0; j < 3; ++j) {
+        weight_1d(tile, g + j, 3, tmp + j, 3);
+      }
+      for (int32_t i = 0; i < alpha; ++i) {
+        weight_1d(tile, tmp + i * 3, 1, u + i * alpha, 1);
+      }
+      for (int32_t xi = 0; xi < alpha * alpha; ++xi) {
+        U[((int64_t)xi * M + m) * C + c] = u[xi];
+      }
+    }
+  }
+}
+
+typedef struct Winograd {
+  int32_t tile;
+  int32_t alpha;
+  int32_t C, iH, iW;
+  int32_t M, oH, oW;
+  int32_t pad_top, pad_left;
+  int32_t tiles_w;      // Tiles in a row of the output
+  int64_t first;        // First tile of the block
+  int32_t count;        // Tiles in the block
+  int32_t ld;           // Capacity of the block in tiles
+  const float *x;       // The image of the block
+  const float *B;
+  float *V;             // [alpha * alpha x C x ld] transformed input
+  float *Mx;            // [alpha * alpha x M x ld] products
+  float *y;             // The output of the image
+  const ONNC_RUNTIME_Activation *acts;
+  int32_t number_of_acts;
+} Winograd;
+
+// Transform the tiles of the block in input channel c.
+static inline void input_tiles(const Winograd *w, int32_t c, int32_t tile) {
+  int32_t alpha = ONNC_RUNTIME_WINOGRAD_ALPHA(tile);
+  const float * restrict x = w->x + (int64_t)c * w->iH * w->iW;
+  float * restrict v_c = w->V + (int64_t)c * w->ld;
+  int64_t xi_stride = (int64_t)w->C * w->ld;
+  for (int32_t t = 0; t < w->count; ++t) {
+    int64_t q = w->first + t;
+    int32_t ih0 = (int32_t)(q / w->tiles_w) * tile - w->pad_top;
+    int32_t iw0 = (int32_t)(q % w->tiles_w) * tile - w->pad_left;
+
+    float d[WINOGRAD_MAX_ALPHA * WINOGRAD_MAX_ALPHA];
+    if (ih0 >= 0 && iw0 >= 0 && ih0 + alpha <= w->iH && iw0 + alpha <= w->iW) {
+      for (int32_t i = 0; i < alpha; ++i) {
+        const float * restrict src = x + (int64_t)(ih0 + i) * w->iW + iw0;
+        for (int32_t j = 0; j < alpha; ++j) {
+          d[i * alpha + j] = src[j];
+        }
+      }
+    } else {
+      for (int32_t i = 0; i < alpha; ++i) {
+        int32_t ih = ih0 + i;
+        for (int32_t j = 0; j < alpha; ++j) {
+          int32_t iw = iw0 + j;
+          bool inside = ih >= 0 && ih < w->iH && iw >= 0 && iw < w->iW;
+          d[i * alpha + j] = inside ? x[(int64_t)ih * w->iW + iw] : 0.f;
+        }
+      }
+    }
+
+    // v = B^T d B
+    float tmp[WINOGRAD_MAX_ALPHA * WINOGRAD_MAX_ALPHA];
+    float v[WINOGRAD_MAX_ALPHA * WINOGRAD_MAX_ALPHA];
+    for (int32_t j = 0; j < alpha; ++j) {
+      input_1d(tile, d + j, alpha, tmp + j, alpha);
+    }
+    for (int32_t i = 0; i < alpha; ++i) {
+      input_1d(tile, tmp + i * alpha, 1, v + i * alpha, 1);
+    }
+    for (int32_t xi = 0; xi < alpha * alpha; ++xi) {
+      v_c[xi * xi_stride + t] = v[xi];
+    }
+  }
+}
+
+// Transform the products of the block back in output channel m, and apply
+// the bias and the activations while the tile is in registers.
+static inline void output_tiles(const Winograd *w, int32_t m, int32_t tile) {
+  int32_t alpha = ONNC_RUNTIME_WINOGRAD_ALPHA(tile);
+  const float * restrict p_m = w->Mx + (int64_t)m * w->ld;
+  float * restrict y = w->y + (int64_t)m * w->oH * w->oW;
+  int64_t xi_stride = (int64_t)w->M * w->ld;
+  float bias = (w->B != NULL) ? w->B[m] : 0.f;
+  for (int32_t t = 0; t < w->count; ++t) {
+    float p[WINOGRAD_MAX_ALPHA * WINOGRAD_MAX_ALPHA];
+    for (int32_t xi = 0; xi < alpha * alpha; ++xi) {
+      p[xi] = p_m[xi * xi_stride + t];
+    }
+
+    // r = A^T p A
+    float tmp[4 * WINOGRAD_MAX_ALPHA], r[4 * 4];
+    for (int32_t j = 0; j < alpha; ++j) {
+      output_1d(tile, p + j, alpha, tmp + j, alpha);
+    }
+    for (int32_t i = 0; i < tile; ++i) {
+      output_1d(tile, tmp + i * alpha, 1, r + i * tile, 1);
+    }
+    for (int32_t i = 0; i < tile * tile; ++i) {
+      r[i] += bias;
+    }
+    ONNC_RUNTIME_internal_activate_all(w->acts, w->number_of_acts,
+                                       tile * tile, r);
+
+    // Tiles at the bottom and the right may hang over the output.
+    int64_t q = w->first + t;
+    int32_t oh0 = (int32_t)(q / w->tiles_w) * tile;
+    int32_t ow0 = (int32_t)(q % w->tiles_w) * tile;
+    int32_t rows = (w->oH - oh0 < tile) ? w->oH - oh0 : tile;
+    int32_t cols = (w->oW - ow0 < tile) ? w->oW - ow0 : tile;
+    for (int32_t i = 0; i < rows; ++i) {
+      float * restrict dst = y + (int64_t)(oh0 + i) * w->oW + ow0;
+      for (int32_t j = 0; j < cols; ++j) {
+        dst[j] = r[i * tile + j];
+      }
+    }
+  }
+}
+
+static void input_task_f2(void *arg, int32_t task) {
+  input_tiles((const Winograd *)arg, task, 2);
+}
+
+static void input_task_f4(void *arg, int32_t task) {
+  input_tiles((const Winograd *)arg, task, 4);
+}
+
+static void output_task_f2(void *arg, int32_t task) {
+  output_tiles((const Winograd *)arg, task, 2);
+}
+
+static void output_task_f4(void *arg, int32_t task) {
+  output_tiles((const Winograd *)arg, task, 4);
+}
+
+void ONNC_RUNTIME_winogradconv_float(
+  void * restrict onnc_runtime_context
+  ,const float * restrict input_X
+  ,int32_t input_X_ndim, const int32_t * restrict input_X_dims
+  ,const float * restrict input_W
+  ,int32_t input_W_ndim, const int32_t * restrict input_W_dims
+  ,const float * restrict input_B
+  ,int32_t input_B_ndim, const int32_t * restrict input_B_dims
+  ,float * restrict output_Y
+  ,int32_t output_Y_ndim, const int32_t * restrict output_Y_dims
+  ,float * restrict activation_alpha
+  ,int32_t number_of_activation_alpha
+  ,float * restrict activation_beta
+  ,int32_t number_of_activation_beta
+  ,const char ** restrict activations
+  ,int32_t number_of_activations
+  ,int32_t * restrict pads
+  ,int32_t number_of_pads
+  ,int32_t tile
+) {
+  ONNC_RUNTIME_Activation acts[number_of_activations + 1];
+  ONNC_RUNTIME_internal_parse_activations(
+    activations, number_of_activations,
+    activation_alpha, number_of_activation_alpha,
+    activation_beta, number_of_activation_beta,
+    activations, number_of_activations, 1, acts);
+
+  Winograd w;
+  w.tile = (tile == 2) ? 2 : 4;
+  w.alpha = ONNC_RUNTIME_WINOGRAD_ALPHA(w.tile);
+  w.C = input_X_dims[1];
+  w.iH = input_X_dims[2];
+  w.iW = input_X_dims[3];
+  w.M = output_Y_dims[1];
+  w.oH = output_Y_dims[2];
+  w.oW = output_Y_dims[3];
+  w.pad_top = (number_of_pads >= 2) ? pads[0] : 0;
+  w.pad_left = (number_of_pads >= 2) ? pads[1] : 0;
+  w.tiles_w = (w.oW + w.tile - 1) / w.tile;
+  w.B = input_B;
+  w.acts = acts;
+  w.number_of_acts = number_of_activations;
+
+  int32_t N = input_X_dims[0];
+  int32_t alpha2 = w.alpha * w.alpha;
+  int64_t tiles = (int64_t)(w.oH + w.tile - 1) / w.tile * w.tiles_w;
+  if (tiles == 0) {
+    return;
+  }
+  int64_t ld = WINOGRAD_BLOCK_SIZE / ((int64_t)alpha2 * (w.C + w.M));
+  if (ld < ONNC_RUNTIME_SGEMM_NR) ld = ONNC_RUNTIME_SGEMM_NR;
+  if (ld > tiles) ld = tiles;
+  w.ld = (int32_t)ld;
+  w.V = (float *)malloc(sizeof(float) * alpha2 * w.C * w.ld);
+  w.Mx = (float *)malloc(sizeof(float) * alpha2 * w.M * w.ld);
+
+  ONNC_RUNTIME_parallel_fn input_task =
+      (w.tile == 2) ? input_task_f2 : input_task_f4;
+  ONNC_RUNTIME_parallel_fn output_task =
+      (w.tile == 2) ? output_task_f2 : output_task_f4;
+  for (int32_t n = 0; n < N; ++n) {
+    w.x = input_X + (int64_t)n * w.C * w.iH * w.iW;
+    w.y = output_Y + (int64_t)n * w.M * w.oH * w.oW;
+    for (w.first = 0; w.first < tiles; w.first += w.ld) {
+      w.count = (tiles - w.first < w.ld) ? (int32_t)(tiles - w.first) : w.ld;
+      ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, w.C,
+                                         input_task, &w);
+      // One [M x C] x [C x count] product per point of the tile.
+      for (int32_t xi = 0; xi < alpha2; ++xi) {
+        ONNC_RUNTIME_internal_sgemm(onnc_runtime_context, false, false,
+                                    w.M, w.count, w.C,
+                                    1.f, input_W + (int64_t)xi * w.M * w.C, w.C,
+                                    w.V + (int64_t)xi * w.C * w.ld, w.ld,
+                                    0.f, w.Mx + (int64_t)xi * w.M * w.ld, w.ld);
+      }
+      ONNC_RUNTIME_internal_parallel_for(onnc_runtime_context, w.M,
+                                         output_task, &w);
+    }
+  }
+
+  free(w.V);
+  free(w.Mx);
+}
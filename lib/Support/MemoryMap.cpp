@@ -25,13 +25,19 @@ MemoryMap::mapFile(const std::string &pName)
   int stat_ret;
   struct stat stat_buf;
   stat_ret = ::fstat(fd, &stat_buf);
-  if (stat_ret != 0)
+  // An empty file can not be mapped.
+  if (stat_ret != 0 || 0 == stat_buf.st_size) {
+    ::close(fd);
     return nullptr;
+  }
 
   SystemError err;
   std::unique_ptr<MemoryMap> ret(new MemoryMap(fd, stat_buf.st_size, 0, err));
 
   ::close(fd);
 
+  if (!err.isGood())
+    return nullptr;
+
   return ret;
 }
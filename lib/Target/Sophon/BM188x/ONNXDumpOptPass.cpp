@@ -68,11 +68,9 @@ ModulePass *onnc::createONNXDumpQuantizedPass(BM1880Backend *pBackend)
 
 static void ExportONNX(const std::string &outputFileName, const Module &pModule)
 {
-  xProto modelProto;
-  onnc::ExportModelProto(modelProto, pModule);
   std::fstream output(outputFileName,
                       std::ios::out | std::ios::trunc | std::ios::binary);
-  modelProto.SerializeToOstream(&output);
+  onnc::SerializeToOstream(output, pModule);
 }
 
 Pass::ReturnType ONNXDumpOpt::runOnModule(Module &pModule)
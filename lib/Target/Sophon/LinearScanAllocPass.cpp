@@ -8,6 +8,7 @@
 #define DEBUG_TYPE "sophon_LSAP"
 #include "LinearScanAllocPass.h"
 #include "TGBackend.h"
+#include <onnc/CodeGen/LiveIntervalsData.h>
 #include <onnc/Core/AnalysisResolver.h>
 #include <onnc/Core/AnalysisUsage.h>
 #include <onnc/Core/PassAnalysisSupport.h>
@@ -17,6 +18,9 @@
 #include <onnc/IR/Compute/Tensor.h>
 #include <onnc/IR/Compute/Value.h>
 #include <onnc/Support/Debug.h>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace onnc;
 
@@ -26,13 +30,14 @@ using namespace onnc;
 char LinearScanAlloc::ID = 0;
 
 LinearScanAlloc::LinearScanAlloc(TGBackend *pTarget)
-    : ModulePass(ID), m_pTarget(pTarget)
+    : ModulePass(ID), m_pTarget(pTarget), m_pLIData(nullptr)
 {
 }
 
 Pass::ReturnType LinearScanAlloc::runOnModule(::onnc::Module &pModule)
 {
   assert (pModule.getNumOfComputeGraphs() == 1);
+  m_pLIData = getAnalysis<LiveIntervalsData>();
   linearScanAllocMem(*pModule.getRootComputeGraph(),
                      getAnalysis<BuildMemOpnd>()->getMemOperandList());
 
@@ -69,19 +74,27 @@ void LinearScanAlloc::memoryAlloc(ComputeMemOperand *pMemOp,
   xTensorProtoDataType ty = (xTensorProtoDataType)pMemVal->kind();
   int tensor_size = m_pTarget->sizeOfTensorType(ty) * getNumElems(pMemVal);
 
+  pMemOp->setLength(tensor_size);
+  allocatedValue.insert({ pMemVal, pMemOp });
+  m_AllocatedMemOpnd.insert(pMemOp);
+
+  // neurons are placed by neuronAlloc, when all lifetimes are known.
   if (pMemOp->residence() != ComputeOperand::kWeightResidence) {
-    pMemOp->setStart(m_NeuronOffset);
-    m_NeuronOffset += tensor_size;
-  } else {
-    pMemOp->setStart(m_WeightOffset);
-    m_WeightOffset += tensor_size;
+    m_Neurons.push_back(pMemOp);
+    return;
   }
 
-  pMemOp->setLength(tensor_size);
-  allocatedValue.insert({ pMemVal, pMemOp });
+  pMemOp->setStart(m_WeightOffset);
+  m_WeightOffset += tensor_size;
   DEBUG(dbgs() << "allocatedValue insert: " << pMemVal->getName() << ", start: "
                << pMemOp->start() << ", end: " << pMemOp->length() << "\n");
-  m_AllocatedMemOpnd.insert(pMemOp);
+}
+
+void LinearScanAlloc::neuronAlloc(
+    const BuildMemOpnd::ValMemOpndMap &pValMemOpndMap)
+{
+  m_NeuronOffset = AllocNeurons(m_Neurons, pValMemOpndMap, *m_pLIData);
+  DEBUG(dbgs() << "neuron memory: " << m_NeuronOffset << "\n");
 }
 
 void LinearScanAlloc::linearScanAllocMem(
@@ -90,6 +103,7 @@ void LinearScanAlloc::linearScanAllocMem(
   m_WeightOffset = 0;
   m_NeuronOffset = 0;
   m_AllocatedMemOpnd.clear();
+  m_Neurons.clear();
   auto valMemOpndMap = pValMemOpndMap;
 
   // we want to increase locality for loading weight data
@@ -120,11 +134,96 @@ void LinearScanAlloc::linearScanAllocMem(
       memoryAlloc(memOp, memVal);
     }
   }
+
+  neuronAlloc(pValMemOpndMap);
 }
 
 void LinearScanAlloc::getAnalysisUsage(AnalysisUsage& pUsage) const
 {
   pUsage.addRequiredID(BuildMemOpnd::ID);
+  pUsage.addRequiredID(LiveIntervalsData::ID);
+}
+
+//===----------------------------------------------------------------------===//
+// Non-member functions
+//===----------------------------------------------------------------------===//
+unsigned int
+onnc::AllocNeurons(const std::vector<ComputeMemOperand *> &pNeurons,
+                   const BuildMemOpnd::ValMemOpndMap &pValMemOpndMap,
+                   const LiveIntervalsData &pLIData)
+{
+  std::unordered_set<const ComputeMemOperand *> neurons(pNeurons.begin(),
+                                                        pNeurons.end());
+
+  // [first, last] slot in which the memory of an operand is in use. No-op
+  // operators share operands, so an operand lives as long as all of its
+  // values.
+  typedef std::pair<unsigned int, unsigned int> Lifetime;
+  std::unordered_map<const ComputeMemOperand *, Lifetime> lifetimes;
+  const unsigned int lastSlot = pLIData.getNumSlots() - 1;
+  for (auto &entry : pValMemOpndMap) {
+    const onnc::Value *value = entry.first;
+    const ComputeMemOperand *memOp = entry.second;
+    if (neurons.find(memOp) == neurons.end() || !pLIData.hasInterval(value))
+      continue;
+
+    const LiveInterval *li = pLIData.getInterval(value);
+    Lifetime life(li->beginIndex().getIndex(), li->endIndex().getIndex());
+
+    // Inputs are written before the first operator and outputs are read
+    // after the last one.
+    if (isa<InputOperator>(static_cast<ComputeOperator *>(value->getDefine())))
+      life.first = 0;
+    for (const Use &use : value->getUses()) {
+      if (isa<OutputOperator>(use.getUser()))
+        life.second = lastSlot;
+    }
+
+    auto found = lifetimes.find(memOp);
+    if (found == lifetimes.end())
+      lifetimes.insert({ memOp, life });
+    else {
+      found->second.first = std::min(found->second.first, life.first);
+      found->second.second = std::max(found->second.second, life.second);
+    }
+  }
+
+  // First fit, in order of execution, among the operands whose lifetimes
+  // overlap.
+  std::vector<const ComputeMemOperand *> placed;
+  std::vector<std::pair<unsigned int, unsigned int> > regions;
+  unsigned int size = 0;
+  for (ComputeMemOperand *memOp : pNeurons) {
+    Lifetime life(0, lastSlot);
+    auto found = lifetimes.find(memOp);
+    if (found != lifetimes.end())
+      life = found->second;
+    else
+      lifetimes.insert({ memOp, life });
+
+    regions.clear();
+    for (const ComputeMemOperand *other : placed) {
+      const Lifetime &otherLife = lifetimes[other];
+      if (otherLife.first <= life.second && life.first <= otherLife.second)
+        regions.push_back({ other->start(), other->start() + other->length() });
+    }
+    std::sort(regions.begin(), regions.end());
+
+    unsigned int start = 0;
+    for (auto &region : regions) {
+      if (start + memOp->length() <= region.first)
+        break;
+      start = std::max(start, region.second);
+    }
+
+    memOp->setStart(start);
+    size = std::max(size, start + memOp->length());
+    placed.push_back(memOp);
+    DEBUG(dbgs() << "neuron [" << life.first << ", " << life.second
+                 << "], start: " << memOp->start()
+                 << ", length: " << memOp->length() << "\n");
+  }
+  return size;
 }
 
 ModulePass *onnc::CreateLinearScanAllocPass(TGBackend *pTarget)
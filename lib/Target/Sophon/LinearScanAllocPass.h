@@ -12,8 +12,16 @@
 #include <onnc/Core/PassSupport.h>
 
 namespace onnc {
+class LiveIntervalsData;
 class TGBackend;
 
+/** \class LinearScanAlloc
+ *  \brief Allocate weight and neuron memory of Sophon targets.
+ *
+ *  Weights are laid out one after another in the order of execution, which
+ *  GenWeightPass depends on. Neurons share memory when their lifetimes,
+ *  taken from LiveIntervalsData, don't overlap.
+ */
 class LinearScanAlloc : public ModulePass
 {
 public:
@@ -34,18 +42,34 @@ private:
 
   void memoryAlloc(ComputeMemOperand *pMemOp, const onnc::Value *pMemVal);
 
+  /// Place the neuron operands collected by memoryAlloc, reusing memory of
+  /// operands which are dead.
+  void neuronAlloc(const BuildMemOpnd::ValMemOpndMap &pValMemOpndMap);
+
 private:
   // for sizeOfTensorType.
   // FIXME: Use DLATargetBackend instead.
   //        sizeofTensorType is used on compute ir with legalized value type
   TGBackend *m_pTarget; // NOLINT
+  LiveIntervalsData *m_pLIData;
   unsigned int m_WeightOffset;
   unsigned int m_NeuronOffset;
   std::unordered_set<ComputeMemOperand*> m_AllocatedMemOpnd;
+  std::vector<ComputeMemOperand*> m_Neurons; ///< in order of execution
 };
 
 ModulePass *CreateLinearScanAllocPass(TGBackend *pTarget);
 
+/// Place the neuron operands @ref pNeurons, whose lengths are set, in order.
+/// An operand lives from the first to the last slot of all the values mapped
+/// to it by @ref pValMemOpndMap; network inputs from the first slot and
+/// outputs until the last. Each operand goes to the lowest offset that doesn't
+/// overlap an already placed operand with an overlapping lifetime.
+/// @return The size of the neuron memory.
+unsigned int AllocNeurons(const std::vector<ComputeMemOperand *> &pNeurons,
+                          const BuildMemOpnd::ValMemOpndMap &pValMemOpndMap,
+                          const LiveIntervalsData &pLIData);
+
 } // namespace onnc
 
 #endif
@@ -21,6 +21,7 @@
 #include <onnc/Analysis/UpdateGraphOutputSize.h>
 #include <onnc/IR/ONNCModulePrinter.h>
 #include <onnc/Target/TargetRegistry.h>
+#include <onnc/Target/TargetStandardPasses.h>
 #include <onnc/Transforms/RemoveTrainingNodes.h>
 
 using namespace onnc;
@@ -42,6 +43,8 @@ void TGBackend::addTensorSel(PassManager &pPM)
 
 void TGBackend::addMemAlloc(PassManager &pPM)
 {
+  // Neurons whose lifetimes don't overlap share memory.
+  addStandardCreateLiveIntervals(pPM);
   pPM.add(CreateBuildMemOpndPass());
   pPM.add(CreateLinearScanAllocPass(this));
 }
@@ -14,14 +14,21 @@ using namespace onnc;
 //===----------------------------------------------------------------------===//
 TargetOptions::TargetOptions()
   : m_PrintModuleBeforeSel(false), m_IgnoreCalibrationStep(false),
-    m_AddDummyCTable(false), m_AddDummyWeight(false) {
+    m_AddDummyCTable(false), m_AddDummyWeight(false), m_Calibrate(false),
+    m_MemAllocStrategy(kMinimumMemory), m_WeightType(kFloatWeight),
+    m_NCHWcBlock(8) {
 }
 
 TargetOptions::TargetOptions(const TargetOptions& pCopy)
   : m_PrintModuleBeforeSel(pCopy.shouldPrintBeforeTensorSel()),
     m_IgnoreCalibrationStep(pCopy.shouldIgnoreCalibrationStep()),
     m_AddDummyCTable(pCopy.shouldUseDummyCTable()),
-    m_AddDummyWeight(pCopy.shouldUseDummyWeight()) {
+    m_AddDummyWeight(pCopy.shouldUseDummyWeight()),
+    m_Calibrate(pCopy.shouldCalibrate()),
+    m_MemAllocStrategy(pCopy.getMemAllocStrategy()),
+    m_WeightType(pCopy.getWeightType()),
+    m_NCHWcBlock(pCopy.getNCHWcBlock()),
+    m_CalibrationTable(pCopy.getCalibrationTable()) {
 }
 
 TargetOptions& TargetOptions::operator=(const TargetOptions& pCopy)
@@ -30,5 +37,63 @@ TargetOptions& TargetOptions::operator=(const TargetOptions& pCopy)
   m_IgnoreCalibrationStep = pCopy.shouldIgnoreCalibrationStep();
   m_AddDummyCTable = pCopy.shouldUseDummyCTable();
   m_AddDummyWeight = pCopy.shouldUseDummyWeight();
+  m_Calibrate = pCopy.shouldCalibrate();
+  m_MemAllocStrategy = pCopy.getMemAllocStrategy();
+  m_WeightType = pCopy.getWeightType();
+  m_NCHWcBlock = pCopy.getNCHWcBlock();
+  m_CalibrationTable = pCopy.getCalibrationTable();
   return *this;
 }
+
+bool TargetOptions::setMemAllocStrategy(const std::string& pName)
+{
+  static const struct {
+    const char* name;
+    MemAllocStrategy strategy;
+  } strategies[] = {
+    { "first-fit", kFirstFit },
+    { "best-fit", kBestFit },
+    { "greedy-by-size", kGreedyBySize },
+    { "skyline", kSkyline },
+    { "minimum", kMinimumMemory },
+  };
+
+  for (const auto& entry : strategies) {
+    if (pName == entry.name) {
+      m_MemAllocStrategy = entry.strategy;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TargetOptions::setWeightType(const std::string& pName)
+{
+  static const struct {
+    const char* name;
+    WeightType type;
+  } types[] = {
+    { "float", kFloatWeight },
+    { "float16", kFloat16Weight },
+    { "bfloat16", kBFloat16Weight },
+  };
+
+  for (const auto& entry : types) {
+    if (pName == entry.name) {
+      m_WeightType = entry.type;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TargetOptions::setNCHWcBlock(const std::string& pName)
+{
+  if ("8" == pName)
+    m_NCHWcBlock = 8;
+  else if ("16" == pName)
+    m_NCHWcBlock = 16;
+  else
+    return false;
+  return true;
+}
@@ -9,8 +9,8 @@
 #include <onnc/CodeGen/BuildMemOperand.h>
 #include <onnc/CodeGen/LinearScanMemAlloc.h>
 #include <onnc/CodeGen/LiveIntervals.h>
-#include <onnc/CodeGen/LiveValueMatrix.h>
 #include <onnc/CodeGen/MemAllocData.h>
+#include <onnc/CodeGen/MemoryAwareSchedule.h>
 #include <onnc/CodeGen/SetMemOperand.h>
 #include <onnc/CodeGen/SlotIndexes.h>
 #include <onnc/Core/InitializePasses.h>
@@ -51,6 +51,12 @@ void onnc::addStandardTensorSel(PassManager& pPM, TargetBackend& pTB) {
   pPM.add(CreateBuildOutputOperators());
 }
 
+void onnc::addStandardTensorSched(PassManager& pPM, TargetBackend& pTB)
+{
+  // Reorder operators to lower the peak of live activation memory.
+  pPM.add(CreateMemoryAwareSchedulePass(&pTB));
+}
+
 void onnc::addStandardCreateLiveIntervals(PassManager& pPM)
 {
   PassRegistry& reg = *pPM.getPassRegistry();
@@ -67,8 +73,6 @@ void onnc::addStandardCreateLiveIntervals(PassManager& pPM)
 void onnc::addStandardMemoryAllocation(PassManager& pPM, TargetBackend& pTB)
 {
   PassRegistry& reg = *pPM.getPassRegistry();
-  // Create live matrix for interference query
-  InitializeLiveValueMatrixPass(reg);
   // Create memory allocation data pass for saving allocation result.
   InitializeMemAllocDataPass(reg);
   // Standard memory allocation for each value
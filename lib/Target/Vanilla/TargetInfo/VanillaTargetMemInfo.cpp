@@ -23,6 +23,7 @@ MemSize VanillaTargetMemInfo::getTensorMemorySize(const Tensor& pVal)
   case kUint16:
   case kInt16:
   case kFloat16:
+  case kBFloat16:
     align = 16, size = 2;
     break;
 
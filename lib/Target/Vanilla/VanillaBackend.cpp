@@ -84,7 +84,8 @@ void VanillaBackend::addTensorSched(PassManager& pPM)
   // After method AddTensorSel, operators have been scheduled in an
   // topological order, which totally respects the data dependency.
   // However, that might not be an optimized order for certain objective.
-  // Add a scheduling optimization pass here.
+  // The standard scheduling lowers the peak of live memory.
+  addStandardTensorSched(pPM, *this);
 }
 
 void VanillaBackend::addMemAlloc(PassManager& pPM)
@@ -0,0 +1,555 @@
+//===- X86AssignLayout.cpp ------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86AssignLayout.h"
+#include "X86ConvCost.h"
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/AveragePool.h>
+#include <onnc/IR/Compute/BatchNormalization.h>
+#include <onnc/IR/Compute/BatchNormalizationNCHWc.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/ConvNCHWc.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/MaxPool.h>
+#include <onnc/IR/Compute/PoolNCHWc.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/Reorder.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/internal/layout.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// @return The float weight pValue if all its values are loaded, otherwise
+///         nullptr.
+const FloatTensor* GetWeight(const Value* pValue)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue->getDefine());
+  if (nullptr == define || !isa<Initializer>(define) ||
+      Value::kFloat != pValue->kind())
+    return nullptr;
+
+  const FloatTensor* tensor = static_cast<const FloatTensor*>(pValue);
+  size_t size = 1;
+  for (int64_t dim : tensor->getDimensions())
+    size *= dim;
+  if (size != tensor->getNumOfValues())
+    return nullptr;
+  return tensor;
+}
+
+/// @return The number of elements of pTensor.
+int64_t GetNumOfElements(const Tensor& pTensor)
+{
+  int64_t size = 1;
+  for (int64_t dim : pTensor.getDimensions())
+    size *= dim;
+  return size;
+}
+
+int64_t ChannelBlocks(int64_t pChannels, int64_t pBlock)
+{
+  return (pChannels + pBlock - 1) / pBlock;
+}
+
+/// @return The dimensions of a N x C x D1 x ... x Dn tensor in NCHWc.
+Tensor::Dimensions BlockedDims(const Tensor::Dimensions& pDims, int64_t pBlock)
+{
+  Tensor::Dimensions dims(pDims);
+  dims[1] = ChannelBlocks(dims[1], pBlock);
+  dims.push_back(pBlock);
+  return dims;
+}
+
+/// Read the two values of a 2-D attribute, which are pDefault if pAttr is
+/// empty.
+/// @retval false If pAttr has neither zero nor two values.
+bool Get2D(const IntsAttr& pAttr, int64_t pDefault, int64_t pValues[2])
+{
+  if (pAttr.vector().empty()) {
+    pValues[0] = pValues[1] = pDefault;
+    return true;
+  }
+  if (2 != pAttr.vector().size())
+    return false;
+  pValues[0] = pAttr.at(0);
+  pValues[1] = pAttr.at(1);
+  return true;
+}
+
+/// Resolve the pads of a 2-D convolution or pooling from pX to pY, taking
+/// auto_pad into account.
+/// @param[out] pPads The pads, as [top, left, bottom, right].
+/// @retval false If the pads don't agree with the shapes.
+bool ResolvePads(const std::string& pAutoPad, const IntsAttr& pAttrPads,
+                 const Tensor& pX, const Tensor& pY, const int64_t pKernel[2],
+                 const int64_t pStrides[2], const int64_t pDilations[2],
+                 IntsAttr& pPads)
+{
+  pPads = IntsAttr(4, 0);
+  for (unsigned int i = 0; i < 2; ++i) {
+    int64_t in = pX.dimension(2 + i);
+    int64_t out = pY.dimension(2 + i);
+    int64_t window = (pKernel[i] - 1) * pDilations[i] + 1;
+    int64_t begin = 0, end = 0;
+    if ("SAME_UPPER" == pAutoPad || "SAME_LOWER" == pAutoPad) {
+      int64_t total =
+          std::max<int64_t>((out - 1) * pStrides[i] + window - in, 0);
+      begin = ("SAME_UPPER" == pAutoPad) ? total / 2 : (total + 1) / 2;
+      end = total - begin;
+    }
+    else if ("VALID" != pAutoPad && 4 == pAttrPads.vector().size()) {
+      begin = pAttrPads.at(i);
+      end = pAttrPads.at(2 + i);
+    }
+    else if ("VALID" != pAutoPad && !pAttrPads.vector().empty())
+      return false;
+
+    if (pStrides[i] <= 0 || in + begin + end < window ||
+        (in + begin + end - window) / pStrides[i] + 1 != out)
+      return false;
+    pPads.at(i) = begin;
+    pPads.at(2 + i) = end;
+  }
+  return true;
+}
+
+/// @retval true If pValue is a 4-D float tensor.
+bool IsFloat4D(const Value* pValue)
+{
+  return Value::kFloat == pValue->kind() &&
+         4 == static_cast<const Tensor*>(pValue)->getNumOfDimensions();
+}
+
+/// Copy the epilogue of pOp to pConv.
+void CopyEpilogue(const Conv& pOp, ConvNCHWc& pConv)
+{
+}
+
+void CopyEpilogue(const FusedConv& pOp, ConvNCHWc& pConv)
+{
+  pConv.setActivationAlpha(pOp.getActivationAlpha());
+  pConv.setActivationBeta(pOp.getActivationBeta());
+  pConv.setActivations(pOp.getActivations());
+}
+
+/** \class LayoutAssigner
+ *  \brief Assign the layout of the operators of one graph, in order.
+ *
+ *  A value is either in NCHW or in NCHWc. A blocked operator defines a new
+ *  NCHWc value and takes over all uses of its NCHW output, which loses its
+ *  define; an operator visited later and reading NCHW gets the NCHW value
+ *  back through a Reorder. So the original NCHW values of the graph outputs
+ *  stay what the outputs read.
+ */
+class LayoutAssigner
+{
+public:
+  LayoutAssigner(GraphEditor& pEditor, int64_t pBlock)
+    : m_Editor(pEditor), m_Block(pBlock), m_NumOfBlocked(0),
+      m_NumOfReorders(0) {
+  }
+
+  /// Assign the layout of pOp. It may be replaced.
+  void assign(ComputeOperator& pOp);
+
+  /// Erase the NCHW values nobody reads anymore.
+  void finish();
+
+  unsigned int getNumOfBlocked() const { return m_NumOfBlocked; }
+
+  unsigned int getNumOfReorders() const { return m_NumOfReorders; }
+
+private:
+  bool isBlocked(const Value* pValue) const {
+    return 0 != m_PlainOf.count(const_cast<Value*>(pValue));
+  }
+
+  /// @return The NCHW value of pValue, which has the shape of the model.
+  Tensor* plain(Tensor& pValue) {
+    return isBlocked(&pValue) ? static_cast<Tensor*>(m_PlainOf[&pValue])
+                              : &pValue;
+  }
+
+  /// @return The NCHWc form of pValue for pUser.
+  Value& toBlocked(Value& pValue, ComputeOperator& pUser);
+
+  /// @return The NCHW form of pValue for pUser.
+  Value& toPlain(Value& pValue, ComputeOperator& pUser);
+
+  /// Let pOp define a new NCHWc value in place of its NCHW output 0.
+  void blockOutput(ComputeOperator& pOp);
+
+  /// Let pOp read pInput in the NCHWc form.
+  void blockInput(ComputeOperator& pOp, unsigned int pInput);
+
+  /// Add a Reorder from pFrom to pTo before pUser.
+  void addReorder(Value& pFrom, Value& pTo, ComputeOperator& pUser);
+
+  template<typename ConvOp>
+  bool assignConv(ConvOp& pOp);
+
+  template<typename PoolOp>
+  bool assignPool(PoolOp& pOp, const std::string& pMode,
+                  int64_t pCountIncludePad);
+
+  bool assignBatchNormalization(BatchNormalization& pOp);
+
+  /// Run an element-wise operator on NCHWc if some input is in NCHWc and
+  /// all inputs and the output have the same shape.
+  bool assignElementwise(ComputeOperator& pOp);
+
+private:
+  GraphEditor& m_Editor;
+  int64_t m_Block;
+  unsigned int m_NumOfBlocked;
+  unsigned int m_NumOfReorders;
+
+  /// The NCHW value of every NCHWc value.
+  std::unordered_map<Value*, Value*> m_PlainOf;
+
+  /// The NCHWc value of every NCHW value which has one.
+  std::unordered_map<Value*, Value*> m_BlockedOf;
+};
+
+void LayoutAssigner::assign(ComputeOperator& pOp)
+{
+  bool blocked = false;
+  if (Conv* conv = dyn_cast<Conv>(&pOp))
+    blocked = assignConv(*conv);
+  else if (FusedConv* fused = dyn_cast<FusedConv>(&pOp))
+    blocked = assignConv(*fused);
+  else if (MaxPool* pool = dyn_cast<MaxPool>(&pOp))
+    blocked = (1 == pool->getNumOfOutputs()) &&
+              assignPool(*pool, "MAX", 0);
+  else if (AveragePool* pool = dyn_cast<AveragePool>(&pOp))
+    blocked = assignPool(*pool, "AVERAGE",
+                         pool->getCountIncludePad().value());
+  else if (BatchNormalization* norm = dyn_cast<BatchNormalization>(&pOp))
+    blocked = assignBatchNormalization(*norm);
+  else if (isa<Relu>(&pOp) || isa<FusedElementwise>(&pOp) || isa<Add>(&pOp))
+    blocked = assignElementwise(pOp);
+
+  if (blocked) {
+    ++m_NumOfBlocked;
+    return;
+  }
+
+  // Everything else reads NCHW.
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i) {
+    Value* input = pOp.getInput(i);
+    if (isBlocked(input))
+      m_Editor.replaceInput(pOp, i, toPlain(*input, pOp));
+  }
+}
+
+void LayoutAssigner::finish()
+{
+  for (std::pair<Value* const, Value*>& value : m_PlainOf) {
+    Value* output = value.second;
+    if (nullptr == output->getDefine() && output->getUses().empty())
+      m_Editor.graph().erase(*output);
+  }
+  m_PlainOf.clear();
+  m_BlockedOf.clear();
+}
+
+Value& LayoutAssigner::toBlocked(Value& pValue, ComputeOperator& pUser)
+{
+  if (isBlocked(&pValue))
+    return pValue;
+
+  std::unordered_map<Value*, Value*>::iterator blocked =
+      m_BlockedOf.find(&pValue);
+  if (m_BlockedOf.end() != blocked)
+    return *blocked->second;
+
+  Tensor& input = static_cast<Tensor&>(pValue);
+  FloatTensor* tensor = m_Editor.addValue(
+      input.getName(), BlockedDims(input.getDimensions(), m_Block));
+  addReorder(pValue, *tensor, pUser);
+  m_BlockedOf[&pValue] = tensor;
+  m_PlainOf[tensor] = &pValue;
+  return *tensor;
+}
+
+Value& LayoutAssigner::toPlain(Value& pValue, ComputeOperator& pUser)
+{
+  // The NCHW value of a blocked operator is defined once, by the Reorder
+  // before its first NCHW user.
+  Value* value = m_PlainOf[&pValue];
+  if (nullptr == value->getDefine()) {
+    addReorder(pValue, *value, pUser);
+    m_BlockedOf[value] = &pValue;
+  }
+  return *value;
+}
+
+void LayoutAssigner::blockOutput(ComputeOperator& pOp)
+{
+  Tensor* output = static_cast<Tensor*>(pOp.getOutput(0));
+  FloatTensor* tensor = m_Editor.addValue(
+      output->getName(), BlockedDims(output->getDimensions(), m_Block));
+  pOp.replaceOutput(0, *tensor);
+  m_PlainOf[tensor] = output;
+}
+
+void LayoutAssigner::blockInput(ComputeOperator& pOp, unsigned int pInput)
+{
+  Value* input = pOp.getInput(pInput);
+  m_Editor.replaceInput(pOp, pInput, toBlocked(*input, pOp));
+}
+
+void LayoutAssigner::addReorder(Value& pFrom, Value& pTo,
+                                ComputeOperator& pUser)
+{
+  Reorder* reorder = m_Editor.graph().addOperator<Reorder>();
+  reorder->addInput(pFrom);
+  reorder->addOutput(pTo);
+  m_Editor.insert(*reorder, pUser);
+  ++m_NumOfReorders;
+}
+
+template<typename ConvOp>
+bool LayoutAssigner::assignConv(ConvOp& pOp)
+{
+  Tensor* x = pOp.getX();
+  Tensor* y = pOp.getY();
+  Tensor* plainX = plain(*x);
+  const FloatTensor* w = GetWeight(pOp.getW());
+  bool hasBias = pOp.getNumOfInputs() > ConvOp::kB;
+  const FloatTensor* b = hasBias ? GetWeight(pOp.getB()) : nullptr;
+  if (!IsFloat4D(plainX) || !IsFloat4D(y) || nullptr == w ||
+      4 != w->getNumOfDimensions() || (hasBias && nullptr == b) ||
+      1 != pOp.getGroup().value() || plainX->dimension(1) != w->dimension(1))
+    return false;
+
+  // Blocking pads the channels up to a multiple of the block, and the
+  // padding is computed, too. Leave the convolutions of few channels, like
+  // the first one of an image network, to im2col.
+  int64_t numOfC = w->dimension(1);
+  int64_t numOfM = w->dimension(0);
+  int64_t numOfCb = ChannelBlocks(numOfC, m_Block);
+  int64_t numOfMb = ChannelBlocks(numOfM, m_Block);
+  if (numOfCb * m_Block > 2 * numOfC || numOfMb * m_Block > 2 * numOfM)
+    return false;
+
+  int64_t kernel[2] = { w->dimension(2), w->dimension(3) };
+  int64_t strides[2], dilations[2];
+  IntsAttr pads;
+  if (!Get2D(pOp.getStrides(), 1, strides) ||
+      !Get2D(pOp.getDilations(), 1, dilations) ||
+      !ResolvePads(pOp.getAutoPad().value(), pOp.getPads(), *plainX, *y,
+                   kernel, strides, dilations, pads))
+    return false;
+
+  // Leave the 3x3 convolutions which WinogradConv runs faster in NCHW, for
+  // X86SelectConvAlgorithm. They pay for a Reorder of a blocked input.
+  int64_t kernelSize = kernel[0] * kernel[1];
+  if (3 == kernel[0] && 3 == kernel[1] && 1 == strides[0] &&
+      1 == strides[1] && 1 == dilations[0] && 1 == dilations[1]) {
+    double winograd = 0;
+    int tile = x86::SelectWinogradTile(numOfC, numOfM, y->dimension(2),
+                                       y->dimension(3), winograd);
+    if (isBlocked(x))
+      winograd += x86::ReorderCost(GetNumOfElements(*plainX));
+    if (0 != tile && winograd < x86::NCHWcCost(numOfC, numOfM, kernelSize,
+                                               y->dimension(2),
+                                               y->dimension(3), m_Block))
+      return false;
+  }
+
+  std::vector<float> values(numOfMb * numOfCb * kernelSize * m_Block *
+                            m_Block);
+  ONNC_RUNTIME_internal_conv_weight_nchwc(numOfM, numOfC, kernelSize,
+                                          m_Block, w->data(), values.data());
+  FloatTensor* packed = m_Editor.addWeight(
+      w->getName(),
+      Tensor::Dimensions{ numOfMb, numOfCb, kernel[0], kernel[1], m_Block,
+                          m_Block },
+      values);
+
+  std::vector<Value*> inputs = { &toBlocked(*x, pOp), packed };
+  if (hasBias) {
+    std::vector<float> bias(b->getValues());
+    bias.resize(numOfMb * m_Block, 0.f);
+    inputs.push_back(m_Editor.addWeight(
+        b->getName(), Tensor::Dimensions{ numOfMb * m_Block }, bias));
+  }
+
+  ConvNCHWc* conv = m_Editor.graph().template addOperator<ConvNCHWc>();
+  conv->setDilations(IntsAttr::VectorType{ dilations[0], dilations[1] });
+  conv->setPads(pads);
+  conv->setStrides(IntsAttr::VectorType{ strides[0], strides[1] });
+  CopyEpilogue(pOp, *conv);
+  m_Editor.replace(pOp, *conv, inputs);
+  blockOutput(*conv);
+  return true;
+}
+
+template<typename PoolOp>
+bool LayoutAssigner::assignPool(PoolOp& pOp, const std::string& pMode,
+                                int64_t pCountIncludePad)
+{
+  Tensor* x = pOp.getX();
+  Tensor* y = pOp.getY();
+  if (!isBlocked(x) || !IsFloat4D(plain(*x)) || !IsFloat4D(y))
+    return false;
+
+  int64_t kernel[2], strides[2];
+  int64_t dilations[2] = { 1, 1 };
+  IntsAttr pads;
+  if (2 != pOp.getKernelShape().vector().size() ||
+      !Get2D(pOp.getKernelShape(), 1, kernel) ||
+      !Get2D(pOp.getStrides(), 1, strides) ||
+      !ResolvePads(pOp.getAutoPad().value(), pOp.getPads(), *plain(*x), *y,
+                   kernel, strides, dilations, pads))
+    return false;
+
+  PoolNCHWc* pool = m_Editor.graph().template addOperator<PoolNCHWc>();
+  pool->setCountIncludePad(IntAttr(pCountIncludePad));
+  pool->setKernelShape(IntsAttr::VectorType{ kernel[0], kernel[1] });
+  pool->setMode(StringAttr(pMode));
+  pool->setPads(pads);
+  pool->setStrides(IntsAttr::VectorType{ strides[0], strides[1] });
+  m_Editor.replace(pOp, *pool, std::vector<Value*>{ x });
+  blockOutput(*pool);
+  return true;
+}
+
+bool LayoutAssigner::assignBatchNormalization(BatchNormalization& pOp)
+{
+  Tensor* x = pOp.getX();
+  if (!isBlocked(x) || 1 != pOp.getNumOfOutputs())
+    return false;
+
+  // The statistics are per channel.
+  int64_t numOfC = plain(*x)->dimension(1);
+  for (unsigned int i = BatchNormalization::kScale; i < pOp.getNumOfInputs();
+       ++i) {
+    const Tensor* input = pOp.getInput(i);
+    if (Value::kFloat != input->kind() ||
+        1 != input->getNumOfDimensions() || numOfC != input->dimension(0))
+      return false;
+  }
+
+  BatchNormalizationNCHWc* norm =
+      m_Editor.graph().addOperator<BatchNormalizationNCHWc>();
+  norm->setEpsilon(pOp.getEpsilon());
+  std::vector<Value*> inputs;
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i)
+    inputs.push_back(pOp.getInput(i));
+  m_Editor.replace(pOp, *norm, inputs);
+  blockOutput(*norm);
+  return true;
+}
+
+bool LayoutAssigner::assignElementwise(ComputeOperator& pOp)
+{
+  if (1 != pOp.getNumOfOutputs() || !IsFloat4D(pOp.getOutput(0)))
+    return false;
+
+  // Padding channels stay finite: every activation maps 0 to a finite
+  // value and adds keep zeros.
+  const Tensor* y = static_cast<const Tensor*>(pOp.getOutput(0));
+  bool anyBlocked = false;
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i) {
+    Tensor* input = static_cast<Tensor*>(pOp.getInput(i));
+    if (Value::kFloat != input->kind() ||
+        plain(*input)->getDimensions() != y->getDimensions())
+      return false;
+    anyBlocked = anyBlocked || isBlocked(input);
+  }
+  if (!anyBlocked)
+    return false;
+
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i)
+    blockInput(pOp, i);
+  blockOutput(pOp);
+  return true;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// X86AssignLayout
+//===----------------------------------------------------------------------===//
+X86AssignLayout::X86AssignLayout(unsigned int pBlock)
+  : ModulePass(ID), m_Block(pBlock), m_NumOfBlocked(0), m_NumOfReorders(0) {
+}
+
+Pass::ReturnType X86AssignLayout::runOnModule(Module& pModule)
+{
+  m_NumOfBlocked = m_NumOfReorders = 0;
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+  return ret;
+}
+
+bool X86AssignLayout::runOnComputeGraph(ComputeGraph& pCG)
+{
+  GraphEditor editor(pCG, "nchwc");
+  LayoutAssigner assigner(editor, m_Block);
+
+  // Only the visited operator and weights get erased, and the Reorders are
+  // inserted in between, so walk the operators as they are now.
+  std::vector<ComputeOperator*> ops;
+  for (ComputeOperator* op : editor.operators()) {
+    if (!isa<Initializer>(op))
+      ops.push_back(op);
+  }
+  for (ComputeOperator* op : ops)
+    assigner.assign(*op);
+  assigner.finish();
+
+  m_NumOfBlocked += assigner.getNumOfBlocked();
+  m_NumOfReorders += assigner.getNumOfReorders();
+  if (0 == assigner.getNumOfBlocked())
+    return false;
+
+  editor.commit();
+  return true;
+}
+
+void X86AssignLayout::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== X86AssignLayout ===\n";
+  pOS << "NCHW" << m_Block << "c operators: " << m_NumOfBlocked
+      << ", reorders: " << m_NumOfReorders << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char X86AssignLayout::ID = 0;
+
+X86AssignLayout* onnc::CreateX86AssignLayoutPass(unsigned int pBlock)
+{
+  return new X86AssignLayout(pBlock);
+}
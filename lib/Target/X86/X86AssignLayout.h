@@ -0,0 +1,67 @@
+//===- X86AssignLayout.h --------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_ASSIGN_LAYOUT_H
+#define TARGET_X86_X86_ASSIGN_LAYOUT_H
+#include <onnc/Core/ModulePass.h>
+
+namespace onnc {
+
+class ComputeGraph;
+
+/** \class X86AssignLayout
+ *  \brief Run convolutions and the operators between them in the blocked
+ *         NCHWc layout of the ONNC Runtime.
+ *
+ *  A 2-D Conv or FusedConv with one group and loaded weights becomes a
+ *  ConvNCHWc unless blocking would more than double its channels, or the
+ *  cost model of X86ConvCost.h says WinogradConv runs it faster. Those
+ *  stay in NCHW for X86SelectConvAlgorithm. MaxPool,
+ *  AveragePool and BatchNormalization follow their input into NCHWc as
+ *  PoolNCHWc and BatchNormalizationNCHWc, while Relu, FusedElementwise and
+ *  Add keep running their element-wise kernels on the blocked tensors.
+ *  Every other operator, including the outputs of the graph, reads NCHW.
+ *
+ *  A Reorder is inserted where a value changes layout, once per value and
+ *  layout, so that a tensor going back to NCHW and into NCHWc again reuses
+ *  its blocked form instead of being reordered twice. The inputs and the
+ *  outputs of the graph keep their names and shapes.
+ */
+class X86AssignLayout : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  /// @param pBlock The channels of a block, 8 or 16.
+  explicit X86AssignLayout(unsigned int pBlock);
+
+  StringRef getPassName() const override { return "X86AssignLayout"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  unsigned int getNumOfBlockedOperators() const { return m_NumOfBlocked; }
+
+  unsigned int getNumOfReorders() const { return m_NumOfReorders; }
+
+private:
+  /// @retval true If pCG has been changed.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  unsigned int m_Block;
+  unsigned int m_NumOfBlocked;
+  unsigned int m_NumOfReorders;
+};
+
+X86AssignLayout* CreateX86AssignLayoutPass(unsigned int pBlock);
+
+} // namespace of onnc
+
+#endif
@@ -6,13 +6,21 @@
 //
 //===----------------------------------------------------------------------===//
 #include "X86Backend.h"
+#include "X86AssignLayout.h"
+#include "X86CodeEmit.h"
 #include "X86InplaceValueFusible.h"
+#include "X86NarrowWeights.h"
+#include "X86Quantize.h"
 #include "X86RemoveWeightFromLiveIntervals.h"
+#include "X86SelectConvAlgorithm.h"
+#include "X86WidenWeights.h"
 #include "TargetInfo/X86TargetInfo.h"
 #include "TargetInfo/X86TargetMemInfo.h"
 #include <onnc/CodeGen/FuseInplaceValue.h>
 #include <onnc/Target/TargetRegistry.h>
 #include <onnc/Target/TargetStandardPasses.h>
+#include <onnc/Transforms/ConstantFolding.h>
+#include <onnc/Transforms/FuseOperators.h>
 #include <onnc/Transforms/TensorSel/LowerRegistry.h>
 #include <onnc/Transforms/TensorSel/Standards/AbsLower.h>
 #include <onnc/Transforms/TensorSel/Standards/AcosLower.h>
@@ -26,7 +34,7 @@
 // TODO: #include <onnc/Transforms/TensorSel/Standards/ATenLower.h>
 #include <onnc/Transforms/TensorSel/Standards/AveragePoolLower.h>
 #include <onnc/Transforms/TensorSel/Standards/BatchNormalizationLower.h>
-// TODO: #include <onnc/Transforms/TensorSel/Standards/CastLower.h>
+#include <onnc/Transforms/TensorSel/Standards/CastLower.h>
 #include <onnc/Transforms/TensorSel/Standards/CeilLower.h>
 #include <onnc/Transforms/TensorSel/Standards/ClipLower.h>
 #include <onnc/Transforms/TensorSel/Standards/ConcatLower.h>
@@ -45,7 +53,7 @@
 // TODO: #include <onnc/Transforms/TensorSel/Standards/ExpandLower.h>
 #include <onnc/Transforms/TensorSel/Standards/FlattenLower.h>
 #include <onnc/Transforms/TensorSel/Standards/FloorLower.h>
-// TODO: #include <onnc/Transforms/TensorSel/Standards/GatherLower.h>
+#include <onnc/Transforms/TensorSel/Standards/GatherLower.h>
 #include <onnc/Transforms/TensorSel/Standards/GemmLower.h>
 // TODO: #include <onnc/Transforms/TensorSel/Standards/GivenTensorFillLower.h>
 #include <onnc/Transforms/TensorSel/Standards/GlobalAveragePoolLower.h>
@@ -150,13 +158,59 @@ void X86Backend::addTensorSel(PassManager& pPM)
   // X86 only uses the standard ONNC IR and standard Lower, so just use the
   // standard Tensor selection passes.
   addStandardTensorSel(pPM, *this);
+
+  // Only convolutions and matrix products read 16-bit float weights; every
+  // other kernel gets the float16 and bfloat16 weights of the model in
+  // float.
+  pPM.add(CreateX86WidenWeightsPass());
+
+  // Run weight-only subgraphs once here instead of on every inference. The
+  // weights they compute can then be folded into by the fusion below.
+  pPM.add(CreateConstantFoldingPass());
+
+  // Fold batch normalizations and biases into weights, and fuse activations
+  // into the operators before them. The interpreter runs the fused operators.
+  pPM.add(CreateFuseOperatorsPass());
+
+  // Run convolutions and matrix multiplications on int8 tensors where the
+  // calibration table knows the range of their values. The table names the
+  // values of the fused graph, so it goes right after fusion.
+  if (!options().getCalibrationTable().empty())
+    pPM.add(CreateX86QuantizePass(options().getCalibrationTable()));
+
+  // Run convolutions and the operators between them in the blocked NCHWc
+  // layout. The 3x3 convolutions Winograd runs faster by the shared cost
+  // model stay in NCHW, and the pass below picks their algorithm. The block
+  // is an option, not the vector width of the compiling host, so that
+  // compiled modules and cached allocations are the same on every host.
+  // Calibration records the values in the layout of the model.
+  if (!options().shouldCalibrate())
+    pPM.add(CreateX86AssignLayoutPass(options().getNCHWcBlock()));
+
+  // Run 3x3 convolutions with the Winograd algorithm where the cost model
+  // says it pays off. Weights are transformed here, at compile time.
+  pPM.add(CreateX86SelectConvAlgorithmPass());
+
+  // Store the float weights left in 16-bit floats. Winograd and the blocked
+  // layout have transformed their weights by now and keep them in float.
+  if (TargetOptions::kFloat16Weight == options().getWeightType())
+    pPM.add(CreateX86NarrowWeightsPass(Value::kFloat16));
+  else if (TargetOptions::kBFloat16Weight == options().getWeightType())
+    pPM.add(CreateX86NarrowWeightsPass(Value::kBFloat16));
+}
+
+void X86Backend::addTensorSched(PassManager& pPM)
+{
+  // Operators run one by one, so their order decides how much memory is
+  // live at the same time.
+  addStandardTensorSched(pPM, *this);
 }
 
 void X86Backend::addMemAlloc(PassManager& pPM)
 {
   // Fuse inplace value pairs before liveness analysis, because this pass may
   // delete values. ONNC IR graph topology may become invalid after this pass.
-  pPM.add(CreateFuseInplaceValuePass(x86::IsInplaceValueFusible));
+  pPM.add(CreateFuseInplaceValuePass(x86::GetInplaceValuePairs));
 
   // Input: Module
   // Output: LiveIntervals
@@ -177,7 +231,9 @@ void X86Backend::addMemAlloc(PassManager& pPM)
 
 void X86Backend::addCodeEmit(PassManager& pPM, const Path& pOutput)
 {
-  // TODO
+  // Input: MemOperands
+  // Output: C code calling ONNC Runtime (pOutput), weights (pOutput.weight)
+  pPM.add(CreateX86CodeEmitPass(pOutput));
 }
 
 void X86Backend::RegisterLowers(LowerRegistry& pRegistry) const
@@ -194,7 +250,7 @@ void X86Backend::RegisterLowers(LowerRegistry& pRegistry) const
   // TODO: pRegistry.emplace<ATenLower>();
   pRegistry.emplace<AveragePoolLower>();
   pRegistry.emplace<BatchNormalizationLower>();
-  // TODO: pRegistry.emplace<CastLower>();
+  pRegistry.emplace<CastLower>();
   pRegistry.emplace<CeilLower>();
   pRegistry.emplace<ClipLower>();
   pRegistry.emplace<ConcatLower>();
@@ -213,7 +269,7 @@ void X86Backend::RegisterLowers(LowerRegistry& pRegistry) const
   // TODO: pRegistry.emplace<ExpandLower>();
   pRegistry.emplace<FlattenLower>();
   pRegistry.emplace<FloorLower>();
-  // TODO: pRegistry.emplace<GatherLower>();
+  pRegistry.emplace<GatherLower>();
   pRegistry.emplace<GemmLower>();
   // TODO: pRegistry.emplace<GivenTensorFillLower>();
   pRegistry.emplace<GlobalAveragePoolLower>();
@@ -21,10 +21,14 @@ public:
 
   void addTensorSel(PassManager& pPM) override;
 
+  void addTensorSched(PassManager& pPM) override;
+
   void addMemAlloc(PassManager& pPM) override;
 
   void addCodeEmit(PassManager& pPM, const Path& pOutput) override;
 
+  bool canEmitCachedModule() const override { return true; }
+
   void RegisterLowers(LowerRegistry& pRegistry) const override;
 };
 
@@ -0,0 +1,405 @@
+//===- X86CodeEmit.cpp ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86CodeEmit.h"
+#include "X86CodeEmitVisitor.h"
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/ComputeMemOperand.h>
+#include <onnc/IR/Module.h>
+#include <onnc/Support/OFStream.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace onnc;
+
+namespace {
+
+/// Tensors in a tensor file start at multiples of this.
+const uint64_t kTensorAlignment = 64;
+
+uint64_t AlignUp(uint64_t pSize)
+{
+  return (pSize + kTensorAlignment - 1) / kTensorAlignment * kTensorAlignment;
+}
+
+/// Every tensor is float in ONNC Runtime.
+uint64_t SizeOf(const Tensor& pTensor)
+{
+  uint64_t size = sizeof(float);
+  for (unsigned int i = 0; i < pTensor.getNumOfDimensions(); ++i)
+    size *= pTensor.dimension(i);
+  return size;
+}
+
+/// Store the values of pTensor as pType in pBytes.
+template<typename Type, typename TensorType>
+void Convert(const Tensor& pTensor, std::vector<char>& pBytes)
+{
+  const TensorType& tensor = static_cast<const TensorType&>(pTensor);
+  std::vector<Type> values(tensor.data(),
+                           tensor.data() + tensor.getNumOfValues());
+  const char* bytes = reinterpret_cast<const char*>(values.data());
+  pBytes.assign(bytes, bytes + values.size() * sizeof(Type));
+}
+
+/// The C type of the pointer to pValue: quantized operators read and write
+/// int8 tensors, every other tensor is float.
+std::string PointerType(const Value& pValue)
+{
+  return (Value::kInt8 == pValue.kind()) ? "int8_t *" : "float *";
+}
+
+/// Describe the tensors of the model in the comments of the output.
+void PrintTensors(OStream& pOS, const char* pKind,
+                  const std::vector<Tensor*>& pTensors)
+{
+  for (size_t i = 0; i < pTensors.size(); ++i) {
+    pOS << " * " << pKind << ' ' << i << ": ";
+    if (nullptr == pTensors[i]) {
+      pOS << "(none)\n";
+      continue;
+    }
+    pOS << pTensors[i]->getName() << " [";
+    for (unsigned int d = 0; d < pTensors[i]->getNumOfDimensions(); ++d)
+      pOS << (0 == d ? "" : ", ") << pTensors[i]->dimension(d);
+    pOS << "]\n";
+  }
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// X86CodeEmit
+//===----------------------------------------------------------------------===//
+X86CodeEmit::X86CodeEmit(const Path& pOutput)
+  : ModulePass(ID), m_Output(pOutput) {
+}
+
+Pass::ReturnType X86CodeEmit::runOnModule(Module& pModule)
+{
+  // Addresses of values, as prepared by onni: weights come from the weight
+  // tensor file, inputs from the input tensor file, and everything else
+  // from the arena.
+  x86::CodeEmitVisitor::AddressTable addresses;
+  TensorList weights, inputs, outputs;
+  std::unordered_set<Value*> weight_values;
+  uint64_t arena_size = 0;
+  for (ComputeOperand* co : pModule.getComputeOperands()) {
+    ComputeMemOperand* mem = dyn_cast<ComputeMemOperand>(co);
+    if (nullptr == mem)
+      continue;
+    Value* v = co->getValue();
+    if (mem->isWeight())
+      weight_values.insert(v);
+    else if (!mem->isInput()) {
+      addresses[v] = "(" + PointerType(*v) + ")(onnc_memory + " +
+                     std::to_string(mem->start()) + ")";
+      arena_size = std::max(arena_size,
+                            static_cast<uint64_t>(mem->start()) +
+                                mem->length());
+    }
+  }
+
+  // Operands are not ordered, so weights are numbered in the order the
+  // operators use them to keep the weight file stable.
+  // Hack: there is no output ComputeOperand, so outputs are the inputs of
+  // OutputOperators.
+  for (ComputeOperator& cm : *pModule.getRootComputeGraph()) {
+    for (unsigned int i = 0; i < cm.getNumOfInputs(); ++i) {
+      Value* v = cm.getInput(i);
+      if (!weight_values.count(v) || addresses.count(v))
+        continue;
+      addresses[v] = "onnc_weight[" + std::to_string(weights.size()) + "]";
+      if (Value::kInt8 == v->kind())
+        addresses[v] = "(int8_t *)" + addresses[v];
+      else if (Value::kFloat16 == v->kind() || Value::kBFloat16 == v->kind())
+        addresses[v] = "(uint16_t *)" + addresses[v];
+      weights.push_back(static_cast<Tensor*>(v));
+    }
+    if (InputOperator* in = dyn_cast<InputOperator>(&cm)) {
+      Tensor* t = in->getTensor<Tensor>();
+      if (weight_values.count(t))
+        continue; // an initializer listed as a graph input
+      addresses[t] = "onnc_input[" + std::to_string(inputs.size()) + "]";
+      inputs.push_back(t);
+    } else if (OutputOperator* out = dyn_cast<OutputOperator>(&cm)) {
+      for (unsigned int i = 0; i < out->getNumOfInputs(); ++i)
+        outputs.push_back(static_cast<Tensor*>(out->getInput(i)));
+    }
+  }
+
+  Path weight_file(m_Output.native() + ".weight");
+  if (!WriteWeights(weight_file, weights)) {
+    errs() << "X86CodeEmit: can not write weights to " << weight_file
+           << std::endl;
+    return Pass::kPassFailure;
+  }
+
+  OFStream os(m_Output);
+  if (!os.is_open()) {
+    errs() << "X86CodeEmit: can not write " << m_Output << std::endl;
+    return Pass::kPassFailure;
+  }
+
+  os << "/*\n"
+     << " * Generated by ONNC for the x86 target.\n"
+     << " *\n"
+     << " * Weights: " << weight_file.filename() << " (" << weights.size()
+     << " tensors)\n";
+  PrintTensors(os, "Input", inputs);
+  PrintTensors(os, "Output", outputs);
+  os << " */\n"
+     << "#include <onnc/Runtime/onnc-runtime-internal.h>\n"
+     << "#include <math.h>\n"
+     << "#include <stddef.h>\n"
+     << "#include <stdint.h>\n"
+     << "#include <string.h>\n"
+     << "\n"
+     << "#define ONNC_MODEL_NUM_WEIGHTS " << weights.size() << '\n'
+     << "#define ONNC_MODEL_NUM_INPUTS " << inputs.size() << '\n'
+     << "#define ONNC_MODEL_NUM_OUTPUTS " << outputs.size() << '\n'
+     << "#define ONNC_MODEL_MEMORY_SIZE " << arena_size << '\n'
+     << "\n"
+     << "/* Sizes in bytes of inputs and outputs, for the drivers of the model. */\n"
+     << "const uint32_t onnc_num_inputs = ONNC_MODEL_NUM_INPUTS;\n"
+     << "const uint32_t onnc_num_outputs = ONNC_MODEL_NUM_OUTPUTS;\n"
+     << "const size_t onnc_input_size[] = {";
+  for (Tensor* t : inputs)
+    os << SizeOf(*t) << ", ";
+  os << "0};\n"
+     << "const size_t onnc_output_size[] = {";
+  for (Tensor* t : outputs)
+    os << SizeOf(*t) << ", ";
+  os << "0};\n"
+     << "\n"
+     << "/* Everything but weights and inputs, laid out by ONNC. */\n"
+     << "static char onnc_memory[ONNC_MODEL_MEMORY_SIZE + 1] "
+     << "__attribute__((aligned(" << kTensorAlignment << ")));\n"
+     << "\n"
+     << "void model_main(void *context)\n"
+     << "{\n"
+     << "  Context *runtime = (Context *)context;\n"
+     << "  (void)runtime;\n";
+  if (!weights.empty()) {
+    os << "  float *onnc_weight[ONNC_MODEL_NUM_WEIGHTS];\n"
+       << "  for (uint32_t i = 0; i < ONNC_MODEL_NUM_WEIGHTS; ++i)\n"
+       << "    onnc_weight[i] = (float *)ONNC_RUNTIME_load_from_tensor_table("
+       << "runtime->weight_context, i);\n";
+  }
+  if (!inputs.empty()) {
+    os << "  float *onnc_input[ONNC_MODEL_NUM_INPUTS];\n"
+       << "  for (uint32_t i = 0; i < ONNC_MODEL_NUM_INPUTS; ++i)\n"
+       << "    onnc_input[i] = (float *)ONNC_RUNTIME_load_from_tensor_table("
+       << "runtime->input_context, i);\n";
+  }
+  os << "\n";
+
+  x86::CodeEmitVisitor visitor(os, addresses);
+  for (ComputeOperator& cm : *pModule.getRootComputeGraph())
+    cm.accept(visitor);
+  if (!visitor.getUnsupported().empty()) {
+    for (const ComputeOperator* op : visitor.getUnsupported()) {
+      errs() << "X86CodeEmit: can not emit " << op->name().str();
+      if (0 < op->getNumOfOutputs())
+        errs() << ' ' << op->getOutput(0)->getName();
+      errs() << std::endl;
+    }
+    return Pass::kPassFailure;
+  }
+
+  if (!outputs.empty()) {
+    os << "\n"
+       << "  if (NULL == runtime->output_context)\n"
+       << "    return;\n";
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      x86::CodeEmitVisitor::AddressTable::const_iterator address =
+          addresses.find(outputs[i]);
+      if (addresses.end() == address)
+        continue;
+      os << "  memcpy(ONNC_RUNTIME_load_from_tensor_table("
+         << "runtime->output_context, " << i << "), " << address->second
+         << ", onnc_output_size[" << i << "]);\n";
+    }
+  }
+  os << "}\n";
+
+  emitDriver(os, inputs);
+  return Pass::kModuleNoChanged;
+}
+
+bool X86CodeEmit::WriteWeights(const Path& pFile, const TensorList& pWeights)
+{
+  // Data of the tensors, converted to float. Quantized weights stay int8
+  // and narrowed weights stay 16-bit.
+  std::vector<std::vector<char> > values(pWeights.size());
+  for (size_t i = 0; i < pWeights.size(); ++i) {
+    switch (pWeights[i]->kind()) {
+    case Value::kFloat:
+      Convert<float, FloatTensor>(*pWeights[i], values[i]);
+      break;
+    case Value::kInt64:
+      Convert<float, Int64Tensor>(*pWeights[i], values[i]);
+      break;
+    case Value::kInt32:
+      Convert<float, Int32Tensor>(*pWeights[i], values[i]);
+      break;
+    case Value::kInt8:
+      Convert<int8_t, Int8Tensor>(*pWeights[i], values[i]);
+      break;
+    case Value::kFloat16:
+      Convert<uint16_t, Float16Tensor>(*pWeights[i], values[i]);
+      break;
+    case Value::kBFloat16:
+      Convert<uint16_t, BFloat16Tensor>(*pWeights[i], values[i]);
+      break;
+    default:
+      errs() << "X86CodeEmit: unsupported type of weight "
+             << pWeights[i]->getName() << std::endl;
+      return false;
+    }
+  }
+
+  // struct ONNC_RUNTIME_Tensor_offset_table: the magic number, the number of
+  // tensors, then the offset and the size of every tensor. Offsets count
+  // from the beginning of the file.
+  std::vector<uint64_t> header(2 + 2 * pWeights.size(), 0);
+  memcpy(header.data(), ".TSR", 4); // ONNC_RUNTIME_TENSOR_FILE_MAGIC
+  header[1] = pWeights.size();
+  uint64_t offset = AlignUp(header.size() * sizeof(uint64_t));
+  for (size_t i = 0; i < pWeights.size(); ++i) {
+    header[2 + 2 * i] = offset;
+    header[3 + 2 * i] = values[i].size();
+    offset = AlignUp(offset + header[3 + 2 * i]);
+  }
+
+  OFStream os(pFile, std::ios_base::out | std::ios_base::trunc |
+                         std::ios_base::binary);
+  if (!os.is_open())
+    return false;
+
+  static const char padding[kTensorAlignment] = { 0 };
+  uint64_t written = header.size() * sizeof(uint64_t);
+  os.write(reinterpret_cast<const char*>(header.data()), written);
+  for (size_t i = 0; i < pWeights.size(); ++i) {
+    os.write(padding, header[2 + 2 * i] - written);
+    os.write(values[i].data(), header[3 + 2 * i]);
+    written = header[2 + 2 * i] + header[3 + 2 * i];
+  }
+  return !os.fail();
+}
+
+void X86CodeEmit::emitDriver(OStream& pOS, const TensorList& pInputs) const
+{
+  pOS << "\n"
+      << "#ifdef ONNC_MODEL_DRIVER\n"
+      << "#include <stdio.h>\n"
+      << "#include <stdlib.h>\n"
+      << "\n"
+      << "/* Read a whole file. */\n"
+      << "static void *onnc_read_file(const char *file, size_t *size)\n"
+      << "{\n"
+      << "  FILE *fp = fopen(file, \"rb\");\n"
+      << "  if (NULL == fp)\n"
+      << "    return NULL;\n"
+      << "  fseek(fp, 0, SEEK_END);\n"
+      << "  *size = (size_t)ftell(fp);\n"
+      << "  fseek(fp, 0, SEEK_SET);\n"
+      << "  void *data = malloc(*size + 1);\n"
+      << "  if (NULL != data && fread(data, 1, *size, fp) != *size) {\n"
+      << "    free(data);\n"
+      << "    data = NULL;\n"
+      << "  }\n"
+      << "  fclose(fp);\n"
+      << "  return data;\n"
+      << "}\n"
+      << "\n"
+      << "/* A zero filled tensor file of count tensors of the given sizes. */\n"
+      << "static void *onnc_tensor_table(size_t count, const size_t *sizes)\n"
+      << "{\n"
+      << "  size_t total = sizeof(TensorOffsetTable) + count * sizeof(TensorOffset);\n"
+      << "  for (size_t i = 0; i < count; ++i)\n"
+      << "    total += sizes[i];\n"
+      << "  TensorOffsetTable *table = (TensorOffsetTable *)calloc(1, total);\n"
+      << "  if (NULL == table)\n"
+      << "    return NULL;\n"
+      << "  memcpy(table->magic, ONNC_RUNTIME_TENSOR_FILE_MAGIC, 4);\n"
+      << "  table->number_of_tensors = count;\n"
+      << "  uint64_t offset = sizeof(TensorOffsetTable) + count * sizeof(TensorOffset);\n"
+      << "  for (size_t i = 0; i < count; ++i) {\n"
+      << "    table->tensor_offsets[i].offset = offset;\n"
+      << "    table->tensor_offsets[i].size = sizes[i];\n"
+      << "    offset += sizes[i];\n"
+      << "  }\n"
+      << "  return table;\n"
+      << "}\n"
+      << "\n"
+      << "/* usage: <program> <weight file> <input file>...\n"
+      << " * Input files hold raw floats. Every output is printed on a line. */\n"
+      << "int main(int argc, char *argv[])\n"
+      << "{\n"
+      << "  if (argc != 2 + ONNC_MODEL_NUM_INPUTS) {\n"
+      << "    fprintf(stderr, \"usage: %s <weight file>";
+  for (size_t i = 0; i < pInputs.size(); ++i)
+    pOS << " <input " << i << '>';
+  pOS << "\\n\", argv[0]);\n"
+      << "    return EXIT_FAILURE;\n"
+      << "  }\n"
+      << "\n"
+      << "  size_t size = 0;\n"
+      << "  void *weight = onnc_read_file(argv[1], &size);\n"
+      << "  if (NULL == weight) {\n"
+      << "    fprintf(stderr, \"can not read %s\\n\", argv[1]);\n"
+      << "    return EXIT_FAILURE;\n"
+      << "  }\n"
+      << "  void *input = onnc_tensor_table(ONNC_MODEL_NUM_INPUTS, onnc_input_size);\n"
+      << "  void *output = onnc_tensor_table(ONNC_MODEL_NUM_OUTPUTS, onnc_output_size);\n"
+      << "  for (uint32_t i = 0; i < ONNC_MODEL_NUM_INPUTS; ++i) {\n"
+      << "    void *data = onnc_read_file(argv[2 + i], &size);\n"
+      << "    if (NULL == data || onnc_input_size[i] != size) {\n"
+      << "      fprintf(stderr, \"%s should hold %zu bytes\\n\", argv[2 + i], onnc_input_size[i]);\n"
+      << "      return EXIT_FAILURE;\n"
+      << "    }\n"
+      << "    memcpy(ONNC_RUNTIME_load_from_tensor_table(input, i), data, size);\n"
+      << "    free(data);\n"
+      << "  }\n"
+      << "\n"
+      << "  Context *context = (Context *)ONNC_RUNTIME_init_runtime();\n"
+      << "  context->weight_context = weight;\n"
+      << "  context->input_context = input;\n"
+      << "  context->output_context = output;\n"
+      << "  model_main(context);\n"
+      << "\n"
+      << "  for (uint32_t i = 0; i < ONNC_MODEL_NUM_OUTPUTS; ++i) {\n"
+      << "    const float *data = (const float *)ONNC_RUNTIME_load_from_tensor_table(output, i);\n"
+      << "    for (size_t j = 0; j < onnc_output_size[i] / sizeof(float); ++j)\n"
+      << "      printf(\"%s%g\", (0 == j) ? \"\" : \" \", data[j]);\n"
+      << "    printf(\"\\n\");\n"
+      << "  }\n"
+      << "\n"
+      << "  ONNC_RUNTIME_shutdown_runtime(context);\n"
+      << "  free(output);\n"
+      << "  free(input);\n"
+      << "  free(weight);\n"
+      << "  return EXIT_SUCCESS;\n"
+      << "}\n"
+      << "#endif\n";
+}
+
+//===----------------------------------------------------------------------===//
+// X86CodeEmit Factory method
+//===----------------------------------------------------------------------===//
+char X86CodeEmit::ID = 0;
+
+X86CodeEmit* onnc::CreateX86CodeEmitPass(const Path& pOutput)
+{
+  return new X86CodeEmit(pOutput);
+}
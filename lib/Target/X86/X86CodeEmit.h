@@ -0,0 +1,69 @@
+//===- X86CodeEmit.h ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_CODE_EMIT_H
+#define TARGET_X86_X86_CODE_EMIT_H
+#include <onnc/Core/ModulePass.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Support/Path.h>
+#include <string>
+#include <vector>
+
+namespace onnc {
+
+class Tensor;
+
+/** \class X86CodeEmit
+ *  \brief Emit the model as a C translation unit calling ONNC Runtime.
+ *
+ *  The output file defines model_main(). Every operator becomes a call to
+ *  its ONNC_RUNTIME_*_float function with constant dimensions and
+ *  attributes. Values other than weights and inputs live at the offsets
+ *  the memory allocation passes gave them, in one static arena. Weights
+ *  are saved next to the output in a tensor file (<output>.weight), and
+ *  are found through Context::weight_context like the inputs are found
+ *  through Context::input_context. The pass fails on operators which can
+ *  not be written as a call, like Constant, whose value the IR does not keep.
+ *
+ *  The number and the sizes of inputs and outputs are exported as
+ *  onnc_num_inputs, onnc_input_size, onnc_num_outputs and onnc_output_size.
+ *  Compiled with ONNC_MODEL_DRIVER defined, the output file also has a
+ *  main() running the model on raw float input files, so no other code
+ *  than ONNC Runtime is needed to build an inference binary.
+ */
+class X86CodeEmit : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  explicit X86CodeEmit(const Path& pOutput);
+
+  ReturnType runOnModule(Module& pModule) override;
+
+  StringRef getPassName() const override { return "X86CodeEmit"; }
+
+private:
+  typedef std::vector<Tensor*> TensorList;
+
+  /// Write the values of pWeights in the tensor file pFile.
+  /// @retval false If a weight has no float representation or pFile can
+  ///               not be written.
+  static bool WriteWeights(const Path& pFile, const TensorList& pWeights);
+
+  /// Write the main() of ONNC_MODEL_DRIVER.
+  void emitDriver(OStream& pOS, const TensorList& pInputs) const;
+
+private:
+  Path m_Output;
+};
+
+X86CodeEmit* CreateX86CodeEmitPass(const Path& pOutput);
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,1699 @@
+//===- X86CodeEmitVisitor.cpp ---------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// This file is generated by scripts/runtime/code_generator.py. Visitors of
+// the ONNC operators, and of the ONNX operators listed in
+// CODE_EMIT_CUSTOM_OPERS, are written by hand in X86CodeEmitVisitorCustom.cpp.
+#include "X86CodeEmitVisitor.h"
+#include "X86RuntimeCall.h"
+
+#include <onnc/IR/Compute/Abs.h>
+#include <onnc/IR/Compute/Acos.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/And.h>
+#include <onnc/IR/Compute/ArgMax.h>
+#include <onnc/IR/Compute/ArgMin.h>
+#include <onnc/IR/Compute/Asin.h>
+#include <onnc/IR/Compute/Atan.h>
+#include <onnc/IR/Compute/AveragePool.h>
+#include <onnc/IR/Compute/BatchNormalization.h>
+#include <onnc/IR/Compute/Cast.h>
+#include <onnc/IR/Compute/Ceil.h>
+#include <onnc/IR/Compute/Clip.h>
+#include <onnc/IR/Compute/Concat.h>
+#include <onnc/IR/Compute/ConvTranspose.h>
+#include <onnc/IR/Compute/Cos.h>
+#include <onnc/IR/Compute/DepthToSpace.h>
+#include <onnc/IR/Compute/Div.h>
+#include <onnc/IR/Compute/Dropout.h>
+#include <onnc/IR/Compute/Elu.h>
+#include <onnc/IR/Compute/Equal.h>
+#include <onnc/IR/Compute/Exp.h>
+#include <onnc/IR/Compute/Expand.h>
+#include <onnc/IR/Compute/Flatten.h>
+#include <onnc/IR/Compute/Floor.h>
+#include <onnc/IR/Compute/GRU.h>
+#include <onnc/IR/Compute/Gather.h>
+#include <onnc/IR/Compute/GlobalAveragePool.h>
+#include <onnc/IR/Compute/GlobalLpPool.h>
+#include <onnc/IR/Compute/GlobalMaxPool.h>
+#include <onnc/IR/Compute/Greater.h>
+#include <onnc/IR/Compute/HardSigmoid.h>
+#include <onnc/IR/Compute/Hardmax.h>
+#include <onnc/IR/Compute/Identity.h>
+#include <onnc/IR/Compute/InstanceNormalization.h>
+#include <onnc/IR/Compute/LRN.h>
+#include <onnc/IR/Compute/LSTM.h>
+#include <onnc/IR/Compute/LeakyRelu.h>
+#include <onnc/IR/Compute/Less.h>
+#include <onnc/IR/Compute/Log.h>
+#include <onnc/IR/Compute/LogSoftmax.h>
+#include <onnc/IR/Compute/LpNormalization.h>
+#include <onnc/IR/Compute/LpPool.h>
+#include <onnc/IR/Compute/Max.h>
+#include <onnc/IR/Compute/MaxPool.h>
+#include <onnc/IR/Compute/MaxRoiPool.h>
+#include <onnc/IR/Compute/Mean.h>
+#include <onnc/IR/Compute/Min.h>
+#include <onnc/IR/Compute/Mul.h>
+#include <onnc/IR/Compute/Multinomial.h>
+#include <onnc/IR/Compute/Neg.h>
+#include <onnc/IR/Compute/Not.h>
+#include <onnc/IR/Compute/Or.h>
+#include <onnc/IR/Compute/PRelu.h>
+#include <onnc/IR/Compute/Pad.h>
+#include <onnc/IR/Compute/Pow.h>
+#include <onnc/IR/Compute/RNN.h>
+#include <onnc/IR/Compute/RandomNormal.h>
+#include <onnc/IR/Compute/RandomNormalLike.h>
+#include <onnc/IR/Compute/RandomUniform.h>
+#include <onnc/IR/Compute/RandomUniformLike.h>
+#include <onnc/IR/Compute/Reciprocal.h>
+#include <onnc/IR/Compute/ReduceL1.h>
+#include <onnc/IR/Compute/ReduceL2.h>
+#include <onnc/IR/Compute/ReduceLogSum.h>
+#include <onnc/IR/Compute/ReduceLogSumExp.h>
+#include <onnc/IR/Compute/ReduceMax.h>
+#include <onnc/IR/Compute/ReduceMean.h>
+#include <onnc/IR/Compute/ReduceMin.h>
+#include <onnc/IR/Compute/ReduceProd.h>
+#include <onnc/IR/Compute/ReduceSum.h>
+#include <onnc/IR/Compute/ReduceSumSquare.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/Reshape.h>
+#include <onnc/IR/Compute/Selu.h>
+#include <onnc/IR/Compute/Shape.h>
+#include <onnc/IR/Compute/Sigmoid.h>
+#include <onnc/IR/Compute/Sin.h>
+#include <onnc/IR/Compute/Size.h>
+#include <onnc/IR/Compute/Slice.h>
+#include <onnc/IR/Compute/Softmax.h>
+#include <onnc/IR/Compute/Softplus.h>
+#include <onnc/IR/Compute/Softsign.h>
+#include <onnc/IR/Compute/SpaceToDepth.h>
+#include <onnc/IR/Compute/Split.h>
+#include <onnc/IR/Compute/Sqrt.h>
+#include <onnc/IR/Compute/Squeeze.h>
+#include <onnc/IR/Compute/Sub.h>
+#include <onnc/IR/Compute/Sum.h>
+#include <onnc/IR/Compute/Tan.h>
+#include <onnc/IR/Compute/Tanh.h>
+#include <onnc/IR/Compute/Tile.h>
+#include <onnc/IR/Compute/TopK.h>
+#include <onnc/IR/Compute/Transpose.h>
+#include <onnc/IR/Compute/Unsqueeze.h>
+#include <onnc/IR/Compute/Upsample.h>
+#include <onnc/IR/Compute/Xor.h>
+#include <onnc/IR/Compute/ATen.h>
+#include <onnc/IR/Compute/Affine.h>
+#include <onnc/IR/Compute/ConstantFill.h>
+#include <onnc/IR/Compute/Crop.h>
+#include <onnc/IR/Compute/GRUUnit.h>
+#include <onnc/IR/Compute/GivenTensorFill.h>
+#include <onnc/IR/Compute/ImageScaler.h>
+#include <onnc/IR/Compute/MeanVarianceNormalization.h>
+#include <onnc/IR/Compute/ParametricSoftplus.h>
+#include <onnc/IR/Compute/Scale.h>
+#include <onnc/IR/Compute/ScaledTanh.h>
+#include <onnc/IR/Compute/ThresholdedRelu.h>
+
+using namespace onnc;
+using namespace onnc::x86;
+
+//===----------------------------------------------------------------------===//
+// CodeEmitVisitor
+//===----------------------------------------------------------------------===//
+CodeEmitVisitor::CodeEmitVisitor(OStream& pOS, const AddressTable& pAddresses)
+  : m_OS(pOS), m_Addresses(pAddresses), m_Unsupported() {
+}
+
+void CodeEmitVisitor::visit(Abs& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_abs_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Acos& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_acos_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Add& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_add_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(And& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_and_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ArgMax& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_argmax_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ArgMin& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_argmin_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Asin& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_asin_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Atan& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_atan_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(AveragePool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_averagepool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("auto_pad", pOp.getAutoPad());
+  call.attribute("count_include_pad", pOp.getCountIncludePad());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(BatchNormalization& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_batchnormalization_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_scale", pOp.getInput(1));
+  call.tensor("input_B", pOp.getInput(2));
+  call.tensor("input_mean", pOp.getInput(3));
+  call.tensor("input_var", pOp.getInput(4));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  call.tensor("output_mean", pOp.getNumOfOutputs() > 1 ? pOp.getOutput(1) : nullptr);
+  call.tensor("output_var", pOp.getNumOfOutputs() > 2 ? pOp.getOutput(2) : nullptr);
+  call.tensor("output_saved_mean", pOp.getNumOfOutputs() > 3 ? pOp.getOutput(3) : nullptr);
+  call.tensor("output_saved_var", pOp.getNumOfOutputs() > 4 ? pOp.getOutput(4) : nullptr);
+  // Attributes
+  call.attribute("epsilon", pOp.getEpsilon());
+  call.attribute("momentum", pOp.getMomentum());
+  call.attribute("spatial", pOp.getSpatial());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Cast& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_cast_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("to", pOp.getTo());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Ceil& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_ceil_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Clip& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_clip_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("max", pOp.getMax());
+  call.attribute("min", pOp.getMin());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Concat& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_concat_float");
+  // Inputs
+  call.tensors("input_inputs", RuntimeCall::Inputs(pOp, 0));
+  // Outputs
+  call.tensor("output_concat_result", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ConvTranspose& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_convtranspose_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_B", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("auto_pad", pOp.getAutoPad());
+  call.attribute("dilations", pOp.getDilations());
+  call.attribute("group", pOp.getGroup());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("output_padding", pOp.getOutputPadding());
+  call.attribute("output_shape", pOp.getOutputShape());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Cos& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_cos_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(DepthToSpace& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_depthtospace_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("blocksize", pOp.getBlocksize());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Div& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_div_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Dropout& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_dropout_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  call.tensor("output_mask", pOp.getNumOfOutputs() > 1 ? pOp.getOutput(1) : nullptr);
+  // Attributes
+  call.attribute("ratio", pOp.getRatio());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Elu& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_elu_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Equal& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_equal_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Exp& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_exp_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Expand& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_expand_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  call.tensor("input_shape", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Flatten& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_flatten_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Floor& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_floor_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(GRU& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_gru_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_R", pOp.getInput(2));
+  call.tensor("input_B", pOp.getNumOfInputs() > 3 ? pOp.getInput(3) : nullptr);
+  call.tensor("input_sequence_lens", pOp.getNumOfInputs() > 4 ? pOp.getInput(4) : nullptr);
+  call.tensor("input_initial_h", pOp.getNumOfInputs() > 5 ? pOp.getInput(5) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getNumOfOutputs() > 0 ? pOp.getOutput(0) : nullptr);
+  call.tensor("output_Y_h", pOp.getNumOfOutputs() > 1 ? pOp.getOutput(1) : nullptr);
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("clip", pOp.getClip());
+  call.attribute("direction", pOp.getDirection());
+  call.attribute("hidden_size", pOp.getHiddenSize());
+  call.attribute("linear_before_reset", pOp.getLinearBeforeReset());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Gather& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_gather_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  call.tensor("input_indices", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(GlobalAveragePool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_globalaveragepool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(GlobalLpPool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_globallppool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("p", pOp.getP());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(GlobalMaxPool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_globalmaxpool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Greater& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_greater_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(HardSigmoid& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_hardsigmoid_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Hardmax& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_hardmax_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Identity& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_identity_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(InstanceNormalization& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_instancenormalization_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  call.tensor("input_scale", pOp.getInput(1));
+  call.tensor("input_B", pOp.getInput(2));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("epsilon", pOp.getEpsilon());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(LRN& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_lrn_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+  call.attribute("bias", pOp.getBias());
+  call.attribute("size", pOp.getSize());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(LSTM& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_lstm_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_R", pOp.getInput(2));
+  call.tensor("input_B", pOp.getNumOfInputs() > 3 ? pOp.getInput(3) : nullptr);
+  call.tensor("input_sequence_lens", pOp.getNumOfInputs() > 4 ? pOp.getInput(4) : nullptr);
+  call.tensor("input_initial_h", pOp.getNumOfInputs() > 5 ? pOp.getInput(5) : nullptr);
+  call.tensor("input_initial_c", pOp.getNumOfInputs() > 6 ? pOp.getInput(6) : nullptr);
+  call.tensor("input_P", pOp.getNumOfInputs() > 7 ? pOp.getInput(7) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getNumOfOutputs() > 0 ? pOp.getOutput(0) : nullptr);
+  call.tensor("output_Y_h", pOp.getNumOfOutputs() > 1 ? pOp.getOutput(1) : nullptr);
+  call.tensor("output_Y_c", pOp.getNumOfOutputs() > 2 ? pOp.getOutput(2) : nullptr);
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("clip", pOp.getClip());
+  call.attribute("direction", pOp.getDirection());
+  call.attribute("hidden_size", pOp.getHiddenSize());
+  call.attribute("input_forget", pOp.getInputForget());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(LeakyRelu& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_leakyrelu_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Less& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_less_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Log& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_log_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(LogSoftmax& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_logsoftmax_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(LpNormalization& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_lpnormalization_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+  call.attribute("p", pOp.getP());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(LpPool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_lppool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("auto_pad", pOp.getAutoPad());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("p", pOp.getP());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Max& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_max_float");
+  // Inputs
+  call.tensors("input_data_0", RuntimeCall::Inputs(pOp, 0));
+  // Outputs
+  call.tensor("output_max", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(MaxPool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_maxpool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  call.tensor("output_Indices", pOp.getNumOfOutputs() > 1 ? pOp.getOutput(1) : nullptr);
+  // Attributes
+  call.attribute("auto_pad", pOp.getAutoPad());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("storage_order", pOp.getStorageOrder());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(MaxRoiPool& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_maxroipool_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_rois", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("pooled_shape", pOp.getPooledShape());
+  call.attribute("spatial_scale", pOp.getSpatialScale());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Mean& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_mean_float");
+  // Inputs
+  call.tensors("input_data_0", RuntimeCall::Inputs(pOp, 0));
+  // Outputs
+  call.tensor("output_mean", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Min& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_min_float");
+  // Inputs
+  call.tensors("input_data_0", RuntimeCall::Inputs(pOp, 0));
+  // Outputs
+  call.tensor("output_min", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Mul& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_mul_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Multinomial& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_multinomial_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dtype", pOp.getDtype());
+  call.attribute("sample_size", pOp.getSampleSize());
+  call.attribute("seed", pOp.getSeed());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Neg& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_neg_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Not& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_not_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Or& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_or_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(PRelu& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_prelu_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_slope", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Pad& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_pad_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("mode", pOp.getMode());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("value", pOp.getValue());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Pow& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_pow_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_Y", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_Z", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(RNN& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_rnn_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_R", pOp.getInput(2));
+  call.tensor("input_B", pOp.getNumOfInputs() > 3 ? pOp.getInput(3) : nullptr);
+  call.tensor("input_sequence_lens", pOp.getNumOfInputs() > 4 ? pOp.getInput(4) : nullptr);
+  call.tensor("input_initial_h", pOp.getNumOfInputs() > 5 ? pOp.getInput(5) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getNumOfOutputs() > 0 ? pOp.getOutput(0) : nullptr);
+  call.tensor("output_Y_h", pOp.getNumOfOutputs() > 1 ? pOp.getOutput(1) : nullptr);
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("clip", pOp.getClip());
+  call.attribute("direction", pOp.getDirection());
+  call.attribute("hidden_size", pOp.getHiddenSize());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(RandomNormal& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_randomnormal_float");
+  // Inputs
+  
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dtype", pOp.getDtype());
+  call.attribute("mean", pOp.getMean());
+  call.attribute("scale", pOp.getScale());
+  call.attribute("seed", pOp.getSeed());
+  call.attribute("shape", pOp.getShape());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(RandomNormalLike& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_randomnormallike_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dtype", pOp.getDtype());
+  call.attribute("mean", pOp.getMean());
+  call.attribute("scale", pOp.getScale());
+  call.attribute("seed", pOp.getSeed());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(RandomUniform& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_randomuniform_float");
+  // Inputs
+  
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dtype", pOp.getDtype());
+  call.attribute("high", pOp.getHigh());
+  call.attribute("low", pOp.getLow());
+  call.attribute("seed", pOp.getSeed());
+  call.attribute("shape", pOp.getShape());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(RandomUniformLike& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_randomuniformlike_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dtype", pOp.getDtype());
+  call.attribute("high", pOp.getHigh());
+  call.attribute("low", pOp.getLow());
+  call.attribute("seed", pOp.getSeed());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Reciprocal& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reciprocal_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceL1& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducel1_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceL2& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducel2_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceLogSum& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducelogsum_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceLogSumExp& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducelogsumexp_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceMax& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducemax_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceMean& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducemean_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceMin& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducemin_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceProd& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reduceprod_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceSum& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducesum_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ReduceSumSquare& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reducesumsquare_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_reduced", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("keepdims", pOp.getKeepdims());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Relu& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_relu_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Reshape& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reshape_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  call.tensor("input_shape", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_reshaped", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Selu& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_selu_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("gamma", pOp.getGamma());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Shape& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_shape_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_shape", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Sigmoid& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_sigmoid_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Sin& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_sin_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Size& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_size_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_size", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Slice& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_slice_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+  call.attribute("ends", pOp.getEnds());
+  call.attribute("starts", pOp.getStarts());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Softmax& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_softmax_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Softplus& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_softplus_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Softsign& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_softsign_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(SpaceToDepth& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_spacetodepth_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("blocksize", pOp.getBlocksize());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Split& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_split_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensors("output_outputs", RuntimeCall::Outputs(pOp, 0));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+  call.attribute("split", pOp.getSplit());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Sqrt& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_sqrt_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Squeeze& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_squeeze_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_squeezed", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Sub& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_sub_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Sum& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_sum_float");
+  // Inputs
+  call.tensors("input_data_0", RuntimeCall::Inputs(pOp, 0));
+  // Outputs
+  call.tensor("output_sum", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Tan& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_tan_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Tanh& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_tanh_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Tile& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_tile_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  call.tensor("input_repeats", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(TopK& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_topk_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Values", pOp.getOutput(0));
+  call.tensor("output_Indices", pOp.getOutput(1));
+  // Attributes
+  call.attribute("axis", pOp.getAxis());
+  call.attribute("k", pOp.getK());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Transpose& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_transpose_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_transposed", pOp.getOutput(0));
+  // Attributes
+  call.attribute("perm", pOp.getPerm());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Unsqueeze& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_unsqueeze_float");
+  // Inputs
+  call.tensor("input_data", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_expanded", pOp.getOutput(0));
+  // Attributes
+  call.attribute("axes", pOp.getAxes());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Upsample& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_upsample_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("mode", pOp.getMode());
+  call.attribute("scales", pOp.getScales());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Xor& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_xor_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_C", pOp.getOutput(0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ATen& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_aten_float");
+  // Inputs
+  call.tensors("input_input", RuntimeCall::Inputs(pOp, 0));
+  // Outputs
+  call.tensors("output_output", RuntimeCall::Outputs(pOp, 0));
+  // Attributes
+  
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Affine& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_affine_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ConstantFill& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_constantfill_float");
+  // Inputs
+  call.tensor("input_input", pOp.getNumOfInputs() > 0 ? pOp.getInput(0) : nullptr);
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dtype", pOp.getDtype());
+  call.attribute("extra_shape", pOp.getExtraShape());
+  call.attribute("input_as_shape", pOp.getInputAsShape());
+  call.attribute("shape", pOp.getShape());
+  call.attribute("value", pOp.getValue());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Crop& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_crop_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("border", pOp.getBorder());
+  call.attribute("scale", pOp.getScale());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(GRUUnit& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_gruunit_float");
+  // Inputs
+  call.tensor("input_hidden_prev", pOp.getInput(0));
+  call.tensor("input_gates", pOp.getInput(1));
+  call.tensor("input_seq_lengths", pOp.getInput(2));
+  call.tensor("input_t", pOp.getInput(3));
+  // Outputs
+  call.tensor("output_hidden", pOp.getOutput(0));
+  // Attributes
+  call.attribute("drop_states", pOp.getDropStates());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(GivenTensorFill& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_giventensorfill_float");
+  // Inputs
+  call.tensor("input_shape", pOp.getNumOfInputs() > 0 ? pOp.getInput(0) : nullptr);
+  // Outputs
+  call.tensor("output_X", pOp.getOutput(0));
+  // Attributes
+  call.attribute("extra_shape", pOp.getExtraShape());
+  call.attribute("input_as_shape", pOp.getInputAsShape());
+  call.attribute("shape", pOp.getShape());
+  call.attribute("values", pOp.getValues());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ImageScaler& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_imagescaler_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("bias", pOp.getBias());
+  call.attribute("scale", pOp.getScale());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(MeanVarianceNormalization& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_meanvariancenormalization_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("across_channels", pOp.getAcrossChannels());
+  call.attribute("normalize_variance", pOp.getNormalizeVariance());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ParametricSoftplus& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_parametricsoftplus_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(Scale& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_scale_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("scale", pOp.getScale());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ScaledTanh& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_scaledtanh_float");
+  // Inputs
+  call.tensor("input_input", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_output", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+
+  call.print(m_OS, pOp);
+}
+
+
+void CodeEmitVisitor::visit(ThresholdedRelu& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_thresholdedrelu_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+
+  call.print(m_OS, pOp);
+}
+
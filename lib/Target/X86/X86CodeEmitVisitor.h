@@ -0,0 +1,173 @@
+//===- X86CodeEmitVisitor.h -----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_CODE_EMIT_VISITOR_H
+#define TARGET_X86_X86_CODE_EMIT_VISITOR_H
+#include "X86RuntimeCall.h"
+#include <onnc/IR/ComputeVisitor.h>
+#include <onnc/Support/IOStream.h>
+#include <vector>
+
+namespace onnc {
+namespace x86 {
+
+/** \class CodeEmitVisitor
+ *  \brief Write the ONNC Runtime call of every visited operator as C code.
+ *
+ *  The counterpart of the interpreter of onni: instead of resolving the
+ *  call at run time, the addresses, dimensions and attributes become
+ *  constants of the generated code.
+ */
+class CodeEmitVisitor : public ComputeVisitor
+{
+public:
+  typedef RuntimeCall::AddressTable AddressTable;
+
+  typedef std::vector<const ComputeOperator*> OperatorList;
+
+public:
+  CodeEmitVisitor(OStream& pOS, const AddressTable& pAddresses);
+
+  /// @return The visited operators which could not be written as C code.
+  const OperatorList& getUnsupported() const { return m_Unsupported; }
+
+  void visit(Abs& pOp) override;
+  void visit(Acos& pOp) override;
+  void visit(Add& pOp) override;
+  void visit(And& pOp) override;
+  void visit(ArgMax& pOp) override;
+  void visit(ArgMin& pOp) override;
+  void visit(Asin& pOp) override;
+  void visit(Atan& pOp) override;
+  void visit(AveragePool& pOp) override;
+  void visit(BatchNormalization& pOp) override;
+  void visit(BatchNormalizationNCHWc& pOp) override;
+  void visit(Cast& pOp) override;
+  void visit(Ceil& pOp) override;
+  void visit(Clip& pOp) override;
+  void visit(Concat& pOp) override;
+  void visit(Constant& pOp) override;
+  void visit(Conv& pOp) override;
+  void visit(ConvNCHWc& pOp) override;
+  void visit(ConvTranspose& pOp) override;
+  void visit(Cos& pOp) override;
+  void visit(DepthToSpace& pOp) override;
+  void visit(Dequantize& pOp) override;
+  void visit(Div& pOp) override;
+  void visit(Dropout& pOp) override;
+  void visit(Elu& pOp) override;
+  void visit(Equal& pOp) override;
+  void visit(Exp& pOp) override;
+  void visit(Expand& pOp) override;
+  void visit(Flatten& pOp) override;
+  void visit(Floor& pOp) override;
+  void visit(FusedConv& pOp) override;
+  void visit(FusedElementwise& pOp) override;
+  void visit(FusedGemm& pOp) override;
+  void visit(GRU& pOp) override;
+  void visit(Gather& pOp) override;
+  void visit(Gemm& pOp) override;
+  void visit(GlobalAveragePool& pOp) override;
+  void visit(GlobalLpPool& pOp) override;
+  void visit(GlobalMaxPool& pOp) override;
+  void visit(Greater& pOp) override;
+  void visit(HardSigmoid& pOp) override;
+  void visit(Hardmax& pOp) override;
+  void visit(Identity& pOp) override;
+  void visit(InstanceNormalization& pOp) override;
+  void visit(Int8Conv& pOp) override;
+  void visit(Int8Gemm& pOp) override;
+  void visit(LRN& pOp) override;
+  void visit(LSTM& pOp) override;
+  void visit(LeakyRelu& pOp) override;
+  void visit(Less& pOp) override;
+  void visit(Log& pOp) override;
+  void visit(LogSoftmax& pOp) override;
+  void visit(LpNormalization& pOp) override;
+  void visit(LpPool& pOp) override;
+  void visit(MatMul& pOp) override;
+  void visit(Max& pOp) override;
+  void visit(MaxPool& pOp) override;
+  void visit(MaxRoiPool& pOp) override;
+  void visit(Mean& pOp) override;
+  void visit(Min& pOp) override;
+  void visit(Mul& pOp) override;
+  void visit(Multinomial& pOp) override;
+  void visit(Neg& pOp) override;
+  void visit(Not& pOp) override;
+  void visit(Or& pOp) override;
+  void visit(PRelu& pOp) override;
+  void visit(Pad& pOp) override;
+  void visit(PoolNCHWc& pOp) override;
+  void visit(Pow& pOp) override;
+  void visit(Quantize& pOp) override;
+  void visit(RNN& pOp) override;
+  void visit(RandomNormal& pOp) override;
+  void visit(RandomNormalLike& pOp) override;
+  void visit(RandomUniform& pOp) override;
+  void visit(RandomUniformLike& pOp) override;
+  void visit(Reciprocal& pOp) override;
+  void visit(ReduceL1& pOp) override;
+  void visit(ReduceL2& pOp) override;
+  void visit(ReduceLogSum& pOp) override;
+  void visit(ReduceLogSumExp& pOp) override;
+  void visit(ReduceMax& pOp) override;
+  void visit(ReduceMean& pOp) override;
+  void visit(ReduceMin& pOp) override;
+  void visit(ReduceProd& pOp) override;
+  void visit(ReduceSum& pOp) override;
+  void visit(ReduceSumSquare& pOp) override;
+  void visit(Relu& pOp) override;
+  void visit(Reorder& pOp) override;
+  void visit(Reshape& pOp) override;
+  void visit(Selu& pOp) override;
+  void visit(Shape& pOp) override;
+  void visit(Sigmoid& pOp) override;
+  void visit(Sin& pOp) override;
+  void visit(Size& pOp) override;
+  void visit(Slice& pOp) override;
+  void visit(Softmax& pOp) override;
+  void visit(Softplus& pOp) override;
+  void visit(Softsign& pOp) override;
+  void visit(SpaceToDepth& pOp) override;
+  void visit(Split& pOp) override;
+  void visit(Sqrt& pOp) override;
+  void visit(Squeeze& pOp) override;
+  void visit(Sub& pOp) override;
+  void visit(Sum& pOp) override;
+  void visit(Tan& pOp) override;
+  void visit(Tanh& pOp) override;
+  void visit(Tile& pOp) override;
+  void visit(TopK& pOp) override;
+  void visit(Transpose& pOp) override;
+  void visit(Unsqueeze& pOp) override;
+  void visit(Upsample& pOp) override;
+  void visit(WinogradConv& pOp) override;
+  void visit(Xor& pOp) override;
+  void visit(ATen& pOp) override;
+  void visit(Affine& pOp) override;
+  void visit(ConstantFill& pOp) override;
+  void visit(Crop& pOp) override;
+  void visit(GRUUnit& pOp) override;
+  void visit(GivenTensorFill& pOp) override;
+  void visit(ImageScaler& pOp) override;
+  void visit(MeanVarianceNormalization& pOp) override;
+  void visit(ParametricSoftplus& pOp) override;
+  void visit(Scale& pOp) override;
+  void visit(ScaledTanh& pOp) override;
+  void visit(ThresholdedRelu& pOp) override;
+
+private:
+  OStream& m_OS;
+  const AddressTable& m_Addresses;
+  OperatorList m_Unsupported;
+};
+
+} // namespace of x86
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,319 @@
+//===- X86CodeEmitVisitorCustom.cpp ---------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// CodeEmitVisitor visitors which code_generator.py does not generate: the
+// ONNC operators, which have no ONNX schema, and the ONNX operators listed in
+// CODE_EMIT_CUSTOM_OPERS.
+#include "X86CodeEmitVisitor.h"
+#include "X86RuntimeCall.h"
+#include <onnc/IR/Compute/BatchNormalizationNCHWc.h>
+#include <onnc/IR/Compute/Constant.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/ConvNCHWc.h>
+#include <onnc/IR/Compute/Dequantize.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Int8Conv.h>
+#include <onnc/IR/Compute/Int8Gemm.h>
+#include <onnc/IR/Compute/MatMul.h>
+#include <onnc/IR/Compute/PoolNCHWc.h>
+#include <onnc/IR/Compute/Quantize.h>
+#include <onnc/IR/Compute/Reorder.h>
+#include <onnc/IR/Compute/WinogradConv.h>
+
+using namespace onnc;
+using namespace onnc::x86;
+
+namespace {
+
+/// @retval true If pWeight is stored in 16-bit floats. Operators read such
+///         weights through the _mixed variants of their runtime functions,
+///         whose weight_type is the ONNX data type of the weight.
+bool IsNarrowWeight(const Value* pWeight)
+{
+  return Value::kFloat16 == pWeight->kind() ||
+         Value::kBFloat16 == pWeight->kind();
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// CodeEmitVisitor
+//===----------------------------------------------------------------------===//
+void CodeEmitVisitor::visit(BatchNormalizationNCHWc& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_batchnormalizationnchwc_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_scale", pOp.getInput(1));
+  call.tensor("input_B", pOp.getInput(2));
+  call.tensor("input_mean", pOp.getInput(3));
+  call.tensor("input_var", pOp.getInput(4));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("epsilon", pOp.getEpsilon());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Constant& pOp) {
+  // The tensor attribute of Constant keeps the shape of the value but not
+  // the values, so there is nothing to pass to ONNC_RUNTIME_constant_float.
+  m_Unsupported.push_back(&pOp);
+}
+
+void CodeEmitVisitor::visit(Conv& pOp) {
+  bool narrow = IsNarrowWeight(pOp.getInput(1));
+  RuntimeCall call(m_Addresses, narrow ? "ONNC_RUNTIME_conv_mixed"
+                                       : "ONNC_RUNTIME_conv_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_B", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("auto_pad", pOp.getAutoPad());
+  call.attribute("dilations", pOp.getDilations());
+  call.attribute("group", pOp.getGroup());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+  if (narrow)
+    call.attribute("weight_type", IntAttr(pOp.getInput(1)->kind()));
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(ConvNCHWc& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_convnchwc_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_B", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("dilations", pOp.getDilations());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Dequantize& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_dequantize_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("scale", pOp.getScale());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(FusedConv& pOp) {
+  bool narrow = IsNarrowWeight(pOp.getInput(1));
+  RuntimeCall call(m_Addresses, narrow ? "ONNC_RUNTIME_fusedconv_mixed"
+                                       : "ONNC_RUNTIME_fusedconv_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_B", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("auto_pad", pOp.getAutoPad());
+  call.attribute("dilations", pOp.getDilations());
+  call.attribute("group", pOp.getGroup());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+  if (narrow)
+    call.attribute("weight_type", IntAttr(pOp.getInput(1)->kind()));
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(FusedElementwise& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_fusedelementwise_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(FusedGemm& pOp) {
+  bool narrow = IsNarrowWeight(pOp.getInput(1));
+  RuntimeCall call(m_Addresses, narrow ? "ONNC_RUNTIME_fusedgemm_mixed"
+                                       : "ONNC_RUNTIME_fusedgemm_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  call.tensor("input_C", pOp.getInput(2));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+  call.attribute("transA", pOp.getTransA());
+  call.attribute("transB", pOp.getTransB());
+  if (narrow)
+    call.attribute("weight_type", IntAttr(pOp.getInput(1)->kind()));
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Gemm& pOp) {
+  bool narrow = IsNarrowWeight(pOp.getInput(1));
+  RuntimeCall call(m_Addresses, narrow ? "ONNC_RUNTIME_gemm_mixed"
+                                       : "ONNC_RUNTIME_gemm_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  call.tensor("input_C", pOp.getInput(2));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("alpha", pOp.getAlpha());
+  call.attribute("beta", pOp.getBeta());
+  call.attribute("transA", pOp.getTransA());
+  call.attribute("transB", pOp.getTransB());
+  if (narrow)
+    call.attribute("weight_type", IntAttr(pOp.getInput(1)->kind()));
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Int8Conv& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_int8conv_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_B", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("dilations", pOp.getDilations());
+  call.attribute("group", pOp.getGroup());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("output_scale", pOp.getOutputScale());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("relu", pOp.getRelu());
+  call.attribute("scales", pOp.getScales());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Int8Gemm& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_int8gemm_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  call.tensor("input_C", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("output_scale", pOp.getOutputScale());
+  call.attribute("relu", pOp.getRelu());
+  call.attribute("scales", pOp.getScales());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(MatMul& pOp) {
+  bool narrow = IsNarrowWeight(pOp.getInput(1));
+  RuntimeCall call(m_Addresses, narrow ? "ONNC_RUNTIME_matmul_mixed"
+                                       : "ONNC_RUNTIME_matmul_float");
+  // Inputs
+  call.tensor("input_A", pOp.getInput(0));
+  call.tensor("input_B", pOp.getInput(1));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  if (narrow)
+    call.attribute("weight_type", IntAttr(pOp.getInput(1)->kind()));
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(PoolNCHWc& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_poolnchwc_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("count_include_pad", pOp.getCountIncludePad());
+  call.attribute("kernel_shape", pOp.getKernelShape());
+  call.attribute("mode", pOp.getMode());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("strides", pOp.getStrides());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Quantize& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_quantize_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("scale", pOp.getScale());
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(Reorder& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_reorder_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+
+
+  call.print(m_OS, pOp);
+}
+
+void CodeEmitVisitor::visit(WinogradConv& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_winogradconv_float");
+  // Inputs
+  call.tensor("input_X", pOp.getInput(0));
+  call.tensor("input_W", pOp.getInput(1));
+  call.tensor("input_B", pOp.getNumOfInputs() > 2 ? pOp.getInput(2) : nullptr);
+  // Outputs
+  call.tensor("output_Y", pOp.getOutput(0));
+  // Attributes
+  call.attribute("activation_alpha", pOp.getActivationAlpha());
+  call.attribute("activation_beta", pOp.getActivationBeta());
+  call.attribute("activations", pOp.getActivations());
+  call.attribute("pads", pOp.getPads());
+  call.attribute("tile", pOp.getTile());
+
+  call.print(m_OS, pOp);
+}
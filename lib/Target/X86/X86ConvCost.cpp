@@ -0,0 +1,107 @@
+//===- X86ConvCost.cpp ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86ConvCost.h"
+#include <cmath>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/internal/sgemm.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+// Moving a float through memory and a scalar operation of the Winograd
+// transforms cost several micro-kernel operations. The constants are rough;
+// they only have to rank the algorithms of one convolution.
+const double kMemoryCost = 4.0;
+const double kTransformCost = 8.0;
+
+/// Operations of the input and output transforms of one tile in one channel.
+struct WinogradTransform
+{
+  int tile;
+  double input;
+  double output;
+};
+
+const WinogradTransform kWinograd[] = {
+  { 2,  64.0,  36.0 },
+  { 4, 264.0, 180.0 }
+};
+
+/// Estimated cost of C[M x N] = A[M x K] * B[K x N] by the runtime SGEMM. It
+/// computes C in blocks of full micro-kernel width, loads and stores C and
+/// packs B.
+double GemmCost(double pM, double pN, double pK)
+{
+  pN = std::ceil(pN / ONNC_RUNTIME_SGEMM_NR) * ONNC_RUNTIME_SGEMM_NR;
+  return 2.0 * pM * pN * pK + kMemoryCost * (4.0 * pM * pN + pK * pN);
+}
+
+/// Estimated cost of a 3x3 convolution by WinogradConv.
+double WinogradCost(const WinogradTransform& pTransform, double pC, double pM,
+                    double pOH, double pOW)
+{
+  double alpha2 = (pTransform.tile + 2) * (pTransform.tile + 2);
+  double tiles = std::ceil(pOH / pTransform.tile) *
+                 std::ceil(pOW / pTransform.tile);
+  // The transformed input and the products go through memory once each way.
+  return alpha2 * GemmCost(pM, tiles, pC) +
+         kTransformCost * tiles * (pC * pTransform.input +
+                                   pM * pTransform.output) +
+         kMemoryCost * 2.0 * alpha2 * tiles * (pC + pM);
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// Cost model
+//===----------------------------------------------------------------------===//
+double x86::Im2colCost(double pC, double pM, double pKernelSize, double pOH,
+                       double pOW)
+{
+  double pixels = pOH * pOW;
+  return GemmCost(pM, pixels, pKernelSize * pC) +
+         kMemoryCost * pKernelSize * pC * pixels;
+}
+
+double x86::NCHWcCost(double pC, double pM, double pKernelSize, double pOH,
+                      double pOW, double pBlock)
+{
+  // The kernel keeps a tile of the output in registers and computes the
+  // padding channels of the last blocks, too. The input and the output go
+  // through memory once.
+  double c = std::ceil(pC / pBlock) * pBlock;
+  double m = std::ceil(pM / pBlock) * pBlock;
+  double pixels = pOH * pOW;
+  return 2.0 * m * c * pKernelSize * pixels +
+         kMemoryCost * (c + m) * pixels;
+}
+
+double x86::ReorderCost(double pSize)
+{
+  return kMemoryCost * 2.0 * pSize;
+}
+
+int x86::SelectWinogradTile(double pC, double pM, double pOH, double pOW,
+                            double& pCost)
+{
+  pCost = Im2colCost(pC, pM, 9.0, pOH, pOW);
+  int tile = 0;
+  for (const WinogradTransform& transform : kWinograd) {
+    double cost = WinogradCost(transform, pC, pM, pOH, pOW);
+    if (cost < pCost) {
+      pCost = cost;
+      tile = transform.tile;
+    }
+  }
+  return tile;
+}
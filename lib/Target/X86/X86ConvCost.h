@@ -0,0 +1,41 @@
+//===- X86ConvCost.h ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_CONV_COST_H
+#define TARGET_X86_X86_CONV_COST_H
+
+namespace onnc {
+namespace x86 {
+
+// The cost model of the convolution kernels of the ONNC Runtime, shared by
+// X86AssignLayout and X86SelectConvAlgorithm so that the layout and the
+// algorithm of a convolution are picked by the same numbers. Costs are of
+// one image, in floating point operations of the GEMM micro-kernel.
+
+/// Estimated cost of a convolution of pC input and pM output channels by
+/// im2col and GEMM. The kernel has pKernelSize taps.
+double Im2colCost(double pC, double pM, double pKernelSize, double pOH,
+                  double pOW);
+
+/// Estimated cost of the same convolution by ConvNCHWc with pBlock channels
+/// in a block.
+double NCHWcCost(double pC, double pM, double pKernelSize, double pOH,
+                 double pOW, double pBlock);
+
+/// Estimated cost of a Reorder of pSize floats between NCHW and NCHWc.
+double ReorderCost(double pSize);
+
+/// Pick the Winograd algorithm of a 3x3 convolution with stride 1.
+/// @param[out] pCost The cost of the picked algorithm, or of im2col.
+/// @return The tile of the cheapest WinogradConv, or 0 if im2col is cheaper.
+int SelectWinogradTile(double pC, double pM, double pOH, double pOW,
+                       double& pCost);
+
+} // namespace x86
+} // namespace onnc
+
+#endif
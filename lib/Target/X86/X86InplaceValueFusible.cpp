@@ -6,7 +6,24 @@
 //
 //===----------------------------------------------------------------------===//
 #include "X86InplaceValueFusible.h"
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/BatchNormalization.h>
+#include <onnc/IR/Compute/BatchNormalizationNCHWc.h>
+#include <onnc/IR/Compute/Clip.h>
+#include <onnc/IR/Compute/Div.h>
+#include <onnc/IR/Compute/Dropout.h>
+#include <onnc/IR/Compute/Flatten.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/Identity.h>
+#include <onnc/IR/Compute/LeakyRelu.h>
+#include <onnc/IR/Compute/Mul.h>
 #include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/Reshape.h>
+#include <onnc/IR/Compute/Sigmoid.h>
+#include <onnc/IR/Compute/Squeeze.h>
+#include <onnc/IR/Compute/Sub.h>
+#include <onnc/IR/Compute/Tanh.h>
+#include <onnc/IR/Compute/Unsqueeze.h>
 
 using namespace onnc;
 
@@ -18,23 +35,73 @@ namespace {
 class InplaceValueFusible : public ComputeVisitor
 {
 public:
-  InplaceValueFusible()
-    : m_bFusible(false) {
+  InplaceValueFusible(FuseInplaceValue::InplacePairs& pPairs)
+    : m_Pairs(pPairs) {
   }
 
-  void visit(const Relu& pOp) { m_bFusible = true; }
+  // Unary element-wise kernels
+  void visit(const Relu& pOp) { addPair(0); }
 
-  bool isFusible() const { return m_bFusible; }
+  void visit(const Sigmoid& pOp) { addPair(0); }
+
+  void visit(const Tanh& pOp) { addPair(0); }
+
+  void visit(const Clip& pOp) { addPair(0); }
+
+  void visit(const LeakyRelu& pOp) { addPair(0); }
+
+  // Runs its activations on each block after copying it to Y.
+  void visit(const FusedElementwise& pOp) { addPair(0); }
+
+  // Only Y is written in inference mode, one channel at a time.
+  void visit(const BatchNormalization& pOp) {
+    if (1 == pOp.getNumOfOutputs())
+      addPair(0);
+  }
+
+  void visit(const BatchNormalizationNCHWc& pOp) { addPair(0); }
+
+  // Binary element-wise kernels. FuseInplaceValue takes the input which
+  // isn't broadcast.
+  void visit(const Add& pOp) { addPair(0); addPair(1); }
+
+  void visit(const Sub& pOp) { addPair(0); addPair(1); }
+
+  void visit(const Mul& pOp) { addPair(0); addPair(1); }
+
+  void visit(const Div& pOp) { addPair(0); addPair(1); }
+
+  // Views
+  void visit(const Identity& pOp) { addView(); }
+
+  void visit(const Dropout& pOp) { addView(); }
+
+  void visit(const Reshape& pOp) { addView(); }
+
+  void visit(const Flatten& pOp) { addView(); }
+
+  void visit(const Squeeze& pOp) { addView(); }
+
+  void visit(const Unsqueeze& pOp) { addView(); }
+
+private:
+  void addPair(unsigned int pInput) {
+    m_Pairs.push_back(FuseInplaceValue::InplacePair{pInput, 0, false});
+  }
+
+  void addView() {
+    m_Pairs.push_back(FuseInplaceValue::InplacePair{0, 0, true});
+  }
 
 private:
-  bool m_bFusible;
+  FuseInplaceValue::InplacePairs& m_Pairs;
 };
 
 } // anonymous namespace
 
-bool onnc::x86::IsInplaceValueFusible(const ComputeOperator& pOp)
+void onnc::x86::GetInplaceValuePairs(const ComputeOperator& pOp,
+                                     FuseInplaceValue::InplacePairs& pPairs)
 {
-  InplaceValueFusible fusible;
+  InplaceValueFusible fusible(pPairs);
   pOp.accept(fusible);
-  return fusible.isFusible();
 }
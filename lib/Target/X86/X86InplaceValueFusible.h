@@ -7,12 +7,18 @@
 //===----------------------------------------------------------------------===//
 #ifndef TARGET_X86_X86_INPLACE_VALUE_FUSIBLE_H_H
 #define TARGET_X86_X86_INPLACE_VALUE_FUSIBLE_H_H
+#include <onnc/CodeGen/FuseInplaceValue.h>
 #include <onnc/IR/ComputeOperator.h>
 
 namespace onnc {
 namespace x86 {
 
-bool IsInplaceValueFusible(const ComputeOperator& pOp);
+/// The input/output pairs of pOp whose runtime kernel may run in place.
+/// Element-wise kernels read element i before they write element i and
+/// touch no other element of the output; view kernels return at once when
+/// the output is the input.
+void GetInplaceValuePairs(const ComputeOperator& pOp,
+                          FuseInplaceValue::InplacePairs& pPairs);
 
 } // namespace x86
 } // namespace onnc
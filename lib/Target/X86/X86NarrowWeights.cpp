@@ -0,0 +1,174 @@
+//===- X86NarrowWeights.cpp -----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86NarrowWeights.h"
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/MatMul.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <unordered_map>
+#include <vector>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/internal/half.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// @return The float weight pValue if all its values are loaded, otherwise
+///         nullptr.
+const FloatTensor* GetWeight(const Value* pValue)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue->getDefine());
+  if (nullptr == define || !isa<Initializer>(define) ||
+      Value::kFloat != pValue->kind())
+    return nullptr;
+
+  const FloatTensor* tensor = static_cast<const FloatTensor*>(pValue);
+  size_t size = 1;
+  for (int64_t dim : tensor->getDimensions())
+    size *= dim;
+  if (size != tensor->getNumOfValues())
+    return nullptr;
+  return tensor;
+}
+
+/// Narrows the weights of one compute graph.
+class Narrower
+{
+public:
+  Narrower(ComputeGraph& pCG, Value::Type pType)
+    : m_Editor(pCG, "narrow"), m_Type(pType), m_SavedBytes(0) {
+  }
+
+  GraphEditor& editor() { return m_Editor; }
+
+  /// Narrow input pIdx of pOp if it is a float weight and the input pData
+  /// of pOp is float.
+  /// @retval true If pOp has been changed.
+  bool run(ComputeOperator& pOp, unsigned int pIdx, unsigned int pData)
+  {
+    if (pIdx >= pOp.getNumOfInputs() || pData >= pOp.getNumOfInputs() ||
+        Value::kFloat != pOp.getInput(pData)->kind())
+      return false;
+
+    const FloatTensor* weight = GetWeight(pOp.getInput(pIdx));
+    if (nullptr == weight)
+      return false;
+
+    Tensor*& narrow = m_Narrow[weight];
+    if (nullptr == narrow) {
+      std::vector<uint16_t> bits(weight->getNumOfValues());
+      const float* values = weight->data();
+      for (size_t i = 0; i < bits.size(); ++i) {
+        bits[i] = (Value::kBFloat16 == m_Type) ?
+                      ONNC_RUNTIME_internal_float_to_bfloat16(values[i]) :
+                      ONNC_RUNTIME_internal_float_to_half(values[i]);
+      }
+      narrow = m_Editor.addWeight(weight->getName(), weight->getDimensions(),
+                                  m_Type, bits);
+      m_SavedBytes += bits.size() * (sizeof(float) - sizeof(uint16_t));
+    }
+    // The float weight is erased once nobody reads it.
+    m_Editor.replaceInput(pOp, pIdx, *narrow);
+    return true;
+  }
+
+  unsigned int getNumOfWeights() const { return m_Narrow.size(); }
+
+  uint64_t getSavedBytes() const { return m_SavedBytes; }
+
+private:
+  GraphEditor m_Editor;
+  Value::Type m_Type;
+  std::unordered_map<const Value*, Tensor*> m_Narrow;
+  uint64_t m_SavedBytes;
+};
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// X86NarrowWeights
+//===----------------------------------------------------------------------===//
+X86NarrowWeights::X86NarrowWeights(Value::Type pType)
+  : ModulePass(ID), m_Type(pType), m_NumOfWeights(0), m_SavedBytes(0) {
+}
+
+Pass::ReturnType X86NarrowWeights::runOnModule(Module& pModule)
+{
+  m_NumOfWeights = 0;
+  m_SavedBytes = 0;
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+  return ret;
+}
+
+bool X86NarrowWeights::runOnComputeGraph(ComputeGraph& pCG)
+{
+  Narrower narrower(pCG, m_Type);
+  // Copy the operators; narrowing erases float weights, never operators.
+  std::vector<ComputeOperator*> ops = narrower.editor().operators();
+
+  bool changed = false;
+  for (ComputeOperator* op : ops) {
+    if (nullptr == op)
+      continue;
+    if (isa<Conv>(op))
+      changed |= narrower.run(*op, Conv::kW, Conv::kX);
+    else if (isa<FusedConv>(op))
+      changed |= narrower.run(*op, FusedConv::kW, FusedConv::kX);
+    else if (isa<Gemm>(op))
+      changed |= narrower.run(*op, Gemm::kB, Gemm::kA);
+    else if (isa<FusedGemm>(op))
+      changed |= narrower.run(*op, FusedGemm::kB, FusedGemm::kA);
+    else if (isa<MatMul>(op))
+      changed |= narrower.run(*op, MatMul::kB, MatMul::kA);
+  }
+
+  m_NumOfWeights += narrower.getNumOfWeights();
+  m_SavedBytes += narrower.getSavedBytes();
+  if (!changed)
+    return false;
+
+  narrower.editor().commit();
+  return true;
+}
+
+void X86NarrowWeights::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== X86NarrowWeights ===\n";
+  pOS << (Value::kBFloat16 == m_Type ? "bfloat16" : "float16")
+      << " weights: " << m_NumOfWeights << ", bytes saved: " << m_SavedBytes
+      << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char X86NarrowWeights::ID = 0;
+
+X86NarrowWeights* onnc::CreateX86NarrowWeightsPass(Value::Type pType)
+{
+  return new X86NarrowWeights(pType);
+}
@@ -0,0 +1,62 @@
+//===- X86NarrowWeights.h -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_NARROW_WEIGHTS_H
+#define TARGET_X86_X86_NARROW_WEIGHTS_H
+#include <onnc/Core/ModulePass.h>
+#include <onnc/IR/Compute/Value.h>
+
+namespace onnc {
+
+class ComputeGraph;
+
+/** \class X86NarrowWeights
+ *  \brief Store the float weights of convolutions and matrix products in
+ *         16-bit floats.
+ *
+ *  The loaded float W of a Conv or FusedConv and the loaded float B of a
+ *  Gemm, FusedGemm or MatMul are rounded to the nearest float16 or bfloat16
+ *  and replaced by a new weight of that type. The runtime kernels widen the
+ *  weights back to float while they pack them, so the arithmetic stays in
+ *  float and only memory and bandwidth shrink. A weight read by several
+ *  operators is narrowed once.
+ */
+class X86NarrowWeights : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  /// @param pType Value::kFloat16 or Value::kBFloat16.
+  explicit X86NarrowWeights(Value::Type pType);
+
+  StringRef getPassName() const override { return "X86NarrowWeights"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  unsigned int getNumOfNarrowWeights() const { return m_NumOfWeights; }
+
+  /// @return The number of bytes saved.
+  uint64_t getSavedBytes() const { return m_SavedBytes; }
+
+private:
+  /// @retval true If pCG has been changed.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  Value::Type m_Type;
+  unsigned int m_NumOfWeights;
+  uint64_t m_SavedBytes;
+};
+
+X86NarrowWeights* CreateX86NarrowWeightsPass(Value::Type pType);
+
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,591 @@
+//===- X86Quantize.cpp ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86Quantize.h"
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/Dequantize.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/Int8Conv.h>
+#include <onnc/IR/Compute/Int8Gemm.h>
+#include <onnc/IR/Compute/MatMul.h>
+#include <onnc/IR/Compute/Quantize.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/internal/qgemm.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// @return The float weight pValue if all its values are loaded, otherwise
+///         nullptr.
+const FloatTensor* GetWeight(const Value* pValue)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue->getDefine());
+  if (nullptr == define || !isa<Initializer>(define) ||
+      Value::kFloat != pValue->kind())
+    return nullptr;
+
+  const FloatTensor* tensor = static_cast<const FloatTensor*>(pValue);
+  size_t size = 1;
+  for (int64_t dim : tensor->getDimensions())
+    size *= dim;
+  if (size != tensor->getNumOfValues())
+    return nullptr;
+  return tensor;
+}
+
+/// Read the two values of a 2-D attribute, which are pDefault if pAttr is
+/// empty.
+/// @retval false If pAttr has neither zero nor two values.
+bool Get2D(const IntsAttr& pAttr, int64_t pDefault, int64_t pValues[2])
+{
+  if (pAttr.vector().empty()) {
+    pValues[0] = pValues[1] = pDefault;
+    return true;
+  }
+  if (2 != pAttr.vector().size())
+    return false;
+  pValues[0] = pAttr.at(0);
+  pValues[1] = pAttr.at(1);
+  return true;
+}
+
+/// Resolve the pads of a 2-D convolution from pX to pY, taking auto_pad
+/// into account.
+/// @param[out] pPads The pads, as [top, left, bottom, right].
+/// @retval false If the pads don't agree with the shapes.
+bool ResolvePads(const std::string& pAutoPad, const IntsAttr& pAttrPads,
+                 const Tensor& pX, const Tensor& pY, const int64_t pKernel[2],
+                 const int64_t pStrides[2], const int64_t pDilations[2],
+                 IntsAttr& pPads)
+{
+  pPads = IntsAttr(4, 0);
+  for (unsigned int i = 0; i < 2; ++i) {
+    int64_t in = pX.dimension(2 + i);
+    int64_t out = pY.dimension(2 + i);
+    int64_t window = (pKernel[i] - 1) * pDilations[i] + 1;
+    int64_t begin = 0, end = 0;
+    if ("SAME_UPPER" == pAutoPad || "SAME_LOWER" == pAutoPad) {
+      int64_t total =
+          std::max<int64_t>((out - 1) * pStrides[i] + window - in, 0);
+      begin = ("SAME_UPPER" == pAutoPad) ? total / 2 : (total + 1) / 2;
+      end = total - begin;
+    }
+    else if ("VALID" != pAutoPad && 4 == pAttrPads.vector().size()) {
+      begin = pAttrPads.at(i);
+      end = pAttrPads.at(2 + i);
+    }
+    else if ("VALID" != pAutoPad && !pAttrPads.vector().empty())
+      return false;
+
+    if (pStrides[i] <= 0 || in + begin + end < window ||
+        (in + begin + end - window) / pStrides[i] + 1 != out)
+      return false;
+    pPads.at(i) = begin;
+    pPads.at(2 + i) = end;
+  }
+  return true;
+}
+
+/// @retval true If pValue is a float tensor of pRank dimensions, or of at
+///         least 2 if pRank is 0.
+bool IsFloatTensor(const Value* pValue, unsigned int pRank)
+{
+  if (Value::kFloat != pValue->kind())
+    return false;
+  unsigned int rank = static_cast<const Tensor*>(pValue)->getNumOfDimensions();
+  return (0 == pRank) ? rank >= 2 : rank == pRank;
+}
+
+/// Read the epilogue of a fused operator.
+/// @param[out] pRelu Whether the epilogue is a Relu.
+/// @retval false If the epilogue is neither empty nor a Relu.
+bool GetRelu(const StringsAttr& pActivations, bool& pRelu)
+{
+  pRelu = (1 == pActivations.vector().size() &&
+           "Relu" == pActivations.at(0));
+  return pRelu || pActivations.vector().empty();
+}
+
+bool GetRelu(const Conv& pOp, bool& pRelu)
+{
+  pRelu = false;
+  return true;
+}
+
+bool GetRelu(const FusedConv& pOp, bool& pRelu)
+{
+  return GetRelu(pOp.getActivations(), pRelu);
+}
+
+bool GetRelu(const Gemm& pOp, bool& pRelu)
+{
+  pRelu = false;
+  return true;
+}
+
+bool GetRelu(const FusedGemm& pOp, bool& pRelu)
+{
+  return GetRelu(pOp.getActivations(), pRelu);
+}
+
+/// Quantize the rows of pValues, a pRows x pCols matrix, each with the scale
+/// of its largest magnitude.
+/// @param[out] pScales The scale of every row.
+std::vector<int8_t> QuantizeRows(const float* pValues, int64_t pRows,
+                                 int64_t pCols, std::vector<float>& pScales)
+{
+  std::vector<int8_t> values(pRows * pCols);
+  pScales.resize(pRows);
+  for (int64_t r = 0; r < pRows; ++r) {
+    const float* row = pValues + r * pCols;
+    float max = 0.f;
+    for (int64_t c = 0; c < pCols; ++c)
+      max = std::max(max, std::fabs(row[c]));
+
+    // A row of zeros keeps any scale.
+    float scale = (max > 0.f) ? max / 127.f : 1.f;
+    for (int64_t c = 0; c < pCols; ++c)
+      values[r * pCols + c] = ONNC_RUNTIME_internal_saturate_s8(row[c] / scale);
+    pScales[r] = scale;
+  }
+  return values;
+}
+
+/** \class Quantizer
+ *  \brief Quantize the operators of one graph, in order.
+ *
+ *  A quantized operator defines a new int8 value and takes over all uses of
+ *  its float output, which loses its define; an operator visited later and
+ *  reading float gets the float value back through a Dequantize. So the
+ *  original float values of the graph outputs stay what the outputs read.
+ */
+class Quantizer
+{
+public:
+  Quantizer(GraphEditor& pEditor, const CalibrationTable& pTable)
+    : m_Editor(pEditor), m_Table(pTable), m_NumOfQuantized(0),
+      m_NumOfConversions(0) {
+  }
+
+  /// Quantize pOp if possible. It may be replaced.
+  void quantize(ComputeOperator& pOp);
+
+  /// Erase the float values nobody reads anymore.
+  void finish();
+
+  unsigned int getNumOfQuantized() const { return m_NumOfQuantized; }
+
+  unsigned int getNumOfConversions() const { return m_NumOfConversions; }
+
+private:
+  bool isInt8(const Value* pValue) const {
+    return 0 != m_FloatOf.count(const_cast<Value*>(pValue));
+  }
+
+  /// @return The float value of pValue, which has the type of the model.
+  Tensor* toFloatValue(Tensor& pValue) {
+    return isInt8(&pValue) ? static_cast<Tensor*>(m_FloatOf[&pValue])
+                           : &pValue;
+  }
+
+  /// @return The scale of the float value pValue, or 0 if the table has no
+  ///         threshold of it.
+  float getScale(const Value& pValue) const {
+    return m_Table.getThreshold(pValue.getName()) / 127.f;
+  }
+
+  /// @return The int8 form of pValue for pUser.
+  Value& toInt8(Value& pValue, ComputeOperator& pUser);
+
+  /// @return The float form of pValue for pUser.
+  Value& toFloat(Value& pValue, ComputeOperator& pUser);
+
+  /// Let pOp define a new int8 value in place of its float output 0.
+  void quantizeOutput(ComputeOperator& pOp);
+
+  template<typename ConvOp>
+  bool quantizeConv(ConvOp& pOp);
+
+  template<typename GemmOp>
+  bool quantizeGemm(GemmOp& pOp);
+
+  bool quantizeMatMul(MatMul& pOp);
+
+  /// Replace pOp by an Int8Gemm of pA and the pN x pK weights pB.
+  /// @param pBias pN values, or empty if there is no bias.
+  void addInt8Gemm(ComputeOperator& pOp, Tensor& pA, const std::string& pName,
+                   const float* pB, int64_t pN, int64_t pK,
+                   const std::vector<float>& pBias, float pAlpha, bool pRelu);
+
+private:
+  GraphEditor& m_Editor;
+  const CalibrationTable& m_Table;
+  unsigned int m_NumOfQuantized;
+  unsigned int m_NumOfConversions;
+
+  /// The float value of every int8 value.
+  std::unordered_map<Value*, Value*> m_FloatOf;
+
+  /// The int8 value of every float value which has one.
+  std::unordered_map<Value*, Value*> m_Int8Of;
+
+  /// The scale of every int8 value.
+  std::unordered_map<Value*, float> m_Scales;
+};
+
+void Quantizer::quantize(ComputeOperator& pOp)
+{
+  bool quantized = false;
+  if (Conv* conv = dyn_cast<Conv>(&pOp))
+    quantized = quantizeConv(*conv);
+  else if (FusedConv* fused = dyn_cast<FusedConv>(&pOp))
+    quantized = quantizeConv(*fused);
+  else if (Gemm* gemm = dyn_cast<Gemm>(&pOp))
+    quantized = quantizeGemm(*gemm);
+  else if (FusedGemm* fused = dyn_cast<FusedGemm>(&pOp))
+    quantized = quantizeGemm(*fused);
+  else if (MatMul* matmul = dyn_cast<MatMul>(&pOp))
+    quantized = quantizeMatMul(*matmul);
+
+  if (quantized) {
+    ++m_NumOfQuantized;
+    return;
+  }
+
+  // Everything else reads float.
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i) {
+    Value* input = pOp.getInput(i);
+    if (isInt8(input))
+      m_Editor.replaceInput(pOp, i, toFloat(*input, pOp));
+  }
+}
+
+void Quantizer::finish()
+{
+  for (std::pair<Value* const, Value*>& value : m_FloatOf) {
+    Value* output = value.second;
+    if (nullptr == output->getDefine() && output->getUses().empty())
+      m_Editor.graph().erase(*output);
+  }
+  m_FloatOf.clear();
+  m_Int8Of.clear();
+  m_Scales.clear();
+}
+
+Value& Quantizer::toInt8(Value& pValue, ComputeOperator& pUser)
+{
+  if (isInt8(&pValue))
+    return pValue;
+
+  std::unordered_map<Value*, Value*>::iterator int8 = m_Int8Of.find(&pValue);
+  if (m_Int8Of.end() != int8)
+    return *int8->second;
+
+  Tensor& input = static_cast<Tensor&>(pValue);
+  Int8Tensor* tensor =
+      m_Editor.addInt8Value(input.getName(), input.getDimensions());
+  float scale = getScale(pValue);
+  Quantize* quantize = m_Editor.graph().addOperator<Quantize>();
+  quantize->setScale(FloatAttr(scale));
+  quantize->addInput(pValue);
+  quantize->addOutput(*tensor);
+  m_Editor.insert(*quantize, pUser);
+  ++m_NumOfConversions;
+
+  m_Int8Of[&pValue] = tensor;
+  m_FloatOf[tensor] = &pValue;
+  m_Scales[tensor] = scale;
+  return *tensor;
+}
+
+Value& Quantizer::toFloat(Value& pValue, ComputeOperator& pUser)
+{
+  // The float value of a quantized operator is defined once, by the
+  // Dequantize before its first float user.
+  Value* value = m_FloatOf[&pValue];
+  if (nullptr == value->getDefine()) {
+    Dequantize* dequantize = m_Editor.graph().addOperator<Dequantize>();
+    dequantize->setScale(FloatAttr(m_Scales[&pValue]));
+    dequantize->addInput(pValue);
+    dequantize->addOutput(*value);
+    m_Editor.insert(*dequantize, pUser);
+    ++m_NumOfConversions;
+  }
+  return *value;
+}
+
+void Quantizer::quantizeOutput(ComputeOperator& pOp)
+{
+  Tensor* output = static_cast<Tensor*>(pOp.getOutput(0));
+  Int8Tensor* tensor =
+      m_Editor.addInt8Value(output->getName(), output->getDimensions());
+  pOp.replaceOutput(0, *tensor);
+  m_FloatOf[tensor] = output;
+  m_Int8Of[output] = tensor;
+  m_Scales[tensor] = getScale(*output);
+}
+
+template<typename ConvOp>
+bool Quantizer::quantizeConv(ConvOp& pOp)
+{
+  Tensor* x = pOp.getX();
+  Tensor* y = pOp.getY();
+  Tensor* floatX = toFloatValue(*x);
+  const FloatTensor* w = GetWeight(pOp.getW());
+  bool hasBias = pOp.getNumOfInputs() > ConvOp::kB;
+  const FloatTensor* b = hasBias ? GetWeight(pOp.getB()) : nullptr;
+  bool relu = false;
+  if (!IsFloatTensor(floatX, 4) || !IsFloatTensor(y, 4) || nullptr == w ||
+      4 != w->getNumOfDimensions() || (hasBias && nullptr == b) ||
+      !GetRelu(pOp, relu))
+    return false;
+
+  int64_t group = pOp.getGroup().value();
+  int64_t numOfM = w->dimension(0);
+  if (group < 1 || 0 != numOfM % group ||
+      floatX->dimension(1) != w->dimension(1) * group ||
+      (hasBias && static_cast<size_t>(numOfM) != b->getNumOfValues()))
+    return false;
+
+  float inScale = getScale(*floatX);
+  float outScale = getScale(*y);
+  if (inScale <= 0.f || outScale <= 0.f)
+    return false;
+
+  int64_t kernel[2] = { w->dimension(2), w->dimension(3) };
+  int64_t strides[2], dilations[2];
+  IntsAttr pads;
+  if (!Get2D(pOp.getStrides(), 1, strides) ||
+      !Get2D(pOp.getDilations(), 1, dilations) ||
+      !ResolvePads(pOp.getAutoPad().value(), pOp.getPads(), *floatX, *y,
+                   kernel, strides, dilations, pads))
+    return false;
+
+  std::vector<float> weightScales;
+  std::vector<int8_t> values =
+      QuantizeRows(w->data(), numOfM, w->getNumOfValues() / numOfM,
+                   weightScales);
+  Int8Tensor* weight =
+      m_Editor.addWeight(w->getName(), w->getDimensions(), values);
+  FloatsAttr::VectorType scales(numOfM);
+  for (int64_t m = 0; m < numOfM; ++m)
+    scales[m] = inScale * weightScales[m];
+
+  std::vector<Value*> inputs = { &toInt8(*x, pOp), weight };
+  if (hasBias)
+    inputs.push_back(pOp.getB());
+
+  Int8Conv* conv = m_Editor.graph().template addOperator<Int8Conv>();
+  conv->setDilations(IntsAttr::VectorType{ dilations[0], dilations[1] });
+  conv->setGroup(IntAttr(group));
+  conv->setKernelShape(IntsAttr::VectorType{ kernel[0], kernel[1] });
+  conv->setOutputScale(FloatAttr(outScale));
+  conv->setPads(pads);
+  conv->setRelu(IntAttr(relu ? 1 : 0));
+  conv->setScales(scales);
+  conv->setStrides(IntsAttr::VectorType{ strides[0], strides[1] });
+  m_Editor.replace(pOp, *conv, inputs);
+  quantizeOutput(*conv);
+  return true;
+}
+
+template<typename GemmOp>
+bool Quantizer::quantizeGemm(GemmOp& pOp)
+{
+  Tensor* a = pOp.getA();
+  Tensor* y = pOp.getY();
+  Tensor* floatA = toFloatValue(*a);
+  const FloatTensor* b = GetWeight(pOp.getB());
+  bool hasC = pOp.getNumOfInputs() > GemmOp::kC;
+  const FloatTensor* c = hasC ? GetWeight(pOp.getC()) : nullptr;
+  bool relu = false;
+  if (!IsFloatTensor(floatA, 2) || !IsFloatTensor(y, 2) ||
+      0 != pOp.getTransA().value() || nullptr == b ||
+      2 != b->getNumOfDimensions() || (hasC && nullptr == c) ||
+      !GetRelu(pOp, relu) || getScale(*floatA) <= 0.f || getScale(*y) <= 0.f)
+    return false;
+
+  bool transB = 0 != pOp.getTransB().value();
+  int64_t numOfK = b->dimension(transB ? 1 : 0);
+  int64_t numOfN = b->dimension(transB ? 0 : 1);
+  if (floatA->dimension(1) != numOfK)
+    return false;
+
+  // The bias is per column: C is a scalar, [N] or [1, N].
+  std::vector<float> bias;
+  if (hasC) {
+    float beta = pOp.getBeta().value();
+    if (1 == c->getNumOfValues())
+      bias.assign(numOfN, beta * c->data()[0]);
+    else if (static_cast<size_t>(numOfN) == c->getNumOfValues() &&
+             numOfN == c->getDimensions().back()) {
+      bias.assign(c->data(), c->data() + numOfN);
+      for (float& value : bias)
+        value *= beta;
+    }
+    else
+      return false;
+  }
+
+  // The weights of a column are contiguous.
+  std::vector<float> values;
+  const float* weights = b->data();
+  if (!transB) {
+    values.resize(numOfN * numOfK);
+    for (int64_t k = 0; k < numOfK; ++k)
+      for (int64_t n = 0; n < numOfN; ++n)
+        values[n * numOfK + k] = weights[k * numOfN + n];
+    weights = values.data();
+  }
+
+  addInt8Gemm(pOp, *a, b->getName(), weights, numOfN, numOfK, bias,
+              pOp.getAlpha().value(), relu);
+  return true;
+}
+
+bool Quantizer::quantizeMatMul(MatMul& pOp)
+{
+  Tensor* a = pOp.getA();
+  Tensor* y = pOp.getY();
+  Tensor* floatA = toFloatValue(*a);
+  const FloatTensor* b = GetWeight(pOp.getB());
+  if (!IsFloatTensor(floatA, 0) || !IsFloatTensor(y, 0) || nullptr == b ||
+      2 != b->getNumOfDimensions() ||
+      floatA->getDimensions().back() != b->dimension(0) ||
+      getScale(*floatA) <= 0.f || getScale(*y) <= 0.f)
+    return false;
+
+  int64_t numOfK = b->dimension(0);
+  int64_t numOfN = b->dimension(1);
+  std::vector<float> values(numOfN * numOfK);
+  for (int64_t k = 0; k < numOfK; ++k)
+    for (int64_t n = 0; n < numOfN; ++n)
+      values[n * numOfK + k] = b->data()[k * numOfN + n];
+
+  addInt8Gemm(pOp, *a, b->getName(), values.data(), numOfN, numOfK,
+              std::vector<float>(), 1.f, false);
+  return true;
+}
+
+void Quantizer::addInt8Gemm(ComputeOperator& pOp, Tensor& pA,
+                            const std::string& pName, const float* pB,
+                            int64_t pN, int64_t pK,
+                            const std::vector<float>& pBias, float pAlpha,
+                            bool pRelu)
+{
+  float inScale = getScale(*toFloatValue(pA));
+  float outScale = getScale(*pOp.getOutput(0));
+
+  std::vector<float> weightScales;
+  std::vector<int8_t> values = QuantizeRows(pB, pN, pK, weightScales);
+  Int8Tensor* weight =
+      m_Editor.addWeight(pName, Tensor::Dimensions{ pN, pK }, values);
+  FloatsAttr::VectorType scales(pN);
+  for (int64_t n = 0; n < pN; ++n)
+    scales[n] = pAlpha * inScale * weightScales[n];
+
+  std::vector<Value*> inputs = { &toInt8(pA, pOp), weight };
+  if (!pBias.empty())
+    inputs.push_back(
+        m_Editor.addWeight(pName, Tensor::Dimensions{ pN }, pBias));
+
+  Int8Gemm* gemm = m_Editor.graph().addOperator<Int8Gemm>();
+  gemm->setOutputScale(FloatAttr(outScale));
+  gemm->setRelu(IntAttr(pRelu ? 1 : 0));
+  gemm->setScales(scales);
+  m_Editor.replace(pOp, *gemm, inputs);
+  quantizeOutput(*gemm);
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// X86Quantize
+//===----------------------------------------------------------------------===//
+X86Quantize::X86Quantize(const std::string& pTable)
+  : ModulePass(ID), m_TablePath(pTable), m_Table(), m_NumOfQuantized(0),
+    m_NumOfConversions(0) {
+}
+
+Pass::ReturnType X86Quantize::runOnModule(Module& pModule)
+{
+  m_NumOfQuantized = m_NumOfConversions = 0;
+  if (!m_Table.read(m_TablePath)) {
+    errs() << "X86Quantize: can not read calibration table " << m_TablePath
+           << std::endl;
+    return Pass::kPassFailure;
+  }
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+  return ret;
+}
+
+bool X86Quantize::runOnComputeGraph(ComputeGraph& pCG)
+{
+  GraphEditor editor(pCG, "int8_");
+  Quantizer quantizer(editor, m_Table);
+
+  // Only the visited operator and weights get erased, and the conversions
+  // are inserted in between, so walk the operators as they are now.
+  std::vector<ComputeOperator*> ops;
+  for (ComputeOperator* op : editor.operators()) {
+    if (!isa<Initializer>(op))
+      ops.push_back(op);
+  }
+  for (ComputeOperator* op : ops)
+    quantizer.quantize(*op);
+  quantizer.finish();
+
+  m_NumOfQuantized += quantizer.getNumOfQuantized();
+  m_NumOfConversions += quantizer.getNumOfConversions();
+  if (0 == quantizer.getNumOfQuantized())
+    return false;
+
+  editor.commit();
+  return true;
+}
+
+void X86Quantize::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== X86Quantize ===\n";
+  pOS << "int8 operators: " << m_NumOfQuantized
+      << ", conversions: " << m_NumOfConversions << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char X86Quantize::ID = 0;
+
+X86Quantize* onnc::CreateX86QuantizePass(const std::string& pTable)
+{
+  return new X86Quantize(pTable);
+}
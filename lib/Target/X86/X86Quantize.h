@@ -0,0 +1,67 @@
+//===- X86Quantize.h ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_QUANTIZE_H
+#define TARGET_X86_X86_QUANTIZE_H
+#include <onnc/Analysis/CalibrationTable.h>
+#include <onnc/Core/ModulePass.h>
+#include <string>
+
+namespace onnc {
+
+class ComputeGraph;
+
+/** \class X86Quantize
+ *  \brief Run convolutions and matrix multiplications on int8 tensors, as
+ *         a calibration table says.
+ *
+ *  A 2-D Conv or FusedConv, a Gemm or FusedGemm and a MatMul with loaded
+ *  float weights become an Int8Conv or an Int8Gemm if the table has the
+ *  thresholds of their input and their output, and their only activation,
+ *  if any, is Relu. Values are quantized symmetrically with the scale
+ *  threshold / 127, and weights with one scale per output channel. Biases
+ *  stay in float.
+ *
+ *  A Quantize or a Dequantize is inserted where a value changes type, once
+ *  per value, so consecutive int8 operators pass int8 tensors to each other.
+ *  The inputs and the outputs of the graph stay float.
+ */
+class X86Quantize : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  /// @param pTable The path of the calibration table.
+  explicit X86Quantize(const std::string& pTable);
+
+  StringRef getPassName() const override { return "X86Quantize"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  unsigned int getNumOfQuantizedOperators() const { return m_NumOfQuantized; }
+
+  unsigned int getNumOfConversions() const { return m_NumOfConversions; }
+
+private:
+  /// @retval true If pCG has been changed.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  std::string m_TablePath;
+  CalibrationTable m_Table;
+  unsigned int m_NumOfQuantized;
+  unsigned int m_NumOfConversions;
+};
+
+X86Quantize* CreateX86QuantizePass(const std::string& pTable);
+
+} // namespace of onnc
+
+#endif
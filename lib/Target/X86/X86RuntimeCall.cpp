@@ -0,0 +1,248 @@
+//===- X86RuntimeCall.cpp -------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86RuntimeCall.h"
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+using namespace onnc;
+using namespace onnc::x86;
+
+namespace {
+
+/// Attributes are narrowed to int32_t, as the interpreter does.
+std::string literal(int64_t pValue)
+{
+  int32_t value = static_cast<int32_t>(pValue);
+  if (INT32_MIN == value)
+    return "INT32_MIN";
+  return std::to_string(value);
+}
+
+std::string literal(double pValue)
+{
+  float value = static_cast<float>(pValue);
+  if (std::isnan(value))
+    return "NAN";
+  if (std::isinf(value))
+    return (value < 0) ? "-INFINITY" : "INFINITY";
+
+  // 9 significant digits round-trip every float.
+  std::ostringstream oss;
+  oss << std::setprecision(9) << value;
+  std::string result = oss.str();
+  if (std::string::npos == result.find_first_of(".e"))
+    result += ".0";
+  return result + "f";
+}
+
+std::string literal(const std::string& pValue)
+{
+  std::ostringstream oss;
+  oss << '"';
+  for (unsigned char c : pValue) {
+    if ('"' == c || '\\' == c)
+      oss << '\\' << c;
+    else if (c < 0x20 || c >= 0x7f)
+      oss << '\\' << std::oct << std::setw(3) << std::setfill('0')
+          << static_cast<int>(c) << std::dec;
+    else
+      oss << c;
+  }
+  oss << '"';
+  return oss.str();
+}
+
+/// Names end up in comments of the generated code.
+std::string comment(const std::string& pText)
+{
+  std::string result = pText;
+  size_t pos = 0;
+  while (std::string::npos != (pos = result.find("*/", pos)))
+    result.replace(pos, 2, "* /");
+  return result;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// RuntimeCall
+//===----------------------------------------------------------------------===//
+RuntimeCall::RuntimeCall(const AddressTable& pAddresses,
+                         const std::string& pFunction)
+  : m_Addresses(pAddresses), m_Function(pFunction),
+    m_Declarations(), m_Arguments() {
+}
+
+std::string RuntimeCall::address(const Value* pValue) const
+{
+  AddressTable::const_iterator address = m_Addresses.find(pValue);
+  if (m_Addresses.end() == address)
+    return "NULL";
+  return address->second;
+}
+
+void RuntimeCall::array(const std::string& pType, const std::string& pName,
+                        const std::vector<std::string>& pValues)
+{
+  std::string declaration = pType + ' ' + pName + "[] = {";
+  for (size_t i = 0; i < pValues.size(); ++i) {
+    if (0 != i)
+      declaration += ", ";
+    declaration += pValues[i];
+  }
+  m_Declarations.push_back(declaration + "};");
+}
+
+void RuntimeCall::dimensions(const std::string& pName, const Tensor& pTensor)
+{
+  std::vector<std::string> dims;
+  for (unsigned int i = 0; i < pTensor.getNumOfDimensions(); ++i)
+    dims.push_back(literal(static_cast<int64_t>(pTensor.dimension(i))));
+  array("static const int32_t", pName, dims);
+}
+
+void RuntimeCall::tensor(const std::string& pName, Tensor* pTensor)
+{
+  if (nullptr == pTensor) {
+    m_Arguments.push_back("NULL, 0, NULL");
+    return;
+  }
+  // Scalars have no dimensions to point at.
+  unsigned int ndim = pTensor->getNumOfDimensions();
+  if (0 == ndim) {
+    m_Arguments.push_back(address(pTensor) + ", 0, NULL");
+    return;
+  }
+  dimensions(pName + "_dims", *pTensor);
+  m_Arguments.push_back(address(pTensor) + ", " + std::to_string(ndim) +
+                        ", " + pName + "_dims");
+}
+
+void RuntimeCall::tensors(const std::string& pName, const TensorList& pTensors)
+{
+  if (pTensors.empty()) {
+    m_Arguments.push_back("NULL, 0, NULL, NULL");
+    return;
+  }
+
+  // Inputs are read only.
+  bool input = (0 == pName.compare(0, 5, "input"));
+  std::vector<std::string> addresses, ndims, dims;
+  for (size_t i = 0; i < pTensors.size(); ++i) {
+    std::string name = pName + "_dims_" + std::to_string(i);
+    addresses.push_back(address(pTensors[i]));
+    ndims.push_back(std::to_string(pTensors[i]->getNumOfDimensions()));
+    if (0 == pTensors[i]->getNumOfDimensions()) {
+      dims.push_back("NULL");
+      continue;
+    }
+    dimensions(name, *pTensors[i]);
+    dims.push_back(name);
+  }
+  array(input ? "const float *" : "float *", pName, addresses);
+  array("static const int32_t", pName + "_ndim", ndims);
+  array("static const int32_t * const", pName + "_dims", dims);
+  m_Arguments.push_back(pName + ", " + std::to_string(pTensors.size()) + ", " +
+                        pName + "_ndim, " + pName + "_dims");
+}
+
+void RuntimeCall::attribute(const std::string& pName, const FloatAttr& pAttr)
+{
+  m_Arguments.push_back(literal(pAttr.value()));
+}
+
+void RuntimeCall::attribute(const std::string& pName, const IntAttr& pAttr)
+{
+  m_Arguments.push_back(literal(pAttr.value()));
+}
+
+void RuntimeCall::attribute(const std::string& pName, const StringAttr& pAttr)
+{
+  m_Arguments.push_back(literal(pAttr.value()));
+}
+
+void RuntimeCall::attribute(const std::string& pName, const GraphAttr& pAttr)
+{
+  m_Arguments.push_back("NULL");
+}
+
+void RuntimeCall::attribute(const std::string& pName, const FloatsAttr& pAttr)
+{
+  if (pAttr.vector().empty()) {
+    m_Arguments.push_back("NULL, 0");
+    return;
+  }
+  std::vector<std::string> values;
+  for (double value : pAttr.vector())
+    values.push_back(literal(value));
+  array("static float", pName, values);
+  m_Arguments.push_back(pName + ", " + std::to_string(values.size()));
+}
+
+void RuntimeCall::attribute(const std::string& pName, const IntsAttr& pAttr)
+{
+  if (pAttr.vector().empty()) {
+    m_Arguments.push_back("NULL, 0");
+    return;
+  }
+  std::vector<std::string> values;
+  for (int64_t value : pAttr.vector())
+    values.push_back(literal(value));
+  array("static int32_t", pName, values);
+  m_Arguments.push_back(pName + ", " + std::to_string(values.size()));
+}
+
+void RuntimeCall::attribute(const std::string& pName,
+                            const StringsAttr& pAttr)
+{
+  if (pAttr.vector().empty()) {
+    m_Arguments.push_back("NULL, 0");
+    return;
+  }
+  std::vector<std::string> values;
+  for (const std::string& value : pAttr.vector())
+    values.push_back(literal(value));
+  array("static const char *", pName, values);
+  m_Arguments.push_back(pName + ", " + std::to_string(values.size()));
+}
+
+void RuntimeCall::print(OStream& pOS, const ComputeOperator& pOp) const
+{
+  pOS << "  /* " << pOp.name().str();
+  if (0 < pOp.getNumOfOutputs())
+    pOS << ' ' << comment(pOp.getOutput(0)->getName());
+  pOS << " */\n";
+  pOS << "  {\n";
+  for (const std::string& declaration : m_Declarations)
+    pOS << "    " << declaration << '\n';
+  pOS << "    " << m_Function << "(context";
+  for (const std::string& argument : m_Arguments)
+    pOS << "\n      , " << argument;
+  pOS << "\n    );\n";
+  pOS << "  }\n";
+}
+
+RuntimeCall::TensorList RuntimeCall::Inputs(ComputeOperator& pOp,
+                                            unsigned int pFirst)
+{
+  TensorList result;
+  for (unsigned int i = pFirst; i < pOp.getNumOfInputs(); ++i)
+    result.push_back(static_cast<Tensor*>(pOp.getInput(i)));
+  return result;
+}
+
+RuntimeCall::TensorList RuntimeCall::Outputs(ComputeOperator& pOp,
+                                             unsigned int pFirst)
+{
+  TensorList result;
+  for (unsigned int i = pFirst; i < pOp.getNumOfOutputs(); ++i)
+    result.push_back(static_cast<Tensor*>(pOp.getOutput(i)));
+  return result;
+}
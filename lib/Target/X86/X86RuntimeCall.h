@@ -0,0 +1,87 @@
+//===- X86RuntimeCall.h ---------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_RUNTIME_CALL_H
+#define TARGET_X86_X86_RUNTIME_CALL_H
+#include <onnc/IR/Compute/Attributes.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/ComputeOperator.h>
+#include <onnc/Support/IOStream.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace onnc {
+namespace x86 {
+
+/** \class RuntimeCall
+ *  \brief The C code of one call to an ONNC Runtime function.
+ *
+ *  Arguments are added in the order of the parameters of the function.
+ *  Every tensor becomes its address, its number of dimensions and a
+ *  constant array of its dimensions. Attributes become literals or
+ *  constant arrays. print() writes the call in a block of its own, so the
+ *  arrays are named after the parameters.
+ */
+class RuntimeCall
+{
+public:
+  /// The C expression of the address of every value.
+  typedef std::unordered_map<const Value*, std::string> AddressTable;
+
+  typedef std::vector<Tensor*> TensorList;
+
+public:
+  RuntimeCall(const AddressTable& pAddresses, const std::string& pFunction);
+
+  /// A tensor parameter. A missing optional tensor is nullptr.
+  void tensor(const std::string& pName, Tensor* pTensor);
+
+  /// A variadic tensor parameter.
+  void tensors(const std::string& pName, const TensorList& pTensors);
+
+  /// @name Attribute parameters
+  /// @{
+  void attribute(const std::string& pName, const FloatAttr& pAttr);
+  void attribute(const std::string& pName, const IntAttr& pAttr);
+  void attribute(const std::string& pName, const StringAttr& pAttr);
+  void attribute(const std::string& pName, const GraphAttr& pAttr);
+  void attribute(const std::string& pName, const FloatsAttr& pAttr);
+  void attribute(const std::string& pName, const IntsAttr& pAttr);
+  void attribute(const std::string& pName, const StringsAttr& pAttr);
+  /// @}
+
+  /// Write the call of pOp to pOS.
+  void print(OStream& pOS, const ComputeOperator& pOp) const;
+
+  /// @return The inputs of pOp from pFirst on.
+  static TensorList Inputs(ComputeOperator& pOp, unsigned int pFirst);
+
+  /// @return The outputs of pOp from pFirst on.
+  static TensorList Outputs(ComputeOperator& pOp, unsigned int pFirst);
+
+private:
+  std::string address(const Value* pValue) const;
+
+  /// Declare a static array of pType named pName holding pValues.
+  void array(const std::string& pType, const std::string& pName,
+             const std::vector<std::string>& pValues);
+
+  /// Declare the dimensions of pTensor as pName.
+  void dimensions(const std::string& pName, const Tensor& pTensor);
+
+private:
+  const AddressTable& m_Addresses;
+  std::string m_Function;
+  std::vector<std::string> m_Declarations;
+  std::vector<std::string> m_Arguments;
+};
+
+} // namespace of x86
+} // namespace of onnc
+
+#endif
@@ -0,0 +1,237 @@
+//===- X86SelectConvAlgorithm.cpp -----------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86SelectConvAlgorithm.h"
+#include "X86ConvCost.h"
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/Compute/WinogradConv.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/internal/winograd.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// @return The float weight pValue if all its values are loaded, otherwise
+///         nullptr.
+const FloatTensor* GetWeight(const Value* pValue)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue->getDefine());
+  if (nullptr == define || !isa<Initializer>(define) ||
+      Value::kFloat != pValue->kind())
+    return nullptr;
+
+  const FloatTensor* tensor = static_cast<const FloatTensor*>(pValue);
+  size_t size = 1;
+  for (int64_t dim : tensor->getDimensions())
+    size *= dim;
+  if (size != tensor->getNumOfValues())
+    return nullptr;
+  return tensor;
+}
+
+/// @retval true If every value of pAttr is pValue.
+bool AllEqual(const IntsAttr& pAttr, int64_t pValue)
+{
+  for (int64_t value : pAttr.vector()) {
+    if (pValue != value)
+      return false;
+  }
+  return true;
+}
+
+/// Resolve the pads of a 3x3, stride 1 convolution, taking auto_pad into
+/// account.
+/// @param[out] pPads The pads, as [top, left, bottom, right].
+/// @retval false If the pads don't agree with the shapes.
+template<typename ConvOp>
+bool ResolvePads(const ConvOp& pOp, IntsAttr& pPads)
+{
+  const std::string& autoPad = pOp.getAutoPad().value();
+  const IntsAttr& pads = pOp.getPads();
+  const Tensor* x = pOp.getX();
+  const Tensor* y = pOp.getY();
+  pPads = IntsAttr(4, 0);
+  for (unsigned int i = 0; i < 2; ++i) {
+    int64_t in = x->dimension(2 + i);
+    int64_t out = y->dimension(2 + i);
+    int64_t begin = 0, end = 0;
+    if ("SAME_UPPER" == autoPad || "SAME_LOWER" == autoPad) {
+      int64_t total = std::max<int64_t>(out + 2 - in, 0);
+      begin = ("SAME_UPPER" == autoPad) ? total / 2 : (total + 1) / 2;
+      end = total - begin;
+    }
+    else if ("VALID" != autoPad && 4 == pads.vector().size()) {
+      begin = pads.at(i);
+      end = pads.at(2 + i);
+    }
+    else if ("VALID" != autoPad && !pads.vector().empty())
+      return false;
+
+    if (in + begin + end - 2 != out)
+      return false;
+    pPads.at(i) = begin;
+    pPads.at(2 + i) = end;
+  }
+  return true;
+}
+
+/// @return The tile of the cheapest Winograd algorithm for pOp, or 0 if pOp
+///         can't run as WinogradConv or im2col is cheaper.
+template<typename ConvOp>
+int SelectTile(const ConvOp& pOp)
+{
+  const Tensor* x = pOp.getX();
+  const Tensor* w = pOp.getW();
+  const Tensor* y = pOp.getY();
+  if (4 != x->getNumOfDimensions() || 4 != w->getNumOfDimensions() ||
+      4 != y->getNumOfDimensions() || Value::kFloat != x->kind() ||
+      nullptr == GetWeight(w))
+    return 0;
+
+  if (3 != w->dimension(2) || 3 != w->dimension(3) ||
+      1 != pOp.getGroup().value() || !AllEqual(pOp.getStrides(), 1) ||
+      !AllEqual(pOp.getDilations(), 1) || !AllEqual(pOp.getKernelShape(), 3) ||
+      x->dimension(1) != w->dimension(1))
+    return 0;
+
+  double cost = 0;
+  return x86::SelectWinogradTile(w->dimension(1), w->dimension(0),
+                                 y->dimension(2), y->dimension(3), cost);
+}
+
+/// Copy the epilogue of pOp to pWinograd.
+void CopyEpilogue(const Conv& pOp, WinogradConv& pWinograd)
+{
+}
+
+void CopyEpilogue(const FusedConv& pOp, WinogradConv& pWinograd)
+{
+  pWinograd.setActivationAlpha(pOp.getActivationAlpha());
+  pWinograd.setActivationBeta(pOp.getActivationBeta());
+  pWinograd.setActivations(pOp.getActivations());
+}
+
+/// Replace pOp by a WinogradConv if it is cheaper.
+/// @return The tile of the WinogradConv, or 0 if pOp is kept.
+template<typename ConvOp>
+int SelectAlgorithm(GraphEditor& pEditor, ConvOp& pOp)
+{
+  IntsAttr pads;
+  int tile = SelectTile(pOp);
+  if (0 == tile || !ResolvePads(pOp, pads))
+    return 0;
+
+  // U[xi][m][c] = (G W[m][c] G^T)[xi]
+  const FloatTensor* w = GetWeight(pOp.getW());
+  int32_t numOfM = w->dimension(0);
+  int32_t numOfC = w->dimension(1);
+  int64_t alpha = ONNC_RUNTIME_WINOGRAD_ALPHA(tile);
+  std::vector<float> values(alpha * alpha * numOfM * numOfC);
+  ONNC_RUNTIME_internal_winograd_weight_float(tile, numOfM, numOfC, w->data(),
+                                              values.data());
+  FloatTensor* u = pEditor.addWeight(
+      w->getName(), Tensor::Dimensions{ alpha * alpha, numOfM, numOfC },
+      values);
+
+  std::vector<Value*> inputs = { pOp.getX(), u };
+  if (pOp.getNumOfInputs() > ConvOp::kB)
+    inputs.push_back(pOp.getB());
+  WinogradConv* winograd = pEditor.graph().template addOperator<WinogradConv>();
+  winograd->setPads(pads);
+  winograd->setTile(IntAttr(tile));
+  CopyEpilogue(pOp, *winograd);
+  pEditor.replace(pOp, *winograd, inputs);
+  return tile;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// X86SelectConvAlgorithm
+//===----------------------------------------------------------------------===//
+X86SelectConvAlgorithm::X86SelectConvAlgorithm()
+  : ModulePass(ID), m_NumOfWinograd2(0), m_NumOfWinograd4(0) {
+}
+
+Pass::ReturnType X86SelectConvAlgorithm::runOnModule(Module& pModule)
+{
+  m_NumOfWinograd2 = m_NumOfWinograd4 = 0;
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+  return ret;
+}
+
+bool X86SelectConvAlgorithm::runOnComputeGraph(ComputeGraph& pCG)
+{
+  GraphEditor editor(pCG, "winograd");
+  const std::vector<ComputeOperator*>& ops = editor.operators();
+
+  bool changed = false;
+  for (size_t i = 0; i < ops.size(); ++i) {
+    int tile = 0;
+    if (Conv* conv = dyn_cast_or_null<Conv>(ops[i]))
+      tile = SelectAlgorithm(editor, *conv);
+    else if (FusedConv* fused = dyn_cast_or_null<FusedConv>(ops[i]))
+      tile = SelectAlgorithm(editor, *fused);
+
+    if (2 == tile)
+      ++m_NumOfWinograd2;
+    else if (4 == tile)
+      ++m_NumOfWinograd4;
+    changed = changed || (0 != tile);
+  }
+
+  if (!changed)
+    return false;
+
+  editor.commit();
+  return true;
+}
+
+unsigned int X86SelectConvAlgorithm::getNumOfWinograd(unsigned int pTile) const
+{
+  return (2 == pTile) ? m_NumOfWinograd2 :
+         (4 == pTile) ? m_NumOfWinograd4 : 0;
+}
+
+void X86SelectConvAlgorithm::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== X86SelectConvAlgorithm ===\n";
+  pOS << "Winograd F(2x2, 3x3): " << m_NumOfWinograd2
+      << ", Winograd F(4x4, 3x3): " << m_NumOfWinograd4 << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char X86SelectConvAlgorithm::ID = 0;
+
+X86SelectConvAlgorithm* onnc::CreateX86SelectConvAlgorithmPass()
+{
+  return new X86SelectConvAlgorithm();
+}
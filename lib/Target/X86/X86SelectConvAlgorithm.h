@@ -0,0 +1,59 @@
+//===- X86SelectConvAlgorithm.h -------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_SELECT_CONV_ALGORITHM_H
+#define TARGET_X86_X86_SELECT_CONV_ALGORITHM_H
+#include <onnc/Core/ModulePass.h>
+
+namespace onnc {
+
+class ComputeGraph;
+
+/** \class X86SelectConvAlgorithm
+ *  \brief Pick the algorithm of every Conv and FusedConv by a cost model of
+ *         the ONNC Runtime kernels.
+ *
+ *  The runtime computes a convolution with im2col and GEMM, or with a direct
+ *  loop if it is depthwise. A 2-D, 3x3 convolution with stride 1, dilation 1
+ *  and one group may also run as WinogradConv with F(2x2, 3x3) or
+ *  F(4x4, 3x3). The pass estimates the cost of each algorithm from the
+ *  shapes, with the cost model X86AssignLayout picks the layout by, and
+ *  replaces the convolution if a Winograd algorithm is cheaper.
+ *  The weights of a replaced convolution are transformed here, once, and
+ *  saved as a new weight.
+ */
+class X86SelectConvAlgorithm : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  X86SelectConvAlgorithm();
+
+  StringRef getPassName() const override { return "X86SelectConvAlgorithm"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  /// @return The number of convolutions run with F(pTile x pTile, 3x3).
+  unsigned int getNumOfWinograd(unsigned int pTile) const;
+
+private:
+  /// @retval true If pCG has been changed.
+  bool runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  unsigned int m_NumOfWinograd2;
+  unsigned int m_NumOfWinograd4;
+};
+
+X86SelectConvAlgorithm* CreateX86SelectConvAlgorithmPass();
+
+} // namespace of onnc
+
+#endif
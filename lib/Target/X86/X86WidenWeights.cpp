@@ -0,0 +1,187 @@
+//===- X86WidenWeights.cpp ------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "X86WidenWeights.h"
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/MatMul.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <unordered_map>
+#include <vector>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/internal/half.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// @retval true If pValue is a float16 or bfloat16 weight.
+bool IsNarrowWeight(const Value* pValue)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue->getDefine());
+  return nullptr != define && isa<Initializer>(define) &&
+         (Value::kFloat16 == pValue->kind() ||
+          Value::kBFloat16 == pValue->kind());
+}
+
+/// @retval true If the runtime function of pOp reads input pIdx in 16-bit
+///         floats, as the code emitter and the interpreter call it.
+bool ReadsNarrow(const ComputeOperator& pOp, unsigned int pIdx)
+{
+  if (isa<Conv>(&pOp))
+    return Conv::kW == pIdx;
+  if (isa<FusedConv>(&pOp))
+    return FusedConv::kW == pIdx;
+  if (isa<Gemm>(&pOp))
+    return Gemm::kB == pIdx;
+  if (isa<FusedGemm>(&pOp))
+    return FusedGemm::kB == pIdx;
+  if (isa<MatMul>(&pOp))
+    return MatMul::kB == pIdx;
+  return false;
+}
+
+/// Convert the values of pWeight to floats with pConvert.
+/// @retval false If the values aren't loaded.
+template<typename TensorType>
+bool Widen(const Tensor& pWeight, float (*pConvert)(uint16_t),
+           std::vector<float>& pValues)
+{
+  const TensorType& tensor = static_cast<const TensorType&>(pWeight);
+  size_t size = 1;
+  for (int64_t dim : tensor.getDimensions())
+    size *= dim;
+  if (size != tensor.getNumOfValues())
+    return false;
+
+  pValues.resize(size);
+  const uint16_t* bits = tensor.data();
+  for (size_t i = 0; i < size; ++i)
+    pValues[i] = pConvert(bits[i]);
+  return true;
+}
+
+/// Widens the weights of one compute graph.
+class Widener
+{
+public:
+  Widener(ComputeGraph& pCG) : m_Editor(pCG, "widen") { }
+
+  GraphEditor& editor() { return m_Editor; }
+
+  /// Let input pIdx of pOp, a 16-bit weight, read a float copy.
+  /// @retval false If the values of the weight aren't loaded.
+  bool run(ComputeOperator& pOp, unsigned int pIdx)
+  {
+    const Tensor* weight = static_cast<const Tensor*>(pOp.getInput(pIdx));
+    FloatTensor*& wide = m_Wide[weight];
+    if (nullptr == wide) {
+      std::vector<float> values;
+      bool loaded = (Value::kBFloat16 == weight->kind()) ?
+          Widen<BFloat16Tensor>(*weight,
+                                ONNC_RUNTIME_internal_bfloat16_to_float,
+                                values) :
+          Widen<Float16Tensor>(*weight, ONNC_RUNTIME_internal_half_to_float,
+                               values);
+      if (!loaded)
+        return false;
+      wide = m_Editor.addWeight(weight->getName(), weight->getDimensions(),
+                                values);
+    }
+    // The 16-bit weight is erased once nobody reads it.
+    m_Editor.replaceInput(pOp, pIdx, *wide);
+    return true;
+  }
+
+  unsigned int getNumOfWeights() const { return m_Wide.size(); }
+
+private:
+  GraphEditor m_Editor;
+  std::unordered_map<const Value*, FloatTensor*> m_Wide;
+};
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// X86WidenWeights
+//===----------------------------------------------------------------------===//
+X86WidenWeights::X86WidenWeights()
+  : ModulePass(ID), m_NumOfWeights(0) {
+}
+
+Pass::ReturnType X86WidenWeights::runOnModule(Module& pModule)
+{
+  m_NumOfWeights = 0;
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    ret |= runOnComputeGraph(*cg->value());
+    if (Pass::kPassFailure & ret)
+      return ret;
+  }
+  return ret;
+}
+
+Pass::ReturnType X86WidenWeights::runOnComputeGraph(ComputeGraph& pCG)
+{
+  Widener widener(pCG);
+  // Copy the operators; widening erases 16-bit weights, never operators.
+  std::vector<ComputeOperator*> ops = widener.editor().operators();
+
+  bool changed = false;
+  for (ComputeOperator* op : ops) {
+    if (nullptr == op)
+      continue;
+    for (unsigned int i = 0; i < op->getNumOfInputs(); ++i) {
+      Value* input = op->getInput(i);
+      if (!IsNarrowWeight(input) || ReadsNarrow(*op, i))
+        continue;
+      if (!widener.run(*op, i)) {
+        errs() << "X86WidenWeights: the values of 16-bit weight "
+               << input->getName() << " are not loaded" << std::endl;
+        return Pass::kPassFailure;
+      }
+      changed = true;
+    }
+  }
+
+  m_NumOfWeights += widener.getNumOfWeights();
+  if (!changed)
+    return Pass::kModuleNoChanged;
+
+  widener.editor().commit();
+  return Pass::kModuleChanged;
+}
+
+void X86WidenWeights::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== X86WidenWeights ===\n";
+  pOS << "widened weights: " << m_NumOfWeights << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char X86WidenWeights::ID = 0;
+
+X86WidenWeights* onnc::CreateX86WidenWeightsPass()
+{
+  return new X86WidenWeights();
+}
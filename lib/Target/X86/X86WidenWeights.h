@@ -0,0 +1,58 @@
+//===- X86WidenWeights.h --------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TARGET_X86_X86_WIDEN_WEIGHTS_H
+#define TARGET_X86_X86_WIDEN_WEIGHTS_H
+#include <onnc/Core/ModulePass.h>
+
+namespace onnc {
+
+class ComputeGraph;
+
+/** \class X86WidenWeights
+ *  \brief Store the 16-bit float weights of a model in float where no
+ *         runtime kernel reads them in 16 bits.
+ *
+ *  Only the W of a Conv or FusedConv and the B of a Gemm, FusedGemm or
+ *  MatMul are read through the _mixed runtime functions; every other kernel
+ *  reads floats. So a float16 or bfloat16 weight read anywhere else, like
+ *  the bias of a convolution or the scale of a normalization, is widened to
+ *  a new float weight. A weight read by several operators is widened once,
+ *  and keeps its 16-bit form for the readers which can use it.
+ *
+ *  The pass fails if such a weight has no loaded values.
+ */
+class X86WidenWeights : public ModulePass
+{
+public:
+  static char ID;
+
+public:
+  X86WidenWeights();
+
+  StringRef getPassName() const override { return "X86WidenWeights"; }
+
+  Pass::ReturnType runOnModule(Module& pModule) override;
+
+  void print(OStream& pOS, const Module* pModule) const override;
+
+  unsigned int getNumOfWideWeights() const { return m_NumOfWeights; }
+
+private:
+  /// @retval kModuleChanged If pCG has been changed.
+  /// @retval kPassFailure If a weight can't be widened.
+  Pass::ReturnType runOnComputeGraph(ComputeGraph& pCG);
+
+private:
+  unsigned int m_NumOfWeights;
+};
+
+X86WidenWeights* CreateX86WidenWeightsPass();
+
+} // namespace of onnc
+
+#endif
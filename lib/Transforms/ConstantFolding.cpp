@@ -0,0 +1,298 @@
+//===- ConstantFolding.cpp ------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Transforms/ConstantFolding.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <onnc/Core/PassSupport.h>
+#include <onnc/Interpreter/Interpreter.h>
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Abs.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/Cast.h>
+#include <onnc/IR/Compute/Ceil.h>
+#include <onnc/IR/Compute/Clip.h>
+#include <onnc/IR/Compute/Concat.h>
+#include <onnc/IR/Compute/Div.h>
+#include <onnc/IR/Compute/Exp.h>
+#include <onnc/IR/Compute/Flatten.h>
+#include <onnc/IR/Compute/Floor.h>
+#include <onnc/IR/Compute/Gather.h>
+#include <onnc/IR/Compute/Identity.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/Log.h>
+#include <onnc/IR/Compute/Max.h>
+#include <onnc/IR/Compute/Mean.h>
+#include <onnc/IR/Compute/Min.h>
+#include <onnc/IR/Compute/Mul.h>
+#include <onnc/IR/Compute/Neg.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Pow.h>
+#include <onnc/IR/Compute/Reciprocal.h>
+#include <onnc/IR/Compute/Reshape.h>
+#include <onnc/IR/Compute/Shape.h>
+#include <onnc/IR/Compute/Size.h>
+#include <onnc/IR/Compute/Slice.h>
+#include <onnc/IR/Compute/Sqrt.h>
+#include <onnc/IR/Compute/Squeeze.h>
+#include <onnc/IR/Compute/Sub.h>
+#include <onnc/IR/Compute/Sum.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/Compute/Tile.h>
+#include <onnc/IR/Compute/Transpose.h>
+#include <onnc/IR/Compute/Unsqueeze.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <cmath>
+#include <vector>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/onnc-runtime.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// Outputs up to this many elements are folded even if they are larger than
+/// the inputs together.
+const int64_t kMaxGrowth = 4096;
+
+/// @return The number of elements of pTensor, or -1 if a dimension isn't
+///         known.
+int64_t GetNumOfElements(const Tensor& pTensor)
+{
+  int64_t size = 1;
+  for (int64_t dim : pTensor.getDimensions()) {
+    if (dim <= 0)
+      return -1;
+    size *= dim;
+  }
+  return size;
+}
+
+/// @retval true If pOp computes the same values on every run and its runtime
+///         kernel is implemented.
+bool IsFoldable(const ComputeOperator& pOp)
+{
+  return isa<Abs>(&pOp) || isa<Add>(&pOp) || isa<Cast>(&pOp) ||
+         isa<Ceil>(&pOp) || isa<Clip>(&pOp) || isa<Concat>(&pOp) ||
+         isa<Div>(&pOp) || isa<Exp>(&pOp) || isa<Flatten>(&pOp) ||
+         isa<Floor>(&pOp) || isa<Gather>(&pOp) || isa<Identity>(&pOp) ||
+         isa<Log>(&pOp) || isa<Max>(&pOp) || isa<Mean>(&pOp) ||
+         isa<Min>(&pOp) || isa<Mul>(&pOp) || isa<Neg>(&pOp) ||
+         isa<Pow>(&pOp) || isa<Reciprocal>(&pOp) || isa<Reshape>(&pOp) ||
+         isa<Shape>(&pOp) || isa<Size>(&pOp) || isa<Slice>(&pOp) ||
+         isa<Sqrt>(&pOp) || isa<Squeeze>(&pOp) || isa<Sub>(&pOp) ||
+         isa<Sum>(&pOp) || isa<Tile>(&pOp) || isa<Transpose>(&pOp) ||
+         isa<Unsqueeze>(&pOp);
+}
+
+/// @retval true If no dimension of pValue is 0 or less, which is how
+///         dimensions that aren't known are read.
+bool HasKnownDimensions(const Value& pValue)
+{
+  return GetNumOfElements(static_cast<const Tensor&>(pValue)) >= 0;
+}
+
+/// @retval true If pOp only reads the dimensions of its inputs.
+bool ReadsDimensionsOnly(const ComputeOperator& pOp)
+{
+  return isa<Shape>(&pOp) || isa<Size>(&pOp);
+}
+
+template<typename TensorType>
+bool CopyValues(const Value& pValue, int64_t pSize, std::vector<float>& pValues)
+{
+  const TensorType& tensor = static_cast<const TensorType&>(pValue);
+  if (static_cast<int64_t>(tensor.getNumOfValues()) != pSize)
+    return false;
+  pValues.assign(tensor.data(), tensor.data() + pSize);
+  return true;
+}
+
+/// Read the values of the weight pValue as floats.
+/// @retval false If pValue isn't a weight, or its values aren't loaded.
+bool GetValues(const Value& pValue, std::vector<float>& pValues)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue.getDefine());
+  if (nullptr == define || !isa<Initializer>(define))
+    return false;
+
+  int64_t size = GetNumOfElements(static_cast<const Tensor&>(pValue));
+  if (size < 0)
+    return false;
+
+  switch (pValue.kind()) {
+  case Value::kFloat:  return CopyValues<FloatTensor>(pValue, size, pValues);
+  case Value::kDouble: return CopyValues<DoubleTensor>(pValue, size, pValues);
+  case Value::kInt8:   return CopyValues<Int8Tensor>(pValue, size, pValues);
+  case Value::kInt16:  return CopyValues<Int16Tensor>(pValue, size, pValues);
+  case Value::kInt32:  return CopyValues<Int32Tensor>(pValue, size, pValues);
+  case Value::kInt64:  return CopyValues<Int64Tensor>(pValue, size, pValues);
+  case Value::kUint8:  return CopyValues<Uint8Tensor>(pValue, size, pValues);
+  case Value::kUint16: return CopyValues<Uint16Tensor>(pValue, size, pValues);
+  case Value::kUint32: return CopyValues<Uint32Tensor>(pValue, size, pValues);
+  case Value::kUint64: return CopyValues<Uint64Tensor>(pValue, size, pValues);
+  default:
+    return false;
+  }
+}
+
+/// @retval true If folded values can replace pValue, which keeps its type.
+bool IsFoldableType(const Value& pValue)
+{
+  return Value::kFloat == pValue.kind() || Value::kInt64 == pValue.kind();
+}
+
+/// @retval true If a graph output is pValue.
+bool IsGraphOutput(const Value& pValue)
+{
+  for (const Use& use : pValue.getUses()) {
+    if (isa<OutputOperator>(use.getUser()))
+      return true;
+  }
+  return false;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// ConstantFolding
+//===----------------------------------------------------------------------===//
+ConstantFolding::ConstantFolding()
+  : ModulePass(ID), m_pContext(nullptr), m_NumOfFolded(0) {
+}
+
+Pass::ReturnType ConstantFolding::runOnModule(Module& pModule)
+{
+  m_NumOfFolded = 0;
+  m_pContext = ONNC_RUNTIME_init_runtime();
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+
+  ONNC_RUNTIME_shutdown_runtime(m_pContext);
+  m_pContext = nullptr;
+  return ret;
+}
+
+bool ConstantFolding::runOnComputeGraph(ComputeGraph& pCG)
+{
+  GraphEditor editor(pCG, "folded");
+  const std::vector<ComputeOperator*>& ops = editor.operators();
+  unsigned int numOfFolded = 0;
+
+  for (size_t i = 0; i < ops.size(); ++i) {
+    ComputeOperator* op = ops[i];
+    if (nullptr == op || !IsFoldable(*op))
+      continue;
+
+    // Read the inputs. Weights folded earlier are read, too.
+    std::vector<std::vector<float> > inputs(op->getNumOfInputs());
+    std::vector<const float*> inputData(op->getNumOfInputs(), nullptr);
+    int64_t inputSize = 0;
+    bool known = true;
+    for (unsigned int j = 0; j < op->getNumOfInputs(); ++j) {
+      if (GetValues(*op->getInput(j), inputs[j])) {
+        inputData[j] = inputs[j].data();
+        inputSize += inputs[j].size();
+      }
+      else
+        known &= ReadsDimensionsOnly(*op) &&
+                 HasKnownDimensions(*op->getInput(j));
+    }
+    if (!known)
+      continue;
+
+    std::vector<std::vector<float> > outputs(op->getNumOfOutputs());
+    std::vector<float*> outputData(op->getNumOfOutputs(), nullptr);
+    for (unsigned int j = 0; j < op->getNumOfOutputs(); ++j) {
+      Tensor* output = static_cast<Tensor*>(op->getOutput(j));
+      int64_t size = GetNumOfElements(*output);
+      if (size < 0 || (size > inputSize && size > kMaxGrowth) ||
+          !IsFoldableType(*output) || IsGraphOutput(*output)) {
+        known = false;
+        break;
+      }
+      outputs[j].resize(size);
+      outputData[j] = outputs[j].data();
+    }
+    if (!known || !evaluate(*op, inputData, outputData))
+      continue;
+
+    // Let new weights replace the outputs.
+    std::vector<Value*> oldOutputs;
+    for (unsigned int j = 0; j < op->getNumOfOutputs(); ++j) {
+      Tensor* output = static_cast<Tensor*>(op->getOutput(j));
+      Tensor* weight = nullptr;
+      if (Value::kInt64 == output->kind()) {
+        std::vector<int64_t> values(outputs[j].size());
+        for (size_t k = 0; k < values.size(); ++k)
+          values[k] = std::llround(outputs[j][k]);
+        weight = editor.addWeight(output->getName(), output->getDimensions(),
+                                  values);
+      }
+      else
+        weight = editor.addWeight(output->getName(), output->getDimensions(),
+                                  outputs[j]);
+      output->replaceAllUsesWith(*weight);
+      oldOutputs.push_back(output);
+    }
+    editor.erase(*op);
+    for (Value* output : oldOutputs)
+      pCG.erase(*output);
+    ++numOfFolded;
+  }
+
+  if (0 == numOfFolded)
+    return false;
+
+  m_NumOfFolded += numOfFolded;
+  editor.commit();
+  return true;
+}
+
+bool ConstantFolding::evaluate(ComputeOperator& pOp,
+                               const std::vector<const float*>& pInputs,
+                               const std::vector<float*>& pOutputs)
+{
+  Interpreter interpreter;
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i)
+    interpreter.m_ATable[pOp.getInput(i)] = const_cast<float*>(pInputs[i]);
+  for (unsigned int i = 0; i < pOp.getNumOfOutputs(); ++i)
+    interpreter.m_ATable[pOp.getOutput(i)] = pOutputs[i];
+
+  // Operators the interpreter doesn't know add no step.
+  pOp.accept(interpreter);
+  if (interpreter.m_Plan.empty())
+    return false;
+  interpreter.m_Plan.run(m_pContext);
+  return true;
+}
+
+void ConstantFolding::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== ConstantFolding ===\n";
+  pOS << "folded operators: " << m_NumOfFolded << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char ConstantFolding::ID = 0;
+
+ModulePass* onnc::CreateConstantFoldingPass()
+{
+  return new ConstantFolding();
+}
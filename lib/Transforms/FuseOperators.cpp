@@ -0,0 +1,407 @@
+//===- FuseOperators.cpp --------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Transforms/FuseOperators.h>
+#include <onnc/Transforms/GraphEditor.h>
+#include <onnc/Core/PassSupport.h>
+#include <onnc/IR/ComputeGraph.h>
+#include <onnc/IR/Module.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/Affine.h>
+#include <onnc/IR/Compute/BatchNormalization.h>
+#include <onnc/IR/Compute/Clip.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/Div.h>
+#include <onnc/IR/Compute/Elu.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/FusedElementwise.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/HardSigmoid.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/LeakyRelu.h>
+#include <onnc/IR/Compute/Mul.h>
+#include <onnc/IR/Compute/Neg.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/ScaledTanh.h>
+#include <onnc/IR/Compute/Sigmoid.h>
+#include <onnc/IR/Compute/Softplus.h>
+#include <onnc/IR/Compute/Softsign.h>
+#include <onnc/IR/Compute/Sub.h>
+#include <onnc/IR/Compute/Tanh.h>
+#include <onnc/IR/Compute/Tensor.h>
+#include <onnc/IR/Compute/ThresholdedRelu.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/IOStream.h>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace onnc;
+
+namespace {
+
+/// An element-wise activation, as in the activations of LSTM.
+struct Activation
+{
+  const char* name;
+  unsigned int numOfParams;
+  double alpha;
+  double beta;
+
+  /// The input the activation works on. The others are weights.
+  unsigned int input;
+};
+
+/// @return The number of elements of pTensor.
+int64_t GetNumOfElements(const Tensor& pTensor)
+{
+  int64_t size = 1;
+  for (int64_t dim : pTensor.getDimensions())
+    size *= dim;
+  return size;
+}
+
+/// @return The float weight pValue if its pNumOfValues values are loaded,
+///         otherwise nullptr.
+const FloatTensor* GetWeight(const Value* pValue, size_t pNumOfValues)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue->getDefine());
+  if (nullptr == define || !isa<Initializer>(define) ||
+      Value::kFloat != pValue->kind())
+    return nullptr;
+
+  const FloatTensor* tensor = static_cast<const FloatTensor*>(pValue);
+  if (pNumOfValues != tensor->getNumOfValues() ||
+      static_cast<int64_t>(pNumOfValues) != GetNumOfElements(*tensor))
+    return nullptr;
+  return tensor;
+}
+
+/// @return The operator reading pValue if it is the only reader.
+ComputeOperator* GetSoleUser(Value& pValue)
+{
+  if (1 != pValue.getUses().size())
+    return nullptr;
+  return pValue.getUses()[0].getUser();
+}
+
+/// Describe pOp as an activation, if it is one.
+bool GetActivation(const ComputeOperator& pOp, Activation& pAct)
+{
+  pAct = Activation{ nullptr, 0, 0.0, 0.0, 0 };
+  if (isa<Relu>(&pOp))
+    pAct.name = "Relu";
+  else if (isa<Sigmoid>(&pOp))
+    pAct.name = "Sigmoid";
+  else if (isa<Tanh>(&pOp))
+    pAct.name = "Tanh";
+  else if (isa<Softsign>(&pOp))
+    pAct.name = "Softsign";
+  else if (isa<Softplus>(&pOp))
+    pAct.name = "Softplus";
+  else if (const LeakyRelu* op = dyn_cast<LeakyRelu>(&pOp))
+    pAct = Activation{ "LeakyRelu", 1, op->getAlpha().value(), 0.0, 0 };
+  else if (const Elu* op = dyn_cast<Elu>(&pOp))
+    pAct = Activation{ "Elu", 1, op->getAlpha().value(), 0.0, 0 };
+  else if (const ThresholdedRelu* op = dyn_cast<ThresholdedRelu>(&pOp))
+    pAct = Activation{ "ThresholdedRelu", 1, op->getAlpha().value(), 0.0, 0 };
+  else if (const HardSigmoid* op = dyn_cast<HardSigmoid>(&pOp))
+    pAct = Activation{ "HardSigmoid", 2, op->getAlpha().value(),
+                       op->getBeta().value(), 0 };
+  else if (const ScaledTanh* op = dyn_cast<ScaledTanh>(&pOp))
+    pAct = Activation{ "ScaledTanh", 2, op->getAlpha().value(),
+                       op->getBeta().value(), 0 };
+  else if (const Affine* op = dyn_cast<Affine>(&pOp))
+    pAct = Activation{ "Affine", 2, op->getAlpha().value(),
+                       op->getBeta().value(), 0 };
+  else if (const Clip* op = dyn_cast<Clip>(&pOp))
+    pAct = Activation{ "Clip", 2, op->getMin().value(), op->getMax().value(), 0 };
+  else if (isa<Neg>(&pOp))
+    pAct = Activation{ "Affine", 2, -1.0, 0.0, 0 };
+  else if (isa<Add>(&pOp) || isa<Sub>(&pOp) || isa<Mul>(&pOp) ||
+           isa<Div>(&pOp)) {
+    // x op s, or s op x, where s is a one-element weight.
+    if (2 != pOp.getNumOfInputs())
+      return false;
+    const FloatTensor* scalar = GetWeight(pOp.getInput(1), 1);
+    pAct.input = 0;
+    if (nullptr == scalar) {
+      scalar = GetWeight(pOp.getInput(0), 1);
+      pAct.input = 1;
+    }
+    if (nullptr == scalar)
+      return false;
+
+    double s = scalar->data()[0];
+    bool first = (0 == pAct.input);
+    if (isa<Add>(&pOp))
+      pAct = Activation{ "Affine", 2, 1.0, s, pAct.input };
+    else if (isa<Sub>(&pOp))
+      pAct = Activation{ "Affine", 2, first ? 1.0 : -1.0, first ? -s : s,
+                         pAct.input };
+    else if (isa<Mul>(&pOp))
+      pAct = Activation{ "Affine", 2, s, 0.0, pAct.input };
+    else if (first && 0.0 != s)
+      pAct = Activation{ "Affine", 2, 1.0 / s, 0.0, pAct.input };
+    else
+      return false;
+  }
+  else
+    return false;
+
+  // The output is the input, element by element.
+  if (pAct.input >= pOp.getNumOfInputs() || 1 != pOp.getNumOfOutputs())
+    return false;
+  const Tensor* input = static_cast<const Tensor*>(pOp.getInput(pAct.input));
+  const Tensor* output = static_cast<const Tensor*>(pOp.getOutput(0));
+  return Value::kFloat == input->kind() && Value::kFloat == output->kind() &&
+         input->getDimensions() == output->getDimensions();
+}
+
+/// @return The sole user of the output of pOp if it is an activation of it.
+ComputeOperator* GetNextActivation(ComputeOperator& pOp, Activation& pAct)
+{
+  if (1 != pOp.getNumOfOutputs())
+    return nullptr;
+  Value* output = pOp.getOutput(0);
+  ComputeOperator* user = GetSoleUser(*output);
+  if (nullptr == user || !GetActivation(*user, pAct) ||
+      user->getInput(pAct.input) != output)
+    return nullptr;
+  return user;
+}
+
+/// Fold the BatchNormalization after pConv into the weights of pConv:
+///   W'[m] = W[m] * s[m], B'[m] = (B[m] - mean[m]) * s[m] + bias[m]
+/// where s[m] = scale[m] / sqrt(var[m] + epsilon).
+bool FoldBatchNormalization(GraphEditor& pEditor, Conv& pConv)
+{
+  BatchNormalization* bn = dyn_cast_or_null<BatchNormalization>(
+      GetSoleUser(*pConv.getOutput(Conv::kY)));
+  if (nullptr == bn || 1 != bn->getNumOfOutputs() ||
+      bn->getInput(BatchNormalization::kX) != pConv.getOutput(Conv::kY))
+    return false;
+
+  const Tensor* w = pConv.getW();
+  if (w->getNumOfDimensions() < 1)
+    return false;
+  size_t numOfM = w->dimension(0);
+  const FloatTensor* weight = GetWeight(w, GetNumOfElements(*w));
+  const FloatTensor* bias = nullptr;
+  if (pConv.getNumOfInputs() > Conv::kB) {
+    bias = GetWeight(pConv.getB(), numOfM);
+    if (nullptr == bias)
+      return false;
+  }
+  const FloatTensor* scale =
+      GetWeight(bn->getInput(BatchNormalization::kScale), numOfM);
+  const FloatTensor* shift =
+      GetWeight(bn->getInput(BatchNormalization::kB), numOfM);
+  const FloatTensor* mean =
+      GetWeight(bn->getInput(BatchNormalization::kInMean), numOfM);
+  const FloatTensor* var =
+      GetWeight(bn->getInput(BatchNormalization::kInVar), numOfM);
+  if (nullptr == weight || nullptr == scale || nullptr == shift ||
+      nullptr == mean || nullptr == var || 0 == numOfM)
+    return false;
+
+  double epsilon = bn->getEpsilon().value();
+  size_t size = weight->getNumOfValues() / numOfM;
+  std::vector<float> newWeight(weight->data(),
+                               weight->data() + weight->getNumOfValues());
+  std::vector<float> newBias(numOfM);
+  for (size_t m = 0; m < numOfM; ++m) {
+    double s = scale->data()[m] / std::sqrt(var->data()[m] + epsilon);
+    for (size_t k = 0; k < size; ++k)
+      newWeight[m * size + k] = newWeight[m * size + k] * s;
+    double b = (nullptr != bias) ? bias->data()[m] : 0.0;
+    newBias[m] = (b - mean->data()[m]) * s + shift->data()[m];
+  }
+
+  FloatTensor* foldedW =
+      pEditor.addWeight(w->getName(), w->getDimensions(), newWeight);
+  FloatTensor* foldedB = pEditor.addWeight(
+      bn->getInput(BatchNormalization::kB)->getName(),
+      Tensor::Dimensions(1, numOfM), newBias);
+
+  pEditor.replaceInput(pConv, Conv::kW, *foldedW);
+  pEditor.replaceInput(pConv, Conv::kB, *foldedB);
+  pEditor.absorb(pConv, *bn);
+  return true;
+}
+
+/// @retval true If pTensor broadcasts as one row, i.e. has at most one
+///         dimension greater than 1, the last one.
+bool IsRow(const Tensor& pTensor)
+{
+  unsigned int rank = pTensor.getNumOfDimensions();
+  for (unsigned int i = 0; i + 1 < rank; ++i) {
+    if (1 != pTensor.dimension(i))
+      return false;
+  }
+  return true;
+}
+
+/// Fold Y + b after pGemm into C: C' = beta * C + b, with beta' = 1.
+bool FoldBias(GraphEditor& pEditor, Gemm& pGemm)
+{
+  Add* add = dyn_cast_or_null<Add>(GetSoleUser(*pGemm.getOutput(Gemm::kY)));
+  if (nullptr == add || 2 != add->getNumOfInputs() ||
+      3 != pGemm.getNumOfInputs())
+    return false;
+
+  Tensor* y = pGemm.getY();
+  if (2 != y->getNumOfDimensions() ||
+      add->getOutput(0)->getDimensions() != y->getDimensions())
+    return false;
+
+  // Only fold rows: C has N or 1 values, and b has N values.
+  size_t numOfN = y->dimension(1);
+  Tensor* other = add->getInput((add->getInput(0) == y) ? 1 : 0);
+  Tensor* c = pGemm.getC();
+  const FloatTensor* bias = GetWeight(other, numOfN);
+  const FloatTensor* cValues = GetWeight(c, numOfN);
+  if (nullptr == cValues)
+    cValues = GetWeight(c, 1);
+  if (nullptr == bias || nullptr == cValues || !IsRow(*other) || !IsRow(*c))
+    return false;
+
+  double beta = pGemm.getBeta().value();
+  std::vector<float> newC(numOfN);
+  for (size_t j = 0; j < numOfN; ++j) {
+    float cj = cValues->data()[(1 == cValues->getNumOfValues()) ? 0 : j];
+    newC[j] = beta * cj + bias->data()[j];
+  }
+
+  FloatTensor* foldedC = pEditor.addWeight(
+      c->getName(), Tensor::Dimensions(1, numOfN), newC);
+  pGemm.setBeta(FloatAttr(1.0));
+  pEditor.replaceInput(pGemm, Gemm::kC, *foldedC);
+  pEditor.absorb(pGemm, *add);
+  return true;
+}
+
+/// Absorb the activations after pFused into its epilogue.
+/// @return The number of absorbed activations.
+template<typename FusedOp>
+unsigned int AbsorbActivations(GraphEditor& pEditor, FusedOp& pFused)
+{
+  unsigned int count = 0;
+  Activation act;
+  while (ComputeOperator* next = GetNextActivation(pFused, act)) {
+    pFused.addActivation(act.name, act.numOfParams, act.alpha, act.beta);
+    pEditor.absorb(pFused, *next);
+    ++count;
+  }
+  return count;
+}
+
+/// Replace pOp by OpType, with the activations after pOp as its epilogue.
+template<typename FusedOp, typename OpType>
+unsigned int FuseEpilogue(GraphEditor& pEditor, OpType& pOp)
+{
+  Activation act;
+  if (nullptr == GetNextActivation(pOp, act))
+    return 0;
+
+  std::vector<Value*> inputs;
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i)
+    inputs.push_back(pOp.getInput(i));
+  FusedOp* fused = pEditor.graph().template addOperator<FusedOp>(pOp);
+  pEditor.replace(pOp, *fused, inputs);
+  return AbsorbActivations(pEditor, *fused);
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// FuseOperators
+//===----------------------------------------------------------------------===//
+FuseOperators::FuseOperators()
+  : ModulePass(ID),
+    m_NumOfFoldedBN(0), m_NumOfFoldedBias(0),
+    m_NumOfEpilogues(0), m_NumOfChains(0) {
+}
+
+Pass::ReturnType FuseOperators::runOnModule(Module& pModule)
+{
+  m_NumOfFoldedBN = m_NumOfFoldedBias = m_NumOfEpilogues = m_NumOfChains = 0;
+
+  Pass::ReturnType ret = Pass::kModuleNoChanged;
+  Module::cg_iterator cg, cgEnd = pModule.cgEnd();
+  for (cg = pModule.cgBegin(); cg != cgEnd; ++cg) {
+    if (runOnComputeGraph(*cg->value()))
+      ret |= Pass::kModuleChanged;
+  }
+  return ret;
+}
+
+bool FuseOperators::runOnComputeGraph(ComputeGraph& pCG)
+{
+  GraphEditor editor(pCG, "fused");
+  const std::vector<ComputeOperator*>& ops = editor.operators();
+
+  // 1. Fold BatchNormalization into Conv and bias into Gemm.
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (Conv* conv = dyn_cast_or_null<Conv>(ops[i]))
+      m_NumOfFoldedBN += FoldBatchNormalization(editor, *conv);
+    else if (Gemm* gemm = dyn_cast_or_null<Gemm>(ops[i]))
+      m_NumOfFoldedBias += FoldBias(editor, *gemm);
+  }
+
+  // 2. Move activations into the epilogues of Conv and Gemm.
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (Conv* conv = dyn_cast_or_null<Conv>(ops[i]))
+      m_NumOfEpilogues += FuseEpilogue<FusedConv>(editor, *conv);
+    else if (Gemm* gemm = dyn_cast_or_null<Gemm>(ops[i]))
+      m_NumOfEpilogues += FuseEpilogue<FusedGemm>(editor, *gemm);
+  }
+
+  // 3. Merge chains of activations.
+  for (size_t i = 0; i < ops.size(); ++i) {
+    Activation first, second;
+    if (nullptr == ops[i] || !GetActivation(*ops[i], first) ||
+        nullptr == GetNextActivation(*ops[i], second))
+      continue;
+
+    ComputeOperator* head = ops[i];
+    std::vector<Value*> inputs = { head->getInput(first.input) };
+    FusedElementwise* fused = pCG.addOperator<FusedElementwise>();
+    fused->addActivation(first.name, first.numOfParams, first.alpha,
+                         first.beta);
+    editor.replace(*head, *fused, inputs);
+    AbsorbActivations(editor, *fused);
+    ++m_NumOfChains;
+  }
+
+  if (0 == m_NumOfFoldedBN + m_NumOfFoldedBias + m_NumOfEpilogues +
+           m_NumOfChains)
+    return false;
+
+  editor.commit();
+  return true;
+}
+
+void FuseOperators::print(OStream& pOS, const Module* pModule) const
+{
+  pOS << "=== FuseOperators ===\n";
+  pOS << "folded batch normalizations: " << m_NumOfFoldedBN
+      << ", folded biases: " << m_NumOfFoldedBias
+      << ", epilogue activations: " << m_NumOfEpilogues
+      << ", element-wise chains: " << m_NumOfChains << "\n";
+}
+
+//===----------------------------------------------------------------------===//
+// Factory method
+//===----------------------------------------------------------------------===//
+char FuseOperators::ID = 0;
+
+ModulePass* onnc::CreateFuseOperatorsPass()
+{
+  return new FuseOperators();
+}
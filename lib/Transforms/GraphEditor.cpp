@@ -0,0 +1,206 @@
+//===- GraphEditor.cpp ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Transforms/GraphEditor.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/Support/Casting.h>
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// GraphEditor
+//===----------------------------------------------------------------------===//
+GraphEditor::GraphEditor(ComputeGraph& pCG, const std::string& pTag)
+  : m_CG(pCG), m_Tag(pTag) {
+  ComputeGraph::iterator nodeIt, nEnd = pCG.end();
+  for (nodeIt = pCG.begin(); nodeIt != nEnd; ++nodeIt) {
+    ComputeOperator* node = nodeIt;
+    m_Positions[node] = m_Operators.size();
+    m_Operators.push_back(node);
+  }
+}
+
+FloatTensor* GraphEditor::addWeight(const std::string& pBaseName,
+                                    const Tensor::Dimensions& pDims,
+                                    const std::vector<float>& pValues)
+{
+  return createWeight<FloatTensor>(pBaseName, pDims, pValues);
+}
+
+Int8Tensor* GraphEditor::addWeight(const std::string& pBaseName,
+                                   const Tensor::Dimensions& pDims,
+                                   const std::vector<int8_t>& pValues)
+{
+  return createWeight<Int8Tensor>(pBaseName, pDims, pValues);
+}
+
+Int64Tensor* GraphEditor::addWeight(const std::string& pBaseName,
+                                    const Tensor::Dimensions& pDims,
+                                    const std::vector<int64_t>& pValues)
+{
+  return createWeight<Int64Tensor>(pBaseName, pDims, pValues);
+}
+
+Tensor* GraphEditor::addWeight(const std::string& pBaseName,
+                               const Tensor::Dimensions& pDims,
+                               Value::Type pType,
+                               const std::vector<uint16_t>& pValues)
+{
+  if (Value::kBFloat16 == pType)
+    return createWeight<BFloat16Tensor>(pBaseName, pDims, pValues);
+  return createWeight<Float16Tensor>(pBaseName, pDims, pValues);
+}
+
+FloatTensor* GraphEditor::addValue(const std::string& pBaseName,
+                                   const Tensor::Dimensions& pDims)
+{
+  return createValue<FloatTensor>(pBaseName, pDims);
+}
+
+Int8Tensor* GraphEditor::addInt8Value(const std::string& pBaseName,
+                                      const Tensor::Dimensions& pDims)
+{
+  return createValue<Int8Tensor>(pBaseName, pDims);
+}
+
+template<typename TensorType>
+TensorType* GraphEditor::createWeight(
+    const std::string& pBaseName, const Tensor::Dimensions& pDims,
+    const typename TensorType::ValueList& pValues)
+{
+  TensorType* tensor = createValue<TensorType>(pBaseName, pDims);
+  tensor->getValues() = pValues;
+
+  Initializer* init = m_CG.addOperator<Initializer>(tensor->getName());
+  init->setTensor(*tensor);
+  m_Weights.push_back(init);
+  return tensor;
+}
+
+template<typename TensorType>
+TensorType* GraphEditor::createValue(const std::string& pBaseName,
+                                     const Tensor::Dimensions& pDims)
+{
+  // Value names are unique in a module.
+  TensorType* tensor = nullptr;
+  for (unsigned int i = 0; nullptr == tensor; ++i) {
+    std::string name = pBaseName + "." + m_Tag + std::to_string(i);
+    if (nullptr == m_CG.getValue(name))
+      tensor = m_CG.addValue<TensorType>(name);
+  }
+  tensor->setDimensions(pDims);
+  return tensor;
+}
+
+void GraphEditor::insert(ComputeOperator& pNew, ComputeOperator& pBefore)
+{
+  size_t position = m_Positions[&pBefore];
+  m_Operators.insert(m_Operators.begin() + position, &pNew);
+  for (size_t i = position; i < m_Operators.size(); ++i) {
+    if (nullptr != m_Operators[i])
+      m_Positions[m_Operators[i]] = i;
+  }
+}
+
+void GraphEditor::replaceInput(ComputeOperator& pOp, unsigned int pIdx,
+                               Value& pValue)
+{
+  if (pIdx == pOp.getNumOfInputs()) {
+    pOp.addInput(pValue);
+    return;
+  }
+  Value* old = pOp.getInput(pIdx);
+  pOp.replaceInput(pIdx, pValue);
+  eraseIfDeadWeight(*old);
+}
+
+void GraphEditor::replace(ComputeOperator& pOld, ComputeOperator& pNew,
+                          const std::vector<Value*>& pInputs)
+{
+  for (Value* input : pInputs)
+    pNew.addInput(*input);
+
+  for (unsigned int i = 0; i < pOld.getNumOfOutputs(); ++i) {
+    Value* output = pOld.getOutput(i);
+    output->clearDefine();
+    pNew.addOutput(*output);
+  }
+
+  size_t position = m_Positions[&pOld];
+  erase(pOld);
+  m_Operators[position] = &pNew;
+  m_Positions[&pNew] = position;
+}
+
+void GraphEditor::erase(ComputeOperator& pOp)
+{
+  std::vector<Value*> inputs;
+  for (unsigned int i = 0; i < pOp.getNumOfInputs(); ++i) {
+    Value* input = pOp.getInput(i);
+    Value::UseList& uses = input->getUses();
+    for (Value::UseList::iterator use = uses.begin(); use != uses.end(); ++use) {
+      if (use->getUser() == &pOp && use->getOperandNo() == i) {
+        uses.erase(use);
+        break;
+      }
+    }
+    inputs.push_back(input);
+  }
+
+  for (unsigned int i = 0; i < pOp.getNumOfOutputs(); ++i) {
+    if (pOp.getOutput(i)->getDefine() == &pOp)
+      pOp.getOutput(i)->clearDefine();
+  }
+
+  std::unordered_map<ComputeOperator*, size_t>::iterator position =
+      m_Positions.find(&pOp);
+  if (m_Positions.end() != position) {
+    m_Operators[position->second] = nullptr;
+    m_Positions.erase(position);
+  }
+  m_CG.erase(pOp);
+
+  for (Value* input : inputs)
+    eraseIfDeadWeight(*input);
+}
+
+void GraphEditor::absorb(ComputeOperator& pFused, ComputeOperator& pNext)
+{
+  Value* middle = pFused.getOutput(0);
+  Value* output = pNext.getOutput(0);
+  erase(pNext);
+  pFused.replaceOutput(0, *output);
+  m_CG.erase(*middle);
+}
+
+void GraphEditor::eraseIfDeadWeight(Value& pValue)
+{
+  ComputeOperator* define = static_cast<ComputeOperator*>(pValue.getDefine());
+  if (!pValue.getUses().empty() || nullptr == define ||
+      !isa<Initializer>(define))
+    return;
+
+  for (std::vector<ComputeOperator*>::iterator weight = m_Weights.begin();
+       weight != m_Weights.end(); ++weight) {
+    if (*weight == define) {
+      m_Weights.erase(weight);
+      break;
+    }
+  }
+  erase(*define);
+  m_CG.erase(pValue);
+}
+
+void GraphEditor::commit()
+{
+  std::vector<ComputeGraph::Node*> order(m_Weights.begin(), m_Weights.end());
+  for (ComputeOperator* op : m_Operators) {
+    if (nullptr != op)
+      order.push_back(op);
+  }
+  m_CG.reorder(order);
+}
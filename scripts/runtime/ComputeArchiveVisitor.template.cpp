@@ -0,0 +1,24 @@
+//===- ComputeArchiveVisitor.cpp ------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// This file is generated by scripts/runtime/code_generator.py. Visitors of
+// the ONNC operators are written by hand in ComputeArchive.cpp.
+#include <onnc/IR/ComputeArchive.h>
+
+${ComputeIR_includes}
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// ComputeArchive
+//===----------------------------------------------------------------------===//
+void ComputeArchive::AddONNXCreators(CreatorMap& pCreators)
+{
+  ${archive_creators}
+}
+
+${archive_visitors}
@@ -0,0 +1,2 @@
+void ComputeArchive::visit(${OperatorName}& pOp) {
+${archive_attribute}}
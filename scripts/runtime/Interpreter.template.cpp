@@ -5,7 +5,10 @@
 // See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
-#include "Interpreter.h"
+// This file is generated by scripts/runtime/code_generator.py. Visitors of
+// the ONNC operators, and of the ONNX operators listed in
+// INTERPRETER_CUSTOM_OPERS, are written by hand in InterpreterCustom.cpp.
+#include <onnc/Interpreter/Interpreter.h>
 #include <onnc/Support/IOStream.h>
 
 ${ComputeIR_includes}
@@ -7,10 +7,12 @@ void Interpreter::visit(${OperatorName}& pOp) {
   ${visitor_prepare_attribute}
 
   // Call to Runtime
-  ONNC_RUNTIME_${operator_name}_float(
-    m_pContext
-    ${visitor_pass_input}
-    ${visitor_pass_output}
-    ${visitor_pass_attribute}
-  );
+  m_Plan.add(pOp, [=](void *pContext) {
+    ONNC_RUNTIME_${operator_name}_float(
+      pContext
+      ${visitor_pass_input}
+      ${visitor_pass_output}
+      ${visitor_pass_attribute}
+    );
+  });
 };
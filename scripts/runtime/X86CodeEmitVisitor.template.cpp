@@ -0,0 +1,26 @@
+//===- X86CodeEmitVisitor.cpp ---------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// This file is generated by scripts/runtime/code_generator.py. Visitors of
+// the ONNC operators, and of the ONNX operators listed in
+// CODE_EMIT_CUSTOM_OPERS, are written by hand in X86CodeEmitVisitorCustom.cpp.
+#include "X86CodeEmitVisitor.h"
+#include "X86RuntimeCall.h"
+
+${ComputeIR_includes}
+
+using namespace onnc;
+using namespace onnc::x86;
+
+//===----------------------------------------------------------------------===//
+// CodeEmitVisitor
+//===----------------------------------------------------------------------===//
+CodeEmitVisitor::CodeEmitVisitor(OStream& pOS, const AddressTable& pAddresses)
+  : m_OS(pOS), m_Addresses(pAddresses), m_Unsupported() {
+}
+
+${code_emit_visitors}
@@ -0,0 +1,11 @@
+void CodeEmitVisitor::visit(${OperatorName}& pOp) {
+  RuntimeCall call(m_Addresses, "ONNC_RUNTIME_${operator_name}_float");
+  // Inputs
+  ${code_emit_input}
+  // Outputs
+  ${code_emit_output}
+  // Attributes
+  ${code_emit_attribute}
+
+  call.print(m_OS, pOp);
+}
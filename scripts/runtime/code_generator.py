@@ -29,6 +29,38 @@ def to_camel_case(snake_str, init_upper = True):
 def format_attr_type(attr_type):
     return str(attr_type).rsplit('.', 1)[-1].lower()
 
+# Inputs and outputs which the X86 backend lets share one buffer, see
+# lib/Target/X86/X86InplaceValueFusible.cpp. Their pointers may alias, so
+# they are not declared restrict.
+INPLACE_IO_NAMES = {
+  'Relu': ['X', 'Y'],
+  'Sigmoid': ['X', 'Y'],
+  'Tanh': ['input', 'output'],
+  'Clip': ['input', 'output'],
+  'LeakyRelu': ['X', 'Y'],
+  'BatchNormalization': ['X', 'Y'],
+  'Add': ['A', 'B', 'C'],
+  'Sub': ['A', 'B', 'C'],
+  'Mul': ['A', 'B', 'C'],
+  'Div': ['A', 'B', 'C'],
+}
+
+# Operators whose Interpreter visitors are written by hand in
+# lib/Interpreter/InterpreterCustom.cpp. Concat fills in the dimensions of
+# its variadic input, and Conv, Gemm and MatMul read their weight through
+# the _mixed runtime functions.
+INTERPRETER_CUSTOM_OPERS = ['Concat', 'Conv', 'Gemm', 'MatMul']
+
+# Operators whose x86 CodeEmitVisitor visitors are written by hand in
+# lib/Target/X86/X86CodeEmitVisitorCustom.cpp: Conv, Gemm and MatMul call the
+# _mixed runtime functions for 16-bit weights, and the tensor attribute of
+# Constant has no values to emit.
+CODE_EMIT_CUSTOM_OPERS = ['Constant', 'Conv', 'Gemm', 'MatMul']
+
+# Operators which ComputeArchive does not know: Constant is not built, and
+# its value is a tensor attribute.
+ARCHIVE_SKIP_OPERS = ['Constant']
+
 def gen_runtime_substitution_hash(schema):
   hash = {
     'OperatorName': schema.name,
@@ -46,8 +78,10 @@ def gen_runtime_substitution_hash(schema):
       }
     return [cb(transform_io_schema(idx, io_schema)) for idx, io_schema in enumerate(io_schemas)]
 
+  inplace_io_names = INPLACE_IO_NAMES.get(schema.name, [])
   def io_parameter(prefix, ctype):
     def cb(io_schema):
+      io_schema['restrict'] = '' if io_schema['io_name'] in inplace_io_names else ' restrict'
       if OpSchema.FormalParameterOption.Variadic == io_schema['option']:
         return [
           ',{ctype} * const * restrict {prefix}_{io_name}'.format(prefix=prefix, ctype=ctype, **io_schema),
@@ -56,7 +90,7 @@ def gen_runtime_substitution_hash(schema):
         ]
       else:
         return [
-          ',{ctype} * restrict {prefix}_{io_name}'.format(prefix=prefix, ctype=ctype, **io_schema),
+          ',{ctype} *{restrict} {prefix}_{io_name}'.format(prefix=prefix, ctype=ctype, **io_schema),
           ',int32_t {prefix}_{io_name}_ndim, const int32_t * restrict {prefix}_{io_name}_dims'.format(prefix=prefix, ctype=ctype, **io_schema)
         ]
     return cb
@@ -171,7 +205,7 @@ def gen_interpreter_substitution_hash(schema):
         return r + [
           'void *{prefix}_{io_name} = m_ATable[{prefix}_{io_name}_t];'.format(**io_schema),
           'int32_t {prefix}_{io_name}_ndim = {prefix}_{io_name}_t->getNumOfDimensions();'.format(**io_schema),
-          'int32_t {prefix}_{io_name}_dims[{prefix}_{io_name}_ndim];'.format(**io_schema),
+          'int32_t *{prefix}_{io_name}_dims = m_Plan.allocate<int32_t>({prefix}_{io_name}_ndim);'.format(**io_schema),
           'for (int i = 0; i < {prefix}_{io_name}_ndim; ++i) {prefix}_{io_name}_dims[i] = {prefix}_{io_name}_t->dimension(i);'.format(**io_schema),
         ]
       elif io_schema['option'] == OpSchema.FormalParameterOption.Optional:
@@ -184,17 +218,17 @@ def gen_interpreter_substitution_hash(schema):
           '  {prefix}_{io_name} = m_ATable[{prefix}_{io_name}_t];'.format(**io_schema),
           '  {prefix}_{io_name}_ndim = {prefix}_{io_name}_t->getNumOfDimensions();'.format(**io_schema),
           '}',
-          'int32_t {prefix}_{io_name}_dims[{prefix}_{io_name}_ndim];'.format(**io_schema),
+          'int32_t *{prefix}_{io_name}_dims = m_Plan.allocate<int32_t>({prefix}_{io_name}_ndim);'.format(**io_schema),
           'for (int i = 0; i < {prefix}_{io_name}_ndim; ++i) {prefix}_{io_name}_dims[i] = {prefix}_{io_name}_t->dimension(i);'.format(**io_schema),
         ]
       elif io_schema['option'] == OpSchema.FormalParameterOption.Variadic:
         # TODO
         return [
           'int32_t {prefix}_{io_name}_ntensor = pOp.getNumOf{Prefix}s() - {idx};'.format(**io_schema),
-          'void *{prefix}_{io_name}[{prefix}_{io_name}_ntensor];'.format(**io_schema),
+          'void **{prefix}_{io_name} = m_Plan.allocate<void *>({prefix}_{io_name}_ntensor);'.format(**io_schema),
           'for (int i = 0; i < {prefix}_{io_name}_ntensor; ++i) {prefix}_{io_name}[i] = m_ATable[pOp.get{Prefix}({idx} + i)];'.format(**io_schema),
-          'int32_t {prefix}_{io_name}_ndim[{prefix}_{io_name}_ntensor]; // FIXME: = {prefix}_{io_name}_v->sizes().size();'.format(**io_schema),
-          'int32_t *{prefix}_{io_name}_dims[{prefix}_{io_name}_ntensor]; // FIXME: [{prefix}_{io_name}_ndim[0]];'.format(**io_schema),
+          'int32_t *{prefix}_{io_name}_ndim = m_Plan.allocate<int32_t>({prefix}_{io_name}_ntensor); // FIXME: = {prefix}_{io_name}_v->sizes().size();'.format(**io_schema),
+          'int32_t **{prefix}_{io_name}_dims = m_Plan.allocate<int32_t *>({prefix}_{io_name}_ntensor); // FIXME: [{prefix}_{io_name}_ndim[0]];'.format(**io_schema),
           '// FIXME: for (int i = 0; i < {prefix}_{io_name}_ndim; ++i) {prefix}_{io_name}_dims[i] = {prefix}_{io_name}_v->sizes()[i].dim;'.format(**io_schema),
         ]
     return cb
@@ -219,11 +253,11 @@ def gen_interpreter_substitution_hash(schema):
 
   # ${visitor_prepare_input}
   hash['visitor_prepare_input'] = '\n  '.join(flatten(for_io_schema(schema.inputs, prepare_io('input'))))
-  hash['visitor_pass_input'] = '\n    '.join(flatten(for_io_schema(schema.inputs, pass_io('input'))))
+  hash['visitor_pass_input'] = '\n      '.join(flatten(for_io_schema(schema.inputs, pass_io('input'))))
 
   # ${visitor_prepare_output}
   hash['visitor_prepare_output'] = '\n  '.join(flatten(for_io_schema(schema.outputs, prepare_io('output'))))
-  hash['visitor_pass_output'] = '\n    '.join(flatten(for_io_schema(schema.outputs, pass_io('output'))))
+  hash['visitor_pass_output'] = '\n      '.join(flatten(for_io_schema(schema.outputs, pass_io('output'))))
   # ========== end of Input Output ==============
 
   # ========== Attributes ==============
@@ -285,9 +319,10 @@ def gen_interpreter_substitution_hash(schema):
     attr['attr_type_ah'] = attr_type_accessor_head_map[attr['attr_type']]
     if attr['attr_type'][-1] == 's':
       attr['attr_type'] = attr_type_map[attr['attr_type']]
+      attr['attr_ptr_type'] = attr['attr_type'] + ('*' if attr['attr_type'][-1] == '*' else ' *')
       return [
         'int32_t number_of_{attr_name} = pOp.get{AttrName}().vector().size();'.format(**attr),
-        '{attr_type} {attr_name}[number_of_{attr_name}];'.format(**attr),
+        '{attr_ptr_type}{attr_name} = m_Plan.allocate<{attr_type}>(number_of_{attr_name});'.format(**attr),
         'for (int i = 0; i < number_of_{attr_name}; ++i) {attr_name}[i] = {attr_type_ah}pOp.get{AttrName}().at(i){attr_type_at};'.format(**attr),
       ]
     else:
@@ -306,7 +341,7 @@ def gen_interpreter_substitution_hash(schema):
         ', {attr_name}'.format(**attr)
       ]
   hash['visitor_prepare_attribute'] = '\n  '.join(flatten(for_attr(prepare_attr)))
-  hash['visitor_pass_attribute'] = '\n    '.join(flatten(for_attr(pass_attr)))
+  hash['visitor_pass_attribute'] = '\n      '.join(flatten(for_attr(pass_attr)))
   # ========== end of Attributes ==============
   return hash
 
@@ -323,7 +358,7 @@ def gen_interpreter(operator_schemas, template_filename, visitor_template_filena
   ComputeIR_includes = []
   interpreter_visitors = []
   # XXX: GraphAttr bug
-  SKIP_OPERS = ['If', 'Loop', 'Scan'] 
+  SKIP_OPERS = ['If', 'Loop', 'Scan'] + INTERPRETER_CUSTOM_OPERS
   # TODO: Refactor to simple data structure and simple for loop
   for domain, supportmap in operator_schemas:
     for _, namemap in supportmap:
@@ -349,6 +384,139 @@ def gen_interpreter(operator_schemas, template_filename, visitor_template_filena
   template_file.close()
   return
 
+def gen_code_emit_substitution_hash(schema):
+  hash = {
+    'OperatorName': schema.name,
+    'operator_name': schema.name.lower(),
+  }
+
+  # ========== Input Output ==============
+  def for_io_schema(io_schemas, cb):
+    def transform_io_schema(idx, io_schema):
+      return {
+        'idx': idx,
+        'io_name': io_schema.name,
+        'option': io_schema.option,
+      }
+    return [cb(transform_io_schema(idx, io_schema)) for idx, io_schema in enumerate(io_schemas)]
+
+  def emit_io(prefix):
+    def cb(io_schema):
+      io_schema['prefix'] = prefix
+      io_schema['Prefix'] = to_camel_case(prefix)
+      if io_schema['option'] == OpSchema.FormalParameterOption.Single:
+        return 'call.tensor("{prefix}_{io_name}", pOp.get{Prefix}({idx}));'.format(**io_schema)
+      elif io_schema['option'] == OpSchema.FormalParameterOption.Optional:
+        return 'call.tensor("{prefix}_{io_name}", pOp.getNumOf{Prefix}s() > {idx} ? pOp.get{Prefix}({idx}) : nullptr);'.format(**io_schema)
+      elif io_schema['option'] == OpSchema.FormalParameterOption.Variadic:
+        return 'call.tensors("{prefix}_{io_name}", RuntimeCall::{Prefix}s(pOp, {idx}));'.format(**io_schema)
+    return cb
+
+  # ${code_emit_input}
+  hash['code_emit_input'] = '\n  '.join(for_io_schema(schema.inputs, emit_io('input')))
+  # ${code_emit_output}
+  hash['code_emit_output'] = '\n  '.join(for_io_schema(schema.outputs, emit_io('output')))
+  # ========== end of Input Output ==============
+
+  # ========== Attributes ==============
+  attrs = []
+  if schema.attributes:
+    attrs = [attr for _, attr in sorted(schema.attributes.items())]
+  # RuntimeCall::attribute is overloaded on the type of the attribute.
+  hash['code_emit_attribute'] = '\n  '.join([
+    'call.attribute("{attr_name}", pOp.get{AttrName}());'.format(
+      attr_name=attr.name, AttrName=to_camel_case(attr.name))
+    for attr in attrs])
+  # ========== end of Attributes ==============
+  return hash
+
+def gen_code_emit_visitor(operator_schemas, template_filename, visitor_template_filename, dist):
+  template_file = open(visitor_template_filename)
+  visitor_template = Template(template_file.read())
+  template_file.close()
+
+  ComputeIR_includes = []
+  code_emit_visitors = []
+  # XXX: GraphAttr bug
+  SKIP_OPERS = ['If', 'Loop', 'Scan'] + CODE_EMIT_CUSTOM_OPERS
+  for domain, supportmap in operator_schemas:
+    for _, namemap in supportmap:
+      for op_type, schema, versions in namemap:
+        if schema.name in SKIP_OPERS:
+          continue
+        substitution_hash = gen_code_emit_substitution_hash(schema)
+        # ${code_emit_visitors}
+        ComputeIR_includes.append('#include <onnc/IR/Compute/{OperatorName}.h>'.format(**substitution_hash))
+        code_emit_visitors.append(visitor_template.substitute(substitution_hash))
+
+  substitution_hash = {
+    'ComputeIR_includes': '\n'.join(ComputeIR_includes),
+    'code_emit_visitors': '\n\n'.join(code_emit_visitors),
+  }
+
+  template_file = open(template_filename)
+  template_str = template_file.read()
+  out_file = open(dist, 'w')
+  out_file.write(Template(template_str).substitute(substitution_hash))
+  out_file.close()
+  template_file.close()
+  return
+
+def gen_compute_archive_substitution_hash(schema):
+  hash = {
+    'OperatorName': schema.name,
+  }
+
+  attrs = []
+  if schema.attributes:
+    attrs = [attr for _, attr in sorted(schema.attributes.items())]
+  # The operator is created with the default values of its required
+  # attributes, and reading overwrites them.
+  hash['required_attr_types'] = ''.join([
+    ', ' + to_camel_case(format_attr_type(attr.type)) + 'Attr'
+    for attr in attrs if attr.required])
+  # ComputeArchive::transfer is overloaded on the type of the attribute.
+  hash['archive_attribute'] = ''.join([
+    '  transfer(pOp, &{OperatorName}::get{AttrName}, &{OperatorName}::set{AttrName});\n'.format(
+      OperatorName=schema.name, AttrName=to_camel_case(attr.name))
+    for attr in attrs])
+  return hash
+
+def gen_compute_archive(operator_schemas, template_filename, visitor_template_filename, dist):
+  template_file = open(visitor_template_filename)
+  visitor_template = Template(template_file.read())
+  template_file.close()
+
+  ComputeIR_includes = []
+  archive_creators = []
+  archive_visitors = []
+  # XXX: GraphAttr bug
+  SKIP_OPERS = ['If', 'Loop', 'Scan'] + ARCHIVE_SKIP_OPERS
+  for domain, supportmap in operator_schemas:
+    for _, namemap in supportmap:
+      for op_type, schema, versions in namemap:
+        if schema.name in SKIP_OPERS:
+          continue
+        substitution_hash = gen_compute_archive_substitution_hash(schema)
+        # ${archive_visitors}
+        ComputeIR_includes.append('#include <onnc/IR/Compute/{OperatorName}.h>'.format(**substitution_hash))
+        archive_creators.append('pCreators["{OperatorName}"] = Create<{OperatorName}{required_attr_types}>;'.format(**substitution_hash))
+        archive_visitors.append(visitor_template.substitute(substitution_hash))
+
+  substitution_hash = {
+    'ComputeIR_includes': '\n'.join(ComputeIR_includes),
+    'archive_creators': '\n  '.join(archive_creators),
+    'archive_visitors': '\n\n'.join(archive_visitors),
+  }
+
+  template_file = open(template_filename)
+  template_str = template_file.read()
+  out_file = open(dist, 'w')
+  out_file.write(Template(template_str).substitute(substitution_hash))
+  out_file.close()
+  template_file.close()
+  return
+
 if __name__ == '__main__':
   # domain -> support level -> name -> [schema]
   index = defaultdict(lambda: defaultdict(lambda: defaultdict(list)))  # type: Dict[Text, Dict[int, Dict[Text, List[OpSchema]]]]
@@ -386,3 +554,5 @@ if __name__ == '__main__':
   gen_operator_runtime(operator_schemas, 'operator.template.h', output_dir + 'include/' + operator_path + '/${operator_name}.h')
   gen_operator_runtime(operator_schemas, 'operator.template.c', output_dir + 'lib/' + operator_path + '/${operator_name}.c')
   gen_interpreter(operator_schemas, 'Interpreter.template.cpp', 'Interpreter.visitor.template.cpp', output_dir + 'Interpreter.cpp')
+  gen_code_emit_visitor(operator_schemas, 'X86CodeEmitVisitor.template.cpp', 'X86CodeEmitVisitor.visitor.template.cpp', output_dir + 'X86CodeEmitVisitor.cpp')
+  gen_compute_archive(operator_schemas, 'ComputeArchiveVisitor.template.cpp', 'ComputeArchiveVisitor.visitor.template.cpp', output_dir + 'ComputeArchiveVisitor.cpp')
@@ -0,0 +1,257 @@
+//===- JITCompiler.cpp ----------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "JITCompiler.h"
+#include <onnc/Support/Directory.h>
+#include <onnc/Support/FileSystem.h>
+#include <onnc/Support/IOStream.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <unistd.h>
+
+using namespace onnc;
+
+namespace {
+
+/// Bump it when the emitted code or the runtime changes incompatibly.
+const char kMagic[8] = { 'O', 'N', 'N', 'C', 'J', 'I', 'T', '1' };
+
+/// Specialize the runtime kernels for the constants of the emitted code.
+/// Kernels keep calling their own copies, even if the process has another
+/// ONNC Runtime.
+const char* kFlags = "-std=gnu99 -O3 -march=native -flto -fPIC -shared "
+                     "-fno-semantic-interposition -Wl,-Bsymbolic";
+
+/// 64-bit FNV-1a
+uint64_t Hash(const std::string& pData, uint64_t pValue)
+{
+  for (unsigned char c : pData) {
+    pValue ^= c;
+    pValue *= 1099511628211ULL;
+  }
+  return pValue;
+}
+
+/// Hash the content of pFile. A missing file hashes as empty.
+uint64_t HashFile(const Path& pFile, uint64_t pValue)
+{
+  std::ifstream file(pFile.native(), std::ios::binary);
+  std::stringstream content;
+  content << file.rdbuf();
+  return Hash(pFile.native() + '\n' + content.str(), pValue);
+}
+
+/// Hash the content of every file under pDir, in a stable order.
+uint64_t HashTree(const Path& pDir, uint64_t pValue)
+{
+  std::vector<std::string> paths;
+  Directory dir(pDir);
+  Directory::const_iterator entry, eEnd = dir.end();
+  for (entry = dir.begin(); entry != eEnd; entry.next()) {
+    Path path(pDir);
+    path.append(entry.fileInfo().path());
+    paths.push_back(path.native());
+  }
+  std::sort(paths.begin(), paths.end());
+  for (const std::string& path : paths) {
+    if (is_directory(path))
+      pValue = HashTree(path, pValue);
+    else if (is_regular(path))
+      pValue = HashFile(path, pValue);
+  }
+  return pValue;
+}
+
+/// @return The standard output of pCommand, or an empty string.
+std::string Output(const std::string& pCommand)
+{
+  std::string output;
+  FILE* pipe = ::popen(pCommand.c_str(), "r");
+  if (nullptr == pipe)
+    return output;
+  char buffer[256];
+  size_t size;
+  while (0 != (size = fread(buffer, 1, sizeof(buffer), pipe)))
+    output.append(buffer, size);
+  ::pclose(pipe);
+  return output;
+}
+
+/// @return The model and the features of the host CPU, which -march=native
+///         compiles for.
+std::string HostCPU()
+{
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line, result;
+  while (std::getline(cpuinfo, line)) {
+    if (0 == line.compare(0, 10, "model name") ||
+        0 == line.compare(0, 5, "flags") ||
+        0 == line.compare(0, 8, "Features")) {
+      result += line + '\n';
+      // the first processor describes the others
+      if ('m' != line[0])
+        break;
+    }
+  }
+  return result;
+}
+
+std::string Quote(const std::string& pArgument)
+{
+  std::string result = "'";
+  for (char c : pArgument) {
+    if ('\'' == c)
+      result += "'\\''";
+    else
+      result += c;
+  }
+  return result + "'";
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// JITCompiler
+//===----------------------------------------------------------------------===//
+JITCompiler::JITCompiler(const Path& pCacheDir, const Path& pSourceDir,
+                         const std::string& pCompiler, unsigned int pVerbose)
+  : m_CacheDir(pCacheDir), m_SourceDir(pSourceDir), m_Compiler(pCompiler),
+    m_Verbose(pVerbose) {
+}
+
+std::vector<std::string>
+JITCompiler::getRuntimeSources(const std::string& pCode) const
+{
+  Path runtime(m_SourceDir);
+  runtime.append("lib/Runtime");
+
+  // The kernel of an operator is in a file named after it. Kernels may call
+  // the kernels of other operators, like fusedgemm calls gemm, so the files
+  // of the operators they call are compiled, too.
+  std::set<std::string> operators;
+  std::vector<std::string> sources;
+  std::vector<std::string> pending(1, pCode);
+  std::regex call("ONNC_RUNTIME_([a-z0-9]+)_(float|mixed)\\(");
+  while (!pending.empty()) {
+    std::string code;
+    code.swap(pending.back());
+    pending.pop_back();
+    std::sregex_iterator match(code.begin(), code.end(), call), mEnd;
+    for (; match != mEnd; ++match) {
+      const std::string op = (*match)[1].str();
+      if (!operators.insert(op).second)
+        continue;
+      Path source(runtime);
+      source.append("operator/" + op + ".c");
+      sources.push_back(source.native());
+      // The compiler reports missing files.
+      std::ifstream file(source.native());
+      std::stringstream content;
+      content << file.rdbuf();
+      pending.push_back(content.str());
+    }
+  }
+  std::sort(sources.begin(), sources.end());
+
+  // Kernels share the internal sources.
+  Path internal(runtime);
+  internal.append("internal");
+  std::vector<std::string> shared;
+  Directory dir(internal);
+  Directory::const_iterator entry, eEnd = dir.end();
+  for (entry = dir.begin(); entry != eEnd; entry.next()) {
+    Path path(internal);
+    path.append(entry.fileInfo().path());
+    if (is_regular(path) && "c" == path.extension().native())
+      shared.push_back(path.native());
+  }
+  std::sort(shared.begin(), shared.end());
+  sources.insert(sources.end(), shared.begin(), shared.end());
+
+  Path main(runtime);
+  main.append("onnc-runtime.c");
+  sources.push_back(main.native());
+  return sources;
+}
+
+bool JITCompiler::compile(const Path& pSource, Path& pLibrary) const
+{
+  std::ifstream file(pSource.native());
+  if (!file) {
+    errs() << "can not read " << pSource << std::endl;
+    return false;
+  }
+  std::stringstream code;
+  code << file.rdbuf();
+
+  Path include(m_SourceDir);
+  include.append("include");
+  std::string arguments =
+      std::string(kFlags) + " -I" + Quote(include.native());
+  std::vector<std::string> sources = getRuntimeSources(code.str());
+  std::string runtime;
+  for (const std::string& source : sources)
+    runtime += " " + Quote(source);
+
+  // Everything the object depends on: the emitted code, the runtime it
+  // is compiled with, the compiler and the CPU -march=native targets.
+  uint64_t hash = 14695981039346656037ULL;
+  hash = Hash(std::string(kMagic, sizeof(kMagic)), hash);
+  hash = Hash(code.str(), hash);
+  hash = Hash(m_Compiler + ' ' + arguments, hash);
+  for (const std::string& source : sources)
+    hash = HashFile(source, hash);
+  Path headers(include);
+  headers.append("onnc/Runtime");
+  hash = HashTree(headers, hash);
+  Path internal(m_SourceDir);
+  internal.append("lib/Runtime/internal");
+  hash = HashTree(internal, hash);
+  hash = Hash(Output(m_Compiler + " --version 2>&1"), hash);
+  hash = Hash(HostCPU(), hash);
+  char key[17];
+  snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+
+  pLibrary = m_CacheDir;
+  pLibrary.append(std::string(key) + ".so");
+  if (exists(pLibrary)) {
+    if (m_Verbose >= 1)
+      outs() << "[v1] JIT cache hit: " << pLibrary << std::endl;
+    return true;
+  }
+
+  if (!exists(m_CacheDir) && !mkdir(m_CacheDir, 0755).isGood()) {
+    errs() << "can not create " << m_CacheDir << std::endl;
+    return false;
+  }
+
+  // Compile to a private file and rename it, so that concurrent runs never
+  // load a partial object.
+  std::string temp = pLibrary.native() + "." + std::to_string(::getpid());
+  std::string command = m_Compiler + ' ' + arguments + " -o " + Quote(temp) +
+                        ' ' + Quote(pSource.native()) + runtime +
+                        " -lm -lpthread";
+  if (m_Verbose >= 2)
+    outs() << "[v2] " << command << std::endl;
+  if (0 != std::system(command.c_str())) {
+    errs() << "failed to compile " << pSource << std::endl;
+    std::remove(temp.c_str());
+    return false;
+  }
+  if (0 != std::rename(temp.c_str(), pLibrary.c_str())) {
+    std::remove(temp.c_str());
+    return false;
+  }
+  if (m_Verbose >= 1)
+    outs() << "[v1] JIT compiled: " << pLibrary << std::endl;
+  return true;
+}
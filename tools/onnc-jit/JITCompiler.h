@@ -0,0 +1,53 @@
+//===- JITCompiler.h ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_JUST_IN_TIME_INTERPRETER_JIT_COMPILER_H
+#define ONNC_JUST_IN_TIME_INTERPRETER_JIT_COMPILER_H
+#include <onnc/Support/Path.h>
+#include <string>
+#include <vector>
+
+/** \class JITCompiler
+ *  \brief Compile the C code emitted by the x86 backend into a shared
+ *  object with the host compiler.
+ *
+ *  The emitted code passes the dimensions and attributes of every operator
+ *  as constants. The ONNC Runtime kernels it calls are compiled in the same
+ *  link-time optimized object, so the compiler propagates the constants
+ *  into the kernels and unrolls and vectorizes their loops for the shapes
+ *  of the model.
+ *
+ *  Shared objects are cached by the hash of the emitted code and of the
+ *  compile command. Weights are not part of the code, so models differing
+ *  only in their weights share one object.
+ */
+class JITCompiler
+{
+public:
+  /// @param pCacheDir  Where shared objects are kept. Created on demand.
+  /// @param pSourceDir The ONNC source tree with include/ and lib/Runtime/.
+  /// @param pCompiler  The C compiler driver.
+  JITCompiler(const onnc::Path& pCacheDir, const onnc::Path& pSourceDir,
+              const std::string& pCompiler, unsigned int pVerbose = 0);
+
+  /// Compile @ref pSource unless the cache already has it.
+  /// @param[out] pLibrary The shared object of @ref pSource.
+  /// @retval false If @ref pSource can't be read or the compiler fails.
+  bool compile(const onnc::Path& pSource, onnc::Path& pLibrary) const;
+
+private:
+  /// @return The runtime sources the emitted @ref pCode needs.
+  std::vector<std::string> getRuntimeSources(const std::string& pCode) const;
+
+private:
+  onnc::Path m_CacheDir;
+  onnc::Path m_SourceDir;
+  std::string m_Compiler;
+  unsigned int m_Verbose;
+};
+
+#endif
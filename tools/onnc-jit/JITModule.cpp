@@ -0,0 +1,147 @@
+//===- JITModule.cpp ------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "JITModule.h"
+#include <algorithm>
+#include <cstring>
+#include <dlfcn.h>
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/onnc-runtime-internal.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+namespace {
+
+/// Tensors in a tensor table start at multiples of this.
+const uint64_t kTensorAlignment = 64;
+
+template<typename SymbolType>
+bool Lookup(void* pHandle, const char* pName, SymbolType& pSymbol,
+            std::string& pError)
+{
+  pSymbol = reinterpret_cast<SymbolType>(dlsym(pHandle, pName));
+  if (nullptr == pSymbol)
+    pError = std::string("missing symbol ") + pName;
+  return nullptr != pSymbol;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// JITModule
+//===----------------------------------------------------------------------===//
+JITModule::JITModule()
+  : m_pHandle(nullptr), m_pMain(nullptr), m_pShutdown(nullptr),
+    m_pContext(nullptr), m_pWeights(), m_InputSize(), m_OutputSize(),
+    m_Inputs(), m_Outputs() {
+}
+
+JITModule::~JITModule()
+{
+  if (nullptr != m_pContext)
+    m_pShutdown(m_pContext);
+  if (nullptr != m_pHandle)
+    dlclose(m_pHandle);
+}
+
+void JITModule::Layout(const std::vector<size_t>& pSizes,
+                       std::vector<uint64_t>& pTable)
+{
+  // struct ONNC_RUNTIME_Tensor_offset_table
+  uint64_t offset = (2 + 2 * pSizes.size()) * sizeof(uint64_t);
+  std::vector<uint64_t> header(2 + 2 * pSizes.size(), 0);
+  memcpy(header.data(), ONNC_RUNTIME_TENSOR_FILE_MAGIC, 4);
+  header[1] = pSizes.size();
+  for (size_t i = 0; i < pSizes.size(); ++i) {
+    offset = (offset + kTensorAlignment - 1) / kTensorAlignment *
+             kTensorAlignment;
+    header[2 + 2 * i] = offset;
+    header[3 + 2 * i] = pSizes[i];
+    offset += pSizes[i];
+  }
+  pTable.assign((offset + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+  std::copy(header.begin(), header.end(), pTable.begin());
+}
+
+void* JITModule::At(const std::vector<uint64_t>& pTable, unsigned int pIdx)
+{
+  const char* table = reinterpret_cast<const char*>(pTable.data());
+  return const_cast<char*>(table) + pTable[2 + 2 * pIdx];
+}
+
+bool JITModule::load(const Path& pLibrary, const Path& pWeights,
+                     std::string& pError)
+{
+  m_pHandle = dlopen(pLibrary.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (nullptr == m_pHandle) {
+    pError = dlerror();
+    return false;
+  }
+
+  InitFn init = nullptr;
+  const uint32_t* num_inputs = nullptr;
+  const uint32_t* num_outputs = nullptr;
+  const size_t* input_size = nullptr;
+  const size_t* output_size = nullptr;
+  if (!Lookup(m_pHandle, "model_main", m_pMain, pError) ||
+      !Lookup(m_pHandle, "ONNC_RUNTIME_init_runtime", init, pError) ||
+      !Lookup(m_pHandle, "ONNC_RUNTIME_shutdown_runtime", m_pShutdown,
+              pError) ||
+      !Lookup(m_pHandle, "onnc_num_inputs", num_inputs, pError) ||
+      !Lookup(m_pHandle, "onnc_num_outputs", num_outputs, pError) ||
+      !Lookup(m_pHandle, "onnc_input_size", input_size, pError) ||
+      !Lookup(m_pHandle, "onnc_output_size", output_size, pError))
+    return false;
+
+  m_pWeights = MemoryMap::mapFile(pWeights.native());
+  if (!m_pWeights) {
+    pError = "can not map " + pWeights.native();
+    return false;
+  }
+
+  m_InputSize.assign(input_size, input_size + *num_inputs);
+  m_OutputSize.assign(output_size, output_size + *num_outputs);
+  Layout(m_InputSize, m_Inputs);
+  Layout(m_OutputSize, m_Outputs);
+
+  // Kernels never write weights.
+  Context* context = static_cast<Context*>(init());
+  context->weight_context = const_cast<char*>(m_pWeights->start());
+  context->input_context = m_Inputs.data();
+  context->output_context = m_Outputs.data();
+  m_pContext = context;
+  return true;
+}
+
+bool JITModule::setInput(unsigned int pIdx, const void* pData, size_t pSize)
+{
+  if (pIdx >= m_InputSize.size() || pSize != m_InputSize[pIdx])
+    return false;
+  memcpy(At(m_Inputs, pIdx), pData, pSize);
+  return true;
+}
+
+void JITModule::run()
+{
+  m_pMain(m_pContext);
+}
+
+void JITModule::printOutputs(OStream& pOS) const
+{
+  for (unsigned int i = 0; i < m_OutputSize.size(); ++i) {
+    const float *values = static_cast<const float *>(At(m_Outputs, i));
+    pOS << '[';
+    for (size_t j = 0; j < m_OutputSize[i] / sizeof(float); ++j) {
+      pOS << std::fixed << values[j] << ", ";
+    }
+    pOS << ']' << std::endl;
+  }
+}
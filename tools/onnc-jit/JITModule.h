@@ -0,0 +1,74 @@
+//===- JITModule.h --------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ONNC_JUST_IN_TIME_INTERPRETER_JIT_MODULE_H
+#define ONNC_JUST_IN_TIME_INTERPRETER_JIT_MODULE_H
+#include <onnc/Support/IOStream.h>
+#include <onnc/Support/MemoryMap.h>
+#include <onnc/Support/Path.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \class JITModule
+ *  \brief A model compiled by JITCompiler, loaded in the process.
+ *
+ *  The shared object has its own copy of ONNC Runtime, so its context comes
+ *  from its own ONNC_RUNTIME_init_runtime(). Weights stay in the mapped
+ *  weight file; inputs and outputs are tensor tables owned by the module.
+ */
+class JITModule
+{
+public:
+  JITModule();
+
+  ~JITModule();
+
+  /// Load the shared object @ref pLibrary and map its weights.
+  /// @retval false If something is missing. @ref pError tells what.
+  bool load(const onnc::Path& pLibrary, const onnc::Path& pWeights,
+            std::string& pError);
+
+  unsigned int getNumOfInputs() const { return m_InputSize.size(); }
+
+  size_t getInputSize(unsigned int pIdx) const { return m_InputSize[pIdx]; }
+
+  /// Copy @ref pSize bytes of @ref pData to input @ref pIdx.
+  /// @retval false If the size doesn't match the input.
+  bool setInput(unsigned int pIdx, const void* pData, size_t pSize);
+
+  void run();
+
+  void printOutputs(onnc::OStream& pOS) const;
+
+private:
+  typedef void (*MainFn)(void*);
+  typedef void* (*InitFn)();
+  typedef bool (*ShutdownFn)(void*);
+
+  /// Lay out a tensor table of tensors of @ref pSizes in @ref pTable.
+  static void Layout(const std::vector<size_t>& pSizes,
+                     std::vector<uint64_t>& pTable);
+
+  /// @return The address of tensor @ref pIdx of @ref pTable.
+  static void* At(const std::vector<uint64_t>& pTable, unsigned int pIdx);
+
+private:
+  void* m_pHandle;
+  MainFn m_pMain;
+  ShutdownFn m_pShutdown;
+  void* m_pContext;
+  std::unique_ptr<onnc::MemoryMap> m_pWeights;
+  std::vector<size_t> m_InputSize;
+  std::vector<size_t> m_OutputSize;
+  std::vector<uint64_t> m_Inputs;  ///< tensor table, 8-byte aligned
+  std::vector<uint64_t> m_Outputs; ///< tensor table, 8-byte aligned
+};
+
+#endif
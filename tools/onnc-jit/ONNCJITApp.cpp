@@ -6,7 +6,11 @@
 //
 //===----------------------------------------------------------------------===//
 #include "ONNCJITApp.h"
+#include "JITCompiler.h"
+#include "JITModule.h"
 #include <cstdlib>
+#include <onnc/CodeGen/CompiledModuleCache.h>
+#include <onnc/Config/ONNX.h>
 #include <onnc/Target/TargetSelect.h>
 #include <onnc/Target/TargetRegistry.h>
 #include <onnc/Target/TargetBackend.h>
@@ -17,6 +21,8 @@
 #include <onnc/Core/PassManager.h>
 #include <onnc/ADT/Color.h>
 #include <onnc/Support/IOStream.h>
+#include <fstream>
+#include <memory>
 #include <string>
 
 using namespace onnc;
@@ -37,14 +43,6 @@ ONNCJITApp::~ONNCJITApp()
 
 int ONNCJITApp::run()
 {
-  onnc::onnx::Reader reader;
-  Module module;
-  SystemError err = reader.parse(options().input(), module);
-  if (!err.isGood()) {
-    // TODO: show error message
-    return EXIT_FAILURE;
-  }
-
   std::string error;
   std::string quadruple;
   options().quadruple().canonical(quadruple);
@@ -56,14 +54,81 @@ int ONNCJITApp::run()
     return EXIT_FAILURE;
   }
 
+  // Only the x86 backend emits C code.
+  if ("x86" != target->name() && "x86-64" != target->name()) {
+    errs() << Color::RED << "Error" << Color::RESET
+           << ": onnc-jit can not compile for target `" << target->name()
+           << '`' << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::unique_ptr<TargetBackend> backend(
+      target->createBackend(options().target()));
+
+  // Compiled modules are kept next to the shared objects. A cached module
+  // goes straight to code emission.
+  CompiledModuleCache cache(options().cacheDir());
+  std::string key = CompiledModuleCache::key(options().input(), target->name(),
+                                             options().target());
+  Module module;
+  bool hit = !key.empty() && cache.load(key, options().input(), module);
+  if (!key.empty() && options().verbose() >= 1) {
+    outs() << "[v1] compiled module cache " << (hit ? "hit: " : "miss: ") << key
+           << std::endl;
+  }
+
+  std::unique_ptr<Module> parsed;
   PassManager pm;
-  TargetBackend* backend = target->createBackend(options().target());
-  backend->addTensorSel(pm);
-  backend->addMemAlloc(pm);
+  if (!hit) {
+    // A failed load may have left part of a module behind.
+    parsed.reset(new Module());
+    onnc::onnx::Reader reader;
+    SystemError err = reader.parse(options().input(), *parsed);
+    if (!err.isGood()) {
+      // TODO: show error message
+      return EXIT_FAILURE;
+    }
+    backend->addTensorSel(pm);
+    backend->addTensorSched(pm);
+    backend->addMemAlloc(pm);
+    if (!key.empty())
+      pm.add(CreateStoreCompiledModulePass(cache, key, options().input()));
+  }
   backend->addCodeEmit(pm, options().output());
 
-  pm.run(module);
+  if (!pm.run(hit ? module : *parsed))
+    return EXIT_FAILURE;
+
+  JITCompiler compiler(options().cacheDir(), options().sourceDir(),
+                       options().compiler(), options().verbose());
+  Path library;
+  if (!compiler.compile(options().output(), library))
+    return EXIT_FAILURE;
+
+  if (options().tensor().empty())
+    return EXIT_SUCCESS;
+
+  JITModule jit;
+  Path weights(options().output().native() + ".weight");
+  if (!jit.load(library, weights, error)) {
+    errs() << Color::RED << "Error" << Color::RESET
+           << ": can not load `" << library << "`: " << error << std::endl;
+    return EXIT_FAILURE;
+  }
 
-  // TODO: just-in-time interpreter starts from here
+  // FIXME: Use onnc-runtime to handle input
+  xTensorProto tensor;
+  std::ifstream input_fin(options().tensor().native());
+  tensor.ParseFromIstream(&input_fin);
+  const std::string &raw_data_str = tensor.raw_data();
+  if (!jit.setInput(0, raw_data_str.data(), raw_data_str.size())) {
+    errs() << Color::RED << "Error" << Color::RESET
+           << ": input `" << options().tensor() << "` has "
+           << raw_data_str.size() << " bytes, but the model expects "
+           << (jit.getNumOfInputs() ? jit.getInputSize(0) : 0) << std::endl;
+    return EXIT_FAILURE;
+  }
+  jit.run();
+  jit.printOutputs(outs());
   return EXIT_SUCCESS;
 }
@@ -13,7 +13,9 @@ using namespace onnc;
 // ONNCJITConfig
 //===----------------------------------------------------------------------===//
 ONNCJITConfig::ONNCJITConfig()
-  : m_Input(), m_Output(), m_Quadruple(), m_Arch(), m_TargetOptions() {
+  : m_Input(), m_Output(), m_Quadruple(), m_Arch(), m_TargetOptions(),
+    m_Verbose(), m_Tensor(), m_CacheDir(), m_SourceDir(),
+    m_Compiler(DefaultCompiler) {
 }
 
 ONNCJITConfig::~ONNCJITConfig()
@@ -11,6 +11,7 @@
 #include <onnc/Support/Path.h>
 #include <onnc/IR/Quadruple.h>
 #include <onnc/Target/TargetOptions.h>
+#include <string>
 #include <vector>
 
 /** \class ONNCJITConfig
@@ -19,7 +20,10 @@
 class ONNCJITConfig
 {
 public:
-  static constexpr const char* DefaultOutputName = "a.out";
+  /// The emitted C code; its weights go to <output>.weight.
+  static constexpr const char* DefaultOutputName = "a.c";
+
+  static constexpr const char* DefaultCompiler = "cc";
 
   enum VerboseLevel : int {
     kQuiet = 0,
@@ -59,6 +63,25 @@ public:
 
   unsigned int verbose() const { return m_Verbose; }
 
+  /// The tensor to run the model on. An empty path only compiles it.
+  const onnc::Path& tensor() const { return m_Tensor; }
+
+  void setTensor(const onnc::Path& pFilePath) { m_Tensor = pFilePath; }
+
+  /// Where compiled models are cached.
+  const onnc::Path& cacheDir() const { return m_CacheDir; }
+
+  void setCacheDir(const onnc::Path& pDir) { m_CacheDir = pDir; }
+
+  /// The ONNC source tree, which has the runtime compiled with models.
+  const onnc::Path& sourceDir() const { return m_SourceDir; }
+
+  void setSourceDir(const onnc::Path& pDir) { m_SourceDir = pDir; }
+
+  const std::string& compiler() const { return m_Compiler; }
+
+  void setCompiler(const std::string& pCompiler) { m_Compiler = pCompiler; }
+
 private:
   onnc::Path m_Input;
   onnc::Path m_Output;
@@ -66,6 +89,10 @@ private:
   std::string m_Arch;
   onnc::TargetOptions m_TargetOptions;
   unsigned int m_Verbose;
+  onnc::Path m_Tensor;
+  onnc::Path m_CacheDir;
+  onnc::Path m_SourceDir;
+  std::string m_Compiler;
 };
 
 #endif
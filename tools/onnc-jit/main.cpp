@@ -11,6 +11,7 @@
 #include <onnc/Support/IOStream.h>
 #include <onnc/Option/CommandLine.h>
 #include <onnc/Config/AboutData.h>
+#include <cstdlib>
 
 using namespace onnc;
 
@@ -64,6 +65,43 @@ static cl::opt<std::string> OptQuadruple("mquadruple", cl::kShort, cl::kOptional
 static cl::opt<std::string> OptMArch("march", cl::kShort, cl::kOptional,
     cl::kValueRequired, cl::desc("target architecture"), cl::about(g_About));
 
+static cl::opt<Path> OptTensor("tensor", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Run the compiled model on the ONNX tensor in <file> and print "
+             "its outputs."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptCacheDir("cache-dir", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Keep compiled models in <dir> (default is "
+             "$XDG_CACHE_HOME/onnc-jit or ~/.cache/onnc-jit)."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptSourceDir("source-dir", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("The ONNC source tree whose runtime is compiled with models."),
+    cl::about(g_About));
+
+static cl::opt<std::string> OptCC("cc", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("The C compiler (default is $CC or cc)."),
+    cl::about(g_About));
+
+/// $XDG_CACHE_HOME/onnc-jit, ~/.cache/onnc-jit, or a temporary directory.
+static Path GetDefaultCacheDir()
+{
+  Path dir;
+  if (const char* cache = getenv("XDG_CACHE_HOME"))
+    dir.assign(cache);
+  else if (const char* home = getenv("HOME")) {
+    dir.assign(home);
+    dir.append(".cache");
+  } else
+    dir.assign("/tmp");
+  dir.append("onnc-jit");
+  return dir;
+}
+
 //===----------------------------------------------------------------------===//
 // Main Procedure
 //===----------------------------------------------------------------------===//
@@ -120,5 +158,27 @@ int main(int pArgc, char* pArgv[])
       jit.options().setArchName(OptMArch);
   }
 
+  // --tensor=<file>
+  if (OptTensor.hasOccurrence())
+    jit.options().setTensor(OptTensor);
+
+  // --cache-dir=<dir>
+  if (OptCacheDir.hasOccurrence())
+    jit.options().setCacheDir(OptCacheDir);
+  else
+    jit.options().setCacheDir(GetDefaultCacheDir());
+
+  // --source-dir=<dir>
+  if (OptSourceDir.hasOccurrence())
+    jit.options().setSourceDir(OptSourceDir);
+  else
+    jit.options().setSourceDir(Path(TOPDIR));
+
+  // --cc=<compiler>
+  if (OptCC.hasOccurrence())
+    jit.options().setCompiler(OptCC);
+  else if (const char* cc = getenv("CC"))
+    jit.options().setCompiler(cc);
+
   return jit.run();
 }
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #include "ONNCApp.h"
 #include <cstdlib>
+#include <onnc/CodeGen/CompiledModuleCache.h>
 #include <onnc/Target/TargetSelect.h>
 #include <onnc/Target/TargetRegistry.h>
 #include <onnc/Target/TargetBackend.h>
@@ -17,6 +18,9 @@
 #include <onnc/Core/PassManager.h>
 #include <onnc/ADT/Color.h>
 #include <onnc/Support/IOStream.h>
+#include <onnc/Support/Timer.h>
+#include <algorithm>
+#include <memory>
 #include <string>
 
 using namespace onnc;
@@ -37,14 +41,6 @@ ONNCApp::~ONNCApp()
 
 int ONNCApp::compile()
 {
-  onnc::onnx::Reader reader;
-  Module module;
-  SystemError err = reader.parse(options().input(), module);
-  if (!err.isGood()) {
-    // TODO: show error message
-    return EXIT_FAILURE;
-  }
-
   std::string error;
   std::string quadruple;
   options().quadruple().canonical(quadruple);
@@ -55,14 +51,56 @@ int ONNCApp::compile()
            << std::endl;
     return EXIT_FAILURE;
   }
+  std::unique_ptr<TargetBackend> backend(
+      target->createBackend(options().target()));
 
+  // A cached module goes straight to code emission.
+  CompiledModuleCache cache(options().cacheDir());
+  std::string key;
+  if (!options().cacheDir().empty() && backend->canEmitCachedModule())
+    key = CompiledModuleCache::key(options().input(), target->name(),
+                                   options().target());
+  Module module;
+  bool hit = false;
+  if (!key.empty()) {
+    hit = cache.load(key, options().input(), module);
+    if (ONNCConfig::kNormal <= options().verbose()) {
+      outs() << "compiled module cache " << (hit ? "hit: " : "miss: ")
+             << key << std::endl;
+    }
+  }
+
+  std::unique_ptr<Module> parsed;
   PassManager pm;
-  TargetBackend* backend = target->createBackend(options().target());
-  backend->addTensorSel(pm);
-  backend->addTensorSched(pm);
-  backend->addMemAlloc(pm);
+  if (!hit) {
+    parsed.reset(new Module());
+    onnc::onnx::Reader reader;
+    Timer timer;
+    timer.start();
+    SystemError err = reader.parse(options().input(), *parsed);
+    timer.stop();
+    if (!err.isGood()) {
+      // TODO: show error message
+      return EXIT_FAILURE;
+    }
+    if (ONNCConfig::kNormal <= options().verbose()) {
+      // bytes per ns are GB/s
+      outs() << "parse: " << reader.getModelSize() << " bytes in "
+             << timer.interval() << ' ' << timer.unit() << ", "
+             << reader.getModelSize() * 1000.0 /
+                    std::max<Timer::Interval>(timer.interval(), 1)
+             << " MB/s" << std::endl;
+    }
+
+    backend->addTensorSel(pm);
+    backend->addTensorSched(pm);
+    backend->addMemAlloc(pm);
+    if (!key.empty())
+      pm.add(CreateStoreCompiledModulePass(cache, key, options().input()));
+  }
   backend->addCodeEmit(pm, options().output());
 
-  pm.run(module);
+  // A failed load may have left part of a module behind.
+  pm.run(hit ? module : *parsed);
   return EXIT_SUCCESS;
 }
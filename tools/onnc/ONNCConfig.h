@@ -59,6 +59,11 @@ public:
 
   unsigned int verbose() const { return m_Verbose; }
 
+  /// An empty path disables the compiled module cache.
+  void setCacheDir(const onnc::Path& pDir) { m_CacheDir = pDir; }
+
+  const onnc::Path& cacheDir() const { return m_CacheDir; }
+
 private:
   onnc::Path m_Input;
   onnc::Path m_Output;
@@ -66,6 +71,7 @@ private:
   std::string m_Arch;
   onnc::TargetOptions m_TargetOptions;
   unsigned int m_Verbose;
+  onnc::Path m_CacheDir;
 };
 
 #endif
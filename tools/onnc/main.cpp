@@ -58,6 +58,37 @@ OptQuiet("quiet", cl::kLong, cl::kOptional, cl::kValueDisallowed,
     cl::desc("Set verbose level to 0."),
     cl::about(g_About));
 
+static cl::opt<std::string> OptMemAlloc("mem-alloc", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Place values in memory by <strategy>: first-fit, best-fit, "
+             "greedy-by-size, skyline or minimum (default, the smallest of "
+             "all)."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptQuantize("quantize", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Run convolutions and matrix multiplications in int8 with the "
+             "ranges of the calibration table <file> (x86 only)."),
+    cl::about(g_About));
+
+static cl::opt<std::string> OptWeightType("weight-type", cl::kLong,
+    cl::kOptional, cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Store the weights of convolutions and matrix multiplications "
+             "as <type>: float (default), float16 or bfloat16 (x86 only)."),
+    cl::about(g_About));
+
+static cl::opt<std::string> OptNCHWcBlock("nchwc-block", cl::kLong,
+    cl::kOptional, cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Block the channels of convolutions by <channels>: 8 (default) "
+             "or 16, which suits AVX-512 (x86 only)."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptCacheDir("cache-dir", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Keep compiled models in <dir> and reuse them when the same "
+             "model is compiled again."),
+    cl::about(g_About));
+
 static cl::opt<std::string> OptQuadruple("mquadruple", cl::kShort, cl::kOptional,
     cl::kValueRequired, cl::desc("target quadruple"), cl::about(g_About));
     
@@ -88,6 +119,45 @@ int main(int pArgc, char* pArgv[])
     return EXIT_SUCCESS;
   }
 
+  // --mem-alloc=<strategy>
+  if (OptMemAlloc.hasOccurrence() &&
+      !onnc.options().target().setMemAllocStrategy(OptMemAlloc)) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": unknown memory allocation strategy: " << OptMemAlloc
+           << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // --quantize=<file>
+  if (OptQuantize.hasOccurrence()) {
+    if (!exists(OptQuantize)) {
+      errs() << Color::MAGENTA << "Fatal" << Color::RESET
+             << ": calibration table not found: " << OptQuantize << std::endl;
+      return EXIT_FAILURE;
+    }
+    onnc.options().target().setCalibrationTable(OptQuantize.native());
+  }
+
+  // --weight-type=<type>
+  if (OptWeightType.hasOccurrence() &&
+      !onnc.options().target().setWeightType(OptWeightType)) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": unknown weight type: " << OptWeightType << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // --nchwc-block=<channels>
+  if (OptNCHWcBlock.hasOccurrence() &&
+      !onnc.options().target().setNCHWcBlock(OptNCHWcBlock)) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": unknown NCHWc block: " << OptNCHWcBlock << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // --cache-dir=<dir>
+  if (OptCacheDir.hasOccurrence())
+    onnc.options().setCacheDir(OptCacheDir);
+
   // check inputs
   if (!exists(OptInput)) {
     errs() << Color::MAGENTA << "Fatal" << Color::RESET
@@ -7,26 +7,26 @@
 //===----------------------------------------------------------------------===//
 #include "ONNIApp.h"
 
-#include "CountOperatorsPass.h"
-#include "InterpreterPass.h"
-#include "OnnxOptPass.h"
+#include <onnc/Interpreter/Calibrator.h>
+#include <onnc/Interpreter/InferenceSession.h>
+#include <onnc/Interpreter/Profiler.h>
 
 #include <cstdlib>
 #include <onnc/Config/ONNX.h>
 #include <onnc/Target/TargetSelect.h>
 #include <onnc/Target/TargetRegistry.h>
-#include <onnc/Target/TargetBackend.h>
 #include <onnc/Target/TargetOptions.h>
-#include <onnc/IRReader/ONNXReader.h>
-#include <onnc/IR/Module.h>
 #include <onnc/IR/ONNXUtils.h>
-#include <onnc/Core/PassManager.h>
 #include <onnc/ADT/Color.h>
+#include <onnc/Support/Directory.h>
 #include <onnc/Support/IOStream.h>
 #include <onnc/Analysis/GlobalStatistics.h>
 
+#include <algorithm>
 #include <string>
 #include <fstream>
+#include <memory>
+#include <vector>
 
 using namespace onnc;
 
@@ -46,14 +46,6 @@ ONNIApp::~ONNIApp()
 
 int ONNIApp::run()
 {
-  onnc::onnx::Reader reader;
-  Module module;
-  SystemError err = reader.parse(options().model(), module);
-  if (!err.isGood()) {
-    // TODO: show error message
-    return EXIT_FAILURE;
-  }
-
   std::string error;
   std::string quadruple;
   options().quadruple().canonical(quadruple);
@@ -65,43 +57,102 @@ int ONNIApp::run()
     return EXIT_FAILURE;
   }
 
-  PassManager pm;
-
-  if (options().onnxOpt()) {
-    pm.add(CreateOnnxOptPass());
+  // The model is compiled once and every input runs on the same session.
+  InferenceSession session(options().numThreads(), options().verbose());
+  session.setCacheDirectory(options().cacheDir());
+  if (!session.load(options().model(), *target, options().target(),
+                    options().onnxOpt(), options().dryRun())) {
+    // TODO: show error message
+    return EXIT_FAILURE;
   }
 
-  TargetBackend* backend = target->createBackend(options().target());
-  backend->addTensorSel(pm);
-  backend->addTensorSched(pm);
-  backend->addMemAlloc(pm);
   if (options().verbose() >= 3) {
-    pm.add(CreateCountOperatorsPass("[Statistics] "));
+    errs() << "==== print CountOperatorsPass result again ====\n";
+    StringList opList = global::stats()->counterList();
+    for(auto listItr=opList.begin(); listItr != opList.end(); ++listItr){
+      global::stats()->printCounter(*listItr, errs());
+    }
+    errs() << "==== end again of printing CountOperatorsPass ====\n";
+  }
+
+  if (options().dryRun())
+    return EXIT_SUCCESS;
+
+  // A directory of tensors runs them in the order of their names.
+  std::vector<std::string> inputs;
+  if (is_directory(options().input())) {
+    Directory dir(options().input());
+    Directory::const_iterator entry, eEnd = dir.end();
+    for (entry = dir.begin(); entry != eEnd; entry.next()) {
+      Path path(options().input());
+      path.append(entry.fileInfo().path());
+      if (is_regular(path))
+        inputs.push_back(path.native());
+    }
+    std::sort(inputs.begin(), inputs.end());
+  } else {
+    inputs.push_back(options().input().native());
   }
 
+  // Profiled runs come after a warm-up run of each input and print their
+  // outputs only once.
+  std::unique_ptr<Profiler> profiler;
+  if (0 < options().profileRuns())
+    profiler.reset(new Profiler(session.getPlan()));
+
+  // Calibration records the first run of every input.
+  std::unique_ptr<Calibrator> calibrator;
+  if (!options().calibration().empty())
+    calibrator.reset(new Calibrator(session));
+
   // FIXME: Use onnc-runtime to handle input
-  char *input_mem = NULL;
-  if (!options().dryRun()) {
+  for (const std::string& input : inputs) {
     xTensorProto tensor;
-    std::ifstream input_fin(options().input().native());
+    std::ifstream input_fin(input);
     tensor.ParseFromIstream(&input_fin);
     const std::string &raw_data_str = tensor.raw_data();
-    input_mem = new char[raw_data_str.size()];
-    memcpy(input_mem, raw_data_str.data(), raw_data_str.size());
+    if (!session.setInput(0, raw_data_str.data(), raw_data_str.size())) {
+      errs() << Color::RED << "Error" << Color::RESET
+             << ": input `" << input << "` has " << raw_data_str.size()
+             << " bytes, but the model expects " << session.getInputSize(0)
+             << std::endl;
+      return EXIT_FAILURE;
+    }
+    session.setCalibrator(calibrator.get());
+    session.run();
+    session.setCalibrator(nullptr);
+    session.printOutputs(outs());
+    if (profiler) {
+      session.setProfiler(profiler.get());
+      for (unsigned int i = 0; i < options().profileRuns(); ++i)
+        session.run();
+      session.setProfiler(nullptr);
+    }
   }
-  pm.add(CreateInterpreterPass(backend, input_mem,
-                               options().verbose(), options().dryRun()));
-
-  pm.run(module);
 
-  if (options().verbose() >= 3) {
-    errs() << "==== print CountOperatorsPass result again ====\n";
-    StringList opList = global::stats()->counterList();
-    for(auto listItr=opList.begin(); listItr != opList.end(); ++listItr){
-      global::stats()->printCounter(*listItr, errs());
+  if (profiler) {
+    profiler->print(outs());
+    if (!options().profileJSON().empty() &&
+        !profiler->writeJSON(options().profileJSON())) {
+      errs() << Color::RED << "Error" << Color::RESET
+             << ": can not write `" << options().profileJSON().native() << '`'
+             << std::endl;
+      return EXIT_FAILURE;
     }
-    errs() << "==== end again of printing CountOperatorsPass ====\n";
+    if (!options().profileTrace().empty() &&
+        !profiler->writeTrace(options().profileTrace())) {
+      errs() << Color::RED << "Error" << Color::RESET
+             << ": can not write `" << options().profileTrace().native() << '`'
+             << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (calibrator && !calibrator->getTable().write(options().calibration())) {
+    errs() << Color::RED << "Error" << Color::RESET
+           << ": can not write `" << options().calibration().native() << '`'
+           << std::endl;
+    return EXIT_FAILURE;
   }
-  delete input_mem;
   return EXIT_SUCCESS;
 }
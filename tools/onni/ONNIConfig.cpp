@@ -15,7 +15,8 @@ using namespace onnc;
 ONNIConfig::ONNIConfig()
   : m_Model(), m_Input(), m_Output(),
     m_Quadruple(), m_Arch(), m_TargetOptions(),
-    m_Verbose(), m_DryRun(), m_OnnxOpt() {
+    m_Verbose(), m_DryRun(), m_OnnxOpt(), m_NumThreads(), m_CacheDir(),
+    m_ProfileRuns(), m_ProfileJSON(), m_ProfileTrace(), m_Calibration() {
 }
 
 ONNIConfig::~ONNIConfig()
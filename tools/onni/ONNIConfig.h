@@ -71,6 +71,37 @@ public:
 
   bool onnxOpt() const { return m_OnnxOpt; }
 
+  /// 0 means the runtime default.
+  void setNumThreads(unsigned int pNumThreads) { m_NumThreads = pNumThreads; }
+
+  unsigned int numThreads() const { return m_NumThreads; }
+
+  /// An empty path disables the compiled module cache.
+  void setCacheDir(const onnc::Path& pDir) { m_CacheDir = pDir; }
+
+  const onnc::Path& cacheDir() const { return m_CacheDir; }
+
+  /// Profile this many runs of every input; 0 disables profiling.
+  void setProfileRuns(unsigned int pRuns) { m_ProfileRuns = pRuns; }
+
+  unsigned int profileRuns() const { return m_ProfileRuns; }
+
+  /// An empty path does not save the profile in JSON.
+  void setProfileJSON(const onnc::Path& pFile) { m_ProfileJSON = pFile; }
+
+  const onnc::Path& profileJSON() const { return m_ProfileJSON; }
+
+  /// An empty path does not save the profile as a Chrome trace.
+  void setProfileTrace(const onnc::Path& pFile) { m_ProfileTrace = pFile; }
+
+  const onnc::Path& profileTrace() const { return m_ProfileTrace; }
+
+  /// Record the ranges of the values over all inputs in this calibration
+  /// table; an empty path runs inference as usual.
+  void setCalibration(const onnc::Path& pFile) { m_Calibration = pFile; }
+
+  const onnc::Path& calibration() const { return m_Calibration; }
+
 private:
   onnc::Path m_Model;
   onnc::Path m_Input;
@@ -81,6 +112,12 @@ private:
   unsigned int m_Verbose;
   bool m_DryRun;
   bool m_OnnxOpt;
+  unsigned int m_NumThreads;
+  onnc::Path m_CacheDir;
+  unsigned int m_ProfileRuns;
+  onnc::Path m_ProfileJSON;
+  onnc::Path m_ProfileTrace;
+  onnc::Path m_Calibration;
 };
 
 #endif
@@ -26,7 +26,8 @@ static cl::opt<Path> OptModel("model", cl::kPositional, cl::kOptional,
 
 static cl::opt<Path> OptInput("input", cl::kPositional, cl::kOptional,
     cl::kValueRequired,
-    cl::desc("The input file"), cl::about(g_About));
+    cl::desc("The input tensor file, or a directory of them"),
+    cl::about(g_About));
 
 static cl::opt<std::string> OptOutput("o", cl::kShort, cl::kOptional,
     cl::kValueRequired,
@@ -75,6 +76,68 @@ OptOnnxOpt("onnx-opt", cl::kLong, cl::kOptional, cl::kValueDisallowed,
     cl::desc("Enable onnx optimizer"),
     cl::about(g_About));
 
+static cl::opt<unsigned int> OptThreads("j", cl::kShort, cl::kOptional,
+    cl::kValueRequired,
+    cl::desc("Run independent operators on <number> threads. -j 1 runs them "
+             "one by one in graph order (default is $ONNC_RUNTIME_NUM_THREADS "
+             "or 1)."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptCacheDir("cache-dir", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Keep compiled models in <dir> and reuse them when the same "
+             "model is run again."),
+    cl::about(g_About));
+
+static cl::opt<unsigned int> OptProfile("profile", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Run every input <number> more times after a warm-up run and "
+             "report the time and throughput of every operator."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptProfileJSON("profile-json", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Save the profile in JSON to <file>. Implies --profile=1 "
+             "unless given."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptProfileTrace("profile-trace", cl::kLong,
+    cl::kOptional, cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Save every profiled run to <file> in the Chrome trace event "
+             "format. Implies --profile=1 unless given."),
+    cl::about(g_About));
+
+static cl::opt<std::string> OptMemAlloc("mem-alloc", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Place values in memory by <strategy>: first-fit, best-fit, "
+             "greedy-by-size, skyline or minimum (default, the smallest of "
+             "all)."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptCalibrate("calibrate", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Record the range of every value over the inputs and save them "
+             "to the calibration table <file> for --quantize."),
+    cl::about(g_About));
+
+static cl::opt<Path> OptQuantize("quantize", cl::kLong, cl::kOptional,
+    cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Run convolutions and matrix multiplications in int8 with the "
+             "ranges of the calibration table <file>."),
+    cl::about(g_About));
+
+static cl::opt<std::string> OptWeightType("weight-type", cl::kLong,
+    cl::kOptional, cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Store the weights of convolutions and matrix multiplications "
+             "as <type>: float (default), float16 or bfloat16."),
+    cl::about(g_About));
+
+static cl::opt<std::string> OptNCHWcBlock("nchwc-block", cl::kLong,
+    cl::kOptional, cl::kValueRequired, cl::kEqualSeparated,
+    cl::desc("Block the channels of convolutions by <channels>: 8 (default) "
+             "or 16, which suits AVX-512."),
+    cl::about(g_About));
+
 static cl::opt<std::string> OptQuadruple("mquadruple", cl::kShort, cl::kOptional,
     cl::kValueRequired, cl::desc("target quadruple"), cl::about(g_About));
 
@@ -105,6 +168,69 @@ int main(int pArgc, char* pArgv[])
   // --onnx-optimizer
   onni.options().setOnnxOpt(OptOnnxOpt);
 
+  // -j threads
+  if (OptThreads.hasOccurrence())
+    onni.options().setNumThreads(OptThreads);
+
+  // --mem-alloc=<strategy>
+  if (OptMemAlloc.hasOccurrence() &&
+      !onni.options().target().setMemAllocStrategy(OptMemAlloc)) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": unknown memory allocation strategy: " << OptMemAlloc
+           << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // --cache-dir=<dir>
+  if (OptCacheDir.hasOccurrence())
+    onni.options().setCacheDir(OptCacheDir);
+
+  // --profile=<runs>, --profile-json=<file>, --profile-trace=<file>
+  if (OptProfileJSON.hasOccurrence())
+    onni.options().setProfileJSON(OptProfileJSON);
+  if (OptProfileTrace.hasOccurrence())
+    onni.options().setProfileTrace(OptProfileTrace);
+  if (OptProfile.hasOccurrence())
+    onni.options().setProfileRuns(OptProfile);
+  else if (OptProfileJSON.hasOccurrence() || OptProfileTrace.hasOccurrence())
+    onni.options().setProfileRuns(1);
+
+  // --calibrate=<file>, --quantize=<file>
+  if (OptCalibrate.hasOccurrence() && OptQuantize.hasOccurrence()) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": --calibrate and --quantize can not be used together"
+           << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (OptCalibrate.hasOccurrence()) {
+    onni.options().setCalibration(OptCalibrate);
+    onni.options().target().calibrate();
+  }
+  if (OptQuantize.hasOccurrence()) {
+    if (!exists(OptQuantize)) {
+      errs() << Color::MAGENTA << "Fatal" << Color::RESET
+             << ": calibration table not found: " << OptQuantize << std::endl;
+      return EXIT_FAILURE;
+    }
+    onni.options().target().setCalibrationTable(OptQuantize.native());
+  }
+
+  // --weight-type=<type>
+  if (OptWeightType.hasOccurrence() &&
+      !onni.options().target().setWeightType(OptWeightType)) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": unknown weight type: " << OptWeightType << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // --nchwc-block=<channels>
+  if (OptNCHWcBlock.hasOccurrence() &&
+      !onni.options().target().setNCHWcBlock(OptNCHWcBlock)) {
+    errs() << Color::MAGENTA << "Fatal" << Color::RESET
+           << ": unknown NCHWc block: " << OptNCHWcBlock << std::endl;
+    return EXIT_FAILURE;
+  }
+
   // --help
   if (OptHelp) {
     g_About.print(outs(), ONNIConfig::kNormal < onni.options().verbose());
@@ -131,9 +257,10 @@ int main(int pArgc, char* pArgv[])
            << ": input file not found: " << OptInput << std::endl;
     return EXIT_FAILURE;
   }
-  if (!is_regular(OptInput)) {
+  if (!is_regular(OptInput) && !is_directory(OptInput)) {
     errs() << Color::MAGENTA << "Fatal" << Color::RESET
-           << ": input file is not a regular file: " << OptInput << std::endl;
+           << ": input is neither a regular file nor a directory: "
+           << OptInput << std::endl;
     return EXIT_FAILURE;
   }
   onni.options().setInput(OptInput);
@@ -0,0 +1,83 @@
+//===- CalibrationTableTest.cpp -------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/Analysis/CalibrationTable.h>
+#include <skypat/skypat.h>
+#include <sstream>
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// CalibrationTableTest
+//===----------------------------------------------------------------------===//
+SKYPAT_F(CalibrationTableTest, parse_bm1880_table)
+{
+  // Fields other than the names and the thresholds are skipped.
+  const char* text =
+    "name: \"lenet\"\n"
+    "# comment\n"
+    "layer {\n"
+    "  name: \"data\"\n"
+    "  threshold_y: 1.0\n"
+    "}\n"
+    "layer {\n"
+    "  name: \"conv1\"\n"
+    "  right_shift_width: 9\n"
+    "  threshold_y: 6.5\n"
+    "  threshold_x_quantized: 101\n"
+    "  convolution_param { group: 1 }\n"
+    "  blob_param {\n"
+    "    name: \"conv1_out\"\n"
+    "    threshold_y: 6.5\n"
+    "  }\n"
+    "  blob_param {\n"
+    "    name: \"conv1_mask\"\n"
+    "    threshold_y: 2e-1\n"
+    "  }\n"
+    "}\n";
+
+  CalibrationTable table;
+  ASSERT_TRUE(table.parse(text));
+  EXPECT_TRUE(table.name() == "lenet");
+  ASSERT_EQ(table.layers().size(), 2);
+  EXPECT_TRUE(table.hasThreshold("data"));
+  EXPECT_EQ(table.getThreshold("data"), 1.0f);
+  EXPECT_EQ(table.getThreshold("conv1_out"), 6.5f);
+  EXPECT_EQ(table.getThreshold("conv1_mask"), 0.2f);
+  EXPECT_FALSE(table.hasThreshold("conv1"));
+  EXPECT_EQ(table.getThreshold("conv1"), 0.f);
+}
+
+SKYPAT_F(CalibrationTableTest, print_and_parse)
+{
+  CalibrationTable table;
+  table.setName("graph");
+  table.addLayer("input", { { "x", 0.1f } });
+  table.addLayer("Conv_0", { { "y", 3.14159274f }, { "z", 12345.678f } });
+
+  std::ostringstream oss;
+  table.print(oss);
+
+  CalibrationTable other;
+  ASSERT_TRUE(other.parse(oss.str()));
+  EXPECT_TRUE(other.name() == "graph");
+  ASSERT_EQ(other.layers().size(), 2);
+  EXPECT_TRUE(other.layers()[1].name == "Conv_0");
+  EXPECT_EQ(other.getThreshold("x"), 0.1f);
+  EXPECT_EQ(other.getThreshold("y"), 3.14159274f);
+  EXPECT_EQ(other.getThreshold("z"), 12345.678f);
+}
+
+SKYPAT_F(CalibrationTableTest, malformed)
+{
+  CalibrationTable table;
+  EXPECT_FALSE(table.parse("layer { name: \"a\" threshold_y: 1.0"));
+  EXPECT_FALSE(table.parse("layer { name: \"a\" threshold_y: x }"));
+  EXPECT_FALSE(table.parse("layer { name: \"a\" } }"));
+  EXPECT_TRUE(table.layers().empty());
+  EXPECT_TRUE(table.parse(""));
+}
@@ -0,0 +1,186 @@
+//===- CompiledModuleCacheTest.cpp ----------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/CodeGen/BuildMemOperand.h>
+#include <onnc/CodeGen/CompiledModuleCache.h>
+#include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/ComputeMemOperand.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/Reshape.h>
+#include <onnc/IR/Compute/Transpose.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/MemoryMap.h>
+#include <onnc/Target/TargetOptions.h>
+#include <skypat/skypat.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace onnc;
+
+namespace {
+
+/// Stands for a model whose weights are in the file.
+Path CreateModelFile()
+{
+  Path model(BUILDDIR);
+  model.append("CompiledModuleCacheTest." + std::to_string(::getpid()) +
+               ".onnx");
+  std::ofstream file(model.native(), std::ios::binary | std::ios::trunc);
+  for (int i = 0; i < 16; ++i) {
+    float value = i;
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+  return model;
+}
+
+/// in -> Relu -> r1 -> Transpose(w) -> r2 -> Reshape(shape) -> r3 -> out
+///
+/// w refers to the values in the model file; shape owns its values.
+ComputeGraph& CreateGraph(Module& pModule, const Path& pModel)
+{
+  IRBuilder builder(pModule);
+  ComputeGraph& cg = *builder.CreateComputeGraph("cached");
+
+  auto create = [&](const char* pName, const Tensor::Dimensions& pDims) {
+    FloatTensor* t = cg.addValue<FloatTensor>(pName);
+    t->setDimensions(pDims);
+    return t;
+  };
+  FloatTensor* in = create("in", {4, 4});
+  cg.addOperator<InputOperator>()->setTensor(*in);
+
+  const MemoryMap* file = pModule.mapFile(pModel);
+  FloatTensor* w = create("w", {4, 4});
+  w->setExternalValues(reinterpret_cast<const float*>(file->start()), 16);
+  cg.addOperator<Initializer>(StringAttr("w"))->setTensor(*w);
+
+  Int64Tensor* shape = cg.addValue<Int64Tensor>("shape");
+  shape->setDimensions({1});
+  shape->getValues().push_back(16);
+  cg.addOperator<Initializer>(StringAttr("shape"))->setTensor(*shape);
+
+  Relu* relu = cg.addOperator<Relu>();
+  relu->addInput(*in);
+  relu->addOutput(*create("r1", {4, 4}));
+
+  Transpose* transpose = cg.addOperator<Transpose>(
+      IntsAttr(std::vector<int64_t>{1, 0}));
+  transpose->addInput(*cg.getValue<Tensor>("r1"));
+  transpose->addInput(*w);
+  transpose->addOutput(*create("r2", {4, 4}));
+
+  Reshape* reshape = cg.addOperator<Reshape>();
+  reshape->addInput(*cg.getValue<Tensor>("r2"));
+  reshape->addInput(*shape);
+  reshape->addOutput(*create("r3", {16}));
+
+  cg.addOperator<OutputOperator>()->addTensor(*cg.getValue<Tensor>("r3"));
+  return cg;
+}
+
+} // anonymous namespace
+
+SKYPAT_F(CompiledModuleCacheTest, store_and_load)
+{
+  Path model = CreateModelFile();
+  Path directory(BUILDDIR);
+  directory.append("CompiledModuleCacheTest." + std::to_string(::getpid()));
+  CompiledModuleCache cache(directory);
+  TargetOptions options;
+  std::string key = CompiledModuleCache::key(model, "x86_64", options);
+  ASSERT_FALSE(key.empty());
+  ASSERT_TRUE(key != CompiledModuleCache::key(model, "x86", options));
+
+  Module stored;
+  ComputeGraph& cg = CreateGraph(stored, model);
+  BuildMemOperand buildMemOpnd;
+  buildMemOpnd.runOnModule(stored);
+  uint32_t start = 0;
+  for (ComputeOperand* opnd : stored.getComputeOperands()) {
+    ComputeMemOperand* mem = cast<ComputeMemOperand>(opnd);
+    mem->setStart(start);
+    mem->setLength(64);
+    start += 64;
+  }
+
+  Module missed;
+  ASSERT_FALSE(cache.load(key, model, missed));
+  ASSERT_TRUE(cache.store(key, model, stored));
+  Module loaded;
+  ASSERT_TRUE(cache.load(key, model, loaded));
+
+  // Operators come back in graph order, with their attributes and values.
+  ComputeGraph* graph = loaded.getRootComputeGraph();
+  ASSERT_TRUE(nullptr != graph);
+  EXPECT_TRUE(graph->name() == "cached");
+  ComputeGraph::iterator it = graph->begin();
+  for (ComputeOperator& op : cg) {
+    ASSERT_TRUE(it != graph->end());
+    ComputeOperator* copy = it;
+    EXPECT_TRUE(op.name() == copy->name());
+    ASSERT_EQ(op.getNumOfInputs(), copy->getNumOfInputs());
+    ASSERT_EQ(op.getNumOfOutputs(), copy->getNumOfOutputs());
+    for (unsigned int i = 0; i < op.getNumOfOutputs(); ++i) {
+      Tensor* value = static_cast<Tensor*>(op.getOutput(i));
+      Tensor* other = static_cast<Tensor*>(copy->getOutput(i));
+      EXPECT_TRUE(value->getName() == other->getName());
+      EXPECT_EQ(value->kind(), other->kind());
+      EXPECT_TRUE(value->getDimensions() == other->getDimensions());
+    }
+    ++it;
+  }
+  EXPECT_TRUE(it == graph->end());
+
+  Transpose* transpose = nullptr;
+  for (ComputeOperator& op : *graph)
+    if (nullptr == transpose)
+      transpose = dyn_cast<Transpose>(&op);
+  ASSERT_TRUE(nullptr != transpose);
+  ASSERT_EQ(transpose->getPerm().vector().size(), 2);
+  EXPECT_EQ(transpose->getPerm().vector()[0], 1);
+  EXPECT_EQ(transpose->getPerm().vector()[1], 0);
+
+  // w still refers to the model, and shape is read from the entry.
+  FloatTensor* w = graph->getValue<FloatTensor>("w");
+  ASSERT_TRUE(w->isExternal());
+  ASSERT_EQ(w->getNumOfValues(), 16);
+  for (int i = 0; i < 16; ++i)
+    EXPECT_EQ(w->data()[i], static_cast<float>(i));
+  Int64Tensor* shape = graph->getValue<Int64Tensor>("shape");
+  ASSERT_EQ(shape->getNumOfValues(), 1);
+  EXPECT_EQ(shape->data()[0], 16);
+
+  // Memory operands keep their residence and place.
+  ASSERT_EQ(loaded.getComputeOperands().size(),
+            stored.getComputeOperands().size());
+  for (ComputeOperand* opnd : loaded.getComputeOperands()) {
+    ComputeMemOperand* mem = cast<ComputeMemOperand>(opnd);
+    const std::string& name = mem->getValue()->getName();
+    ComputeMemOperand* original = nullptr;
+    for (ComputeOperand* other : stored.getComputeOperands())
+      if (other->getValue()->getName() == name &&
+          other->getSource()->name() == mem->getSource()->name() &&
+          other->getTarget()->name() == mem->getTarget()->name())
+        original = cast<ComputeMemOperand>(other);
+    ASSERT_TRUE(nullptr != original);
+    EXPECT_EQ(mem->residence(), original->residence());
+    EXPECT_EQ(mem->start(), original->start());
+    EXPECT_EQ(mem->length(), original->length());
+  }
+
+  Path entry(directory);
+  entry.append(key + ".module");
+  std::remove(entry.c_str());
+  ::rmdir(directory.c_str());
+  std::remove(model.c_str());
+}
@@ -7,7 +7,10 @@
 //===----------------------------------------------------------------------===//
 #include <onnc/ADT/StringList.h>
 #include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/Concat.h>
 #include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/Gather.h>
 #include <onnc/IR/Compute/Gemm.h>
 #include <onnc/IR/Compute/Initializer.h>
 #include <onnc/IR/Compute/InputOperator.h>
@@ -16,12 +19,16 @@
 #include <onnc/IR/Compute/OutputOperator.h>
 #include <onnc/IR/Compute/Relu.h>
 #include <onnc/IR/Compute/Reshape.h>
+#include <onnc/IR/Compute/Shape.h>
 #include <onnc/IR/Compute/Softmax.h>
+#include <onnc/IR/Compute/Transpose.h>
 #include <onnc/IR/Compute/ATen.h>
+#include <onnc/Support/Casting.h>
 #include <onnc/Support/IOStream.h>
 #include <onnc/Support/OStrStream.h>
 #include <skypat/skypat.h>
 #include <onnc/CodeGen/BuildMemOperand.h>
+#include <onnc/Transforms/ConstantFolding.h>
 
 using namespace onnc;
 
@@ -213,3 +220,90 @@ SKYPAT_F(ComputeGraphTest, print_alexnet)
   module.printComputeGraph(jsonObj);
 }
 
+
+SKYPAT_F(ComputeGraphTest, constant_folding)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("Folding");
+
+  // z = Reshape(x + Transpose(w), Shape(x))
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {3, 2}));
+  CreateFloatWeightOperator(cg, "w", {2, 3});
+  cg.getValue<FloatTensor>("w")->getValues() = { 0, 1, 2, 3, 4, 5 };
+  CreateComputeOperator<Transpose>(cg, {"w"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "wt", {3, 2}));
+  Add* add = CreateComputeOperator<Add>(cg, {"x", "wt"});
+  add->addOutput(*CreateFloatComputeTensor(cg, "y", {3, 2}));
+  CreateComputeOperator<Shape>(cg, {"x"})
+    ->addOutput(*CreateComputeTensor<Int64Tensor>(cg, "s", {2}));
+  Reshape* reshape = CreateComputeOperator<Reshape>(cg, {"y", "s"});
+  reshape->addOutput(*CreateFloatComputeTensor(cg, "z", {3, 2}));
+  CreateComputeOperator<OutputOperator>(cg, {"z"});
+
+  ConstantFolding pass;
+  ASSERT_TRUE(Pass::kModuleChanged == pass.runOnModule(module));
+  ASSERT_EQ(pass.getNumOfFolded(), 2);
+
+  // The unused weight and the folded values are gone.
+  ASSERT_TRUE(nullptr == cg.getValue("w"));
+  ASSERT_TRUE(nullptr == cg.getValue("wt"));
+  ASSERT_TRUE(nullptr == cg.getValue("s"));
+
+  const FloatTensor* wt = static_cast<const FloatTensor*>(add->getInput(1));
+  ASSERT_TRUE(isa<Initializer>(static_cast<ComputeOperator*>(wt->getDefine())));
+  std::vector<float> transposed = { 0, 3, 1, 4, 2, 5 };
+  ASSERT_TRUE(transposed == wt->getValues());
+
+  // The shape stays int64.
+  const Int64Tensor* shape = static_cast<const Int64Tensor*>(reshape->getInput(1));
+  ASSERT_TRUE(Value::kInt64 == shape->kind());
+  std::vector<int64_t> dims = { 3, 2 };
+  ASSERT_TRUE(dims == shape->getValues());
+
+  // Weights run before their users.
+  bool seenAdd = false;
+  for (ComputeOperator& op : cg) {
+    ASSERT_FALSE(isa<Transpose>(&op) || isa<Shape>(&op));
+    ASSERT_FALSE(seenAdd && isa<Initializer>(&op));
+    seenAdd |= (&op == add);
+  }
+}
+
+SKYPAT_F(ComputeGraphTest, constant_folding_shape_chain)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("ShapeChain");
+
+  // y = Reshape(x, Concat(Gather(Shape(x), [1]), [3]))
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {3, 2}));
+  CreateWeightOperator<Int64Tensor>(cg, "i", {1});
+  cg.getValue<Int64Tensor>("i")->getValues() = { 1 };
+  CreateWeightOperator<Int64Tensor>(cg, "k", {1});
+  cg.getValue<Int64Tensor>("k")->getValues() = { 3 };
+  CreateComputeOperator<Shape>(cg, {"x"})
+    ->addOutput(*CreateComputeTensor<Int64Tensor>(cg, "s", {2}));
+  CreateComputeOperator<Gather>(cg, {"s", "i"})
+    ->addOutput(*CreateComputeTensor<Int64Tensor>(cg, "g", {1}));
+  CreateComputeOperator<Concat>(cg, {"g", "k"}, IntAttr(0))
+    ->addOutput(*CreateComputeTensor<Int64Tensor>(cg, "c", {2}));
+  Reshape* reshape = CreateComputeOperator<Reshape>(cg, {"x", "c"});
+  reshape->addOutput(*CreateFloatComputeTensor(cg, "y", {2, 3}));
+  CreateComputeOperator<OutputOperator>(cg, {"y"});
+
+  ConstantFolding pass;
+  ASSERT_TRUE(Pass::kModuleChanged == pass.runOnModule(module));
+  ASSERT_EQ(pass.getNumOfFolded(), 3);
+
+  // Only the Reshape is left, reading the computed shape.
+  for (ComputeOperator& op : cg)
+    ASSERT_FALSE(isa<Shape>(&op) || isa<Gather>(&op) || isa<Concat>(&op));
+  const Int64Tensor* shape = static_cast<const Int64Tensor*>(reshape->getInput(1));
+  ASSERT_TRUE(Value::kInt64 == shape->kind());
+  ASSERT_TRUE(isa<Initializer>(static_cast<ComputeOperator*>(shape->getDefine())));
+  std::vector<int64_t> dims = { 2, 3 };
+  ASSERT_TRUE(dims == shape->getValues());
+}
@@ -399,3 +399,30 @@ SKYPAT_F(ComputeIRTest, deep_clone)
 
   module.dump();
 }
+
+SKYPAT_F(ComputeIRTest, external_values_test)
+{
+  onnc::Module module;
+  IRBuilder builder(module);
+
+  ComputeGraph* cg = builder.CreateComputeGraph("top-level");
+  onnc::FloatTensor* ft = cg->addValue<onnc::FloatTensor>("val.f");
+
+  const float weights[] = { 1.f, 2.f, 3.f };
+  ft->setExternalValues(weights, 3);
+  ASSERT_TRUE(ft->isExternal());
+  ASSERT_EQ(ft->data(), weights);
+  ASSERT_EQ(ft->getNumOfValues(), 3);
+
+  // reading values copies them but keeps referring to the external ones
+  const onnc::FloatTensor* cft = ft;
+  ASSERT_EQ(cft->getValues().size(), 3);
+  ASSERT_EQ(cft->getValues()[2], 3.f);
+  ASSERT_EQ(ft->data(), weights);
+
+  // modifiable values are owned by the tensor
+  ft->getValues()[0] = 4.f;
+  ASSERT_FALSE(ft->isExternal());
+  ASSERT_EQ(ft->data()[0], 4.f);
+  ASSERT_EQ(weights[0], 1.f);
+}
@@ -0,0 +1,171 @@
+//===- FuseOperatorsTest.cpp ----------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/ADT/StringList.h>
+#include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Compute/Add.h>
+#include <onnc/IR/Compute/BatchNormalization.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/FusedConv.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Transforms/FuseOperators.h>
+#include <skypat/skypat.h>
+#include <cmath>
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// Create Compute Graph Helper
+//===----------------------------------------------------------------------===//
+static Tensor*
+CreateFloatComputeTensor(ComputeGraph& pCG, const StringRef& pName,
+                         const Tensor::Dimensions& pDims)
+{
+  Tensor* t = pCG.addValue<FloatTensor>(pName);
+  t->setDimensions(pDims);
+  return t;
+}
+
+static void
+CreateFloatWeightOperator(ComputeGraph& pCG, const std::string& pName,
+                          const Tensor::Dimensions& pDims,
+                          const std::vector<float>& pValues)
+{
+  Initializer* init = pCG.addOperator<Initializer>(pName);
+  Tensor* value = CreateFloatComputeTensor(pCG, pName, pDims);
+  static_cast<FloatTensor*>(value)->getValues() = pValues;
+  init->setTensor(*value);
+}
+
+template<typename OpTy, typename ... NodeCtorParams>
+static OpTy* CreateComputeOperator(ComputeGraph& pCG,
+                                   const StringList& pInputNames,
+                                   NodeCtorParams&& ... pParams)
+{
+  OpTy* op = pCG.addOperator<OpTy>(pParams...);
+  for (auto& iname : pInputNames)
+    op->addInput(*pCG.getValue<Tensor>(iname));
+  return op;
+}
+
+static const std::vector<float>& GetValues(const Tensor* pTensor)
+{
+  return static_cast<const FloatTensor*>(pTensor)->getValues();
+}
+
+//===----------------------------------------------------------------------===//
+// FuseOperatorsTest
+//===----------------------------------------------------------------------===//
+SKYPAT_F(FuseOperatorsTest, conv_batchnorm_relu)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("ConvBN");
+
+  // z = Relu(BatchNormalization(Conv(x, w, b))), two 1x1 filters.
+  const std::vector<float> w = { 1, -2, 3, 4 }, b = { 0.5, -1 };
+  const std::vector<float> scale = { 2, 0.5 }, shift = { 1, -3 };
+  const std::vector<float> mean = { 0.25, 4 }, var = { 3, 0.75 };
+  const float epsilon = 1e-3;
+
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {1, 2, 3, 3}));
+  CreateFloatWeightOperator(cg, "w", {2, 2, 1, 1}, w);
+  CreateFloatWeightOperator(cg, "b", {2}, b);
+  CreateFloatWeightOperator(cg, "scale", {2}, scale);
+  CreateFloatWeightOperator(cg, "shift", {2}, shift);
+  CreateFloatWeightOperator(cg, "mean", {2}, mean);
+  CreateFloatWeightOperator(cg, "var", {2}, var);
+  CreateComputeOperator<Conv>(cg, {"x", "w", "b"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "y", {1, 2, 3, 3}));
+  BatchNormalization* bn = CreateComputeOperator<BatchNormalization>(
+    cg, {"y", "scale", "shift", "mean", "var"});
+  bn->setEpsilon(FloatAttr(epsilon));
+  bn->addOutput(*CreateFloatComputeTensor(cg, "n", {1, 2, 3, 3}));
+  CreateComputeOperator<Relu>(cg, {"n"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "z", {1, 2, 3, 3}));
+  CreateComputeOperator<OutputOperator>(cg, {"z"});
+
+  FuseOperators pass;
+  ASSERT_TRUE(Pass::kModuleChanged == pass.runOnModule(module));
+  ASSERT_EQ(pass.getNumOfFoldedBN(), 1);
+  ASSERT_EQ(pass.getNumOfEpilogues(), 1);
+
+  // Conv, BatchNormalization and Relu are one FusedConv defining z.
+  FusedConv* fused = nullptr;
+  for (ComputeOperator& op : cg) {
+    ASSERT_FALSE(isa<Conv>(&op) || isa<BatchNormalization>(&op) ||
+                 isa<Relu>(&op));
+    if (isa<FusedConv>(&op))
+      fused = cast<FusedConv>(&op);
+  }
+  ASSERT_TRUE(nullptr != fused);
+  ASSERT_TRUE(fused->getY() == cg.getValue("z"));
+  ASSERT_EQ(fused->getActivations().vector().size(), 1);
+  ASSERT_TRUE("Relu" == fused->getActivations().at(0));
+  ASSERT_TRUE(nullptr == cg.getValue("y"));
+  ASSERT_TRUE(nullptr == cg.getValue("n"));
+
+  // W'[m] = W[m] * s[m], B'[m] = (B[m] - mean[m]) * s[m] + shift[m]
+  const std::vector<float>& newW = GetValues(fused->getW());
+  const std::vector<float>& newB = GetValues(fused->getB());
+  ASSERT_EQ(newW.size(), 4);
+  ASSERT_EQ(newB.size(), 2);
+  for (unsigned int m = 0; m < 2; ++m) {
+    double s = scale[m] / std::sqrt(var[m] + epsilon);
+    for (unsigned int k = 0; k < 2; ++k)
+      EXPECT_TRUE(std::fabs(newW[m * 2 + k] - w[m * 2 + k] * s) < 1e-5);
+    EXPECT_TRUE(std::fabs(newB[m] - ((b[m] - mean[m]) * s + shift[m])) < 1e-5);
+  }
+}
+
+SKYPAT_F(FuseOperatorsTest, gemm_add)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("GemmAdd");
+
+  // z = Gemm(a, w, c) + bias, with beta = 0.5.
+  const std::vector<float> c = { 1, 2, 3, 4 }, bias = { 10, 20, 30, 40 };
+
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "a", {2, 3}));
+  CreateFloatWeightOperator(cg, "w", {3, 4}, std::vector<float>(12, 1));
+  CreateFloatWeightOperator(cg, "c", {4}, c);
+  CreateFloatWeightOperator(cg, "bias", {4}, bias);
+  Gemm* gemm = CreateComputeOperator<Gemm>(cg, {"a", "w", "c"});
+  gemm->setBeta(FloatAttr(0.5));
+  gemm->addOutput(*CreateFloatComputeTensor(cg, "y", {2, 4}));
+  CreateComputeOperator<Add>(cg, {"y", "bias"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "z", {2, 4}));
+  CreateComputeOperator<OutputOperator>(cg, {"z"});
+
+  FuseOperators pass;
+  ASSERT_TRUE(Pass::kModuleChanged == pass.runOnModule(module));
+  ASSERT_EQ(pass.getNumOfFoldedBias(), 1);
+  ASSERT_EQ(pass.getNumOfEpilogues(), 0);
+
+  // Gemm defines z; the Add and the old weights are gone.
+  for (ComputeOperator& op : cg)
+    ASSERT_FALSE(isa<Add>(&op));
+  ASSERT_TRUE(gemm->getY() == cg.getValue("z"));
+  ASSERT_TRUE(nullptr == cg.getValue("y"));
+  ASSERT_TRUE(nullptr == cg.getValue("c"));
+  ASSERT_TRUE(nullptr == cg.getValue("bias"));
+
+  // C' = beta * C + bias, beta' = 1.
+  ASSERT_TRUE(1.0 == gemm->getBeta().value());
+  const std::vector<float>& newC = GetValues(gemm->getC());
+  ASSERT_EQ(newC.size(), 4);
+  for (unsigned int j = 0; j < 4; ++j)
+    EXPECT_TRUE(std::fabs(newC[j] - (0.5 * c[j] + bias[j])) < 1e-5);
+}
@@ -0,0 +1,149 @@
+//===- JITTest.cpp --------------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/ADT/StringList.h>
+#include <onnc/Core/PassManager.h>
+#include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Compute/FusedGemm.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/OStrStream.h>
+#include <onnc/Support/Path.h>
+#include <onnc/Target/TargetOptions.h>
+#include <onnc/Transforms/FuseOperators.h>
+#include <skypat/skypat.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "../../lib/Target/X86/X86Backend.h"
+#include "../onnc-jit/JITCompiler.h"
+#include "../onnc-jit/JITModule.h"
+
+using namespace onnc;
+
+namespace {
+
+FloatTensor* CreateTensor(ComputeGraph& pCG, const StringRef& pName,
+                          const Tensor::Dimensions& pDims)
+{
+  FloatTensor* t = pCG.addValue<FloatTensor>(pName);
+  t->setDimensions(pDims);
+  return t;
+}
+
+void CreateWeight(ComputeGraph& pCG, const std::string& pName,
+                  const Tensor::Dimensions& pDims,
+                  const std::vector<float>& pValues)
+{
+  Initializer* init = pCG.addOperator<Initializer>(pName);
+  FloatTensor* value = CreateTensor(pCG, pName, pDims);
+  value->getValues() = pValues;
+  init->setTensor(*value);
+}
+
+/// r = Relu(Gemm(a, g, c)), which fusion turns into one FusedGemm.
+ComputeGraph& CreateMLP(Module& pM)
+{
+  IRBuilder builder(pM);
+  ComputeGraph& cg = *builder.CreateComputeGraph("MLP");
+
+  cg.addOperator<InputOperator>()->setTensor(*CreateTensor(cg, "a", {2, 3}));
+  CreateWeight(cg, "g", {3, 4},
+               { 1, -1, 0.5, 0, -0.5, 2, 1, -1, 0.25, 0, -2, 1 });
+  CreateWeight(cg, "c", {4}, { 0.5, -0.5, 1, 0 });
+
+  Gemm* gemm = cg.addOperator<Gemm>();
+  gemm->addInput(*cg.getValue<Tensor>("a"));
+  gemm->addInput(*cg.getValue<Tensor>("g"));
+  gemm->addInput(*cg.getValue<Tensor>("c"));
+  gemm->addOutput(*CreateTensor(cg, "z", {2, 4}));
+  Relu* relu = cg.addOperator<Relu>();
+  relu->addInput(*cg.getValue<Tensor>("z"));
+  relu->addOutput(*CreateTensor(cg, "r", {2, 4}));
+  cg.addOperator<OutputOperator>()->addTensor(*cg.getValue<Tensor>("r"));
+  return cg;
+}
+
+} // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// JITTest
+//===----------------------------------------------------------------------===//
+SKYPAT_F(JITTest, fused_gemm_runs)
+{
+  Module module;
+  ComputeGraph& cg = CreateMLP(module);
+
+  Path output(BUILDDIR);
+  output.append("JITTest." + std::to_string(::getpid()) + ".c");
+  TargetOptions options;
+  X86Backend backend(options);
+  PassRegistry registry;
+  PassManager pm(registry);
+  pm.add(CreateFuseOperatorsPass());
+  backend.addMemAlloc(pm);
+  backend.addCodeEmit(pm, output);
+  ASSERT_TRUE(pm.run(module));
+
+  // Every Gemm is fused, so the emitted code only calls fusedgemm, whose
+  // kernel calls gemm.
+  for (ComputeOperator& op : cg)
+    ASSERT_FALSE(isa<Gemm>(&op) || isa<Relu>(&op));
+
+  Path cache(BUILDDIR);
+  cache.append("JITTest." + std::to_string(::getpid()));
+  const char* cc = getenv("CC");
+  JITCompiler compiler(cache, Path(TOPDIR), nullptr != cc ? cc : "cc");
+  Path library;
+  ASSERT_TRUE(compiler.compile(output, library));
+
+  JITModule jit;
+  std::string error;
+  Path weights(output.native() + ".weight");
+  ASSERT_TRUE(jit.load(library, weights, error));
+  ASSERT_EQ(jit.getNumOfInputs(), 1);
+  std::vector<float> a = { 1, 2, -1, 0.5, -1, 2 };
+  ASSERT_TRUE(jit.setInput(0, a.data(), a.size() * sizeof(float)));
+  jit.run();
+
+  std::string printed;
+  OStrStream oss(printed);
+  jit.printOutputs(oss);
+  oss.flush();
+
+  // r = max(a * g + c, 0)
+  const float g[3][4] = { { 1, -1, 0.5, 0 }, { -0.5, 2, 1, -1 },
+                          { 0.25, 0, -2, 1 } };
+  const float c[4] = { 0.5, -0.5, 1, 0 };
+  std::replace(printed.begin(), printed.end(), '[', ' ');
+  std::replace(printed.begin(), printed.end(), ']', ' ');
+  std::replace(printed.begin(), printed.end(), ',', ' ');
+  std::istringstream values(printed);
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      float expected = c[j];
+      for (int k = 0; k < 3; ++k)
+        expected += a[i * 3 + k] * g[k][j];
+      float value = 0;
+      ASSERT_TRUE(values >> value);
+      EXPECT_EQ(value, std::max(expected, 0.f));
+    }
+  }
+
+  std::remove(library.c_str());
+  ::rmdir(cache.c_str());
+  std::remove(weights.c_str());
+  std::remove(output.c_str());
+}
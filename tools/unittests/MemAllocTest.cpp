@@ -13,11 +13,13 @@
 #include <onnc/CodeGen/LiveIntervalsData.h>
 #include <onnc/CodeGen/LiveValueMatrix.h>
 #include <onnc/CodeGen/MemAllocData.h>
+#include <onnc/CodeGen/MemoryAwareSchedule.h>
 #include <onnc/CodeGen/SlotIndexes.h>
 #include <onnc/Core/AnalysisResolver.h>
 #include <onnc/Core/InitializePasses.h>
 #include <onnc/Core/PassManager.h>
 #include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Compute/Add.h>
 #include <onnc/IR/Compute/Conv.h>
 #include <onnc/IR/Compute/Gemm.h>
 #include <onnc/IR/Compute/Initializer.h>
@@ -34,6 +36,7 @@
 #include <onnc/Target/TargetMemInfo.h>
 #include <onnc/Target/TargetStandardPasses.h>
 #include <skypat/skypat.h>
+#include <algorithm>
 #include "../../lib/Target/X86/X86RemoveWeightFromLiveIntervals.h"
 
 using namespace onnc;
@@ -215,6 +218,7 @@ public:
     case kUint16:
     case kInt16:
     case kFloat16:
+    case kBFloat16:
       align = 16, size = 2;
       break;
 
@@ -439,6 +443,7 @@ SKYPAT_F(MemAllocTest, exclude_weight_linear_mem_alloc_test)
   passMgr.add(CreateX86RemoveWeightFromLiveIntervalsPass());
   addStandardMemoryAllocation(passMgr, vtarget);
   addStandardSetMemOperands(passMgr);
+  passMgr.add(CreateLiveValueMatrixPass());
 
   LiveIntervalsData* liData =
     static_cast<LiveIntervalsData*>(passMgr.lookup(&LiveIntervalsData::ID));
@@ -517,3 +522,177 @@ SKYPAT_F(MemAllocTest, inplace_value_fusible_test)
 
   ASSERT_TRUE(memAllocData->hasAlloc(cg.getValue("relu2_1")));
 }
+
+SKYPAT_F(MemAllocTest, mem_alloc_strategy_test)
+{
+  const TargetOptions::MemAllocStrategy strategies[] = {
+    TargetOptions::kFirstFit, TargetOptions::kBestFit,
+    TargetOptions::kGreedyBySize, TargetOptions::kSkyline,
+    TargetOptions::kMinimumMemory
+  };
+
+  uint64_t minimum = 0;
+  for (auto strategy : strategies) {
+    TargetOptions opt;
+    opt.setMemAllocStrategy(strategy);
+    VTargetBackend vtarget(opt);
+
+    PassRegistry registry;
+    PassManager passMgr(registry);
+    addStandardCreateLiveIntervals(passMgr);
+    addStandardMemoryAllocation(passMgr, vtarget);
+    passMgr.add(CreateLiveValueMatrixPass());
+
+    Module module;
+    CreateAlexNet(module);
+    passMgr.run(module);
+
+    LiveIntervalsData* liData =
+      static_cast<LiveIntervalsData*>(passMgr.lookup(&LiveIntervalsData::ID));
+    LiveValueMatrix* liveMat =
+      static_cast<LiveValueMatrix*>(passMgr.lookup(&LiveValueMatrix::ID));
+    MemAllocData* memAllocData =
+      static_cast<MemAllocData*>(passMgr.lookup(&MemAllocData::ID));
+    LinearScanMemAlloc* memAlloc =
+      static_cast<LinearScanMemAlloc*>(passMgr.lookup(&LinearScanMemAlloc::ID));
+
+    uint64_t footprint = 0;
+    for (auto li : liData->getSortedIntervals()) {
+      MemAllocData::AllocEntry
+        myAlloc = memAllocData->getAlloc(li->getValue());
+      footprint = std::max(footprint, myAlloc.startAddr + myAlloc.size);
+
+      for (auto overlappedLI : liveMat->getInterferingLiveIntervals(li)) {
+        MemAllocData::AllocEntry otherAlloc =
+          memAllocData->getAlloc(overlappedLI->getValue());
+        ASSERT_FALSE(otherAlloc.overlap(myAlloc));
+      }
+    }
+    ASSERT_EQ(memAlloc->getFootprint(), footprint);
+    ASSERT_TRUE(memAlloc->getPeakLiveSize() <= footprint);
+
+    if (TargetOptions::kMinimumMemory != strategy) {
+      if (0 == minimum || footprint < minimum)
+        minimum = footprint;
+    }
+    else
+      ASSERT_EQ(footprint, minimum);
+  }
+
+  TargetOptions opt;
+  ASSERT_TRUE(opt.setMemAllocStrategy("skyline"));
+  ASSERT_TRUE(TargetOptions::kSkyline == opt.getMemAllocStrategy());
+  ASSERT_FALSE(opt.setMemAllocStrategy("worst-fit"));
+}
+
+static void VTargetGetInplacePairs(const ComputeOperator& pOp,
+                                   FuseInplaceValue::InplacePairs& pPairs)
+{
+  if (isa<Relu>(&pOp))
+    pPairs.push_back(FuseInplaceValue::InplacePair{0, 0, false});
+  else if (isa<Add>(&pOp)) {
+    pPairs.push_back(FuseInplaceValue::InplacePair{0, 0, false});
+    pPairs.push_back(FuseInplaceValue::InplacePair{1, 0, false});
+  }
+  else if (isa<Reshape>(&pOp))
+    pPairs.push_back(FuseInplaceValue::InplacePair{0, 0, true});
+}
+
+SKYPAT_F(MemAllocTest, inplace_pair_table_test)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("Chain");
+
+  //   x -> Relu -> r -> Add(w, r) -> s -> Reshape -> f -> Relu -> y
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {2, 4, 8}));
+  CreateFloatWeightOperator(cg, "w", {8});
+  CreateFloatWeightOperator(cg, "shape", {2});
+  CreateComputeOperator<Relu>(cg, {"x"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "r", {2, 4, 8}));
+  CreateComputeOperator<Add>(cg, {"w", "r"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "s", {2, 4, 8}));
+  CreateComputeOperator<Reshape>(cg, {"s", "shape"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "f", {2, 32}));
+  CreateComputeOperator<Relu>(cg, {"f"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "y", {2, 32}));
+  CreateComputeOperator<OutputOperator>(cg, {"y"});
+
+  TargetOptions opt;
+  VTargetBackend vtarget(opt);
+
+  PassRegistry registry;
+  PassManager passMgr(registry);
+  FuseInplaceValue* fuse = new FuseInplaceValue(VTargetGetInplacePairs);
+  passMgr.add(fuse);
+  addStandardCreateLiveIntervals(passMgr);
+  passMgr.add(CreateX86RemoveWeightFromLiveIntervalsPass());
+  addStandardMemoryAllocation(passMgr, vtarget);
+  addStandardSetMemOperands(passMgr);
+
+  MemAllocData* memAllocData =
+    static_cast<MemAllocData*>(passMgr.lookup(&MemAllocData::ID));
+
+  passMgr.run(module);
+
+  // The graph input x is never written; s and y are replaced by r and f;
+  // f is a view of r.
+  ASSERT_EQ(fuse->getNumOfFused(), 3);
+  ASSERT_EQ(fuse->getNumOfViews(), 1);
+  ASSERT_TRUE(nullptr == cg.getValue("s"));
+  ASSERT_TRUE(nullptr == cg.getValue("y"));
+
+  Tensor* r = cg.getValue<Tensor>("r");
+  Tensor* f = cg.getValue<Tensor>("f");
+  ASSERT_EQ(f->getNumOfDimensions(), 2);
+  ASSERT_EQ(memAllocData->getBase(f), r);
+  ASSERT_EQ(memAllocData->getAlloc(f).startAddr,
+            memAllocData->getAlloc(r).startAddr);
+  ASSERT_FALSE(memAllocData->hasAlloc(cg.getValue("x")));
+}
+
+SKYPAT_F(MemAllocTest, memory_aware_schedule_test)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("Diamond");
+
+  // Both large values are live at the same time in the original order:
+  //   x -> a1 (large) -> a2 -> y
+  //   x -> b1 (large) -> b2 -> y
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {1}));
+  Relu* a1 = CreateComputeOperator<Relu>(cg, {"x"});
+  a1->addOutput(*CreateFloatComputeTensor(cg, "a1", {100}));
+  Relu* b1 = CreateComputeOperator<Relu>(cg, {"x"});
+  b1->addOutput(*CreateFloatComputeTensor(cg, "b1", {100}));
+  Relu* a2 = CreateComputeOperator<Relu>(cg, {"a1"});
+  a2->addOutput(*CreateFloatComputeTensor(cg, "a2", {1}));
+  CreateComputeOperator<Relu>(cg, {"b1"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "b2", {1}));
+  CreateComputeOperator<Add>(cg, {"a2", "b2"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "y", {1}));
+  CreateComputeOperator<OutputOperator>(cg, {"y"});
+
+  TargetOptions opt;
+  VTargetBackend vtarget(opt);
+  MemoryAwareSchedule schedule(&vtarget);
+  ASSERT_TRUE(Pass::kModuleChanged & schedule.runOnModule(module));
+
+  ASSERT_EQ(schedule.getResults().size(), 1);
+  ASSERT_EQ(schedule.getResults()[0].before, 804);
+  ASSERT_EQ(schedule.getResults()[0].after, 408);
+
+  // a1 is consumed by a2 before b1 is computed.
+  std::vector<ComputeOperator*> order;
+  for (ComputeGraph::iterator it = cg.begin(); it != cg.end(); ++it)
+    order.push_back(it);
+  ASSERT_EQ(order.size(), 7);
+  ASSERT_TRUE(isa<InputOperator>(order.front()));
+  ASSERT_TRUE(isa<OutputOperator>(order.back()));
+  ASSERT_TRUE(std::find(order.begin(), order.end(), a2) <
+              std::find(order.begin(), order.end(), b1));
+  ASSERT_TRUE(std::find(order.begin(), order.end(), a1) <
+              std::find(order.begin(), order.end(), a2));
+}
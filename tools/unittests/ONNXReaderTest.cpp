@@ -7,6 +7,12 @@
 //===----------------------------------------------------------------------===//
 #include <skypat/skypat.h>
 #include <onnc/IRReader/ONNXReader.h>
+#include <onnc/IR/ONNXUtils.h>
+#include <onnc/ONNXWrapper/ONNXWrapper.h>
+#include <onnc/Support/FileSystem.h>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 
 using namespace onnc;
 
@@ -26,3 +32,218 @@ SKYPAT_F(ONNXReaderTest, parse_file)
   SystemError err = reader.parse(path, module);
   ASSERT_TRUE(err.isGood());
 }
+
+namespace {
+
+xTensorProto* AddInitializer(xGraphProto& pGraph, const std::string& pName,
+                             xTensorProtoDataType pType,
+                             const std::vector<int64_t>& pDims,
+                             const void* pData, size_t pSize)
+{
+  xTensorProto* tensor = pGraph.add_initializer();
+  tensor->set_name(pName);
+  tensor->set_data_type(pType);
+  for (int64_t dim : pDims)
+    tensor->add_dims(dim);
+  tensor->set_raw_data(pData, pSize);
+
+  // IR version 3 lists initializers as graph inputs too.
+  auto* input = pGraph.add_input();
+  input->set_name(pName);
+  auto* type = input->mutable_type()->mutable_tensor_type();
+  type->set_elem_type(pType);
+  for (int64_t dim : pDims)
+    type->mutable_shape()->add_dim()->set_dim_value(dim);
+  return tensor;
+}
+
+} // anonymous namespace
+
+/// Y = Reshape(X, shape) + bias. Shape inference reads the payload of the
+/// streamed initializer shape.
+SKYPAT_F(ONNXReaderTest, infer_shape_of_streamed_model)
+{
+  const int64_t shape[] = { 2, 6 };
+  const float bias[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+  xProto model;
+  model.set_ir_version(3);
+  model.add_opset_import()->set_version(7);
+  xGraphProto* graph = model.mutable_graph();
+  graph->set_name("reshape");
+  auto* x = graph->add_input();
+  x->set_name("X");
+  auto* xType = x->mutable_type()->mutable_tensor_type();
+  xType->set_elem_type(xTensorProto::FLOAT);
+  xType->mutable_shape()->add_dim()->set_dim_value(3);
+  xType->mutable_shape()->add_dim()->set_dim_value(4);
+  AddInitializer(*graph, "shape", xTensorProto::INT64, { 2 }, shape,
+                 sizeof(shape));
+  AddInitializer(*graph, "bias", xTensorProto::FLOAT, { 2, 6 }, bias,
+                 sizeof(bias));
+  auto* reshape = graph->add_node();
+  reshape->set_op_type("Reshape");
+  reshape->add_input("X");
+  reshape->add_input("shape");
+  reshape->add_output("R");
+  auto* add = graph->add_node();
+  add->set_op_type("Add");
+  add->add_input("R");
+  add->add_input("bias");
+  add->add_output("Y");
+  auto* y = graph->add_output();
+  y->set_name("Y");
+  y->mutable_type()->mutable_tensor_type()->set_elem_type(xTensorProto::FLOAT);
+
+  Path path(BUILDDIR);
+  path.append("streamed_reshape.onnx");
+  {
+    std::ofstream file(path.native(), std::ios::binary | std::ios::trunc);
+    ASSERT_TRUE(model.SerializeToOstream(&file));
+  }
+
+  onnc::Module module;
+  onnc::onnx::Reader reader;
+  ASSERT_TRUE(reader.parse(path, module).isGood());
+  // The payloads stay in the mapped file.
+  ASSERT_EQ(module.getExternalData("shape").size(), sizeof(shape));
+  ASSERT_EQ(module.getExternalData("bias").size(), sizeof(bias));
+
+  ASSERT_TRUE(onnxInferShape(module));
+  const xValue* output = module.getRootTensorGraph()->outputs()[0];
+  ASSERT_EQ(output->sizes().size(), 2);
+  EXPECT_EQ(output->sizes()[0].dim, 2);
+  EXPECT_EQ(output->sizes()[1].dim, 6);
+
+  // Shape inference leaves the payloads in the file, and exporting the
+  // module brings them back.
+  EXPECT_EQ(module.getExternalData("bias").size(), sizeof(bias));
+  xProto exported;
+  ExportModelProto(exported, module);
+  bool found = false;
+  for (const xTensorProto& tensor : exported.graph().initializer()) {
+    if ("bias" != tensor.name())
+      continue;
+    found = true;
+    ASSERT_EQ(tensor.raw_data().size(), sizeof(bias));
+    EXPECT_EQ(0, std::memcmp(tensor.raw_data().data(), bias, sizeof(bias)));
+  }
+  EXPECT_TRUE(found);
+
+  // Exporting for shape inference copies the shape but not the weights.
+  xProto shapes;
+  ExportModelProto(shapes, module, kShapePayloads);
+  ASSERT_EQ(shapes.graph().initializer_size(), 2);
+  for (const xTensorProto& tensor : shapes.graph().initializer()) {
+    if ("shape" == tensor.name())
+      EXPECT_EQ(tensor.raw_data().size(), sizeof(shape));
+    else {
+      EXPECT_FALSE(tensor.has_raw_data());
+      EXPECT_TRUE(xTensorProto::EXTERNAL == tensor.data_location());
+    }
+  }
+
+  // Serializing the module writes the weights straight from the file.
+  std::stringstream stream;
+  ASSERT_TRUE(SerializeToOstream(stream, module));
+  xProto written;
+  ASSERT_TRUE(written.ParseFromString(stream.str()));
+  EXPECT_EQ(written.graph().node_size(), 2);
+  found = false;
+  for (const xTensorProto& tensor : written.graph().initializer()) {
+    if ("bias" != tensor.name())
+      continue;
+    found = true;
+    EXPECT_FALSE(tensor.has_data_location());
+    ASSERT_EQ(tensor.raw_data().size(), sizeof(bias));
+    EXPECT_EQ(0, std::memcmp(tensor.raw_data().data(), bias, sizeof(bias)));
+  }
+  EXPECT_TRUE(found);
+
+  remove(path);
+}
+
+namespace {
+
+/// Write a model whose only initializer W is external data at @ref
+/// pLocation, and parse it.
+bool ParseWithExternalLocation(const Path& pDir, const std::string& pLocation)
+{
+  xProto model;
+  model.set_ir_version(3);
+  model.add_opset_import()->set_version(7);
+  xGraphProto* graph = model.mutable_graph();
+  graph->set_name("external");
+  xTensorProto* tensor = graph->add_initializer();
+  tensor->set_name("W");
+  tensor->set_data_type(xTensorProto::FLOAT);
+  tensor->add_dims(4);
+  tensor->set_data_location(xTensorProto::EXTERNAL);
+  auto* entry = tensor->add_external_data();
+  entry->set_key("location");
+  entry->set_value(pLocation);
+  auto* input = graph->add_input();
+  input->set_name("W");
+  auto* type = input->mutable_type()->mutable_tensor_type();
+  type->set_elem_type(xTensorProto::FLOAT);
+  type->mutable_shape()->add_dim()->set_dim_value(4);
+  auto* relu = graph->add_node();
+  relu->set_op_type("Relu");
+  relu->add_input("W");
+  relu->add_output("Y");
+  auto* y = graph->add_output();
+  y->set_name("Y");
+  y->mutable_type()->mutable_tensor_type()->set_elem_type(xTensorProto::FLOAT);
+
+  Path path(pDir);
+  path.append("external.onnx");
+  {
+    std::ofstream file(path.native(), std::ios::binary | std::ios::trunc);
+    if (!model.SerializeToOstream(&file))
+      return false;
+  }
+  onnc::Module module;
+  onnc::onnx::Reader reader;
+  return reader.parse(path, module).isGood();
+}
+
+void WriteFloats(const Path& pPath)
+{
+  const float data[] = { 1, 2, 3, 4 };
+  std::ofstream file(pPath.native(), std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(data), sizeof(data));
+}
+
+} // anonymous namespace
+
+/// External data must stay inside the directory of the model.
+SKYPAT_F(ONNXReaderTest, reject_external_data_outside_model_dir)
+{
+  Path root(BUILDDIR);
+  root.append("external_data_test");
+  clean(root);
+  Path dir(root);
+  dir.append("model");
+  ASSERT_TRUE(mkdir(root, 0755).isGood());
+  ASSERT_TRUE(mkdir(dir, 0755).isGood());
+
+  Path inside(dir), outside(root), link(dir);
+  inside.append("weights.bin");
+  outside.append("secret.bin");
+  link.append("link.bin");
+  WriteFloats(inside);
+  WriteFloats(outside);
+  ASSERT_TRUE(symlink(outside, link).isGood());
+
+  Path absolute_outside;
+  ASSERT_TRUE(realpath(absolute_outside, outside));
+
+  EXPECT_TRUE(ParseWithExternalLocation(dir, "weights.bin"));
+  EXPECT_TRUE(ParseWithExternalLocation(dir, "./weights.bin"));
+  EXPECT_FALSE(ParseWithExternalLocation(dir, "../secret.bin"));
+  EXPECT_FALSE(ParseWithExternalLocation(dir, "sub/../../secret.bin"));
+  EXPECT_FALSE(ParseWithExternalLocation(dir, absolute_outside.native()));
+  EXPECT_FALSE(ParseWithExternalLocation(dir, "link.bin"));
+
+  clean(root);
+}
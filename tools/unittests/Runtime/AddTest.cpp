@@ -0,0 +1,105 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/add.h>
+}
+#undef restrict
+
+SKYPAT_F(Operator_Add, non_broadcast){
+    // Prepare
+    srand(time(NULL));
+    int32_t ndim = rand() % 3 + 1;
+    int32_t dims[ndim];
+    int32_t dataSize = 1;
+    for(int32_t i = 0; i < ndim; ++i){
+        dims[i] = rand() % 100 + 1;
+        dataSize *= dims[i];
+    }
+    float A[dataSize], B[dataSize], C[dataSize], Ans[dataSize];
+    for(int32_t i = 0; i < dataSize; ++i){
+        A[i] = rand() % 1000 / 100.0;
+        B[i] = rand() % 1000 / 100.0;
+        Ans[i] = A[i] + B[i];
+    }
+    // Run
+    ONNC_RUNTIME_add_float(NULL
+        ,A
+        ,ndim,dims
+        ,B
+        ,ndim,dims
+        ,C
+        ,ndim,dims
+    );
+    // Check
+    for(int32_t i = 0; i < dataSize; ++i){
+        EXPECT_EQ(C[i], Ans[i]);
+    }
+}
+
+SKYPAT_F(Operator_Add, scalar_broadcast){
+    // Prepare
+    int32_t dims[2]{3, 37};
+    int32_t scalarDims[1]{1};
+    float A[111], B[1]{2.5}, C[111], D[111];
+    for(int32_t i = 0; i < 111; ++i){
+        A[i] = i * 0.5;
+    }
+    // Run
+    ONNC_RUNTIME_add_float(NULL, A, 2, dims, B, 1, scalarDims, C, 2, dims);
+    ONNC_RUNTIME_add_float(NULL, B, 1, scalarDims, A, 2, dims, D, 2, dims);
+    // Check
+    for(int32_t i = 0; i < 111; ++i){
+        EXPECT_EQ(C[i], A[i] + 2.5f);
+        EXPECT_EQ(D[i], A[i] + 2.5f);
+    }
+}
+
+SKYPAT_F(Operator_Add, multidirectional_broadcast){
+    // Prepare: [2, 3, 1, 5] + [4, 1] -> [2, 3, 4, 5]
+    int32_t A_dims[4]{2, 3, 1, 5};
+    int32_t B_dims[2]{4, 1};
+    int32_t C_dims[4]{2, 3, 4, 5};
+    float A[30], B[4], C[120];
+    for(int32_t i = 0; i < 30; ++i){
+        A[i] = i;
+    }
+    for(int32_t i = 0; i < 4; ++i){
+        B[i] = 100 * (i + 1);
+    }
+    // Run
+    ONNC_RUNTIME_add_float(NULL, A, 4, A_dims, B, 2, B_dims, C, 4, C_dims);
+    // Check
+    for(int32_t n = 0; n < 6; ++n){
+        for(int32_t h = 0; h < 4; ++h){
+            for(int32_t w = 0; w < 5; ++w){
+                EXPECT_EQ(C[(n * 4 + h) * 5 + w], A[n * 5 + w] + B[h]);
+            }
+        }
+    }
+}
+
+SKYPAT_F(Operator_Add, in_place){
+    // Prepare: C aliases the input which isn't broadcast
+    int32_t A_dims[3]{2, 4, 33};
+    int32_t B_dims[2]{4, 1};
+    float A[264], B[4], Ans[264];
+    for(int32_t i = 0; i < 264; ++i){
+        A[i] = i * 0.25;
+    }
+    for(int32_t i = 0; i < 4; ++i){
+        B[i] = 10 * (i + 1);
+    }
+    for(int32_t i = 0; i < 264; ++i){
+        Ans[i] = A[i] + B[i / 33 % 4];
+    }
+    // Run
+    ONNC_RUNTIME_add_float(NULL, A, 3, A_dims, B, 2, B_dims, A, 3, A_dims);
+    // Check
+    for(int32_t i = 0; i < 264; ++i){
+        EXPECT_EQ(A[i], Ans[i]);
+    }
+}
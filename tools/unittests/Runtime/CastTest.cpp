@@ -0,0 +1,46 @@
+#include <skypat/skypat.h>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/cast.h>
+}
+#undef restrict
+
+namespace {
+
+std::vector<float> Cast(const std::vector<float>& pInput, int32_t pTo){
+    std::vector<float> out(pInput.size());
+    int32_t dims[1]{static_cast<int32_t>(pInput.size())};
+    ONNC_RUNTIME_cast_float(NULL
+        ,pInput.data(), 1, dims
+        ,out.data(), 1, dims
+        ,pTo
+    );
+    return out;
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_Cast, to_integers){
+    std::vector<float> in{2.7f, -2.7f, 300.f, -129.f};
+    // int64 truncates toward zero.
+    std::vector<float> int64{2, -2, 300, -129};
+    EXPECT_TRUE(Cast(in, 7) == int64);
+    // int8 and uint8 wrap around.
+    std::vector<float> int8{2, -2, 44, 127};
+    EXPECT_TRUE(Cast(in, 3) == int8);
+    std::vector<float> uint8{2, 254, 44, 127};
+    EXPECT_TRUE(Cast(in, 2) == uint8);
+}
+
+SKYPAT_F(Operator_Cast, to_floats){
+    std::vector<float> in{1.f / 3, 0.f, -5.5f};
+    EXPECT_TRUE(Cast(in, 1) == in);
+    std::vector<float> boolean{1, 0, 1};
+    EXPECT_TRUE(Cast(in, 9) == boolean);
+    // float16 keeps 11 significant bits.
+    std::vector<float> half = Cast(in, 10);
+    EXPECT_EQ(half[0], 0.333251953125f);
+    EXPECT_EQ(half[2], -5.5f);
+}
@@ -0,0 +1,207 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/conv.h>
+    #include <onnc/Runtime/operator/fusedconv.h>
+    #include <onnc/Runtime/operator/winogradconv.h>
+    #include <onnc/Runtime/internal/winograd.h>
+}
+#undef restrict
+
+namespace {
+
+struct Conv2D {
+    int32_t N, C, H, W, M, group, kH, kW, sH, sW, pH, pW, dH, dW;
+
+    int32_t oH() const { return (H + 2 * pH - ((kH - 1) * dH + 1)) / sH + 1; }
+    int32_t oW() const { return (W + 2 * pW - ((kW - 1) * dW + 1)) / sW + 1; }
+};
+
+// Direct convolution used as the reference.
+void ReferenceConv(const Conv2D& p, const float* X, const float* Wt,
+                   const float* B, float* Y){
+    int32_t kC = p.C / p.group, Mg = p.M / p.group;
+    int32_t oH = p.oH(), oW = p.oW();
+    for(int32_t n = 0; n < p.N; ++n)
+    for(int32_t m = 0; m < p.M; ++m)
+    for(int32_t oh = 0; oh < oH; ++oh)
+    for(int32_t ow = 0; ow < oW; ++ow){
+        double sum = B[m];
+        for(int32_t c = 0; c < kC; ++c)
+        for(int32_t kh = 0; kh < p.kH; ++kh)
+        for(int32_t kw = 0; kw < p.kW; ++kw){
+            int32_t ih = oh * p.sH - p.pH + kh * p.dH;
+            int32_t iw = ow * p.sW - p.pW + kw * p.dW;
+            if(ih < 0 || ih >= p.H || iw < 0 || iw >= p.W) continue;
+            int32_t ic = (m / Mg) * kC + c;
+            sum += X[((n * p.C + ic) * p.H + ih) * p.W + iw] *
+                   Wt[((m * kC + c) * p.kH + kh) * p.kW + kw];
+        }
+        Y[((n * p.M + m) * oH + oh) * oW + ow] = sum;
+    }
+}
+
+// Runs the Conv, or the FusedConv with one activation if act is not NULL.
+// Only Relu and Clip are checked here.
+void RunConv(const Conv2D& p, const char* act = NULL,
+             float alpha = 0.f, float beta = 0.f){
+    srand(time(NULL));
+    int32_t kC = p.C / p.group;
+    std::vector<float> X(p.N * p.C * p.H * p.W), Wt(p.M * kC * p.kH * p.kW);
+    std::vector<float> B(p.M);
+    std::vector<float> Y(p.N * p.M * p.oH() * p.oW()), Ans(Y.size());
+    for(float& v : X) v = rand() % 1000 / 100.0 - 5.0;
+    for(float& v : Wt) v = rand() % 1000 / 1000.0 - 0.5;
+    for(float& v : B) v = rand() % 1000 / 1000.0 - 0.5;
+
+    int32_t X_dims[4]{p.N, p.C, p.H, p.W};
+    int32_t W_dims[4]{p.M, kC, p.kH, p.kW};
+    int32_t B_dims[1]{p.M};
+    int32_t Y_dims[4]{p.N, p.M, p.oH(), p.oW()};
+    int32_t dilations[2]{p.dH, p.dW};
+    int32_t kernel_shape[2]{p.kH, p.kW};
+    int32_t pads[4]{p.pH, p.pW, p.pH, p.pW};
+    int32_t strides[2]{p.sH, p.sW};
+    // Run
+    if(act == NULL){
+        ONNC_RUNTIME_conv_float(NULL
+            ,X.data(), 4, X_dims
+            ,Wt.data(), 4, W_dims
+            ,B.data(), 1, B_dims
+            ,Y.data(), 4, Y_dims
+            ,"NOTSET"
+            ,dilations, 2
+            ,p.group
+            ,kernel_shape, 2
+            ,pads, 4
+            ,strides, 2
+        );
+    }else{
+        float activation_alpha[1]{alpha}, activation_beta[1]{beta};
+        const char* activations[1]{act};
+        ONNC_RUNTIME_fusedconv_float(NULL
+            ,X.data(), 4, X_dims
+            ,Wt.data(), 4, W_dims
+            ,B.data(), 1, B_dims
+            ,Y.data(), 4, Y_dims
+            ,activation_alpha, 1
+            ,activation_beta, 1
+            ,activations, 1
+            ,"NOTSET"
+            ,dilations, 2
+            ,p.group
+            ,kernel_shape, 2
+            ,pads, 4
+            ,strides, 2
+        );
+    }
+    ReferenceConv(p, X.data(), Wt.data(), B.data(), Ans.data());
+    if(act != NULL){
+        bool clip = (std::string(act) == "Clip");
+        for(float& v : Ans)
+            v = clip ? std::min(std::max(v, alpha), beta) : std::max(v, 0.f);
+    }
+    // Check
+    for(size_t i = 0; i < Y.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-3 * (1 + std::fabs(Ans[i])));
+    }
+}
+
+// Runs the WinogradConv of a 3x3, stride 1 convolution with output tiles of
+// tile x tile, with Relu as epilogue if relu is set.
+void RunWinogradConv(const Conv2D& p, int32_t tile, bool relu = false){
+    srand(time(NULL));
+    int32_t alpha = ONNC_RUNTIME_WINOGRAD_ALPHA(tile);
+    std::vector<float> X(p.N * p.C * p.H * p.W), Wt(p.M * p.C * 9);
+    std::vector<float> U(alpha * alpha * p.M * p.C), B(p.M);
+    std::vector<float> Y(p.N * p.M * p.oH() * p.oW()), Ans(Y.size());
+    for(float& v : X) v = rand() % 1000 / 100.0 - 5.0;
+    for(float& v : Wt) v = rand() % 1000 / 1000.0 - 0.5;
+    for(float& v : B) v = rand() % 1000 / 1000.0 - 0.5;
+    ONNC_RUNTIME_internal_winograd_weight_float(tile, p.M, p.C, Wt.data(),
+                                                U.data());
+
+    int32_t X_dims[4]{p.N, p.C, p.H, p.W};
+    int32_t U_dims[3]{alpha * alpha, p.M, p.C};
+    int32_t B_dims[1]{p.M};
+    int32_t Y_dims[4]{p.N, p.M, p.oH(), p.oW()};
+    int32_t pads[4]{p.pH, p.pW, p.pH, p.pW};
+    const char* activations[1]{"Relu"};
+    // Run
+    ONNC_RUNTIME_winogradconv_float(NULL
+        ,X.data(), 4, X_dims
+        ,U.data(), 3, U_dims
+        ,B.data(), 1, B_dims
+        ,Y.data(), 4, Y_dims
+        ,NULL, 0
+        ,NULL, 0
+        ,activations, relu ? 1 : 0
+        ,pads, 4
+        ,tile
+    );
+    ReferenceConv(p, X.data(), Wt.data(), B.data(), Ans.data());
+    if(relu){
+        for(float& v : Ans) v = std::max(v, 0.f);
+    }
+    // Check
+    for(size_t i = 0; i < Y.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-3 * (1 + std::fabs(Ans[i])));
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_Conv, general){
+    RunConv(Conv2D{2, 3, 17, 19, 8, 1, 3, 3, 1, 1, 1, 1, 1, 1});
+    RunConv(Conv2D{1, 32, 24, 24, 40, 1, 3, 3, 2, 2, 1, 1, 1, 1});
+}
+
+SKYPAT_F(Operator_Conv, grouped_dilated){
+    RunConv(Conv2D{1, 4, 10, 10, 6, 2, 3, 3, 2, 1, 0, 2, 1, 2});
+}
+
+SKYPAT_F(Operator_Conv, pointwise){
+    RunConv(Conv2D{1, 16, 9, 9, 32, 1, 1, 1, 1, 1, 0, 0, 1, 1});
+    RunConv(Conv2D{1, 3, 8, 8, 5, 1, 1, 1, 2, 2, 0, 0, 1, 1});
+}
+
+SKYPAT_F(Operator_Conv, depthwise){
+    RunConv(Conv2D{1, 8, 15, 13, 8, 8, 3, 3, 2, 2, 1, 1, 1, 1});
+    RunConv(Conv2D{1, 8, 15, 13, 16, 8, 3, 5, 1, 2, 2, 1, 2, 1});
+}
+
+SKYPAT_F(Operator_FusedConv, general){
+    RunConv(Conv2D{2, 3, 17, 19, 8, 1, 3, 3, 1, 1, 1, 1, 1, 1}, "Relu");
+    RunConv(Conv2D{1, 32, 24, 24, 40, 1, 3, 3, 2, 2, 1, 1, 1, 1}, "Clip", 0.f, 6.f);
+}
+
+SKYPAT_F(Operator_FusedConv, pointwise){
+    RunConv(Conv2D{1, 16, 9, 9, 32, 1, 1, 1, 1, 1, 0, 0, 1, 1}, "Relu");
+}
+
+SKYPAT_F(Operator_FusedConv, depthwise){
+    RunConv(Conv2D{1, 8, 15, 13, 8, 8, 3, 3, 2, 2, 1, 1, 1, 1}, "Clip", -1.f, 1.f);
+}
+
+SKYPAT_F(Operator_WinogradConv, f2x2){
+    RunWinogradConv(Conv2D{2, 3, 17, 19, 8, 1, 3, 3, 1, 1, 1, 1, 1, 1}, 2);
+    RunWinogradConv(Conv2D{1, 8, 6, 7, 5, 1, 3, 3, 1, 1, 0, 0, 1, 1}, 2);
+}
+
+SKYPAT_F(Operator_WinogradConv, f4x4){
+    RunWinogradConv(Conv2D{2, 3, 17, 19, 8, 1, 3, 3, 1, 1, 1, 1, 1, 1}, 4);
+    RunWinogradConv(Conv2D{1, 8, 6, 7, 5, 1, 3, 3, 1, 1, 0, 0, 1, 1}, 4);
+}
+
+// More tiles than one block holds.
+SKYPAT_F(Operator_WinogradConv, blocked){
+    RunWinogradConv(Conv2D{1, 64, 40, 40, 64, 1, 3, 3, 1, 1, 1, 1, 1, 1}, 2);
+    RunWinogradConv(Conv2D{1, 64, 56, 56, 64, 1, 3, 3, 1, 1, 1, 1, 1, 1}, 4, true);
+}
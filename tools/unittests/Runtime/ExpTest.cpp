@@ -0,0 +1,77 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/exp.h>
+    #include <onnc/Runtime/operator/sigmoid.h>
+    #include <onnc/Runtime/operator/tanh.h>
+}
+#undef restrict
+
+namespace {
+
+// Distance between got and ref in units in the last place of ref.
+double UlpError(float got, double ref){
+    float r = ref;
+    double ulp = std::nextafter(std::fabs(r), INFINITY) - std::fabs(r);
+    return std::fabs(got - ref) / ulp;
+}
+
+const int32_t kDataSize = 4099;
+
+void Prepare(float* X){
+    srand(time(NULL));
+    for(int32_t i = 0; i < kDataSize; ++i){
+        X[i] = (rand() % 170000 - 85000) / 1000.0;
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_Exp, accuracy){
+    float X[kDataSize], Y[kDataSize];
+    int32_t dims[1]{kDataSize};
+    Prepare(X);
+    ONNC_RUNTIME_exp_float(NULL, X, 1, dims, Y, 1, dims);
+    for(int32_t i = 0; i < kDataSize; ++i){
+        EXPECT_TRUE(UlpError(Y[i], std::exp((double)X[i])) < 2.0);
+    }
+}
+
+SKYPAT_F(Operator_Exp, tanh_accuracy){
+    float X[kDataSize], Y[kDataSize];
+    int32_t dims[1]{kDataSize};
+    Prepare(X);
+    for(int32_t i = 0; i < kDataSize; ++i){
+        X[i] /= 10.0;
+    }
+    ONNC_RUNTIME_tanh_float(NULL, X, 1, dims, Y, 1, dims);
+    for(int32_t i = 0; i < kDataSize; ++i){
+        EXPECT_TRUE(UlpError(Y[i], std::tanh((double)X[i])) < 2.0);
+    }
+}
+
+SKYPAT_F(Operator_Exp, sigmoid_accuracy){
+    float X[kDataSize], Y[kDataSize];
+    int32_t dims[1]{kDataSize};
+    Prepare(X);
+    ONNC_RUNTIME_sigmoid_float(NULL, X, 1, dims, Y, 1, dims);
+    for(int32_t i = 0; i < kDataSize; ++i){
+        double ref = 1.0 / (1.0 + std::exp(-(double)X[i]));
+        EXPECT_TRUE(UlpError(Y[i], ref) < 3.0);
+    }
+}
+
+SKYPAT_F(Operator_Exp, special_values){
+    float X[4]{INFINITY, -INFINITY, NAN, 0.0f};
+    float Y[4];
+    int32_t dims[1]{4};
+    ONNC_RUNTIME_exp_float(NULL, X, 1, dims, Y, 1, dims);
+    EXPECT_TRUE(std::isinf(Y[0]));
+    EXPECT_EQ(Y[1], 0.0f);
+    EXPECT_TRUE(std::isnan(Y[2]));
+    EXPECT_EQ(Y[3], 1.0f);
+}
@@ -0,0 +1,128 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/gru.h>
+}
+#undef restrict
+
+namespace {
+
+float Sigmoid(float x){
+    return 1.f / (1.f + std::exp(-x));
+}
+
+float Random(){
+    return rand() % 1000 / 1000.0 - 0.5;
+}
+
+// Straightforward per-timestep GRU with the default activations.
+void ReferenceGRU(int32_t seq, int32_t batch, int32_t input, int32_t H,
+                  int32_t linear_before_reset, bool reverse,
+                  const std::vector<float>& X, const std::vector<float>& W,
+                  const std::vector<float>& R, const std::vector<float>& B,
+                  const std::vector<float>& initial_h,
+                  std::vector<float>& Y, std::vector<float>& Y_h){
+    for(int32_t b = 0; b < batch; ++b){
+        std::vector<float> h(&initial_h[b * H], &initial_h[(b + 1) * H]);
+        std::vector<float> xw(3 * H), hr(3 * H), rh(H);
+        for(int32_t s = 0; s < seq; ++s){
+            int32_t t = reverse ? seq - 1 - s : s;
+            for(int32_t j = 0; j < 3 * H; ++j){
+                xw[j] = B[j];
+                for(int32_t k = 0; k < input; ++k){
+                    xw[j] += X[(t * batch + b) * input + k] * W[j * input + k];
+                }
+                hr[j] = B[3 * H + j];
+                for(int32_t k = 0; k < H; ++k){
+                    hr[j] += h[k] * R[j * H + k];
+                }
+            }
+            std::vector<float> z(H), r(H);
+            for(int32_t j = 0; j < H; ++j){
+                z[j] = Sigmoid(xw[j] + hr[j]);
+                r[j] = Sigmoid(xw[H + j] + hr[H + j]);
+                rh[j] = r[j] * h[j];
+            }
+            for(int32_t j = 0; j < H; ++j){
+                float hidden;
+                if(linear_before_reset){
+                    hidden = std::tanh(xw[2 * H + j] + r[j] * hr[2 * H + j]);
+                }else{
+                    float sum = B[5 * H + j];
+                    for(int32_t k = 0; k < H; ++k){
+                        sum += rh[k] * R[(2 * H + j) * H + k];
+                    }
+                    hidden = std::tanh(xw[2 * H + j] + sum);
+                }
+                Y[(t * batch + b) * H + j] = (1.f - z[j]) * hidden + z[j] * h[j];
+            }
+            for(int32_t j = 0; j < H; ++j){
+                h[j] = Y[(t * batch + b) * H + j];
+            }
+        }
+        for(int32_t j = 0; j < H; ++j){
+            Y_h[b * H + j] = h[j];
+        }
+    }
+}
+
+void RunGRU(const char* direction, int32_t linear_before_reset){
+    srand(time(NULL));
+    const int32_t seq = 6, batch = 3, input = 9, H = 13;
+    const bool reverse = std::string(direction) == "reverse";
+    std::vector<float> X(seq * batch * input), W(3 * H * input), R(3 * H * H),
+        B(6 * H), initial_h(batch * H);
+    for(float& v : X) v = Random();
+    for(float& v : W) v = Random();
+    for(float& v : R) v = Random();
+    for(float& v : B) v = Random();
+    for(float& v : initial_h) v = Random();
+
+    std::vector<float> Y(seq * batch * H), Y_h(batch * H);
+    std::vector<float> Ans(Y.size()), Ans_h(Y_h.size());
+    ReferenceGRU(seq, batch, input, H, linear_before_reset, reverse,
+                 X, W, R, B, initial_h, Ans, Ans_h);
+
+    int32_t X_dims[3]{seq, batch, input};
+    int32_t W_dims[3]{1, 3 * H, input};
+    int32_t R_dims[3]{1, 3 * H, H};
+    int32_t B_dims[2]{1, 6 * H};
+    int32_t h_dims[3]{1, batch, H};
+    int32_t Y_dims[4]{seq, 1, batch, H};
+    // Run
+    ONNC_RUNTIME_gru_float(NULL
+        ,X.data(), 3, X_dims
+        ,W.data(), 3, W_dims
+        ,R.data(), 3, R_dims
+        ,B.data(), 2, B_dims
+        ,NULL, 0, NULL
+        ,initial_h.data(), 3, h_dims
+        ,Y.data(), 4, Y_dims
+        ,Y_h.data(), 3, h_dims
+        ,NULL, 0, NULL, 0, NULL, 0
+        ,0.f, direction, H, linear_before_reset
+    );
+    // Check
+    for(size_t i = 0; i < Y.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-4);
+    }
+    for(size_t i = 0; i < Y_h.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y_h[i] - Ans_h[i]) <= 1e-4);
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_GRU, forward){
+    RunGRU("forward", 0);
+}
+
+SKYPAT_F(Operator_GRU, reverse_linear_before_reset){
+    RunGRU("reverse", 1);
+}
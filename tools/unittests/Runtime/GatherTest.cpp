@@ -0,0 +1,81 @@
+#include <skypat/skypat.h>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/concat.h>
+    #include <onnc/Runtime/operator/gather.h>
+}
+#undef restrict
+
+SKYPAT_F(Operator_Gather, axis_0){
+    // data is 3x2; indices are 2x2 and the output is 2x2x2.
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    std::vector<float> indices{0, 2, -1, 1};
+    std::vector<float> out(8, -1.f);
+    int32_t data_dims[2]{3, 2};
+    int32_t indices_dims[2]{2, 2};
+    int32_t out_dims[3]{2, 2, 2};
+    ONNC_RUNTIME_gather_float(NULL
+        ,data.data(), 2, data_dims
+        ,indices.data(), 2, indices_dims
+        ,out.data(), 3, out_dims
+        ,0
+    );
+    std::vector<float> ans{1, 2, 5, 6, 5, 6, 3, 4};
+    for(size_t i = 0; i < ans.size(); ++i){
+        EXPECT_EQ(out[i], ans[i]);
+    }
+}
+
+SKYPAT_F(Operator_Gather, axis_1){
+    // Take columns 2 and 0 of a 2x3 matrix.
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    std::vector<float> indices{2, 0};
+    std::vector<float> out(4, -1.f);
+    int32_t data_dims[2]{2, 3};
+    int32_t indices_dims[1]{2};
+    int32_t out_dims[2]{2, 2};
+    ONNC_RUNTIME_gather_float(NULL
+        ,data.data(), 2, data_dims
+        ,indices.data(), 1, indices_dims
+        ,out.data(), 2, out_dims
+        ,-1
+    );
+    std::vector<float> ans{3, 1, 6, 4};
+    for(size_t i = 0; i < ans.size(); ++i){
+        EXPECT_EQ(out[i], ans[i]);
+    }
+}
+
+// A dimension of a shape, as in Shape -> Gather -> Unsqueeze -> Concat.
+SKYPAT_F(Operator_Gather, scalar_index){
+    std::vector<float> shape{1, 3, 224, 224};
+    float index = 1, out = 0;
+    int32_t shape_dims[1]{4};
+    ONNC_RUNTIME_gather_float(NULL
+        ,shape.data(), 1, shape_dims
+        ,&index, 0, NULL
+        ,&out, 0, NULL
+        ,0
+    );
+    EXPECT_EQ(out, 3.f);
+}
+
+SKYPAT_F(Operator_Concat, axis_1){
+    // 2x1 and 2x2 make 2x3.
+    std::vector<float> a{1, 2}, b{3, 4, 5, 6}, out(6, -1.f);
+    int32_t a_dims[2]{2, 1}, b_dims[2]{2, 2}, out_dims[2]{2, 3};
+    const float* inputs[2]{a.data(), b.data()};
+    int32_t ndims[2]{2, 2};
+    const int32_t* dims[2]{a_dims, b_dims};
+    ONNC_RUNTIME_concat_float(NULL
+        ,inputs, 2, ndims, dims
+        ,out.data(), 2, out_dims
+        ,1
+    );
+    std::vector<float> ans{1, 3, 4, 2, 5, 6};
+    for(size_t i = 0; i < ans.size(); ++i){
+        EXPECT_EQ(out[i], ans[i]);
+    }
+}
@@ -0,0 +1,80 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/gemm.h>
+}
+#undef restrict
+
+namespace {
+
+void RunGemm(int32_t M, int32_t N, int32_t K, int32_t transA, int32_t transB,
+             int32_t C_ndim, const int32_t* C_dims){
+    srand(time(NULL));
+    float alpha = 0.5, beta = 2.0;
+    std::vector<float> A(M * K), B(K * N), Y(M * N), Ans(M * N);
+    int32_t C_size = 1;
+    for(int32_t i = 0; i < C_ndim; ++i){
+        C_size *= C_dims[i];
+    }
+    std::vector<float> C(C_size);
+    for(float& v : A) v = rand() % 1000 / 1000.0 - 0.5;
+    for(float& v : B) v = rand() % 1000 / 1000.0 - 0.5;
+    for(float& v : C) v = rand() % 1000 / 1000.0 - 0.5;
+
+    int32_t C_M = (C_ndim == 2) ? C_dims[0] : 1;
+    int32_t C_N = (C_ndim >= 1) ? C_dims[C_ndim - 1] : 1;
+    for(int32_t i = 0; i < M; ++i){
+        for(int32_t j = 0; j < N; ++j){
+            double sum = 0;
+            for(int32_t k = 0; k < K; ++k){
+                float a = transA ? A[k * M + i] : A[i * K + k];
+                float b = transB ? B[j * K + k] : B[k * N + j];
+                sum += a * b;
+            }
+            float c = C[(C_M == 1 ? 0 : i) * C_N + (C_N == 1 ? 0 : j)];
+            Ans[i * N + j] = alpha * sum + beta * c;
+        }
+    }
+
+    int32_t A_dims[2]{transA ? K : M, transA ? M : K};
+    int32_t B_dims[2]{transB ? N : K, transB ? K : N};
+    int32_t Y_dims[2]{M, N};
+    // Run
+    ONNC_RUNTIME_gemm_float(NULL
+        ,A.data(), 2, A_dims
+        ,B.data(), 2, B_dims
+        ,C.data(), C_ndim, C_dims
+        ,Y.data(), 2, Y_dims
+        ,alpha, beta, transA, transB
+    );
+    // Check
+    for(int32_t i = 0; i < M * N; ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-4 * (1 + std::fabs(Ans[i])));
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_Gemm, no_transpose){
+    int32_t C_dims[2]{37, 29};
+    RunGemm(37, 29, 300, 0, 0, 2, C_dims);
+}
+
+SKYPAT_F(Operator_Gemm, transpose){
+    int32_t C_dims[1]{29};
+    RunGemm(37, 29, 17, 1, 0, 1, C_dims);
+    RunGemm(37, 29, 17, 0, 1, 1, C_dims);
+    RunGemm(37, 29, 17, 1, 1, 1, C_dims);
+}
+
+SKYPAT_F(Operator_Gemm, broadcast_C){
+    int32_t column[2]{13, 1};
+    RunGemm(13, 50, 8, 0, 1, 2, column);
+    int32_t scalar[1]{1};
+    RunGemm(13, 50, 8, 0, 1, 1, scalar);
+}
@@ -0,0 +1,210 @@
+#include <skypat/skypat.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/onnc-runtime.h>
+    #include <onnc/Runtime/operator/fusedconv.h>
+    #include <onnc/Runtime/operator/fusedgemm.h>
+    #include <onnc/Runtime/operator/matmul.h>
+    #include <onnc/Runtime/internal/half.h>
+    #include <onnc/Runtime/internal/sgemm.h>
+}
+#undef restrict
+
+namespace {
+
+std::vector<float> RandomFloat(size_t size){
+    std::vector<float> values(size);
+    for(float& v : values) v = rand() % 1000 / 1000.0 - 0.5;
+    return values;
+}
+
+// pWeights in storage, and the floats they stand for.
+struct Narrow{
+    std::vector<uint16_t> bits;
+    std::vector<float> values;
+
+    Narrow(const std::vector<float>& pWeights, int32_t storage)
+      : bits(pWeights.size()), values(pWeights.size()){
+        for(size_t i = 0; i < pWeights.size(); ++i){
+            if(storage == ONNC_RUNTIME_STORAGE_FLOAT16){
+                bits[i] = ONNC_RUNTIME_internal_float_to_half(pWeights[i]);
+                values[i] = ONNC_RUNTIME_internal_half_to_float(bits[i]);
+            }else{
+                bits[i] = ONNC_RUNTIME_internal_float_to_bfloat16(pWeights[i]);
+                values[i] = ONNC_RUNTIME_internal_bfloat16_to_float(bits[i]);
+            }
+        }
+    }
+};
+
+const int32_t kStorages[]{ONNC_RUNTIME_STORAGE_FLOAT16,
+                          ONNC_RUNTIME_STORAGE_BFLOAT16};
+
+void ExpectNear(const std::vector<float>& pY, const std::vector<float>& pExpected){
+    ASSERT_EQ(pY.size(), pExpected.size());
+    for(size_t i = 0; i < pY.size(); ++i)
+        EXPECT_TRUE(std::fabs(pY[i] - pExpected[i]) < 1e-4f);
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Runtime_Half, half_round_trip){
+    // Every half but the NaNs converts to float and back unchanged.
+    for(uint32_t h = 0; h < 0x10000; ++h){
+        uint16_t bits = static_cast<uint16_t>(h);
+        if((bits & 0x7c00) == 0x7c00 && (bits & 0x3ff) != 0) continue;
+        float x = ONNC_RUNTIME_internal_half_to_float(bits);
+        ASSERT_EQ(ONNC_RUNTIME_internal_float_to_half(x), bits);
+    }
+}
+
+SKYPAT_F(Runtime_Half, half_rounding){
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(1.f), 0x3c00);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(-2.f), 0xc000);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(65504.f), 0x7bff);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(65520.f), 0x7c00);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(1e-8f), 0x0000);
+    // Halfway between two halves rounds to the even one.
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(1.f + 1.f / 2048), 0x3c00);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(1.f + 3.f / 2048), 0x3c02);
+    // The smallest subnormal, and ties below it.
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(5.9604645e-8f), 0x0001);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(2.9802322e-8f), 0x0000);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(8.9406967e-8f), 0x0002);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_half(NAN) & 0x7fff, 0x7e00);
+}
+
+SKYPAT_F(Runtime_Half, bfloat16_rounding){
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_bfloat16(1.f), 0x3f80);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_bfloat16(-1.5f), 0xbfc0);
+    // 1 + 2^-8 is a tie and rounds to 1; 1 + 3 * 2^-8 rounds up.
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_bfloat16(1.f + 1.f / 256), 0x3f80);
+    EXPECT_EQ(ONNC_RUNTIME_internal_float_to_bfloat16(1.f + 3.f / 256), 0x3f82);
+    EXPECT_EQ(ONNC_RUNTIME_internal_bfloat16_to_float(0x4049), 3.140625f);
+    EXPECT_TRUE(std::isnan(ONNC_RUNTIME_internal_bfloat16_to_float(
+        ONNC_RUNTIME_internal_float_to_bfloat16(NAN))));
+}
+
+SKYPAT_F(Runtime_Half, widen){
+    // Longer than a vector and not a multiple of one.
+    std::vector<float> X = RandomFloat(37);
+    for(int32_t storage : kStorages){
+        Narrow narrow(X, storage);
+        std::vector<float> Y(X.size());
+        ONNC_RUNTIME_internal_widen(storage, narrow.bits.data(), Y.data(),
+                                    static_cast<int64_t>(Y.size()));
+        for(size_t i = 0; i < Y.size(); ++i) EXPECT_EQ(Y[i], narrow.values[i]);
+    }
+}
+
+SKYPAT_F(Runtime_Half, sgemm_mixed){
+    // Sizes that leave partial blocks in every dimension.
+    const int32_t M = 13, N = 37, K = 300;
+    std::vector<float> A = RandomFloat(M * K), B = RandomFloat(K * N);
+    for(int32_t storage : kStorages){
+        Narrow narrowA(A, storage), narrowB(B, storage);
+        for(int trans = 0; trans < 4; ++trans){
+            bool transA = trans & 1, transB = trans & 2;
+            int32_t lda = transA ? M : K, ldb = transB ? K : N;
+            std::vector<float> Y(M * N), expected(M * N);
+            ONNC_RUNTIME_internal_sgemm(NULL, transA, transB, M, N, K, 1.f,
+                                        narrowA.values.data(), lda,
+                                        narrowB.values.data(), ldb,
+                                        0.f, expected.data(), N);
+
+            // Either operand may be narrow.
+            ONNC_RUNTIME_internal_sgemm_mixed(NULL, transA, transB, M, N, K,
+                                              1.f, narrowA.bits.data(), storage,
+                                              lda, narrowB.values.data(),
+                                              ONNC_RUNTIME_STORAGE_FLOAT, ldb,
+                                              0.f, Y.data(), N);
+            ExpectNear(Y, expected);
+            ONNC_RUNTIME_internal_sgemm_mixed(NULL, transA, transB, M, N, K,
+                                              1.f, narrowA.values.data(),
+                                              ONNC_RUNTIME_STORAGE_FLOAT, lda,
+                                              narrowB.bits.data(), storage, ldb,
+                                              0.f, Y.data(), N);
+            ExpectNear(Y, expected);
+        }
+    }
+}
+
+SKYPAT_F(Runtime_Half, fusedconv_mixed){
+    // A grouped 3x3 convolution and a depthwise one.
+    const int32_t groups[]{2, 4};
+    for(int32_t group : groups)
+    for(int32_t storage : kStorages){
+        const int32_t C = 4, M = 4, kC = C / group;
+        std::vector<float> X = RandomFloat(C * 7 * 7);
+        std::vector<float> W = RandomFloat(M * kC * 3 * 3), B = RandomFloat(M);
+        Narrow narrow(W, storage);
+        std::vector<float> Y(M * 5 * 5), expected(M * 5 * 5);
+
+        int32_t X_dims[4]{1, C, 7, 7}, W_dims[4]{M, kC, 3, 3};
+        int32_t B_dims[1]{M}, Y_dims[4]{1, M, 5, 5};
+        int32_t dilations[2]{1, 1}, kernel_shape[2]{3, 3};
+        int32_t pads[4]{0, 0, 0, 0}, strides[2]{1, 1};
+        const char* activations[1]{"Relu"};
+        ONNC_RUNTIME_fusedconv_float(NULL
+            ,X.data(), 4, X_dims, narrow.values.data(), 4, W_dims
+            ,B.data(), 1, B_dims, expected.data(), 4, Y_dims
+            ,NULL, 0, NULL, 0, activations, 1
+            ,"NOTSET", dilations, 2, group, kernel_shape, 2, pads, 4
+            ,strides, 2);
+        ONNC_RUNTIME_fusedconv_mixed(NULL
+            ,X.data(), 4, X_dims, narrow.bits.data(), 4, W_dims
+            ,B.data(), 1, B_dims, Y.data(), 4, Y_dims
+            ,NULL, 0, NULL, 0, activations, 1
+            ,"NOTSET", dilations, 2, group, kernel_shape, 2, pads, 4
+            ,strides, 2, storage);
+        ExpectNear(Y, expected);
+    }
+}
+
+SKYPAT_F(Runtime_Half, fusedgemm_mixed){
+    const int32_t M = 3, N = 20, K = 50;
+    std::vector<float> A = RandomFloat(M * K), B = RandomFloat(N * K);
+    std::vector<float> C = RandomFloat(N);
+    for(int32_t storage : kStorages){
+        Narrow narrow(B, storage);
+        std::vector<float> Y(M * N), expected(M * N);
+        int32_t A_dims[2]{M, K}, B_dims[2]{N, K}, C_dims[1]{N}, Y_dims[2]{M, N};
+        const char* activations[1]{"Relu"};
+        ONNC_RUNTIME_fusedgemm_float(NULL, A.data(), 2, A_dims,
+                                     narrow.values.data(), 2, B_dims,
+                                     C.data(), 1, C_dims, expected.data(), 2,
+                                     Y_dims, NULL, 0, NULL, 0, activations, 1,
+                                     1.f, 1.f, 0, 1);
+        ONNC_RUNTIME_fusedgemm_mixed(NULL, A.data(), 2, A_dims,
+                                     narrow.bits.data(), 2, B_dims,
+                                     C.data(), 1, C_dims, Y.data(), 2,
+                                     Y_dims, NULL, 0, NULL, 0, activations, 1,
+                                     1.f, 1.f, 0, 1, storage);
+        ExpectNear(Y, expected);
+    }
+}
+
+SKYPAT_F(Runtime_Half, matmul_mixed){
+    // A batch of distinct right-hand sides, so B is offset per product.
+    const int32_t batches = 3, M = 4, N = 9, K = 6;
+    std::vector<float> A = RandomFloat(batches * M * K);
+    std::vector<float> B = RandomFloat(batches * K * N);
+    for(int32_t storage : kStorages){
+        Narrow narrow(B, storage);
+        std::vector<float> Y(batches * M * N), expected(batches * M * N);
+        int32_t A_dims[3]{batches, M, K}, B_dims[3]{batches, K, N};
+        int32_t Y_dims[3]{batches, M, N};
+        ONNC_RUNTIME_matmul_float(NULL, A.data(), 3, A_dims,
+                                  narrow.values.data(), 3, B_dims,
+                                  expected.data(), 3, Y_dims);
+        ONNC_RUNTIME_matmul_mixed(NULL, A.data(), 3, A_dims,
+                                  narrow.bits.data(), 3, B_dims,
+                                  Y.data(), 3, Y_dims, storage);
+        ExpectNear(Y, expected);
+    }
+}
@@ -0,0 +1,124 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/lstm.h>
+}
+#undef restrict
+
+namespace {
+
+float Sigmoid(float x){
+    return 1.f / (1.f + std::exp(-x));
+}
+
+float Random(){
+    return rand() % 1000 / 1000.0 - 0.5;
+}
+
+// Straightforward per-timestep LSTM with the default activations.
+void ReferenceLSTM(int32_t seq, int32_t batch, int32_t input, int32_t H,
+                   int32_t num_directions, const std::vector<int32_t>& seq_lens,
+                   const std::vector<float>& X, const std::vector<float>& W,
+                   const std::vector<float>& R, const std::vector<float>& B,
+                   const std::vector<float>& P, std::vector<float>& Y,
+                   std::vector<float>& Y_h, std::vector<float>& Y_c){
+    for(int32_t d = 0; d < num_directions; ++d){
+        for(int32_t b = 0; b < batch; ++b){
+            std::vector<float> h(H, 0.f), c(H, 0.f), g(4 * H);
+            for(int32_t s = 0; s < seq_lens[b]; ++s){
+                int32_t t = (d == 1) ? seq_lens[b] - 1 - s : s;
+                for(int32_t j = 0; j < 4 * H; ++j){
+                    float sum = B[d * 8 * H + j] + B[d * 8 * H + 4 * H + j];
+                    for(int32_t k = 0; k < input; ++k){
+                        sum += X[(t * batch + b) * input + k] * W[(d * 4 * H + j) * input + k];
+                    }
+                    for(int32_t k = 0; k < H; ++k){
+                        sum += h[k] * R[(d * 4 * H + j) * H + k];
+                    }
+                    g[j] = sum;
+                }
+                const float* p = &P[d * 3 * H];
+                for(int32_t j = 0; j < H; ++j){
+                    float i = Sigmoid(g[j] + p[j] * c[j]);
+                    float f = Sigmoid(g[2 * H + j] + p[2 * H + j] * c[j]);
+                    c[j] = f * c[j] + i * std::tanh(g[3 * H + j]);
+                    float o = Sigmoid(g[H + j] + p[H + j] * c[j]);
+                    h[j] = o * std::tanh(c[j]);
+                    Y[((t * num_directions + d) * batch + b) * H + j] = h[j];
+                }
+            }
+            for(int32_t j = 0; j < H; ++j){
+                Y_h[(d * batch + b) * H + j] = h[j];
+                Y_c[(d * batch + b) * H + j] = c[j];
+            }
+        }
+    }
+}
+
+void RunLSTM(const char* direction, int32_t num_directions,
+             const std::vector<int32_t>& seq_lens){
+    srand(time(NULL));
+    const int32_t seq = 5, batch = seq_lens.size(), input = 7, H = 11;
+    std::vector<float> X(seq * batch * input), W(num_directions * 4 * H * input),
+        R(num_directions * 4 * H * H), B(num_directions * 8 * H),
+        P(num_directions * 3 * H);
+    for(float& v : X) v = Random();
+    for(float& v : W) v = Random();
+    for(float& v : R) v = Random();
+    for(float& v : B) v = Random();
+    for(float& v : P) v = Random();
+
+    std::vector<float> Y(seq * num_directions * batch * H, 0.f),
+        Y_h(num_directions * batch * H), Y_c(num_directions * batch * H);
+    std::vector<float> Ans(Y.size(), 0.f), Ans_h(Y_h.size()), Ans_c(Y_c.size());
+    ReferenceLSTM(seq, batch, input, H, num_directions, seq_lens,
+                  X, W, R, B, P, Ans, Ans_h, Ans_c);
+
+    int32_t X_dims[3]{seq, batch, input};
+    int32_t W_dims[3]{num_directions, 4 * H, input};
+    int32_t R_dims[3]{num_directions, 4 * H, H};
+    int32_t B_dims[2]{num_directions, 8 * H};
+    int32_t seq_lens_dims[1]{batch};
+    int32_t P_dims[2]{num_directions, 3 * H};
+    int32_t Y_dims[4]{seq, num_directions, batch, H};
+    int32_t Y_h_dims[3]{num_directions, batch, H};
+    // Run
+    ONNC_RUNTIME_lstm_float(NULL
+        ,X.data(), 3, X_dims
+        ,W.data(), 3, W_dims
+        ,R.data(), 3, R_dims
+        ,B.data(), 2, B_dims
+        ,reinterpret_cast<const float*>(seq_lens.data()), 1, seq_lens_dims
+        ,NULL, 0, NULL
+        ,NULL, 0, NULL
+        ,P.data(), 2, P_dims
+        ,Y.data(), 4, Y_dims
+        ,Y_h.data(), 3, Y_h_dims
+        ,Y_c.data(), 3, Y_h_dims
+        ,NULL, 0, NULL, 0, NULL, 0
+        ,0.f, direction, H, 0
+    );
+    // Check
+    for(size_t i = 0; i < Y.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-4);
+    }
+    for(size_t i = 0; i < Y_h.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y_h[i] - Ans_h[i]) <= 1e-4);
+        EXPECT_TRUE(std::fabs(Y_c[i] - Ans_c[i]) <= 1e-4);
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_LSTM, forward){
+    RunLSTM("forward", 1, std::vector<int32_t>{5, 5, 5});
+}
+
+SKYPAT_F(Operator_LSTM, bidirectional_sequence_lens){
+    RunLSTM("bidirectional", 2, std::vector<int32_t>{5, 2, 4, 1});
+}
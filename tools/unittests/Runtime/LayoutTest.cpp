@@ -0,0 +1,250 @@
+#include <skypat/skypat.h>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/batchnormalizationnchwc.h>
+    #include <onnc/Runtime/operator/convnchwc.h>
+    #include <onnc/Runtime/operator/poolnchwc.h>
+    #include <onnc/Runtime/operator/reorder.h>
+    #include <onnc/Runtime/internal/layout.h>
+}
+#undef restrict
+
+namespace {
+
+int32_t Blocks(int32_t C, int32_t block){
+    return ONNC_RUNTIME_internal_channel_blocks(C, block);
+}
+
+// X, a N x C x H x W tensor, in NCHWc.
+std::vector<float> ToBlocked(const std::vector<float>& X, int32_t N, int32_t C,
+                             int32_t H, int32_t W, int32_t block){
+    std::vector<float> Y(N * Blocks(C, block) * H * W * block);
+    int32_t X_dims[4]{N, C, H, W};
+    int32_t Y_dims[5]{N, Blocks(C, block), H, W, block};
+    ONNC_RUNTIME_reorder_float(NULL, X.data(), 4, X_dims, Y.data(), 5, Y_dims);
+    return Y;
+}
+
+// X, a N x C x H x W tensor in NCHWc, in NCHW.
+std::vector<float> FromBlocked(const std::vector<float>& X, int32_t N,
+                               int32_t C, int32_t H, int32_t W, int32_t block){
+    std::vector<float> Y(N * C * H * W);
+    int32_t X_dims[5]{N, Blocks(C, block), H, W, block};
+    int32_t Y_dims[4]{N, C, H, W};
+    ONNC_RUNTIME_reorder_float(NULL, X.data(), 5, X_dims, Y.data(), 4, Y_dims);
+    return Y;
+}
+
+std::vector<float> Random(size_t size, float scale){
+    std::vector<float> values(size);
+    for(float& v : values) v = (rand() % 1000 / 1000.0 - 0.5) * scale;
+    return values;
+}
+
+void ExpectNear(const std::vector<float>& Y, const std::vector<float>& Ans){
+    ASSERT_TRUE(Y.size() == Ans.size());
+    for(size_t i = 0; i < Y.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-3 * (1 + std::fabs(Ans[i])));
+    }
+}
+
+struct Conv2D {
+    int32_t N, C, H, W, M, kH, kW, sH, sW, pT, pL, pB, pR, dH, dW;
+
+    int32_t oH() const { return (H + pT + pB - ((kH - 1) * dH + 1)) / sH + 1; }
+    int32_t oW() const { return (W + pL + pR - ((kW - 1) * dW + 1)) / sW + 1; }
+};
+
+void ReferenceConv(const Conv2D& p, const float* X, const float* Wt,
+                   const float* B, bool relu, float* Y){
+    int32_t oH = p.oH(), oW = p.oW();
+    for(int32_t n = 0; n < p.N; ++n)
+    for(int32_t m = 0; m < p.M; ++m)
+    for(int32_t oh = 0; oh < oH; ++oh)
+    for(int32_t ow = 0; ow < oW; ++ow){
+        double sum = B[m];
+        for(int32_t c = 0; c < p.C; ++c)
+        for(int32_t kh = 0; kh < p.kH; ++kh)
+        for(int32_t kw = 0; kw < p.kW; ++kw){
+            int32_t ih = oh * p.sH - p.pT + kh * p.dH;
+            int32_t iw = ow * p.sW - p.pL + kw * p.dW;
+            if(ih < 0 || ih >= p.H || iw < 0 || iw >= p.W) continue;
+            sum += X[((n * p.C + c) * p.H + ih) * p.W + iw] *
+                   Wt[((m * p.C + c) * p.kH + kh) * p.kW + kw];
+        }
+        Y[((n * p.M + m) * oH + oh) * oW + ow] =
+            relu ? std::max(sum, 0.) : sum;
+    }
+}
+
+void RunConvNCHWc(const Conv2D& p, int32_t block, bool relu = false){
+    srand(time(NULL));
+    std::vector<float> X = Random(p.N * p.C * p.H * p.W, 10.f);
+    std::vector<float> Wt = Random(p.M * p.C * p.kH * p.kW, 1.f);
+    std::vector<float> B = Random(p.M, 1.f);
+    int32_t Cb = Blocks(p.C, block), Mb = Blocks(p.M, block);
+
+    std::vector<float> Xb = ToBlocked(X, p.N, p.C, p.H, p.W, block);
+    std::vector<float> Wb(Mb * Cb * p.kH * p.kW * block * block);
+    ONNC_RUNTIME_internal_conv_weight_nchwc(p.M, p.C, p.kH * p.kW, block,
+                                            Wt.data(), Wb.data());
+    std::vector<float> Bb(Mb * block, 0.f);
+    std::copy(B.begin(), B.end(), Bb.begin());
+    std::vector<float> Yb(p.N * Mb * p.oH() * p.oW() * block);
+
+    int32_t X_dims[5]{p.N, Cb, p.H, p.W, block};
+    int32_t W_dims[6]{Mb, Cb, p.kH, p.kW, block, block};
+    int32_t B_dims[1]{Mb * block};
+    int32_t Y_dims[5]{p.N, Mb, p.oH(), p.oW(), block};
+    int32_t dilations[2]{p.dH, p.dW};
+    int32_t pads[4]{p.pT, p.pL, p.pB, p.pR};
+    int32_t strides[2]{p.sH, p.sW};
+    const char* activations[1]{"Relu"};
+    // Run
+    ONNC_RUNTIME_convnchwc_float(NULL
+        ,Xb.data(), 5, X_dims
+        ,Wb.data(), 6, W_dims
+        ,Bb.data(), 1, B_dims
+        ,Yb.data(), 5, Y_dims
+        ,NULL, 0
+        ,NULL, 0
+        ,activations, relu ? 1 : 0
+        ,dilations, 2
+        ,pads, 4
+        ,strides, 2
+    );
+    std::vector<float> Ans(p.N * p.M * p.oH() * p.oW());
+    ReferenceConv(p, X.data(), Wt.data(), B.data(), relu, Ans.data());
+    // Check
+    ExpectNear(FromBlocked(Yb, p.N, p.M, p.oH(), p.oW(), block), Ans);
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_Reorder, round_trip){
+    srand(time(NULL));
+    for(int32_t block : {8, 16}){
+        std::vector<float> X = Random(2 * 21 * 5 * 7, 10.f);
+        std::vector<float> Xb = ToBlocked(X, 2, 21, 5, 7, block);
+        // The padding channels of the last block are zero.
+        int32_t Cb = Blocks(21, block);
+        for(int32_t n = 0; n < 2; ++n)
+        for(int32_t s = 0; s < 5 * 7; ++s)
+        for(int32_t c = 21 - (Cb - 1) * block; c < block; ++c){
+            EXPECT_EQ(Xb[((n * Cb + Cb - 1) * 35 + s) * block + c], 0.f);
+        }
+        // The first channel of the second block.
+        EXPECT_EQ(Xb[(1 * 35 + 3) * block], X[block * 35 + 3]);
+        std::vector<float> Y = FromBlocked(Xb, 2, 21, 5, 7, block);
+        EXPECT_TRUE(X == Y);
+    }
+}
+
+SKYPAT_F(Operator_ConvNCHWc, general){
+    RunConvNCHWc(Conv2D{2, 3, 17, 19, 8, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1}, 8);
+    RunConvNCHWc(Conv2D{1, 32, 24, 24, 40, 3, 3, 2, 2, 1, 1, 1, 1, 1, 1}, 8);
+    RunConvNCHWc(Conv2D{1, 20, 9, 30, 36, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1}, 16, true);
+}
+
+SKYPAT_F(Operator_ConvNCHWc, pads_dilations){
+    RunConvNCHWc(Conv2D{1, 12, 10, 11, 6, 3, 5, 2, 1, 0, 2, 1, 0, 1, 2}, 8);
+    RunConvNCHWc(Conv2D{2, 16, 7, 7, 24, 3, 3, 1, 1, 2, 2, 2, 2, 2, 2}, 16);
+}
+
+SKYPAT_F(Operator_ConvNCHWc, pointwise){
+    RunConvNCHWc(Conv2D{1, 64, 14, 14, 48, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1}, 8, true);
+    RunConvNCHWc(Conv2D{1, 16, 8, 8, 5, 1, 1, 2, 2, 0, 0, 0, 0, 1, 1}, 16);
+}
+
+SKYPAT_F(Operator_PoolNCHWc, max_average){
+    srand(time(NULL));
+    const int32_t N = 2, C = 19, H = 11, W = 13;
+    const int32_t K = 3, S = 2, P = 1;
+    const int32_t OH = (H + 2 * P - K) / S + 1, OW = (W + 2 * P - K) / S + 1;
+    std::vector<float> X = Random(N * C * H * W, 10.f);
+    for(int32_t block : {8, 16}){
+        int32_t Cb = Blocks(C, block);
+        std::vector<float> Xb = ToBlocked(X, N, C, H, W, block);
+        std::vector<float> Yb(N * Cb * OH * OW * block);
+        int32_t X_dims[5]{N, Cb, H, W, block};
+        int32_t Y_dims[5]{N, Cb, OH, OW, block};
+        int32_t kernel_shape[2]{K, K};
+        int32_t pads[4]{P, P, P, P};
+        int32_t strides[2]{S, S};
+        for(int32_t kind = 0; kind < 3; ++kind){
+            bool max = (kind == 0), include_pad = (kind == 2);
+            ONNC_RUNTIME_poolnchwc_float(NULL
+                ,Xb.data(), 5, X_dims
+                ,Yb.data(), 5, Y_dims
+                ,include_pad ? 1 : 0
+                ,kernel_shape, 2
+                ,max ? "MAX" : "AVERAGE"
+                ,pads, 4
+                ,strides, 2
+            );
+            std::vector<float> Ans(N * C * OH * OW);
+            for(int32_t nc = 0; nc < N * C; ++nc)
+            for(int32_t oh = 0; oh < OH; ++oh)
+            for(int32_t ow = 0; ow < OW; ++ow){
+                double acc = max ? -FLT_MAX : 0.;
+                int32_t count = 0;
+                for(int32_t h = oh * S - P; h < oh * S - P + K; ++h)
+                for(int32_t w = ow * S - P; w < ow * S - P + K; ++w){
+                    if(h < 0 || h >= H || w < 0 || w >= W) continue;
+                    float v = X[(nc * H + h) * W + w];
+                    acc = max ? std::max<double>(acc, v) : acc + v;
+                    ++count;
+                }
+                Ans[(nc * OH + oh) * OW + ow] =
+                    max ? acc : acc / (include_pad ? K * K : count);
+            }
+            ExpectNear(FromBlocked(Yb, N, C, OH, OW, block), Ans);
+        }
+    }
+}
+
+SKYPAT_F(Operator_BatchNormalizationNCHWc, inference){
+    srand(time(NULL));
+    const int32_t N = 2, C = 27, H = 6, W = 5;
+    const float epsilon = 1e-5f;
+    std::vector<float> X = Random(N * C * H * W, 10.f);
+    std::vector<float> scale = Random(C, 2.f), B = Random(C, 2.f);
+    std::vector<float> mean = Random(C, 2.f), var = Random(C, 1.f);
+    for(float& v : var) v += 1.f;
+    std::vector<float> Ans(X.size());
+    for(int32_t n = 0; n < N; ++n)
+    for(int32_t c = 0; c < C; ++c)
+    for(int32_t s = 0; s < H * W; ++s){
+        int32_t i = (n * C + c) * H * W + s;
+        Ans[i] = scale[c] * (X[i] - mean[c]) / std::sqrt(var[c] + epsilon) +
+                 B[c];
+    }
+    for(int32_t block : {8, 16}){
+        int32_t Cb = Blocks(C, block);
+        std::vector<float> Xb = ToBlocked(X, N, C, H, W, block);
+        std::vector<float> Yb(Xb.size(), 1.f);
+        int32_t X_dims[5]{N, Cb, H, W, block};
+        int32_t C_dims[1]{C};
+        ONNC_RUNTIME_batchnormalizationnchwc_float(NULL
+            ,Xb.data(), 5, X_dims
+            ,scale.data(), 1, C_dims
+            ,B.data(), 1, C_dims
+            ,mean.data(), 1, C_dims
+            ,var.data(), 1, C_dims
+            ,Yb.data(), 5, X_dims
+            ,epsilon
+        );
+        ExpectNear(FromBlocked(Yb, N, C, H, W, block), Ans);
+        // The padding channels are zero.
+        for(int32_t c = C - (Cb - 1) * block; c < block; ++c){
+            EXPECT_EQ(Yb[(Cb - 1) * H * W * block + c], 0.f);
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/matmul.h>
+}
+#undef restrict
+
+namespace {
+
+void Fill(std::vector<float>& pData){
+    for(float& v : pData) v = rand() % 1000 / 1000.0 - 0.5;
+}
+
+bool Near(float pA, float pB){
+    return std::fabs(pA - pB) <= 1e-4 * (1 + std::fabs(pB));
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_MatMul, two_dimensional){
+    // Prepare
+    srand(time(NULL));
+    int32_t M = 19, K = 70, N = 33;
+    std::vector<float> A(M * K), B(K * N), Y(M * N);
+    Fill(A);
+    Fill(B);
+    int32_t A_dims[2]{M, K}, B_dims[2]{K, N}, Y_dims[2]{M, N};
+    // Run
+    ONNC_RUNTIME_matmul_float(NULL, A.data(), 2, A_dims, B.data(), 2, B_dims,
+                              Y.data(), 2, Y_dims);
+    // Check
+    for(int32_t i = 0; i < M; ++i){
+        for(int32_t j = 0; j < N; ++j){
+            double sum = 0;
+            for(int32_t k = 0; k < K; ++k){
+                sum += A[i * K + k] * B[k * N + j];
+            }
+            EXPECT_TRUE(Near(Y[i * N + j], sum));
+        }
+    }
+}
+
+SKYPAT_F(Operator_MatMul, shared_weight){
+    // Prepare: [2, 3, 5, 8] x [8, 6] -> [2, 3, 5, 6]
+    srand(time(NULL));
+    std::vector<float> A(2 * 3 * 5 * 8), B(8 * 6), Y(2 * 3 * 5 * 6);
+    Fill(A);
+    Fill(B);
+    int32_t A_dims[4]{2, 3, 5, 8}, B_dims[2]{8, 6}, Y_dims[4]{2, 3, 5, 6};
+    // Run
+    ONNC_RUNTIME_matmul_float(NULL, A.data(), 4, A_dims, B.data(), 2, B_dims,
+                              Y.data(), 4, Y_dims);
+    // Check
+    for(int32_t r = 0; r < 30; ++r){
+        for(int32_t j = 0; j < 6; ++j){
+            double sum = 0;
+            for(int32_t k = 0; k < 8; ++k){
+                sum += A[r * 8 + k] * B[k * 6 + j];
+            }
+            EXPECT_TRUE(Near(Y[r * 6 + j], sum));
+        }
+    }
+}
+
+SKYPAT_F(Operator_MatMul, batch_broadcast){
+    // Prepare: [3, 1, 4, 5] x [2, 5, 7] -> [3, 2, 4, 7]
+    srand(time(NULL));
+    std::vector<float> A(3 * 4 * 5), B(2 * 5 * 7), Y(3 * 2 * 4 * 7);
+    Fill(A);
+    Fill(B);
+    int32_t A_dims[4]{3, 1, 4, 5}, B_dims[3]{2, 5, 7}, Y_dims[4]{3, 2, 4, 7};
+    // Run
+    ONNC_RUNTIME_matmul_float(NULL, A.data(), 4, A_dims, B.data(), 3, B_dims,
+                              Y.data(), 4, Y_dims);
+    // Check
+    for(int32_t x = 0; x < 3; ++x){
+        for(int32_t y = 0; y < 2; ++y){
+            for(int32_t i = 0; i < 4; ++i){
+                for(int32_t j = 0; j < 7; ++j){
+                    double sum = 0;
+                    for(int32_t k = 0; k < 5; ++k){
+                        sum += A[(x * 4 + i) * 5 + k] * B[(y * 5 + k) * 7 + j];
+                    }
+                    EXPECT_TRUE(Near(Y[((x * 2 + y) * 4 + i) * 7 + j], sum));
+                }
+            }
+        }
+    }
+}
+
+SKYPAT_F(Operator_MatMul, vector_operands){
+    // Prepare: [5] x [5, 3] -> [3] and [4, 5] x [5] -> [4]
+    srand(time(NULL));
+    std::vector<float> V(5), B(5 * 3), A(4 * 5), Y1(3), Y2(4);
+    Fill(V);
+    Fill(B);
+    Fill(A);
+    int32_t V_dims[1]{5}, B_dims[2]{5, 3}, A_dims[2]{4, 5};
+    int32_t Y1_dims[1]{3}, Y2_dims[1]{4};
+    // Run
+    ONNC_RUNTIME_matmul_float(NULL, V.data(), 1, V_dims, B.data(), 2, B_dims,
+                              Y1.data(), 1, Y1_dims);
+    ONNC_RUNTIME_matmul_float(NULL, A.data(), 2, A_dims, V.data(), 1, V_dims,
+                              Y2.data(), 1, Y2_dims);
+    // Check
+    for(int32_t j = 0; j < 3; ++j){
+        double sum = 0;
+        for(int32_t k = 0; k < 5; ++k){
+            sum += V[k] * B[k * 3 + j];
+        }
+        EXPECT_TRUE(Near(Y1[j], sum));
+    }
+    for(int32_t i = 0; i < 4; ++i){
+        double sum = 0;
+        for(int32_t k = 0; k < 5; ++k){
+            sum += A[i * 5 + k] * V[k];
+        }
+        EXPECT_TRUE(Near(Y2[i], sum));
+    }
+}
+
+SKYPAT_F(Operator_MatMul, many_batch_dimensions){
+    // Prepare: [2, 1 x 18, 1, 3, 4] x [2, 4, 5] -> [2, 1 x 18, 2, 3, 5]
+    srand(time(NULL));
+    const int32_t ndim = 22;
+    std::vector<float> A(2 * 3 * 4), B(2 * 4 * 5), Y(2 * 2 * 3 * 5);
+    Fill(A);
+    Fill(B);
+    std::vector<int32_t> A_dims(ndim, 1), Y_dims(ndim, 1);
+    A_dims[0] = 2; A_dims[ndim - 2] = 3; A_dims[ndim - 1] = 4;
+    Y_dims[0] = 2; Y_dims[ndim - 3] = 2; Y_dims[ndim - 2] = 3;
+    Y_dims[ndim - 1] = 5;
+    int32_t B_dims[3]{2, 4, 5};
+    // Run
+    ONNC_RUNTIME_matmul_float(NULL, A.data(), ndim, A_dims.data(),
+                              B.data(), 3, B_dims, Y.data(), ndim,
+                              Y_dims.data());
+    // Check
+    for(int32_t x = 0; x < 2; ++x){
+        for(int32_t y = 0; y < 2; ++y){
+            for(int32_t i = 0; i < 3; ++i){
+                for(int32_t j = 0; j < 5; ++j){
+                    double sum = 0;
+                    for(int32_t k = 0; k < 4; ++k){
+                        sum += A[(x * 3 + i) * 4 + k] * B[(y * 4 + k) * 5 + j];
+                    }
+                    EXPECT_TRUE(Near(Y[((x * 2 + y) * 3 + i) * 5 + j], sum));
+                }
+            }
+        }
+    }
+}
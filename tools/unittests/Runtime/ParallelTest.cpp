@@ -0,0 +1,57 @@
+#include <skypat/skypat.h>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/onnc-runtime.h>
+    #include <onnc/Runtime/internal/parallel.h>
+}
+#undef restrict
+
+namespace {
+
+struct Job {
+    void* context;
+    int64_t sum;
+};
+
+void AddTask(void* arg, int32_t task){
+    __atomic_fetch_add(&static_cast<Job*>(arg)->sum, task, __ATOMIC_RELAXED);
+}
+
+// A task that starts a parallel loop of its own, like an operator does.
+void RunJob(void* arg){
+    Job* job = static_cast<Job*>(arg);
+    ONNC_RUNTIME_internal_parallel_for(job->context, 100, AddTask, job);
+}
+
+void RunJobs(int32_t num_threads){
+    void* context = ONNC_RUNTIME_init_runtime();
+    ONNC_RUNTIME_set_num_threads(context, num_threads);
+    EXPECT_EQ(ONNC_RUNTIME_internal_num_threads(context), num_threads);
+
+    // Run
+    std::vector<Job> jobs(500, Job{context, 0});
+    ONNC_RUNTIME_Task_group group{0};
+    for(Job& job : jobs){
+        ONNC_RUNTIME_internal_submit(context, &group, RunJob, &job);
+    }
+    ONNC_RUNTIME_internal_wait(context, &group);
+
+    // Check
+    EXPECT_EQ(group.pending, 0);
+    for(const Job& job : jobs){
+        EXPECT_EQ(job.sum, 4950);
+    }
+    ONNC_RUNTIME_shutdown_runtime(context);
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Runtime_Parallel, single_thread){
+    RunJobs(1);
+}
+
+SKYPAT_F(Runtime_Parallel, nested_tasks){
+    RunJobs(4);
+}
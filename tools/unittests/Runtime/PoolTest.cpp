@@ -0,0 +1,169 @@
+#include <skypat/skypat.h>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/onnc-runtime.h>
+    #include <onnc/Runtime/operator/averagepool.h>
+    #include <onnc/Runtime/operator/globalaveragepool.h>
+    #include <onnc/Runtime/operator/globalmaxpool.h>
+    #include <onnc/Runtime/operator/lppool.h>
+    #include <onnc/Runtime/operator/maxpool.h>
+}
+#undef restrict
+
+namespace {
+
+enum Kind { kAverage, kAverageIncludePad, kMax, kLp };
+
+struct Pool2D {
+    int32_t N, C, H, W;
+    int32_t KH, KW, SH, SW, PH, PW;
+};
+
+// Element (n, c, h, w) of the reference pooling, or of the padded input
+// when the window goes outside.
+float Reference(Kind pKind, int32_t pP, const Pool2D& p,
+                const std::vector<float>& pX, int32_t pNC,
+                int32_t pOH, int32_t pOW){
+    double acc = (pKind == kMax) ? -FLT_MAX : 0.;
+    int32_t count = 0;
+    for(int32_t kh = 0; kh < p.KH; ++kh){
+        for(int32_t kw = 0; kw < p.KW; ++kw){
+            int32_t h = pOH * p.SH - p.PH + kh;
+            int32_t w = pOW * p.SW - p.PW + kw;
+            if(h < 0 || h >= p.H || w < 0 || w >= p.W){
+                continue;
+            }
+            float v = pX[((int64_t)pNC * p.H + h) * p.W + w];
+            ++count;
+            if(pKind == kMax){
+                acc = std::fmax(acc, v);
+            }else if(pKind == kLp){
+                acc += std::pow(std::fabs(v), pP);
+            }else{
+                acc += v;
+            }
+        }
+    }
+    switch(pKind){
+    case kAverage:           return acc / count;
+    case kAverageIncludePad: return acc / (p.KH * p.KW);
+    case kLp:                return std::pow(acc, 1. / pP);
+    default:                 return acc;
+    }
+}
+
+void RunPool(Kind pKind, const Pool2D& p, int32_t pP = 0,
+             int32_t num_threads = 1){
+    // Prepare
+    int32_t OH = (p.H + 2 * p.PH - p.KH) / p.SH + 1;
+    int32_t OW = (p.W + 2 * p.PW - p.KW) / p.SW + 1;
+    int32_t x_dims[4]{p.N, p.C, p.H, p.W};
+    int32_t y_dims[4]{p.N, p.C, OH, OW};
+    int32_t kernel_shape[2]{p.KH, p.KW};
+    int32_t pads[4]{p.PH, p.PW, p.PH, p.PW};
+    int32_t strides[2]{p.SH, p.SW};
+    std::vector<float> X((int64_t)p.N * p.C * p.H * p.W);
+    std::vector<float> Y((int64_t)p.N * p.C * OH * OW);
+    for(float& x : X){
+        x = (float)(rand() % 2001 - 1000) / 1000.f;
+    }
+
+    // Run
+    void* context = ONNC_RUNTIME_init_runtime();
+    ONNC_RUNTIME_set_num_threads(context, num_threads);
+    switch(pKind){
+    case kAverage:
+    case kAverageIncludePad:
+        ONNC_RUNTIME_averagepool_float(context, X.data(), 4, x_dims,
+                                       Y.data(), 4, y_dims, "NOTSET",
+                                       pKind == kAverageIncludePad,
+                                       kernel_shape, 2, pads, 4, strides, 2);
+        break;
+    case kMax:
+        ONNC_RUNTIME_maxpool_float(context, X.data(), 4, x_dims,
+                                   Y.data(), 4, y_dims, NULL, 0, NULL,
+                                   "NOTSET", kernel_shape, 2, pads, 4, 0,
+                                   strides, 2);
+        break;
+    case kLp:
+        ONNC_RUNTIME_lppool_float(context, X.data(), 4, x_dims,
+                                  Y.data(), 4, y_dims, "NOTSET",
+                                  kernel_shape, 2, pP, pads, 4, strides, 2);
+        break;
+    }
+    ONNC_RUNTIME_shutdown_runtime(context);
+
+    // Check
+    for(int32_t nc = 0; nc < p.N * p.C; ++nc){
+        for(int32_t oh = 0; oh < OH; ++oh){
+            for(int32_t ow = 0; ow < OW; ++ow){
+                float expected = Reference(pKind, pP, p, X, nc, oh, ow);
+                float actual = Y[((int64_t)nc * OH + oh) * OW + ow];
+                ASSERT_TRUE(std::fabs(actual - expected) <= 1e-4f * (1.f + std::fabs(expected)));
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_MaxPool, padding){
+    // Padded elements must not win over negative inputs.
+    RunPool(kMax, Pool2D{2, 3, 7, 9, 3, 3, 1, 1, 1, 1});
+    RunPool(kMax, Pool2D{1, 4, 12, 11, 3, 2, 2, 2, 1, 0});
+    RunPool(kMax, Pool2D{1, 2, 8, 8, 2, 2, 2, 2, 0, 0});
+}
+
+SKYPAT_F(Operator_AveragePool, padding){
+    RunPool(kAverage, Pool2D{2, 3, 7, 9, 3, 3, 1, 1, 1, 1});
+    RunPool(kAverage, Pool2D{1, 4, 12, 11, 3, 5, 2, 3, 1, 2});
+    RunPool(kAverageIncludePad, Pool2D{2, 3, 7, 9, 3, 3, 1, 1, 1, 1});
+}
+
+SKYPAT_F(Operator_LpPool, exponents){
+    RunPool(kLp, Pool2D{1, 3, 7, 9, 3, 3, 1, 1, 1, 1}, 1);
+    RunPool(kLp, Pool2D{1, 3, 7, 9, 3, 3, 2, 2, 1, 1}, 2);
+    RunPool(kLp, Pool2D{1, 3, 7, 9, 2, 3, 1, 2, 0, 1}, 3);
+}
+
+SKYPAT_F(Operator_Pool, multi_thread){
+    RunPool(kMax, Pool2D{2, 32, 56, 56, 3, 3, 2, 2, 1, 1}, 0, 4);
+    RunPool(kAverage, Pool2D{2, 32, 56, 56, 3, 3, 1, 1, 1, 1}, 0, 4);
+}
+
+SKYPAT_F(Operator_GlobalAveragePool, channels){
+    // Prepare
+    int32_t x_dims[4]{2, 64, 17, 19};
+    int32_t y_dims[4]{2, 64, 1, 1};
+    int32_t plane = 17 * 19;
+    std::vector<float> X(2 * 64 * plane), Y(2 * 64), Z(2 * 64);
+    for(float& x : X){
+        x = (float)(rand() % 2001 - 1000) / 1000.f;
+    }
+
+    // Run
+    void* context = ONNC_RUNTIME_init_runtime();
+    ONNC_RUNTIME_set_num_threads(context, 4);
+    ONNC_RUNTIME_globalaveragepool_float(context, X.data(), 4, x_dims,
+                                         Y.data(), 4, y_dims);
+    ONNC_RUNTIME_globalmaxpool_float(context, X.data(), 4, x_dims,
+                                     Z.data(), 4, y_dims);
+    ONNC_RUNTIME_shutdown_runtime(context);
+
+    // Check
+    for(int32_t nc = 0; nc < 2 * 64; ++nc){
+        double sum = 0.;
+        float max = -FLT_MAX;
+        for(int32_t i = 0; i < plane; ++i){
+            sum += X[nc * plane + i];
+            max = std::fmax(max, X[nc * plane + i]);
+        }
+        EXPECT_TRUE(std::fabs(Y[nc] - sum / plane) <= 1e-5f);
+        EXPECT_EQ(Z[nc], max);
+    }
+}
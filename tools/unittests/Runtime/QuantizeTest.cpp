@@ -0,0 +1,137 @@
+#include <skypat/skypat.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/onnc-runtime.h>
+    #include <onnc/Runtime/operator/dequantize.h>
+    #include <onnc/Runtime/operator/int8conv.h>
+    #include <onnc/Runtime/operator/int8gemm.h>
+    #include <onnc/Runtime/operator/quantize.h>
+    #include <onnc/Runtime/internal/qgemm.h>
+}
+#undef restrict
+
+namespace {
+
+std::vector<int8_t> RandomInt8(size_t size){
+    std::vector<int8_t> values(size);
+    for(int8_t& v : values) v = static_cast<int8_t>(rand() % 256 - 128);
+    return values;
+}
+
+std::vector<float> RandomFloat(size_t size, float scale){
+    std::vector<float> values(size);
+    for(float& v : values) v = (rand() % 1000 / 1000.0 - 0.5) * scale;
+    return values;
+}
+
+// The requantization of ONNC_RUNTIME_internal_qgemm, on an exact sum.
+int8_t Requantize(int32_t sum, float scale, float bias, float output_scale,
+                  bool relu){
+    float value = static_cast<float>(sum) * scale + bias;
+    if(relu && value < 0.f) value = 0.f;
+    return ONNC_RUNTIME_internal_saturate_s8(value * (1.f / output_scale));
+}
+
+// Y[rows x N] = A[rows x K] * B[N x K]^T through ONNC_RUNTIME_int8gemm_float,
+// compared with the exact sums.
+void TestGemm(void* context, int32_t rows, int32_t N, int32_t K, bool relu){
+    std::vector<int8_t> A = RandomInt8(rows * K), B = RandomInt8(N * K);
+    std::vector<float> C = RandomFloat(N, 4.f), scales(N);
+    for(int32_t j = 0; j < N; ++j) scales[j] = 1e-4f * (1 + j % 7);
+    std::vector<int8_t> Y(rows * N);
+
+    int32_t A_dims[2]{rows, K}, B_dims[2]{N, K}, C_dims[1]{N}, Y_dims[2]{rows, N};
+    ONNC_RUNTIME_int8gemm_float(context, A.data(), 2, A_dims, B.data(), 2,
+                                B_dims, C.data(), 1, C_dims, Y.data(), 2,
+                                Y_dims, 0.05f, relu, scales.data(), N);
+
+    for(int32_t i = 0; i < rows; ++i)
+    for(int32_t j = 0; j < N; ++j){
+        int32_t sum = 0;
+        for(int32_t k = 0; k < K; ++k) sum += A[i * K + k] * B[j * K + k];
+        EXPECT_EQ(Y[i * N + j], Requantize(sum, scales[j], C[j], 0.05f, relu));
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_Quantize, round_trip){
+    std::vector<float> X{0.f, 0.25f, 0.75f, -0.25f, -0.75f, 1.f, 100.f, -100.f};
+    std::vector<int8_t> Y(X.size());
+    std::vector<float> Z(X.size());
+    int32_t dims[1]{static_cast<int32_t>(X.size())};
+
+    // Halves round to the nearest even integer; overflow saturates.
+    ONNC_RUNTIME_quantize_float(NULL, X.data(), 1, dims, Y.data(), 1, dims,
+                                0.5f);
+    const int8_t expected[]{0, 0, 2, 0, -2, 2, 127, -128};
+    for(size_t i = 0; i < X.size(); ++i) EXPECT_EQ(Y[i], expected[i]);
+
+    ONNC_RUNTIME_dequantize_float(NULL, Y.data(), 1, dims, Z.data(), 1, dims,
+                                  0.5f);
+    for(size_t i = 0; i < X.size(); ++i) EXPECT_EQ(Z[i], expected[i] * 0.5f);
+}
+
+SKYPAT_F(Operator_Int8Gemm, tails){
+    // Neither K nor N nor the rows fill a block.
+    TestGemm(NULL, 1, 1, 1, false);
+    TestGemm(NULL, 7, 35, 70, false);
+    TestGemm(NULL, 150, 17, 33, true);
+}
+
+SKYPAT_F(Operator_Int8Gemm, threads){
+    void* context = ONNC_RUNTIME_init_runtime();
+    ONNC_RUNTIME_set_num_threads(context, 4);
+    // Few rows split the columns, many rows split the rows.
+    TestGemm(context, 3, 300, 1100, false);
+    TestGemm(context, 700, 40, 100, true);
+    ONNC_RUNTIME_shutdown_runtime(context);
+}
+
+SKYPAT_F(Operator_Int8Conv, groups_pads_strides){
+    const int32_t N = 2, C = 6, H = 9, W = 7, M = 4, group = 2;
+    const int32_t kH = 3, kW = 2, sH = 2, sW = 1, dH = 1, dW = 2;
+    const int32_t pT = 1, pL = 2, pB = 1, pR = 0;
+    const int32_t kC = C / group, Mg = M / group;
+    const int32_t oH = (H + pT + pB - ((kH - 1) * dH + 1)) / sH + 1;
+    const int32_t oW = (W + pL + pR - ((kW - 1) * dW + 1)) / sW + 1;
+
+    std::vector<int8_t> X = RandomInt8(N * C * H * W);
+    std::vector<int8_t> Wt = RandomInt8(M * kC * kH * kW);
+    std::vector<float> B = RandomFloat(M, 2.f), scales(M);
+    for(int32_t m = 0; m < M; ++m) scales[m] = 1e-3f * (m + 1);
+    std::vector<int8_t> Y(N * M * oH * oW);
+
+    int32_t X_dims[4]{N, C, H, W}, W_dims[4]{M, kC, kH, kW};
+    int32_t B_dims[1]{M}, Y_dims[4]{N, M, oH, oW};
+    int32_t dilations[2]{dH, dW}, kernel_shape[2]{kH, kW};
+    int32_t pads[4]{pT, pL, pB, pR}, strides[2]{sH, sW};
+    ONNC_RUNTIME_int8conv_float(NULL, X.data(), 4, X_dims, Wt.data(), 4,
+                                W_dims, B.data(), 1, B_dims, Y.data(), 4,
+                                Y_dims, dilations, 2, group, kernel_shape, 2,
+                                0.1f, pads, 4, 1, scales.data(), M,
+                                strides, 2);
+
+    for(int32_t n = 0; n < N; ++n)
+    for(int32_t m = 0; m < M; ++m)
+    for(int32_t oh = 0; oh < oH; ++oh)
+    for(int32_t ow = 0; ow < oW; ++ow){
+        int32_t sum = 0;
+        for(int32_t c = 0; c < kC; ++c)
+        for(int32_t kh = 0; kh < kH; ++kh)
+        for(int32_t kw = 0; kw < kW; ++kw){
+            int32_t ih = oh * sH - pT + kh * dH;
+            int32_t iw = ow * sW - pL + kw * dW;
+            if(ih < 0 || ih >= H || iw < 0 || iw >= W) continue;
+            int32_t x_c = (m / Mg) * kC + c;
+            sum += X[((n * C + x_c) * H + ih) * W + iw] *
+                   Wt[((m * kC + c) * kH + kh) * kW + kw];
+        }
+        EXPECT_EQ(Y[((n * M + m) * oH + oh) * oW + ow],
+                  Requantize(sum, scales[m], B[m], 0.1f, true));
+    }
+}
@@ -0,0 +1,123 @@
+#include <skypat/skypat.h>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/operator/rnn.h>
+}
+#undef restrict
+
+namespace {
+
+float Random(){
+    return rand() % 1000 / 1000.0 - 0.5;
+}
+
+// Straightforward per-timestep RNN with the default Tanh activation. Steps
+// past lens[b] are left zero in Y.
+void ReferenceRNN(int32_t seq, int32_t batch, int32_t input, int32_t H,
+                  bool reverse, const std::vector<int32_t>& lens,
+                  const std::vector<float>& X, const std::vector<float>& W,
+                  const std::vector<float>& R, const std::vector<float>& B,
+                  const std::vector<float>& initial_h,
+                  std::vector<float>& Y, std::vector<float>& Y_h){
+    for(int32_t b = 0; b < batch; ++b){
+        std::vector<float> h(&initial_h[b * H], &initial_h[(b + 1) * H]);
+        std::vector<float> next(H);
+        for(int32_t s = 0; s < lens[b]; ++s){
+            int32_t t = reverse ? lens[b] - 1 - s : s;
+            for(int32_t j = 0; j < H; ++j){
+                float sum = B[j] + B[H + j];
+                for(int32_t k = 0; k < input; ++k){
+                    sum += X[(t * batch + b) * input + k] * W[j * input + k];
+                }
+                for(int32_t k = 0; k < H; ++k){
+                    sum += h[k] * R[j * H + k];
+                }
+                next[j] = std::tanh(sum);
+            }
+            h = next;
+            for(int32_t j = 0; j < H; ++j){
+                Y[(t * batch + b) * H + j] = h[j];
+            }
+        }
+        for(int32_t j = 0; j < H; ++j){
+            Y_h[b * H + j] = h[j];
+        }
+    }
+}
+
+// seq_lens is handed to the kernel as is; lens is what the kernel is
+// expected to use after clamping it to [0, seq].
+void RunRNN(const char* direction, const std::vector<int32_t>& seq_lens,
+            const std::vector<int32_t>& lens){
+    srand(time(NULL));
+    const int32_t seq = 6, batch = 4, input = 7, H = 11;
+    const bool reverse = std::string(direction) == "reverse";
+    std::vector<float> X(seq * batch * input), W(H * input), R(H * H),
+        B(2 * H), initial_h(batch * H);
+    for(float& v : X) v = Random();
+    for(float& v : W) v = Random();
+    for(float& v : R) v = Random();
+    for(float& v : B) v = Random();
+    for(float& v : initial_h) v = Random();
+
+    // Poison Y so that missing zero padding shows up.
+    std::vector<float> Y(seq * batch * H, 1000.f), Y_h(batch * H);
+    std::vector<float> Ans(Y.size(), 0.f), Ans_h(Y_h.size());
+    ReferenceRNN(seq, batch, input, H, reverse, lens,
+                 X, W, R, B, initial_h, Ans, Ans_h);
+
+    int32_t X_dims[3]{seq, batch, input};
+    int32_t W_dims[3]{1, H, input};
+    int32_t R_dims[3]{1, H, H};
+    int32_t B_dims[2]{1, 2 * H};
+    int32_t lens_dims[1]{batch};
+    int32_t h_dims[3]{1, batch, H};
+    int32_t Y_dims[4]{seq, 1, batch, H};
+    // Run
+    ONNC_RUNTIME_rnn_float(NULL
+        ,X.data(), 3, X_dims
+        ,W.data(), 3, W_dims
+        ,R.data(), 3, R_dims
+        ,B.data(), 2, B_dims
+        ,seq_lens.empty() ? NULL
+                          : reinterpret_cast<const float*>(seq_lens.data())
+        ,seq_lens.empty() ? 0 : 1, seq_lens.empty() ? NULL : lens_dims
+        ,initial_h.data(), 3, h_dims
+        ,Y.data(), 4, Y_dims
+        ,Y_h.data(), 3, h_dims
+        ,NULL, 0, NULL, 0, NULL, 0
+        ,0.f, direction, H
+    );
+    // Check
+    for(size_t i = 0; i < Y.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y[i] - Ans[i]) <= 1e-4);
+    }
+    for(size_t i = 0; i < Y_h.size(); ++i){
+        EXPECT_TRUE(std::fabs(Y_h[i] - Ans_h[i]) <= 1e-4);
+    }
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_RNN, forward){
+    RunRNN("forward", {}, {6, 6, 6, 6});
+}
+
+SKYPAT_F(Operator_RNN, reverse){
+    RunRNN("reverse", {}, {6, 6, 6, 6});
+}
+
+SKYPAT_F(Operator_RNN, forward_sequence_lens){
+    RunRNN("forward", {6, 3, 0, 1}, {6, 3, 0, 1});
+}
+
+// Out-of-range lengths are clamped to [0, seq_length].
+SKYPAT_F(Operator_RNN, reverse_sequence_lens){
+    RunRNN("reverse", {2, 100, -5, 6}, {2, 6, 0, 6});
+}
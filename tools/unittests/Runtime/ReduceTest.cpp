@@ -0,0 +1,153 @@
+#include <skypat/skypat.h>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#define restrict __restrict__
+extern "C"{
+    #include <onnc/Runtime/onnc-runtime.h>
+    #include <onnc/Runtime/operator/reducel2.h>
+    #include <onnc/Runtime/operator/reducelogsumexp.h>
+    #include <onnc/Runtime/operator/reducemax.h>
+    #include <onnc/Runtime/operator/reducemean.h>
+    #include <onnc/Runtime/operator/reducesum.h>
+}
+#undef restrict
+
+namespace {
+
+typedef void (*ReduceFn)(void*, const float*, int32_t, const int32_t*,
+                         float*, int32_t, const int32_t*,
+                         int32_t*, int32_t, int32_t);
+
+typedef std::function<double(const std::vector<float>&)> Reference;
+
+// Run pFn over pAxes of an input of shape pDims and compare every output
+// with pRef of the elements it reduces.
+void RunReduce(ReduceFn pFn, const Reference& pRef,
+               std::vector<int32_t> pDims, std::vector<int32_t> pAxes,
+               int32_t num_threads = 1){
+    // Prepare
+    int32_t ndim = pDims.size();
+    std::vector<bool> reduced(ndim, pAxes.empty());
+    for(int32_t axis : pAxes){
+        reduced[axis < 0 ? axis + ndim : axis] = true;
+    }
+    std::vector<int32_t> out_dims(ndim);
+    int64_t size = 1, out_size = 1;
+    for(int32_t i = 0; i < ndim; ++i){
+        out_dims[i] = reduced[i] ? 1 : pDims[i];
+        size *= pDims[i];
+        out_size *= out_dims[i];
+    }
+    std::vector<float> X(size), Y(out_size);
+    for(float& x : X){
+        x = (float)(rand() % 2001 - 1000) / 1000.f;
+    }
+
+    // Run
+    void* context = ONNC_RUNTIME_init_runtime();
+    ONNC_RUNTIME_set_num_threads(context, num_threads);
+    pFn(context, X.data(), ndim, pDims.data(), Y.data(), ndim, out_dims.data(),
+        pAxes.data(), pAxes.size(), 1);
+    ONNC_RUNTIME_shutdown_runtime(context);
+
+    // Check
+    std::vector<std::vector<float> > groups(out_size);
+    for(int64_t i = 0; i < size; ++i){
+        int64_t rest = i, out = 0, step = 1;
+        for(int32_t d = ndim - 1; d >= 0; --d){
+            int64_t index = rest % pDims[d];
+            rest /= pDims[d];
+            if(!reduced[d]){
+                out += index * step;
+                step *= pDims[d];
+            }
+        }
+        groups[out].push_back(X[i]);
+    }
+    for(int64_t i = 0; i < out_size; ++i){
+        double expected = pRef(groups[i]);
+        ASSERT_TRUE(std::fabs(Y[i] - expected) <= 1e-4 * (1. + std::fabs(expected)));
+    }
+}
+
+double Sum(const std::vector<float>& pValues){
+    double sum = 0.;
+    for(float v : pValues) sum += v;
+    return sum;
+}
+
+double Mean(const std::vector<float>& pValues){
+    return Sum(pValues) / pValues.size();
+}
+
+double Max(const std::vector<float>& pValues){
+    double max = pValues[0];
+    for(float v : pValues) max = std::fmax(max, v);
+    return max;
+}
+
+double L2(const std::vector<float>& pValues){
+    double sum = 0.;
+    for(float v : pValues) sum += (double)v * v;
+    return std::sqrt(sum);
+}
+
+double LogSumExp(const std::vector<float>& pValues){
+    double sum = 0.;
+    for(float v : pValues) sum += std::exp(v);
+    return std::log(sum);
+}
+
+} // anonymous namespace
+
+SKYPAT_F(Operator_ReduceSum, axes){
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {2, 3, 4, 5}, {1, 3});
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {2, 3, 4, 5}, {0, 2});
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {2, 3, 4, 5}, {-1});
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {2, 3, 4, 5}, {0});
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {2, 1, 4, 5}, {1, 2});
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {7, 37}, {1});
+}
+
+SKYPAT_F(Operator_ReduceSum, all_axes){
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {3, 4, 5}, {});
+}
+
+SKYPAT_F(Operator_ReduceSum, multi_thread){
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {4, 32, 33, 31}, {2, 3}, 4);
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {16, 3000, 3}, {0}, 4);
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, {8, 64, 300}, {1}, 4);
+}
+
+SKYPAT_F(Operator_ReduceSum, many_axes){
+    // Axes past the 32nd, and kept and reduced axes alternating.
+    std::vector<int32_t> dims(40, 1);
+    for(int32_t i = 0; i < 8; ++i){
+        dims[i] = dims[32 + i] = 2;
+    }
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, dims,
+              {1, 3, 5, 7, 20, 33, 35, 37, 39});
+    RunReduce(ONNC_RUNTIME_reducesum_float, Sum, dims, {0, 2, 34, -1}, 4);
+}
+
+SKYPAT_F(Operator_ReduceMax, negative_values){
+    RunReduce(ONNC_RUNTIME_reducemax_float, Max, {2, 3, 4, 5}, {1, 3});
+    RunReduce(ONNC_RUNTIME_reducemax_float, Max, {2, 3, 4, 5}, {-1});
+    RunReduce(ONNC_RUNTIME_reducemax_float, Max, {4, 32, 33, 31}, {0, 1}, 4);
+}
+
+SKYPAT_F(Operator_ReduceMean, axes){
+    RunReduce(ONNC_RUNTIME_reducemean_float, Mean, {2, 3, 4, 5}, {1, 2});
+    RunReduce(ONNC_RUNTIME_reducemean_float, Mean, {4, 32, 33, 31}, {2, 3}, 4);
+}
+
+SKYPAT_F(Operator_ReduceL2, axes){
+    RunReduce(ONNC_RUNTIME_reducel2_float, L2, {2, 3, 4, 5}, {0, 3});
+}
+
+SKYPAT_F(Operator_ReduceLogSumExp, axes){
+    RunReduce(ONNC_RUNTIME_reducelogsumexp_float, LogSumExp, {2, 3, 4, 5}, {2});
+}
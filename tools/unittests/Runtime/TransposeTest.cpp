@@ -2,13 +2,67 @@
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
+#include <vector>
 
 #define restrict __restrict__
 extern "C"{
+    #include <onnc/Runtime/onnc-runtime.h>
     #include <onnc/Runtime/operator/transpose.h>
 }
 #undef restrict
 
+namespace {
+
+// Transpose a tensor of shape pDims by pPerm (reversed if empty), and
+// compare with numpy.transpose.
+void RunTranspose(std::vector<int32_t> pDims, std::vector<int32_t> pPerm,
+                  int32_t num_threads = 1){
+    // Prepare
+    int32_t ndim = pDims.size();
+    std::vector<int32_t> perm(pPerm);
+    if(perm.empty()){
+        for(int32_t i = ndim - 1; i >= 0; --i) perm.push_back(i);
+    }
+    std::vector<int32_t> out_dims(ndim);
+    std::vector<int64_t> strides(ndim);
+    int64_t size = 1;
+    for(int32_t i = ndim - 1; i >= 0; --i){
+        strides[i] = size;
+        size *= pDims[i];
+    }
+    for(int32_t i = 0; i < ndim; ++i){
+        out_dims[i] = pDims[perm[i]];
+    }
+    std::vector<float> A(size), B(size);
+    for(int64_t i = 0; i < size; ++i){
+        A[i] = (float)i;
+    }
+
+    // Run
+    void* context = ONNC_RUNTIME_init_runtime();
+    ONNC_RUNTIME_set_num_threads(context, num_threads);
+    ONNC_RUNTIME_transpose_float(context
+        ,A.data()
+        ,ndim,pDims.data()
+        ,B.data()
+        ,ndim,out_dims.data()
+        ,pPerm.data(), pPerm.size()
+    );
+    ONNC_RUNTIME_shutdown_runtime(context);
+
+    // Check
+    for(int64_t i = 0; i < size; ++i){
+        int64_t rest = i, offset = 0;
+        for(int32_t j = ndim - 1; j >= 0; --j){
+            offset += (rest % out_dims[j]) * strides[perm[j]];
+            rest /= out_dims[j];
+        }
+        ASSERT_EQ(B[i], A[offset]);
+    }
+}
+
+} // anonymous namespace
+
 SKYPAT_F(Operator_Transpose, non_broadcast){
     // Prepare
     srand(time(NULL));
@@ -28,17 +82,17 @@ SKYPAT_F(Operator_Transpose, non_broadcast){
     };
     float B[27];
     float Ans[27]{
-        000.0, 100.0, 200.0,
-        001.0, 101.0, 201.0,
-        002.0, 102.0, 202.0,
+        000.0, 010.0, 020.0,
+        100.0, 110.0, 120.0,
+        200.0, 210.0, 220.0,
 
-        010.0, 110.0, 210.0,
-        011.0, 111.0, 211.0,
-        012.0, 112.0, 212.0,
+        001.0, 011.0, 021.0,
+        101.0, 111.0, 121.0,
+        201.0, 211.0, 221.0,
 
-        020.0, 120.0, 220.0,
-        021.0, 121.0, 221.0,
-        022.0, 122.0, 222.0
+        002.0, 012.0, 022.0,
+        102.0, 112.0, 122.0,
+        202.0, 212.0, 222.0
     };
     int32_t perm[3]{2, 0, 1};
     // Run
@@ -54,3 +108,23 @@ SKYPAT_F(Operator_Transpose, non_broadcast){
         EXPECT_EQ(B[i], Ans[i]);
     }
 }
+
+SKYPAT_F(Operator_Transpose, permutations){
+    // NCHW -> NHWC and back
+    RunTranspose({2, 19, 13, 11}, {0, 2, 3, 1});
+    RunTranspose({2, 13, 11, 19}, {0, 3, 1, 2});
+    // Last two axes, as in attention
+    RunTranspose({2, 3, 37, 20}, {0, 1, 3, 2});
+    RunTranspose({2, 37, 3, 20}, {0, 2, 1, 3});
+    // Identity, default and arbitrary ones
+    RunTranspose({4, 5, 6}, {0, 1, 2});
+    RunTranspose({4, 5, 6}, {});
+    RunTranspose({3, 1, 7, 2, 5}, {4, 2, 0, 3, 1});
+    RunTranspose({9, 70}, {1, 0});
+}
+
+SKYPAT_F(Operator_Transpose, multi_thread){
+    RunTranspose({1, 64, 56, 56}, {0, 2, 3, 1}, 4);
+    RunTranspose({4, 12, 128, 64}, {0, 2, 1, 3}, 4);
+    RunTranspose({300, 500}, {1, 0}, 4);
+}
@@ -0,0 +1,152 @@
+//===- SophonLinearScanAllocTest.cpp --------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/ADT/StringList.h>
+#include <onnc/CodeGen/LiveIntervals.h>
+#include <onnc/CodeGen/LiveIntervalsData.h>
+#include <onnc/CodeGen/SlotIndexes.h>
+#include <onnc/Core/AnalysisResolver.h>
+#include <onnc/Core/PassManager.h>
+#include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/Reshape.h>
+#include <skypat/skypat.h>
+#include <unordered_set>
+#include "../../lib/Target/Sophon/LinearScanAllocPass.h"
+
+using namespace onnc;
+
+namespace {
+
+Tensor* CreateFloatTensor(ComputeGraph& pCG, const StringRef& pName,
+                          const Tensor::Dimensions& pDims)
+{
+  Tensor* t = pCG.addValue<FloatTensor>(pName);
+  t->setDimensions(pDims);
+  return t;
+}
+
+template<typename OpTy>
+OpTy* CreateOperator(ComputeGraph& pCG, const StringList& pInputNames)
+{
+  OpTy* op = pCG.addOperator<OpTy>();
+  for (auto& iname : pInputNames)
+    op->addInput(*pCG.getValue<Tensor>(iname));
+  return op;
+}
+
+/// in -> Relu -> r1 -> Reshape -> r2 -> Relu -> r3 -> Relu -> r4 -> Relu -> r5
+///
+/// Reshape is a no-op, so r1 and r2 share a memory operand which lives until
+/// r2 is read.
+ComputeGraph& CreateChain(Module& pModule)
+{
+  IRBuilder builder(pModule);
+  ComputeGraph& cg = *builder.CreateComputeGraph("chain");
+
+  cg.addOperator<InputOperator>()->setTensor(*CreateFloatTensor(cg, "in", {4}));
+  Initializer* shape = cg.addOperator<Initializer>();
+  Tensor* shapeValue = cg.addValue<Int64Tensor>("shape");
+  shapeValue->setDimensions({1});
+  shape->setTensor(*shapeValue);
+
+  CreateOperator<Relu>(cg, {"in"})
+    ->addOutput(*CreateFloatTensor(cg, "r1", {16}));
+  CreateOperator<Reshape>(cg, {"r1", "shape"})
+    ->addOutput(*CreateFloatTensor(cg, "r2", {16}));
+  CreateOperator<Relu>(cg, {"r2"})
+    ->addOutput(*CreateFloatTensor(cg, "r3", {16}));
+  CreateOperator<Relu>(cg, {"r3"})
+    ->addOutput(*CreateFloatTensor(cg, "r4", {16}));
+  CreateOperator<Relu>(cg, {"r4"})
+    ->addOutput(*CreateFloatTensor(cg, "r5", {16}));
+  CreateOperator<OutputOperator>(cg, {"r5"});
+  return cg;
+}
+
+} // anonymous namespace
+
+SKYPAT_F(SophonLinearScanAllocTest, reuse_dead_neurons)
+{
+  Module module;
+  ComputeGraph& cg = CreateChain(module);
+
+  PassManager passMgr;
+  AnalysisResolver resolver(passMgr);
+  BuildSlotIndexes buildSlotIdx;
+  LiveIntervalsData liData;
+  LiveIntervals liveIntrvls;
+  resolver.add(buildSlotIdx.getPassID(), buildSlotIdx);
+  resolver.add(liData.getPassID(), liData);
+  liData.setResolver(resolver);
+  liveIntrvls.setResolver(resolver);
+  liData.doInitialization(module);
+  buildSlotIdx.runOnModule(module);
+  liveIntrvls.runOnModule(module);
+
+  BuildMemOpnd buildMemOpnd;
+  buildMemOpnd.runOnModule(module);
+  const BuildMemOpnd::ValMemOpndMap& memOpnds =
+    buildMemOpnd.getMemOperandList();
+
+  // Collect the neurons in order of execution, as LinearScanAlloc does.
+  std::vector<ComputeMemOperand*> neurons;
+  std::unordered_set<ComputeMemOperand*> seen;
+  auto collect = [&](Value* pValue) {
+    ComputeMemOperand* memOp = memOpnds.find(pValue)->second;
+    if (ComputeOperand::kWeightResidence == memOp->residence() ||
+        !seen.insert(memOp).second)
+      return;
+    Tensor* tensor = static_cast<Tensor*>(pValue);
+    int64_t length = 4;
+    for (unsigned i = 0; i < tensor->getNumOfDimensions(); ++i)
+      length *= tensor->dimension(i);
+    memOp->setLength(length);
+    neurons.push_back(memOp);
+  };
+  for (ComputeGraph::iterator it = cg.begin(); it != cg.end(); ++it) {
+    ComputeOperator* op = it;
+    if (isa<InputOperator>(op) || isa<OutputOperator>(op) ||
+        isa<Initializer>(op))
+      continue;
+    for (unsigned i = 0; i < op->getNumOfInputs(); ++i)
+      collect(op->getInput(i));
+    for (unsigned i = 0; i < op->getNumOfOutputs(); ++i)
+      collect(op->getOutput(i));
+  }
+  ASSERT_EQ(neurons.size(), 5);
+
+  unsigned int size = AllocNeurons(neurons, memOpnds, liData);
+
+  auto memOf = [&](const char* pName) {
+    return memOpnds.find(cg.getValue(pName))->second;
+  };
+  ASSERT_TRUE(memOf("r1") == memOf("r2"));
+
+  // Values which are live at the same time never share memory, including r3
+  // and the operand r1 shares with r2 across the Reshape.
+  const char* names[] = { "in", "r1", "r2", "r3", "r4", "r5" };
+  for (const char* u : names) {
+    for (const char* v : names) {
+      const ComputeMemOperand* a = memOf(u);
+      const ComputeMemOperand* b = memOf(v);
+      if (a == b ||
+          !liData.getInterval(cg.getValue(u))->overlap(
+            *liData.getInterval(cg.getValue(v))))
+        continue;
+      EXPECT_TRUE(a->start() + a->length() <= b->start() ||
+                  b->start() + b->length() <= a->start());
+    }
+  }
+
+  // r4 is written after `in` is dead, and takes its place.
+  EXPECT_EQ(memOf("r4")->start(), memOf("in")->start());
+  EXPECT_TRUE(size < 16 + 4 * 64);
+}
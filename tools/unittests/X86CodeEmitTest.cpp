@@ -0,0 +1,428 @@
+//===- X86CodeEmitTest.cpp ------------------------------------------------===//
+//
+//                             The ONNC Project
+//
+// See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include <onnc/ADT/StringList.h>
+#include <onnc/Core/PassManager.h>
+#include <onnc/IR/IRBuilder.h>
+#include <onnc/IR/Compute/Constant.h>
+#include <onnc/IR/Compute/Conv.h>
+#include <onnc/IR/Compute/ConvNCHWc.h>
+#include <onnc/IR/Compute/Gemm.h>
+#include <onnc/IR/Compute/Initializer.h>
+#include <onnc/IR/Compute/InputOperator.h>
+#include <onnc/IR/Compute/OutputOperator.h>
+#include <onnc/IR/Compute/Relu.h>
+#include <onnc/IR/Compute/WinogradConv.h>
+#include <onnc/Interpreter/Interpreter.h>
+#include <onnc/Support/Casting.h>
+#include <onnc/Support/Path.h>
+#include <onnc/Target/TargetOptions.h>
+#include <skypat/skypat.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../lib/Target/X86/X86AssignLayout.h"
+#include "../../lib/Target/X86/X86Backend.h"
+#include "../../lib/Target/X86/X86CodeEmit.h"
+#include "../../lib/Target/X86/X86SelectConvAlgorithm.h"
+#include "../../lib/Target/X86/X86WidenWeights.h"
+
+#define restrict __restrict__
+extern "C" {
+#include <onnc/Runtime/onnc-runtime.h>
+#include <onnc/Runtime/internal/half.h>
+}
+#undef restrict
+
+using namespace onnc;
+
+//===----------------------------------------------------------------------===//
+// Create Compute Graph Helper
+//===----------------------------------------------------------------------===//
+static FloatTensor*
+CreateFloatComputeTensor(ComputeGraph& pCG, const StringRef& pName,
+                         const Tensor::Dimensions& pDims)
+{
+  FloatTensor* t = pCG.addValue<FloatTensor>(pName);
+  t->setDimensions(pDims);
+  return t;
+}
+
+/// A weight of sequential values, scaled so that results stay small.
+static void
+CreateFloatWeightOperator(ComputeGraph& pCG, const std::string& pName,
+                          const Tensor::Dimensions& pDims, float pScale)
+{
+  Initializer* init = pCG.addOperator<Initializer>(pName);
+  FloatTensor* value = CreateFloatComputeTensor(pCG, pName, pDims);
+  size_t size = 1;
+  for (int64_t dim : pDims)
+    size *= dim;
+  for (size_t i = 0; i < size; ++i)
+    value->getValues().push_back(pScale * (static_cast<int>(i % 7) - 3));
+  init->setTensor(*value);
+}
+
+template<typename OpTy, typename ... NodeCtorParams>
+static OpTy* CreateComputeOperator(ComputeGraph& pCG,
+                                   const StringList& pInputNames,
+                                   NodeCtorParams&& ... pParams)
+{
+  OpTy* op = pCG.addOperator<OpTy>(pParams...);
+  for (auto& iname : pInputNames)
+    op->addInput(*pCG.getValue<Tensor>(iname));
+  return op;
+}
+
+static size_t GetNumOfElements(const Tensor& pTensor)
+{
+  size_t size = 1;
+  for (int64_t dim : pTensor.getDimensions())
+    size *= dim;
+  return size;
+}
+
+static std::string Quote(const std::string& pArg)
+{
+  return "'" + pArg + "'";
+}
+
+//===----------------------------------------------------------------------===//
+// Create Model
+//===----------------------------------------------------------------------===//
+/// r = Relu(Conv(x, w, b)) and z = Gemm(a, g, c): two inputs, two outputs,
+/// and values living in the arena.
+static ComputeGraph& CreateTinyModel(Module& pM)
+{
+  IRBuilder builder(pM);
+  ComputeGraph& cg = *builder.CreateComputeGraph("Tiny");
+
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {1, 2, 5, 5}));
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "a", {2, 3}));
+  CreateFloatWeightOperator(cg, "w", {3, 2, 3, 3}, 0.125);
+  CreateFloatWeightOperator(cg, "b", {3}, 0.5);
+  CreateFloatWeightOperator(cg, "g", {3, 4}, 0.25);
+  CreateFloatWeightOperator(cg, "c", {4}, 1);
+
+  Conv* conv = CreateComputeOperator<Conv>(cg, {"x", "w", "b"});
+  conv->setDilations(IntsAttr(2, 1));
+  conv->setKernelShape(IntsAttr(2, 3));
+  conv->setPads(IntsAttr(4, 1));
+  conv->setStrides(IntsAttr(2, 1));
+  conv->addOutput(*CreateFloatComputeTensor(cg, "y", {1, 3, 5, 5}));
+  CreateComputeOperator<Relu>(cg, {"y"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "r", {1, 3, 5, 5}));
+  CreateComputeOperator<Gemm>(cg, {"a", "g", "c"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "z", {2, 4}));
+  CreateComputeOperator<OutputOperator>(cg, {"r", "z"});
+  return cg;
+}
+
+/// r = Relu(Conv3x3(Conv1x1(x, w1), w3)): a 1x1 convolution, which only the
+/// blocked layout runs, and a wide 3x3 one, which Winograd runs faster.
+static ComputeGraph& CreateConvChain(Module& pM)
+{
+  IRBuilder builder(pM);
+  ComputeGraph& cg = *builder.CreateComputeGraph("ConvChain");
+
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {1, 64, 28, 28}));
+  CreateFloatWeightOperator(cg, "w1", {64, 64, 1, 1}, 1.f / 64);
+  CreateFloatWeightOperator(cg, "w3", {64, 64, 3, 3}, 1.f / 512);
+
+  Conv* pointwise = CreateComputeOperator<Conv>(cg, {"x", "w1"});
+  pointwise->setKernelShape(IntsAttr(2, 1));
+  pointwise->addOutput(*CreateFloatComputeTensor(cg, "y1", {1, 64, 28, 28}));
+  Conv* conv = CreateComputeOperator<Conv>(cg, {"y1", "w3"});
+  conv->setKernelShape(IntsAttr(2, 3));
+  conv->setPads(IntsAttr(4, 1));
+  conv->addOutput(*CreateFloatComputeTensor(cg, "y3", {1, 64, 28, 28}));
+  CreateComputeOperator<Relu>(cg, {"y3"})
+    ->addOutput(*CreateFloatComputeTensor(cg, "r", {1, 64, 28, 28}));
+  CreateComputeOperator<OutputOperator>(cg, {"r"});
+  return cg;
+}
+
+/// y = Conv(x, w, b) with float16 weights, or float ones if pFloat.
+static ComputeGraph& CreateHalfConv(Module& pM, bool pFloat)
+{
+  IRBuilder builder(pM);
+  ComputeGraph& cg = *builder.CreateComputeGraph("HalfConv");
+
+  cg.addOperator<InputOperator>()->setTensor(
+    *CreateFloatComputeTensor(cg, "x", {1, 2, 5, 5}));
+  CreateFloatWeightOperator(cg, "w", {3, 2, 3, 3}, 0.125);
+  CreateFloatWeightOperator(cg, "b", {3}, 0.5);
+  if (!pFloat) {
+    // The values are exact in float16.
+    for (const char* name : { "w", "b" }) {
+      FloatTensor* weight = cg.getValue<FloatTensor>(name);
+      Initializer* init = static_cast<Initializer*>(weight->getDefine());
+      Float16Tensor* half = cg.addValue<Float16Tensor>(std::string(name) + "h");
+      half->setDimensions(weight->getDimensions());
+      for (float value : weight->getValues())
+        half->getValues().push_back(
+            ONNC_RUNTIME_internal_float_to_half(value));
+      init->replaceOutput(0, *half);
+      cg.erase(*weight);
+    }
+  }
+
+  Conv* conv = CreateComputeOperator<Conv>(
+      cg, {"x", pFloat ? "w" : "wh", pFloat ? "b" : "bh"});
+  conv->setKernelShape(IntsAttr(2, 3));
+  conv->setPads(IntsAttr(4, 1));
+  conv->addOutput(*CreateFloatComputeTensor(cg, "y", {1, 3, 5, 5}));
+  CreateComputeOperator<OutputOperator>(cg, {"y"});
+  return cg;
+}
+
+/// Run pCG with the interpreter on pInput.
+/// @return The values of the graph output pOutput.
+static std::vector<float> Interpret(ComputeGraph& pCG,
+                                    std::vector<float>& pInput,
+                                    const std::string& pOutput)
+{
+  std::vector<std::vector<float> > buffers;
+  Interpreter interpreter;
+  for (ComputeOperator& op : pCG) {
+    for (unsigned int i = 0; i < op.getNumOfOutputs(); ++i) {
+      Value* v = op.getOutput(i);
+      if (isa<Initializer>(&op) && Value::kFloat16 == v->kind()) {
+        Float16Tensor* weight = static_cast<Float16Tensor*>(v);
+        interpreter.m_ATable[v] = const_cast<uint16_t*>(weight->data());
+        continue;
+      }
+      if (isa<Initializer>(&op)) {
+        FloatTensor* weight = static_cast<FloatTensor*>(v);
+        interpreter.m_ATable[v] = const_cast<float*>(weight->data());
+        continue;
+      }
+      buffers.emplace_back(GetNumOfElements(*static_cast<Tensor*>(v)));
+      interpreter.m_ATable[v] = buffers.back().data();
+    }
+  }
+  interpreter.m_ATable[pCG.getValue("x")] = pInput.data();
+  for (ComputeOperator& op : pCG)
+    op.accept(interpreter);
+  void* context = ONNC_RUNTIME_init_runtime();
+  interpreter.m_Plan.run(context);
+  ONNC_RUNTIME_shutdown_runtime(context);
+
+  const float* output = static_cast<const float*>(
+      interpreter.m_ATable[pCG.getValue(pOutput)]);
+  return std::vector<float>(
+      output, output + GetNumOfElements(*pCG.getValue<Tensor>(pOutput)));
+}
+
+//===----------------------------------------------------------------------===//
+// X86CodeEmitTest
+//===----------------------------------------------------------------------===//
+SKYPAT_F(X86CodeEmitTest, blocked_layout_leaves_winograd_convolutions)
+{
+  Module module, reference;
+  ComputeGraph& cg = CreateConvChain(module);
+  ComputeGraph& expected = CreateConvChain(reference);
+
+  // The passes in the order of X86Backend::addTensorSel.
+  X86AssignLayout layout(8);
+  X86SelectConvAlgorithm algorithm;
+  layout.runOnModule(module);
+  algorithm.runOnModule(module);
+
+  // The 1x1 convolution runs in NCHWc and the 3x3 one by Winograd.
+  unsigned int numOfBlocked = 0, numOfWinograd = 0;
+  for (ComputeOperator& op : cg) {
+    ASSERT_FALSE(isa<Conv>(&op));
+    numOfBlocked += isa<ConvNCHWc>(&op) ? 1 : 0;
+    numOfWinograd += isa<WinogradConv>(&op) ? 1 : 0;
+  }
+  ASSERT_EQ(numOfBlocked, 1);
+  ASSERT_EQ(numOfWinograd, 1);
+  ASSERT_EQ(algorithm.getNumOfWinograd(2) + algorithm.getNumOfWinograd(4), 1);
+
+  // Both compute what the convolutions do.
+  std::vector<float> input(GetNumOfElements(*cg.getValue<Tensor>("x")));
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 13) / 4 - 1;
+  std::vector<float> actual = Interpret(cg, input, "r");
+  std::vector<float> answer = Interpret(expected, input, "r");
+  ASSERT_EQ(actual.size(), answer.size());
+  for (size_t i = 0; i < actual.size(); ++i)
+    EXPECT_TRUE(std::fabs(actual[i] - answer[i]) <=
+                1e-3 * std::max(1.f, std::fabs(answer[i])));
+}
+
+SKYPAT_F(X86CodeEmitTest, float16_bias_is_widened)
+{
+  Module module, reference;
+  ComputeGraph& cg = CreateHalfConv(module, false);
+  ComputeGraph& expected = CreateHalfConv(reference, true);
+
+  X86WidenWeights widen;
+  ASSERT_TRUE(Pass::kModuleChanged == widen.runOnModule(module));
+  ASSERT_EQ(widen.getNumOfWideWeights(), 1);
+
+  // The conv_mixed kernel reads W in float16; the bias is read in float.
+  Conv* conv = nullptr;
+  for (ComputeOperator& op : cg) {
+    if (nullptr == conv)
+      conv = dyn_cast<Conv>(&op);
+  }
+  ASSERT_TRUE(nullptr != conv);
+  EXPECT_TRUE(Value::kFloat16 == conv->getW()->kind());
+  ASSERT_TRUE(Value::kFloat == conv->getB()->kind());
+  ASSERT_TRUE(expected.getValue<FloatTensor>("b")->getValues() ==
+              static_cast<FloatTensor*>(conv->getB())->getValues());
+  ASSERT_TRUE(nullptr == cg.getValue("bh"));
+
+  std::vector<float> input(GetNumOfElements(*cg.getValue<Tensor>("x")));
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 11) / 4 - 1;
+  std::vector<float> actual = Interpret(cg, input, "y");
+  std::vector<float> answer = Interpret(expected, input, "y");
+  ASSERT_EQ(actual.size(), answer.size());
+  for (size_t i = 0; i < actual.size(); ++i)
+    EXPECT_TRUE(std::fabs(actual[i] - answer[i]) <=
+                1e-4 * std::max(1.f, std::fabs(answer[i])));
+}
+
+SKYPAT_F(X86CodeEmitTest, emitted_model_matches_interpreter)
+{
+  Module module;
+  ComputeGraph& cg = CreateTinyModel(module);
+
+  Path output(BUILDDIR);
+  output.append("X86CodeEmitTest.c");
+  TargetOptions options;
+  X86Backend backend(options);
+  PassRegistry registry;
+  PassManager pm(registry);
+  backend.addMemAlloc(pm);
+  backend.addCodeEmit(pm, output);
+  ASSERT_TRUE(pm.run(module));
+
+  // Inputs, in the order of the InputOperators.
+  const char* inputNames[] = { "x", "a" };
+  std::vector<std::vector<float> > inputs;
+  std::string inputFiles;
+  for (const char* name : inputNames) {
+    Tensor* input = cg.getValue<Tensor>(name);
+    std::vector<float> values(GetNumOfElements(*input));
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<float>(i % 11) / 4 - 1;
+    Path file(output.native() + "." + name);
+    std::ofstream ofs(file.native(), std::ios::binary);
+    ofs.write(reinterpret_cast<const char*>(values.data()),
+              values.size() * sizeof(float));
+    ASSERT_TRUE(ofs.good());
+    inputFiles += " " + Quote(file.native());
+    inputs.push_back(values);
+  }
+
+  // In-place fusion may have renamed the outputs, so ask OutputOperator.
+  std::vector<Value*> outputs;
+  for (ComputeOperator& op : cg) {
+    if (isa<OutputOperator>(&op)) {
+      for (unsigned int i = 0; i < op.getNumOfInputs(); ++i)
+        outputs.push_back(op.getInput(i));
+    }
+  }
+  ASSERT_EQ(outputs.size(), 2);
+
+  // Run the interpreter over the same graph, every value in its own buffer.
+  std::vector<std::vector<float> > buffers;
+  Interpreter interpreter;
+  for (ComputeOperator& op : cg) {
+    for (unsigned int i = 0; i < op.getNumOfOutputs(); ++i) {
+      Value* v = op.getOutput(i);
+      if (interpreter.m_ATable.count(v))
+        continue;
+      if (Initializer* init = dyn_cast<Initializer>(&op)) {
+        FloatTensor* weight = init->getTensor<FloatTensor>();
+        interpreter.m_ATable[v] = weight->getValues().data();
+        continue;
+      }
+      buffers.emplace_back(GetNumOfElements(*static_cast<Tensor*>(v)));
+      interpreter.m_ATable[v] = buffers.back().data();
+    }
+  }
+  for (size_t i = 0; i < inputs.size(); ++i)
+    interpreter.m_ATable[cg.getValue(inputNames[i])] = inputs[i].data();
+  for (ComputeOperator& op : cg)
+    op.accept(interpreter);
+  void* context = ONNC_RUNTIME_init_runtime();
+  interpreter.m_Plan.run(context);
+  ONNC_RUNTIME_shutdown_runtime(context);
+
+  // Build the emitted model with its driver and ONNC Runtime.
+  Path binary(output.native() + ".exe");
+  std::string runtime = std::string(TOPDIR) + "/lib/Runtime";
+  const char* cc = getenv("CC");
+  std::string command = std::string(nullptr != cc ? cc : "cc") +
+      " -std=gnu99 -O2 -Wall -Werror -DONNC_MODEL_DRIVER -I" + Quote(TOPDIR) +
+      "/include " + Quote(output.native()) + " " + Quote(runtime) +
+      "/onnc-runtime.c " + Quote(runtime) + "/internal/*.c " +
+      Quote(runtime) + "/operator/*.c -lm -lpthread -o " +
+      Quote(binary.native());
+  ASSERT_EQ(std::system(command.c_str()), 0);
+
+  // The driver prints every output on a line.
+  command = Quote(binary.native()) + " " + Quote(output.native() + ".weight") +
+            inputFiles;
+  FILE* pipe = popen(command.c_str(), "r");
+  ASSERT_TRUE(nullptr != pipe);
+  std::string printed;
+  char chunk[4096];
+  while (size_t size = fread(chunk, 1, sizeof(chunk), pipe))
+    printed.append(chunk, size);
+  ASSERT_EQ(pclose(pipe), 0);
+
+  std::istringstream lines(printed);
+  for (Value* v : outputs) {
+    std::string line;
+    ASSERT_TRUE(std::getline(lines, line));
+    std::istringstream words(line);
+    const float* expected =
+        static_cast<const float*>(interpreter.m_ATable[v]);
+    size_t size = GetNumOfElements(*static_cast<Tensor*>(v));
+    for (size_t i = 0; i < size; ++i) {
+      float value = 0;
+      ASSERT_TRUE(words >> value);
+      // %g keeps six significant digits.
+      EXPECT_TRUE(std::fabs(value - expected[i]) <=
+                  1e-4 * std::max(1.f, std::fabs(expected[i])));
+    }
+    float extra = 0;
+    ASSERT_FALSE(words >> extra);
+  }
+}
+
+SKYPAT_F(X86CodeEmitTest, constant_fails_to_emit)
+{
+  Module module;
+  IRBuilder builder(module);
+  ComputeGraph& cg = *builder.CreateComputeGraph("Constant");
+  cg.addOperator<Constant>(TensorAttr())
+    ->addOutput(*CreateFloatComputeTensor(cg, "k", {2, 2}));
+  CreateComputeOperator<OutputOperator>(cg, {"k"});
+
+  // The tensor attribute has no values, so there is no call to emit.
+  Path output(BUILDDIR);
+  output.append("X86CodeEmitTest.constant.c");
+  X86CodeEmit emit(output);
+  ASSERT_TRUE(Pass::kPassFailure == emit.runOnModule(module));
+  std::remove(output.c_str());
+  std::remove((output.native() + ".weight").c_str());
+}